@@ -0,0 +1,138 @@
+#
+# Makefile for the Virtual Jaguar core fuzzing harness
+#
+# by Jean-Paul Mari
+#
+# This software is licensed under the GPL v3 or any later version. See the
+# file LICENSE file for details. ;-)
+#
+# The core & the 68K sources are built with the coverage and the sanitizers,
+# and linked with libFuzzer:
+#     make -f corefuzz.mak
+#     ./corefuzz corpus/
+# AFL++ uses its own compilers and libFuzzer driver:
+#     make -f corefuzz.mak CC=afl-clang-fast CXX=afl-clang-fast++ FUZZ_LINK=-fsanitize=fuzzer
+# Without libFuzzer, the inputs given on the command line are run:
+#     make -f corefuzz.mak STANDALONE=1
+#     ./corefuzz -runs=100 inputs/*
+#
+
+ifeq ("$(V)","1")
+Q :=
+else
+Q := @
+endif
+
+ifeq ("$(STANDALONE)","1")
+FUZZ_CFLAGS = -fsanitize=address,undefined -DCORE_FUZZ_STANDALONE
+FUZZ_LINK  ?= -fsanitize=address,undefined
+else
+CC         := clang
+CXX        := clang++
+FUZZ_CFLAGS = -fsanitize=fuzzer-no-link,address,undefined
+FUZZ_LINK  ?= -fsanitize=fuzzer,address,undefined
+endif
+
+SDL_CFLAGS = `sdl-config --cflags`
+SDL_LIBS   = `sdl-config --libs`
+QT_CFLAGS  = -fPIC $(shell pkg-config --cflags Qt5Widgets)
+QT_LIBS    = $(shell pkg-config --libs Qt5Widgets)
+DEFINES    = -D__GCCUNIX__ -DCORE_FUZZ
+CFLAGS     = -O1 -g -fno-omit-frame-pointer $(FUZZ_CFLAGS)
+CXXFLAGS   = $(CFLAGS)
+
+INCS := -I./src -I./src/m68000 -I./src/m68000/obj
+
+OBJDIR := obj/fuzz
+
+CORE_OBJS := \
+	$(OBJDIR)/asi.o          \
+	$(OBJDIR)/blitter.o      \
+	$(OBJDIR)/bus.o          \
+	$(OBJDIR)/cdintf.o       \
+	$(OBJDIR)/cdrom.o        \
+	$(OBJDIR)/corefuzz.o     \
+	$(OBJDIR)/crc32.o        \
+	$(OBJDIR)/dac.o          \
+	$(OBJDIR)/debugport.o    \
+	$(OBJDIR)/dsp.o          \
+	$(OBJDIR)/eeprom.o       \
+	$(OBJDIR)/event.o        \
+	$(OBJDIR)/fastreset.o    \
+	$(OBJDIR)/filedb.o       \
+	$(OBJDIR)/frametiming.o  \
+	$(OBJDIR)/gpu.o          \
+	$(OBJDIR)/hooks.o        \
+	$(OBJDIR)/hosttuning.o   \
+	$(OBJDIR)/interrupt.o    \
+	$(OBJDIR)/jagbios.o      \
+	$(OBJDIR)/jagbios2.o     \
+	$(OBJDIR)/jagcdbios.o    \
+	$(OBJDIR)/jagdevcdbios.o \
+	$(OBJDIR)/jagstub1bios.o \
+	$(OBJDIR)/jagstub2bios.o \
+	$(OBJDIR)/jagdasm.o      \
+	$(OBJDIR)/jaguar.o       \
+	$(OBJDIR)/jerry.o        \
+	$(OBJDIR)/joystick.o     \
+	$(OBJDIR)/log.o          \
+	$(OBJDIR)/memory.o       \
+	$(OBJDIR)/memtrack.o     \
+	$(OBJDIR)/mmu.o          \
+	$(OBJDIR)/modelsBIOS.o   \
+	$(OBJDIR)/op.o           \
+	$(OBJDIR)/opcodestats.o  \
+	$(OBJDIR)/reverse.o      \
+	$(OBJDIR)/sanitizer.o    \
+	$(OBJDIR)/scripting.o    \
+	$(OBJDIR)/state.o        \
+	$(OBJDIR)/tom.o          \
+	$(OBJDIR)/universalhdr.o \
+	$(OBJDIR)/unwind.o       \
+	$(OBJDIR)/watchpoint.o   \
+	$(OBJDIR)/wavetable.o
+
+M68K_OBJS := \
+	$(OBJDIR)/m68k/cpustbl.o \
+	$(OBJDIR)/m68k/cpudefs.o \
+	$(OBJDIR)/m68k/cpuemu.o \
+	$(OBJDIR)/m68k/cpuextra.o \
+	$(OBJDIR)/m68k/readcpu.o \
+	$(OBJDIR)/m68k/m68kinterface.o \
+	$(OBJDIR)/m68k/m68kdasm.o
+
+# Targets for convenience sake, not "real" targets
+.PHONY: clean
+
+all: corefuzz
+	@echo "Done!"
+
+$(OBJDIR):
+	@mkdir -p $(OBJDIR)/m68k
+
+# The 68K generated sources, from the 68K core makefile (host compiler, no sanitizers)
+src/m68000/obj/cpustbl.c src/m68000/obj/cpudefs.c src/m68000/obj/cpuemu.c:
+	$(Q)$(MAKE) -C src/m68000 CROSS= CFLAGS="-O2" V="$(V)" obj obj/cpuemu.c
+
+corefuzz: $(OBJDIR) $(CORE_OBJS) $(M68K_OBJS)
+	@echo -e "\033[01;33m***\033[00;32m Linking the core fuzzing harness...\033[00m"
+	$(Q)$(CXX) $(FUZZ_LINK) $(CORE_OBJS) $(M68K_OBJS) -o corefuzz $(SDL_LIBS) $(QT_LIBS) -lz
+
+# Main source compilation (implicit rules)...
+
+$(OBJDIR)/%.o: src/%.cpp
+	@echo -e "\033[01;33m***\033[00;32m Compiling $<...\033[00m"
+	$(Q)$(CXX) -MMD $(CXXFLAGS) $(SDL_CFLAGS) $(QT_CFLAGS) $(DEFINES) $(INCS) -c $< -o $@
+
+$(OBJDIR)/m68k/%.o: src/m68000/%.c
+	@echo -e "\033[01;33m***\033[00;32m Compiling $<...\033[00m"
+	$(Q)$(CC) -MMD $(CFLAGS) $(SDL_CFLAGS) $(INCS) -c $< -o $@
+
+$(OBJDIR)/m68k/%.o: src/m68000/obj/%.c
+	@echo -e "\033[01;33m***\033[00;32m Compiling $<...\033[00m"
+	$(Q)$(CC) -MMD $(CFLAGS) $(SDL_CFLAGS) $(INCS) -c $< -o $@
+
+clean:
+	@-rm -rf $(OBJDIR) corefuzz
+
+-include $(OBJDIR)/*.d $(OBJDIR)/m68k/*.d
@@ -0,0 +1,103 @@
+#
+# Makefile for the Virtual Jaguar core tests
+#
+# by Jean-Paul Mari
+#
+# This software is licensed under the GPL v3 or any later version. See the
+# file LICENSE file for details. ;-)
+#
+# The tests are linked with the core & the 68K libraries (make libs), with the
+# debugger managers used by the variables tests:
+#     make test
+#     ./coretest [-l] [test...]
+#
+
+ifeq ("$(V)","1")
+Q :=
+else
+Q := @
+endif
+
+# The core library may use libcdio & the Lua scripting
+ifneq "$(shell pkg-config --silence-errors --libs libcdio)" ""
+CDIOLIB  := -lcdio
+else
+CDIOLIB  :=
+endif
+
+ifneq "$(shell pkg-config --silence-errors --libs lua5.3)" ""
+LUA_LIBS := $(shell pkg-config --libs lua5.3)
+else
+LUA_LIBS :=
+endif
+
+CC         := $(CROSS)gcc
+CXX        := $(CROSS)g++
+SDL_CFLAGS = `$(CROSS)sdl-config --cflags`
+SDL_LIBS   = `$(CROSS)sdl-config --libs`
+QT_CFLAGS  = -fPIC $(shell pkg-config --cflags Qt5Widgets)
+QT_LIBS    = $(shell pkg-config --libs Qt5Widgets)
+DEFINES    = -D__GCCUNIX__
+CFLAGS    ?= -O2
+CXXFLAGS  ?= -O2
+
+INCS := -I./src -I./src/m68000 -I./src/tests -I/usr/include/libdwarf
+
+OBJDIR := obj/coretest
+
+OBJS := \
+	$(OBJDIR)/crc32.o                   \
+	$(OBJDIR)/LEB128.o                  \
+	$(OBJDIR)/log.o                     \
+	$(OBJDIR)/unzip.o                   \
+	$(OBJDIR)/debugger/DBGManager.o     \
+	$(OBJDIR)/debugger/DWARFManager.o   \
+	$(OBJDIR)/debugger/ELFManager.o     \
+	$(OBJDIR)/debugger/HWLABELManager.o \
+	$(OBJDIR)/debugger/VARPROGManager.o \
+	$(OBJDIR)/tests/asi.o               \
+	$(OBJDIR)/tests/beampoll.o          \
+	$(OBJDIR)/tests/butch.o             \
+	$(OBJDIR)/tests/bus.o               \
+	$(OBJDIR)/tests/coretest.o          \
+	$(OBJDIR)/tests/debugport.o         \
+	$(OBJDIR)/tests/flags.o             \
+	$(OBJDIR)/tests/hooks.o             \
+	$(OBJDIR)/tests/interrupt.o         \
+	$(OBJDIR)/tests/jerrytimers.o       \
+	$(OBJDIR)/tests/opspec.o            \
+	$(OBJDIR)/tests/registers.o         \
+	$(OBJDIR)/tests/reverse.o           \
+	$(OBJDIR)/tests/riscmath.o          \
+	$(OBJDIR)/tests/sanitizer.o         \
+	$(OBJDIR)/tests/state.o             \
+	$(OBJDIR)/tests/unwind.o            \
+	$(OBJDIR)/tests/unzip.o             \
+	$(OBJDIR)/tests/varprog.o           \
+	$(OBJDIR)/tests/watchpoint.o
+
+LIBS := obj/libjaguarcore.a obj/libm68k.a
+
+# Targets for convenience sake, not "real" targets
+.PHONY: clean
+
+all: coretest
+	@echo "Done!"
+
+$(OBJDIR):
+	@mkdir -p $(OBJDIR)/debugger $(OBJDIR)/tests
+
+coretest: $(OBJDIR) $(OBJS) $(LIBS)
+	@echo -e "\033[01;33m***\033[00;32m Linking the core tests...\033[00m"
+	$(Q)$(CXX) $(OBJS) $(LIBS) -o coretest $(SDL_LIBS) $(QT_LIBS) $(CDIOLIB) $(LUA_LIBS) -lelf -ldwarf -lz -pthread
+
+# Main source compilation (implicit rules)...
+
+$(OBJDIR)/%.o: src/%.cpp
+	@echo -e "\033[01;33m***\033[00;32m Compiling $<...\033[00m"
+	$(Q)$(CXX) -MMD $(CXXFLAGS) $(SDL_CFLAGS) $(QT_CFLAGS) $(DEFINES) $(INCS) -c $< -o $@
+
+clean:
+	@-rm -rf $(OBJDIR) coretest
+
+-include $(OBJDIR)/*.d $(OBJDIR)/debugger/*.d $(OBJDIR)/tests/*.d
@@ -0,0 +1,35 @@
+/*
+ * vjdebugport.h - Virtual Jaguar guest debug port, for the 68K C programs
+ *
+ * The port is on when the emulator has the "Guest debug port" setting, and
+ * always in the headless runner; VJ_DEBUG_PRESENT() tells it. The writes
+ * elsewhere (a real Jaguar) go to the unmapped space and are lost. Each
+ * write costs the bus cycles of a plain 68K write.
+ *
+ *     VJ_DEBUG_STRING("score = "); VJ_DEBUG_DEC(score); VJ_DEBUG_CHAR('\n');
+ *     VJ_DEBUG_BEGIN(1); DrawScene(); VJ_DEBUG_END(1);
+ *     VJ_DEBUG_ASSERT(lives >= 0);
+ */
+
+#ifndef __VJDEBUGPORT_H__
+#define __VJDEBUGPORT_H__
+
+#define VJ_DEBUG_BASE		0xFFFF00
+#define VJ_DEBUG_ID			0x564A
+
+#define VJ_DEBUG_REG8(o)	(*(volatile unsigned char *)(VJ_DEBUG_BASE + (o) + 1))
+#define VJ_DEBUG_REG16(o)	(*(volatile unsigned short *)(VJ_DEBUG_BASE + (o)))
+#define VJ_DEBUG_REG32(o)	(*(volatile unsigned long *)(VJ_DEBUG_BASE + (o)))
+
+#define VJ_DEBUG_PRESENT()	(VJ_DEBUG_REG16(0x00) == VJ_DEBUG_ID)
+#define VJ_DEBUG_CHAR(c)	(VJ_DEBUG_REG8(0x00) = (unsigned char)(c))
+#define VJ_DEBUG_HEX(v)		(VJ_DEBUG_REG32(0x04) = (unsigned long)(v))
+#define VJ_DEBUG_DEC(v)		(VJ_DEBUG_REG32(0x08) = (unsigned long)(v))
+#define VJ_DEBUG_STRING(s)	(VJ_DEBUG_REG32(0x0C) = (unsigned long)(s))
+#define VJ_DEBUG_BEGIN(id)	(VJ_DEBUG_REG32(0x10) = (unsigned long)(id))
+#define VJ_DEBUG_END(id)	(VJ_DEBUG_REG32(0x14) = (unsigned long)(id))
+
+/* The failed condition is the message, the source line is the identifier */
+#define VJ_DEBUG_ASSERT(c)	do { if (!(c)) { VJ_DEBUG_STRING(__FILE__ ": " #c); VJ_DEBUG_REG32(0x18) = __LINE__; } } while (0)
+
+#endif	/* __VJDEBUGPORT_H__ */
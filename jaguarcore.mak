@@ -37,6 +37,15 @@ HAVECDIO :=
 CDIOLIB  :=
 endif
 
+# Set vars for the Lua scripting
+ifneq "$(shell pkg-config --silence-errors --libs lua5.3)" ""
+HAVELUA     := -DHAVE_LIB_LUA
+LUA_CFLAGS  := $(shell pkg-config --cflags lua5.3)
+else
+HAVELUA     :=
+LUA_CFLAGS  :=
+endif
+
 CC      := $(CROSS)gcc
 LD      := $(CROSS)gcc
 AR      := $(CROSS)ar
@@ -44,21 +53,29 @@ ARFLAGS := -rs
 
 SDL_CFLAGS = `$(CROSS)sdl-config --cflags`
 QT_CFLAGS = -fPIC -I/usr/include/qt5 -I/usr/include/qt5/QtOpenGL -I/usr/include/qt5/QtWidgets -I/usr/include/qt5/QtGui -I/usr/include/qt5/QtCore
-DEFINES = -D$(SYSTYPE)
+DEFINES = -D$(SYSTYPE) $(HAVELUA)
 GCC_DEPS = -MMD
 
-INCS := -I./src
+INCS := -I./src $(LUA_CFLAGS)
 
 OBJS := \
+	obj/asi.o          \
 	obj/blitter.o      \
+	obj/bus.o          \
 	obj/cdintf.o       \
 	obj/cdrom.o        \
 	obj/dac.o          \
+	obj/debugport.o    \
 	obj/dsp.o          \
 	obj/eeprom.o       \
 	obj/event.o        \
+	obj/fastreset.o    \
 	obj/filedb.o       \
+	obj/frametiming.o  \
 	obj/gpu.o          \
+	obj/hooks.o        \
+	obj/hosttuning.o   \
+	obj/interrupt.o    \
 	obj/jagbios.o      \
 	obj/jagbios2.o     \
 	obj/jagcdbios.o    \
@@ -74,9 +91,15 @@ OBJS := \
 	obj/mmu.o          \
 	obj/modelsBIOS.o   \
 	obj/op.o           \
+	obj/opcodestats.o  \
+	obj/reverse.o      \
+	obj/sanitizer.o    \
+	obj/scripting.o    \
 	obj/state.o        \
 	obj/tom.o          \
 	obj/universalhdr.o \
+	obj/unwind.o       \
+	obj/watchpoint.o   \
 	obj/wavetable.o
 
 # Targets for convenience sake, not "real" targets
@@ -0,0 +1,724 @@
+//
+// JERRY asynchronous serial interface
+//
+// The UART has a transmit buffer in front of its shift register, and a
+// receive buffer. ASICLK divides the system clock for the 16x receiver clock,
+// so a character (start, 8 data, parity, stop bits) takes 160 (176 with the
+// parity) system clocks per ASICLK + 1. The characters are timed by two
+// events of the main list, where the 68K reaches the registers: the end of
+// the transmission of the shift register, and the arrival of the next
+// received character.
+//
+// The host end of the line is a pseudo-terminal (in raw mode) or a UNIX
+// socket (one client at a time), served by a non-blocking I/O thread through
+// two lock-free byte queues. The line is flow controlled: a character is only
+// received when the receive buffer is empty, and the transmission waits when
+// the host queue is full, so nothing is dropped, and the overrun, framing and
+// parity errors never happen. The host end needs a Linux host; without it,
+// the characters sent are lost and none is received.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Callbacks translated in the save state events
+// JPM   Oct./2026  Debugger reads without side effects, wake up pipe closed on a socket path too long
+// JPM   Oct./2026  UART buffers & shift register in the save state
+//
+
+#include "asi.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include "event.h"
+#include "interrupt.h"
+#include "jerry.h"
+#include "log.h"
+#include "memory.h"
+#include "state.h"
+#include "tom.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#define ASI_HOST
+#endif
+
+#define ASI_RING_SIZE		0x10000						// Host queues size, a power of 2
+#define ASI_OVERSAMPLING	16							// System clocks per bit, for ASICLK = 0
+#define ASI_CTRL_MASK		(ASI_CTRL_TXBRK | 0x003F)	// Control bits kept, and read back in the status
+
+// Bytes queue between the emulation & the host I/O thread (one producer, one consumer)
+struct ASIRing
+{
+	uint8_t data[ASI_RING_SIZE];
+	std::atomic<uint32_t> head, tail;
+};
+
+static ASIRing asiRx, asiTx;						// From the host, to the host
+
+static uint16_t asiCtrl, asiClk;
+static uint8_t asiRxData, asiTxData, asiTxShift;
+static bool asiRxFull, asiTxFull, asiTxShifting;
+static double asiRxLast;							// Main list time of the last character received
+
+static bool asiHostOpen = false;
+static char asiHostSetting[MAX_PATH];				// Setting of the opened host end
+static char asiHostName[MAX_PATH];					// Pseudo-terminal slave name, or socket path
+
+#ifdef ASI_HOST
+static int asiHostFd = -1;							// Pseudo-terminal master, or socket client (-1 without client)
+static int asiListenFd = -1;
+static int asiPtySlaveFd = -1;						// Kept open, so the line stays up without a client
+static int asiWakePipe[2] = { -1, -1 };
+static std::thread * asiHostThread = NULL;			// Not a static object, a process exit does not join it
+static std::atomic<bool> asiHostQuit(false), asiHostSleeping(false);
+#endif
+
+static void ASIHostClose(void);
+
+
+//
+static inline uint32_t ASIRingCount(ASIRing & ring)
+{
+	return ring.head.load(std::memory_order_acquire) - ring.tail.load(std::memory_order_acquire);
+}
+
+
+//
+static bool ASIRingPut(ASIRing & ring, uint8_t c)
+{
+	uint32_t head = ring.head.load(std::memory_order_relaxed);
+
+	if ((head - ring.tail.load(std::memory_order_acquire)) == ASI_RING_SIZE)
+	{
+		return false;
+	}
+
+	ring.data[head & (ASI_RING_SIZE - 1)] = c;
+	ring.head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+
+//
+static bool ASIRingGet(ASIRing & ring, uint8_t * c)
+{
+	uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+
+	if (tail == ring.head.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	*c = ring.data[tail & (ASI_RING_SIZE - 1)];
+	ring.tail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+
+//
+// Wake the host I/O thread up, if it sleeps without anything to send
+//
+static void ASIHostWake(void)
+{
+#ifdef ASI_HOST
+	char c = 0;
+
+	if (asiHostSleeping.exchange(false) && (write(asiWakePipe[1], &c, 1) < 0))
+	{
+		WriteLog("ASI: Cannot wake the host I/O thread up\n");
+	}
+#endif
+}
+
+
+#ifdef ASI_HOST
+//
+// Host bytes read into the receive queue, false if the client is gone
+//
+static bool ASIHostReceive(void)
+{
+	uint32_t head = asiRx.head.load(std::memory_order_relaxed);
+	uint32_t index = head & (ASI_RING_SIZE - 1);
+	uint32_t room = ASI_RING_SIZE - (head - asiRx.tail.load(std::memory_order_acquire));
+	ssize_t count = read(asiHostFd, &asiRx.data[index], ((room < (ASI_RING_SIZE - index)) ? room : (ASI_RING_SIZE - index)));
+
+	if (count > 0)
+	{
+		asiRx.head.store(head + (uint32_t)count, std::memory_order_release);
+		return true;
+	}
+
+	return ((count < 0) && ((errno == EAGAIN) || (errno == EINTR)));
+}
+
+
+//
+// Transmit queue written to the host, false if the client is gone
+//
+static bool ASIHostSend(void)
+{
+	uint32_t tail = asiTx.tail.load(std::memory_order_relaxed);
+	uint32_t index = tail & (ASI_RING_SIZE - 1);
+	uint32_t pending = asiTx.head.load(std::memory_order_acquire) - tail;
+	uint32_t size = ((pending < (ASI_RING_SIZE - index)) ? pending : (ASI_RING_SIZE - index));
+	// No SIGPIPE from a socket client gone
+	ssize_t count = ((asiListenFd >= 0) ? send(asiHostFd, &asiTx.data[index], size, MSG_NOSIGNAL) : write(asiHostFd, &asiTx.data[index], size));
+
+	if (count > 0)
+	{
+		asiTx.tail.store(tail + (uint32_t)count, std::memory_order_release);
+		return true;
+	}
+
+	return ((count < 0) && ((errno == EAGAIN) || (errno == EINTR)));
+}
+
+
+//
+// Host I/O thread
+// It sleeps until the emulation sends something; a full receive queue is polled for room each ms
+//
+static void ASIHostLoop(void)
+{
+	while (!asiHostQuit.load())
+	{
+		struct pollfd fds[2];
+		uint32_t received = ASIRingCount(asiRx);
+		bool sending = (ASIRingCount(asiTx) != 0);
+		int timeout = -1;
+
+		fds[0].fd = asiWakePipe[0];
+		fds[0].events = POLLIN;
+		fds[1].fd = ((asiHostFd >= 0) ? asiHostFd : asiListenFd);
+		fds[1].events = ((asiHostFd < 0) ? POLLIN : (((received < ASI_RING_SIZE) ? POLLIN : 0) | (sending ? POLLOUT : 0)));
+
+		if (received == ASI_RING_SIZE)
+		{
+			timeout = 1;
+		}
+		else if (!sending)
+		{
+			asiHostSleeping.store(true);
+
+			// Sent since the check
+			if (ASIRingCount(asiTx))
+			{
+				timeout = 0;
+			}
+		}
+
+		int events = poll(fds, 2, timeout);
+		asiHostSleeping.store(false);
+
+		if (events < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			WriteLog("ASI: Host I/O poll failed (%s)\n", strerror(errno));
+			break;
+		}
+
+		if (fds[0].revents & POLLIN)
+		{
+			char buffer[64];
+
+			while (read(asiWakePipe[0], buffer, sizeof(buffer)) > 0)
+				;
+		}
+
+		// Socket client
+		if (asiHostFd < 0)
+		{
+			if ((fds[1].revents & POLLIN) && ((asiHostFd = accept(asiListenFd, NULL, NULL)) >= 0))
+			{
+				fcntl(asiHostFd, F_SETFL, O_NONBLOCK);
+				WriteLog("ASI: Client connected on %s\n", asiHostName);
+			}
+
+			continue;
+		}
+
+		bool connected = true;
+
+		if (fds[1].revents & POLLIN)
+		{
+			connected = ASIHostReceive();
+		}
+
+		if (connected && (fds[1].revents & POLLOUT))
+		{
+			connected = ASIHostSend();
+		}
+
+		if (connected && (fds[1].revents & (POLLERR | POLLHUP)) && !(fds[1].revents & POLLIN))
+		{
+			connected = false;
+		}
+
+		// The bytes not sent yet wait for the next client
+		if (!connected && (asiListenFd >= 0))
+		{
+			close(asiHostFd);
+			asiHostFd = -1;
+			WriteLog("ASI: Client disconnected from %s\n", asiHostName);
+		}
+	}
+}
+#endif
+
+
+//
+// Open the host end of the line, a pseudo-terminal or a UNIX socket
+//
+static bool ASIHostOpen(const char * host)
+{
+	snprintf(asiHostSetting, sizeof(asiHostSetting), "%s", host);
+#ifdef ASI_HOST
+	asiRx.head.store(0);
+	asiRx.tail.store(0);
+	asiTx.head.store(0);
+	asiTx.tail.store(0);
+
+	if (pipe(asiWakePipe) < 0)
+	{
+		WriteLog("ASI: Cannot create the wake up pipe (%s)\n", strerror(errno));
+		return false;
+	}
+
+	fcntl(asiWakePipe[0], F_SETFL, O_NONBLOCK);
+	fcntl(asiWakePipe[1], F_SETFL, O_NONBLOCK);
+
+	if (!strcmp(host, ASI_HOST_PTY))
+	{
+		struct termios tio;
+
+		if (((asiHostFd = posix_openpt(O_RDWR | O_NOCTTY)) < 0) || grantpt(asiHostFd) || unlockpt(asiHostFd) || !ptsname(asiHostFd))
+		{
+			WriteLog("ASI: Cannot create the pseudo-terminal (%s)\n", strerror(errno));
+			ASIHostClose();
+			return false;
+		}
+
+		snprintf(asiHostName, sizeof(asiHostName), "%s", ptsname(asiHostFd));
+
+		// The bytes go through unchanged
+		if (((asiPtySlaveFd = open(asiHostName, O_RDWR | O_NOCTTY)) < 0) || tcgetattr(asiPtySlaveFd, &tio))
+		{
+			WriteLog("ASI: Cannot set the pseudo-terminal %s up (%s)\n", asiHostName, strerror(errno));
+			ASIHostClose();
+			return false;
+		}
+
+		cfmakeraw(&tio);
+		tcsetattr(asiPtySlaveFd, TCSANOW, &tio);
+		fcntl(asiHostFd, F_SETFL, O_NONBLOCK);
+	}
+	else
+	{
+		struct sockaddr_un address;
+
+		if (strlen(host) >= sizeof(address.sun_path))
+		{
+			WriteLog("ASI: Socket path too long: %s\n", host);
+			ASIHostClose();
+			return false;
+		}
+
+		memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+		strcpy(address.sun_path, host);
+		snprintf(asiHostName, sizeof(asiHostName), "%s", host);
+		unlink(host);
+
+		if (((asiListenFd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) || bind(asiListenFd, (struct sockaddr *)&address, sizeof(address)) || listen(asiListenFd, 1))
+		{
+			WriteLog("ASI: Cannot listen on %s (%s)\n", host, strerror(errno));
+			ASIHostClose();
+			return false;
+		}
+
+		fcntl(asiListenFd, F_SETFL, O_NONBLOCK);
+	}
+
+	asiHostQuit.store(false);
+	asiHostThread = new std::thread(ASIHostLoop);
+	asiHostOpen = true;
+	WriteLog("ASI: Serial line on %s\n", asiHostName);
+	return true;
+#else
+	WriteLog("ASI: No serial line host end on this system\n");
+	return false;
+#endif
+}
+
+
+//
+// Close the host end, the bytes not sent are lost
+//
+static void ASIHostClose(void)
+{
+#ifdef ASI_HOST
+	if (asiHostThread)
+	{
+		asiHostQuit.store(true);
+		asiHostSleeping.store(true);
+		ASIHostWake();
+		asiHostThread->join();
+		delete asiHostThread;
+		asiHostThread = NULL;
+	}
+
+	if (asiListenFd >= 0)
+	{
+		close(asiListenFd);
+		unlink(asiHostName);
+	}
+
+	if (asiHostFd >= 0)
+	{
+		close(asiHostFd);
+	}
+
+	if (asiPtySlaveFd >= 0)
+	{
+		close(asiPtySlaveFd);
+	}
+
+	if (asiWakePipe[0] >= 0)
+	{
+		close(asiWakePipe[0]);
+		close(asiWakePipe[1]);
+	}
+
+	asiHostFd = asiListenFd = asiPtySlaveFd = asiWakePipe[0] = asiWakePipe[1] = -1;
+#endif
+	asiHostOpen = false;
+	asiHostSetting[0] = asiHostName[0] = 0;
+}
+
+
+//
+// Name of the host end (pseudo-terminal slave, or socket path), NULL if none
+//
+const char * ASIHostName(void)
+{
+	return (asiHostOpen ? asiHostName : NULL);
+}
+
+
+//
+// Time of a character, in microseconds
+//
+static double ASICharacterTime(void)
+{
+	uint32_t bits = ((asiCtrl & ASI_CTRL_PAREN) ? 11 : 10);
+	return (double)(bits * ASI_OVERSAMPLING * (asiClk + 1)) * (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+}
+
+
+//
+// Receive queue poll period: a character time, not shorter than a halfline
+//
+static double ASIPollTime(void)
+{
+	double halfline = (vjs.hardwareTypeNTSC ? HORIZ_PERIOD_IN_USEC_NTSC : HORIZ_PERIOD_IN_USEC_PAL) / 2.0;
+	double time = ASICharacterTime();
+	return ((time > halfline) ? time : halfline);
+}
+
+
+//
+// Interrupt request, when enabled
+//
+static void ASIInterrupt(uint16_t enable)
+{
+	if ((asiCtrl & enable) && TOMIRQEnabled(IRQ_DSP))
+	{
+		InterruptJERRYRequest(IRQ2_ASI);
+	}
+}
+
+
+//
+// Character loaded in the shift register, the transmit buffer is empty again
+//
+static void ASITxStart(uint8_t c)
+{
+	asiTxShift = c;
+	asiTxShifting = true;
+	SetCallbackTime(ASITxCallback, ASICharacterTime());
+	ASIInterrupt(ASI_CTRL_TINTEN);
+}
+
+
+//
+// Character sent, the next one is taken from the transmit buffer
+//
+void ASITxCallback(void)
+{
+	// Host queue full, the character waits
+	if (asiHostOpen)
+	{
+		if (!ASIRingPut(asiTx, asiTxShift))
+		{
+			SetCallbackTime(ASITxCallback, ASICharacterTime());
+			return;
+		}
+
+		ASIHostWake();
+	}
+
+	asiTxShifting = false;
+
+	if (asiTxFull)
+	{
+		asiTxFull = false;
+		ASITxStart(asiTxData);
+	}
+}
+
+
+//
+// Character received from the host queue, if the receive buffer is empty
+// The next one is looked for when the buffer is read, the queue is polled meanwhile
+//
+void ASIRxCallback(void)
+{
+	if (!asiRxFull && ASIRingGet(asiRx, &asiRxData))
+	{
+		asiRxFull = true;
+		asiRxLast = GetEventListTime(EVENT_MAIN);
+		ASIInterrupt(ASI_CTRL_RINTEN);
+	}
+
+	SetCallbackTime(ASIRxCallback, ASIPollTime());
+}
+
+
+//
+// Receive buffer read, the next character can come a character time after the last one
+// The debugger reads the buffer as it is
+//
+static uint8_t ASIReadData(uint32_t who)
+{
+	if (asiRxFull && (who != DEBUG))
+	{
+		asiRxFull = false;
+
+		if (asiHostOpen)
+		{
+			double wait = asiRxLast + ASICharacterTime() - GetEventListTime(EVENT_MAIN);
+			RemoveCallback(ASIRxCallback);
+			SetCallbackTime(ASIRxCallback, ((wait > 0.0) ? wait : 0.0));
+		}
+	}
+
+	return asiRxData;
+}
+
+
+//
+// ASISTAT, the line is idle (at the mark level)
+//
+static uint16_t ASIReadStatus(void)
+{
+	return (asiCtrl & ASI_CTRL_MASK) | (asiTxFull ? 0 : ASI_STAT_TBE) | (asiRxFull ? ASI_STAT_RBF : 0)
+		| ((asiCtrl & ASI_CTRL_RXIPOL) ? 0 : ASI_STAT_SERIN);
+}
+
+
+//
+// ASIDATA written, a full transmit buffer is overwritten
+//
+static void ASIWriteData(uint8_t data)
+{
+	if (!asiTxShifting)
+	{
+		ASITxStart(data);
+	}
+	else
+	{
+		asiTxData = data;
+		asiTxFull = true;
+	}
+}
+
+
+//
+// ASICTRL written, the interrupts enabled with their condition already true are requested
+//
+static void ASIWriteControl(uint16_t data)
+{
+	uint16_t enabled = data & ~asiCtrl;
+	asiCtrl = data & ASI_CTRL_MASK;
+
+	if ((enabled & ASI_CTRL_TINTEN) && !asiTxFull)
+	{
+		ASIInterrupt(ASI_CTRL_TINTEN);
+	}
+
+	if ((enabled & ASI_CTRL_RINTEN) && asiRxFull)
+	{
+		ASIInterrupt(ASI_CTRL_RINTEN);
+	}
+}
+
+
+//
+// UART reset, the host end is (re)opened when its setting has changed
+// The host queues are kept, as the host does not see the reset
+//
+void ASIReset(void)
+{
+	RemoveCallback(ASITxCallback);
+	RemoveCallback(ASIRxCallback);
+	asiCtrl = asiClk = 0;
+	asiRxData = asiTxData = asiTxShift = 0;
+	asiRxFull = asiTxFull = asiTxShifting = false;
+	asiRxLast = 0.0;
+
+	if (strcmp(asiHostSetting, vjs.asiHost))
+	{
+		ASIHostClose();
+
+		if (vjs.asiHost[0])
+		{
+			ASIHostOpen(vjs.asiHost);
+		}
+	}
+
+	if (asiHostOpen)
+	{
+		SetCallbackTime(ASIRxCallback, ASIPollTime());
+	}
+}
+
+
+//
+void ASIDone(void)
+{
+	ASIHostClose();
+}
+
+
+//
+// UART state, the host end & its queues are not part of it
+//
+size_t asi_dump(FILE *fp)
+{
+	size_t total_dumped = 0;
+
+	DUMP16(asiCtrl);
+	DUMP16(asiClk);
+	DUMP8(asiRxData);
+	DUMP8(asiTxData);
+	DUMP8(asiTxShift);
+	DUMPBOOL(asiRxFull);
+	DUMPBOOL(asiTxFull);
+	DUMPBOOL(asiTxShifting);
+	DUMPDOUBLE(asiRxLast);
+
+	return total_dumped;
+}
+
+
+size_t asi_load(FILE *fp)
+{
+	size_t total_loaded = 0;
+
+	LOAD16(asiCtrl);
+	LOAD16(asiClk);
+	LOAD8(asiRxData);
+	LOAD8(asiTxData);
+	LOAD8(asiTxShift);
+	LOADBOOL(asiRxFull);
+	LOADBOOL(asiTxFull);
+	LOADBOOL(asiTxShifting);
+	LOADDOUBLE(asiRxLast);
+
+	return total_loaded;
+}
+
+
+//
+// Registers ($F10030 - $F10035)
+//
+uint16_t ASIReadWord(uint32_t offset, uint32_t who)
+{
+	switch (offset & 0x06)
+	{
+	case 0:
+		return ASIReadData(who);
+	case 2:
+		return ASIReadStatus();
+	case 4:
+		return asiClk;
+	}
+
+	return 0;
+}
+
+
+//
+uint8_t ASIReadByte(uint32_t offset, uint32_t who)
+{
+	if ((offset & 0x07) == 0)
+	{
+		return 0;
+	}
+
+	uint16_t value = ASIReadWord(offset & ~0x01, who);
+	return (uint8_t)((offset & 0x01) ? value : (value >> 8));
+}
+
+
+//
+void ASIWriteWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	switch (offset & 0x06)
+	{
+	case 0:
+		ASIWriteData(data & 0xFF);
+		break;
+	case 2:
+		ASIWriteControl(data);
+		break;
+	case 4:
+		asiClk = data;
+	}
+}
+
+
+//
+void ASIWriteByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	switch (offset & 0x07)
+	{
+	case 1:
+		ASIWriteData(data);
+		break;
+	case 2:
+	case 3:
+		ASIWriteControl((offset & 0x01) ? ((asiCtrl & 0xFF00) | data) : ((asiCtrl & 0x00FF) | (data << 8)));
+		break;
+	case 4:
+		asiClk = (asiClk & 0x00FF) | (data << 8);
+		break;
+	case 5:
+		asiClk = (asiClk & 0xFF00) | data;
+	}
+}
@@ -0,0 +1,47 @@
+//
+// asi.h: Header file
+//
+// JERRY asynchronous serial interface (UART), with the host end of the line
+// on a pseudo-terminal or a UNIX socket
+//
+
+#ifndef __ASI_H__
+#define __ASI_H__
+
+#include <stdint.h>
+#include "settings.h"
+
+// Host end of the line (vjs.asiHost): "pty" for a pseudo-terminal, or a UNIX socket path
+#define ASI_HOST_PTY		"pty"
+
+// ASICTRL bits (written), the low ones are read back in ASISTAT
+#define ASI_CTRL_ODD		0x0001
+#define ASI_CTRL_PAREN		0x0002
+#define ASI_CTRL_TXOPOL		0x0004
+#define ASI_CTRL_RXIPOL		0x0008
+#define ASI_CTRL_TINTEN		0x0010
+#define ASI_CTRL_RINTEN		0x0020
+#define ASI_CTRL_CLRERR		0x0040
+#define ASI_CTRL_TXBRK		0x4000
+
+// ASISTAT bits (read)
+#define ASI_STAT_RBF		0x0080
+#define ASI_STAT_TBE		0x0100
+#define ASI_STAT_PE			0x0200
+#define ASI_STAT_FE			0x0400
+#define ASI_STAT_OE			0x0800
+#define ASI_STAT_SERIN		0x2000
+#define ASI_STAT_TXBRK		0x4000
+#define ASI_STAT_ERROR		0x8000
+
+extern void ASIReset(void);
+extern void ASIDone(void);
+extern uint8_t ASIReadByte(uint32_t offset, uint32_t who);
+extern uint16_t ASIReadWord(uint32_t offset, uint32_t who);
+extern void ASIWriteByte(uint32_t offset, uint8_t data, uint32_t who);
+extern void ASIWriteWord(uint32_t offset, uint16_t data, uint32_t who);
+extern const char * ASIHostName(void);
+extern void ASITxCallback(void);
+extern void ASIRxCallback(void);
+
+#endif	// __ASI_H__
@@ -16,6 +16,10 @@
 // JLH  01/16/2010  Created this log ;-)
 // JPM  06/06/2016  Visual Studio support
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Phrase mode inner counter always counting (found by the core fuzzing)
+// JPM   Oct./2026  Blitter marked as the bus master for the data watchpoints
+// JPM   Oct./2026  Blits charged to the main bus arbitration
+// JPM   Oct./2026  Fixed the shifts by 64 and the invalid pixel sizes constants (found by the core fuzzing)
 //
 
 //
@@ -32,11 +36,13 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include "bus.h"
 #include "jaguar.h"
 #include "log.h"
 //#include "memory.h"
 #include "settings.h"
 #include "state.h"
+#include "watchpoint.h"
 
 // Various conditional compilation goodies...
 
@@ -1726,6 +1732,37 @@ void BlitterWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 }
 
 
+//
+// Bus cycles of a blit, from its registers at the start
+// Each line is a burst of the destination writes, with the source & the
+// destination reads; when the source & the destination are in different DRAM
+// pages, each access is a page miss
+//
+static uint32_t BlitterBusCycles(uint32_t cmd)
+{
+	uint32_t counter = REG(PIXLINECOUNTER);
+	uint32_t inner = counter & 0xFFFF, outer = counter >> 16;
+	uint32_t dstFlags = REG(DSTA2 ? A2_FLAGS : A1_FLAGS);
+	uint32_t dstBase = REG(DSTA2 ? A2_BASE : A1_BASE), srcBase = REG(DSTA2 ? A1_BASE : A2_BASE);
+	uint32_t pixelBits = 1 << ((dstFlags >> 3) & 0x07);
+	bool phraseMode = (((dstFlags >> 16) & 0x03) == XADDPHR);
+	uint32_t units = (phraseMode ? (((inner * pixelBits) + 63) / 64) : inner);
+	uint32_t accesses = units * (1 + (SRCEN ? 1 : 0) + (DSTEN ? 1 : 0) + (SRCENZ ? 1 : 0) + (DSTENZ ? 1 : 0) + (DSTWRZ ? 1 : 0));
+	uint32_t line;
+
+	if (SRCEN && ((srcBase ^ dstBase) >> BUS_PAGE_SHIFT))
+	{
+		line = accesses * BUS_PAGE_MISS;
+	}
+	else
+	{
+		line = BusBurst(dstBase, accesses);
+	}
+
+	return (line * (outer ? outer : 1));
+}
+
+
 void BlitterWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 {
 /*if (((offset & 0xFF) >= PATTERNDATA) && ((offset & 0xFF) < PATTERNDATA + 8))
@@ -1751,9 +1788,13 @@ doGPUDis = true;
 	BlitterWriteByte(offset + 0, data >> 8, who);
 	BlitterWriteByte(offset + 1, data & 0xFF, who);
 
-	if ((offset & 0xFF) == 0x3A)
 	// I.e., the second write of 32-bit value--not convinced this is the best way to do this!
 	// But then again, according to the Jaguar docs, this is correct...!
+	if ((offset & 0xFF) == 0x3A)
+	{
+		uint32_t master = watchpointMaster;
+		watchpointMaster = BLITTER;
+		BusCharge(BLITTER, BlitterBusCycles(GET32(blitter_ram, 0x38)));
 /*extern int blit_start_log;
 extern bool doGPUDis;
 if (blit_start_log)
@@ -1772,13 +1813,13 @@ if (blit_start_log)
 		BlitterMidsummer2();
 #endif
 #else
-	{
 		if (vjs.useFastBlitter)
 			blitter_blit(GET32(blitter_ram, 0x38));
 		else
 			BlitterMidsummer2();
-	}
 #endif
+		watchpointMaster = master;
+	}
 }
 //F02278,9,A,B
 
@@ -3533,7 +3574,8 @@ for A1
 similarly for A2
 JLH: Also, 11 will likewise set the value to 111
 */
-				uint8_t a1_xconst = 6 - a1_pixsize, a2_xconst = 6 - a2_pixsize;
+// The constants are 3 bits wide (the pixel sizes 6 & 7 are not valid)
+				uint8_t a1_xconst = (6 - a1_pixsize) & 0x07, a2_xconst = (6 - a2_pixsize) & 0x07;
 
 				if (a1addx == 1)
 				    a1_xconst = 0;
@@ -3597,8 +3639,8 @@ it is being updated by one phrase
 Masking is enabled for a1 when a1addx[0..1] is 00, and the value
 is 6 - the pixel size (again!)
 */
-				uint8_t maska1 = (a1_add && a1addx == 0 ? 6 - a1_pixsize : 0);
-				uint8_t maska2 = (a2_add && a2addx == 0 ? 6 - a2_pixsize : 0);
+				uint8_t maska1 = (a1_add && a1addx == 0 ? (6 - a1_pixsize) & 0x07 : 0);
+				uint8_t maska2 = (a2_add && a2addx == 0 ? (6 - a2_pixsize) & 0x07 : 0);
 				uint8_t modx = (a2_add ? maska2 : maska1);
 /* Generate load strobes for the increment updates */
 
@@ -3807,7 +3849,7 @@ Source shifting is disabled when srcen is not set.
 */
 uint8_t dstxp = (dsta2 ? a2_x : a1_x) & 0x3F;
 uint8_t srcxp = (dsta2 ? a1_x : a2_x) & 0x3F;
-uint8_t shftv = ((dstxp - srcxp) << pixsize) & 0x3F;
+uint8_t shftv = ((uint32_t)(dstxp - srcxp) << pixsize) & 0x3F;
 /* The phrase mode alignment count is given by the phrase offset
 of the first pixel, for bit to byte expansion */
 uint8_t pobb = 0;
@@ -4007,6 +4049,8 @@ if (logBlit)
 					inc |= (phrase_mode && (((pixsize == 3 || pixsize == 4) && (inct & 0x02)) || pixsize == 5 && !(inct & 0x01)) ? 0x02 : 0x00);
 					inc |= (phrase_mode && ((pixsize == 3 && (inct & 0x04)) || (pixsize == 4 && !(inct & 0x03))) ? 0x04 : 0x00);
 					inc |= (phrase_mode && pixsize == 3 && !(inct & 0x07) ? 0x08 : 0x00);
+//The pixel sizes below 8 bits are not handled in phrase mode, and the inner loop would never end
+					inc = (inc ? inc : 0x01);
 
 					uint16_t oldicount = icount;	// Save icount to detect underflow...
 					icount -= inc;
@@ -4127,10 +4171,8 @@ if (phrase_mode && !dsten)
 //Now it does!
 
 // srcd2 = xxxx xxxx 0123 4567, srcd = 8901 2345 xxxx xxxx, srcshift = $20 (32)
-uint64_t srcd = (srcd2 << (64 - srcshift)) | (srcd1 >> srcshift);
-//bleh, ugly ugly ugly
-if (srcshift == 0)
-	srcd = srcd1;
+//bleh, ugly ugly ugly (a shift by 64 is undefined)
+uint64_t srcd = (srcshift ? (srcd2 << (64 - srcshift)) | (srcd1 >> srcshift) : srcd1);
 
 //NOTE: This only works with pixel sizes less than 8BPP...
 //DOUBLE NOTE: Still need to do regression testing to ensure that this doesn't break other stuff... !!! CHECK !!!
@@ -4171,10 +4213,8 @@ if (logBlit)
 }
 
 uint8_t zSrcShift = srcshift & 0x30;
-srcz = (srcz2 << (64 - zSrcShift)) | (srcz1 >> zSrcShift);
-//bleh, ugly ugly ugly
-if (zSrcShift == 0)
-	srcz = srcz1;
+//bleh, ugly ugly ugly (a shift by 64 is undefined)
+srcz = (zSrcShift ? (srcz2 << (64 - zSrcShift)) | (srcz1 >> zSrcShift) : srcz1);
 
 #if 0//def VERBOSE_BLITTER_LOGGING
 if (logBlit)
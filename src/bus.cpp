@@ -0,0 +1,223 @@
+//
+// Main bus arbitration
+//
+// The 68K, the GPU, the DSP, the blitter and the Object Processor share the
+// main bus, but each of them runs as if it had it for itself. With the
+// arbitration on, each master charges the bus cycles of its accesses, in
+// bursts: the 68K & the GPU at the end of their slices, the DSP at the end of
+// its slices on the audio thread, the blitter at the start of a blit (from its
+// registers), and the Object Processor at the end of a halfline (from its
+// objects). The accesses are never charged one by one.
+//
+// At each halfline, the budget of the halfline is granted in the hardware
+// priority order (OP, DSP, GPU, blitter, then 68K; the DMA and high priority
+// modes are not modelled). The blitter & OP transfers not granted go on over
+// the next halflines; the cycles not granted to an executor are stalled at the
+// start of its next slices, so it runs fewer cycles in the same time. The
+// stalled time still wants the bus, and is charged again.
+//
+// The DRAM costs are a page miss for the first phrase of a burst and for each
+// page crossed, and a page hit for the other phrases.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Requests, transfers not granted & stalls in the save state
+//
+
+#include "bus.h"
+
+#include <atomic>
+#include <string.h>
+#include "event.h"
+#include "memory.h"
+#include "state.h"
+
+// Requests carried over, and stalls, are limited to a frame of bus cycles
+#define BUS_PENDING_MAX		(525 * 846)
+
+uint32_t busAccesses[BUS_MASTERS];
+
+static std::atomic<uint32_t> busRequested[BUS_MASTERS];
+static std::atomic<uint32_t> busStalls[BUS_MASTERS];
+static uint32_t busPending[BUS_MASTERS];				// Blitter & OP transfers not granted yet
+static BusStats busStats;
+
+// Priority order, from the highest
+static const uint32_t busPriority[] = { OP, DSP, GPU, BLITTER, M68K };
+
+
+//
+void BusReset(void)
+{
+	for (uint32_t i = 0; i < BUS_MASTERS; i++)
+	{
+		busRequested[i].store(0, std::memory_order_relaxed);
+		busStalls[i].store(0, std::memory_order_relaxed);
+	}
+
+	memset(busAccesses, 0, sizeof(busAccesses));
+	memset(busPending, 0, sizeof(busPending));
+	memset(&busStats, 0, sizeof(busStats));
+}
+
+
+size_t bus_dump(FILE *fp)
+{
+	size_t total_dumped = 0;
+
+	for (uint32_t i = 0; i < BUS_MASTERS; i++)
+	{
+		DUMP32(busRequested[i].load(std::memory_order_relaxed));
+		DUMP32(busStalls[i].load(std::memory_order_relaxed));
+	}
+
+	DUMPARR32(busPending);
+
+	return total_dumped;
+}
+
+
+size_t bus_load(FILE *fp)
+{
+	size_t total_loaded = 0;
+	uint32_t requested, stalls;
+
+	for (uint32_t i = 0; i < BUS_MASTERS; i++)
+	{
+		LOAD32(requested);
+		LOAD32(stalls);
+		busRequested[i].store(requested, std::memory_order_relaxed);
+		busStalls[i].store(stalls, std::memory_order_relaxed);
+	}
+
+	LOADARR32(busPending);
+	memset(busAccesses, 0, sizeof(busAccesses));
+
+	return total_loaded;
+}
+
+
+//
+// RISC cycles of a burst of phrases
+//
+uint32_t BusBurst(uint32_t address, uint32_t phrases)
+{
+	if (!phrases)
+	{
+		return 0;
+	}
+
+	address &= ~0x07;
+	uint32_t misses = 1 + (((address + (phrases * 8) - 1) >> BUS_PAGE_SHIFT) - (address >> BUS_PAGE_SHIFT));
+	return ((misses * BUS_PAGE_MISS) + ((phrases - misses) * BUS_PAGE_HIT));
+}
+
+
+//
+// Charge the bus cycles of a master, in its own clock (the 68K runs at the half of the RISC clock)
+//
+void BusCharge(uint32_t who, uint32_t cycles)
+{
+	if (vjs.busArbitration && cycles)
+	{
+		busRequested[who].fetch_add((who == M68K) ? (cycles * 2) : cycles, std::memory_order_relaxed);
+	}
+}
+
+
+//
+// Charge the external accesses counted along a GPU or DSP slice, they are taken as page misses
+//
+void BusChargeAccesses(uint32_t who)
+{
+	BusCharge(who, busAccesses[who] * BUS_PAGE_MISS);
+	busAccesses[who] = 0;
+}
+
+
+//
+// Cycles of a slice the master has to wait for the bus, in its own clock
+//
+uint32_t BusStall(uint32_t who, uint32_t cycles)
+{
+	if (!vjs.busArbitration)
+	{
+		return 0;
+	}
+
+	uint32_t scale = ((who == M68K) ? 2 : 1);
+	uint32_t stall = busStalls[who].load(std::memory_order_relaxed) / scale;
+	stall = ((stall < cycles) ? stall : cycles);
+
+	if (stall)
+	{
+		busStalls[who].fetch_sub(stall * scale, std::memory_order_relaxed);
+		busRequested[who].fetch_add(stall * scale, std::memory_order_relaxed);
+	}
+
+	return stall;
+}
+
+
+//
+// Grant the halfline budget in the priority order
+//
+void BusHalfline(void)
+{
+	if (!vjs.busArbitration)
+	{
+		return;
+	}
+
+	uint32_t halfline = USEC_TO_RISC_CYCLES(vjs.hardwareTypeNTSC ? (HORIZ_PERIOD_IN_USEC_NTSC / 2.0) : (HORIZ_PERIOD_IN_USEC_PAL / 2.0));
+	uint32_t budget = halfline;
+
+	for (uint32_t i = 0; i < (sizeof(busPriority) / sizeof(busPriority[0])); i++)
+	{
+		uint32_t who = busPriority[i];
+		uint32_t request = busRequested[who].exchange(0, std::memory_order_relaxed) + busPending[who];
+
+		// An executor cannot use the bus longer than the halfline, the excess is the slices jitter
+		if ((who != OP) && (who != BLITTER) && (request > halfline))
+		{
+			request = halfline;
+		}
+
+		uint32_t granted = ((request < budget) ? request : budget);
+		uint32_t deficit = request - granted;
+
+		budget -= granted;
+		busStats.requested[who] += request - busPending[who];
+		busStats.granted[who] += granted;
+
+		if ((who == OP) || (who == BLITTER))
+		{
+			busPending[who] = ((deficit < BUS_PENDING_MAX) ? deficit : BUS_PENDING_MAX);
+		}
+		else if (deficit)
+		{
+			uint32_t stall = busStalls[who].load(std::memory_order_relaxed);
+			uint32_t room = ((stall < BUS_PENDING_MAX) ? (BUS_PENDING_MAX - stall) : 0);
+			deficit = ((deficit < room) ? deficit : room);
+			busStalls[who].fetch_add(deficit, std::memory_order_relaxed);
+			busStats.stalled[who] += deficit;
+		}
+	}
+
+	busStats.halflines++;
+
+	if (!budget)
+	{
+		busStats.saturated++;
+	}
+}
+
+
+//
+void BusGetStats(BusStats * stats)
+{
+	*stats = busStats;
+}
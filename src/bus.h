@@ -0,0 +1,45 @@
+//
+// bus.h: Header file
+//
+// Main bus arbitration: the bus masters charge their accesses in bursts
+// against a halfline budget, and the cycles they could not get are taken back
+// from their executors
+//
+
+#ifndef __BUS_H__
+#define __BUS_H__
+
+#include <stdint.h>
+#include "settings.h"
+
+#define BUS_MASTERS			10						// Bus masters identifiers (memory.h)
+
+// DRAM costs, in RISC cycles per phrase
+#define BUS_PAGE_SHIFT		11						// 2 KB DRAM pages
+#define BUS_PAGE_HIT		2
+#define BUS_PAGE_MISS		5
+
+struct BusStats
+{
+	uint32_t halflines;
+	uint32_t saturated;								// Halflines with the whole budget granted
+	uint64_t requested[BUS_MASTERS];				// RISC cycles
+	uint64_t granted[BUS_MASTERS];
+	uint64_t stalled[BUS_MASTERS];					// Cycles taken back from the executors
+};
+
+// External accesses of the GPU & the DSP, charged at the end of their slices
+extern uint32_t busAccesses[BUS_MASTERS];
+
+// External access counted, with the arbitration on only
+#define BUS_ACCESS(_who)	do { if (vjs.busArbitration) { busAccesses[_who]++; } } while (0)
+
+extern void BusReset(void);
+extern uint32_t BusBurst(uint32_t address, uint32_t phrases);
+extern void BusCharge(uint32_t who, uint32_t cycles);
+extern void BusChargeAccesses(uint32_t who);
+extern uint32_t BusStall(uint32_t who, uint32_t cycles);
+extern void BusHalfline(void);
+extern void BusGetStats(BusStats * stats);
+
+#endif	// __BUS_H__
@@ -11,6 +11,7 @@
 // ---  ----------  ------------------------------------------------------------
 // JLH  01/16/2010  Created this log ;-)
 // JPM  06/15/2016  Visual Studio support
+// JPM   Oct./2026  Sectors reader used instead of the drive
 //
 
 //
@@ -60,6 +61,7 @@ static void TestCDIO(void)
 #ifdef HAVE_LIB_CDIO
 static CdIo_t * cdioPtr = NULL;
 #endif
+static CDIntfReader cdIntfReader = NULL;
 
 
 bool CDIntfInit(void)
@@ -93,8 +95,20 @@ void CDIntfDone(void)
 }
 
 
+//
+// Sectors reader used instead of the drive, NULL to use the drive again
+//
+void CDIntfSetReader(CDIntfReader reader)
+{
+	cdIntfReader = reader;
+}
+
+
 bool CDIntfReadBlock(uint32_t sector, uint8_t * buffer)
 {
+	if (cdIntfReader)
+		return cdIntfReader(sector, buffer);
+
 #ifdef _MSC_VER
 #pragma message("Warning: !!! FIX !!! CDIntfReadBlock not implemented!")
 #else
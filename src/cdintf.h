@@ -9,9 +9,13 @@
 
 #include <stdint.h>
 
+// Sectors reader used instead of the drive, such as a synthetic CD image
+typedef bool (* CDIntfReader)(uint32_t, uint8_t *);
+
 bool CDIntfInit(void);
 void CDIntfDone(void);
 bool CDIntfReadBlock(uint32_t, uint8_t *);
+void CDIntfSetReader(CDIntfReader);
 uint32_t CDIntfGetNumSessions(void);
 void CDIntfSelectDrive(uint32_t);
 uint32_t CDIntfGetCurrentDrive(void);
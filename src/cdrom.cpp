@@ -17,6 +17,7 @@
 // ---  ----------  ------------------------------------------------------------
 // JLH  01/16/2010  Created this log ;-)
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Butch I2S FIFO filled by sector bursts, words logging at compile time
 //
 
 #include "cdrom.h"
@@ -28,8 +29,10 @@
 #include "cdintf.h"									// System agnostic CD interface functions
 #include "log.h"
 #include "dac.h"
+#include "jerry.h"
 
 //#define CDROM_LOG									// For CDROM logging, obviously
+//#define CDROM_SSI_LOG								// For the Butch to JERRY I2S words logging
 
 /*
 BUTCH     equ  $DFFF00		; base of Butch=interrupt control register, R/W
@@ -190,6 +193,11 @@ static bool haveCDGoodness;
 static uint32_t min, sec, frm, block;
 static uint8_t cdBuf[2352 + 96];
 static uint32_t cdBufPtr = 2352;
+#define BUTCH_FIFO_WORDS	(2352 / 4)
+static uint32_t butchFIFO[BUTCH_FIFO_WORDS];			// Words of cdBuf, popped at cdBufPtr
+static uint8_t cdBuf2[2352 + 96], cdBufNext[2352 + 96];
+static uint32_t cdBufNextBlock = 0xFFFFFFFF;			// Block read in cdBufNext
+static void ButchFIFODecode(void);
 //Also need to set up (save/restore) the CD's NVRAM
 
 
@@ -223,6 +231,8 @@ size_t cdrom_load(FILE *fp)
 	LOADARR8(cdBuf);
 	LOAD32(cdBufPtr);
 	LOADARR8(cdRam);
+	ButchFIFODecode();
+	cdBufNextBlock = 0xFFFFFFFF;
 
 	return total_loaded;
 }
@@ -290,6 +300,7 @@ void CDROMReset(void)
 {
 	memset(cdRam, 0x00, 0x100);
 	cdCmd = 0;
+	cdBufNextBlock = 0xFFFFFFFF;
 }
 
 void CDROMDone(void)
@@ -635,6 +646,10 @@ void CDROMWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 	offset &= 0xFF;
 	cdRam[offset] = data;
 
+	// I2S path to JERRY may be on, its word clock with it
+	if (offset == I2CNTRL + 3)
+		JERRYI2SWake();
+
 #ifdef CDROM_LOG
 	if ((offset & 0xFF) < 12 * 4)
 		WriteLog("[%s] ", BReg[(offset & 0xFF) / 4]);
@@ -647,6 +662,10 @@ void CDROMWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 	offset &= 0xFF;
 	SET16(cdRam, offset, data);
 
+	// I2S path to JERRY may be on, its word clock with it
+	if (offset == I2CNTRL + 2)
+		JERRYI2SWake();
+
 	// Command register
 //Lesse what this does... Seems to work OK...!
 	if (offset == DS_DATA)
@@ -846,10 +865,47 @@ static uint16_t CDROMBusRead(void)
 }
 
 //
-// This simulates a read from BUTCH over the SSI to JERRY. Uses real reading!
+// Butch I2S FIFO: a whole CD sector of stereo words, filled in one burst from
+// the CD interface. The drive data is a word late, so each burst needs the start
+// of the next sector too; it is kept for the next burst.
+//
+static void ButchFIFOFill(void)
+{
+#ifdef CDROM_SSI_LOG
+	WriteLog("CDROM: Reading block #%u...\n", block);
+#endif
+	//No error checking. !!! FIX !!!
+//NOTE: We have to subtract out the 1st track start as well (in cdintf_foo.cpp)!
+	if (cdBufNextBlock == block)
+		memcpy(cdBuf2, cdBufNext, sizeof(cdBuf2));
+	else
+		CDIntfReadBlock(block, cdBuf2);
+
+	CDIntfReadBlock(block + 1, cdBufNext);
+	cdBufNextBlock = block + 1;
+	memcpy(cdBuf, cdBuf2 + 2, 2350);
+	cdBuf[2350] = cdBufNext[0];
+	cdBuf[2351] = cdBufNext[1];
+	ButchFIFODecode();
+
+	block++, cdBufPtr = 0;
+}
+
+//
+// Words of the FIFO, from the sector data
+// It seems that even though the data on the CD is organized as LL LH RL RH the
+// way it expects to see the data is RH RL LH LL: right channel in the lower 16
+// bits, left channel in the upper 16 bits.
+//
+static void ButchFIFODecode(void)
+{
+	for(uint32_t i=0; i<BUTCH_FIFO_WORDS; i++)
+		butchFIFO[i] = (cdBuf[(i * 4) + 3] << 24) | (cdBuf[(i * 4) + 2] << 16) | (cdBuf[(i * 4) + 1] << 8) | cdBuf[(i * 4) + 0];
+}
+
+//
+// This simulates a read from BUTCH over the SSI to JERRY, one 16-bit word per access
 //
-//temp, until I can fix my CD image... Argh!
-static uint8_t cdBuf2[2532 + 96], cdBuf3[2532 + 96];
 uint16_t GetWordFromButchSSI(uint32_t offset, uint32_t who/*= UNKNOWN*/)
 {
 	bool go = ((offset & 0x0F) == 0x0A || (offset & 0x0F) == 0x0E ? true : false);
@@ -859,53 +915,18 @@ uint16_t GetWordFromButchSSI(uint32_t offset, uint32_t who/*= UNKNOWN*/)
 
 // The problem comes in here. Really, we should generate the IRQ once we've stuffed
 // our values into the DAC L/RRXD ports...
-// But then again, the whole IRQ system needs an overhaul in order to make it more
-// cycle accurate WRT to the various CPUs. Right now, it's catch-as-catch-can, which
-// means that IRQs get serviced on scanline boundaries instead of when they occur.
 	cdBufPtr += 2;
 
 	if (cdBufPtr >= 2352)
-	{
-WriteLog("CDROM: %s reading block #%u...\n", whoName[who], block);
-		//No error checking. !!! FIX !!!
-//NOTE: We have to subtract out the 1st track start as well (in cdintf_foo.cpp)!
-//		CDIntfReadBlock(block - 150, cdBuf);
-
-//Crappy kludge for shitty shit. Lesse if it works!
-		CDIntfReadBlock(block - 150, cdBuf2);
-		CDIntfReadBlock(block - 149, cdBuf3);
-		for(int i=0; i<2352-4; i+=4)
-		{
-			cdBuf[i+0] = cdBuf2[i+4];
-			cdBuf[i+1] = cdBuf2[i+5];
-			cdBuf[i+2] = cdBuf2[i+2];
-			cdBuf[i+3] = cdBuf2[i+3];
-		}
-		cdBuf[2348] = cdBuf3[0];
-		cdBuf[2349] = cdBuf3[1];
-		cdBuf[2350] = cdBuf2[2350];
-		cdBuf[2351] = cdBuf2[2351];//*/
-
-		block++, cdBufPtr = 0;
-	}
-
-/*extern bool doDSPDis;
-if (block == 244968)
-	doDSPDis = true;//*/
+		ButchFIFOFill();
 
-WriteLog("[%04X:%01X]", GET16(cdBuf, cdBufPtr), offset & 0x0F);
-if (cdBufPtr % 32 == 30)
-	WriteLog("\n");
-
-//	return GET16(cdBuf, cdBufPtr);
-//This probably isn't endian safe...
-// But then again... It seems that even though the data on the CD is organized as
-// LL LH RL RH the way it expects to see the data is RH RL LH LL.
-// D'oh! It doesn't matter *how* the data comes in, since it puts each sample into
-// its own left or right side queue, i.e. it reads them 32 bits at a time and puts
-// them into their L/R channel queues. It does seem, though, that it expects the
-// right channel to be the upper 16 bits and the left to be the lower 16.
-	return (cdBuf[cdBufPtr + 1] << 8) | cdBuf[cdBufPtr + 0];
+	uint16_t data = (uint16_t)(butchFIFO[cdBufPtr >> 2] >> ((cdBufPtr & 0x02) << 3));
+#ifdef CDROM_SSI_LOG
+	WriteLog("[%04X:%01X]", data, offset & 0x0F);
+	if (cdBufPtr % 32 == 30)
+		WriteLog("\n");
+#endif
+	return data;
 }
 
 bool ButchIsReadyToSend(void)
@@ -917,80 +938,34 @@ WriteLog("Butch is%s ready to send...\n", cdRam[I2CNTRL + 3] & 0x02 ? "" : " not
 }
 
 //
-// This simulates a read from BUTCH over the SSI to JERRY. Uses real reading!
+// This simulates a read from BUTCH over the SSI to JERRY: the next stereo word
+// popped from the FIFO into the DAC L/RRXD ports
 //
 void SetSSIWordsXmittedFromButch(void)
 {
-
-// The problem comes in here. Really, we should generate the IRQ once we've stuffed
-// our values into the DAC L/RRXD ports...
-// But then again, the whole IRQ system needs an overhaul in order to make it more
-// cycle accurate WRT to the various CPUs. Right now, it's catch-as-catch-can, which
-// means that IRQs get serviced on scanline boundaries instead of when they occur.
-
 // NOTE: The CD BIOS uses the following SMODE:
 //       DAC: M68K writing to SMODE. Bits: WSEN FALLING  [68K PC=00050D8C]
 	cdBufPtr += 4;
 
-	if (cdBufPtr >= 2352)
-	{
-WriteLog("CDROM: Reading block #%u...\n", block);
-		//No error checking. !!! FIX !!!
-//NOTE: We have to subtract out the 1st track start as well (in cdintf_foo.cpp)!
-//		CDIntfReadBlock(block - 150, cdBuf);
-
-//Crappy kludge for shitty shit. Lesse if it works!
-//It does! That means my CD is WRONG! FUCK!
-
-// But, then again, according to Belboz at AA the two zeroes in front *ARE* necessary...
-// So that means my CD is OK, just this method is wrong!
+// According to Belboz at AA the two zeroes in front of the data *ARE* necessary...
 // It all depends on whether or not the interrupt occurs on the RISING or FALLING edge
 // of the word strobe... !!! FIX !!!
-
 // When WS rises, left channel was done transmitting. When WS falls, right channel is done.
-//		CDIntfReadBlock(block - 150, cdBuf2);
-//		CDIntfReadBlock(block - 149, cdBuf3);
-		CDIntfReadBlock(block, cdBuf2);
-		CDIntfReadBlock(block + 1, cdBuf3);
-		memcpy(cdBuf, cdBuf2 + 2, 2350);
-		cdBuf[2350] = cdBuf3[0];
-		cdBuf[2351] = cdBuf3[1];//*/
-
-		block++, cdBufPtr = 0;
-
-/*extern bool doDSPDis;
-static int foo = 0;
-if (block == 244968)
-{
-	foo++;
-WriteLog("\n***** foo = %u, block = %u *****\n\n", foo, block);
-	if (foo == 2)
-		doDSPDis = true;
-}//*/
-	}
-
-
-WriteLog("[%02X%02X %02X%02X]", cdBuf[cdBufPtr+1], cdBuf[cdBufPtr+0], cdBuf[cdBufPtr+3], cdBuf[cdBufPtr+2]);
-if (cdBufPtr % 32 == 28)
-	WriteLog("\n");
-
-//This probably isn't endian safe...
-// But then again... It seems that even though the data on the CD is organized as
-// LL LH RL RH the way it expects to see the data is RH RL LH LL.
-// D'oh! It doesn't matter *how* the data comes in, since it puts each sample into
-// its own left or right side queue, i.e. it reads them 32 bits at a time and puts
-// them into their L/R channel queues. It does seem, though, that it expects the
-// right channel to be the upper 16 bits and the left to be the lower 16.
+	if (cdBufPtr >= 2352)
+		ButchFIFOFill();
 
-// This behavior is strictly a function of *where* the WS creates an IRQ. If the data
-// is shifted by two zeroes (00 00 in front of the data file) then this *is* the
-// correct behavior, since the left channel will be xmitted followed by the right
+	uint32_t word = butchFIFO[cdBufPtr >> 2];
+#ifdef CDROM_SSI_LOG
+	WriteLog("[%08X]", word);
+	if (cdBufPtr % 32 == 28)
+		WriteLog("\n");
+#endif
 
 // Now we have definitive proof: The MYST CD shows a word offset. So that means we have
 // to figure out how to make that work here *without* having to load 2 sectors, offset, etc.
 // !!! FIX !!!
-	lrxd = (cdBuf[cdBufPtr + 3] << 8) | cdBuf[cdBufPtr + 2],
-	rrxd = (cdBuf[cdBufPtr + 1] << 8) | cdBuf[cdBufPtr + 0];
+	lrxd = (uint16_t)(word >> 16),
+	rrxd = (uint16_t)word;
 }
 
 /*
@@ -0,0 +1,329 @@
+//
+// Core fuzzing harness
+//
+// libFuzzer entry points, also used by AFL++ with its libFuzzer driver. The
+// machine is initialised once, without BIOS, and captured as the fast reset
+// baseline; each input is run from the baseline through the TOM, JERRY, OP and
+// blitter code paths. The first byte of an input selects the target, the rest
+// is its data:
+//     0: ROM image at $802000, run by the 68K along the GPU & DSP events
+//     1: video mode word, then an object list at $40000 run by the OP halflines
+//     2: blitter registers writes, 5 bytes each (register, long value)
+//     3: save state file contents after its header; the first data byte gives
+//        the header flags (bit 0) and the version 1 chunks (bit 1)
+// The runs are kept short, so a plain box goes over 1000 runs per second:
+// the blitter inner & outer counts and the blits number are bounded, the ROM
+// image size too.
+//
+// Without libFuzzer (CORE_FUZZ_STANDALONE), the inputs given on the command
+// line are run, and the runs per second are displayed.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Inputs memory marked with the memory space write epochs
+// JPM   Oct./2026  HC no longer random
+// JPM   Oct./2026  Save state loading target
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "dac.h"
+#include "event.h"
+#include "fastreset.h"
+#include "frametiming.h"
+#include "gpu.h"
+#include "hosttuning.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "modelsBIOS.h"
+#include "settings.h"
+#include "state.h"
+#include "tom.h"
+#include "m68000/m68kinterface.h"
+
+// Targets
+enum { FUZZ_ROM = 0, FUZZ_OBJECT_LIST, FUZZ_BLITTER, FUZZ_SAVESTATE, FUZZ_END };
+
+#define FUZZ_ROM_ADDRESS		0x802000
+#define FUZZ_ROM_MAX			0x10000
+#define FUZZ_OL_ADDRESS			0x40000
+#define FUZZ_OL_MAX				0x4000
+#define FUZZ_EVENTS				24				// Events run per ROM input (halflines & timers)
+#define FUZZ_SAMPLES			64				// DSP samples run per ROM input
+#define FUZZ_HALFLINES			24				// Halflines rendered per object list input
+#define FUZZ_FIRST_HALFLINE		31				// First visible halfline (NTSC)
+#define FUZZ_BLITTER_REGS		40				// Blitter registers ($F02200 - $F0229F)
+#define FUZZ_BLITS				4				// Blits started per blitter input
+#define FUZZ_BLITTER_COMMAND	0x38
+#define FUZZ_BLITTER_COUNT		0x3C
+#define FUZZ_SEED				0x4A414755		// Random seed for the baseline RAM & each input
+#define FUZZ_STATE_SECTION		16				// Save state sections directory entry size
+
+// Same frame buffer size as the GL widget texture
+#define FUZZ_SCREEN_PITCH		1024
+#define FUZZ_SCREEN_HEIGHT		512
+
+VJSettings vjs;
+static uint32_t fuzzScreenBuffer[FUZZ_SCREEN_PITCH * FUZZ_SCREEN_HEIGHT];
+
+
+//
+// Initialise the machine, and capture the baseline
+//
+static bool FuzzInit(void)
+{
+	memset(&vjs, 0, sizeof(vjs));
+	vjs.hardwareTypeNTSC = true;
+	vjs.biosType = BT_M_SERIES;
+	vjs.jaguarModel = JAG_M_SERIES;
+	vjs.GPUEnabled = true;
+	vjs.DSPEnabled = true;
+	vjs.allowWritesToROM = true;
+	vjs.allowM68KExceptionCatch = false;
+	vjs.allowWritesToUnknownLocation = true;
+	vjs.emulationThreadCPU = vjs.audioThreadCPU = vjs.workerThreadCPU = -1;
+	vjs.hugePagesType = HOST_HUGEPAGES_NONE;
+	vjs.DRAM_size = 0x200000;
+
+	JaguarSetScreenPitch(FUZZ_SCREEN_PITCH);
+	JaguarSetScreenBuffer(fuzzScreenBuffer);
+	JaguarInit();
+	SelectBIOS(vjs.biosType);
+	// The RAM contents are randomized at the reset, the same ones for each session
+	srand(FUZZ_SEED);
+	JaguarReset();
+
+	// The ROM inputs start at the cartridge run address
+	jaguarRunAddress = FUZZ_ROM_ADDRESS;
+	SET32(jaguarMainRAM, 0, vjs.DRAM_size);
+	SET32(jaguarMainRAM, 4, jaguarRunAddress);
+	m68k_pulse_reset();
+
+	return CoreFastResetCapture();
+}
+
+
+//
+// ROM image, run by the 68K with the GPU & the DSP
+//
+static void FuzzROM(const uint8_t * data, size_t size)
+{
+	size = ((size > FUZZ_ROM_MAX) ? FUZZ_ROM_MAX : size);
+	memcpy(&jagMemSpace[FUZZ_ROM_ADDRESS], data, size);
+	MemoryPagesWritten(FUZZ_ROM_ADDRESS, (uint32_t)size);
+
+	for (uint32_t i = 0; i < FUZZ_EVENTS; i++)
+	{
+		double timeToNextEvent = GetTimeToNextEvent();
+		m68k_execute(USEC_TO_M68K_CYCLES(timeToNextEvent));
+		GPUExec(USEC_TO_RISC_CYCLES(timeToNextEvent));
+		HandleNextEvent();
+	}
+
+	DACExecHeadless(FUZZ_SAMPLES);
+}
+
+
+//
+// Object list, rendered for the halflines in the display
+//
+static void FuzzObjectList(const uint8_t * data, size_t size)
+{
+	if (size < 2)
+	{
+		return;
+	}
+
+	// Video enabled, and the OP started from the first halfline
+	JaguarWriteWord(0xF00028, ((data[0] << 8) | data[1]) | 0x0001, M68K);
+	JaguarWriteWord(0xF00046, 0x0000, M68K);
+	JaguarWriteWord(0xF00048, 0xFFFF, M68K);
+	JaguarWriteWord(0xF00020, (FUZZ_OL_ADDRESS & 0xFFFF), M68K);
+	JaguarWriteWord(0xF00022, (FUZZ_OL_ADDRESS >> 16), M68K);
+
+	size = (((size - 2) > FUZZ_OL_MAX) ? FUZZ_OL_MAX : (size - 2));
+	memcpy(&jaguarMainRAM[FUZZ_OL_ADDRESS], data + 2, size);
+	MemoryPagesWritten(FUZZ_OL_ADDRESS, (uint32_t)size);
+
+	for (uint16_t halfline = FUZZ_FIRST_HALFLINE; halfline < (FUZZ_FIRST_HALFLINE + FUZZ_HALFLINES); halfline++)
+	{
+		TOMExecHalfline(halfline, true);
+	}
+}
+
+
+//
+// Blitter registers writes, the command register starts the blit
+//
+static void FuzzBlitter(const uint8_t * data, size_t size)
+{
+	uint32_t blits = 0;
+
+	// The counts left by a previous blit are not bounded
+	JaguarWriteLong(0xF02200 + FUZZ_BLITTER_COUNT, 0x00010001, GPU);
+
+	for (; size >= 5; data += 5, size -= 5)
+	{
+		uint32_t reg = (data[0] % FUZZ_BLITTER_REGS) * 4;
+		uint32_t value = GET32(data, 1);
+
+		// Inner & outer counts bounded (1 - 64 and 1 - 8)
+		if (reg == FUZZ_BLITTER_COUNT)
+		{
+			value = ((((value >> 16) & 0x07) + 1) << 16) | ((value & 0x3F) + 1);
+		}
+		else if ((reg == FUZZ_BLITTER_COMMAND) && (++blits > FUZZ_BLITS))
+		{
+			break;
+		}
+
+		JaguarWriteLong(0xF02200 + reg, value, GPU);
+	}
+}
+
+
+//
+// Save state file contents, loaded over the baseline
+//
+static void FuzzSaveState(const uint8_t * data, size_t size)
+{
+	if (!size)
+	{
+		return;
+	}
+
+	size_t stateSize = size + 3;
+	uint8_t * state = (uint8_t *)malloc(stateSize);
+
+	if (!state)
+	{
+		return;
+	}
+
+	state[0] = 'V';
+	state[1] = 'J';
+	state[2] = data[0] & 0x01;
+	state[3] = ((data[0] & 0x02) ? 0x01 : 0x02);
+	memcpy(state + 4, data + 1, size - 1);
+
+	// The sections CRC32 are made right, so the substates are loaded
+	if ((state[3] == 0x02) && !state[2] && (stateSize >= 8))
+	{
+		for (uint32_t i = 0, count = GET32(state, 4); (i < count) && ((8 + ((i + 1) * FUZZ_STATE_SECTION)) <= stateSize); i++)
+		{
+			uint8_t * entry = &state[8 + (i * FUZZ_STATE_SECTION)];
+			uint32_t offset = GET32(entry, 4), sectionSize = GET32(entry, 8);
+
+			if ((offset <= stateSize) && (sectionSize <= (stateSize - offset)))
+			{
+				uint32_t crc = (uint32_t)crc32(crc32(0L, Z_NULL, 0), &state[offset], sectionSize);
+				SET32(entry, 12, crc);
+			}
+		}
+	}
+
+	StateLoadFromFile(state, stateSize);
+	free(state);
+}
+
+
+extern "C" int LLVMFuzzerInitialize(int * argc, char *** argv)
+{
+	if (!FuzzInit())
+	{
+		fprintf(stderr, "Could not capture the fast reset baseline!\n");
+		exit(1);
+	}
+
+	return 0;
+}
+
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
+{
+	if (!size)
+	{
+		return 0;
+	}
+
+	CoreFastReset();
+	srand(FUZZ_SEED);
+
+	switch (data[0] % FUZZ_END)
+	{
+	case FUZZ_ROM:
+		FuzzROM(data + 1, size - 1);
+		break;
+
+	case FUZZ_OBJECT_LIST:
+		FuzzObjectList(data + 1, size - 1);
+		break;
+
+	case FUZZ_BLITTER:
+		FuzzBlitter(data + 1, size - 1);
+		break;
+
+	case FUZZ_SAVESTATE:
+		FuzzSaveState(data + 1, size - 1);
+		break;
+	}
+
+	return 0;
+}
+
+
+#if defined(CORE_FUZZ_STANDALONE)
+//
+// Run the inputs files, -runs=<n> runs each of them n times
+//
+int main(int argc, char * argv[])
+{
+	uint32_t runs = 1, count = 0;
+	LLVMFuzzerInitialize(&argc, &argv);
+	uint64_t start = FrameTimingNow();
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strncmp(argv[i], "-runs=", 6))
+		{
+			runs = (uint32_t)strtoul(argv[i] + 6, NULL, 10);
+			continue;
+		}
+
+		FILE * fp = fopen(argv[i], "rb");
+
+		if (!fp)
+		{
+			printf("Could not open input \"%s\"!\n", argv[i]);
+			continue;
+		}
+
+		fseek(fp, 0, SEEK_END);
+		size_t size = (size_t)ftell(fp);
+		rewind(fp);
+		uint8_t * data = (uint8_t *)malloc(size ? size : 1);
+
+		if (data && (fread(data, 1, size, fp) == size))
+		{
+			for (uint32_t j = 0; j < runs; j++, count++)
+			{
+				LLVMFuzzerTestOneInput(data, size);
+			}
+		}
+
+		free(data);
+		fclose(fp);
+	}
+
+	double elapsed = (FrameTimingNow() - start) / 1000000000.0;
+	printf("%u runs in %.3f s: %.2f runs/s\n", count, elapsed, (elapsed > 0.0 ? count / elapsed : 0.0));
+	CoreFastResetDone();
+	JaguarDone();
+	return 0;
+}
+#endif
@@ -18,6 +18,12 @@
 // JLH  01/16/2010  Created this log ;-)
 // JLH  04/30/2012  Changed SDL audio handler to run JERRY
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Host tuning of the audio thread
+// JPM   Oct./2026  DSP can run without the SDL audio (headless runner)
+// JPM   Oct./2026  Audio samples requested per frame are given to the frame timing
+// JPM   Oct./2026  I2S word clock restarted by the serial mode change
+// JPM   Oct./2026  DSP marked as the bus master for the data watchpoints
+// JPM   Oct./2026  DSP slices shortened by the main bus arbitration
 //
 
 // Need to set up defaults that the BIOS sets for the SSI here in DACInit()... !!! FIX !!!
@@ -49,9 +55,12 @@
 #include "dac.h"
 
 #include "SDL.h"
+#include "bus.h"
 #include "cdrom.h"
 #include "dsp.h"
 #include "event.h"
+#include "frametiming.h"
+#include "hosttuning.h"
 #include "jerry.h"
 #include "jaguar.h"
 #include "log.h"
@@ -59,6 +68,7 @@
 //#include "memory.h"
 #include "settings.h"
 #include "state.h"
+#include "watchpoint.h"
 
 //#define DEBUG_DAC
 
@@ -83,12 +93,14 @@
 
 static SDL_AudioSpec desired;
 static bool SDLSoundInitialized;
+static bool audioThreadTuned;					// Host tuning applied on the SDL audio thread
 //static uint8_t SCLKFrequencyDivider = 19;			// Default is roughly 22 KHz (20774 Hz in NTSC mode)
 // /*static*/ uint16_t serialMode = 0;
 
 // Private function prototypes
 
 void SDLSoundCallback(void * userdata, Uint8 * buffer, int length);
+static bool DACRunDSP(Uint8 * buffer, int length);
 void DSPSampleCallback(void);
 
 static Uint8 * sampleBuffer = NULL;
@@ -160,6 +172,7 @@ size_t total_loaded = 0;
 void DACInit(void)
 {
 	SDLSoundInitialized = false;
+	audioThreadTuned = false;
 
 //	if (!vjs.audioEnabled)
 	if (!vjs.DSPEnabled)
@@ -250,6 +263,41 @@ void SDLSoundCallback(void * userdata, Uint8 * buffer, int length)
 {
 	WriteLog("SDLSoundCallback called: length: %d  load: %d  dump: %d\n", length, dac_load_state, dac_dump_state);
 
+	// The SDL audio thread can only be tuned from itself
+	if (!audioThreadTuned)
+	{
+		HostTuningApplyThread(HOST_THREAD_AUDIO);
+		audioThreadTuned = true;
+	}
+
+	// 16 bits stereo samples
+	FrameTimingAudioSamples(length / 4);
+
+	if (!DACRunDSP(buffer, length))
+	{
+		return;
+	}
+
+	if (dac_load_state)
+	{
+		dac_load_state = false;
+	}
+	else
+	{
+		if (dac_dump_state)
+		{
+			dac_dump_state = false;
+		}
+	}
+}
+
+
+//
+// Run the DSP for the time needed to fill the audio buffer
+// Return false if the DSP is not running
+//
+static bool DACRunDSP(Uint8 * buffer, int length)
+{
 	// 1st, check to see if the DSP is running. If not, fill the buffer with L/RXTD and exit.
 
 	if (!DSPIsRunning())
@@ -260,7 +308,7 @@ void SDLSoundCallback(void * userdata, Uint8 * buffer, int length)
 			((uint16_t *)buffer)[i + 1] = rtxd;
 		}
 
-		return;
+		return false;
 	}
 
 	// The length of time we're dealing with here is 1/48000 s, so we multiply this
@@ -288,26 +336,39 @@ void SDLSoundCallback(void * userdata, Uint8 * buffer, int length)
 
 		if (vjs.DSPEnabled)
 		{
+			uint32_t dspCycles = USEC_TO_RISC_CYCLES(timeToNextEvent);
+			dspCycles -= BusStall(DSP, dspCycles);
+			watchpointMaster = DSP;
+
 			if (vjs.usePipelinedDSP)
-				DSPExecP2(USEC_TO_RISC_CYCLES(timeToNextEvent));
+				DSPExecP2(dspCycles);
 			else
-				DSPExec(USEC_TO_RISC_CYCLES(timeToNextEvent));
+				DSPExec(dspCycles);
+
+			BusChargeAccesses(DSP);
 		}
 
 		HandleNextEvent(EVENT_JERRY);
 	}
 	while (!bufferDone);
 
-	if (dac_load_state)
-	{
-		dac_load_state = false;
-	}
-	else
+	return true;
+}
+
+
+//
+// Run the DSP without the SDL audio, for the time of the requested number of samples
+// The samples are dropped
+//
+void DACExecHeadless(uint32_t samples)
+{
+	static uint16_t headlessBuffer[4096 * 2];
+
+	while (samples)
 	{
-		if (dac_dump_state)
-		{
-			dac_dump_state = false;
-		}
+		uint32_t count = ((samples > 4096) ? 4096 : samples);
+		DACRunDSP((Uint8 *)headlessBuffer, count * 4);
+		samples -= count;
 	}
 }
 
@@ -392,6 +453,7 @@ void DACWriteWord(uint32_t offset, uint16_t data, uint32_t who/*= UNKNOWN*/)
 			(data & 0x04 ? "WSEN " : ""), (data & 0x08 ? "RISING " : ""),
 			(data & 0x10 ? "FALLING " : ""), (data & 0x20 ? "EVERYWORD" : ""),
 			m68k_get_reg(NULL, M68K_REG_PC));
+		JERRYI2SWake();
 	}
 }
 
@@ -11,6 +11,7 @@ void DACInit(void);
 void DACReset(void);
 void DACPauseAudioThread(bool state = true);
 void DACDone(void);
+void DACExecHeadless(uint32_t samples);
 //int GetCalculatedFrequency(void);
 
 // DAC memory access
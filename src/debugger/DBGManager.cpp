@@ -17,6 +17,7 @@
 // JPM  Sept./2019  Support the unsigned/signed short type
 //  RG   Jan./2021  Linux build fixes
 // JPM    May/2021  Code refactoring for the variables
+// JPM   Oct./2026  Added the function address range, and the variables location programs
 //
 
 // To Do
@@ -34,6 +35,7 @@
 #include "DWARFManager.h"
 #include "DBGManager.h"
 #include "HWLABELManager.h"
+#include "VARPROGManager.h"
 #include "settings.h"
 #include "memory.h"
 
@@ -162,12 +164,17 @@ void DBGManager_Init(void)
 	ELFManager_Init();
 	// DWARF initialisation
 	DWARFManager_Init();
+	// Variables location programs initialisation
+	VARPROGManager_Init();
 }
 
 
 // Common debugger reset
 void DBGManager_Reset(void)
 {
+	// the programs refer to the variables information
+	VARPROGManager_Reset();
+
 	if ((DBGType & DBG_DWARF))
 	{
 		DWARFManager_Reset();
@@ -186,6 +193,8 @@ void DBGManager_Reset(void)
 // Common debugger close
 void DBGManager_Close(void)
 {
+	VARPROGManager_Close();
+
 	if ((DBGType & DBG_DWARF))
 	{
 		DWARFManager_Close();
@@ -693,6 +702,21 @@ char *DBGManager_GetFunctionName(size_t Adr)
 }
 
 
+// Get function address range from address
+// Return false if no function has been found
+bool DBGManager_GetFunctionRange(size_t Adr, size_t *LowPC, size_t *HighPC)
+{
+	if ((DBGType & DBG_ELFDWARF))
+	{
+		return DWARFManager_GetFunctionRange(Adr, LowPC, HighPC);
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
 // Get line number from address and his tag
 // Return line number on the symbol name found
 // Return 0 if no symbol name has been found
@@ -257,6 +257,8 @@ typedef struct VariablesStruct
 	char *PtrTypeName;								// Variable's Type name
 	size_t NbTabVariables;							// Number of Variable's members
 	VariablesStruct **TabVariables;					// Variable's Members (used for structures at the moment)
+	size_t LocationSize;							// Variable's location expression size
+	unsigned char *PtrLocation;						// Variable's location expression (DW_OP list)
 }S_VariablesStruct;
 
 
@@ -283,6 +285,7 @@ extern size_t DBGManager_GetSrcLanguageFromIndex(size_t Index);
 
 // Functions manager
 extern char *DBGManager_GetFunctionName(size_t Adr);
+extern bool DBGManager_GetFunctionRange(size_t Adr, size_t *LowPC, size_t *HighPC);
 
 // Symbols manager
 extern char	*DBGManager_GetSymbolNameFromAdr(size_t Adr);
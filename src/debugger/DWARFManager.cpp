@@ -18,6 +18,7 @@
 // JPM   June/2021  Update the source file path clean up
 // JPM   Oct./2021  Support wider offset ranges for local and parameter variables
 // JPM  March/2022  Added a '/cygdrive/' directory detection
+// JPM   Oct./2026  Keep the variables location expressions, and added the function address range
 //
 
 // To Do
@@ -123,6 +124,8 @@ typedef struct VariablesStruct
 	char *PtrTypeName;								// Variable's Type name
 	size_t NbTabVariables;							// Number of Variable's members
 	VariablesStruct **TabVariables;					// Variable's Members (used for structures at the moment)
+	size_t LocationSize;							// Variable's location expression size
+	unsigned char *PtrLocation;						// Variable's location expression (DW_OP list)
 }S_VariablesStruct;
 
 // Sub program internal structure
@@ -331,6 +334,7 @@ void DWARFManager_CloseDMI(void)
 			{
 				free(PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].PtrName);
 				free(PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].PtrTypeName);
+				free(PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].PtrLocation);
 			}
 			free(PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables);
 
@@ -358,6 +362,7 @@ void DWARFManager_CloseDMI(void)
 		{
 			free(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrName);
 			free(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrTypeName);
+			free(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrLocation);
 
 			// free the variable's members
 			while (PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].NbTabVariables--)
@@ -748,6 +753,13 @@ void DWARFManager_InitDMI(void)
 														{
 															PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].Op = (*((unsigned char *)(return_block->bl_data)));
 
+															// keep the location expression
+															if ((PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrLocation = (unsigned char *)malloc(return_block->bl_len)))
+															{
+																memcpy(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrLocation, return_block->bl_data, return_block->bl_len);
+																PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].LocationSize = return_block->bl_len;
+															}
+
 															switch (return_block->bl_len)
 															{
 															case 5:
@@ -806,6 +818,8 @@ void DWARFManager_InitDMI(void)
 												// Invalid variable
 												free(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrName);
 												PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrName = NULL;
+												free(PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrLocation);
+												PtrCU[NbCU].PtrVariables[PtrCU[NbCU].NbVariables].PtrLocation = NULL;
 											}
 										}
 
@@ -1153,6 +1167,13 @@ void DWARFManager_InitDMI(void)
 																			{
 																				PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].Op = *((unsigned char *)(return_block->bl_data));
 
+																				// keep the location expression
+																				if ((PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].PtrLocation = (unsigned char *)malloc(return_block->bl_len)))
+																				{
+																					memcpy(PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].PtrLocation, return_block->bl_data, return_block->bl_len);
+																					PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].PtrVariables[PtrCU[NbCU].PtrSubProgs[PtrCU[NbCU].NbSubProgs].NbVariables].LocationSize = return_block->bl_len;
+																				}
+
 																				switch (return_block->bl_len)
 																				{
 																				case 1:
@@ -2210,6 +2231,30 @@ char *DWARFManager_GetFunctionName(size_t Adr)
 }
 
 
+// Get function address range based on an address
+// Return false if no function has been found, otherwise the function's low and high PC are set
+bool DWARFManager_GetFunctionRange(size_t Adr, size_t *LowPC, size_t *HighPC)
+{
+	for (size_t i = 0; i < NbCU; i++)
+	{
+		if ((Adr >= PtrCU[i].LowPC) && (Adr < PtrCU[i].HighPC))
+		{
+			for (size_t j = 0; j < PtrCU[i].NbSubProgs; j++)
+			{
+				if ((Adr >= PtrCU[i].PtrSubProgs[j].LowPC) && (Adr < PtrCU[i].PtrSubProgs[j].HighPC))
+				{
+					*LowPC = PtrCU[i].PtrSubProgs[j].LowPC;
+					*HighPC = PtrCU[i].PtrSubProgs[j].HighPC;
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+
 // Get number of lines of texts source list from source index
 size_t DWARFManager_GetSrcNbListPtrFromIndex(size_t Index, bool Used)
 {
@@ -24,6 +24,7 @@ extern size_t DWARFManager_GetNbSources(void);
 
 // General manager
 extern char *DWARFManager_GetFunctionName(size_t Adr);
+extern bool DWARFManager_GetFunctionRange(size_t Adr, size_t *LowPC, size_t *HighPC);
 extern size_t DWARFManager_GetSrcLanguageFromIndex(size_t Index);
 
 // Source text files manager
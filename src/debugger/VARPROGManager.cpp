@@ -0,0 +1,617 @@
+//
+// VARPROGManager.cpp: Variables location programs manager
+//
+// by Jean-Paul Mari
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// WHO  WHEN        WHAT
+// ---  ----------  ------------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Dereferenced address checked without the wrap
+//
+
+// The variable's DW_OP location expression, and its type formatting, are compiled once in a
+// small program: the operands are decoded, the literals, constants and registers ops are merged,
+// and the value format is selected from the type encoding & size. The programs are cached per
+// variable (DIE) and function address range, so the locals and watches refresh only runs them
+// against the M68K registers and the memory.
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "LEB128.h"
+#include "DBGManager.h"
+#include "VARPROGManager.h"
+#include "settings.h"
+#include "memory.h"
+#include "m68000/m68kinterface.h"
+
+
+// Definitions for the programs
+#define VARPROG_MAXCODES		16						// Codes number in a program
+#define VARPROG_STACKSIZE		8						// Evaluation stack size
+#define VARPROG_HASHSIZE		1024					// Programs cache buckets number
+#define VARPROG_MEMSIZE			0xF20000				// Jaguar memory space size
+#define VARPROG_REGISTERS		16						// M68K registers (D0-D7, A0-A7)
+
+// Value formats, from the type encoding & size
+typedef enum {
+	VARPROG_FORMAT_NONE = 0,
+	VARPROG_FORMAT_BOOL,
+	VARPROG_FORMAT_FLOAT,
+	VARPROG_FORMAT_DOUBLE,
+	VARPROG_FORMAT_SHORT,
+	VARPROG_FORMAT_INT,
+	VARPROG_FORMAT_LONG,
+	VARPROG_FORMAT_USHORT,
+	VARPROG_FORMAT_UINT,
+	VARPROG_FORMAT_ULONG,
+	VARPROG_FORMAT_UCHAR,
+	VARPROG_FORMAT_PTR
+}VARPROGFORMAT;
+
+// Program code
+// The op is a DW_OP, the lit, const & reg ops are set to consts, regx & bregx
+typedef struct VarProgCode
+{
+	uint8_t Op;
+	uint8_t Reg;									// Register number (regx & bregx)
+	int32_t Operand;								// Decoded operand
+}S_VarProgCode;
+
+// Program
+typedef struct VarProg
+{
+	S_VariablesStruct *PtrVariable;					// Variable (DIE)
+	size_t LowPC, HighPC;							// Function address range (0 for a global variable)
+	size_t NbCodes;									// Codes number, 0 if the location cannot be compiled
+	S_VarProgCode Codes[VARPROG_MAXCODES];
+	size_t Format;									// Value format
+	size_t Size;									// Value size
+	size_t MemSize;									// Memory limit for the location
+	VarProg *PtrNext;								// Next program in the cache bucket
+}S_VarProg;
+
+
+// Programs management
+VarProg **PtrVarProgs;
+char VarProgValue[1000];
+
+const char *VarProgRegName[VARPROG_REGISTERS] = { "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "A0", "A1", "A2", "A3", "A4", "A5", "A6", "A7" };
+
+
+// Function declarations
+bool VARPROGManager_Compile(VarProg *PtrProg);
+size_t VARPROGManager_GetFormat(size_t TypeEncoding, size_t TypeByteSize);
+
+
+// Programs manager initialisation
+void VARPROGManager_Init(void)
+{
+	PtrVarProgs = (VarProg **)calloc(VARPROG_HASHSIZE, sizeof(VarProg *));
+}
+
+
+// Programs manager reset
+// The programs are freed, as they refer to the variables information
+void VARPROGManager_Reset(void)
+{
+	if (PtrVarProgs)
+	{
+		for (size_t i = 0; i < VARPROG_HASHSIZE; i++)
+		{
+			while (VarProg *PtrProg = PtrVarProgs[i])
+			{
+				PtrVarProgs[i] = PtrProg->PtrNext;
+				free(PtrProg);
+			}
+		}
+	}
+}
+
+
+// Programs manager close
+void VARPROGManager_Close(void)
+{
+	VARPROGManager_Reset();
+	free(PtrVarProgs);
+	PtrVarProgs = NULL;
+}
+
+
+// Get the value format from the type encoding & size
+// Same values as the ones displayed by DBGManager_GetVariableValueFromAdr
+size_t VARPROGManager_GetFormat(size_t TypeEncoding, size_t TypeByteSize)
+{
+	switch (TypeEncoding)
+	{
+	case DBG_ATE_boolean:
+		return VARPROG_FORMAT_BOOL;
+
+	case DBG_ATE_float:
+		return (TypeByteSize == 4) ? VARPROG_FORMAT_FLOAT : ((TypeByteSize == 8) ? VARPROG_FORMAT_DOUBLE : VARPROG_FORMAT_NONE);
+
+	case DBG_ATE_signed:
+		return (TypeByteSize == 2) ? VARPROG_FORMAT_SHORT : ((TypeByteSize == 4) ? VARPROG_FORMAT_INT : ((TypeByteSize == 8) ? VARPROG_FORMAT_LONG : VARPROG_FORMAT_NONE));
+
+	case DBG_ATE_unsigned:
+		return (TypeByteSize == 2) ? VARPROG_FORMAT_USHORT : ((TypeByteSize == 4) ? VARPROG_FORMAT_UINT : ((TypeByteSize == 8) ? VARPROG_FORMAT_ULONG : VARPROG_FORMAT_NONE));
+
+	case DBG_ATE_unsigned_char:
+		return VARPROG_FORMAT_UCHAR;
+
+	case DBG_ATE_ptr:
+		return (TypeByteSize == 4) ? VARPROG_FORMAT_PTR : VARPROG_FORMAT_NONE;
+
+	default:
+		return VARPROG_FORMAT_NONE;
+	}
+}
+
+
+// Compile the variable's location expression
+// Return false if the expression has an unsupported op
+bool VARPROGManager_Compile(VarProg *PtrProg)
+{
+	unsigned char *Ptr = PtrProg->PtrVariable->PtrLocation;
+	unsigned char *PtrEnd = Ptr + PtrProg->PtrVariable->LocationSize;
+	VarProgCode *PtrCode;
+	size_t Op, Reg;
+
+	while (Ptr < PtrEnd)
+	{
+		if (PtrProg->NbCodes == VARPROG_MAXCODES)
+		{
+			return false;
+		}
+
+		PtrCode = &PtrProg->Codes[PtrProg->NbCodes++];
+		PtrCode->Op = (uint8_t)(Op = *Ptr++);
+		PtrCode->Reg = 0;
+		PtrCode->Operand = 0;
+
+		if ((Op >= DBG_OP_lit0) && (Op <= DBG_OP_lit31))
+		{
+			PtrCode->Op = DBG_OP_consts;
+			PtrCode->Operand = (int32_t)(Op - DBG_OP_lit0);
+		}
+		else if ((Op >= DBG_OP_reg0) && (Op <= DBG_OP_reg31))
+		{
+			PtrCode->Op = DBG_OP_regx;
+			PtrCode->Reg = (uint8_t)(Op - DBG_OP_reg0);
+		}
+		else if ((Op >= DBG_OP_breg0) && (Op <= DBG_OP_breg31))
+		{
+			PtrCode->Op = DBG_OP_bregx;
+			PtrCode->Reg = (uint8_t)(Op - DBG_OP_breg0);
+			PtrCode->Operand = (int32_t)ReadLEB128((char *)Ptr);
+			while (*Ptr++ & 0x80);
+		}
+		else
+		{
+			switch (Op)
+			{
+			case DBG_OP_addr:
+				PtrCode->Op = DBG_OP_consts;
+				PtrCode->Operand = (int32_t)GET32(Ptr, 0);
+				Ptr += 4;
+				break;
+
+			case DBG_OP_const1u:
+			case DBG_OP_const1s:
+				PtrCode->Operand = (Op == DBG_OP_const1u) ? (int32_t)Ptr[0] : (int32_t)(int8_t)Ptr[0];
+				PtrCode->Op = DBG_OP_consts;
+				Ptr += 1;
+				break;
+
+			case DBG_OP_const2u:
+			case DBG_OP_const2s:
+				PtrCode->Operand = (Op == DBG_OP_const2u) ? (int32_t)GET16(Ptr, 0) : (int32_t)(int16_t)GET16(Ptr, 0);
+				PtrCode->Op = DBG_OP_consts;
+				Ptr += 2;
+				break;
+
+			case DBG_OP_const4u:
+			case DBG_OP_const4s:
+				PtrCode->Op = DBG_OP_consts;
+				PtrCode->Operand = (int32_t)GET32(Ptr, 0);
+				Ptr += 4;
+				break;
+
+			case DBG_OP_constu:
+			case DBG_OP_plus_uconst:
+			case DBG_OP_regx:
+				if (Op == DBG_OP_regx)
+				{
+					if ((Reg = ReadULEB128((char *)Ptr)) >= VARPROG_REGISTERS)
+					{
+						return false;
+					}
+					PtrCode->Reg = (uint8_t)Reg;
+				}
+				else
+				{
+					PtrCode->Operand = (int32_t)ReadULEB128((char *)Ptr);
+					PtrCode->Op = ((Op == DBG_OP_constu) ? DBG_OP_consts : DBG_OP_plus_uconst);
+				}
+				while (*Ptr++ & 0x80);
+				break;
+
+			case DBG_OP_consts:
+			case DBG_OP_fbreg:
+				PtrCode->Operand = (int32_t)ReadLEB128((char *)Ptr);
+				while (*Ptr++ & 0x80);
+				break;
+
+			case DBG_OP_bregx:
+				if ((Reg = ReadULEB128((char *)Ptr)) >= VARPROG_REGISTERS)
+				{
+					return false;
+				}
+				PtrCode->Reg = (uint8_t)Reg;
+				while (*Ptr++ & 0x80);
+				PtrCode->Operand = (int32_t)ReadLEB128((char *)Ptr);
+				while (*Ptr++ & 0x80);
+				break;
+
+			case DBG_OP_nop:
+				PtrProg->NbCodes--;
+				break;
+
+			case DBG_OP_deref:
+			case DBG_OP_dup:
+			case DBG_OP_drop:
+			case DBG_OP_over:
+			case DBG_OP_swap:
+			case DBG_OP_and:
+			case DBG_OP_minus:
+			case DBG_OP_mul:
+			case DBG_OP_neg:
+			case DBG_OP_not:
+			case DBG_OP_or:
+			case DBG_OP_plus:
+			case DBG_OP_shl:
+			case DBG_OP_shr:
+			case DBG_OP_shra:
+			case DBG_OP_xor:
+			case DBG_OP_stack_value:
+				break;
+
+			default:
+				return false;
+			}
+		}
+
+		// operands must fit in the expression, and the registers are the M68K ones
+		if ((Ptr > PtrEnd) || (PtrCode->Reg >= VARPROG_REGISTERS))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+// Get the variable's program for a function address range (0 for a global variable)
+// The program is compiled at the first request, and kept until the debugger reset
+// Return NULL if there is no program
+void *VARPROGManager_GetProgram(S_VariablesStruct *PtrVariable, size_t LowPC, size_t HighPC)
+{
+	VarProg *PtrProg;
+	size_t Hash;
+
+	if (!PtrVarProgs || !PtrVariable)
+	{
+		return NULL;
+	}
+
+	// look for the program in the cache
+	Hash = ((((size_t)PtrVariable >> 3) ^ LowPC) % VARPROG_HASHSIZE);
+	for (PtrProg = PtrVarProgs[Hash]; PtrProg; PtrProg = PtrProg->PtrNext)
+	{
+		if ((PtrProg->PtrVariable == PtrVariable) && (PtrProg->LowPC == LowPC) && (PtrProg->HighPC == HighPC))
+		{
+			return PtrProg;
+		}
+	}
+
+	// compile the program
+	if ((PtrProg = (VarProg *)calloc(1, sizeof(VarProg))))
+	{
+		PtrProg->PtrVariable = PtrVariable;
+		PtrProg->LowPC = LowPC;
+		PtrProg->HighPC = HighPC;
+		PtrProg->Format = VARPROGManager_GetFormat(PtrVariable->TypeEncoding, PtrVariable->TypeByteSize);
+		PtrProg->Size = PtrVariable->TypeByteSize ? PtrVariable->TypeByteSize : 1;
+		// local variables are on the stack, in RAM
+		PtrProg->MemSize = HighPC ? 0 : VARPROG_MEMSIZE;
+
+		if (!VARPROGManager_Compile(PtrProg))
+		{
+			PtrProg->NbCodes = 0;
+		}
+
+		PtrProg->PtrNext = PtrVarProgs[Hash];
+		PtrVarProgs[Hash] = PtrProg;
+	}
+
+	return PtrProg;
+}
+
+
+// Get the register name if the program's location is a register
+// Return NULL if the location is not a register
+char *VARPROGManager_GetRegisterName(void *PtrProgram)
+{
+	VarProg *PtrProg = (VarProg *)PtrProgram;
+
+	if (PtrProg && PtrProg->NbCodes && (PtrProg->Codes[PtrProg->NbCodes - 1].Op == DBG_OP_regx))
+	{
+		return (char *)VarProgRegName[PtrProg->Codes[PtrProg->NbCodes - 1].Reg];
+	}
+
+	return NULL;
+}
+
+
+// Run the program
+// The location address is set to 0 if the location is not in memory
+// Return value as a text pointer, NULL if the value cannot be read
+// Note: Pointer may point on a 0 length text
+char *VARPROGManager_Run(void *PtrProgram, size_t *Adr)
+{
+	VarProg *PtrProg = (VarProg *)PtrProgram;
+	uint32_t Stack[VARPROG_STACKSIZE], Value;
+	size_t Sp = 0, MemSize;
+	int Reg = -1;
+	bool StackValue = false;
+
+	*Adr = 0;
+
+	if (!PtrProg || !PtrProg->NbCodes)
+	{
+		return NULL;
+	}
+
+	MemSize = PtrProg->MemSize ? PtrProg->MemSize : vjs.DRAM_size;
+
+	for (size_t i = 0; i < PtrProg->NbCodes; i++)
+	{
+		VarProgCode *PtrCode = &PtrProg->Codes[i];
+
+		// check the stack room for the op
+		switch (PtrCode->Op)
+		{
+		case DBG_OP_consts:
+		case DBG_OP_bregx:
+		case DBG_OP_fbreg:
+		case DBG_OP_dup:
+		case DBG_OP_over:
+			if ((Sp == VARPROG_STACKSIZE) || ((PtrCode->Op == DBG_OP_dup) && (Sp < 1)) || ((PtrCode->Op == DBG_OP_over) && (Sp < 2)))
+			{
+				return NULL;
+			}
+			break;
+
+		case DBG_OP_regx:
+			break;
+
+		case DBG_OP_swap:
+		case DBG_OP_and:
+		case DBG_OP_minus:
+		case DBG_OP_mul:
+		case DBG_OP_or:
+		case DBG_OP_plus:
+		case DBG_OP_shl:
+		case DBG_OP_shr:
+		case DBG_OP_shra:
+		case DBG_OP_xor:
+			if (Sp < 2)
+			{
+				return NULL;
+			}
+			break;
+
+		default:
+			if (Sp < 1)
+			{
+				return NULL;
+			}
+			break;
+		}
+
+		switch (PtrCode->Op)
+		{
+		case DBG_OP_consts:
+			Stack[Sp++] = (uint32_t)PtrCode->Operand;
+			break;
+
+		case DBG_OP_bregx:
+			Stack[Sp++] = m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + PtrCode->Reg)) + PtrCode->Operand;
+			break;
+
+		case DBG_OP_fbreg:
+			// the frame base is A6
+			Stack[Sp++] = m68k_get_reg(NULL, M68K_REG_A6) + PtrCode->Operand;
+			break;
+
+		case DBG_OP_regx:
+			Reg = PtrCode->Reg;
+			break;
+
+		case DBG_OP_deref:
+			if ((MemSize < 4) || (Stack[Sp - 1] > (MemSize - 4)))
+			{
+				return NULL;
+			}
+			Stack[Sp - 1] = GET32(jagMemSpace, Stack[Sp - 1]);
+			break;
+
+		case DBG_OP_plus_uconst:
+			Stack[Sp - 1] += PtrCode->Operand;
+			break;
+
+		case DBG_OP_dup:
+			Stack[Sp] = Stack[Sp - 1];
+			Sp++;
+			break;
+
+		case DBG_OP_over:
+			Stack[Sp] = Stack[Sp - 2];
+			Sp++;
+			break;
+
+		case DBG_OP_drop:
+			Sp--;
+			break;
+
+		case DBG_OP_swap:
+			Value = Stack[Sp - 1];
+			Stack[Sp - 1] = Stack[Sp - 2];
+			Stack[Sp - 2] = Value;
+			break;
+
+		case DBG_OP_neg:
+			Stack[Sp - 1] = (uint32_t)-(int32_t)Stack[Sp - 1];
+			break;
+
+		case DBG_OP_not:
+			Stack[Sp - 1] = ~Stack[Sp - 1];
+			break;
+
+		case DBG_OP_stack_value:
+			StackValue = true;
+			break;
+
+		default:
+			Value = Stack[--Sp];
+			switch (PtrCode->Op)
+			{
+			case DBG_OP_and:
+				Stack[Sp - 1] &= Value;
+				break;
+
+			case DBG_OP_minus:
+				Stack[Sp - 1] -= Value;
+				break;
+
+			case DBG_OP_mul:
+				Stack[Sp - 1] *= Value;
+				break;
+
+			case DBG_OP_or:
+				Stack[Sp - 1] |= Value;
+				break;
+
+			case DBG_OP_plus:
+				Stack[Sp - 1] += Value;
+				break;
+
+			case DBG_OP_shl:
+				Stack[Sp - 1] = (Value < 32) ? (Stack[Sp - 1] << Value) : 0;
+				break;
+
+			case DBG_OP_shr:
+				Stack[Sp - 1] = (Value < 32) ? (Stack[Sp - 1] >> Value) : 0;
+				break;
+
+			case DBG_OP_shra:
+				Stack[Sp - 1] = (uint32_t)((int32_t)Stack[Sp - 1] >> ((Value < 32) ? Value : 31));
+				break;
+
+			case DBG_OP_xor:
+				Stack[Sp - 1] ^= Value;
+				break;
+			}
+			break;
+		}
+	}
+
+	// the location must be set
+	if ((Reg < 0) && !Sp)
+	{
+		return NULL;
+	}
+
+	// value from a register, or computed
+	if ((Reg >= 0) || StackValue)
+	{
+		sprintf(VarProgValue, "0x%x", (Reg >= 0) ? m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + Reg)) : Stack[Sp - 1]);
+		return VarProgValue;
+	}
+
+	// value from memory
+	if ((Stack[Sp - 1] < 4) || ((Stack[Sp - 1] + PtrProg->Size) > MemSize))
+	{
+		return NULL;
+	}
+
+	uint8_t *Ptr = &jagMemSpace[*Adr = Stack[Sp - 1]];
+	uint64_t Value64;
+	float F;
+	double D;
+
+	VarProgValue[0] = 0;
+
+	switch (PtrProg->Format)
+	{
+	case VARPROG_FORMAT_BOOL:
+		sprintf(VarProgValue, "%s", Ptr[PtrProg->Size - 1] ? "true" : "false");
+		break;
+
+	case VARPROG_FORMAT_FLOAT:
+		Value = GET32(Ptr, 0);
+		memcpy(&F, &Value, sizeof(F));
+		sprintf(VarProgValue, "%F", F);
+		break;
+
+	case VARPROG_FORMAT_DOUBLE:
+		Value64 = GET64(Ptr, 0);
+		memcpy(&D, &Value64, sizeof(D));
+		sprintf(VarProgValue, "%F", D);
+		break;
+
+	case VARPROG_FORMAT_SHORT:
+		sprintf(VarProgValue, "%i", (int16_t)GET16(Ptr, 0));
+		break;
+
+	case VARPROG_FORMAT_INT:
+		sprintf(VarProgValue, "%i", (int32_t)GET32(Ptr, 0));
+		break;
+
+	case VARPROG_FORMAT_LONG:
+		// the lower 32 bits, as displayed by the DBG manager
+		sprintf(VarProgValue, "%i", (int32_t)GET32(Ptr, 4));
+		break;
+
+	case VARPROG_FORMAT_USHORT:
+		sprintf(VarProgValue, "%u", (uint16_t)GET16(Ptr, 0));
+		break;
+
+	case VARPROG_FORMAT_UINT:
+		sprintf(VarProgValue, "%u", (uint32_t)GET32(Ptr, 0));
+		break;
+
+	case VARPROG_FORMAT_ULONG:
+		sprintf(VarProgValue, "%u", (uint32_t)GET32(Ptr, 4));
+		break;
+
+	case VARPROG_FORMAT_UCHAR:
+		// char is sign extended, as displayed by the DBG manager
+		sprintf(VarProgValue, "%u", (unsigned int)(char)Ptr[PtrProg->Size - 1]);
+		break;
+
+	case VARPROG_FORMAT_PTR:
+		sprintf(VarProgValue, "0x%06x", (uint32_t)GET32(Ptr, 0));
+		break;
+
+	default:
+		break;
+	}
+
+	return VarProgValue;
+}
@@ -0,0 +1,18 @@
+
+
+#ifndef __VARPROGMANAGER_H__
+#define __VARPROGMANAGER_H__
+
+
+// Internal manager
+extern void VARPROGManager_Init(void);
+extern void VARPROGManager_Reset(void);
+extern void VARPROGManager_Close(void);
+
+// Programs manager
+extern void *VARPROGManager_GetProgram(S_VariablesStruct *PtrVariable, size_t LowPC, size_t HighPC);
+extern char *VARPROGManager_GetRegisterName(void *PtrProgram);
+extern char *VARPROGManager_Run(void *PtrProgram, size_t *Adr);
+
+
+#endif	// __VARPROGMANAGER_H__
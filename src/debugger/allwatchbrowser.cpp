@@ -11,6 +11,7 @@
 // JPM  09/14/2018  Added a status bar, better status report and set information values in a tab
 // JPM  April/2019  Added a sorting filter, tableview unique rows creation
 // JPM  April/2021  Added a search feature.
+// JPM   Oct./2026  Values read through the variables location programs, rows created once
 //
 
 // STILL TO DO:
@@ -33,6 +34,7 @@
 #include "debugger/allwatchbrowser.h"
 #include "memory.h"
 #include "debugger/DBGManager.h"
+#include "debugger/VARPROGManager.h"
 
 
 // 
@@ -49,7 +51,8 @@ model(new QStandardItemModel),
 NbWatch(0),
 CurrentWatch(0),
 statusbar(new QStatusBar),
-PtrWatchInfo(NULL)
+PtrWatchInfo(NULL),
+PtrWatchProgram(NULL)
 {
 	setWindowTitle(tr("All Watch"));
 
@@ -166,8 +169,10 @@ void AllWatchBrowserWindow::SelectSearchSymbol(void)
 void AllWatchBrowserWindow::Reset(void)
 {
 	free(PtrWatchInfo);
+	free(PtrWatchProgram);
 	NbWatch = 0;
 	PtrWatchInfo = NULL;
+	PtrWatchProgram = NULL;
 }
 
 
@@ -181,6 +186,8 @@ void AllWatchBrowserWindow::RefreshContents(void)
 	QString WatchAll;
 	size_t Error = AW_NOERROR;
 	char *PtrValue;
+	size_t Adr;
+	QString Value;
 	//S_VariablesStruct* Var;
 
 	if (isVisible())
@@ -191,6 +198,7 @@ void AllWatchBrowserWindow::RefreshContents(void)
 			if (NbWatch = DBGManager_GetNbVariables(NULL))
 			{
 				PtrWatchInfo = (void**)calloc(NbWatch, sizeof(S_VariablesStruct*));
+				PtrWatchProgram = (void**)calloc(NbWatch, sizeof(void*));
 #ifndef AW_LAYOUTTEXTS
 #ifdef AW_SORTINGFILTER
 				TableView->setSortingEnabled(false);
@@ -209,7 +217,15 @@ void AllWatchBrowserWindow::RefreshContents(void)
 						}
 #else
 						model->insertRow(i);
+						model->setItem(i, 0, new QStandardItem(QString("%1").arg(((S_VariablesStruct*)PtrWatchInfo[i])->PtrName)));
+						model->setItem(i, 1, new QStandardItem(QString("")));
+						model->setItem(i, 2, new QStandardItem(QString("%1").arg(((S_VariablesStruct*)PtrWatchInfo[i])->PtrTypeName)));
 #endif
+						// arrays and structures values are not displayed
+						if (!(((S_VariablesStruct*)PtrWatchInfo[i])->TypeTag & (DBG_TAG_TYPE_array | DBG_TAG_TYPE_structure)))
+						{
+							PtrWatchProgram[i] = VARPROGManager_GetProgram((S_VariablesStruct*)PtrWatchInfo[i], 0, 0);
+						}
 					}
 				}
 			}
@@ -219,19 +235,8 @@ void AllWatchBrowserWindow::RefreshContents(void)
 		{
 			for (uint32_t i = AW_STARTNUMVARIABLE; i < NbWatch; i++)
 			{
-				if (((S_VariablesStruct*)PtrWatchInfo[i])->TypeTag & (DBG_TAG_TYPE_array | DBG_TAG_TYPE_structure))
-				{
-#if defined(AW_SUPPORTARRAY) || defined(AW_SUPPORTSTRUCTURE)
-					//PtrValue = (char *)memcpy(Value, &jaguarMainRAM[PtrWatchInfo[i].addr], 20);
-					PtrValue = NULL;
-#else
-					PtrValue = NULL;
-#endif
-				}
-				else
-				{
-					PtrValue = DBGManager_GetVariableValueFromAdr(((S_VariablesStruct*)PtrWatchInfo[i])->Addr, ((S_VariablesStruct*)PtrWatchInfo[i])->TypeEncoding, ((S_VariablesStruct*)PtrWatchInfo[i])->TypeByteSize);
-				}
+				// run the variable's location program
+				PtrValue = VARPROGManager_Run(PtrWatchProgram[i], &Adr);
 #ifdef AW_LAYOUTTEXTS
 				if (i)
 				{
@@ -240,9 +245,12 @@ void AllWatchBrowserWindow::RefreshContents(void)
 				sprintf(string, "%i : %s | %s | 0x%06X | %s", (i + 1), PtrWatchInfo[i].PtrVariableBaseTypeName, PtrWatchInfo[i].PtrVariableName, (unsigned int)PtrWatchInfo[i].addr, PtrValue ? PtrValue : (char *)"<font color='#ff0000'>N/A</font>");
 				WatchAll += QString(string);
 #else
-				model->setItem(i, 0, new QStandardItem(QString("%1").arg(((S_VariablesStruct*)PtrWatchInfo[i])->PtrName)));
-				model->setItem(i, 1, new QStandardItem(QString("%1").arg(PtrValue)));
-				model->setItem(i, 2, new QStandardItem(QString("%1").arg(((S_VariablesStruct*)PtrWatchInfo[i])->PtrTypeName)));
+				// the rows are created once, only the changed values are set
+				Value = QString("%1").arg(PtrValue);
+				if (model->item(i, 1)->text() != Value)
+				{
+					model->item(i, 1)->setText(Value);
+				}
 #endif
 			}
 #ifdef AW_LAYOUTTEXTS
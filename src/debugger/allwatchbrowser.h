@@ -66,6 +66,7 @@ class AllWatchBrowserWindow: public QWidget
 		QStatusBar *statusbar;
 		//WatchInfo *PtrWatchInfo;
 		void **PtrWatchInfo;
+		void **PtrWatchProgram;
 		size_t NbWatch;
 		QPushButton *search;
 		QLineEdit* symbol;
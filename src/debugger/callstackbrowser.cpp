@@ -13,11 +13,10 @@
 // JPM  08/09/2019    Prevent crash in case of call stack is out of range
 // JPM  03/16/2020    Modified the layout window and added source filename from the called source line
 // JPM  April/2021    Added a #line information
+// JPM   Oct./2026    Frames from the stack unwinder, rows kept per return address
 
 // STILL TO DO:
 // To set the information display at the right
-// To use DWARF frame information?
-// To check if call stack pointer is used (DWARF information?)
 //
 
 #include "debugger/callstackbrowser.h"
@@ -78,89 +77,90 @@ CallStackBrowserWindow::~CallStackBrowserWindow(void)
 }
 
 
+// Reset the rows kept from the previous program
+void CallStackBrowserWindow::Reset(void)
+{
+	Rows.clear();
+}
+
+
+// Get the symbolised row of a return address
+// The rows are kept, the debug information does not change for a program
+const CallStackBrowserWindow::S_CallStackRow &CallStackBrowserWindow::GetRow(uint32_t ret)
+{
+	QHash<uint32_t, S_CallStackRow>::const_iterator it = Rows.constFind(ret);
+	DBGstatus FilenameStatus;
+	S_CallStackRow Row;
+	char msg[1024];
+	char *Name;
+
+	if (it != Rows.constEnd())
+	{
+		return *it;
+	}
+
+	// function name
+	Row.Function = QString("%1").arg((Name = DBGManager_GetFunctionName(ret)) ? Name : "(N/A)");
+	// line number
+	sprintf(msg, "%zi", DBGManager_GetNumLineFromAdr(ret, DBG_NO_TAG));
+	Row.NumLine = QString("%1").arg((msg[0] != '0') ? msg : "(N/A)");
+	// called line
+	Row.Line = (Name = DBGManager_GetLineSrcFromAdr(ret, DBG_NO_TAG)) ? QString(Name).trimmed() : QString("(N/A)");
+	// source filename from called source line
+	Row.Filename = QString("%1").arg(((Name = DBGManager_GetFullSourceFilenameFromAdr(ret, &FilenameStatus)) && !FilenameStatus) ? Name : "(N/A)");
+
+	return *Rows.insert(ret, Row);
+}
+
+
 // 
 void CallStackBrowserWindow::RefreshContents(void)
 {
+	static const char *MethodName[] = { "call frame information", "function prologue", "A6 frames chain" };
 	char msg[1024];
 	size_t Error = CS_NOERROR;
-	DBGstatus FilenameStatus;
-	unsigned int a6, Sa6, ret;
-	char *Name;
-	size_t NumError = 0;
+	uint32_t NbFrames, ret;
 #ifdef CS_LAYOUTTEXTS
 	QString CallStack;
 	char string[1024];
 #else
-	int NbRaw = 0;
-	QString FunctionName;
+	QStandardItem *Item;
 #endif
 
 	if (isVisible())
 	{
+		if (DBGManager_GetType() && (NbFrames = UnwindStack(Frames, UNWIND_FRAMES_MAX)))
+		{
 #ifndef CS_LAYOUTTEXTS
-		model->setRowCount(0);
+			model->setRowCount(NbFrames);
 #endif
-		if ((a6 = m68k_get_reg(NULL, M68K_REG_A6)) && DBGManager_GetType())
-		{
-			while ((Sa6 = a6) && !NumError)
+			for (uint32_t i = 0; i < NbFrames; i++)
 			{
-				if ((Sa6 >= (m68k_get_reg(NULL, M68K_REG_SP) - 4)) && (Sa6 < vjs.DRAM_size))
-				{
-					a6 = GET32(jaguarMainRAM, Sa6);
-					ret = GET32(jaguarMainRAM, Sa6 + 4);
+				const S_CallStackRow &Row = GetRow(ret = Frames[i].returnAddress);
+				sprintf(msg, "0x%06X", ret);
 #ifdef CS_LAYOUTTEXTS
-					sprintf(string, "0x%06X | Ret: 0x%06X | From: %s - 0x%06X | Line: %s", Sa6, ret, (Name = DBGManager_GetFunctionName(ret)), (unsigned int)DBGManager_GetAdrFromSymbolName(Name), DBGManager_GetLineSrcFromAdr(ret, DBG_NO_TAG));
-					CallStack += QString(string);
-					if (a6)
-					{
-						CallStack += QString("<br>");
-					}
-#else
-					// insert line
-					model->insertRow(NbRaw);
-					// display the function name
-					model->setItem(NbRaw, 0, new QStandardItem(QString("%1").arg((Name = DBGManager_GetFunctionName(ret)) ? Name : "(N/A)")));
-					// display the line number
-					sprintf(msg, "%zi", DBGManager_GetNumLineFromAdr(ret, DBG_NO_TAG));
-					model->setItem(NbRaw, 1, new QStandardItem(QString("%1").arg((msg[0] != '0') ? msg : "(N/A)")));
-					// display the called line
-					FunctionName = QString(Name = DBGManager_GetLineSrcFromAdr(ret, DBG_NO_TAG));
-					//FunctionName.replace("&nbsp;", " ");
-					FunctionName = FunctionName.trimmed();
-					model->setItem(NbRaw, 2, new QStandardItem(QString("%1").arg(Name ? FunctionName : "(N/A)")));
-					// display the return address
-					sprintf(msg, "0x%06X", ret);
-					model->setItem(NbRaw, 3, new QStandardItem(QString("%1").arg(msg)));
-					// display the source filename from called source line
-					model->setItem(NbRaw++, 4, new QStandardItem(QString("%1").arg(((Name = DBGManager_GetFullSourceFilenameFromAdr(ret, &FilenameStatus)) && !FilenameStatus) ? Name : "(N/A)")));
-#endif
-				}
-				else
+				sprintf(string, "0x%06X | Ret: %s | From: %s | Line: %s", Frames[i].cfa, msg, Row.Function.toLatin1().constData(), Row.Line.toLatin1().constData());
+				CallStack += QString(string);
+				if ((i + 1) < NbFrames)
 				{
-					NumError = 0x1;
+					CallStack += QString("<br>");
 				}
+#else
+				model->setItem(i, 0, new QStandardItem(Row.Function));
+				model->setItem(i, 1, new QStandardItem(Row.NumLine));
+				model->setItem(i, 2, new QStandardItem(Row.Line));
+				// display the return address, and how it has been found
+				model->setItem(i, 3, (Item = new QStandardItem(QString("%1").arg(msg))));
+				Item->setToolTip(QString("From the %1").arg(MethodName[Frames[i].method]));
+				model->setItem(i, 4, new QStandardItem(Row.Filename));
+#endif
 			}
 #ifdef CS_LAYOUTTEXTS
 			text->clear();
 			text->setText(CallStack);
 #endif
-			switch (NumError)
-			{
-			case 0:
-				sprintf(msg, "Ready");
-				Error = CS_NOERROR;
-				break;
-
-			case 0x1:
-				sprintf(msg, "Call Stack out of range");
-				Error = CS_ERROR;
-				break;
-
-			default:
-				sprintf(msg, "Call Stack in limbo");
-				Error = CS_WARNING;
-				break;
-			}
+			sprintf(msg, "Ready");
+			Error = CS_NOERROR;
 		}
 		else
 		{
@@ -168,6 +168,8 @@ void CallStackBrowserWindow::RefreshContents(void)
 			Error = CS_NOCALLSTACK;
 #ifdef CS_LAYOUTTEXTS
 			text->clear();
+#else
+			model->setRowCount(0);
 #endif
 		}
 
@@ -11,6 +11,7 @@
 
 #include <QtWidgets/QtWidgets>
 #include <stdint.h>
+#include "unwind.h"
 
 // Error code definitions
 #define	CS_NOERROR		0x00
@@ -30,11 +31,22 @@ class CallStackBrowserWindow : public QWidget
 
 	public slots:
 		void RefreshContents(void);
+		void Reset(void);
 
 	protected:
 		void keyPressEvent(QKeyEvent *);
 
 	private:
+		struct S_CallStackRow
+		{
+			QString Function;
+			QString NumLine;
+			QString Line;
+			QString Filename;
+		};
+		const S_CallStackRow &GetRow(uint32_t ret);
+		QHash<uint32_t, S_CallStackRow> Rows;
+		UnwindFrame Frames[UNWIND_FRAMES_MAX];
 		QVBoxLayout *layout;
 		QStatusBar *statusbar;
 #ifdef CS_LAYOUTTEXTS
@@ -13,6 +13,7 @@
 //  RG   Jan./2021  Linux build fixes
 // JPM    May/2021  Display the structure's members
 // JPM   Oct./2021  Fix a crash for inaccessible memory range, and added an error icon in case of values cannot be read
+// JPM   Oct./2026  Values read through the variables location programs, rows created only for a new function
 //
 
 // STILL TO DO:
@@ -29,6 +30,7 @@
 #include "debugger/localbrowser.h"
 #include "memory.h"
 #include "debugger/DBGManager.h"
+#include "debugger/VARPROGManager.h"
 #include "settings.h"
 #include "m68000/m68kinterface.h"
 
@@ -41,8 +43,7 @@ model(new QStandardItemModel),
 NbLocal(0),
 FuncName(NULL),
 LocalInfo(NULL),
-statusbar(new QStatusBar),
-ExRegA6(-1)
+statusbar(new QStatusBar)
 {
 	setWindowTitle(tr("Locals"));
 #ifdef LOCAL_FONTS
@@ -76,11 +77,21 @@ LocalBrowserWindow::~LocalBrowserWindow(void)
 }
 
 
+// Reset the local variables information
+// The variables information and their programs are no more valid
+void LocalBrowserWindow::Reset(void)
+{
+	FuncName = NULL;
+	NbLocal = 0;
+	model->setRowCount(0);
+}
+
+
 // Get the local variables information
 // Return true for a new local variables set
 bool LocalBrowserWindow::UpdateInfos(void)
 {
-	size_t Adr;
+	size_t Adr, LowPC, HighPC;
 	char *Ptr;
 
 	// get number of local variables located in the M68K PC address
@@ -94,15 +105,21 @@ bool LocalBrowserWindow::UpdateInfos(void)
 			{
 				// function is different
 				FuncName = Ptr;
+				if (!DBGManager_GetFunctionRange(Adr, &LowPC, &HighPC))
+				{
+					LowPC = HighPC = Adr;
+				}
+
 				if (LocalInfo = (S_LocalInfo*)realloc(LocalInfo, (sizeof(S_LocalInfo) * NbLocal)))
 				{
 					for (size_t i = 0; i < NbLocal; i++)
 					{
-						// get local variable name and his information
+						// get local variable name and his information, with his location program
 						if ((LocalInfo[i].PtrVariable = DBGManager_GetInfosVariable(Adr, i + 1)))
 						{
 							LocalInfo[i].Adr = 0;
-							LocalInfo[i].PtrCPURegisterName = NULL;
+							LocalInfo[i].PtrProgram = VARPROGManager_GetProgram((S_VariablesStruct*)LocalInfo[i].PtrVariable, LowPC, HighPC);
+							LocalInfo[i].PtrCPURegisterName = VARPROGManager_GetRegisterName(LocalInfo[i].PtrProgram);
 						}
 					}
 				}
@@ -155,6 +172,9 @@ void LocalBrowserWindow::setValueRow(QStandardItem *Row, size_t Adr, char* Value
 			// check the pointer's value
 			if (((Adr = GET32(jagMemSpace, Adr)) >= 4) && (Adr < vjs.DRAM_size))
 			{
+				// the rows are kept from a refresh to another
+				child->setIcon(QIcon());
+
 				// loop on the variables list
 				for (size_t i = 0; i < nb; i++)
 				{
@@ -188,23 +208,17 @@ void LocalBrowserWindow::setValueRow(QStandardItem *Row, size_t Adr, char* Value
 void LocalBrowserWindow::RefreshContents(void)
 {
 	size_t Error = LOCAL_NOERROR;
-	size_t RegA6;
 	QString Local;
 	QString MSG;
-	char Value1[100];
 	char *PtrValue;
 
-	// local variables may come from M68K registers
-	const char *CPURegName[] = { "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "A0", "A1", "A2", "A3", "A4", "A5", "A6", "A7" };
-
 	// refresh only if local's window is displayed
 	if (isVisible())
 	{
 		// get local's information
-		if (UpdateInfos() || (ExRegA6 != m68k_get_reg(NULL, M68K_REG_A6)))
+		if (UpdateInfos())
 		{
 			// erase the previous variables list
-			ExRegA6 = RegA6 = m68k_get_reg(NULL, M68K_REG_A6);
 			model->setRowCount(0);
 
 			// loop on the locals found
@@ -219,29 +233,13 @@ void LocalBrowserWindow::RefreshContents(void)
 					// check if the local variable is use by the code
 					if (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op)
 					{
-						// local or parameters variables
-						if (((((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op >= DBG_OP_breg0) && (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op <= DBG_OP_breg31)) || (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op == DBG_OP_fbreg))
-						{
-							// get variable's address
-							LocalInfo[i].Adr = RegA6 + ((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Offset;
-							// check variable's parameter op
-							//if ((((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op == DBG_OP_fbreg))
-							//{
-							//	LocalInfo[i].Adr += 8;
-							//}
-						}
-						else
+						// variable type from CPU register
+						if (LocalInfo[i].PtrCPURegisterName)
 						{
-							// variable type from CPU register
-							if ((((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op >= DBG_OP_reg0) && (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op <= DBG_OP_reg31))
-							{
-								// set color text for a register type variable
-								model->item((int)i, 0)->setForeground(QColor(0, 0, 0xfe));
-								model->item((int)i, 1)->setForeground(QColor(0, 0, 0xfe));
-								model->item((int)i, 2)->setForeground(QColor(0, 0, 0xfe));
-								// get the register's name
-								LocalInfo[i].PtrCPURegisterName = (char *)CPURegName[(((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op - DBG_OP_reg0)];
-							}
+							// set color text for a register type variable
+							model->item((int)i, 0)->setForeground(QColor(0, 0, 0xfe));
+							model->item((int)i, 1)->setForeground(QColor(0, 0, 0xfe));
+							model->item((int)i, 2)->setForeground(QColor(0, 0, 0xfe));
 						}
 					}
 					else
@@ -263,28 +261,8 @@ void LocalBrowserWindow::RefreshContents(void)
 				// check if the local variable is use by the code
 				if (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op)
 				{
-					// variable's address must fit in RAM
-					if ((LocalInfo[i].Adr >= 4) && (LocalInfo[i].Adr < vjs.DRAM_size))
-					{
-						// get the variable's value
-						PtrValue = DBGManager_GetVariableValueFromAdr(LocalInfo[i].Adr, ((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->TypeEncoding, ((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->TypeByteSize);
-					}
-					else
-					{
-						// check CPU register's type variable
-						if (LocalInfo[i].PtrCPURegisterName)
-						{
-							// get the value from register
-							memset(Value1, 0, sizeof(Value1));
-							sprintf(Value1, "0x%x", m68k_get_reg(NULL, (m68k_register_t)((size_t)M68K_REG_D0 + (((S_VariablesStruct*)(LocalInfo[i].PtrVariable))->Op - DBG_OP_reg0))));
-							PtrValue = Value1;
-						}
-						else
-						{
-							// no value can be found
-							PtrValue = NULL;
-						}
-					}
+					// get the variable's value, and his address, from the location program
+					PtrValue = VARPROGManager_Run(LocalInfo[i].PtrProgram, &LocalInfo[i].Adr);
 
 					// display icon for unavailable value
 					if (!PtrValue)
@@ -293,12 +271,18 @@ void LocalBrowserWindow::RefreshContents(void)
 					}
 					else
 					{
+						// the rows are kept from a refresh to another
+						model->item((int)i, 1)->setIcon(QIcon());
+
 						// do not display arrays
 						if (!(((S_VariablesStruct*)LocalInfo[i].PtrVariable)->TypeTag & DBG_TAG_TYPE_array))
 						{
 							// set the local's variable value
 							model->item((int)i, 1)->setText(QString("%1").arg(PtrValue));
-							setValueRow(model->item((int)i), LocalInfo[i].Adr, PtrValue, (S_VariablesStruct*)(LocalInfo[i].PtrVariable));
+							if (LocalInfo[i].Adr)
+							{
+								setValueRow(model->item((int)i), LocalInfo[i].Adr, PtrValue, (S_VariablesStruct*)(LocalInfo[i].PtrVariable));
+							}
 						}
 						//else
 						//{
@@ -29,12 +29,14 @@ class LocalBrowserWindow: public QWidget
 		size_t Adr;
 		char *PtrCPURegisterName;
 		void *PtrVariable;
+		void *PtrProgram;
 	}
 	S_LocalInfo;
 
 	public:
 		LocalBrowserWindow(QWidget *parent = 0);
 		~LocalBrowserWindow(void);
+		void Reset(void);
 
 	public slots:
 		void RefreshContents(void);
@@ -53,7 +55,6 @@ class LocalBrowserWindow: public QWidget
 		QStatusBar *statusbar;
 		size_t NbLocal;
 		char *FuncName;
-		size_t ExRegA6;
 };
 
 #endif	// __LOCALBROWSER_H__
@@ -0,0 +1,309 @@
+//
+// Guest debug port
+//
+// The guest programs (68K, GPU & DSP) write to a reserved range of the
+// unmapped space to build text lines, to set begin/end timing markers, or to
+// report the failed assertions. The port is decoded in the unknown locations
+// handlers, so the emulation and the guest timing are unchanged: a port write
+// costs the bus cycles of any unmapped write. Each bus master has its own
+// line and its own long registers latches, the interleaved writes do not mix.
+//
+// The events are stamped with the RISC cycles of the main events list, plus
+// the cycles run by the 68K in its current slice; the GPU & DSP writes get
+// the end of the 68K slice. They go in a ring read without a lock by one
+// consumer (the GUI or the headless runner), and are dropped (and counted)
+// when the consumer is late. The DSP writes from the audio thread, so the
+// producers (the ring head, the lines and the begin markers) share a lock.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Producers locked, the DSP writes from the audio thread
+//
+
+#include "debugport.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <unordered_map>
+#include "event.h"
+#include "log.h"
+#include "memory.h"
+#include "m68000/m68kinterface.h"
+
+// Ring size, a power of 2
+#define DEBUGPORT_RING_SIZE	1024
+#define DEBUGPORT_MASTERS	10
+
+// Line & long registers latch of a bus master
+struct DebugPortMaster
+{
+	char text[DEBUGPORT_TEXT_MAX];
+	uint32_t length;
+	uint16_t latch;
+};
+
+static DebugPortEvent debugPortRing[DEBUGPORT_RING_SIZE];
+static std::atomic<uint32_t> debugPortHead(0), debugPortTail(0);
+static std::atomic<uint32_t> debugPortDropped(0);
+static DebugPortMaster debugPortMasters[DEBUGPORT_MASTERS];
+static std::unordered_map<uint32_t, uint64_t> debugPortBegins;			// Begin markers cycles, per identifier
+static std::mutex debugPortMutex;						// Producers side
+
+
+//
+// Forget the lines & the markers, the events not read are kept
+//
+void DebugPortReset(void)
+{
+	std::lock_guard<std::mutex> lock(debugPortMutex);
+	memset(debugPortMasters, 0, sizeof(debugPortMasters));
+	debugPortBegins.clear();
+}
+
+
+//
+static uint64_t DebugPortCycles(void)
+{
+	int cycles = m68k_cycles_run();
+	return (uint64_t)(GetEventListTime(EVENT_MAIN) / (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC)) + ((cycles > 0) ? (2 * cycles) : 0);
+}
+
+
+//
+// Send an event, the text and the assertion events take the line of the master
+// The producers are locked by the register writes
+//
+static void DebugPortSend(uint32_t type, uint32_t who, uint32_t id, uint64_t cycles, uint64_t duration)
+{
+	DebugPortMaster & master = debugPortMasters[who];
+	uint32_t head = debugPortHead.load(std::memory_order_relaxed);
+
+	if ((head - debugPortTail.load(std::memory_order_acquire)) == DEBUGPORT_RING_SIZE)
+	{
+		debugPortDropped.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		DebugPortEvent & event = debugPortRing[head & (DEBUGPORT_RING_SIZE - 1)];
+		event.type = type;
+		event.who = who;
+		event.id = id;
+		event.cycles = cycles;
+		event.duration = duration;
+		event.text[0] = 0;
+
+		if ((type == DEBUGPORT_TEXT) || (type == DEBUGPORT_ASSERTION))
+		{
+			memcpy(event.text, master.text, master.length);
+			event.text[master.length] = 0;
+		}
+
+		debugPortHead.store(head + 1, std::memory_order_release);
+	}
+
+	if ((type == DEBUGPORT_TEXT) || (type == DEBUGPORT_ASSERTION))
+	{
+		master.length = 0;
+	}
+}
+
+
+//
+// Append a character to the line, a full line is sent
+//
+static void DebugPortPutChar(uint32_t who, uint8_t c)
+{
+	DebugPortMaster & master = debugPortMasters[who];
+
+	if (c == '\n')
+	{
+		DebugPortSend(DEBUGPORT_TEXT, who, 0, DebugPortCycles(), 0);
+	}
+	else if (c != '\r')
+	{
+		master.text[master.length++] = c;
+
+		if (master.length == (DEBUGPORT_TEXT_MAX - 1))
+		{
+			DebugPortSend(DEBUGPORT_TEXT, who, 0, DebugPortCycles(), 0);
+		}
+	}
+}
+
+
+//
+static void DebugPortPutString(uint32_t who, const char * string)
+{
+	while (*string)
+	{
+		DebugPortPutChar(who, *string++);
+	}
+}
+
+
+//
+// Long register written
+//
+static void DebugPortLong(uint32_t reg, uint32_t value, uint32_t who)
+{
+	char buffer[16];
+	uint64_t cycles;
+
+	switch (reg)
+	{
+	case DEBUGPORT_HEX:
+		sprintf(buffer, "%08X", value);
+		DebugPortPutString(who, buffer);
+		break;
+
+	case DEBUGPORT_DEC:
+		sprintf(buffer, "%d", (int32_t)value);
+		DebugPortPutString(who, buffer);
+		break;
+
+	// The string is read without the bus, from the main RAM or the ROM
+	case DEBUGPORT_STRING:
+		for (uint32_t i = 0; i < (DEBUGPORT_TEXT_MAX * 4); i++, value++)
+		{
+			uint8_t c = ((value < vjs.DRAM_size) || ((value >= 0x800000) && (value < 0xDFFF00))) ? jagMemSpace[value] : 0;
+
+			if (!c)
+			{
+				break;
+			}
+
+			DebugPortPutChar(who, c);
+		}
+		break;
+
+	case DEBUGPORT_BEGIN:
+		debugPortBegins[value] = cycles = DebugPortCycles();
+		DebugPortSend(DEBUGPORT_MARK_BEGIN, who, value, cycles, 0);
+		break;
+
+	case DEBUGPORT_END:
+		{
+			std::unordered_map<uint32_t, uint64_t>::iterator it = debugPortBegins.find(value);
+			cycles = DebugPortCycles();
+			DebugPortSend(DEBUGPORT_MARK_END, who, value, cycles, ((it != debugPortBegins.end()) ? (cycles - it->second) : 0));
+
+			if (it != debugPortBegins.end())
+			{
+				debugPortBegins.erase(it);
+			}
+		}
+		break;
+
+	case DEBUGPORT_ASSERT:
+		WriteLog("DEBUGPORT: %s assertion %u failed\n", whoName[who], value);
+		DebugPortSend(DEBUGPORT_ASSERTION, who, value, DebugPortCycles(), 0);
+		break;
+	}
+}
+
+
+//
+void DebugPortWriteByte(uint32_t address, uint8_t data, uint32_t who)
+{
+	address = (address & 0xFFFFFF) - DEBUGPORT_BASE;
+
+	if ((address < 2) && (who < DEBUGPORT_MASTERS))
+	{
+		std::lock_guard<std::mutex> lock(debugPortMutex);
+		DebugPortPutChar(who, data);
+	}
+}
+
+
+//
+void DebugPortWriteWord(uint32_t address, uint16_t data, uint32_t who)
+{
+	address = (address & 0xFFFFFF) - DEBUGPORT_BASE;
+
+	if (who >= DEBUGPORT_MASTERS)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(debugPortMutex);
+
+	if (address < 2)
+	{
+		DebugPortPutChar(who, data & 0xFF);
+	}
+	else if (!(address & 0x02))
+	{
+		debugPortMasters[who].latch = data;
+	}
+	else
+	{
+		DebugPortLong(address & ~0x03, ((uint32_t)debugPortMasters[who].latch << 16) | data, who);
+	}
+}
+
+
+//
+// The identifier lets the guest know the port is on
+//
+uint16_t DebugPortReadWord(uint32_t address)
+{
+	return ((((address & 0xFFFFFF) - DEBUGPORT_BASE) < 2) ? DEBUGPORT_ID : 0);
+}
+
+
+//
+// Next event, for the consumer
+//
+bool DebugPortRead(DebugPortEvent * event)
+{
+	uint32_t tail = debugPortTail.load(std::memory_order_relaxed);
+
+	if (tail == debugPortHead.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	*event = debugPortRing[tail & (DEBUGPORT_RING_SIZE - 1)];
+	debugPortTail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+
+//
+// Events dropped by a full ring
+//
+uint32_t DebugPortDropped(void)
+{
+	return debugPortDropped.load(std::memory_order_relaxed);
+}
+
+
+//
+// Event as a text line
+//
+void DebugPortFormat(const DebugPortEvent * event, char * buffer, uint32_t size)
+{
+	switch (event->type)
+	{
+	case DEBUGPORT_TEXT:
+		snprintf(buffer, size, "[%s %llu] %s", whoName[event->who], (unsigned long long)event->cycles, event->text);
+		break;
+
+	case DEBUGPORT_MARK_BEGIN:
+		snprintf(buffer, size, "[%s %llu] begin #%u", whoName[event->who], (unsigned long long)event->cycles, event->id);
+		break;
+
+	case DEBUGPORT_MARK_END:
+		snprintf(buffer, size, "[%s %llu] end #%u, %llu cycles", whoName[event->who], (unsigned long long)event->cycles, event->id, (unsigned long long)event->duration);
+		break;
+
+	default:
+		snprintf(buffer, size, "[%s %llu] assertion #%u failed: %s", whoName[event->who], (unsigned long long)event->cycles, event->id, event->text);
+		break;
+	}
+}
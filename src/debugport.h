@@ -0,0 +1,60 @@
+//
+// debugport.h: Header file
+//
+// Guest debug port, for the text output, the timing markers and the
+// assertions of the 68K, GPU & DSP programs
+//
+
+#ifndef __DEBUGPORT_H__
+#define __DEBUGPORT_H__
+
+#include <stdint.h>
+#include "settings.h"
+
+// Port location, in the unmapped space (the 68K can use the short absolute addressing)
+#define DEBUGPORT_BASE		0xFFFF00
+#define DEBUGPORT_SIZE		0x20
+#define DEBUGPORT_ID		0x564A					// 'VJ', read at the base when the port is on
+
+// Registers offsets, the long registers act at the write of their low word
+// DEBUGPORT_CHAR      byte (or word low byte), character appended to the line, '\n' sends the line
+// DEBUGPORT_HEX       long, value appended in hexadecimal
+// DEBUGPORT_DEC       long, value appended in signed decimal
+// DEBUGPORT_STRING    long, address of a NUL terminated string appended (main RAM or ROM)
+// DEBUGPORT_BEGIN     long, begin marker of an identifier
+// DEBUGPORT_END       long, end marker of an identifier
+// DEBUGPORT_ASSERT    long, failed assertion identifier (i.e. source line), the line is its message
+#define DEBUGPORT_CHAR		0x00
+#define DEBUGPORT_HEX		0x04
+#define DEBUGPORT_DEC		0x08
+#define DEBUGPORT_STRING	0x0C
+#define DEBUGPORT_BEGIN		0x10
+#define DEBUGPORT_END		0x14
+#define DEBUGPORT_ASSERT	0x18
+
+#define DEBUGPORT_TEXT_MAX	120
+
+enum { DEBUGPORT_TEXT = 0, DEBUGPORT_MARK_BEGIN, DEBUGPORT_MARK_END, DEBUGPORT_ASSERTION };
+
+struct DebugPortEvent
+{
+	uint8_t type;
+	uint8_t who;								// Writing bus master
+	uint32_t id;								// Marker or assertion identifier
+	uint64_t cycles;							// RISC cycles since the reset
+	uint64_t duration;							// Cycles from the begin marker, for an end marker
+	char text[DEBUGPORT_TEXT_MAX];
+};
+
+extern void DebugPortReset(void);
+extern void DebugPortWriteByte(uint32_t address, uint8_t data, uint32_t who);
+extern void DebugPortWriteWord(uint32_t address, uint16_t data, uint32_t who);
+extern uint16_t DebugPortReadWord(uint32_t address);
+extern bool DebugPortRead(DebugPortEvent * event);
+extern uint32_t DebugPortDropped(void);
+extern void DebugPortFormat(const DebugPortEvent * event, char * buffer, uint32_t size);
+
+// The port is decoded by the unknown locations handlers only, the mapped accesses cost nothing
+#define DEBUGPORT_HIT(address)	(vjs.allowDebugPort && ((((address) & 0xFFFFFF) - DEBUGPORT_BASE) < DEBUGPORT_SIZE))
+
+#endif	// __DEBUGPORT_H__
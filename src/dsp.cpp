@@ -19,19 +19,32 @@
 // JLH  11/26/2011  Added fixes for LOAD/STORE alignment issues
 // JPM  06/06/2016  Visual Studio support
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  MMULT 3x3/4x4 local RAM fast path, DIV with the host divide
+// JPM   Oct./2026  Per opcode execution histogram
+// JPM   Oct./2026  IMASK cleared wakes the execution core up, instead of a check at each instruction
+// JPM   Oct./2026  Local RAM writes by the DSP dispatched to the memory write hooks
+// JPM   Oct./2026  External accesses counted for the main bus arbitration
+// JPM   Oct./2026  Cycles run in the current slice, for the JERRY timers counters
+// JPM   Oct./2026  External accesses counted with the bus arbitration on only
+// JPM   Oct./2026  Pipelined opcodes handlers names
+// JPM   Oct./2026  Interrupt latches & enables moved to the interrupt controller
 //
 
 #include "dsp.h"
 
 #include <SDL.h>								// Used only for SDL_GetTicks...
 #include <stdlib.h>
+#include "bus.h"
 #include "dac.h"
 #include "gpu.h"
+#include "hooks.h"
+#include "interrupt.h"
 #include "jagdasm.h"
 #include "jaguar.h"
 #include "jerry.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
+#include "opcodestats.h"
 //#include "memory.h"
 #include "state.h"
 
@@ -201,6 +214,30 @@ uint8_t plPtrFetch, plPtrRead, plPtrExec, plPtrWrite;
 PipelineStage pipeline[4];
 bool IMASKCleared = false;
 
+// Execution budget of a DSPExec call, the cycles are moved aside by a wakeup
+struct DSPExecBudget
+{
+	int32_t cycles;
+	int32_t stashed;
+	int32_t slice;								// Cycles given to the call
+};
+
+// Budget of the innermost DSPExec call, in the thread running the JERRY events list only
+static thread_local DSPExecBudget * dspExecBudget = NULL;
+
+
+//
+// Wake up the execution core at the end of the current instruction
+//
+static inline void DSPWakeUp(void)
+{
+	if (dspExecBudget)
+	{
+		dspExecBudget->stashed += dspExecBudget->cycles;
+		dspExecBudget->cycles = 0;
+	}
+}
+
 // DSP flags (old--have to get rid of this crap)
 
 #define CINT0FLAG			0x00200
@@ -249,6 +286,14 @@ bool IMASKCleared = false;
 #define VERSION			0x0F000
 #define INT_LAT5		0x10000
 
+// Interrupt enables & latches, kept by the interrupt controller (one bit per DSPIRQ_xxx)
+#define INT_ENAS		(INT_ENA0 | INT_ENA1 | INT_ENA2 | INT_ENA3 | INT_ENA4 | INT_ENA5)
+#define INT_LATS		(INT_LAT0 | INT_LAT1 | INT_LAT2 | INT_LAT3 | INT_LAT4 | INT_LAT5)
+#define DSP_ENAS(irqs)			((((irqs) & 0x1F) << 4) | (((irqs) & 0x20) << 11))
+#define DSP_ENAS_IRQS(flags)	((((flags) >> 4) & 0x1F) | (((flags) >> 11) & 0x20))
+#define DSP_LATS(irqs)			((((irqs) & 0x1F) << 6) | (((irqs) & 0x20) << 11))
+#define DSP_LATS_IRQS(ctrl)		((((ctrl) >> 6) & 0x1F) | (((ctrl) >> 11) & 0x20))
+
 extern uint32_t jaguar_mainRom_crc32;
 
 // Is opcode 62 *really* a NOP? Seems like it...
@@ -407,6 +452,11 @@ uint32_t dsp_reg_bank_0[32], dsp_reg_bank_1[32];
 static uint32_t dsp_opcode_first_parameter;
 static uint32_t dsp_opcode_second_parameter;
 
+// Matrix multiply operands: alternate register halves & big-endian words of the local RAM
+#define DSP_MMULT_LO(r)		((int32_t)(int16_t)((r) & 0xFFFF))
+#define DSP_MMULT_HI(r)		((int32_t)(int16_t)((r) >> 16))
+#define DSP_MMULT_RAM(o)		((int32_t)(int16_t)(((uint16_t)dsp_ram_8[(o) + 2] << 8) | dsp_ram_8[(o) + 3]))
+
 #define DSP_RUNNING			(dsp_control & 0x01)
 
 #define RM					dsp_reg[dsp_opcode_first_parameter]
@@ -547,6 +597,7 @@ uint8_t DSPReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 			return (data & 0xFF);
 	}
 
+	BUS_ACCESS(DSP);
 	return JaguarReadByte(offset, who);
 }
 
@@ -575,6 +626,7 @@ uint16_t DSPReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 			return data >> 16;
 	}
 
+	BUS_ACCESS(DSP);
 	return JaguarReadWord(offset, who);
 }
 
@@ -605,12 +657,12 @@ uint32_t DSPReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 		{
 		case 0x00:
 			dsp_flags = (dsp_flags & 0xFFFFFFF8) | (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
-			return dsp_flags & 0xFFFFC1FF;
+			return (dsp_flags | DSP_ENAS(InterruptEnabled(INTERRUPT_DSP))) & 0xFFFFC1FF;
 		case 0x04: return dsp_matrix_control;
 		case 0x08: return dsp_pointer_to_matrix;
 		case 0x0C: return dsp_data_organization;
 		case 0x10: return dsp_pc;
-		case 0x14: return dsp_control;
+		case 0x14: return dsp_control | DSP_LATS(InterruptPending(INTERRUPT_DSP));
 		case 0x18: return dsp_modulo;
 		case 0x1C: return dsp_remain;
 		case 0x20:
@@ -620,6 +672,7 @@ uint32_t DSPReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 		return 0xFFFFFFFF;
 	}
 
+	BUS_ACCESS(DSP);
 	return JaguarReadLong(offset, who);
 }
 
@@ -631,6 +684,10 @@ void DSPWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 
 	if ((offset >= DSP_WORK_RAM_BASE) && (offset < DSP_WORK_RAM_BASE + 0x2000))
 	{
+		// The other masters writes are dispatched by the bus
+		if (who == DSP)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 1, who);
+
 		offset -= DSP_WORK_RAM_BASE;
 		dsp_ram_8[offset] = data;
 //This is rather stupid! !!! FIX !!!
@@ -661,6 +718,7 @@ void DSPWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 //	WriteLog("dsp: writing %.2x at 0x%.8x\n",data,offset);
 //Should this *ever* happen??? Shouldn't we be saying "unknown" here???
 // Well, yes, it can. There are 3 MMU users after all: 68K, GPU & DSP...!
+	BUS_ACCESS(DSP);
 	JaguarWriteByte(offset, data, who);
 }
 
@@ -681,6 +739,9 @@ void DSPWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 {
 	WriteLog("DSP: %s is writing %04X at location 0xF1B2F4 (DSP_PC: %08X)...\n", whoName[who], data, dsp_pc);
 }//*/
+		if (who == DSP)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 2, who);
+
 		offset -= DSP_WORK_RAM_BASE;
 		dsp_ram_8[offset] = data >> 8;
 		dsp_ram_8[offset+1] = data & 0xFF;
@@ -723,6 +784,7 @@ SET16(ram2, offset, data);
 		return;
 	}
 
+	BUS_ACCESS(DSP);
 	JaguarWriteWord(offset, data, who);
 }
 
@@ -745,6 +807,9 @@ void DSPWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 {
 	WriteLog("DSP: %s is writing %08X at location 0xF1BE2C (DSP_PC: %08X)...\n", whoName[who], data, dsp_pc - 2);
 }//*/
+		if (who == DSP)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 4, who);
+
 		offset -= DSP_WORK_RAM_BASE;
 		SET32(dsp_ram_8, offset, data);
 //CC only!
@@ -767,15 +832,20 @@ SET32(ram2, offset, data);
 #endif
 //			bool IMASKCleared = (dsp_flags & IMASK) && !(data & IMASK);
 			IMASKCleared = (dsp_flags & IMASK) && !(data & IMASK);
+
+			// The pending interrupts are checked at the end of the instruction
+			if (IMASKCleared)
+				DSPWakeUp();
+
 			// NOTE: According to the JTRM, writing a 1 to IMASK has no effect; only the
 			//       IRQ logic can set it. So we mask it out here to prevent problems...
-			dsp_flags = data & (~IMASK);
+			dsp_flags = data & (~(IMASK | INT_ENAS));
+			InterruptSetEnabled(INTERRUPT_DSP, DSP_ENAS_IRQS(data));
 			dsp_flag_z = dsp_flags & 0x01;
 			dsp_flag_c = (dsp_flags >> 1) & 0x01;
 			dsp_flag_n = (dsp_flags >> 2) & 0x01;
 			DSPUpdateRegisterBanks();
-			dsp_control &= ~((dsp_flags & CINT04FLAGS) >> 3);
-			dsp_control &= ~((dsp_flags & CINT5FLAG) >> 1);
+			InterruptAcknowledge(INTERRUPT_DSP, ((data & CINT04FLAGS) >> 9) | ((data & CINT5FLAG) >> 12));
 			break;
 		}
 		case 0x04:
@@ -820,11 +890,9 @@ WriteLog("Write to DSP CTRL by %s: %08X (DSP PC=$%08X)\n", whoName[who], data, d
 #else
 #warning "!!! DSP IRQs that go to the 68K have to be routed thru TOM !!! FIX !!!"
 #endif // _MSC_VER
-				if (JERRYIRQEnabled(IRQ2_DSP))
+				if (InterruptJERRYRequest(IRQ2_DSP))	// Set 68000 IPL 2...
 				{
-					JERRYSetPendingIRQ(IRQ2_DSP);
 					DSPReleaseTimeslice();
-					m68k_set_irq(2);			// Set 68000 IPL 2...
 				}
 				data &= ~CPUINT;
 			}
@@ -908,6 +976,7 @@ WriteLog("DSP: Modulo data %08X written by %s.\n", data, whoName[who]);
 //	JaguarWriteWord(offset+2, data & 0xFFFF, DSP);
 //if (offset > 0xF1FFFF)
 //	badWrite = true;
+	BUS_ACCESS(DSP);
 	JaguarWriteLong(offset, data, who);
 }
 
@@ -941,12 +1010,8 @@ void DSPHandleIRQs(void)
 	if (dsp_flags & IMASK) 							// Bail if we're already inside an interrupt
 		return;
 
-	// Get the active interrupt bits (latches) & interrupt mask (enables)
-	uint32_t bits = ((dsp_control >> 10) & 0x20) | ((dsp_control >> 6) & 0x1F),
-		mask = ((dsp_flags >> 11) & 0x20) | ((dsp_flags >> 4) & 0x1F);
-
-//	WriteLog("dsp: bits=%.2x mask=%.2x\n",bits,mask);
-	bits &= mask;
+	// Get the active interrupt bits (latches & enables)
+	uint32_t bits = InterruptActive(INTERRUPT_DSP);
 
 	if (!bits)										// Bail if nothing is enabled
 		return;
@@ -1109,12 +1174,8 @@ DSPUpdateRegisterBanks();
 	if (dsp_flags & IMASK) 							// Bail if we're already inside an interrupt
 		return;
 
-	// Get the active interrupt bits (latches) & interrupt mask (enables)
-	uint32_t bits = ((dsp_control >> 10) & 0x20) | ((dsp_control >> 6) & 0x1F),
-		mask = ((dsp_flags >> 11) & 0x20) | ((dsp_flags >> 4) & 0x1F);
-
-//	WriteLog("dsp: bits=%.2x mask=%.2x\n",bits,mask);
-	bits &= mask;
+	// Get the active interrupt bits (latches & enables)
+	uint32_t bits = InterruptActive(INTERRUPT_DSP);
 
 	if (!bits)										// Bail if nothing is enabled
 		return;
@@ -1190,9 +1251,8 @@ ctrl1[0] = regs1[30] = dsp_pc;
 //
 void DSPSetIRQLine(int irqline, int state)
 {
-//NOTE: This doesn't take INT_LAT5 into account. !!! FIX !!!
-	uint32_t mask = INT_LAT0 << irqline;
-	dsp_control &= ~mask;							// Clear the latch bit
+	uint32_t mask = 1 << irqline;
+	InterruptAcknowledge(INTERRUPT_DSP, mask);		// Clear the latch bit
 //CC only!
 #ifdef DSP_DEBUG_CC
 ctrl1[8] = ctrl2[8] = dsp_control;
@@ -1201,7 +1261,7 @@ ctrl1[8] = ctrl2[8] = dsp_control;
 
 	if (state)
 	{
-		dsp_control |= mask;						// Set the latch bit
+		InterruptLatch(INTERRUPT_DSP, mask);		// Set the latch bit
 #ifdef _MSC_VER
 #pragma message("Warning: !!! No checking done to see if we're using pipelined DSP or not !!!")
 #else
@@ -1230,6 +1290,21 @@ bool DSPIsRunning(void)
 }
 
 
+//
+// Cycles run in the slice of the innermost DSPExec call, 0 out of it or from another thread
+//
+int32_t DSPCyclesRun(void)
+{
+	return (dspExecBudget ? (dspExecBudget->slice - dspExecBudget->cycles - dspExecBudget->stashed) : 0);
+}
+
+
+uint32_t DSPGetPC(void)
+{
+	return dsp_pc;
+}
+
+
 void DSPInit(void)
 {
 //	memory_malloc_secure((void **)&dsp_ram_8, 0x2000, "DSP work RAM");
@@ -1252,6 +1327,7 @@ void DSPReset(void)
 	dsp_pointer_to_matrix = 0x00000000;
 	dsp_data_organization = 0xFFFFFFFF;
 	dsp_control			  = 0x00002000;				// Report DSP version 2
+	InterruptReset(INTERRUPT_DSP);
 	dsp_div_control		  = 0x00000000;
 	dsp_in_exec			  = 0;
 
@@ -1356,11 +1432,14 @@ size_t dsp_dump(FILE *fp)
 	DUMP64(dsp_acc);
 	DUMP32(dsp_remain);
 	DUMP32(dsp_modulo);
-	DUMP32(dsp_flags);
+	// The interrupt enables & latches in their registers
+	uint32_t flags = dsp_flags | DSP_ENAS(InterruptEnabled(INTERRUPT_DSP));
+	uint32_t control = dsp_control | DSP_LATS(InterruptPending(INTERRUPT_DSP));
+	DUMP32(flags);
 	DUMP32(dsp_matrix_control);
 	DUMP32(dsp_pointer_to_matrix);
 	DUMP32(dsp_data_organization);
-	DUMP32(dsp_control);
+	DUMP32(control);
 	DUMP32(dsp_div_control);
 	DUMP8(dsp_flag_z);
 	DUMP8(dsp_flag_n);
@@ -1445,6 +1524,10 @@ size_t dsp_load(FILE *fp)
 	LOAD32(dsp_pointer_to_matrix);
 	LOAD32(dsp_data_organization);
 	LOAD32(dsp_control);
+	InterruptSetEnabled(INTERRUPT_DSP, DSP_ENAS_IRQS(dsp_flags));
+	InterruptSetPending(INTERRUPT_DSP, DSP_LATS_IRQS(dsp_control));
+	dsp_flags &= ~INT_ENAS;
+	dsp_control &= ~INT_LATS;
 	LOAD32(dsp_div_control);
 	LOAD8(dsp_flag_z);
 	LOAD8(dsp_flag_n);
@@ -1485,12 +1568,12 @@ void DSPDone(void)
 	WriteLog("\n\n---------------------------------------------------------------------\n");
 	WriteLog("DSP I/O Registers\n");
 	WriteLog("---------------------------------------------------------------------\n");
-	WriteLog("F1%04X   (D_FLAGS): $%06X\n", 0xA100, (dsp_flags & 0xFFFFFFF8) | (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z);
+	WriteLog("F1%04X   (D_FLAGS): $%06X\n", 0xA100, (dsp_flags & 0xFFFFFFF8) | DSP_ENAS(InterruptEnabled(INTERRUPT_DSP)) | (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z);
 	WriteLog("F1%04X    (D_MTXC): $%04X\n", 0xA104, dsp_matrix_control);
 	WriteLog("F1%04X    (D_MTXA): $%04X\n", 0xA108, dsp_pointer_to_matrix);
 	WriteLog("F1%04X     (D_END): $%02X\n", 0xA10C, dsp_data_organization);
 	WriteLog("F1%04X      (D_PC): $%06X\n", 0xA110, dsp_pc);
-	WriteLog("F1%04X    (D_CTRL): $%06X\n", 0xA114, dsp_control);
+	WriteLog("F1%04X    (D_CTRL): $%06X\n", 0xA114, dsp_control | DSP_LATS(InterruptPending(INTERRUPT_DSP)));
 	WriteLog("F1%04X     (D_MOD): $%08X\n", 0xA118, dsp_modulo);
 	WriteLog("F1%04X  (D_REMAIN): $%08X\n", 0xA11C, dsp_remain);
 	WriteLog("F1%04X (D_DIVCTRL): $%02X\n", 0xA11C, dsp_div_control);
@@ -1501,9 +1584,9 @@ void DSPDone(void)
 	WriteLog("DSP: %sin interrupt handler\n", (dsp_flags & IMASK ? "" : "not "));
 
 	// Get the active interrupt bits
-	int bits = ((dsp_control >> 10) & 0x20) | ((dsp_control >> 6) & 0x1F);
+	int bits = InterruptPending(INTERRUPT_DSP);
 	// Get the interrupt mask
-	int mask = ((dsp_flags >> 11) & 0x20) | ((dsp_flags >> 4) & 0x1F);
+	int mask = InterruptEnabled(INTERRUPT_DSP);
 
 	WriteLog("DSP: pending=$%X enabled=$%X (%s%s%s%s%s%s)\n", bits, mask,
 		(mask & 0x01 ? "CPU " : ""), (mask & 0x02 ? "I2S " : ""),
@@ -1734,25 +1817,13 @@ for(int k=0; k<2; k++)
 
 
 //
-// DSP execution core
+// DSP instructions run up to the end of the budget, or up to a wakeup
 //
 //static bool R20Set = false, tripwire = false;
 //static uint32_t pcQueue[32], ptrPCQ = 0;
-void DSPExec(int32_t cycles)
+static inline void DSPRun(DSPExecBudget & budget)
 {
-#ifdef DSP_SINGLE_STEPPING
-	if (dsp_control & 0x18)
-	{
-		cycles = 1;
-		dsp_control &= ~0x10;
-	}
-#endif
-//There is *no* good reason to do this here!
-//	DSPHandleIRQs();
-	dsp_releaseTimeSlice_flag = 0;
-	dsp_in_exec++;
-
-	while (cycles > 0 && DSP_RUNNING)
+	while (budget.cycles > 0 && DSP_RUNNING)
 	{
 /*extern uint32_t totalFrames;
 //F1B2F6: LOAD   (R14+$04), R24 [NCZ:001, R14+$04=00F20018, R24=FFFFFFFF] -> Jaguar: Unknown word read at 00F20018 by DSP (M68K PC=00E32E)
@@ -1769,15 +1840,6 @@ if (dsp_pc == 0xF1B092)
 /*if (dsp_pc == 0xF1B140)
 	doDSPDis = true;//*/
 
-		if (IMASKCleared)						// If IMASK was cleared,
-		{
-#ifdef DSP_DEBUG_IRQ
-			WriteLog("DSP: Finished interrupt. PC=$%06X\n", dsp_pc);
-#endif
-			DSPHandleIRQsNP();					// See if any other interrupts are pending!
-			IMASKCleared = false;
-		}
-
 /*if (badWrite)
 {
 	WriteLog("\nDSP: Encountered bad write in Atari Synth module. PC=%08X, R15=%08X\n", dsp_pc, dsp_reg[15]);
@@ -1800,7 +1862,8 @@ ptrPCQ %= 32;*/
 		dsp_pc += 2;
 		dsp_opcode[index]();
 		dsp_opcode_use[index]++;
-		cycles -= dsp_opcode_cycles[index];
+		budget.cycles -= dsp_opcode_cycles[index];
+		OPCODE_STATS_ADD(dspOpcodeStats, index, dsp_opcode_cycles[index]);
 /*if (dsp_reg_bank_0[20] == 0xF1A100 & !R20Set)
 {
 	WriteLog("DSP: R20 set to $F1A100 at %u ms%s...\n", SDL_GetTicks(), (dsp_flags & IMASK ? " (inside interrupt)" : ""));
@@ -1828,8 +1891,52 @@ if ((dsp_pc < 0xF1B000 || dsp_pc > 0xF1CFFE) && !tripwire)
 	WriteLog("\n");
 }*/
 	}
+}
+
+
+//
+// DSP execution core
+//
+void DSPExec(int32_t cycles)
+{
+#ifdef DSP_SINGLE_STEPPING
+	if (dsp_control & 0x18)
+	{
+		cycles = 1;
+		dsp_control &= ~0x10;
+	}
+#endif
+//There is *no* good reason to do this here!
+//	DSPHandleIRQs();
+	DSPExecBudget budget = { cycles, 0, cycles };
+	DSPExecBudget * outerBudget = dspExecBudget;
+	dspExecBudget = &budget;
+	dsp_releaseTimeSlice_flag = 0;
+	dsp_in_exec++;
+
+	while (budget.cycles > 0 && DSP_RUNNING)
+	{
+		if (IMASKCleared)						// If IMASK was cleared,
+		{
+#ifdef DSP_DEBUG_IRQ
+			WriteLog("DSP: Finished interrupt. PC=$%06X\n", dsp_pc);
+#endif
+			DSPHandleIRQsNP();					// See if any other interrupts are pending!
+			IMASKCleared = false;
+		}
+
+		// Cycles moved aside by a wakeup are given back
+		DSPRun(budget);
+		budget.cycles += budget.stashed;
+		budget.stashed = 0;
+	}
 
 	dsp_in_exec--;
+	dspExecBudget = outerBudget;
+
+	// IMASK cleared in a delay slot, the outer call checks the pending interrupts after the jump
+	if (IMASKCleared)
+		DSPWakeUp();
 }
 
 
@@ -2210,7 +2317,10 @@ static void dsp_opcode_storeb(void)
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		DSPWriteLong(RM, RN & 0xFF, DSP);
 	else
+	{
+		BUS_ACCESS(DSP);
 		JaguarWriteByte(RM, RN, DSP);
+	}
 }
 
 
@@ -2224,12 +2334,18 @@ static void dsp_opcode_storew(void)
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		DSPWriteLong(RM & 0xFFFFFFFE, RN & 0xFFFF, DSP);
 	else
+	{
+		BUS_ACCESS(DSP);
 		JaguarWriteWord(RM & 0xFFFFFFFE, RN, DSP);
+	}
 #else
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		DSPWriteLong(RM, RN & 0xFFFF, DSP);
 	else
+	{
+		BUS_ACCESS(DSP);
 		JaguarWriteWord(RM, RN, DSP);
+	}
 #endif
 }
 
@@ -2257,7 +2373,10 @@ static void dsp_opcode_loadb(void)
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		RN = DSPReadLong(RM, DSP) & 0xFF;
 	else
+	{
+		BUS_ACCESS(DSP);
 		RN = JaguarReadByte(RM, DSP);
+	}
 #ifdef DSP_DIS_LOADB
 	if (doDSPDis)
 		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
@@ -2275,12 +2394,18 @@ static void dsp_opcode_loadw(void)
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		RN = DSPReadLong(RM & 0xFFFFFFFE, DSP) & 0xFFFF;
 	else
+	{
+		BUS_ACCESS(DSP);
 		RN = JaguarReadWord(RM & 0xFFFFFFFE, DSP);
+	}
 #else
 	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		RN = DSPReadLong(RM, DSP) & 0xFFFF;
 	else
+	{
+		BUS_ACCESS(DSP);
 		RN = JaguarReadWord(RM, DSP);
+	}
 #endif
 #ifdef DSP_DIS_LOADW
 	if (doDSPDis)
@@ -2579,6 +2704,33 @@ static void dsp_opcode_normi(void)
 }
 
 
+//
+// 3x3 & 4x4 matrices in the local RAM: the operands are read directly and the
+// products are summed modulo 2^32, as the result is truncated to 32 bits
+// Return false if the matrix must be done by the generic loop
+//
+static inline bool dsp_mmult_local(uint32_t * res)
+{
+	int count = dsp_matrix_control & 0x0F;
+	uint32_t stride = (dsp_matrix_control & 0x10 ? 4 * count : 4);
+	uint32_t offset = dsp_pointer_to_matrix - DSP_WORK_RAM_BASE;
+
+	if (((count != 3) && (count != 4)) || (offset >= 0x2000) || ((offset + (stride * (count - 1))) >= 0x2000) || ((IMM_1 + 1) >= 32))
+		return false;
+
+	uint32_t a0 = dsp_alternate_reg[IMM_1], a1 = dsp_alternate_reg[IMM_1 + 1];
+	uint32_t sum = (uint32_t)(DSP_MMULT_LO(a0) * DSP_MMULT_RAM(offset))
+		+ (uint32_t)(DSP_MMULT_HI(a0) * DSP_MMULT_RAM(offset + stride))
+		+ (uint32_t)(DSP_MMULT_LO(a1) * DSP_MMULT_RAM(offset + (stride * 2)));
+
+	if (count == 4)
+		sum += (uint32_t)(DSP_MMULT_HI(a1) * DSP_MMULT_RAM(offset + (stride * 3)));
+
+	*res = sum;
+	return true;
+}
+
+
 static void dsp_opcode_mmult(void)
 {
 	int count	= dsp_matrix_control&0x0f;
@@ -2586,6 +2738,13 @@ static void dsp_opcode_mmult(void)
 	int64_t accum = 0;
 	uint32_t res;
 
+	if (dsp_mmult_local(&res))
+	{
+		RN = res;
+		SET_ZN(RN);
+		return;
+	}
+
 	if (!(dsp_matrix_control & 0x10))
 	{
 		for (int i = 0; i < count; i++)
@@ -2675,18 +2834,33 @@ static void dsp_opcode_div(void)
 	uint32_t q = RN;
 	uint32_t r = 0;
 
-	// If 16.16 division, stuff top 16 bits of RN into remainder and put the
-	// bottom 16 of RN in top 16 of quotient
-	if (dsp_div_control & 0x01)
-		q <<= 16, r = RN >> 16;
+	// Same quotient & remainder with a host divide, when the divisor is below
+	// 2^31 and the quotient fits in 32 bits. The remainder of the last step is
+	// left negative (r - RM) when the quotient is even
+	if (RM && !(RM & 0x80000000) && (!(dsp_div_control & 0x01) || ((RN >> 16) < RM)))
+	{
+		uint64_t dividend = (dsp_div_control & 0x01 ? (uint64_t)RN << 16 : (uint64_t)RN);
+		q = (uint32_t)(dividend / RM);
+		r = (uint32_t)(dividend % RM);
 
-	for(int i=0; i<32; i++)
+		if (!(q & 0x01))
+			r -= RM;
+	}
+	else
 	{
-//		uint32_t sign = (r >> 31) & 0x01;
-		uint32_t sign = r & 0x80000000;
-		r = (r << 1) | ((q >> 31) & 0x01);
-		r += (sign ? RM : -RM);
-		q = (q << 1) | (((~r) >> 31) & 0x01);
+		// If 16.16 division, stuff top 16 bits of RN into remainder and put the
+		// bottom 16 of RN in top 16 of quotient
+		if (dsp_div_control & 0x01)
+			q <<= 16, r = RN >> 16;
+
+		for(int i=0; i<32; i++)
+		{
+//			uint32_t sign = (r >> 31) & 0x01;
+			uint32_t sign = r & 0x80000000;
+			r = (r << 1) | ((q >> 31) & 0x01);
+			r += (sign ? RM : -RM);
+			q = (q << 1) | (((~r) >> 31) & 0x01);
+		}
 	}
 
 	RN = q;
@@ -3028,6 +3202,30 @@ void (* DSPOpcode[64])() =
 	DSP_store_r14_r,	DSP_store_r15_r,	DSP_illegal,		DSP_addqmod
 };
 
+// Pipelined opcodes handlers names, for the opcode statistics sample profile
+const char * DSPOpcodeName[64] =
+{
+	"DSP_add",			"DSP_addc",			"DSP_addq",			"DSP_addqt",
+	"DSP_sub",			"DSP_subc",			"DSP_subq",			"DSP_subqt",
+	"DSP_neg",			"DSP_and",			"DSP_or",			"DSP_xor",
+	"DSP_not",			"DSP_btst",			"DSP_bset",			"DSP_bclr",
+
+	"DSP_mult",			"DSP_imult",		"DSP_imultn",		"DSP_resmac",
+	"DSP_imacn",		"DSP_div",			"DSP_abs",			"DSP_sh",
+	"DSP_shlq",			"DSP_shrq",			"DSP_sha",			"DSP_sharq",
+	"DSP_ror",			"DSP_rorq",			"DSP_cmp",			"DSP_cmpq",
+
+	"DSP_subqmod",		"DSP_sat16s",		"DSP_move",			"DSP_moveq",
+	"DSP_moveta",		"DSP_movefa",		"DSP_movei",		"DSP_loadb",
+	"DSP_loadw",		"DSP_load",			"DSP_sat32s",		"DSP_load_r14_i",
+	"DSP_load_r15_i",	"DSP_storeb",		"DSP_storew",		"DSP_store",
+
+	"DSP_mirror",		"DSP_store_r14_i",	"DSP_store_r15_i",	"DSP_movepc",
+	"DSP_jump",			"DSP_jr",			"DSP_mmult",		"DSP_mtoi",
+	"DSP_normi",		"DSP_nop",			"DSP_load_r14_r",	"DSP_load_r15_r",
+	"DSP_store_r14_r",	"DSP_store_r15_r",	"DSP_illegal",		"DSP_addqmod"
+};
+
 bool readAffected[64][2] =
 {
 	{ true,  true}, { true,  true}, {false,  true}, {false,  true},
@@ -3517,6 +3715,7 @@ lastExec = pipeline[plPtrExec].instruction;
 #endif
 			cycles -= dsp_opcode_cycles[pipeline[plPtrExec].opcode];
 			dsp_opcode_use[pipeline[plPtrExec].opcode]++;
+			OPCODE_STATS_ADD(dspOpcodeStats, pipeline[plPtrExec].opcode, dsp_opcode_cycles[pipeline[plPtrExec].opcode]);
 			DSPOpcode[pipeline[plPtrExec].opcode]();
 //WriteLog("    --> Returned from execute. DSP_PC: %08X\n", dsp_pc);
 		}
@@ -4346,6 +4545,13 @@ static void DSP_mmult(void)
 	int64_t accum = 0;
 	uint32_t res;
 
+	if (dsp_mmult_local(&res))
+	{
+		PRES = res;
+		SET_ZN(PRES);
+		return;
+	}
+
 	if (!(dsp_matrix_control & 0x10))
 	{
 		for (int i = 0; i < count; i++)
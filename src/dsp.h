@@ -25,6 +25,8 @@ void DSPWriteWord(uint32_t offset, uint16_t data, uint32_t who = UNKNOWN);
 void DSPWriteLong(uint32_t offset, uint32_t data, uint32_t who = UNKNOWN);
 void DSPReleaseTimeslice(void);
 bool DSPIsRunning(void);
+int32_t DSPCyclesRun(void);
+uint32_t DSPGetPC(void);
 
 void DSPExecP(int32_t cycles);
 void DSPExecP2(int32_t cycles);
@@ -36,6 +38,8 @@ void DSPExecComp(int32_t cycles);
 extern bool doDSPDis;
 extern uint32_t dsp_reg_bank_0[], dsp_reg_bank_1[];
 extern uint8_t dsp_ram_8[];
+extern const char * dsp_opcode_str[];
+extern const char * DSPOpcodeName[];
 
 // DSP interrupt numbers (in $F1A100, bits 4-8 & 16)
 
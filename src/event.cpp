@@ -15,6 +15,9 @@
 // ---  ----------  -------------------------------------------------------------
 // JLH  01/16/2010  Created this log ;-)
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Added the time to a callback
+// JPM   Oct./2026  Added the lists elapsed time
+// JPM   Oct./2026  Added the ASI callbacks translation
 //
 
 //
@@ -61,6 +64,8 @@ static Event eventListJERRY[EVENT_LIST_SIZE];
 static uint32_t nextEvent;
 static uint32_t nextEventJERRY;
 static uint32_t numberOfEvents;
+static double eventListTime;						// Elapsed time of the lists, in µs
+static double eventListJERRYTime;
 
 extern void DSPSampleCallback(void);
 extern void HalflineCallback(void);
@@ -68,12 +73,16 @@ extern void JERRYPIT1Callback(void);
 extern void JERRYPIT2Callback(void);
 extern void JERRYI2SCallback(void);
 extern void TOMPITCallback(void);
+extern void ASITxCallback(void);
+extern void ASIRxCallback(void);
 #define TR_DSPSampleCallback 0x101
 #define TR_HalflineCallback  0x201
 #define TR_JERRYPIT1Callback 0x301
 #define TR_JERRYPIT2Callback 0x302
 #define TR_JERRYI2SCallback  0x303
 #define TR_TOMPITCallback    0x401
+#define TR_ASITxCallback     0x501
+#define TR_ASIRxCallback     0x502
 
 size_t events_dump(FILE *fp)
 {
@@ -101,6 +110,8 @@ size_t events_dump(FILE *fp)
 	TRANSLATE_DUMP(JERRYPIT2Callback);
 	TRANSLATE_DUMP(JERRYI2SCallback);
 	TRANSLATE_DUMP(TOMPITCallback);
+	TRANSLATE_DUMP(ASITxCallback);
+	TRANSLATE_DUMP(ASIRxCallback);
 next: {}
 	}
 
@@ -112,6 +123,8 @@ next: {}
 		TRANSLATE_DUMP_JERRY(JERRYPIT2Callback);
 		TRANSLATE_DUMP_JERRY(JERRYI2SCallback);
 		TRANSLATE_DUMP_JERRY(TOMPITCallback);
+		TRANSLATE_DUMP_JERRY(ASITxCallback);
+		TRANSLATE_DUMP_JERRY(ASIRxCallback);
 nextJERRY: {}
 	}
 
@@ -199,6 +212,8 @@ size_t events_load(FILE *fp)
 		TRANSLATE_LOAD(JERRYPIT2Callback);
 		TRANSLATE_LOAD(JERRYI2SCallback);
 		TRANSLATE_LOAD(TOMPITCallback);
+		TRANSLATE_LOAD(ASITxCallback);
+		TRANSLATE_LOAD(ASIRxCallback);
 next: {}
 	}
 
@@ -210,6 +225,8 @@ next: {}
 		TRANSLATE_LOAD_JERRY(JERRYPIT2Callback);
 		TRANSLATE_LOAD_JERRY(JERRYI2SCallback);
 		TRANSLATE_LOAD_JERRY(TOMPITCallback);
+		TRANSLATE_LOAD_JERRY(ASITxCallback);
+		TRANSLATE_LOAD_JERRY(ASIRxCallback);
 nextJERRY: {}
 	}
 
@@ -227,6 +244,7 @@ nextJERRY: {}
 	LOAD32(nextEvent);
 	LOAD32(nextEventJERRY);
 	LOAD32(numberOfEvents);
+	eventListTime = eventListJERRYTime = 0.0;
 
 	return total_loaded;
 }
@@ -246,6 +264,7 @@ void InitializeEventList(void)
 	}
 
 	numberOfEvents = 0;
+	eventListTime = eventListJERRYTime = 0.0;
 	WriteLog("EVENT: Cleared event list.\n");
 }
 
@@ -337,6 +356,34 @@ void AdjustCallbackTime(void (* callback)(void), double time)
 }
 
 
+//
+// Time to a callback event
+// Returns -1 if the callback is not in the lists
+//
+double GetCallbackTime(void (* callback)(void))
+{
+	for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+	{
+		if (eventList[i].valid && eventList[i].timerCallback == callback)
+			return eventList[i].eventTime;
+		else if (eventListJERRY[i].valid && eventListJERRY[i].timerCallback == callback)
+			return eventListJERRY[i].eventTime;
+	}
+
+	return -1.0;
+}
+
+
+//
+// Time elapsed in a list, from its initialisation (or its loading) to its last handled event
+// The timers count their cycles from it
+//
+double GetEventListTime(int type/*= EVENT_MAIN*/)
+{
+	return ((type == EVENT_MAIN) ? eventListTime : eventListJERRYTime);
+}
+
+
 //
 // Since our list is unordered WRT time, we have to search it to find the next event
 // Returns time to next event & sets nextEvent to that event
@@ -414,6 +461,7 @@ void HandleNextEvent(int type/*= EVENT_MAIN*/)
 
 		eventList[nextEvent].valid = false;			// Remove event from list...
 		numberOfEvents--;
+		eventListTime += elapsedTime;
 
 		(*event)();
 	}
@@ -432,6 +480,7 @@ void HandleNextEvent(int type/*= EVENT_MAIN*/)
 
 		eventListJERRY[nextEventJERRY].valid = false;	// Remove event from list...
 		numberOfEvents--;
+		eventListJERRYTime += elapsedTime;
 
 		(*event)();
 	}
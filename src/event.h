@@ -26,6 +26,8 @@ void InitializeEventList(void);
 void SetCallbackTime(void (* callback)(void), double time, int type = EVENT_MAIN);
 void RemoveCallback(void (* callback)(void));
 void AdjustCallbackTime(void (* callback)(void), double time);
+double GetCallbackTime(void (* callback)(void));
+double GetEventListTime(int type = EVENT_MAIN);
 double GetTimeToNextEvent(int type = EVENT_MAIN);
 void HandleNextEvent(int type = EVENT_MAIN);
 
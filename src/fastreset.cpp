@@ -0,0 +1,114 @@
+//
+// Fast reset of the core
+//
+// A baseline of the machine is captured once: the memory space is copied,
+// and the chips state is dumped without the memory space contents. The reset
+// loads back the chips state, and copies back only the memory space pages
+// written since the previous reset, the pages with its epoch or a later one;
+// the bus write functions mark the pages they write. The memory written
+// directly, out of the bus functions, has to be marked by its writer. The
+// Butch and the TOM/JERRY areas are written through the registers references,
+// they are always copied back.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Dirty pages from the memory space pages write epochs
+//
+
+#include "fastreset.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "jaguar.h"
+#include "log.h"
+#include "memory.h"
+#include "state.h"
+#include "m68000/m68kinterface.h"
+
+// Memory space size, and the areas copied back at each reset
+#define FASTRESET_MEMORY_SIZE	0xF20000
+#define FASTRESET_BUTCH_START	0xDFFF00
+#define FASTRESET_BUTCH_END		0xE00000
+#define FASTRESET_IO_START		0xF00000
+#define FASTRESET_IO_END		0xF20000
+
+static uint8_t * baselineMemory = NULL;
+static uint8_t * baselineChips = NULL;
+static size_t baselineChipsSize = 0;
+static uint32_t baselineFrameCount = 0;
+static uint64_t baselineInstructionCount = 0;
+static uint64_t resetEpoch = 0;
+
+
+//
+// Capture the current machine as the baseline
+//
+bool CoreFastResetCapture(void)
+{
+	CoreFastResetDone();
+
+	if (!(baselineChips = StateDumpChipsToMemory(&baselineChipsSize)))
+	{
+		WriteLog("FASTRESET: Cannot dump the chips state\n");
+		return false;
+	}
+
+	if (!(baselineMemory = (uint8_t *)malloc(FASTRESET_MEMORY_SIZE)))
+	{
+		WriteLog("FASTRESET: Cannot allocate the memory space copy\n");
+		CoreFastResetDone();
+		return false;
+	}
+
+	// The dump is not exact (the events times are dumped as text), so the machine goes on from the baseline as it is loaded
+	StateLoadChipsFromMemory(baselineChips, baselineChipsSize);
+	memcpy(baselineMemory, jagMemSpace, FASTRESET_MEMORY_SIZE);
+	resetEpoch = MemoryNewEpoch();
+	baselineFrameCount = jaguarFrameCount;
+	baselineInstructionCount = m68kInstructionCount;
+	return true;
+}
+
+
+//
+// Back to the baseline
+//
+void CoreFastReset(void)
+{
+	if (!baselineMemory)
+	{
+		return;
+	}
+
+	for (uint32_t page = 0; page < MEMORY_PAGES; page++)
+	{
+		if (memoryPageEpoch[page] >= resetEpoch)
+		{
+			uint32_t offset = page << MEMORY_PAGE_SHIFT;
+			memcpy(&jagMemSpace[offset], &baselineMemory[offset], (1 << MEMORY_PAGE_SHIFT));
+		}
+	}
+
+	resetEpoch = MemoryNewEpoch();
+
+	memcpy(&jagMemSpace[FASTRESET_BUTCH_START], &baselineMemory[FASTRESET_BUTCH_START], (FASTRESET_BUTCH_END - FASTRESET_BUTCH_START));
+	memcpy(&jagMemSpace[FASTRESET_IO_START], &baselineMemory[FASTRESET_IO_START], (FASTRESET_IO_END - FASTRESET_IO_START));
+	StateLoadChipsFromMemory(baselineChips, baselineChipsSize);
+	jaguarFrameCount = baselineFrameCount;
+	m68kInstructionCount = baselineInstructionCount;
+}
+
+
+//
+// Release the baseline
+//
+void CoreFastResetDone(void)
+{
+	free(baselineMemory);
+	free(baselineChips);
+	baselineMemory = baselineChips = NULL;
+	baselineChipsSize = 0;
+}
@@ -0,0 +1,16 @@
+//
+// fastreset.h: Header file
+//
+// Fast reset of the core to a captured baseline
+//
+
+#ifndef __FASTRESET_H__
+#define __FASTRESET_H__
+
+#include <stdint.h>
+
+extern bool CoreFastResetCapture(void);
+extern void CoreFastReset(void);
+extern void CoreFastResetDone(void);
+
+#endif	// __FASTRESET_H__
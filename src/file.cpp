@@ -19,6 +19,10 @@
 // JPM        2020  Added ELF section types check, new error messages and ELF executable file information
 //  RG   Jan./2021  Linux build fixes
 // JPM  06/23/2021  Added ELF sections check
+// JPM   Oct./2026  ZIP members found from the archive index, with a size sanity check
+// JPM   Oct./2026  ELF call frame information given to the stack unwinder
+// JPM   Oct./2026  Memory range of the loaded software kept
+// JPM   Oct./2026  ZIP software loaded from the archive indexed by the file scanner
 //
 
 #include "file.h"
@@ -36,6 +40,7 @@
 #include "log.h"
 #include "memory.h"
 #include "universalhdr.h"
+#include "unwind.h"
 #include "unzip.h"
 #include "zlib.h"
 #include "libelf.h"
@@ -51,6 +56,7 @@
 static int gzfilelength(gzFile gd);
 //#if defined(_MSC_VER) || defined(__MINGW64__)|| defined(__MINGW32__) || defined(__CYGWIN__)
 static bool CheckExtension(const uint8_t *filename, const char *ext);
+static void SetLoadRange(uint32_t address, uint32_t size);
 //#else
 //static bool CheckExtension(const char * filename, const char * ext);
 //#endif // _MSC_VER
@@ -58,6 +64,15 @@ static bool CheckExtension(const uint8_t *filename, const char *ext);
 
 // Private variables/enums
 
+// ZIP members size limits
+#define ZIP_MAX_CARTRIDGE_SIZE	0x600000			// $800000 - $DFFFFF cartridge space
+#define ZIP_MAX_ELF_SIZE		0x4000000
+#define ZIP_MAX_EEPROM_SIZE		2048
+#define ZIP_MAX_IMAGE_SIZE		0x1000000
+
+// Memory range covering the software loaded by JaguarLoadFile
+uint32_t jaguarLoadAddress, jaguarLoadSize;
+
 
 //
 // Generic ROM loading
@@ -95,6 +110,7 @@ uint32_t JaguarLoadROM(uint8_t * &rom, char * path)
 
 //		uint8_t * buffer = NULL;
 //		romSize = GetFileFromZIP(path, FT_SOFTWARE, buffer);
+		// The archive opened by the file scanner is taken from the archives cache
 		romSize = GetFileFromZIP(path, FT_SOFTWARE, rom);
 
 		if (romSize == 0)
@@ -171,11 +187,14 @@ bool JaguarLoadFile(char * path)
 	int fileType = ParseFileType(buffer, jaguarROMSize);
 	jaguarCartInserted = false;
 	DBGManager_Reset();
+	UnwindReset();
+	jaguarLoadAddress = jaguarLoadSize = 0;
 
 	if (fileType == JST_ROM)
 	{
 		jaguarCartInserted = true;
 		memcpy(jagMemSpace + 0x800000, buffer, jaguarROMSize);
+		SetLoadRange(0x800000, jaguarROMSize);
 // Checking something...
 jaguarRunAddress = GET32(jagMemSpace, 0x800404);
 WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress);
@@ -188,6 +207,7 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 		WriteLog("FILE: Setting up Alpine ROM... Run address: 00802000, length: %08X\n", jaguarROMSize);
 		memset(jagMemSpace + 0x800000, 0xFF, 0x2000);
 		memcpy(jagMemSpace + 0x802000, buffer, jaguarROMSize);
+		SetLoadRange(0x802000, jaguarROMSize);
 		delete[] buffer;
 
 // Maybe instead of this, we could try requiring the STUBULATOR ROM? Just a thought...
@@ -248,6 +268,8 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 									case SHT_PROGBITS:
 										if ((PtrGElfShdr->sh_flags & (SHF_ALLOC | SHF_WRITE | SHF_EXECINSTR)))
 										{
+											SetLoadRange((uint32_t)PtrGElfShdr->sh_addr, (uint32_t)PtrGElfShdr->sh_size);
+
 											if (PtrGElfShdr->sh_addr >= 0x800000)
 											{
 												memcpy(jagMemSpace + PtrGElfShdr->sh_addr, buffer + PtrGElfShdr->sh_offset, PtrGElfShdr->sh_size);
@@ -265,7 +287,6 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 											case ELF_debug_TYPE:
 											case ELF_debug_abbrev_TYPE:
 											case ELF_debug_aranges_TYPE:
-											case ELF_debug_frame_TYPE:
 											case ELF_debug_info_TYPE:
 											case ELF_debug_line_TYPE:
 											case ELF_debug_loc_TYPE:
@@ -277,6 +298,10 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 											case ELF_debug_types_TYPE:						
 												break;
 
+											case ELF_debug_frame_TYPE:
+												UnwindSetFrameInfo(buffer + PtrGElfShdr->sh_offset, (uint32_t)PtrGElfShdr->sh_size);
+												break;
+
 											case ELF_stab_TYPE:
 												break;
 
@@ -371,6 +396,7 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 			codeSize = GET32(buffer, 0x02) + GET32(buffer, 0x06);
 		WriteLog("FILE: Setting up homebrew (ABS-1)... Run address: %08X, length: %08X\n", loadAddress, codeSize);
 		memcpy(jagMemSpace + loadAddress, buffer + 0x24, codeSize);
+		SetLoadRange(loadAddress, codeSize);
 		delete[] buffer;
 		jaguarRunAddress = loadAddress;
 		return true;
@@ -381,6 +407,7 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 			codeSize = GET32(buffer, 0x18) + GET32(buffer, 0x1C);
 		WriteLog("FILE: Setting up homebrew (ABS-2)... Run address: %08X, length: %08X\n", runAddress, codeSize);
 		memcpy(jagMemSpace + loadAddress, buffer + 0xA8, codeSize);
+		SetLoadRange(loadAddress, codeSize);
 		delete[] buffer;
 		jaguarRunAddress = runAddress;
 		return true;
@@ -429,6 +456,7 @@ WriteLog("FILE: Cartridge run address is reported as $%X...\n", jaguarRunAddress
 			uint32_t loadAddress = GET32(buffer, 0x22), runAddress = GET32(buffer, 0x2A);
 			WriteLog("FILE: Setting up homebrew (Jag Server)... Run address: $%X, length: $%X\n", runAddress, jaguarROMSize - 0x2E);
 			memcpy(jagMemSpace + loadAddress, buffer + 0x2E, jaguarROMSize - 0x2E);
+			SetLoadRange(loadAddress, jaguarROMSize - 0x2E);
 			delete[] buffer;
 			jaguarRunAddress = runAddress;
 
@@ -453,6 +481,7 @@ SET16(jaguarMainRAM, 0x1000, 0x60FE);		// Here: bra Here
 		uint32_t loadAddress = (buffer[0x1F] << 24) | (buffer[0x1E] << 16) | (buffer[0x1D] << 8) | buffer[0x1C];
 		WriteLog("FILE: Setting up homebrew (GEMDOS WTFOMGBBQ type)... Run address: $%X, length: $%X\n", loadAddress, jaguarROMSize - 0x20);
 		memcpy(jagMemSpace + loadAddress, buffer + 0x20, jaguarROMSize - 0x20);
+		SetLoadRange(loadAddress, jaguarROMSize - 0x20);
 		delete[] buffer;
 		jaguarRunAddress = loadAddress;
 		return true;
@@ -542,6 +571,30 @@ static int gzfilelength(gzFile gd)
 }
 
 
+//
+// Extend the loaded memory range over a loaded block
+//
+static void SetLoadRange(uint32_t address, uint32_t size)
+{
+	if (!size)
+	{
+		return;
+	}
+
+	if (!jaguarLoadSize)
+	{
+		jaguarLoadAddress = address;
+		jaguarLoadSize = size;
+		return;
+	}
+
+	uint32_t end = jaguarLoadAddress + jaguarLoadSize;
+	end = (((address + size) > end) ? (address + size) : end);
+	jaguarLoadAddress = ((address < jaguarLoadAddress) ? address : jaguarLoadAddress);
+	jaguarLoadSize = end - jaguarLoadAddress;
+}
+
+
 //
 // Compare extension to passed in filename. If equal, return true; otherwise false.
 //
@@ -565,40 +618,41 @@ static bool CheckExtension(const uint8_t *filename, const char *ext)
 
 
 //
-// Get file from .ZIP
+// Maximum size of a member of a type, the software must fit in the cartridge
+// space (with an optional Alpine universal header), the ELF files can hold the
+// debug information
+//
+static uint32_t GetMaxSizeFromZIP(FileType type, const uint8_t * filename)
+{
+	switch (type)
+	{
+	case FT_SOFTWARE:
+		return (CheckExtension(filename, ".elf") ? ZIP_MAX_ELF_SIZE : (ZIP_MAX_CARTRIDGE_SIZE + 8192));
+
+	case FT_EEPROM:
+		return ZIP_MAX_EEPROM_SIZE;
+
+	default:
+		return ZIP_MAX_IMAGE_SIZE;
+	}
+}
+
+
+//
+// Get file from an opened .ZIP
 // Returns the size of the file inside the .ZIP file that we're looking at
 // NOTE: If the thing we're looking for is found, it allocates it in the passed in buffer.
 //       Which means we have to deallocate it later.
 //
-uint32_t GetFileFromZIP(const char * zipFile, FileType type, uint8_t * &buffer)
+uint32_t GetFileFromZIP(ZipArchive * zip, FileType type, uint8_t * &buffer)
 {
-// NOTE: We could easily check for this by discarding anything that's larger than the RAM/ROM
-//       size of the Jaguar console.
-#if defined(_MSC_VER)
-#pragma message("Warning: !!! FIX !!! Should have sanity checking for ROM size to prevent buffer overflow!")
-#else
-#warning "!!! FIX !!! Should have sanity checking for ROM size to prevent buffer overflow!"
-#endif // _MSC_VER
 	const char ftStrings[5][32] = { "Software", "EEPROM", "Label", "Box Art", "Controller Overlay" };
-//	ZIP * zip = openzip(0, 0, zipFile);
-	FILE * zip = fopen(zipFile, "rb");
-
-	if (zip == NULL)
-	{
-		WriteLog("FILE: Could not open file '%s'!\n", zipFile);
-		return 0;
-	}
-
-//	zipent * ze;
-	ZipFileEntry ze;
+	uint32_t index;
 	bool found = false;
 
-	// The order is here is important: If the file is found, we need to short-circuit the
-	// readzip() call because otherwise, 'ze' will be pointing to the wrong file!
-//	while (!found && readzip(zip))
-	while (!found && GetZIPHeader(zip, ze))
+	for(index=0; !found && (index<zip->count); index++)
 	{
-//		ze = &zip->ent;
+		ZipFileEntry & ze = zip->entry[index];
 
 		// Here we simply rely on the file extension to tell the truth, but we know
 		// that extensions lie like sons-a-bitches. So this is naive, we need to do
@@ -628,46 +682,53 @@ uint32_t GetFileFromZIP(const char * zipFile, FileType type, uint8_t * &buffer)
 			found = true;
 			WriteLog("FILE: Found EEPROM file '%s'.\n", ze.filename);
 		}
+	}
 
-		if (!found)
-			fseek(zip, ze.compressedSize, SEEK_CUR);
+	if (!found)
+	{
+		// Didn't find what we're looking for...
+		WriteLog("FILE: Failed to find file of type %s...\n", ftStrings[type]);
+		return 0;
 	}
 
-	uint32_t fileSize = 0;
+	ZipFileEntry & ze = zip->entry[--index];
 
-	if (found)
+	// Size sanity check, before trusting the size to allocate the buffer
+	if (!ze.uncompressedSize || (ze.uncompressedSize > GetMaxSizeFromZIP(type, ze.filename)))
 	{
-		WriteLog("FILE: Uncompressing...");
-// Insert file size sanity check here...
-		buffer = new uint8_t[ze.uncompressedSize];
+		WriteLog("FILE: Size of '%s' is not valid (%u bytes)!\n", ze.filename, ze.uncompressedSize);
+		return 0;
+	}
 
-//		if (readuncompresszip(zip, ze.compressedSize, buffer) == 0)
-//		if (UncompressFileFromZIP(zip, ze.compressedSize, buffer) == 0)
-		if (UncompressFileFromZIP(zip, ze, buffer) == 0)
-		{
-			fileSize = ze.uncompressedSize;
-			WriteLog("success! (%u bytes)\n", fileSize);
-		}
-		else
-		{
-			delete[] buffer;
-			buffer = NULL;
-			WriteLog("FAILED!\n");
-		}
+	uint32_t fileSize = 0;
+	WriteLog("FILE: Uncompressing...");
+	buffer = new uint8_t[ze.uncompressedSize];
+
+	if (UncompressFileFromZIP(zip, index, buffer, ze.uncompressedSize) == 0)
+	{
+		fileSize = ze.uncompressedSize;
+		WriteLog("success! (%u bytes)\n", fileSize);
 	}
 	else
-		// Didn't find what we're looking for...
-		WriteLog("FILE: Failed to find file of type %s...\n", ftStrings[type]);
+	{
+		delete[] buffer;
+		buffer = NULL;
+		WriteLog("FAILED!\n");
+	}
 
-//	closezip(zip);
-	fclose(zip);
 	return fileSize;
 }
 
 
-uint32_t GetFileDBIdentityFromZIP(const char * zipFile)
+//
+// Get file from .ZIP
+// Returns the size of the file inside the .ZIP file that we're looking at
+// NOTE: If the thing we're looking for is found, it allocates it in the passed in buffer.
+//       Which means we have to deallocate it later.
+//
+uint32_t GetFileFromZIP(const char * zipFile, FileType type, uint8_t * &buffer)
 {
-	FILE * zip = fopen(zipFile, "rb");
+	ZipArchive * zip = ZIPOpen(zipFile);
 
 	if (zip == NULL)
 	{
@@ -675,37 +736,48 @@ uint32_t GetFileDBIdentityFromZIP(const char * zipFile)
 		return 0;
 	}
 
-	ZipFileEntry ze;
+	uint32_t fileSize = GetFileFromZIP(zip, type, buffer);
+	ZIPClose(zip);
+	return fileSize;
+}
+
+
+uint32_t GetFileDBIdentityFromZIP(const char * zipFile)
+{
+	ZipArchive * zip = ZIPOpen(zipFile);
+
+	if (zip == NULL)
+	{
+		WriteLog("FILE: Could not open file '%s'!\n", zipFile);
+		return 0;
+	}
 
 	// Loop through all files in the zip file under consideration
-	while (GetZIPHeader(zip, ze))
+	for(uint32_t i=0; i<zip->count; i++)
 	{
 		// & loop through all known CRC32s in our file DB to see if it's there!
 		uint32_t index = 0;
 
 		while (romList[index].crc32 != 0xFFFFFF)
 		{
-			if (romList[index].crc32 == ze.crc32)
+			if (romList[index].crc32 == zip->entry[i].crc32)
 			{
-				fclose(zip);
+				ZIPClose(zip);
 				return index;
 			}
 
 			index++;
 		}
-
-		// We didn't find it, so skip the compressed data...
-		fseek(zip, ze.compressedSize, SEEK_CUR);
 	}
 
-	fclose(zip);
+	ZIPClose(zip);
 	return (uint32_t )-1;
 }
 
 
 bool FindFileInZIPWithCRC32(const char * zipFile, uint32_t crc)
 {
-	FILE * zip = fopen(zipFile, "rb");
+	ZipArchive * zip = ZIPOpen(zipFile);
 
 	if (zip == NULL)
 	{
@@ -713,22 +785,16 @@ bool FindFileInZIPWithCRC32(const char * zipFile, uint32_t crc)
 		return 0;
 	}
 
-	ZipFileEntry ze;
+	bool found = false;
 
 	// Loop through all files in the zip file under consideration
-	while (GetZIPHeader(zip, ze))
+	for(uint32_t i=0; !found && (i<zip->count); i++)
 	{
-		if (ze.crc32 == crc)
-		{
-			fclose(zip);
-			return true;
-		}
-
-		fseek(zip, ze.compressedSize, SEEK_CUR);
+		found = (zip->entry[i].crc32 == crc);
 	}
 
-	fclose(zip);
-	return false;
+	ZIPClose(zip);
+	return found;
 }
 
 
@@ -9,6 +9,8 @@
 // ---  ----------  -----------------------------------------------------------
 // JPM  06/15/2016  ELF format support
 // JPM  06/19/2016  Soft debugger support
+// JPM   Oct./2026  ZIP file functions on an opened archive
+// JPM   Oct./2026  Memory range of the loaded software
 //
 
 #ifndef __FILE_H__
@@ -22,15 +24,21 @@ extern "C" {
 #endif
 #endif
 
+struct ZipArchive;
+
 enum FileType { FT_SOFTWARE=0, FT_EEPROM, FT_LABEL, FT_BOXART, FT_OVERLAY };
 // JST = Jaguar Software Type
 enum { JST_NONE = 0, JST_ROM, JST_ALPINE, JST_ABS_TYPE1, JST_ABS_TYPE2, JST_JAGSERVER, JST_WTFOMGBBQ, JST_ELF32 };
 
+// Memory range covering the software loaded by JaguarLoadFile
+extern uint32_t jaguarLoadAddress, jaguarLoadSize;
+
 extern uint32_t JaguarLoadROM(uint8_t * &rom, char * path);
 extern bool JaguarLoadFile(char * path);
 extern bool AlpineLoadFile(char * path);
 extern bool DebuggerLoadFile(char * path);
 extern uint32_t GetFileFromZIP(const char * zipFile, FileType type, uint8_t * &buffer);
+extern uint32_t GetFileFromZIP(ZipArchive * zip, FileType type, uint8_t * &buffer);
 extern uint32_t GetFileDBIdentityFromZIP(const char * zipFile);
 extern bool FindFileInZIPWithCRC32(const char * zipFile, uint32_t crc);
 extern uint32_t ParseFileType(uint8_t * buffer, uint32_t size);
@@ -0,0 +1,410 @@
+//
+// Fork-server batch runner
+//
+// The machine is initialised once, and the software is run for the warm-up
+// frames; then a child process is forked per job. The children inherit the
+// memory space and the chips state copy-on-write, apply their own input
+// script and patches, run the frames, and report the frame & machine state
+// CRC32 in a pipe. The cold mode starts a new process per job instead, so the
+// runs per second can be compared with the cost of a full start.
+//
+// Jobs file: one job per line, empty lines and lines starting with # are
+// skipped. A job is a Lua script (- for none), followed by the patches:
+//     inputs/start.lua 802000=4E714E71 F03000=00
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "forkserver.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "frametiming.h"
+#include "headless.h"
+#include "jaguar.h"
+#include "log.h"
+#include "memory.h"
+#include "scripting.h"
+#include "settings.h"
+#include "state.h"
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Job result status
+enum { FS_JOB_DONE = 0, FS_JOB_SCRIPT_ERROR, FS_JOB_NOT_RUN };
+
+struct ForkServerPatch
+{
+	uint32_t address;
+	std::vector<uint8_t> data;
+};
+
+struct ForkServerJob
+{
+	std::string script;
+	std::vector<ForkServerPatch> patches;
+};
+
+// Result sent by the child process, smaller than PIPE_BUF so the writes are atomic
+struct ForkServerResult
+{
+	uint32_t job;
+	uint32_t status;
+	uint32_t frameCount;
+	uint32_t frameCRC32;
+	uint32_t stateCRC32;
+};
+
+
+//
+// Read the jobs file
+//
+static bool ForkServerReadJobs(const char * jobsFilename, std::vector<ForkServerJob> & jobs)
+{
+	char line[4096];
+	uint32_t lineNumber = 0;
+	FILE * fp = fopen(jobsFilename, "r");
+
+	if (!fp)
+	{
+		printf("Could not open jobs file \"%s\"!\n", jobsFilename);
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), fp))
+	{
+		ForkServerJob job;
+		char * token = strtok(line, " \t\r\n");
+		lineNumber++;
+
+		if (!token || (token[0] == '#'))
+		{
+			continue;
+		}
+
+		if (strcmp(token, "-"))
+		{
+			job.script = token;
+		}
+
+		while ((token = strtok(NULL, " \t\r\n")))
+		{
+			ForkServerPatch patch;
+			char * end;
+
+			patch.address = (uint32_t)strtoul(token + (token[0] == '$'), &end, 16);
+
+			if (*end++ != '=')
+			{
+				end = NULL;
+			}
+
+			while (end && isxdigit(end[0]) && isxdigit(end[1]))
+			{
+				char byte[3] = { end[0], end[1], 0 };
+				patch.data.push_back((uint8_t)strtoul(byte, NULL, 16));
+				end += 2;
+			}
+
+			if (!end || *end || patch.data.empty())
+			{
+				printf("Jobs file line %u: bad patch \"%s\" (address=bytes in hexadecimal)\n", lineNumber, token);
+				fclose(fp);
+				return false;
+			}
+
+			job.patches.push_back(patch);
+		}
+
+		jobs.push_back(job);
+	}
+
+	fclose(fp);
+
+	if (jobs.empty())
+	{
+		printf("No job in \"%s\"!\n", jobsFilename);
+		return false;
+	}
+
+	return true;
+}
+
+
+//
+// Apply the patches & the script of a job, run the frames and give the result
+// The ROM cannot be written by the bus, so its patches go straight in the memory space
+//
+static ForkServerResult ForkServerExecuteJob(const ForkServerJob & job, uint32_t index, uint32_t frames)
+{
+	ForkServerResult result;
+
+	memset(&result, 0, sizeof(result));
+	result.job = index;
+
+	for (size_t i = 0; i < job.patches.size(); i++)
+	{
+		for (size_t j = 0; j < job.patches[i].data.size(); j++)
+		{
+			uint32_t address = (job.patches[i].address + (uint32_t)j) & 0xFFFFFF;
+
+			if ((address >= 0x800000) && (address < 0xDFFF00))
+			{
+				jaguarMainROM[address - 0x800000] = job.patches[i].data[j];
+			}
+			else
+			{
+				JaguarWriteByte(address, job.patches[i].data[j], UNKNOWN);
+			}
+		}
+	}
+
+	if (!job.script.empty() && !ScriptLoad(job.script.c_str()))
+	{
+		result.status = FS_JOB_SCRIPT_ERROR;
+		return result;
+	}
+
+	HeadlessExecute(frames);
+	result.status = FS_JOB_DONE;
+	result.frameCount = jaguarFrameCount;
+	result.frameCRC32 = HeadlessFrameCRC32();
+	result.stateCRC32 = StateCRC32();
+	ScriptDone();
+	return result;
+}
+
+
+#if !defined(_WIN32)
+//
+// Wait for a child process, and collect the results sent until then
+// Returns the job of the child process
+//
+static uint32_t ForkServerWait(int fd, std::vector<pid_t> & jobPid, std::vector<ForkServerResult> & results, int * status)
+{
+	ForkServerResult result;
+	pid_t pid;
+
+	while (((pid = wait(status)) < 0) && (errno == EINTR));
+
+	// The child process has written its result before its end
+	while (read(fd, &result, sizeof(result)) == sizeof(result))
+	{
+		if (result.job < results.size())
+		{
+			results[result.job] = result;
+		}
+	}
+
+	for (uint32_t i = 0; i < jobPid.size(); i++)
+	{
+		if (jobPid[i] == pid)
+		{
+			jobPid[i] = 0;
+			return i;
+		}
+	}
+
+	return (uint32_t)jobPid.size();
+}
+
+
+//
+// Start a child process for a job
+// The warm child runs the job from the forked machine, the cold child starts the program again for the job only
+//
+static pid_t ForkServerStart(const ForkServerJob & job, uint32_t index, uint32_t frames, int fd, bool cold, int argc, char * argv[])
+{
+	fflush(NULL);
+	pid_t pid = fork();
+
+	if (pid != 0)
+	{
+		return pid;
+	}
+
+	if (cold)
+	{
+		char jobOption[64];
+		std::vector<char *> args(argv, argv + argc);
+
+		sprintf(jobOption, "%u:%i", index, fd);
+		args.push_back((char *)"--batch-job");
+		args.push_back(jobOption);
+		args.push_back(NULL);
+		execv("/proc/self/exe", args.data());
+		execvp(argv[0], args.data());
+		_exit(127);
+	}
+
+	ForkServerResult result = ForkServerExecuteJob(job, index, frames);
+	ssize_t r = write(fd, &result, sizeof(result));
+	_exit(r == sizeof(result) ? 0 : 1);
+}
+#endif
+
+
+//
+// Run the jobs from the preinitialised machine, or from cold starts
+//
+int ForkServerRun(char * filename, uint32_t frames, uint32_t warmupFrames, const char * jobsFilename, uint32_t workers, bool cold, int argc, char * argv[])
+{
+#if defined(_WIN32)
+	printf("The batch runner needs fork(), it is not available on this platform!\n");
+	return 1;
+#else
+	std::vector<ForkServerJob> jobs;
+	int fds[2];
+	uint64_t start = FrameTimingNow();
+
+	if (!ForkServerReadJobs(jobsFilename, jobs))
+	{
+		return 1;
+	}
+
+	// The cold children load the software themselves
+	if (!cold)
+	{
+		if (!HeadlessLoad(filename))
+		{
+			JaguarDone();
+			return 1;
+		}
+
+		HeadlessExecute(warmupFrames);
+		printf("Initialisation and %u warm-up frames: %.3f ms\n", warmupFrames, (FrameTimingNow() - start) / 1000000.0);
+	}
+
+	if (pipe(fds) != 0)
+	{
+		printf("Could not create the results pipe!\n");
+
+		if (!cold)
+		{
+			JaguarDone();
+		}
+
+		return 1;
+	}
+
+	// The results are collected after each child end, without waiting for more
+	fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+	std::vector<pid_t> jobPid(jobs.size(), 0);
+	std::vector<ForkServerResult> results(jobs.size());
+	std::vector<int> exitStatus(jobs.size(), 0);
+	uint32_t next = 0, active = 0, failed = 0;
+	workers = (workers ? workers : 1);
+	start = FrameTimingNow();
+
+	for (uint32_t i = 0; i < results.size(); i++)
+	{
+		results[i].status = FS_JOB_NOT_RUN;
+	}
+
+	while ((next < jobs.size()) || active)
+	{
+		while ((next < jobs.size()) && (active < workers))
+		{
+			if ((jobPid[next] = ForkServerStart(jobs[next], next, frames, fds[1], cold, argc, argv)) < 0)
+			{
+				printf("Could not start job %u!\n", next);
+				jobPid[next] = 0;
+			}
+			else
+			{
+				active++;
+			}
+
+			next++;
+		}
+
+		if (active)
+		{
+			int status = 0;
+			uint32_t job = ForkServerWait(fds[0], jobPid, results, &status);
+
+			if (job < jobs.size())
+			{
+				exitStatus[job] = status;
+				active--;
+			}
+			else
+			{
+				// No more child process to wait for
+				active = 0;
+			}
+		}
+	}
+
+	double elapsed = (FrameTimingNow() - start) / 1000000000.0;
+	close(fds[0]);
+	close(fds[1]);
+
+	for (uint32_t i = 0; i < results.size(); i++)
+	{
+		if (results[i].status == FS_JOB_DONE)
+		{
+			printf("Job %u: frame %u CRC32: %08X, state CRC32: %08X\n", i, results[i].frameCount, results[i].frameCRC32, results[i].stateCRC32);
+		}
+		else
+		{
+			printf("Job %u: %s (%s %i)\n", i, (results[i].status == FS_JOB_SCRIPT_ERROR ? "could not run the script" : "failed"), (WIFSIGNALED(exitStatus[i]) ? "signal" : "exit status"), (WIFSIGNALED(exitStatus[i]) ? WTERMSIG(exitStatus[i]) : WEXITSTATUS(exitStatus[i])));
+			failed++;
+		}
+	}
+
+	printf("%u %s runs in %.3f s: %.2f runs/s\n", (uint32_t)jobs.size(), (cold ? "cold" : "forked"), elapsed, (elapsed > 0.0 ? jobs.size() / elapsed : 0.0));
+
+	if (!cold)
+	{
+		JaguarDone();
+	}
+
+	return (failed ? 1 : 0);
+#endif
+}
+
+
+//
+// Run one job in a cold started process, the job option is <job>:<results pipe>
+//
+int ForkServerRunJob(char * filename, uint32_t frames, uint32_t warmupFrames, const char * jobsFilename, const char * jobOption)
+{
+#if defined(_WIN32)
+	return 1;
+#else
+	std::vector<ForkServerJob> jobs;
+	uint32_t index;
+	int fd;
+
+	if ((sscanf(jobOption, "%u:%i", &index, &fd) != 2) || !ForkServerReadJobs(jobsFilename, jobs) || (index >= jobs.size()))
+	{
+		return 1;
+	}
+
+	if (!HeadlessLoad(filename))
+	{
+		return 1;
+	}
+
+	HeadlessExecute(warmupFrames);
+	ForkServerResult result = ForkServerExecuteJob(jobs[index], index, frames);
+	int retVal = (write(fd, &result, sizeof(result)) == sizeof(result) ? 0 : 1);
+	JaguarDone();
+	return retVal;
+#endif
+}
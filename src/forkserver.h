@@ -0,0 +1,15 @@
+//
+// forkserver.h: Header file
+//
+// Batch runner forking preinitialised machines
+//
+
+#ifndef __FORKSERVER_H__
+#define __FORKSERVER_H__
+
+#include <stdint.h>
+
+extern int ForkServerRun(char * filename, uint32_t frames, uint32_t warmupFrames, const char * jobsFilename, uint32_t workers, bool cold, int argc, char * argv[]);
+extern int ForkServerRunJob(char * filename, uint32_t frames, uint32_t warmupFrames, const char * jobsFilename, const char * jobOption);
+
+#endif	// __FORKSERVER_H__
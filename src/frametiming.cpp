@@ -0,0 +1,363 @@
+//
+// Frame timing instrumentation
+//
+// The GUI marks the frame start, the end of the emulation and the end of the
+// display, the measures of each frame are taken from a monotonic nanoseconds
+// clock. They go in lock-free log-linear histograms, so the percentiles can be
+// read from any thread, and in a history used by the graph overlay and the CSV
+// dump. The audio thread only adds the samples it requests, and the input
+// events only stamp their time, so the frame measures can be taken alone.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "frametiming.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include "log.h"
+#include "settings.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Histograms buckets: 16 linear sub-buckets per power of 2 (~6% of precision)
+#define FT_SUBBUCKETS_BITS		4
+#define FT_SUBBUCKETS			(1 << FT_SUBBUCKETS_BITS)
+#define FT_BUCKETS				(64 * FT_SUBBUCKETS)
+
+// A frame starting too late after the previous display is a pause, and is not measured
+#define FT_PAUSE_NS				250000000
+
+// Graph overlay
+#define FT_GRAPH_HEIGHT			64
+#define FT_GRAPH_NS_PER_PIXEL	500000
+#define FT_GRAPH_MAX_FRAMES		256
+
+struct FrameTimingRecord
+{
+	uint64_t timestamp;
+	uint64_t measure[FT_END];
+};
+
+static std::atomic<uint32_t> histogram[FT_END][FT_BUCKETS];
+static std::atomic<uint32_t> audioSamples;
+static std::atomic<uint64_t> inputTimestamp;		// 0 if no pending input
+static FrameTimingRecord history[FRAMETIMING_HISTORY];
+static uint32_t historyIndex, historyCount, frameNumber;
+static uint64_t markTimestamp[FT_MARK_DISPLAYED + 1];
+static uint64_t previousStart, previousDisplayed;
+
+
+//
+// Monotonic clock in nanoseconds
+//
+uint64_t FrameTimingNow(void)
+{
+#if defined(_WIN32)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	if (!frequency.QuadPart)
+	{
+		QueryPerformanceFrequency(&frequency);
+	}
+
+	QueryPerformanceCounter(&counter);
+	return (uint64_t)(((double)counter.QuadPart * 1000000000.0) / (double)frequency.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+#endif
+}
+
+
+//
+// Histogram bucket of a value
+//
+static uint32_t FrameTimingBucket(uint64_t value)
+{
+	uint32_t msb = FT_SUBBUCKETS_BITS;
+
+	if (value < FT_SUBBUCKETS)
+	{
+		return (uint32_t)value;
+	}
+
+	while (value >> (msb + 1))
+	{
+		msb++;
+	}
+
+	return ((msb - FT_SUBBUCKETS_BITS + 1) * FT_SUBBUCKETS) + ((uint32_t)(value >> (msb - FT_SUBBUCKETS_BITS)) & (FT_SUBBUCKETS - 1));
+}
+
+
+//
+// Middle value of a histogram bucket
+//
+static uint64_t FrameTimingBucketValue(uint32_t bucket)
+{
+	if (bucket < FT_SUBBUCKETS)
+	{
+		return bucket;
+	}
+
+	uint32_t shift = (bucket / FT_SUBBUCKETS) - 1;
+	return ((uint64_t)(FT_SUBBUCKETS + (bucket % FT_SUBBUCKETS)) << shift) + ((1ULL << shift) >> 1);
+}
+
+
+static void FrameTimingAdd(uint32_t measure, uint64_t value)
+{
+	histogram[measure][FrameTimingBucket(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+//
+// Clear the measures
+//
+void FrameTimingReset(void)
+{
+	for (uint32_t i = 0; i < FT_END; i++)
+	{
+		for (uint32_t j = 0; j < FT_BUCKETS; j++)
+		{
+			histogram[i][j].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	audioSamples.store(0, std::memory_order_relaxed);
+	inputTimestamp.store(0, std::memory_order_relaxed);
+	memset(history, 0, sizeof(history));
+	historyIndex = historyCount = frameNumber = 0;
+	previousStart = previousDisplayed = 0;
+}
+
+
+//
+// Mark a frame step
+// The frame measures are taken at the display mark
+//
+void FrameTimingMark(uint32_t mark)
+{
+	uint64_t now = FrameTimingNow();
+
+	if (mark > FT_MARK_DISPLAYED)
+	{
+		return;
+	}
+
+	markTimestamp[mark] = now;
+
+	if (mark == FT_MARK_DISPLAYED)
+	{
+		FrameTimingRecord * record = &history[historyIndex];
+		uint64_t start = markTimestamp[FT_MARK_START];
+		bool paused = (!previousDisplayed || ((start - previousDisplayed) > FT_PAUSE_NS));
+
+		memset(record, 0, sizeof(FrameTimingRecord));
+		record->timestamp = start;
+		record->measure[FT_EMULATION] = markTimestamp[FT_MARK_EMULATED] - start;
+		record->measure[FT_RENDER] = now - markTimestamp[FT_MARK_EMULATED];
+		FrameTimingAdd(FT_EMULATION, record->measure[FT_EMULATION]);
+		FrameTimingAdd(FT_RENDER, record->measure[FT_RENDER]);
+
+		if (!paused)
+		{
+			record->measure[FT_FRAME] = start - previousStart;
+			record->measure[FT_WAIT] = start - previousDisplayed;
+			FrameTimingAdd(FT_FRAME, record->measure[FT_FRAME]);
+			FrameTimingAdd(FT_WAIT, record->measure[FT_WAIT]);
+		}
+
+		// Input event to display
+		uint64_t input = inputTimestamp.exchange(0, std::memory_order_relaxed);
+
+		if (input)
+		{
+			record->measure[FT_LATENCY] = now - input;
+			FrameTimingAdd(FT_LATENCY, record->measure[FT_LATENCY]);
+		}
+
+		record->measure[FT_AUDIO] = audioSamples.exchange(0, std::memory_order_relaxed);
+		FrameTimingAdd(FT_AUDIO, record->measure[FT_AUDIO]);
+
+		historyIndex = (historyIndex + 1) % FRAMETIMING_HISTORY;
+		historyCount += (historyCount < FRAMETIMING_HISTORY);
+		frameNumber++;
+		previousStart = start;
+		previousDisplayed = now;
+	}
+}
+
+
+//
+// Stamp an input event, only the first one is kept until the frame display
+//
+void FrameTimingInputEvent(void)
+{
+	uint64_t expected = 0;
+
+	inputTimestamp.compare_exchange_strong(expected, FrameTimingNow(), std::memory_order_relaxed);
+}
+
+
+//
+// Audio samples requested by the host audio, called from the audio thread
+//
+void FrameTimingAudioSamples(uint32_t samples)
+{
+	audioSamples.fetch_add(samples, std::memory_order_relaxed);
+}
+
+
+//
+// Get the measure percentile (0 if no measure)
+//
+uint64_t FrameTimingPercentile(uint32_t measure, uint32_t percent)
+{
+	uint64_t total = 0, count = 0;
+
+	if (measure >= FT_END)
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < FT_BUCKETS; i++)
+	{
+		total += histogram[measure][i].load(std::memory_order_relaxed);
+	}
+
+	uint64_t rank = ((total * percent) + 99) / 100;
+
+	for (uint32_t i = 0; (i < FT_BUCKETS) && total; i++)
+	{
+		count += histogram[measure][i].load(std::memory_order_relaxed);
+
+		if (count && (count >= rank))
+		{
+			return FrameTimingBucketValue(i);
+		}
+	}
+
+	return 0;
+}
+
+
+//
+// Frames per 10 seconds over the last frames
+//
+uint32_t FrameTimingFPS(void)
+{
+	uint64_t elapsed = 0;
+	uint32_t frames = 0;
+
+	for (uint32_t i = 1; (i <= 32) && (i <= historyCount); i++)
+	{
+		FrameTimingRecord * record = &history[(historyIndex + FRAMETIMING_HISTORY - i) % FRAMETIMING_HISTORY];
+
+		if (record->measure[FT_FRAME])
+		{
+			elapsed += record->measure[FT_FRAME];
+			frames++;
+		}
+	}
+
+	return (elapsed ? (uint32_t)(((uint64_t)frames * 10000000000ULL) / elapsed) : 0);
+}
+
+
+//
+// Draw the frames graph overlay in the bottom left corner of the screen buffer
+// Each frame is a bar with the emulation (green), render (blue) and wait (grey) times, the red line is the expected frame time
+// Pixels are RGBA
+//
+void FrameTimingDrawGraph(uint32_t * buffer, uint32_t pitch, uint32_t width, uint32_t height)
+{
+	uint32_t frames = (width < FT_GRAPH_MAX_FRAMES) ? width : FT_GRAPH_MAX_FRAMES;
+	uint32_t target = (uint32_t)((vjs.hardwareTypeNTSC ? (1000000000 / 60) : (1000000000 / 50)) / FT_GRAPH_NS_PER_PIXEL);
+
+	if (!buffer || (height < FT_GRAPH_HEIGHT))
+	{
+		return;
+	}
+
+	frames = (frames < historyCount) ? frames : historyCount;
+
+	for (uint32_t x = 0; x < frames; x++)
+	{
+		FrameTimingRecord * record = &history[(historyIndex + FRAMETIMING_HISTORY - frames + x) % FRAMETIMING_HISTORY];
+		uint32_t emulation = (uint32_t)(record->measure[FT_EMULATION] / FT_GRAPH_NS_PER_PIXEL);
+		uint32_t render = emulation + (uint32_t)(record->measure[FT_RENDER] / FT_GRAPH_NS_PER_PIXEL);
+		uint32_t wait = render + (uint32_t)(record->measure[FT_WAIT] / FT_GRAPH_NS_PER_PIXEL);
+
+		for (uint32_t y = 0; y < FT_GRAPH_HEIGHT; y++)
+		{
+			uint32_t color = 0x000000FF;
+
+			if (y == target)
+			{
+				color = 0xFF0000FF;
+			}
+			else if (y < emulation)
+			{
+				color = 0x00C000FF;
+			}
+			else if (y < render)
+			{
+				color = 0x4060FFFF;
+			}
+			else if (y < wait)
+			{
+				color = 0x808080FF;
+			}
+
+			buffer[((height - 1 - y) * pitch) + x] = color;
+		}
+	}
+}
+
+
+//
+// Dump the frames history in a CSV file
+//
+bool FrameTimingDumpCSV(const char * path)
+{
+	FILE * fp = fopen(path, "w");
+
+	if (!fp)
+	{
+		WriteLog("FRAMETIMING: Cannot create %s\n", path);
+		return false;
+	}
+
+	fprintf(fp, "frame,timestamp_ns,frame_ns,emulation_ns,render_ns,wait_ns,latency_ns,audio_samples\n");
+
+	for (uint32_t i = 0; i < historyCount; i++)
+	{
+		FrameTimingRecord * record = &history[(historyIndex + FRAMETIMING_HISTORY - historyCount + i) % FRAMETIMING_HISTORY];
+		fprintf(fp, "%u,%llu", (frameNumber - historyCount + i), (unsigned long long)record->timestamp);
+
+		for (uint32_t j = 0; j < FT_END; j++)
+		{
+			fprintf(fp, ",%llu", (unsigned long long)record->measure[j]);
+		}
+
+		fprintf(fp, "\n");
+	}
+
+	fclose(fp);
+	WriteLog("FRAMETIMING: %u frames dumped in %s\n", historyCount, path);
+	return true;
+}
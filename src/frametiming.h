@@ -0,0 +1,36 @@
+//
+// frametiming.h: Header file
+//
+// Frame timing, jitter and latency instrumentation
+//
+
+#ifndef __FRAMETIMING_H__
+#define __FRAMETIMING_H__
+
+#include <stdint.h>
+
+// Measures per frame
+// FT_FRAME             frame period, from a frame start to the next one (ns)
+// FT_EMULATION         frame emulation time (ns)
+// FT_RENDER            render & upload time of the frame (ns)
+// FT_WAIT              time spent waiting on the frame timer (ns)
+// FT_LATENCY           input event to display time, only for the frames with an input (ns)
+// FT_AUDIO             audio samples requested by the host audio during the frame
+enum { FT_FRAME = 0, FT_EMULATION, FT_RENDER, FT_WAIT, FT_LATENCY, FT_AUDIO, FT_END };
+
+// Frame marks
+enum { FT_MARK_START = 0, FT_MARK_EMULATED, FT_MARK_DISPLAYED };
+
+#define FRAMETIMING_HISTORY		4096			// Frames kept for the graph & the CSV dump
+
+extern uint64_t FrameTimingNow(void);
+extern void FrameTimingReset(void);
+extern void FrameTimingMark(uint32_t mark);
+extern void FrameTimingInputEvent(void);
+extern void FrameTimingAudioSamples(uint32_t samples);
+extern uint64_t FrameTimingPercentile(uint32_t measure, uint32_t percent);
+extern uint32_t FrameTimingFPS(void);
+extern void FrameTimingDrawGraph(uint32_t * buffer, uint32_t pitch, uint32_t width, uint32_t height);
+extern bool FrameTimingDumpCSV(const char * path);
+
+#endif	// __FRAMETIMING_H__
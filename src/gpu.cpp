@@ -21,6 +21,16 @@
 // JLH  11/26/2011  Added fixes for LOAD/STORE alignment issues
 // JPM  06/06/2016  Visual Studio support
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  MMULT 3x3/4x4 local RAM fast path, DIV with the host divide
+// JPM   Oct./2026  Per opcode execution histogram
+// JPM   Oct./2026  GPU -> CPU interrupt requested to the interrupt controller
+// JPM   Oct./2026  Local RAM writes by the GPU dispatched to the memory write hooks
+// JPM   Oct./2026  External accesses counted for the main bus arbitration
+// JPM   Oct./2026  External accesses counted with the bus arbitration on only
+// JPM   Oct./2026  Interrupts checked at the timeslice start only when the latches or the flags changed
+// JPM   Oct./2026  IMASK cleared by the GPU, the interrupts checked at the end of the instruction (after the jump for a delay slot)
+// JPM   Oct./2026  Cycles run in the slice, for the JERRY timers counters
+// JPM   Oct./2026  Interrupt latches & enables moved to the interrupt controller
 //
 
 //
@@ -36,11 +46,15 @@
 
 #include <stdlib.h>
 #include <string.h>								// For memset
+#include "bus.h"
 #include "dsp.h"
+#include "hooks.h"
+#include "interrupt.h"
 #include "jagdasm.h"
 #include "jaguar.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
+#include "opcodestats.h"
 //#include "memory.h"
 #include "tom.h"
 #include "state.h"
@@ -179,6 +193,10 @@ GPU opcodes use (BIOS flying ATARI logo):
 #define INT_CLR4		0x2000
 #define REGPAGE			0x4000
 #define DMAEN			0x8000
+#define INT_ENA04		(INT_ENA0 | INT_ENA1 | INT_ENA2 | INT_ENA3 | INT_ENA4)
+
+// G_CTRL interrupt latches, kept by the interrupt controller
+#define INT_LAT04		0x07C0
 
 // External global variables
 
@@ -341,6 +359,11 @@ static uint32_t gpu_instruction;
 static uint32_t gpu_opcode_first_parameter;
 static uint32_t gpu_opcode_second_parameter;
 
+// Matrix multiply operands: alternate register halves & big-endian words of the local RAM
+#define GPU_MMULT_LO(r)		((int32_t)(int16_t)((r) & 0xFFFF))
+#define GPU_MMULT_HI(r)		((int32_t)(int16_t)((r) >> 16))
+#define GPU_MMULT_RAM(o)		((int32_t)(int16_t)(((uint16_t)gpu_ram_8[(o) + 2] << 8) | gpu_ram_8[(o) + 3]))
+
 #define GPU_RUNNING		(gpu_control & 0x01)
 
 #define RM				gpu_reg[gpu_opcode_first_parameter]
@@ -398,6 +421,33 @@ const char * gpu_opcode_str[64]=
 
 static uint32_t gpu_in_exec = 0;
 static uint32_t gpu_releaseTimeSlice_flag = 0;
+// Latches, enables or IMASK changed since the interrupts were last checked
+static bool gpu_irqs_changed = true;
+// IMASK cleared by the running instruction
+static bool gpu_imask_cleared = false;
+
+// Execution budget of a GPUExec call, the cycles are moved aside by a wakeup
+struct GPUExecBudget
+{
+	int32_t cycles;
+	int32_t stashed;
+	int32_t slice;								// Cycles given to the call
+};
+
+static GPUExecBudget * gpuExecBudget = NULL;	// Budget of the innermost GPUExec call
+
+
+//
+// Wake up the execution core at the end of the current instruction
+//
+static inline void GPUWakeUp(void)
+{
+	if (gpuExecBudget)
+	{
+		gpuExecBudget->stashed += gpuExecBudget->cycles;
+		gpuExecBudget->cycles = 0;
+	}
+}
 
 void GPUReleaseTimeslice(void)
 {
@@ -409,6 +459,16 @@ bool	GPUIsRunning(void)
 	return	GPU_RUNNING;
 }
 
+
+//
+// Cycles run in the slice of the innermost GPUExec call, 0 out of it
+//
+int32_t GPUCyclesRun(void)
+{
+	return (gpuExecBudget ? (gpuExecBudget->slice - gpuExecBudget->cycles - gpuExecBudget->stashed) : 0);
+}
+
+
 uint32_t GPUGetPC(void)
 {
 	return gpu_pc;
@@ -470,6 +530,7 @@ uint8_t GPUReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 			return data & 0xFF;
 	}
 
+	BUS_ACCESS(GPU);
 	return JaguarReadByte(offset, who);
 }
 
@@ -506,6 +567,7 @@ uint16_t GPUReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 //if (offset >= 0xF0B000 && offset <= 0xF0BFFF)
 //WriteLog("[GPUR16] --> Possible GPU RAM mirror access by %s!", whoName[who]);
 
+	BUS_ACCESS(GPU);
 	return JaguarReadWord(offset, who);
 }
 
@@ -542,7 +604,7 @@ uint32_t GPUReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 
 			gpu_flags = (gpu_flags & 0xFFFFFFF8) | (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z;
 
-			return gpu_flags & 0xFFFFC1FF;
+			return (gpu_flags | (InterruptEnabled(INTERRUPT_GPU) << 4)) & 0xFFFFC1FF;
 		case 0x04:
 			return gpu_matrix_control;
 		case 0x08:
@@ -552,7 +614,7 @@ uint32_t GPUReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 		case 0x10:
 			return gpu_pc;
 		case 0x14:
-			return gpu_control;
+			return gpu_control | (InterruptPending(INTERRUPT_GPU) << 6);
 		case 0x18:
 			return gpu_hidata;
 		case 0x1C:
@@ -570,6 +632,7 @@ uint32_t GPUReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 /*if (offset >= 0xF1D000 && offset <= 0xF1DFFF)
 	WriteLog("[GPUR32] --> Reading from Wavetable ROM!\n");//*/
 
+	BUS_ACCESS(GPU);
 	return (JaguarReadWord(offset, who) << 16) | JaguarReadWord(offset + 2, who);
 }
 
@@ -583,6 +646,10 @@ void GPUWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 
 	if ((offset >= GPU_WORK_RAM_BASE) && (offset <= GPU_WORK_RAM_BASE + 0x0FFF))
 	{
+		// The other masters writes are dispatched by the bus
+		if (who == GPU)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 1, who);
+
 		gpu_ram_8[offset & 0xFFF] = data;
 
 //This is the same stupid worthless code that was in the DSP!!! AARRRGGGGHHHHH!!!!!!
@@ -611,6 +678,7 @@ void GPUWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 		return;
 	}
 //	WriteLog("gpu: writing %.2x at 0x%.8x\n",data,offset);
+	BUS_ACCESS(GPU);
 	JaguarWriteByte(offset, data, who);
 }
 
@@ -624,6 +692,9 @@ void GPUWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 
 	if ((offset >= GPU_WORK_RAM_BASE) && (offset <= GPU_WORK_RAM_BASE + 0x0FFE))
 	{
+		if (who == GPU)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 2, who);
+
 		gpu_ram_8[offset & 0xFFF] = (data>>8) & 0xFF;
 		gpu_ram_8[(offset+1) & 0xFFF] = data & 0xFF;//*/
 /*		offset &= 0xFFF;
@@ -686,6 +757,7 @@ void GPUWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 	}
 
 	// Have to be careful here--this can cause an infinite loop!
+	BUS_ACCESS(GPU);
 	JaguarWriteWord(offset, data, who);
 }
 
@@ -708,6 +780,9 @@ void GPUWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 		}
 #endif	// GPU_DEBUG
 
+		if (who == GPU)
+			HOOKS_CALL(HOOK_MEMWRITE, offset, data, 4, who);
+
 		offset &= 0xFFF;
 		SET32(gpu_ram_8, offset, data);
 		return;
@@ -723,20 +798,32 @@ void GPUWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 			bool IMASKCleared = (gpu_flags & IMASK) && !(data & IMASK);
 			// NOTE: According to the JTRM, writing a 1 to IMASK has no effect; only the
 			//       IRQ logic can set it. So we mask it out here to prevent problems...
-			gpu_flags = data & (~IMASK);
+			gpu_flags = data & (~(IMASK | INT_ENA04));
+			InterruptSetEnabled(INTERRUPT_GPU, (data & INT_ENA04) >> 4);
+			gpu_irqs_changed = true;
 			gpu_flag_z = gpu_flags & ZERO_FLAG;
 			gpu_flag_c = (gpu_flags & CARRY_FLAG) >> 1;
 			gpu_flag_n = (gpu_flags & NEGA_FLAG) >> 2;
 			GPUUpdateRegisterBanks();
-			gpu_control &= ~((gpu_flags & CINT04FLAGS) >> 3);	// Interrupt latch clear bits
+			InterruptAcknowledge(INTERRUPT_GPU, (data & CINT04FLAGS) >> 9);	// Interrupt latch clear bits
 //Writing here is only an interrupt enable--this approach is just plain wrong!
 //			GPUHandleIRQs();
 //This, however, is A-OK! ;-)
-			if (IMASKCleared)						// If IMASK was cleared,
-				GPUHandleIRQs();					// see if any other interrupts need servicing!
+			// If IMASK was cleared, see if any other interrupts need servicing! By the GPU itself,
+			// at the end of the instruction (after the jump for a delay slot)
+			if (IMASKCleared)
+			{
+				if (gpuExecBudget)
+				{
+					gpu_imask_cleared = true;
+					GPUWakeUp();
+				}
+				else
+					GPUHandleIRQs();
+			}
 #ifdef GPU_DEBUG
-			if (gpu_flags & (INT_ENA0 | INT_ENA1 | INT_ENA2 | INT_ENA3 | INT_ENA4))
-				WriteLog("GPU: Interrupt enable set by %s! Bits: %02X\n", whoName[who], (gpu_flags >> 4) & 0x1F);
+			if (InterruptEnabled(INTERRUPT_GPU))
+				WriteLog("GPU: Interrupt enable set by %s! Bits: %02X\n", whoName[who], InterruptEnabled(INTERRUPT_GPU));
 			WriteLog("GPU: REGPAGE %s...\n", (gpu_flags & REGPAGE ? "set" : "cleared"));
 #endif	// GPU_DEBUG
 			break;
@@ -766,15 +853,11 @@ WriteLog("GPU: %s setting GPU PC to %08X %s\n", whoName[who], gpu_pc, (GPU_RUNNI
 			if (data & 0x02)
 			{
 //WriteLog("GPU->CPU interrupt\n");
-				if (TOMIRQEnabled(IRQ_GPU))
-				{
 //This is the programmer's responsibility, to make sure the handler is valid, not ours!
 //					if ((TOMIRQEnabled(IRQ_GPU))// && (JaguarInterruptHandlerIsValid(64)))
-					{
-						TOMSetPendingGPUInt();
-						m68k_set_irq(2);			// Set 68000 IPL 2
-						GPUReleaseTimeslice();
-					}
+				if (InterruptTOMRequest(IRQ_GPU))	// Set 68000 IPL 2
+				{
+					GPUReleaseTimeslice();
 				}
 				data &= ~0x02;
 			}
@@ -932,6 +1015,7 @@ if (GPU_RUNNING && effect_start5 && gpu_pc == 0xF035D8)
 //	JaguarWriteWord(offset, (data >> 16) & 0xFFFF, who);
 //	JaguarWriteWord(offset+2, data & 0xFFFF, who);
 // We're a 32-bit processor, we can do a long write...!
+	BUS_ACCESS(GPU);
 	JaguarWriteLong(offset, data, who);
 }
 
@@ -953,15 +1037,14 @@ void GPUUpdateRegisterBanks(void)
 
 void GPUHandleIRQs(void)
 {
+	gpu_irqs_changed = false;
+
 	// Bail out if we're already in an interrupt!
 	if (gpu_flags & IMASK)
 		return;
 
-	// Get the interrupt latch & enable bits
-	uint32_t bits = (gpu_control >> 6) & 0x1F, mask = (gpu_flags >> 4) & 0x1F;
-
 	// Bail out if latched interrupts aren't enabled
-	bits &= mask;
+	uint32_t bits = InterruptActive(INTERRUPT_GPU);
 	if (!bits)
 		return;
 
@@ -1002,12 +1085,13 @@ void GPUSetIRQLine(int irqline, int state)
 	if (start_logging)
 		WriteLog("GPU: Setting GPU IRQ line #%i\n", irqline);
 
-	uint32_t mask = 0x0040 << irqline;
-	gpu_control &= ~mask;				// Clear the interrupt latch
+	uint32_t mask = 1 << irqline;
+	InterruptAcknowledge(INTERRUPT_GPU, mask);	// Clear the interrupt latch
+	gpu_irqs_changed = true;
 
 	if (state)
 	{
-		gpu_control |= mask;			// Assert the interrupt latch
+		InterruptLatch(INTERRUPT_GPU, mask);	// Assert the interrupt latch
 		GPUHandleIRQs();				// And handle the interrupt...
 	}
 }
@@ -1040,6 +1124,9 @@ void GPUReset(void)
 	gpu_data_organization = 0xFFFFFFFF;
 	gpu_pc				  = 0x00F03000;
 	gpu_control			  = 0x00002800;			// Correctly sets this as TOM Rev. 2
+	InterruptReset(INTERRUPT_GPU);
+	gpu_irqs_changed	  = true;
+	gpu_imask_cleared	  = false;
 	gpu_hidata			  = 0x00000000;
 	gpu_remain			  = 0x00000000;			// These two registers are RO/WO
 	gpu_div_control		  = 0x00000000;
@@ -1134,11 +1221,14 @@ size_t gpu_dump(FILE *fp)
 	DUMP32(gpu_acc);
 	DUMP32(gpu_remain);
 	DUMP32(gpu_hidata);
-	DUMP32(gpu_flags);
+	// The interrupt enables & latches in their registers
+	uint32_t flags = gpu_flags | (InterruptEnabled(INTERRUPT_GPU) << 4);
+	uint32_t control = gpu_control | (InterruptPending(INTERRUPT_GPU) << 6);
+	DUMP32(flags);
 	DUMP32(gpu_matrix_control);
 	DUMP32(gpu_pointer_to_matrix);
 	DUMP32(gpu_data_organization);
-	DUMP32(gpu_control);
+	DUMP32(control);
 	DUMP32(gpu_div_control);
 	DUMP8(gpu_flag_z);
 	DUMP8(gpu_flag_n);
@@ -1184,6 +1274,11 @@ size_t gpu_load(FILE *fp)
 	LOADARR32(gpu_opcode_use);
 	LOAD32(gpu_in_exec);
 	LOAD32(gpu_releaseTimeSlice_flag);
+	InterruptSetEnabled(INTERRUPT_GPU, (gpu_flags & INT_ENA04) >> 4);
+	InterruptSetPending(INTERRUPT_GPU, (gpu_control & INT_LAT04) >> 6);
+	gpu_flags &= ~INT_ENA04;
+	gpu_control &= ~INT_LAT04;
+	gpu_irqs_changed = true;
 
 	uint32_t whichreg;
 	LOAD32(whichreg);
@@ -1212,12 +1307,12 @@ void GPUDone(void)
 	WriteLog("\n\n---------------------------------------------------------------------\n");
 	WriteLog("GPU I/O Registers\n");
 	WriteLog("---------------------------------------------------------------------\n");
-	WriteLog("F0%04X   (G_FLAGS): $%06X\n", 0x2100, (gpu_flags & 0xFFFFFFF8) | (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z);
+	WriteLog("F0%04X   (G_FLAGS): $%06X\n", 0x2100, (gpu_flags & 0xFFFFFFF8) | (InterruptEnabled(INTERRUPT_GPU) << 4) | (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z);
 	WriteLog("F0%04X    (G_MTXC): $%04X\n", 0x2104, gpu_matrix_control);
 	WriteLog("F0%04X    (G_MTXA): $%04X\n", 0x2108, gpu_pointer_to_matrix);
 	WriteLog("F0%04X     (G_END): $%02X\n", 0x210C, gpu_data_organization);
 	WriteLog("F0%04X      (G_PC): $%06X\n", 0x2110, gpu_pc);
-	WriteLog("F0%04X    (G_CTRL): $%06X\n", 0x2114, gpu_control);
+	WriteLog("F0%04X    (G_CTRL): $%06X\n", 0x2114, gpu_control | (InterruptPending(INTERRUPT_GPU) << 6));
 	WriteLog("F0%04X  (G_HIDATA): $%08X\n", 0x2118, gpu_hidata);
 	WriteLog("F0%04X  (G_REMAIN): $%08X\n", 0x211C, gpu_remain);
 	WriteLog("F0%04X (G_DIVCTRL): $%02X\n", 0x211C, gpu_div_control);
@@ -1226,7 +1321,7 @@ void GPUDone(void)
 	WriteLog("GPU: Stopped at PC=%08X (GPU %s running)\n", (unsigned int)gpu_pc, GPU_RUNNING ? "was" : "wasn't");
 
 	// Get the interrupt latch & enable bits
-	uint8_t bits = (gpu_control >> 6) & 0x1F, mask = (gpu_flags >> 4) & 0x1F;
+	uint8_t bits = InterruptPending(INTERRUPT_GPU), mask = InterruptEnabled(INTERRUPT_GPU);
 	WriteLog("GPU: Latch bits = %02X, enable bits = %02X\n", bits, mask);
 
 	GPUDumpRegisters();
@@ -1242,29 +1337,17 @@ void GPUDone(void)
 }
 
 
-//
-// Main GPU execution core
-//
 static int testCount = 1;
 static int len = 0;
 static bool tripwire = false;
-void GPUExec(int32_t cycles)
-{
-	if (!GPU_RUNNING)
-		return;
 
-#ifdef GPU_SINGLE_STEPPING
-	if (gpu_control & 0x18)
-	{
-		cycles = 1;
-		gpu_control &= ~0x10;
-	}
-#endif
-	GPUHandleIRQs();
-	gpu_releaseTimeSlice_flag = 0;
-	gpu_in_exec++;
 
-	while (cycles > 0 && GPU_RUNNING)
+//
+// GPU instructions run up to the end of the budget, or up to a wakeup
+//
+static inline void GPURun(GPUExecBudget & budget)
+{
+	while (budget.cycles > 0 && GPU_RUNNING)
 	{
 if (gpu_ram_8[0x054] == 0x98 && gpu_ram_8[0x055] == 0x0A && gpu_ram_8[0x056] == 0x03
 	&& gpu_ram_8[0x057] == 0x00 && gpu_ram_8[0x058] == 0x00 && gpu_ram_8[0x059] == 0x00)
@@ -1434,8 +1517,9 @@ if (gpu_pc == 0xF03548 && firstTime)
 /*if (gpu_pc == 0xF0354C)
 	gpu_flag_z = 0;//, gpu_start_log = 1;//*/
 
-		cycles -= gpu_opcode_cycles[index];
+		budget.cycles -= gpu_opcode_cycles[index];
 		gpu_opcode_use[index]++;
+		OPCODE_STATS_ADD(gpuOpcodeStats, index, gpu_opcode_cycles[index]);
 if (gpu_start_log)
 	WriteLog("(RM=%08X, RN=%08X)\n", RM, RN);//*/
 if ((gpu_pc < 0xF03000 || gpu_pc > 0xF03FFF) && !tripwire)
@@ -1444,8 +1528,57 @@ if ((gpu_pc < 0xF03000 || gpu_pc > 0xF03FFF) && !tripwire)
 	tripwire = true;
 }
 	}
+}
+
+
+//
+// Main GPU execution core
+//
+void GPUExec(int32_t cycles)
+{
+	if (!GPU_RUNNING)
+		return;
+
+#ifdef GPU_SINGLE_STEPPING
+	if (gpu_control & 0x18)
+	{
+		cycles = 1;
+		gpu_control &= ~0x10;
+	}
+#endif
+	// The interrupts are handled as their latches are set or IMASK cleared; an interrupt
+	// enabled while latched, or latched while the GPU was stopped, is taken at the slice start
+	// (not in a delay slot, the jump would overwrite its vector)
+	if (gpu_irqs_changed && !gpuExecBudget)
+		GPUHandleIRQs();
+
+	GPUExecBudget budget = { cycles, 0, cycles };
+	GPUExecBudget * outerBudget = gpuExecBudget;
+	gpuExecBudget = &budget;
+	gpu_releaseTimeSlice_flag = 0;
+	gpu_in_exec++;
+
+	while (budget.cycles > 0 && GPU_RUNNING)
+	{
+		// Cycles moved aside by a wakeup are given back
+		GPURun(budget);
+		budget.cycles += budget.stashed;
+		budget.stashed = 0;
+
+		// IMASK cleared by the instruction, the pending interrupts are checked at its end
+		if (gpu_imask_cleared && !outerBudget)
+		{
+			gpu_imask_cleared = false;
+			GPUHandleIRQs();
+		}
+	}
 
 	gpu_in_exec--;
+	gpuExecBudget = outerBudget;
+
+	// IMASK cleared in a delay slot, the outer call checks the pending interrupts after the jump
+	if (gpu_imask_cleared)
+		GPUWakeUp();
 }
 
 //
@@ -2026,7 +2159,10 @@ static void gpu_opcode_storeb(void)
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		GPUWriteLong(RM, RN & 0xFF, GPU);
 	else
+	{
+		BUS_ACCESS(GPU);
 		JaguarWriteByte(RM, RN, GPU);
+	}
 }
 
 
@@ -2040,12 +2176,18 @@ static void gpu_opcode_storew(void)
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		GPUWriteLong(RM & 0xFFFFFFFE, RN & 0xFFFF, GPU);
 	else
+	{
+		BUS_ACCESS(GPU);
 		JaguarWriteWord(RM, RN, GPU);
+	}
 #else
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		GPUWriteLong(RM, RN & 0xFFFF, GPU);
 	else
+	{
+		BUS_ACCESS(GPU);
 		JaguarWriteWord(RM, RN, GPU);
+	}
 #endif
 }
 
@@ -2095,7 +2237,10 @@ static void gpu_opcode_loadb(void)
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		RN = GPUReadLong(RM, GPU) & 0xFF;
 	else
+	{
+		BUS_ACCESS(GPU);
 		RN = JaguarReadByte(RM, GPU);
+	}
 #ifdef GPU_DIS_LOADB
 	if (doGPUDis)
 		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
@@ -2113,12 +2258,18 @@ static void gpu_opcode_loadw(void)
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		RN = GPUReadLong(RM & 0xFFFFFFFE, GPU) & 0xFFFF;
 	else
+	{
+		BUS_ACCESS(GPU);
 		RN = JaguarReadWord(RM, GPU);
+	}
 #else
 	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
 		RN = GPUReadLong(RM, GPU) & 0xFFFF;
 	else
+	{
+		BUS_ACCESS(GPU);
 		RN = JaguarReadWord(RM, GPU);
+	}
 #endif
 #ifdef GPU_DIS_LOADW
 	if (doGPUDis)
@@ -2433,6 +2584,33 @@ static void gpu_opcode_normi(void)
 	SET_ZN(res);
 }
 
+//
+// 3x3 & 4x4 matrices in the local RAM: the operands are read directly and the
+// products are summed modulo 2^32, as the result is truncated to 32 bits
+// Return false if the matrix must be done by the generic loop
+//
+static inline bool gpu_mmult_local(uint32_t * res)
+{
+	int count = gpu_matrix_control & 0x0F;
+	uint32_t stride = (gpu_matrix_control & 0x10 ? 4 * count : 4);
+	uint32_t offset = gpu_pointer_to_matrix - GPU_WORK_RAM_BASE;
+
+	if (((count != 3) && (count != 4)) || (offset >= 0x1000) || ((offset + (stride * (count - 1))) >= 0x1000) || ((IMM_1 + 1) >= 32))
+		return false;
+
+	uint32_t a0 = gpu_alternate_reg[IMM_1], a1 = gpu_alternate_reg[IMM_1 + 1];
+	uint32_t sum = (uint32_t)(GPU_MMULT_LO(a0) * GPU_MMULT_RAM(offset))
+		+ (uint32_t)(GPU_MMULT_HI(a0) * GPU_MMULT_RAM(offset + stride))
+		+ (uint32_t)(GPU_MMULT_LO(a1) * GPU_MMULT_RAM(offset + (stride * 2)));
+
+	if (count == 4)
+		sum += (uint32_t)(GPU_MMULT_HI(a1) * GPU_MMULT_RAM(offset + (stride * 3)));
+
+	*res = sum;
+	return true;
+}
+
+
 static void gpu_opcode_mmult(void)
 {
 	int count	= gpu_matrix_control & 0x0F;	// Matrix width
@@ -2440,6 +2618,13 @@ static void gpu_opcode_mmult(void)
 	int64_t accum = 0;
 	uint32_t res;
 
+	if (gpu_mmult_local(&res))
+	{
+		RN = res;
+		SET_ZN(res);
+		return;
+	}
+
 	if (gpu_matrix_control & 0x10)				// Column stepping
 	{
 		for(int i=0; i<count; i++)
@@ -2532,18 +2717,33 @@ static void gpu_opcode_div(void)	// RN / RM
 	uint32_t q = RN;
 	uint32_t r = 0;
 
-	// If 16.16 division, stuff top 16 bits of RN into remainder and put the
-	// bottom 16 of RN in top 16 of quotient
-	if (gpu_div_control & 0x01)
-		q <<= 16, r = RN >> 16;
+	// Same quotient & remainder with a host divide, when the divisor is below
+	// 2^31 and the quotient fits in 32 bits. The remainder of the last step is
+	// left negative (r - RM) when the quotient is even
+	if (RM && !(RM & 0x80000000) && (!(gpu_div_control & 0x01) || ((RN >> 16) < RM)))
+	{
+		uint64_t dividend = (gpu_div_control & 0x01 ? (uint64_t)RN << 16 : (uint64_t)RN);
+		q = (uint32_t)(dividend / RM);
+		r = (uint32_t)(dividend % RM);
 
-	for(int i=0; i<32; i++)
+		if (!(q & 0x01))
+			r -= RM;
+	}
+	else
 	{
-//		uint32_t sign = (r >> 31) & 0x01;
-		uint32_t sign = r & 0x80000000;
-		r = (r << 1) | ((q >> 31) & 0x01);
-		r += (sign ? RM : -RM);
-		q = (q << 1) | (((~r) >> 31) & 0x01);
+		// If 16.16 division, stuff top 16 bits of RN into remainder and put the
+		// bottom 16 of RN in top 16 of quotient
+		if (gpu_div_control & 0x01)
+			q <<= 16, r = RN >> 16;
+
+		for(int i=0; i<32; i++)
+		{
+//			uint32_t sign = (r >> 31) & 0x01;
+			uint32_t sign = r & 0x80000000;
+			r = (r << 1) | ((q >> 31) & 0x01);
+			r += (sign ? RM : -RM);
+			q = (q << 1) | (((~r) >> 31) & 0x01);
+		}
 	}
 
 	RN = q;
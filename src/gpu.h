@@ -31,6 +31,7 @@ void GPUReleaseTimeslice(void);
 void GPUResetStats(void);
 uint32_t GPUReadPC(void);
 bool	GPUIsRunning(void);
+int32_t GPUCyclesRun(void);
 
 // GPU interrupt numbers (from $F00100, bits 4-8)
 
@@ -40,5 +41,6 @@ enum { GPUIRQ_CPU = 0, GPUIRQ_DSP, GPUIRQ_TIMER, GPUIRQ_OBJECT, GPUIRQ_BLITTER }
 
 extern uint32_t gpu_reg_bank_0[], gpu_reg_bank_1[];
 extern uint8_t gpu_ram_8[];
+extern const char * gpu_opcode_str[];
 
 #endif	// __GPU_H__
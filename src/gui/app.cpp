@@ -19,16 +19,25 @@
 // JPM  Sept./2017  Added the 'Rx' word to the emulator name, updated the credits line, added option (--es-all, --es-ui, --es-alpine & --es-debugger) to support the erase settings
 // JPM   Oct./2018  Added the Rx version's contact in the help text, added timer initialisation in the SDL_Init
 // JPM   Apr./2019  Fixed a command line option duplication
+// JPM   Oct./2026  Added the script (--script) and the headless runner (--headless & --frames) options
+// JPM   Oct./2026  Added the fork-server batch runner options (--batch, --warmup, --workers & --cold)
+// JPM   Oct./2026  Added the Object Processor speculation options (--op-spec, --op-spec-verify & --no-op-spec)
+// JPM   Oct./2026  Added the 68K beam polling loops skip options (--beam-skip & --no-beam-skip)
+// JPM   Oct./2026  Added the main bus arbitration options (--bus & --no-bus)
+// JPM   Oct./2026  Added the serial line host end option (--asi)
 //
 
 #include "app.h"
 
 #include "SDL.h"
 #include <QtWidgets/QApplication>
+#include "forkserver.h"
 #include "gamepad.h"
+#include "headless.h"
 #include "log.h"
 #include "mainwin.h"
 #include "profile.h"
+#include "scripting.h"
 #include "settings.h"
 #include "version.h"
 #include <iostream>
@@ -54,6 +63,14 @@ bool noUntunedTankPlease = false;
 bool loadAndGo = false;
 bool useLogfile = false;
 QString filename;
+static const char * scriptFilename = NULL;
+static bool headless = false;
+static uint32_t headlessFrames = 60;
+static const char * batchFilename = NULL;
+static const char * batchJob = NULL;
+static uint32_t batchWarmupFrames = 0;
+static uint32_t batchWorkers = 1;
+static bool batchCold = false;
 
 // Here's the main application loop--short and simple...
 int main(int argc, char * argv[])
@@ -109,8 +126,38 @@ int main(int argc, char * argv[])
 			printf("Failed to open virtualjaguar.log for writing!\n");
 	}
 
+	// Headless runner doesn't need the GUI, neither the SDL
+	if (headless)
+	{
+		if (filename.isEmpty())
+		{
+			printf("No file to run in headless mode!\n");
+		}
+		else
+		{
+			HeadlessSettings();
+			ParseOptions(argc, argv);
+			DBGManager_Init();
+
+			// Batch runner, or one of its cold started jobs
+			if (batchJob)
+			{
+				retVal = ForkServerRunJob(filename.toUtf8().data(), headlessFrames, batchWarmupFrames, batchFilename, batchJob);
+			}
+			else if (batchFilename)
+			{
+				retVal = ForkServerRun(filename.toUtf8().data(), headlessFrames, batchWarmupFrames, batchFilename, batchWorkers, batchCold, argc, argv);
+			}
+			else
+			{
+				retVal = HeadlessRun(filename.toUtf8().data(), headlessFrames, scriptFilename);
+			}
+
+			DBGManager_Close();
+		}
+	}
 	// Set up SDL library
-	if (SDL_Init(SDL_INIT_JOYSTICK | SDL_INIT_AUDIO | SDL_INIT_TIMER) < 0)
+	else if (SDL_Init(SDL_INIT_JOYSTICK | SDL_INIT_AUDIO | SDL_INIT_TIMER) < 0)
 	{
 		WriteLog("VJ: Could not initialize the SDL library: %s\n", SDL_GetError());
 	}
@@ -122,6 +169,7 @@ int main(int argc, char * argv[])
 		Gamepad::AllocateJoysticks();
 		AutoConnectProfiles();
 		retVal = app.exec();					// And run it!
+		ScriptDone();
 		DBGManager_Close();
 		Gamepad::DeallocateJoysticks();
 
@@ -162,6 +210,10 @@ App::App(int & argc, char * argv[]): QApplication(argc, argv)
 			printf("Could not load file \"%s\"!\n", filename.toUtf8().data());
 	}
 
+	// Script is hooked on the loaded software
+	if (scriptFilename && !ScriptLoad(scriptFilename))
+		printf("Could not run script \"%s\"!\n", scriptFilename);
+
 	mainWindow->show();
 }
 
@@ -204,6 +256,14 @@ bool ParseCommandLine(int argc, char * argv[])
 				"   --fullscreen  -f  Start in full screen mode\n"
 				"   --blur        -B  Enable GL bilinear filter\n"
 				"   --no-blur         Disable GL bilinear filtering\n"
+				"   --op-spec         Render the OP ahead on a worker thread\n"
+				"   --op-spec-verify  Render the OP ahead, and compare with serial\n"
+				"   --no-op-spec      Render the OP on the emulation thread only\n"
+				"   --beam-skip       Skip the 68K loops polling the beam position\n"
+				"   --no-beam-skip    Run the 68K beam polling loops (default)\n"
+				"   --bus             Share the main bus between the bus masters\n"
+				"   --no-bus          Run the bus masters without bus contention (default)\n"
+				"   --asi <pty|path>  Serial line on a pseudo-terminal or a UNIX socket\n"
 				"   --log         -l  Create and use log file\n"
 				"   --no-log          Do not use log file (default)\n"
 				"   --help        -h  Show this message\n"
@@ -212,6 +272,13 @@ bool ParseCommandLine(int argc, char * argv[])
 				"   --es-ui           Erase UI settings only\n"
 				"   --es-alpine       Erase alpine mode settings only\n"
 				"   --es-debugger     Erase debugger mode settings only\n"
+				"   --script <file>   Run the Lua script hooked on the emulation\n"
+				"   --headless        Run the file without GUI, video and audio\n"
+				"   --frames <n>      Number of frames to run in headless mode (60)\n"
+				"   --batch <file>    Run the jobs file in forked headless machines\n"
+				"   --warmup <n>      Frames run before the batch jobs are forked (0)\n"
+				"   --workers <n>     Number of batch jobs run at the same time (1)\n"
+				"   --cold            Start a new process per batch job, to compare\n"
 				"   --please-dont-kill-my-computer\n"
 				"                 -z  Run Virtual Jaguar without \"snow\"\n"
 				"\n"
@@ -289,6 +356,68 @@ bool ParseCommandLine(int argc, char * argv[])
 			vjs.DRAM_size = 0x800000;
 		}
 
+		// Script
+		if ((strcmp(argv[i], "--script") == 0) && ((i + 1) < argc))
+		{
+			scriptFilename = argv[++i];
+			continue;
+		}
+
+		// Serial line host end, set with the options
+		if ((strcmp(argv[i], "--asi") == 0) && ((i + 1) < argc))
+		{
+			i++;
+			continue;
+		}
+
+		// Headless runner
+		if (strcmp(argv[i], "--headless") == 0)
+		{
+			headless = true;
+		}
+
+		// Number of frames to run in headless mode
+		if ((strcmp(argv[i], "--frames") == 0) && ((i + 1) < argc))
+		{
+			headlessFrames = (uint32_t)atoi(argv[++i]);
+			continue;
+		}
+
+		// Batch runner, it runs headless
+		if ((strcmp(argv[i], "--batch") == 0) && ((i + 1) < argc))
+		{
+			batchFilename = argv[++i];
+			headless = true;
+			continue;
+		}
+
+		// Frames run before the batch jobs
+		if ((strcmp(argv[i], "--warmup") == 0) && ((i + 1) < argc))
+		{
+			batchWarmupFrames = (uint32_t)atoi(argv[++i]);
+			continue;
+		}
+
+		// Batch jobs run at the same time
+		if ((strcmp(argv[i], "--workers") == 0) && ((i + 1) < argc))
+		{
+			batchWorkers = (uint32_t)atoi(argv[++i]);
+			continue;
+		}
+
+		// Batch jobs started in new processes
+		if (strcmp(argv[i], "--cold") == 0)
+		{
+			batchCold = true;
+		}
+
+		// Cold started batch job (<job>:<results pipe>), given by the batch runner
+		if ((strcmp(argv[i], "--batch-job") == 0) && ((i + 1) < argc))
+		{
+			batchJob = argv[++i];
+			continue;
+		}
+
 		// Check for filename
 		if (argv[i][0] != '-')
 		{
@@ -377,6 +506,50 @@ void ParseOptions(int argc, char * argv[])
 		{
 			vjs.glFilter = 0;
 		}
+
+		// Object Processor speculation
+		if (strcmp(argv[i], "--op-spec") == 0)
+		{
+			vjs.opSpeculation = OPSPEC_ON;
+		}
+
+		if (strcmp(argv[i], "--op-spec-verify") == 0)
+		{
+			vjs.opSpeculation = OPSPEC_VERIFY;
+		}
+
+		if (strcmp(argv[i], "--no-op-spec") == 0)
+		{
+			vjs.opSpeculation = OPSPEC_OFF;
+		}
+
+		// 68K beam polling loops skip
+		if (strcmp(argv[i], "--beam-skip") == 0)
+		{
+			vjs.beamPollSkip = true;
+		}
+
+		if (strcmp(argv[i], "--no-beam-skip") == 0)
+		{
+			vjs.beamPollSkip = false;
+		}
+
+		// Main bus arbitration
+		if (strcmp(argv[i], "--bus") == 0)
+		{
+			vjs.busArbitration = true;
+		}
+
+		if (strcmp(argv[i], "--no-bus") == 0)
+		{
+			vjs.busArbitration = false;
+		}
+
+		// Serial line host end
+		if ((strcmp(argv[i], "--asi") == 0) && ((i + 1) < argc))
+		{
+			strncpy(vjs.asiHost, argv[++i], sizeof(vjs.asiHost) - 1);
+		}
 	}
 }
 
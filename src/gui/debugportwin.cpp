@@ -0,0 +1,88 @@
+//
+// debugportwin.cpp - Guest debug port output
+//
+// by Jean-Paul Mari
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+// STILL TO DO:
+//
+
+#include "debugportwin.h"
+#include "debugport.h"
+
+
+// 
+DebugPortWindow::DebugPortWindow(QWidget * parent/*= 0*/) : QWidget(parent, Qt::Dialog),
+layout(new QVBoxLayout),
+text(new QPlainTextEdit),
+clear(new QPushButton(tr("Clear"))),
+status(new QLabel),
+dropped(0)
+{
+	setWindowTitle(tr("Debug port output"));
+
+	QFont fixedFont("Lucida Console", 8, QFont::Normal);
+	fixedFont.setStyleHint(QFont::TypeWriter);
+	text->setFont(fixedFont);
+	text->setReadOnly(true);
+	text->setMaximumBlockCount(DEBUGPORTWIN_LINES_MAX);
+	setLayout(layout);
+
+	layout->addWidget(text);
+	layout->addWidget(status);
+	layout->addWidget(clear);
+
+	connect(clear, SIGNAL(clicked()), this, SLOT(Clear()));
+}
+
+
+//
+void DebugPortWindow::Clear(void)
+{
+	text->clear();
+}
+
+
+// Drain the debug port events, even if the window is hidden
+// The assertions are displayed in red
+void DebugPortWindow::RefreshContents(void)
+{
+	DebugPortEvent event;
+	char line[256];
+
+	while (DebugPortRead(&event))
+	{
+		DebugPortFormat(&event, line, sizeof(line));
+
+		if (event.type == DEBUGPORT_ASSERTION)
+		{
+			text->appendHtml(QString("<font color=\"red\"><b>%1</b></font>").arg(QString(line).toHtmlEscaped()));
+		}
+		else
+		{
+			text->appendPlainText(QString(line));
+		}
+	}
+
+	if (DebugPortDropped() != dropped)
+	{
+		dropped = DebugPortDropped();
+		status->setText(QString(tr("%1 events dropped")).arg(dropped));
+	}
+}
+
+
+// 
+void DebugPortWindow::keyPressEvent(QKeyEvent * e)
+{
+	if (e->key() == Qt::Key_Escape)
+	{
+		hide();
+	}
+}
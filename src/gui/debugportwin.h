@@ -0,0 +1,38 @@
+//
+// debugportwin.h: Guest debug port output
+//
+// by Jean-Paul Mari
+//
+
+#ifndef __DEBUGPORTWIN_H__
+#define __DEBUGPORTWIN_H__
+
+#include <QtWidgets/QtWidgets>
+#include <stdint.h>
+
+// Lines kept in the output
+#define DEBUGPORTWIN_LINES_MAX	10000
+
+class DebugPortWindow : public QWidget
+{
+	Q_OBJECT
+
+	public:
+		DebugPortWindow(QWidget * parent = 0);
+		void RefreshContents(void);
+
+	private slots:
+		void Clear(void);
+
+	protected:
+		void keyPressEvent(QKeyEvent *);
+
+	private:
+		QVBoxLayout * layout;
+		QPlainTextEdit * text;
+		QPushButton * clear;
+		QLabel * status;
+		uint32_t dropped;
+};
+
+#endif	// __DEBUGPORTWIN_H__
@@ -8,6 +8,8 @@
 // WHO  WHEN        WHAT
 // ---  ----------  ------------------------------------------------------------
 // JPM  March/2022  Created this file based from the alpinetab source code
+// JPM   Oct./2026  Added the guest memory sanitizer
+// JPM   Oct./2026  Added the guest debug port
 //
 
 #include "exceptionstab.h"
@@ -58,6 +60,8 @@ ExceptionsTab::ExceptionsTab(QWidget * parent/*= 0*/): QWidget(parent)
 	writeROM = new QCheckBox(tr("Allow writes to cartridge ROM"));
 	M68KExceptionCatch = new QCheckBox(tr("Allow M68000 exception catch"));
 	WriteUnknownMemoryLocation = new QCheckBox(tr("Allow writes to unknown memory location"));
+	GuestSanitizer = new QCheckBox(tr("Sanitize the guest memory writes (heap && stack, needs the allocator symbols)"));
+	GuestDebugPort = new QCheckBox(tr("Guest debug port at $FFFF00 (text, markers && assertions)"));
 //	useDSP             = new QCheckBox(tr("Enable DSP"));
 //	useHostAudio       = new QCheckBox(tr("Enable audio playback"));
 //	useUnknownSoftware = new QCheckBox(tr("Allow unknown software in file chooser"));
@@ -67,6 +71,8 @@ ExceptionsTab::ExceptionsTab(QWidget * parent/*= 0*/): QWidget(parent)
 	layout4->addWidget(writeROM);
 	layout4->addWidget(M68KExceptionCatch);
 	layout4->addWidget(WriteUnknownMemoryLocation);
+	layout4->addWidget(GuestSanitizer);
+	layout4->addWidget(GuestDebugPort);
 //	layout4->addWidget(useDSP);
 //	layout4->addWidget(useHostAudio);
 //	layout4->addWidget(useUnknownSoftware);
@@ -91,6 +97,8 @@ void ExceptionsTab::GetSettings(void)
 	writeROM->setChecked(vjs.allowWritesToROM);
 	M68KExceptionCatch->setChecked(vjs.allowM68KExceptionCatch);
 	WriteUnknownMemoryLocation->setChecked(vjs.allowWritesToUnknownLocation);
+	GuestSanitizer->setChecked(vjs.allowGuestSanitizer);
+	GuestDebugPort->setChecked(vjs.allowDebugPort);
 }
 
 
@@ -105,6 +113,8 @@ void ExceptionsTab::SetSettings(void)
 	vjs.allowWritesToROM = writeROM->isChecked();
 	vjs.allowM68KExceptionCatch = M68KExceptionCatch->isChecked();
 	vjs.allowWritesToUnknownLocation = WriteUnknownMemoryLocation->isChecked();
+	vjs.allowGuestSanitizer = GuestSanitizer->isChecked();
+	vjs.allowDebugPort = GuestDebugPort->isChecked();
 }
 
 
@@ -25,6 +25,8 @@ class ExceptionsTab: public QWidget
 		QCheckBox *writeROM;
 		QCheckBox *M68KExceptionCatch;
 		QCheckBox *WriteUnknownMemoryLocation;
+		QCheckBox *GuestSanitizer;
+		QCheckBox *GuestDebugPort;
 //		QCheckBox *useDSP;
 //		QCheckBox *useHostAudio;
 //		QCheckBox *useUnknownSoftware;
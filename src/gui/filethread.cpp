@@ -16,14 +16,19 @@
 //                  to follow the flow of the logic
 //
 // JPM  06/06/2016  Visual Studio support
+// JPM   Oct./2026  Host tuning of the worker thread
+// JPM   Oct./2026  ZIP file opened once for the software and the label
+// JPM   Oct./2026  ZIP file kept in the archives cache for the software loading
 
 #include "filethread.h"
 
 #include "crc32.h"
 #include "file.h"
 #include "filedb.h"
+#include "hosttuning.h"
 //#include "memory.h"
 #include "settings.h"
+#include "unzip.h"
 
 #define VERBOSE_LOGGING
 
@@ -69,6 +74,10 @@ The future is NOW! :-)
 //
 void FileThread::run(void)
 {
+	HostTuningApplyThread(HOST_THREAD_WORKER);
+
+	// Archives kept from a previous scan are not the ones of this scan
+	ZIPFlushCache();
 	QDir romDir(vjs.ROMPath);
 	QFileInfoList list = romDir.entryInfoList();
 
@@ -104,16 +113,27 @@ void FileThread::HandleFile(QFileInfo fileInfo)
 		? true : false);
 	uint32_t fileSize = 0;
 	uint8_t * buffer = NULL;
+	ZipArchive * zip = NULL;
 
 	if (haveZIPFile)
 	{
 		// ZIP files are special: They contain more than just the software now... ;-)
 		// So now we fish around inside them to pull out the stuff we want.
-		// Probably also need more stringent error checking as well... :-O
-		fileSize = GetFileFromZIP(fileInfo.filePath().toUtf8(), FT_SOFTWARE, buffer);
+		// The archive is opened once, and its index is used for all the lookups
+		// It stays in the archives cache under the path given to the picker, so
+		// it is not mapped & indexed again when the software is loaded
+		zip = ZIPOpen(fileInfo.canonicalFilePath().toUtf8());
+
+		if (zip == NULL)
+			return;
+
+		fileSize = GetFileFromZIP(zip, FT_SOFTWARE, buffer);
 
 		if (fileSize == 0)
+		{
+			ZIPClose(zip);
 			return;
+		}
 	}
 	else
 	{
@@ -154,10 +174,16 @@ void FileThread::HandleFile(QFileInfo fileInfo)
 	{
 		// If we allow unknown software, we pass the (-1) index on, otherwise...
 		if (!allowUnknownSoftware)
+		{
+			ZIPClose(zip);
 			return;								// CRC wasn't found, so bail...
+		}
 	}
 	else if ((index != 0xFFFFFFFF) && romList[index].flags & FF_BIOS)
+	{
+		ZIPClose(zip);
 		return;
+	}
 
 //Here's a little problem. When we create the image here and pass it off to FilePicker,
 //we can clobber this image before we have a chance to copy it out in the FilePicker function
@@ -168,7 +194,7 @@ void FileThread::HandleFile(QFileInfo fileInfo)
 	// See if we can fish out a label. :-)
 	if (haveZIPFile)
 	{
-		uint32_t size = GetFileFromZIP(fileInfo.filePath().toUtf8(), FT_LABEL, buffer);
+		uint32_t size = GetFileFromZIP(zip, FT_LABEL, buffer);
 //printf("FT: Label size = %u bytes.\n", size);
 
 		if (size > 0)
@@ -181,6 +207,7 @@ void FileThread::HandleFile(QFileInfo fileInfo)
 			delete[] buffer;
 		}
 //printf("FileThread: Attempted to load image. Size: %u x %u...\n", img.width(), img.height());
+		ZIPClose(zip);
 	}
 
 //	emit FoundAFile2(index, fileInfo.canonicalFilePath(), img, fileSize);
@@ -17,6 +17,9 @@
 // JLH  06/23/2011  Created this file
 // JPM  Sept./2018  Added a Models & Bios tab, slashes / backslashes formatting, and screenshot path
 // JPM  March/2022  Added and slightly modified the save state patch from PvtLewis
+// JPM   Oct./2026  Added the Object Processor speculation
+// JPM   Oct./2026  Added the 68K beam polling loops skip
+// JPM   Oct./2026  Added the main bus arbitration
 //
 
 // STILL TO DO:
@@ -85,6 +88,9 @@ GeneralTab::GeneralTab(QWidget * parent/*= 0*/): QWidget(parent)
 //	useHostAudio       = new QCheckBox(tr("Enable audio playback (requires DSP)"));
 	useUnknownSoftware = new QCheckBox(tr("Show all files in file chooser"));
 	useFastBlitter     = new QCheckBox(tr("Use fast blitter"));
+	useOPSpeculation   = new QCheckBox(tr("Render the Object Processor ahead on a worker thread"));
+	useBeamPollSkip    = new QCheckBox(tr("Skip the 68K beam polling loops"));
+	useBusArbitration  = new QCheckBox(tr("Share the main bus between the bus masters"));
 
 #ifndef NEWMODELSBIOSHANDLER
 	layout4->addWidget(useBIOS);
@@ -95,6 +101,9 @@ GeneralTab::GeneralTab(QWidget * parent/*= 0*/): QWidget(parent)
 //	layout4->addWidget(useHostAudio);
 	layout4->addWidget(useUnknownSoftware);
 	layout4->addWidget(useFastBlitter);
+	layout4->addWidget(useOPSpeculation);
+	layout4->addWidget(useBeamPollSkip);
+	layout4->addWidget(useBusArbitration);
 
 	setLayout(layout4);
 }
@@ -123,6 +132,9 @@ void GeneralTab::GetSettings(void)
 	useFullScreen->setChecked(vjs.fullscreen);
 	//	generalTab->useHostAudio->setChecked(vjs.audioEnabled);
 	useFastBlitter->setChecked(vjs.useFastBlitter);
+	useOPSpeculation->setChecked(vjs.opSpeculation != OPSPEC_OFF);
+	useBeamPollSkip->setChecked(vjs.beamPollSkip);
+	useBusArbitration->setChecked(vjs.busArbitration);
 }
 
 
@@ -144,6 +156,10 @@ void GeneralTab::SetSettings(void)
 	vjs.fullscreen = useFullScreen->isChecked();
 	//	vjs.audioEnabled   = generalTab->useHostAudio->isChecked();
 	vjs.useFastBlitter = useFastBlitter->isChecked();
+	// The verify mode, from the command line, is kept
+	vjs.opSpeculation = (!useOPSpeculation->isChecked() ? OPSPEC_OFF : (vjs.opSpeculation != OPSPEC_OFF ? vjs.opSpeculation : OPSPEC_ON));
+	vjs.beamPollSkip = useBeamPollSkip->isChecked();
+	vjs.busArbitration = useBusArbitration->isChecked();
 }
 
 
@@ -32,6 +32,9 @@ class GeneralTab: public QWidget
 		QCheckBox *useFullScreen;
 		QCheckBox *useUnknownSoftware;
 		QCheckBox *useFastBlitter;
+		QCheckBox *useOPSpeculation;
+		QCheckBox *useBeamPollSkip;
+		QCheckBox *useBusArbitration;
 };
 
 #endif	// __GENERALTAB_H__
@@ -34,6 +34,20 @@
 // JPM   Apr./2021  Handle number of M68K cycles used in tracing mode, added video output display in a window
 // JPM    May/2021  Check missing dll for the tests pattern
 // JPM  March/2022  Added cygdrive directory removal setting, a ROM cartridge browser, a GPU/DSP memory browser, added and slightly modified the save state patch from PvtLewis
+// JPM   Oct./2026  Added host tuning settings, achieved settings and frame time percentiles in the status bar
+// JPM   Oct./2026  Replaced the FPS ring buffer by the frame timing instrumentation, added the frame timing overlay and CSV dump
+// JPM   Oct./2026  Added the opcode histograms dump in the debugger mode (OPCODE_STATS)
+// JPM   Oct./2026  Added the reverse debugger recording, reverse steps and reverse continue
+// JPM   Oct./2026  Added the Object Processor speculation setting
+// JPM   Oct./2026  Added the 68K beam polling loops skip setting
+// JPM   Oct./2026  Added the guest memory sanitizer setup from the allocator symbols, and its report
+// JPM   Oct./2026  Locals window reset along the debugger windows
+// JPM   Oct./2026  Call stack window reset along the debugger windows
+// JPM   Oct./2026  Added the guest debug port output window, and its setting
+// JPM   Oct./2026  Data watchpoints hits logged, and displayed at their halt
+// JPM   Oct./2026  Main bus arbitration setting
+// JPM   Oct./2026  Recorded or plain frame run by an if/else
+// JPM   Oct./2026  Sanitizer shadow names shared with the core
 //
 
 // FIXED:
@@ -70,11 +84,18 @@
 #include "gamepad.h"
 #include "generaltab.h"
 #include "glwidget.h"
+#include "frametiming.h"
+#include "opcodestats.h"
 #include "help.h"
+#include "hosttuning.h"
 #include "profile.h"
+#include "reverse.h"
+#include "sanitizer.h"
 #include "settings.h"
 #include "version.h"
+#include "watchpoint.h"
 #include "emustatus.h"
+#include "debugportwin.h"
 #include "debug/cpubrowser.h"
 #include "debug/m68kdasmbrowser.h"
 #include "debug/memorybrowser.h"
@@ -150,11 +171,8 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 	for(int i=0; i<8; i++)
 		keyHeld[i] = false;
 
-	// FPS management
-	for(int i=0; i<RING_BUFFER_SIZE; i++)
-		ringBuffer[i] = 0;
-
-	ringBufferPointer = RING_BUFFER_SIZE - 1;
+	// Frame timing management
+	FrameTimingReset();
 
 	// main window
 	//if (vjs.softTypeDebugger)
@@ -197,6 +215,7 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 	helpWin = new HelpWindow(this);
 	filePickWin = new FilePickerWindow(this);
 	emuStatusWin = new EmuStatusWindow(this);
+	debugPortWin = new DebugPortWindow(this);
 	
 	// windows alpine mode features
 	romcartBrowseWin = new ROMCartBrowserWindow(this);
@@ -385,6 +404,19 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 	emustatusAct->setShortcutContext(Qt::ApplicationShortcut);
 	connect(emustatusAct, SIGNAL(triggered()), this, SLOT(ShowEmuStatusWin()));
 
+	debugPortAct = new QAction(QIcon(":/res/status.png"), tr("Debug &Port Output"), this);
+	debugPortAct->setStatusTip(tr("Guest debug port output"));
+	connect(debugPortAct, SIGNAL(triggered()), this, SLOT(ShowDebugPortWin()));
+
+	// Frame timing actions
+	frameTimingOverlayAct = new QAction(tr("Frame &Timing Overlay"), this);
+	frameTimingOverlayAct->setStatusTip(tr("Display the frame timing graph over the screen"));
+	frameTimingOverlayAct->setCheckable(true);
+	connect(frameTimingOverlayAct, SIGNAL(triggered()), this, SLOT(ToggleFrameTimingOverlay()));
+	frameTimingDumpAct = new QAction(tr("&Dump Frame Timings"), this);
+	frameTimingDumpAct->setStatusTip(tr("Dump the last frames timing in a CSV file in the screenshots folder"));
+	connect(frameTimingDumpAct, SIGNAL(triggered()), this, SLOT(DumpFrameTimings()));
+
 	// Use CD action
 	useCDAct = new QAction(QIcon(":/res/compact-disc.png"), tr("&Use CD Unit"), this);
 	useCDAct->setStatusTip(tr("Use Jaguar Virtual CD unit"));
@@ -432,6 +464,21 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 		traceStepIntoAct->setDisabled(true);
 		connect(traceStepIntoAct, SIGNAL(triggered()), this, SLOT(DebuggerTraceStepInto()));
 
+		// Reverse debugger
+		reverseRecordAct = new QAction(QIcon(""), tr("Reverse &Recording"), this);
+		reverseRecordAct->setStatusTip(tr("Record the emulation for the reverse steps (the sound is not played)"));
+		reverseRecordAct->setCheckable(true);
+		connect(reverseRecordAct, SIGNAL(triggered()), this, SLOT(ToggleReverseRecording()));
+		reverseStepIntoAct = new QAction(QIcon(""), tr("Reverse Step &Into"), this);
+		reverseStepIntoAct->setDisabled(true);
+		connect(reverseStepIntoAct, SIGNAL(triggered()), this, SLOT(DebuggerReverseStepInto()));
+		reverseStepOverAct = new QAction(QIcon(""), tr("Reverse Step O&ver"), this);
+		reverseStepOverAct->setDisabled(true);
+		connect(reverseStepOverAct, SIGNAL(triggered()), this, SLOT(DebuggerReverseStepOver()));
+		reverseContinueAct = new QAction(QIcon(""), tr("Reverse &Continue"), this);
+		reverseContinueAct->setDisabled(true);
+		connect(reverseContinueAct, SIGNAL(triggered()), this, SLOT(DebuggerReverseContinue()));
+
 		// Function breakpoint
 		newFunctionBreakpointAct = new QAction(QIcon(""), tr("&Function Breakpoint"), this);
 		newFunctionBreakpointAct->setShortcut(QKeySequence(tr(vjs.KBContent[KBFUNCTIONBREAKPOINT].KBSettingValue)));
@@ -451,6 +498,13 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 		saveDumpAsAct->setDisabled(false);
 		connect(saveDumpAsAct, SIGNAL(triggered()), this, SLOT(ShowSaveDumpAsWin()));
 
+#ifdef OPCODE_STATS
+		// Opcode histograms dump
+		opcodeStatsDumpAct = new QAction(tr("Dump &Opcode Statistics"), this);
+		opcodeStatsDumpAct->setStatusTip(tr("Dump the 68K, GPU & DSP opcode histograms in CSV files and a sample profile in the screenshots folder"));
+		connect(opcodeStatsDumpAct, SIGNAL(triggered()), this, SLOT(DumpOpcodeStats()));
+#endif
+
 		VideoOutputAct = new QAction(tr("Output Video"), this);
 		VideoOutputAct->setStatusTip(tr("Shows the output video window"));
 		connect(VideoOutputAct, SIGNAL(triggered()), this, SLOT(ShowVideoOutputWin()));
@@ -578,6 +632,9 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 	fileMenu->addAction(useCDAct);
 	fileMenu->addAction(configAct);
 	fileMenu->addAction(emustatusAct);
+	fileMenu->addAction(debugPortAct);
+	fileMenu->addAction(frameTimingOverlayAct);
+	fileMenu->addAction(frameTimingDumpAct);
 	fileMenu->addSeparator();
 	fileMenu->addAction(quitAppAct);
 
@@ -643,12 +700,20 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 			debugMenu->addAction(traceStepIntoAct);
 			debugMenu->addAction(traceStepOverAct);
 			debugMenu->addSeparator();
+			debugMenu->addAction(reverseRecordAct);
+			debugMenu->addAction(reverseStepIntoAct);
+			debugMenu->addAction(reverseStepOverAct);
+			debugMenu->addAction(reverseContinueAct);
+			debugMenu->addSeparator();
 			debugNewBreakpointMenu = debugMenu->addMenu(tr("&New Breakpoint"));
 			debugNewBreakpointMenu->addAction(newFunctionBreakpointAct);
 			debugMenu->addAction(deleteAllBreakpointsAct);
 			debugMenu->addAction(disableAllBreakpointsAct);
 			debugMenu->addSeparator();
 			debugMenu->addAction(saveDumpAsAct);
+#ifdef OPCODE_STATS
+			debugMenu->addAction(opcodeStatsDumpAct);
+#endif
 #if 0
 			debugMenu->addSeparator();
 			debugMenu->addAction(DasmAct);
@@ -921,6 +986,8 @@ MainWin::MainWin(bool autoRun): running(true), powerButtonOn(false),
 	jaguarCartInserted = true;
 	WriteLog("Virtual Jaguar %s Rx (Last full build was on %s %s)\n", VJ_RELEASE_VERSION, __DATE__, __TIME__);
 	WriteLog("VJ: Initializing jaguar subsystem...\n");
+	// The emulation runs in the main thread
+	HostTuningApplyThread(HOST_THREAD_EMULATION);
 	JaguarInit();
 
 #ifndef NEWMODELSBIOSHANDLER
@@ -1005,6 +1072,7 @@ void MainWin::SyncUI(void)
 	// Set toolbar buttons/menus based on settings read in (sync the UI)...
 	// (Really, this is to sync command line options passed in)
 	blurAct->setChecked(vjs.glFilter);
+	frameTimingOverlayAct->setChecked(vjs.frameTimingOverlay);
 	x1Act->setChecked(zoomLevel == 1);
 	x2Act->setChecked(zoomLevel == 2);
 	x3Act->setChecked(zoomLevel == 3);
@@ -1166,10 +1234,16 @@ void MainWin::HandleKeys(QKeyEvent * e, bool state)
 	for(int i=BUTTON_FIRST; i<=BUTTON_LAST; i++)
 	{
 		if (e->key() == (int)vjs.p1KeyBindings[i])
+		{
 			joypad0Buttons[i] = (state ? 0x01 : 0x00);
+			FrameTimingInputEvent();
+		}
 
 		if (e->key() == (int)vjs.p2KeyBindings[i])
+		{
 			joypad1Buttons[i] = (state ? 0x01 : 0x00);
+			FrameTimingInputEvent();
+		}
 	}
 }
 
@@ -1183,11 +1257,17 @@ void MainWin::HandleGamepads(void)
 
 	for(int i=BUTTON_FIRST; i<=BUTTON_LAST; i++)
 	{
+		uint8_t p0 = joypad0Buttons[i], p1 = joypad1Buttons[i];
+
 		if (vjs.p1KeyBindings[i] & (JOY_BUTTON | JOY_HAT | JOY_AXIS))
 			joypad0Buttons[i] = (Gamepad::GetState(gamepadIDSlot1, vjs.p1KeyBindings[i]) ? 0x01 : 0x00);
 
 		if (vjs.p2KeyBindings[i] & (JOY_BUTTON | JOY_HAT | JOY_AXIS))
 			joypad1Buttons[i] = (Gamepad::GetState(gamepadIDSlot2, vjs.p2KeyBindings[i]) ? 0x01 : 0x00);
+
+		// Input to display latency
+		if ((joypad0Buttons[i] != p0) || (joypad1Buttons[i] != p1))
+			FrameTimingInputEvent();
 	}
 }
 
@@ -1319,8 +1399,19 @@ static uint32_t ntscTickCount;
 	else
 	{
 		// Otherwise, run the Jaguar simulation
+		FrameTimingMark(FT_MARK_START);
 		HandleGamepads();
-		JaguarExecuteNew();
+
+		if (ReverseIsRecording())
+		{
+			ReverseExecuteFrame();
+		}
+		else
+		{
+			JaguarExecuteNew();
+		}
+
+		FrameTimingMark(FT_MARK_EMULATED);
 		//if (!vjs.softTypeDebugger)
 			videoWidget->HandleMouseHiding();
 
@@ -1344,39 +1435,49 @@ static uint32_t refresh = 0;
 		}
 	}
 
+	// Frame timing graph over the screen
+	if (!showUntunedTankCircuit && vjs.frameTimingOverlay)
+		FrameTimingDrawGraph(videoWidget->buffer, videoWidget->textureWidth, TOMGetVideoModeWidth(), videoWidget->rasterHeight);
+
 	//if (!vjs.softTypeDebugger)
 		videoWidget->updateGL();
 		//vjs.softTypeDebugger ? VideoOutputWin->RefreshContents(videoWidget) : NULL;
 
-	// FPS handling
-	// Approach: We use a ring buffer to store times (in ms) over a given
-	// amount of frames, then sum them to figure out the FPS.
-	uint32_t timestamp = SDL_GetTicks();
-	// This assumes the ring buffer size is a power of 2
-//	ringBufferPointer = (ringBufferPointer + 1) & (RING_BUFFER_SIZE - 1);
-	// Doing it this way is better. Ring buffer size can be arbitrary then.
-	ringBufferPointer = (ringBufferPointer + 1) % RING_BUFFER_SIZE;
-	ringBuffer[ringBufferPointer] = timestamp - oldTimestamp;
-	uint32_t elapsedTime = 0;
-
-	for(uint32_t i=0; i<RING_BUFFER_SIZE; i++)
-		elapsedTime += ringBuffer[i];
-
-	// elapsedTime must be non-zero
-	if (elapsedTime == 0)
-		elapsedTime = 1;
+	// Frame timing handling
+	// Approach: The frame steps are marked with a nanoseconds clock, and the
+	// measures go in histograms to get the percentiles.
+	if (!showUntunedTankCircuit)
+		FrameTimingMark(FT_MARK_DISPLAYED);
 
 	// This is in frames per 10 seconds, so we can have 1 decimal
-	uint32_t framesPerSecond = (uint32_t)(((float)RING_BUFFER_SIZE / (float)elapsedTime) * 10000.0);
+	uint32_t framesPerSecond = FrameTimingFPS();
 	uint32_t fpsIntegerPart = framesPerSecond / 10;
 	uint32_t fpsDecimalPart = framesPerSecond % 10;
 	// If this is updated too frequently to be useful, we can throttle it down
 	// so that it only updates every 10th frame or so
-	statusBar()->showMessage(QString("%1.%2 FPS").arg(fpsIntegerPart).arg(fpsDecimalPart));
-	oldTimestamp = timestamp;
+	QString status = QString("%1.%2 FPS | frame p50/p95/p99 %3/%4/%5 ms | emu p99 %6 ms | input latency p50 %7 ms").arg(fpsIntegerPart).arg(fpsDecimalPart)
+		.arg(FrameTimingPercentile(FT_FRAME, 50) / 1000000.0, 0, 'f', 2).arg(FrameTimingPercentile(FT_FRAME, 95) / 1000000.0, 0, 'f', 2).arg(FrameTimingPercentile(FT_FRAME, 99) / 1000000.0, 0, 'f', 2)
+		.arg(FrameTimingPercentile(FT_EMULATION, 99) / 1000000.0, 0, 'f', 2).arg(FrameTimingPercentile(FT_LATENCY, 50) / 1000000.0, 0, 'f', 2);
+
+	// Achieved settings on tuned hosts
+	if (HostTuningIsActive())
+		status += QString(" | %1").arg(HostTuningGetStatus());
+
+	statusBar()->showMessage(status);
+
+	// The debug port is drained even with its window hidden
+	debugPortWin->RefreshContents();
 
 	if (M68KDebugHaltStatus())
+	{
 		ToggleRunState();
+		ShowSanitizerReport();
+		ShowWatchpointHits(true);
+	}
+	else
+	{
+		ShowWatchpointHits(false);
+	}
 }
 
 
@@ -1444,11 +1545,13 @@ void MainWin::TogglePowerState(void)
 
 		WriteLog("GUI: Resetting Jaguar...\n");
 		JaguarReset();
+		FrameTimingReset();
 		DebuggerReset();
 		CommonReset();
 		DebuggerResetWindows();
 		CommonResetWindows();
-		DACPauseAudioThread(false);
+		// The DSP is run along the frames during the reverse debugger recording
+		DACPauseAudioThread(ReverseIsRecording());
 	}
 }
 
@@ -1470,6 +1573,9 @@ void MainWin::ToggleRunState(void)
 		{
 			traceStepIntoAct->setDisabled(false);
 			traceStepOverAct->setDisabled(false);
+			reverseStepIntoAct->setDisabled(!ReverseIsRecording());
+			reverseStepOverAct->setDisabled(!ReverseIsRecording());
+			reverseContinueAct->setDisabled(!ReverseIsRecording());
 			restartAct->setDisabled(false);
 			m68kDasmWin->Use68KPCAddress();
 			GPUDasmWin->UseGPUPCAddress();
@@ -1506,6 +1612,9 @@ void MainWin::ToggleRunState(void)
 		{
 			traceStepIntoAct->setDisabled(true);
 			traceStepOverAct->setDisabled(true);
+			reverseStepIntoAct->setDisabled(true);
+			reverseStepOverAct->setDisabled(true);
+			reverseContinueAct->setDisabled(true);
 			restartAct->setDisabled(true);
 			BreakpointsWin->RefreshContents();
 		}
@@ -1515,7 +1624,7 @@ void MainWin::ToggleRunState(void)
 
 	emuStatusWin->ResetM68KCycles();
 	// Pause/unpause any running/non-running threads...
-	DACPauseAudioThread(!running);
+	DACPauseAudioThread(!running || ReverseIsRecording());
 }
 
 
@@ -1854,6 +1963,7 @@ void MainWin::LoadSoftware(QString file)
 	// We have to load our software *after* the Jaguar RESET
 	cartridgeLoaded = JaguarLoadFile(file.toUtf8().data());
 	SET32(jaguarMainRAM, 0, vjs.DRAM_size);						// Set stack in the M68000's Reset SP
+	SetupSanitizer();
 
 	// This is icky because we've already done it
 // it gets worse :-P
@@ -1893,6 +2003,90 @@ void MainWin::LoadSoftware(QString file)
 }
 
 
+// Start the guest memory sanitizer on the allocator found in the symbols
+// Same allocator as the heap allocation window (__HeapBase)
+void MainWin::SetupSanitizer(void)
+{
+	static const char * entryName[SANITIZER_ENTRIES] = { "malloc", "calloc", "realloc", "free" };
+	uint32_t entry[SANITIZER_ENTRIES];
+	size_t heapBase;
+
+	if (!vjs.allowGuestSanitizer || !DBGManager_GetType() || !(heapBase = DBGManager_GetAdrFromSymbolName((char *)"__HeapBase")))
+	{
+		SanitizerDisable();
+		return;
+	}
+
+	for (uint32_t i = 0; i < SANITIZER_ENTRIES; i++)
+	{
+		entry[i] = (uint32_t)DBGManager_GetAdrFromSymbolName((char *)entryName[i]);
+	}
+
+	SanitizerEnable(entry, (uint32_t)heapBase);
+}
+
+
+// Display the guest memory sanitizer violation, if the halt comes from it
+void MainWin::ShowSanitizerReport(void)
+{
+	SanitizerReport report;
+	QString msg;
+	char * name;
+
+	if (!SanitizerGetReport(&report))
+	{
+		return;
+	}
+
+	msg = QString("%1 write of %2 byte(s) at $%3 (%4 memory)\n").arg(whoName[report.who]).arg(report.size).arg(report.address, 6, 16, QChar('0')).arg(sanitizerShadowName[report.shadow]);
+	msg += (report.pc ? QString("PC: $%1 %2\n").arg(report.pc, 6, 16, QChar('0')).arg((name = DBGManager_GetFunctionName(report.pc)) ? name : "") : QString("PC: (N/A)\n"));
+
+	if (report.allocationFound)
+	{
+		msg += QString("\nAllocation $%1 - $%2 (%3 bytes, %4), allocated from:\n").arg(report.allocation.address, 6, 16, QChar('0')).arg(report.allocation.address + report.allocation.size, 6, 16, QChar('0')).arg(report.allocation.size).arg(report.allocation.live ? "live" : "freed");
+
+		for (uint32_t i = 0; i < report.allocation.depth; i++)
+		{
+			msg += QString("$%1 %2\n").arg(report.allocation.callStack[i], 6, 16, QChar('0')).arg((name = DBGManager_GetFunctionName(report.allocation.callStack[i])) ? name : "");
+		}
+	}
+
+	QMessageBox msgBox;
+	msgBox.setWindowTitle(tr("Memory sanitizer"));
+	msgBox.setText(msg);
+	msgBox.setStandardButtons(QMessageBox::Ok);
+	msgBox.exec();
+}
+
+
+// Log the data watchpoints hits, and display them if they have halted the emulation
+void MainWin::ShowWatchpointHits(bool halted)
+{
+	WatchpointHit hit;
+	QString msg;
+	char line[256];
+	char * name;
+
+	while (WatchpointGetHit(&hit))
+	{
+		WatchpointFormat(&hit, line, sizeof(line));
+		WriteLog("WATCH: %s\n", line);
+		msg += QString("%1 %2\n").arg(line).arg((hit.pc && (name = DBGManager_GetFunctionName(hit.pc))) ? name : "");
+	}
+
+	if (!halted || msg.isEmpty())
+	{
+		return;
+	}
+
+	QMessageBox msgBox;
+	msgBox.setWindowTitle(tr("Data watchpoints"));
+	msgBox.setText(msg);
+	msgBox.setStandardButtons(QMessageBox::Ok);
+	msgBox.exec();
+}
+
+
 void MainWin::ToggleCDUsage(void)
 {
 	CDActive = !CDActive;
@@ -1958,7 +2152,12 @@ void MainWin::ShowSaveDumpAsWin(void)
 // Step Into trace
 void MainWin::DebuggerTraceStepInto(void)
 {
-	if (SourcesWin->isVisible() && SourcesWin->GetTraceStatus())
+	// Step forward in the reverse debugger history
+	if (ReverseIsInHistory())
+	{
+		ReverseStepForward(false);
+	}
+	else if (SourcesWin->isVisible() && SourcesWin->GetTraceStatus())
 	{
 		while (!SourcesWin->CheckChangeLine())
 		{
@@ -1994,6 +2193,7 @@ void MainWin::DebuggerRestart(void)
 	m68k_brk_hitcounts_reset();
 	emuStatusWin->ResetM68KCycles();
 	bpmHitCounts = 0;
+	ReverseReset();
 	DebuggerResetWindows();
 	CommonResetWindows();
 	SourcesWin->Init();
@@ -2009,7 +2209,12 @@ void MainWin::DebuggerRestart(void)
 // Step Over trace
 void MainWin::DebuggerTraceStepOver(void)
 {
-	if (SourcesWin->isVisible() && SourcesWin->GetTraceStatus())
+	// Step forward in the reverse debugger history
+	if (ReverseIsInHistory())
+	{
+		ReverseStepForward(true);
+	}
+	else if (SourcesWin->isVisible() && SourcesWin->GetTraceStatus())
 	{
 		while (!SourcesWin->CheckChangeLine())
 		{
@@ -2031,13 +2236,64 @@ void MainWin::DebuggerTraceStepOver(void)
 }
 
 
+// Reverse Step Into
+void MainWin::DebuggerReverseStepInto(void)
+{
+	ReverseStepInto();
+	videoWidget->updateGL();
+	RefreshWindows();
+}
+
+
+// Reverse Step Over, back to the call of the subroutine just returned from
+void MainWin::DebuggerReverseStepOver(void)
+{
+	ReverseStepOver();
+	videoWidget->updateGL();
+	RefreshWindows();
+}
+
+
+// Reverse Continue, back to the last breakpoint reached
+void MainWin::DebuggerReverseContinue(void)
+{
+	ReverseContinue();
+	videoWidget->updateGL();
+	RefreshWindows();
+}
+
+
+// Start or stop the reverse debugger recording
+// The DSP is run along the recorded frames, the audio thread is kept paused
+void MainWin::ToggleReverseRecording(void)
+{
+	ReverseSetRecording(reverseRecordAct->isChecked());
+	DACPauseAudioThread(!running || ReverseIsRecording());
+
+	if (!running)
+	{
+		reverseStepIntoAct->setDisabled(!ReverseIsRecording());
+		reverseStepOverAct->setDisabled(!ReverseIsRecording());
+		reverseContinueAct->setDisabled(!ReverseIsRecording());
+	}
+}
+
+
 // Advance / Execute for one frame
 void MainWin::FrameAdvance(void)
 {
 //printf("Frame Advance...\n");
 	ToggleRunState();
 	// Execute 1 frame, then exit (only useful in Pause mode)
-	JaguarExecuteNew();
+	if (ReverseIsRecording())
+	{
+		ReverseExecuteFrame();
+	}
+	else
+	{
+		JaguarExecuteNew();
+	}
+
 	//if (!vjs.softTypeDebugger)
 		videoWidget->updateGL();
 		//vjs.softTypeDebugger ? VideoOutputWin->RefreshContents(videoWidget) : NULL;
@@ -2185,6 +2441,13 @@ void MainWin::ShowEmuStatusWin(void)
 }
 
 
+void MainWin::ShowDebugPortWin(void)
+{
+	debugPortWin->show();
+	debugPortWin->RefreshContents();
+}
+
+
 void MainWin::ShowStackBrowserWin(void)
 {
 	stackBrowseWin->show();
@@ -2301,6 +2564,7 @@ void MainWin::ReadSettings(void)
 	vjs.usePipelinedDSP = settings.value("usePipelinedDSP", false).toBool();
 	vjs.useOpenGL = settings.value("useOpenGL", true).toBool();
 	vjs.glFilter = settings.value("glFilterType", 1).toInt();
+	vjs.frameTimingOverlay = settings.value("frameTimingOverlay", false).toBool();
 	vjs.renderType = settings.value("renderType", 0).toInt();
 
 	// read the BIOS & console model settings
@@ -2325,7 +2589,12 @@ void MainWin::ReadSettings(void)
 	vjs.allowWritesToROM = settings.value("writeROM", true).toBool();
 	vjs.allowM68KExceptionCatch = settings.value("M68KExceptionCatch", false).toBool();
 	vjs.allowWritesToUnknownLocation = settings.value("WriteUnknownLocation", true).toBool();
+	vjs.allowGuestSanitizer = settings.value("GuestSanitizer", false).toBool();
+	vjs.allowDebugPort = settings.value("GuestDebugPort", false).toBool();
 	vjs.useFastBlitter = settings.value("useFastBlitter", false).toBool();
+	vjs.opSpeculation = settings.value("opSpeculation", OPSPEC_OFF).toUInt();
+	vjs.beamPollSkip = settings.value("beamPollSkip", false).toBool();
+	vjs.busArbitration = settings.value("busArbitration", false).toBool();
 
 	// read settings from the Debugger mode
 	settings.beginGroup("debugger");
@@ -2347,6 +2616,17 @@ void MainWin::ReadSettings(void)
 	vjs.refresh = settings.value("refresh", 60).toUInt();
 	settings.endGroup();
 
+	// read settings from the host tuning
+	settings.beginGroup("host");
+	vjs.emulationThreadCPU = settings.value("emulationThreadCPU", -1).toInt();
+	vjs.audioThreadCPU = settings.value("audioThreadCPU", -1).toInt();
+	vjs.workerThreadCPU = settings.value("workerThreadCPU", -1).toInt();
+	vjs.emulationThreadPriority = settings.value("emulationThreadPriority", 0).toUInt();
+	vjs.audioThreadPriority = settings.value("audioThreadPriority", 0).toUInt();
+	vjs.useRoundRobinScheduling = settings.value("useRoundRobinScheduling", false).toBool();
+	vjs.hugePagesType = settings.value("hugePagesType", HOST_HUGEPAGES_NONE).toUInt();
+	settings.endGroup();
+
 	// read settings from the Keybindings
 	settings.beginGroup("keybindings");
 	for (i = 0; i < KB_END; i++)
@@ -2458,6 +2738,11 @@ void MainWin::ReadUISettings(void)
 	pos = settings.value("emuStatusWinPos", QPoint(200, 200)).toPoint();
 	emuStatusWin->move(pos);
 	settings.value("emuStatusWinIsVisible", false).toBool() ? ShowEmuStatusWin() : void();
+	pos = settings.value("debugPortWinPos", QPoint(200, 200)).toPoint();
+	debugPortWin->move(pos);
+	settings.value("debugPortWinIsVisible", false).toBool() ? ShowDebugPortWin() : void();
+	size = settings.value("debugPortWinSize", QSize(500, 300)).toSize();
+	debugPortWin->resize(size);
 	
 	// Alpine debug UI information (also needed by the Debugger)
 	if (vjs.hardwareTypeAlpine || vjs.softTypeDebugger)
@@ -2642,6 +2927,7 @@ void MainWin::WriteSettings(void)
 	settings.setValue("usePipelinedDSP", vjs.usePipelinedDSP);
 	settings.setValue("useOpenGL", vjs.useOpenGL);
 	settings.setValue("glFilterType", vjs.glFilter);
+	settings.setValue("frameTimingOverlay", vjs.frameTimingOverlay);
 	settings.setValue("renderType", vjs.renderType);
 	//settings.setValue("JagBootROM", vjs.jagBootPath);
 	//settings.setValue("CDBootROM", vjs.CDBootPath);
@@ -2664,11 +2950,16 @@ void MainWin::WriteSettings(void)
 	settings.setValue("fullscreen", vjs.fullscreen);
 	settings.setValue("showUnknownSoftware", allowUnknownSoftware);
 	settings.setValue("useFastBlitter", vjs.useFastBlitter);
+	settings.setValue("opSpeculation", vjs.opSpeculation);
+	settings.setValue("beamPollSkip", vjs.beamPollSkip);
+	settings.setValue("busArbitration", vjs.busArbitration);
 
 	// write the exceptions settings 
 	settings.setValue("writeROM", vjs.allowWritesToROM);
 	settings.setValue("M68KExceptionCatch", vjs.allowM68KExceptionCatch);
 	settings.setValue("WriteUnknownLocation", vjs.allowWritesToUnknownLocation);
+	settings.setValue("GuestSanitizer", vjs.allowGuestSanitizer);
+	settings.setValue("GuestDebugPort", vjs.allowDebugPort);
 
 	// write settings from the Alpine mode
 	settings.beginGroup("alpine");
@@ -2677,6 +2968,17 @@ void MainWin::WriteSettings(void)
 	settings.setValue("DefaultABS", vjs.absROMPath);
 	settings.endGroup();
 
+	// write settings from the host tuning
+	settings.beginGroup("host");
+	settings.setValue("emulationThreadCPU", vjs.emulationThreadCPU);
+	settings.setValue("audioThreadCPU", vjs.audioThreadCPU);
+	settings.setValue("workerThreadCPU", vjs.workerThreadCPU);
+	settings.setValue("emulationThreadPriority", vjs.emulationThreadPriority);
+	settings.setValue("audioThreadPriority", vjs.audioThreadPriority);
+	settings.setValue("useRoundRobinScheduling", vjs.useRoundRobinScheduling);
+	settings.setValue("hugePagesType", vjs.hugePagesType);
+	settings.endGroup();
+
 	// write settings from the Debugger mode
 	settings.beginGroup("debugger");
 	settings.setValue("DisplayHWLabels", vjs.displayHWlabels);
@@ -2770,6 +3072,9 @@ void MainWin::WriteUISettings(void)
 	// Common UI information
 	settings.setValue("emuStatusWinPos", emuStatusWin->pos());
 	settings.setValue("emuStatusWinIsVisible", emuStatusWin->isVisible());
+	settings.setValue("debugPortWinPos", debugPortWin->pos());
+	settings.setValue("debugPortWinIsVisible", debugPortWin->isVisible());
+	settings.setValue("debugPortWinSize", debugPortWin->size());
 	
 	// Alpine debug UI information (also needed by the Debugger)
 	if (vjs.hardwareTypeAlpine || vjs.softTypeDebugger)
@@ -2908,6 +3213,8 @@ void MainWin::DebuggerResetWindows(void)
 	{
 		FilesrcListWin->Reset();
 		allWatchBrowseWin->Reset();
+		LocalBrowseWin->Reset();
+		CallStackBrowseWin->Reset();
 		heapallocatorBrowseWin->Reset();
 		BreakpointsWin->Reset();
 		CartFilesListWin->Reset();
@@ -2983,3 +3290,45 @@ void MainWin::MakeScreenshot(void)
 	screenshot.save((char *)Text, "JPG", 100);
 }
 
+
+// Toggle the frame timing graph over the screen
+void MainWin::ToggleFrameTimingOverlay(void)
+{
+	vjs.frameTimingOverlay = !vjs.frameTimingOverlay;
+	frameTimingOverlayAct->setChecked(vjs.frameTimingOverlay);
+}
+
+
+// Dump the frame timings in a CSV file, in the screenshots folder
+void MainWin::DumpFrameTimings(void)
+{
+	char Text[256];
+	time_t now = time(0);
+	struct tm tstruct;
+
+	// Create filename
+	tstruct = *localtime(&now);
+	sprintf(Text, "%svj_frametiming_%i%i%i_%i%i%i.csv", vjs.screenshotPath, tstruct.tm_year, tstruct.tm_mon, tstruct.tm_mday, tstruct.tm_hour, tstruct.tm_min, tstruct.tm_sec);
+
+	FrameTimingDumpCSV(Text);
+}
+
+
+// Dump the opcode histograms in CSV files & a sample profile, in the screenshots folder
+void MainWin::DumpOpcodeStats(void)
+{
+	char Text[MAX_PATH + 64];
+	time_t now = time(0);
+	struct tm tstruct;
+
+	// Create the files prefix
+	tstruct = *localtime(&now);
+	sprintf(Text, "%svj_opcodestats_%i%i%i_%i%i%i", vjs.screenshotPath, tstruct.tm_year, tstruct.tm_mon, tstruct.tm_mday, tstruct.tm_hour, tstruct.tm_min, tstruct.tm_sec);
+
+	if (OpcodeStatsDumpCSV(Text))
+	{
+		strcat(Text, ".prof");
+		OpcodeStatsExportProfile(Text);
+	}
+}
+
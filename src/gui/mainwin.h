@@ -16,6 +16,7 @@
 // Who  When        What
 // ---  ----------  -------------------------------------------------------------
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Added the guest memory sanitizer setup & report
 //
 
 #ifndef __MAINWIN_H__
@@ -26,8 +27,6 @@
 #include "state.h"
 #include "tom.h"
 
-#define RING_BUFFER_SIZE 32
-
 // Main windows
 class GLWidget;
 //class VideoWindow;
@@ -37,6 +36,7 @@ class FilePickerWindow;
 class VideoOutputWindow;
 //class DasmWindow;
 class EmuStatusWindow;
+class DebugPortWindow;
 
 // Alpine
 class ROMCartBrowserWindow;
@@ -113,11 +113,18 @@ class MainWin: public QMainWindow
 		void FrameAdvance(void);
 		void ToggleFullScreen(void);
 		void ShowEmuStatusWin(void);
+		void ShowDebugPortWin(void);
 		void MakeScreenshot(void);
+		void ToggleFrameTimingOverlay(void);
+		void DumpFrameTimings(void);
 		// Debugger
 		void DebuggerTraceStepOver(void);
 		void DebuggerTraceStepInto(void);
 		void DebuggerRestart(void);
+		void DebuggerReverseStepInto(void);
+		void DebuggerReverseStepOver(void);
+		void DebuggerReverseContinue(void);
+		void ToggleReverseRecording(void);
 		void ShowAllWatchBrowserWin(void);
 		void ShowLocalBrowserWin(void);
 		void ShowCallStackBrowserWin(void);
@@ -129,6 +136,7 @@ class MainWin: public QMainWindow
 		void DeleteAllBreakpoints(void);
 		void DisableAllBreakpoints(void);
 		void ShowSaveDumpAsWin(void);
+		void DumpOpcodeStats(void);
 		void SelectdasmtabWidget(const int);
 		void ShowVideoOutputWin(void);
 		//void ShowDasmWin(void);
@@ -168,6 +176,9 @@ class MainWin: public QMainWindow
 		void ReadSettings(void);
 		void WriteSettings(void);
 		void WriteUISettings(void);
+		void SetupSanitizer(void);
+		void ShowSanitizerReport(void);
+		void ShowWatchpointHits(bool halted);
 
 	private:
 		GLWidget *videoWidget;
@@ -177,6 +188,7 @@ class MainWin: public QMainWindow
 		HelpWindow *helpWin;
 		FilePickerWindow *filePickWin;
 		EmuStatusWindow *emuStatusWin;
+		DebugPortWindow *debugPortWin;
 		SaveDumpAsWindow *SaveDumpAsWin;
 		QTimer *timer;
 		bool running;
@@ -227,9 +239,6 @@ class MainWin: public QMainWindow
 
 	public:
 		bool plzDontKillMyComputer;
-		uint32_t oldTimestamp;
-		uint32_t ringBufferPointer;
-		uint32_t ringBuffer[RING_BUFFER_SIZE];
 
 	private:
 		QPoint mainWinPosition;
@@ -270,11 +279,14 @@ class MainWin: public QMainWindow
 		QAction *ntscAct;
 		QAction *palAct;
 		QAction *blurAct;
+		QAction *frameTimingOverlayAct;
+		QAction *frameTimingDumpAct;
 		QAction *aboutAct;
 		QAction *helpAct;
 		QAction *filePickAct;
 		QAction *configAct;
 		QAction *emustatusAct;
+		QAction *debugPortAct;
 		QAction *useCDAct;
 		QAction *frameAdvanceAct;
 		QAction *fullScreenAct;
@@ -294,6 +306,10 @@ class MainWin: public QMainWindow
 		// Debugger
 		QAction *traceStepOverAct;
 		QAction *traceStepIntoAct;
+		QAction *reverseRecordAct;
+		QAction *reverseStepIntoAct;
+		QAction *reverseStepOverAct;
+		QAction *reverseContinueAct;
 		QAction *restartAct;
 		QAction *VideoOutputAct;
 		QAction *heapallocatorBrowseAct;
@@ -306,6 +322,7 @@ class MainWin: public QMainWindow
 		QAction *deleteAllBreakpointsAct;
 		QAction *disableAllBreakpointsAct;
 		QAction *saveDumpAsAct;
+		QAction *opcodeStatsDumpAct;
 		QAction *exceptionVectorTableBrowseAct;
 		QAction *CartFilesListAct;
 
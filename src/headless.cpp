@@ -0,0 +1,271 @@
+//
+// Headless runner
+//
+// Run a software for a number of frames without the GUI, the video and the
+// audio output, with an optional script hooked on the emulation. The DSP is
+// run along the frames, and the last frame CRC32 is displayed so the runs can
+// be compared.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Display the frame emulation time percentiles
+// JPM   Oct./2026  Split the loading & the frames run, for the batch runner
+// JPM   Oct./2026  Display the Object Processor speculation statistics
+// JPM   Oct./2026  Beam polling loops skip disabled by default
+// JPM   Oct./2026  Guest debug port events displayed after each frame
+// JPM   Oct./2026  Data watchpoints hits displayed after each frame
+// JPM   Oct./2026  Display the main bus arbitration statistics
+// JPM   Oct./2026  Display the serial line host end
+//
+
+#include "headless.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "asi.h"
+#include "bus.h"
+#include "crc32.h"
+#include "dac.h"
+#include "debugport.h"
+#include "file.h"
+#include "frametiming.h"
+#include "hosttuning.h"
+#include "jaguar.h"
+#include "log.h"
+#include "memory.h"
+#include "modelsBIOS.h"
+#include "op.h"
+#include "m68000/m68kinterface.h"
+#include "scripting.h"
+#include "settings.h"
+#include "tom.h"
+#include "watchpoint.h"
+
+// Same frame buffer size as the GL widget texture
+#define HEADLESS_SCREEN_PITCH	1024
+#define HEADLESS_SCREEN_HEIGHT	512
+
+static uint32_t headlessScreenBuffer[HEADLESS_SCREEN_PITCH * HEADLESS_SCREEN_HEIGHT];
+
+
+//
+// Default settings, the GUI settings are read by the main window only
+// The command line options can override them
+//
+void HeadlessSettings(void)
+{
+	vjs.useJoystick = false;
+	vjs.hardwareTypeNTSC = true;
+	vjs.frameSkip = 0;
+	vjs.audioEnabled = true;
+	vjs.usePipelinedDSP = false;
+	vjs.biosType = BT_M_SERIES;
+	vjs.jaguarModel = JAG_M_SERIES;
+	vjs.useJaguarBIOS = false;
+	vjs.GPUEnabled = true;
+	vjs.DSPEnabled = true;
+	vjs.allowWritesToROM = true;
+	vjs.allowM68KExceptionCatch = false;
+	vjs.allowWritesToUnknownLocation = true;
+	vjs.useFastBlitter = false;
+	vjs.emulationThreadCPU = vjs.audioThreadCPU = vjs.workerThreadCPU = -1;
+	vjs.emulationThreadPriority = vjs.audioThreadPriority = 0;
+	vjs.hugePagesType = HOST_HUGEPAGES_NONE;
+	vjs.frameTimingOverlay = false;
+	vjs.opSpeculation = OPSPEC_OFF;
+	vjs.beamPollSkip = false;
+	vjs.busArbitration = false;
+	vjs.allowDebugPort = true;
+	vjs.asiHost[0] = 0;
+}
+
+
+//
+// Initialise the machine, and load the software
+//
+bool HeadlessLoad(char * filename)
+{
+	JaguarSetScreenPitch(HEADLESS_SCREEN_PITCH);
+	JaguarSetScreenBuffer(headlessScreenBuffer);
+	JaguarInit();
+	SelectBIOS(vjs.biosType);
+	JaguarReset();
+
+	if (ASIHostName())
+	{
+		printf("ASI: serial line on %s\n", ASIHostName());
+		fflush(stdout);
+	}
+
+	// We have to load our software *after* the Jaguar RESET
+	if (!JaguarLoadFile(filename))
+	{
+		printf("Could not load file \"%s\"!\n", filename);
+		return false;
+	}
+
+	SET32(jaguarMainRAM, 0, vjs.DRAM_size);						// Set stack in the M68000's Reset SP
+
+	if (!vjs.useJaguarBIOS)
+	{
+		SET32(jaguarMainRAM, 4, jaguarRunAddress);
+	}
+
+	m68k_pulse_reset();
+	return true;
+}
+
+
+//
+// Display the guest debug port events
+//
+static void HeadlessDebugPort(void)
+{
+	static uint32_t dropped = 0;
+	DebugPortEvent event;
+	char line[256];
+
+	while (DebugPortRead(&event))
+	{
+		DebugPortFormat(&event, line, sizeof(line));
+		printf("%s\n", line);
+	}
+
+	if (DebugPortDropped() != dropped)
+	{
+		printf("Debug port: %u events dropped\n", DebugPortDropped() - dropped);
+		dropped = DebugPortDropped();
+	}
+}
+
+
+//
+// Display the data watchpoints hits
+//
+static void HeadlessWatchpoints(void)
+{
+	static uint32_t dropped = 0;
+	WatchpointHit hit;
+	char line[256];
+
+	while (WatchpointGetHit(&hit))
+	{
+		WatchpointFormat(&hit, line, sizeof(line));
+		printf("Watchpoint %s\n", line);
+	}
+
+	if (WatchpointDropped() != dropped)
+	{
+		printf("Watchpoints: %u hits dropped\n", WatchpointDropped() - dropped);
+		dropped = WatchpointDropped();
+	}
+}
+
+
+//
+// Display the main bus share of each bus master
+//
+static void HeadlessBusStats(void)
+{
+	static const uint32_t masters[] = { OP, DSP, GPU, BLITTER, M68K };
+	BusStats stats;
+	BusGetStats(&stats);
+	printf("Bus: %u halflines, %u saturated\n", stats.halflines, stats.saturated);
+
+	for (uint32_t i = 0; i < (sizeof(masters) / sizeof(masters[0])); i++)
+	{
+		printf("Bus %-7s: %llu cycles requested, %llu granted, %llu stalled\n", whoName[masters[i]], (unsigned long long)stats.requested[masters[i]], (unsigned long long)stats.granted[masters[i]], (unsigned long long)stats.stalled[masters[i]]);
+	}
+}
+
+
+//
+// Run the number of frames
+//
+void HeadlessExecute(uint32_t frames)
+{
+	// DSP runs for the frame time, as the audio callback does it
+	uint32_t samplesPerFrame = (vjs.hardwareTypeNTSC ? (48000 / 60) : (48000 / 50));
+
+	for (uint32_t i = 0; i < frames; i++)
+	{
+		FrameTimingMark(FT_MARK_START);
+		JaguarExecuteNew();
+
+		if (vjs.DSPEnabled)
+		{
+			DACExecHeadless(samplesPerFrame);
+		}
+
+		FrameTimingMark(FT_MARK_EMULATED);
+		FrameTimingMark(FT_MARK_DISPLAYED);
+		HeadlessDebugPort();
+		HeadlessWatchpoints();
+
+		// No debugger to take the control
+		if (M68KDebugHaltStatus())
+		{
+			WriteLog("HEADLESS: M68K halted at frame %u, PC=$%06X\n", i, m68k_get_reg(NULL, M68K_REG_PC));
+			M68KDebugResume();
+		}
+	}
+}
+
+
+//
+// CRC32 of the last frame
+//
+uint32_t HeadlessFrameCRC32(void)
+{
+	return (uint32_t)crc32_calcCheckSum((uint8_t *)headlessScreenBuffer, sizeof(headlessScreenBuffer));
+}
+
+
+//
+// Run the software for the number of frames
+//
+int HeadlessRun(char * filename, uint32_t frames, const char * script)
+{
+	int retVal = 1;
+
+	if (HeadlessLoad(filename))
+	{
+		if (!script || ScriptLoad(script))
+		{
+			FrameTimingReset();
+			HeadlessExecute(frames);
+			printf("Frame %u CRC32: %08X\n", jaguarFrameCount, HeadlessFrameCRC32());
+			printf("Frame emulation p50/p95/p99: %.3f/%.3f/%.3f ms\n", FrameTimingPercentile(FT_EMULATION, 50) / 1000000.0, FrameTimingPercentile(FT_EMULATION, 95) / 1000000.0, FrameTimingPercentile(FT_EMULATION, 99) / 1000000.0);
+
+			if (vjs.opSpeculation != OPSPEC_OFF)
+			{
+				OPSpecStats stats;
+				OPSpecGetStats(&stats);
+				printf("OP speculation: %u committed, %u conflicts, %u unsafe, %u discarded\n", stats.committed, stats.conflicts, stats.unsafe, stats.discarded);
+
+				if (vjs.opSpeculation == OPSPEC_VERIFY)
+				{
+					printf("OP speculation verify: %u halflines, %u mismatches\n", stats.verified, stats.mismatches);
+				}
+			}
+
+			if (vjs.busArbitration)
+			{
+				HeadlessBusStats();
+			}
+
+			ScriptDone();
+			retVal = 0;
+		}
+		else
+		{
+			printf("Could not run script \"%s\"!\n", script);
+		}
+	}
+
+	JaguarDone();
+	return retVal;
+}
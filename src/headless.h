@@ -0,0 +1,18 @@
+//
+// headless.h: Header file
+//
+// Emulation without the GUI
+//
+
+#ifndef __HEADLESS_H__
+#define __HEADLESS_H__
+
+#include <stdint.h>
+
+extern void HeadlessSettings(void);
+extern bool HeadlessLoad(char * filename);
+extern void HeadlessExecute(uint32_t frames);
+extern uint32_t HeadlessFrameCRC32(void);
+extern int HeadlessRun(char * filename, uint32_t frames, const char * script);
+
+#endif	// __HEADLESS_H__
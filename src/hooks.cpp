@@ -0,0 +1,117 @@
+//
+// Emulation events hooks
+//
+// The callbacks are kept in small fixed lists, one per event. The dispatch
+// points in the emulation only check the list count, so nothing is paid as
+// long as nobody (i.e. a script) subscribes to the event.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Memory read events
+//
+
+#include "hooks.h"
+
+#include <string.h>
+#include "log.h"
+
+
+HookList hookList[HOOK_END];
+bool hooksBreakpointResume;
+
+
+//
+// Register a callback for an event
+// The address range is only used by the memory events
+//
+bool HooksRegister(uint32_t type, HookCallback callback, void * userData, uint32_t low/*= 0*/, uint32_t high/*= 0xFFFFFFFF*/)
+{
+	if ((type >= HOOK_END) || !callback)
+	{
+		return false;
+	}
+
+	HookList * list = &hookList[type];
+
+	if (list->count == HOOK_MAX_CALLBACKS)
+	{
+		WriteLog("HOOKS: No more callbacks available for event %u\n", type);
+		return false;
+	}
+
+	HookEntry * entry = &list->entry[list->count];
+	entry->callback = callback;
+	entry->userData = userData;
+	entry->low = low;
+	entry->high = high;
+	list->count++;
+
+	return true;
+}
+
+
+//
+// Unregister a callback
+//
+void HooksUnregister(uint32_t type, HookCallback callback, void * userData)
+{
+	if (type >= HOOK_END)
+	{
+		return;
+	}
+
+	HookList * list = &hookList[type];
+
+	for (uint32_t i = 0; i < list->count; i++)
+	{
+		if ((list->entry[i].callback == callback) && (list->entry[i].userData == userData))
+		{
+			// Keep the list compact, so the dispatch stops at the count
+			memmove(&list->entry[i], &list->entry[i + 1], (list->count - i - 1) * sizeof(HookEntry));
+			list->count--;
+			return;
+		}
+	}
+}
+
+
+//
+// Remove all callbacks
+//
+void HooksReset(void)
+{
+	memset(hookList, 0, sizeof(hookList));
+}
+
+
+//
+// Call the callbacks registered for an event
+// Only reached when the list is not empty
+// A callback may unregister itself (i.e. in case of a script error)
+//
+void HooksDispatch(uint32_t type, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+	HookList * list = &hookList[type];
+	uint32_t i = 0;
+
+	while (i < list->count)
+	{
+		HookEntry * entry = &list->entry[i];
+		uint32_t count = list->count;
+
+		// Check if the access overlaps the registered range
+		if (((type != HOOK_MEMWRITE) && (type != HOOK_MEMREAD)) || (((arg0 + arg2 - 1) >= entry->low) && (arg0 <= entry->high)))
+		{
+			entry->callback(entry->userData, arg0, arg1, arg2, arg3);
+		}
+
+		// The next callback has taken the place of the removed one
+		if (list->count == count)
+		{
+			i++;
+		}
+	}
+}
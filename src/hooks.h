@@ -0,0 +1,58 @@
+//
+// hooks.h: Header file
+//
+// Registered callbacks lists for the emulation events (used by the scripting)
+// An empty list costs only one predictable branch at the dispatch point
+// The memory events are also dispatched from the audio thread (DSP accesses)
+//
+
+#ifndef __HOOKS_H__
+#define __HOOKS_H__
+
+#include <stdint.h>
+
+// Events which can be hooked
+// HOOK_FRAMESTART      before the frame emulation (arg0 = frame number)
+// HOOK_FRAMEEND        after the frame emulation, screen buffer is complete (arg0 = frame number)
+// HOOK_HALFLINE        after the halfline rendering (arg0 = VC)
+// HOOK_MEMWRITE        memory write, only called for the registered range (arg0 = address, arg1 = value, arg2 = size in bytes, arg3 = who)
+// HOOK_MEMREAD         memory read, only called for the registered range (arg0 = address, arg1 = value read, arg2 = size in bytes, arg3 = who)
+//                      the M68K reads include its instruction fetches, the debugger reads (who = DEBUG) are not reported
+// HOOK_BREAKPOINT      M68K breakpoint reached (arg0 = address), set hooksBreakpointResume to let the emulation continue
+enum { HOOK_FRAMESTART = 0, HOOK_FRAMEEND, HOOK_HALFLINE, HOOK_MEMWRITE, HOOK_MEMREAD, HOOK_BREAKPOINT, HOOK_END };
+
+#define HOOK_MAX_CALLBACKS	16
+
+typedef void (* HookCallback)(void * userData, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3);
+
+struct HookEntry
+{
+	HookCallback callback;
+	void * userData;
+	uint32_t low, high;							// Address range for the memory events
+};
+
+struct HookList
+{
+	uint32_t count;
+	HookEntry entry[HOOK_MAX_CALLBACKS];
+};
+
+extern HookList hookList[HOOK_END];
+extern bool hooksBreakpointResume;
+
+extern bool HooksRegister(uint32_t type, HookCallback callback, void * userData, uint32_t low = 0, uint32_t high = 0xFFFFFFFF);
+extern void HooksUnregister(uint32_t type, HookCallback callback, void * userData);
+extern void HooksReset(void);
+extern void HooksDispatch(uint32_t type, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3);
+
+#if defined(__GNUC__)
+#define HOOKS_UNLIKELY(x)	__builtin_expect(!!(x), 0)
+#else
+#define HOOKS_UNLIKELY(x)	(x)
+#endif
+
+// Dispatch point, only one test when nothing is registered
+#define HOOKS_CALL(type, arg0, arg1, arg2, arg3)	do { if (HOOKS_UNLIKELY(hookList[type].count)) HooksDispatch(type, arg0, arg1, arg2, arg3); } while (0)
+
+#endif	// __HOOKS_H__
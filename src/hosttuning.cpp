@@ -0,0 +1,338 @@
+//
+// Host tuning for dedicated emulator hosts
+//
+// Pin the emulation, audio and worker threads on chosen cores, give them a
+// real-time scheduling priority, and back the large emulator memory areas
+// (jagMemSpace, colour lookup tables) with transparent or explicit huge pages.
+// The areas smaller than a huge page are allocated on their own huge page.
+// Everything is opt-in from the settings, and on non Linux hosts the calls
+// simply do nothing.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Areas smaller than a huge page allocated on their own huge page
+// JPM   Oct./2026  Area mapped again when the explicit huge pages cannot be obtained
+//
+
+#include "hosttuning.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "log.h"
+#include "settings.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+
+// Achieved settings for one thread
+struct HostThreadStatus
+{
+	bool applied;
+	int32_t cpu;						// -1 if not pinned
+	int policy;							// 0 = normal, 'F' = FIFO, 'R' = RR
+	uint32_t priority;
+};
+
+static const char * threadName[HOST_THREAD_END] = { "emu", "audio", "worker" };
+static HostThreadStatus threadStatus[HOST_THREAD_END];
+static size_t hugePagesBytes;			// Memory successfully backed/advised with huge pages
+static uint32_t hugePagesType;			// Huge pages type actually obtained
+static char statusText[256];
+
+
+//
+// Return the settings requested for the thread type
+//
+static void HostTuningGetRequest(uint32_t threadType, int32_t & cpu, uint32_t & priority)
+{
+	switch (threadType)
+	{
+	case HOST_THREAD_EMULATION:
+		cpu = vjs.emulationThreadCPU;
+		priority = vjs.emulationThreadPriority;
+		break;
+
+	case HOST_THREAD_AUDIO:
+		cpu = vjs.audioThreadCPU;
+		priority = vjs.audioThreadPriority;
+		break;
+
+	default:
+		cpu = vjs.workerThreadCPU;
+		priority = 0;
+		break;
+	}
+}
+
+
+//
+// Check if any host tuning has been requested
+//
+bool HostTuningIsActive(void)
+{
+	return ((vjs.emulationThreadCPU >= 0) || (vjs.audioThreadCPU >= 0) || (vjs.workerThreadCPU >= 0)
+		|| vjs.emulationThreadPriority || vjs.audioThreadPriority || (vjs.hugePagesType != HOST_HUGEPAGES_NONE));
+}
+
+
+//
+// Apply the requested affinity and scheduling to the calling thread
+//
+void HostTuningApplyThread(uint32_t threadType)
+{
+	int32_t cpu;
+	uint32_t priority;
+
+	if (threadType >= HOST_THREAD_END)
+	{
+		return;
+	}
+
+	HostTuningGetRequest(threadType, cpu, priority);
+	HostThreadStatus * status = &threadStatus[threadType];
+	status->applied = true;
+	status->cpu = -1;
+	status->policy = 0;
+	status->priority = 0;
+
+#if defined(__linux__)
+	pthread_t self = pthread_self();
+
+	if ((cpu >= 0) && (cpu < CPU_SETSIZE))
+	{
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+
+		if (pthread_setaffinity_np(self, sizeof(set), &set) == 0)
+		{
+			// Check back what the kernel has really done
+			CPU_ZERO(&set);
+
+			if ((pthread_getaffinity_np(self, sizeof(set), &set) == 0) && (CPU_COUNT(&set) == 1) && CPU_ISSET(cpu, &set))
+			{
+				status->cpu = cpu;
+			}
+		}
+		else
+		{
+			WriteLog("HOST: Cannot pin the %s thread on CPU %i\n", threadName[threadType], cpu);
+		}
+	}
+
+	if (priority)
+	{
+		int policy = (vjs.useRoundRobinScheduling ? SCHED_RR : SCHED_FIFO);
+		struct sched_param param;
+		int min = sched_get_priority_min(policy), max = sched_get_priority_max(policy);
+
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = ((int)priority < min) ? min : (((int)priority > max) ? max : (int)priority);
+
+		if (pthread_setschedparam(self, policy, &param) == 0)
+		{
+			if ((pthread_getschedparam(self, &policy, &param) == 0) && ((policy == SCHED_FIFO) || (policy == SCHED_RR)))
+			{
+				status->policy = (policy == SCHED_RR) ? 'R' : 'F';
+				status->priority = param.sched_priority;
+			}
+		}
+		else
+		{
+			WriteLog("HOST: Cannot set the %s thread real-time priority %u (CAP_SYS_NICE or rtprio limit needed)\n", threadName[threadType], priority);
+		}
+	}
+#else
+	(void)cpu;
+	(void)priority;
+#endif
+
+	WriteLog("HOST: %s thread -> CPU %i, %s priority %u\n", threadName[threadType], status->cpu, (status->policy ? (status->policy == 'R' ? "RR" : "FIFO") : "normal"), status->priority);
+}
+
+
+//
+// Back a memory area with huge pages
+// Only the part aligned on huge pages boundaries can be backed, so the large areas should be declared with HOST_HUGEPAGE_ALIGN,
+// and the smaller ones allocated by HostTuningAllocMemory
+// The explicit backing remaps the area, so its current content is saved and restored
+//
+void HostTuningBackMemory(void * base, size_t size, const char * name)
+{
+#if defined(__linux__) && defined(HOST_HUGEPAGE_SIZE)
+	uintptr_t start = ((uintptr_t)base + HOST_HUGEPAGE_SIZE - 1) & ~(uintptr_t)(HOST_HUGEPAGE_SIZE - 1);
+	uintptr_t end = ((uintptr_t)base + size) & ~(uintptr_t)(HOST_HUGEPAGE_SIZE - 1);
+
+	if ((vjs.hugePagesType == HOST_HUGEPAGES_NONE) || (end <= start))
+	{
+		return;
+	}
+
+	size_t length = end - start;
+
+#ifdef MAP_HUGETLB
+	if (vjs.hugePagesType == HOST_HUGEPAGES_EXPLICIT)
+	{
+		uint8_t * save = (uint8_t *)malloc(length);
+
+		if (save)
+		{
+			memcpy(save, (void *)start, length);
+
+			if (mmap((void *)start, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0) != MAP_FAILED)
+			{
+				memcpy((void *)start, save, length);
+				free(save);
+				hugePagesBytes += length;
+				hugePagesType = HOST_HUGEPAGES_EXPLICIT;
+				WriteLog("HOST: %s backed by %u KB of explicit huge pages\n", name, (unsigned int)(length >> 10));
+				return;
+			}
+
+			// The failed fixed mapping may have removed the area, it is mapped again with the normal pages
+			if (mmap((void *)start, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)
+			{
+				free(save);
+				WriteLog("HOST: %s cannot be mapped again\n", name);
+				exit(1);
+			}
+
+			memcpy((void *)start, save, length);
+			free(save);
+		}
+
+		// The area content is kept in case of failure, so we can fall back on the transparent pages
+		WriteLog("HOST: No explicit huge pages available for %s (check vm.nr_hugepages), trying transparent huge pages\n", name);
+	}
+#endif
+
+#ifdef MADV_HUGEPAGE
+	if (madvise((void *)start, length, MADV_HUGEPAGE) == 0)
+	{
+		hugePagesBytes += length;
+
+		if (hugePagesType == HOST_HUGEPAGES_NONE)
+		{
+			hugePagesType = HOST_HUGEPAGES_TRANSPARENT;
+		}
+
+		WriteLog("HOST: %s advised for %u KB of transparent huge pages\n", name, (unsigned int)(length >> 10));
+	}
+	else
+	{
+		WriteLog("HOST: Transparent huge pages are not available for %s\n", name);
+	}
+#endif
+#else
+	(void)base;
+	(void)size;
+	(void)name;
+#endif
+}
+
+
+//
+// Allocate a memory area on its own huge page aligned region, so an area smaller than a huge
+// page can be backed by a huge page too; the area is cleared
+// Returns NULL if the area cannot be allocated
+//
+void * HostTuningAllocMemory(size_t size, const char * name)
+{
+#if defined(__linux__) && defined(HOST_HUGEPAGE_SIZE)
+	size_t length = (size + HOST_HUGEPAGE_SIZE - 1) & ~(size_t)(HOST_HUGEPAGE_SIZE - 1);
+	uint8_t * region = (uint8_t *)mmap(NULL, length + HOST_HUGEPAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (region == MAP_FAILED)
+	{
+		WriteLog("HOST: Cannot allocate %s\n", name);
+		return NULL;
+	}
+
+	// The region is trimmed down to the huge pages boundaries
+	uint8_t * base = (uint8_t *)(((uintptr_t)region + HOST_HUGEPAGE_SIZE - 1) & ~(uintptr_t)(HOST_HUGEPAGE_SIZE - 1));
+
+	if (base > region)
+	{
+		munmap(region, base - region);
+	}
+
+	if ((base + length) < (region + length + HOST_HUGEPAGE_SIZE))
+	{
+		munmap(base + length, (region + length + HOST_HUGEPAGE_SIZE) - (base + length));
+	}
+
+	HostTuningBackMemory(base, length, name);
+	return base;
+#else
+	(void)name;
+	return calloc(1, size);
+#endif
+}
+
+
+//
+// Free a memory area allocated by HostTuningAllocMemory
+//
+void HostTuningFreeMemory(void * base, size_t size)
+{
+#if defined(__linux__) && defined(HOST_HUGEPAGE_SIZE)
+	if (base)
+	{
+		munmap(base, (size + HOST_HUGEPAGE_SIZE - 1) & ~(size_t)(HOST_HUGEPAGE_SIZE - 1));
+	}
+#else
+	(void)size;
+	free(base);
+#endif
+}
+
+
+//
+// Achieved settings, to be displayed in the status bar
+//
+const char * HostTuningGetStatus(void)
+{
+	size_t len = 0;
+
+	statusText[0] = 0;
+
+	for (uint32_t i = 0; i < HOST_THREAD_END; i++)
+	{
+		HostThreadStatus * status = &threadStatus[i];
+
+		if (status->applied && ((status->cpu >= 0) || status->policy))
+		{
+			len += snprintf(statusText + len, sizeof(statusText) - len, "%s%s", (len ? " " : ""), threadName[i]);
+
+			if ((status->cpu >= 0) && (len < sizeof(statusText)))
+			{
+				len += snprintf(statusText + len, sizeof(statusText) - len, ":cpu%i", status->cpu);
+			}
+
+			if (status->policy && (len < sizeof(statusText)))
+			{
+				len += snprintf(statusText + len, sizeof(statusText) - len, ":%s%u", (status->policy == 'R' ? "RR" : "FIFO"), status->priority);
+			}
+		}
+
+		if (len >= sizeof(statusText))
+		{
+			return statusText;
+		}
+	}
+
+	if (hugePagesBytes)
+	{
+		snprintf(statusText + len, sizeof(statusText) - len, "%s%s %uMB", (len ? " " : ""), (hugePagesType == HOST_HUGEPAGES_EXPLICIT ? "HugeTLB" : "THP"), (unsigned int)(hugePagesBytes >> 20));
+	}
+
+	return statusText;
+}
@@ -0,0 +1,34 @@
+//
+// hosttuning.h: Header file
+//
+// Host threads scheduling and memory backing for dedicated emulator hosts
+//
+
+#ifndef __HOSTTUNING_H__
+#define __HOSTTUNING_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Host huge pages alignment, used by the large tables we want to back with huge pages
+#if defined(__linux__) && defined(__GNUC__)
+#define HOST_HUGEPAGE_SIZE		0x200000
+#define HOST_HUGEPAGE_ALIGN		__attribute__((aligned(HOST_HUGEPAGE_SIZE)))
+#else
+#define HOST_HUGEPAGE_ALIGN
+#endif
+
+// Threads which can be tuned
+enum { HOST_THREAD_EMULATION = 0, HOST_THREAD_AUDIO, HOST_THREAD_WORKER, HOST_THREAD_END };
+
+// Huge pages backing type
+enum { HOST_HUGEPAGES_NONE = 0, HOST_HUGEPAGES_TRANSPARENT, HOST_HUGEPAGES_EXPLICIT };
+
+extern void HostTuningBackMemory(void * base, size_t size, const char * name);
+extern void * HostTuningAllocMemory(size_t size, const char * name);
+extern void HostTuningFreeMemory(void * base, size_t size);
+extern void HostTuningApplyThread(uint32_t threadType);
+extern bool HostTuningIsActive(void);
+extern const char * HostTuningGetStatus(void);
+
+#endif	// __HOSTTUNING_H__
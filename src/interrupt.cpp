@@ -0,0 +1,145 @@
+//
+// Interrupt controller
+//
+// All the 68K interrupts go thru TOM at level 2 (IPL1 is tied to INTL on TOM),
+// the JERRY ones thru DINT. The controller has the latches & the enables of
+// the TOM & JERRY interrupts to the 68K, and of the GPU & DSP interrupts; the
+// chips registers (INT1, JINTCTRL, G_CTRL/G_FLAGS & D_CTRL/D_FLAGS) read and
+// write them. A 68K request is latched and pushed to the 68K only if its line
+// is enabled, and the 68K handles it at its next instruction boundary instead
+// of polling the lines at each instruction. The GPU & DSP handle their
+// interrupts as their latches are set or their IMASK is cleared; IMASK stays
+// in their flags, as it selects their register bank too.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Enables of all the units, and the JERRY, GPU & DSP latches
+//
+
+#include "interrupt.h"
+
+#include <stdio.h>
+#include "m68000/m68kinterface.h"
+
+// Latches & enables of a unit
+struct InterruptUnit
+{
+	uint32_t pending;
+	uint32_t enabled;
+};
+
+static InterruptUnit interruptUnit[INTERRUPT_END];
+
+// Bits used by each unit
+static const uint32_t interruptUnitMask[INTERRUPT_END] = { 0x1F, 0xFF, 0x1F, 0x3F };
+
+
+//
+// Unit latches & enables cleared
+//
+void InterruptReset(uint32_t unit)
+{
+	interruptUnit[unit].pending = 0;
+	interruptUnit[unit].enabled = 0;
+}
+
+
+//
+// Unit latches (i.e. as read in INT1)
+//
+uint32_t InterruptPending(uint32_t unit)
+{
+	return interruptUnit[unit].pending;
+}
+
+
+//
+// Unit latches set back (state load)
+//
+void InterruptSetPending(uint32_t unit, uint32_t pending)
+{
+	interruptUnit[unit].pending = pending & interruptUnitMask[unit];
+}
+
+
+//
+// Unit latches set, the processor is not interrupted
+//
+void InterruptLatch(uint32_t unit, uint32_t irqs)
+{
+	interruptUnit[unit].pending |= irqs & interruptUnitMask[unit];
+}
+
+
+//
+// Unit latches cleared (i.e. by an INT1 write)
+//
+void InterruptAcknowledge(uint32_t unit, uint32_t irqs)
+{
+	interruptUnit[unit].pending &= ~irqs;
+}
+
+
+//
+// Unit enables
+//
+uint32_t InterruptEnabled(uint32_t unit)
+{
+	return interruptUnit[unit].enabled;
+}
+
+
+void InterruptSetEnabled(uint32_t unit, uint32_t enabled)
+{
+	interruptUnit[unit].enabled = enabled & interruptUnitMask[unit];
+}
+
+
+//
+// Unit latches enabled
+//
+uint32_t InterruptActive(uint32_t unit)
+{
+	return interruptUnit[unit].pending & interruptUnit[unit].enabled;
+}
+
+
+//
+// TOM interrupt request
+// Returns true if the 68K is interrupted
+//
+bool InterruptTOMRequest(int irq)
+{
+	InterruptUnit * tom = &interruptUnit[INTERRUPT_TOM];
+
+	if (!(tom->enabled & (1 << irq)))
+	{
+		return false;
+	}
+
+	tom->pending |= (1 << irq);
+	m68k_set_irq(2);
+	return true;
+}
+
+
+//
+// JERRY interrupt request, the interrupt is its IRQ2_xxx bit
+// Returns true if the 68K is interrupted
+//
+bool InterruptJERRYRequest(int irq)
+{
+	InterruptUnit * jerry = &interruptUnit[INTERRUPT_JERRY];
+
+	if (!(jerry->enabled & irq))
+	{
+		return false;
+	}
+
+	jerry->pending |= irq;
+	m68k_set_irq(2);
+	return true;
+}
@@ -0,0 +1,31 @@
+//
+// interrupt.h: Header file
+//
+// Interrupt controller, the latches & enables of the 68K (thru TOM & JERRY),
+// GPU & DSP interrupts
+//
+
+#ifndef __INTERRUPT_H__
+#define __INTERRUPT_H__
+
+#include <stdint.h>
+
+// Controller units, the latches & enables have one bit per interrupt
+// INTERRUPT_TOM        TOM interrupts to the 68K (IRQ_VIDEO - IRQ_DSP), in INT1
+// INTERRUPT_JERRY      JERRY interrupts to the 68K thru the TOM DSP one (IRQ2_xxx bits), in JINTCTRL
+// INTERRUPT_GPU        GPU interrupts (GPUIRQ_xxx), latches in G_CTRL & enables in G_FLAGS
+// INTERRUPT_DSP        DSP interrupts (DSPIRQ_xxx), latches in D_CTRL & enables in D_FLAGS
+enum { INTERRUPT_TOM = 0, INTERRUPT_JERRY, INTERRUPT_GPU, INTERRUPT_DSP, INTERRUPT_END };
+
+extern void InterruptReset(uint32_t unit);
+extern uint32_t InterruptPending(uint32_t unit);
+extern void InterruptSetPending(uint32_t unit, uint32_t pending);
+extern void InterruptLatch(uint32_t unit, uint32_t irqs);
+extern void InterruptAcknowledge(uint32_t unit, uint32_t irqs);
+extern uint32_t InterruptEnabled(uint32_t unit);
+extern void InterruptSetEnabled(uint32_t unit, uint32_t enabled);
+extern uint32_t InterruptActive(uint32_t unit);
+extern bool InterruptTOMRequest(int irq);
+extern bool InterruptJERRYRequest(int irq);
+
+#endif	// __INTERRUPT_H__
@@ -13,6 +13,7 @@
 // JLH  06/01/2012  Created this log (long overdue! ;-)
 // JLH  01/23/2013  Beautifying of disassembly, including hex digits of opcodes
 //                  and operands
+// JPM   Oct./2026  Thread safe, and code read away from its run address
 //
 
 #include "jagdasm.h"
@@ -20,7 +21,7 @@
 #include <stdio.h>
 #include "jaguar.h"
 
-#define ROPCODE(a) JaguarReadWord(a)
+#define ROPCODE(a) JaguarReadWord((a) + sourceOffset)
 
 uint8_t convert_zero[32] =
 { 32,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31 };
@@ -68,7 +69,7 @@ const char * condition[32] =
 
 char * signed_16bit(int16_t val)
 {
-	static char temp[10];
+	static thread_local char temp[10];
 
 	if (val < 0)
 		sprintf(temp, "-$%X", -val);
@@ -79,7 +80,7 @@ char * signed_16bit(int16_t val)
 }
 
 
-unsigned dasmjag(int dsp_type, char * bufferOut, unsigned pc)
+unsigned dasmjag(int dsp_type, char * bufferOut, unsigned pc, int sourceOffset/*= 0*/)
 {
 	char buffer[64];
 	int op = ROPCODE(pc);
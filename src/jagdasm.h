@@ -4,6 +4,7 @@
 #define JAGUAR_GPU 0
 #define JAGUAR_DSP 1
 
-unsigned dasmjag(int dsp_type, char * buffer, unsigned pc);
+// The code is read from pc + sourceOffset, for code not uploaded to its run address yet
+unsigned dasmjag(int dsp_type, char * buffer, unsigned pc, int sourceOffset = 0);
 
 #endif
@@ -20,6 +20,23 @@
 // JPM   Feb./2021  Added a specific breakpoint for the M68K bus error exception, and a M68K exception catch detection
 // JPM   Apr./2021  Keep number of M68K cycles used in tracing mode
 // JPM   Jan./2022  Added a writes to unknown memory location catch
+// JPM   Oct./2026  Memory space can be backed by huge pages
+// JPM   Oct./2026  Added the emulation events hooks (frame, halfline, memory writes & breakpoints)
+// JPM   Oct./2026  Dump the opcode histograms at exit (OPCODE_STATS)
+// JPM   Oct./2026  Trace steps recorded for the reverse debugger
+// JPM   Oct./2026  Memory pages written marked for the fast reset
+// JPM   Oct./2026  Memory pages written marked with the write epochs, for the OP speculation too
+// JPM   Oct./2026  Vertical interrupt requested to the interrupt controller
+// JPM   Oct./2026  Long reads of TOM & JERRY done by the chips
+// JPM   Oct./2026  Allocator entries watched for the guest memory sanitizer
+// JPM   Oct./2026  Guest debug port decoded in the unknown locations handlers
+// JPM   Oct./2026  Bus masters marked for the data watchpoints
+// JPM   Oct./2026  Executors slices shortened by the main bus arbitration
+// JPM   Oct./2026  68K side effects counted & traceback repeated, for the beam polling loops fast-forward
+// JPM   Oct./2026  Long writes done at once in the DRAM, and by TOM & JERRY
+// JPM   Oct./2026  SR not kept in the traceback, for the lazy condition codes
+// JPM   Oct./2026  Lazy flags state kept in the traceback, the SR made for the odd address backtrace only
+// JPM   Oct./2026  Memory read hooks
 //
 
 
@@ -34,22 +51,31 @@
 #include <SDL.h>
 #include "SDL_opengl.h"
 #include "blitter.h"
+#include "bus.h"
 #include "cdrom.h"
 #include "dac.h"
+#include "debugport.h"
 #include "dsp.h"
 #include "eeprom.h"
 #include "event.h"
 #include "foooked.h"
 #include "gpu.h"
+#include "hooks.h"
+#include "hosttuning.h"
+#include "interrupt.h"
 #include "jerry.h"
 #include "joystick.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
-//#include "memory.h"
+#include "memory.h"
 #include "memtrack.h"
 #include "mmu.h"
+#include "opcodestats.h"
+#include "reverse.h"
+#include "sanitizer.h"
 #include "settings.h"
 #include "tom.h"
+#include "watchpoint.h"
 //#include "debugger/BreakpointsWin.h"
 #ifdef NEWMODELSBIOSHANDLER
 #include "modelsBIOS.h"
@@ -119,7 +145,12 @@ uint32_t d4Queue[0x400];
 uint32_t d5Queue[0x400];
 uint32_t d6Queue[0x400];
 uint32_t d7Queue[0x400];
+// Lazy flags state, the SR is made from it only for the backtrace
 uint32_t srQueue[0x400];
+uint32_t ccOpQueue[0x400];
+uint32_t ccSrcQueue[0x400];
+uint32_t ccDstQueue[0x400];
+uint32_t ccResQueue[0x400];
 uint32_t pcQPtr = 0;
 bool startM68KTracing = false;
 
@@ -132,6 +163,7 @@ S_BrkInfo *brkInfo;
 size_t brkNbr;
 
 bool frameDone;
+uint32_t jaguarFrameCount;
 
 //
 // Callback function to detect illegal instructions
@@ -205,10 +237,18 @@ if (inRoutine)
 	d5Queue[pcQPtr] = m68k_get_reg(NULL, M68K_REG_D5);
 	d6Queue[pcQPtr] = m68k_get_reg(NULL, M68K_REG_D6);
 	d7Queue[pcQPtr] = m68k_get_reg(NULL, M68K_REG_D7);
-	srQueue[pcQPtr] = m68k_get_reg(NULL, M68K_REG_SR);
+	// Reading the SR would make the lazy condition codes at each instruction
+	m68k_get_lazy_flags(&srQueue[pcQPtr], &ccOpQueue[pcQPtr], &ccSrcQueue[pcQPtr], &ccDstQueue[pcQPtr], &ccResQueue[pcQPtr]);
 	pcQPtr++;
 	pcQPtr &= 0x3FF;
 
+	// Positions scan of the reverse debugger
+	ReverseInstructionHook();
+	// Allocator calls of the memory sanitizer
+	SANITIZER_INSTRUCTION_HOOK(m68kPC);
+
+#if !defined(CORE_FUZZ)
+	// The fuzzing harness goes on, as the odd address is a guest fault
 	if (m68kPC & 0x01)		// Oops! We're fetching an odd address!
 	{
 		WriteLog("M68K: Attempted to execute from an odd address!\n\nBacktrace:\n\n");
@@ -217,7 +257,8 @@ if (inRoutine)
 		for(int i=0; i<0x400; i++)
 		{
 //			WriteLog("[A2=%08X, D0=%08X]\n", a2Queue[(pcQPtr + i) & 0x3FF], d0Queue[(pcQPtr + i) & 0x3FF]);
-			WriteLog("[A0=%08X, A1=%08X, A2=%08X, A3=%08X, A4=%08X, A5=%08X, A6=%08X, A7=%08X, D0=%08X, D1=%08X, D2=%08X, D3=%08X, D4=%08X, D5=%08X, D6=%08X, D7=%08X, SR=%04X]\n", a0Queue[(pcQPtr + i) & 0x3FF], a1Queue[(pcQPtr + i) & 0x3FF], a2Queue[(pcQPtr + i) & 0x3FF], a3Queue[(pcQPtr + i) & 0x3FF], a4Queue[(pcQPtr + i) & 0x3FF], a5Queue[(pcQPtr + i) & 0x3FF], a6Queue[(pcQPtr + i) & 0x3FF], a7Queue[(pcQPtr + i) & 0x3FF], d0Queue[(pcQPtr + i) & 0x3FF], d1Queue[(pcQPtr + i) & 0x3FF], d2Queue[(pcQPtr + i) & 0x3FF], d3Queue[(pcQPtr + i) & 0x3FF], d4Queue[(pcQPtr + i) & 0x3FF], d5Queue[(pcQPtr + i) & 0x3FF], d6Queue[(pcQPtr + i) & 0x3FF], d7Queue[(pcQPtr + i) & 0x3FF], srQueue[(pcQPtr + i) & 0x3FF]);
+			uint32_t q = (pcQPtr + i) & 0x3FF;
+			WriteLog("[A0=%08X, A1=%08X, A2=%08X, A3=%08X, A4=%08X, A5=%08X, A6=%08X, A7=%08X, D0=%08X, D1=%08X, D2=%08X, D3=%08X, D4=%08X, D5=%08X, D6=%08X, D7=%08X, SR=%04X]\n", a0Queue[q], a1Queue[q], a2Queue[q], a3Queue[q], a4Queue[q], a5Queue[q], a6Queue[q], a7Queue[q], d0Queue[q], d1Queue[q], d2Queue[q], d3Queue[q], d4Queue[q], d5Queue[q], d6Queue[q], d7Queue[q], m68k_lazy_sr(srQueue[q], ccOpQueue[q], ccSrcQueue[q], ccDstQueue[q], ccResQueue[q]));
 			m68k_disassemble(buffer, pcQueue[(pcQPtr + i) & 0x3FF], 0, 1);//M68K_CPU_TYPE_68000);
 			WriteLog("\t%08X: %s\n", pcQueue[(pcQPtr + i) & 0x3FF], buffer);
 		}
@@ -232,6 +273,7 @@ if (inRoutine)
 		LogDone();
 		exit(0);
 	}
+#endif
 
 	// Disassemble everything
 /*	{
@@ -491,6 +533,37 @@ CD_switch::	-> $306C
 #endif
 }
 
+
+//
+// Traceback of a fast-forwarded 68K loop: the last instructions logged, one iteration, repeated
+// Not done while the instructions are traced in the log, or for an iteration longer than the queues
+//
+bool M68KTracebackRepeat(uint64_t count, uint64_t times)
+{
+	uint32_t * queues[] = { pcQueue, a0Queue, a1Queue, a2Queue, a3Queue, a4Queue, a5Queue, a6Queue, a7Queue,
+		d0Queue, d1Queue, d2Queue, d3Queue, d4Queue, d5Queue, d6Queue, d7Queue, srQueue, ccOpQueue, ccSrcQueue, ccDstQueue, ccResQueue };
+	uint32_t iteration[0x400];
+
+	if (startM68KTracing || !count || (count > 0x400))
+		return false;
+
+	// Only the last entries are kept
+	uint64_t total = count * times;
+	uint64_t kept = (total > 0x400 ? 0x400 : total);
+
+	for (uint32_t q = 0; q < (sizeof(queues) / sizeof(queues[0])); q++)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			iteration[i] = queues[q][(pcQPtr - count + i) & 0x3FF];
+
+		for (uint64_t i = total - kept; i < total; i++)
+			queues[q][(pcQPtr + i) & 0x3FF] = iteration[i % count];
+	}
+
+	pcQPtr = (pcQPtr + total) & 0x3FF;
+	return true;
+}
+
 #if 0
 Now here be dragons...
 Here is how memory ranges are defined in the CoJag driver.
@@ -1125,6 +1198,16 @@ unsigned int m68k_brk_add(void *PtrInfo)
 }
 
 
+// Breakpoint has been reached
+// The breakpoint hooks can let the emulation continue
+static unsigned int m68k_brk_hit(unsigned int adr)
+{
+	hooksBreakpointResume = false;
+	HOOKS_CALL(HOOK_BREAKPOINT, adr, 0, 0, 0);
+	return !hooksBreakpointResume;
+}
+
+
 // Check if breakpoint has been reached
 unsigned int m68k_brk_check(unsigned int adr)
 {
@@ -1132,7 +1215,7 @@ unsigned int m68k_brk_check(unsigned int adr)
 	if ((adr == bpmAddress1) && bpmActive)
 	{
 		bpmHitCounts++;
-		return true;
+		return m68k_brk_hit(adr);
 	}
 	else
 	{
@@ -1144,7 +1227,7 @@ unsigned int m68k_brk_check(unsigned int adr)
 				if (brkInfo[i].Adr == adr)
 				{
 					brkInfo[i].HitCounts++;
-					return true;
+					return m68k_brk_hit(adr);
 				}
 			}
 		}
@@ -1155,6 +1238,21 @@ unsigned int m68k_brk_check(unsigned int adr)
 }
 
 
+// Check if an address has an active breakpoint, without reaching it
+unsigned int m68k_brk_find(unsigned int adr)
+{
+	for (size_t i = 0; i < brkNbr; i++)
+	{
+		if (brkInfo[i].Used && brkInfo[i].Active && (brkInfo[i].Adr == adr))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
 // Disable the M68000 breakpoints
 void m68k_brk_disable(void)
 {
@@ -1184,13 +1282,17 @@ void m68k_brk_close(void)
 }
 
 
+// Chips registers & CD-ROM reads, which can have a side effect (the boot ROM is counted too)
+#define M68K_READ_SIDE_EFFECT(address)	if ((address) >= 0xDFFF00) m68kSideEffectCount++
+
+
 // Read 1 byte from address
 // Check if address reaches a breakpoint
 unsigned int m68k_read_memory_8(unsigned int address)
 {
 #ifdef ALPINE_FUNCTIONS
 	// Check if breakpoint on memory is active, and deal with it
-	if (!startM68KTracing && m68k_brk_check(address))
+	if (!startM68KTracing && !ReverseIsReplaying() && m68k_brk_check(address))
 	{
 		M68KDebugHalt();
 	}
@@ -1198,6 +1300,7 @@ unsigned int m68k_read_memory_8(unsigned int address)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	M68K_READ_SIDE_EFFECT(address);
 #ifdef CPU_DEBUG_MEMORY
 	// Note that the Jaguar only has 2M of RAM, not 4!
 	if ((address >= 0x000000) && (address <= 0x1FFFFF))
@@ -1266,6 +1369,7 @@ unsigned int m68k_read_memory_8(unsigned int address)
 //	WriteLog("M68K: Read byte $%02X at $%08X [PC=%08X]\n", retVal, address, m68k_get_reg(NULL, M68K_REG_PC));
 //if (address >= 0x8B5E4 && address <= 0x8B5E4 + 16)
 //	WriteLog("M68K: Read byte $%02X at $%08X [PC=%08X]\n", retVal, address, m68k_get_reg(NULL, M68K_REG_PC));
+	HOOKS_CALL(HOOK_MEMREAD, address, retVal, 1, M68K);
     return retVal;
 #else
 	return MMURead8(address, M68K);
@@ -1282,7 +1386,7 @@ unsigned int m68k_read_memory_16(unsigned int address)
 {
 #ifdef ALPINE_FUNCTIONS
 	// Check if breakpoint on memory is active, and deal with it
-	if (!startM68KTracing && m68k_brk_check(address))
+	if (!startM68KTracing && !ReverseIsReplaying() && m68k_brk_check(address))
 	{
 		M68KDebugHalt();
 	}
@@ -1290,6 +1394,7 @@ unsigned int m68k_read_memory_16(unsigned int address)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	M68K_READ_SIDE_EFFECT(address);
 #ifdef CPU_DEBUG_MEMORY
 /*	if ((address >= 0x000000) && (address <= 0x3FFFFE))
 	{
@@ -1418,6 +1523,7 @@ unsigned int m68k_read_memory_16(unsigned int address)
 //$8B5E4 -> Only +1 read at $808AA
 //if (address >= 0x8B5E4 && address <= 0x8B5E4 + 16)
 //	WriteLog("M68K: Read word $%04X at $%08X [PC=%08X]\n", retVal, address, m68k_get_reg(NULL, M68K_REG_PC));
+	HOOKS_CALL(HOOK_MEMREAD, address, retVal, 2, M68K);
     return retVal;
 #else
 	return MMURead16(address, M68K);
@@ -1431,15 +1537,20 @@ bool m68k_read_exception_vector(unsigned int address, char *text)
 	QString msg;
 	QMessageBox msgBox;
 
+	// The reverse debugger replay halts silently
+	if (!ReverseIsReplaying())
+	{
 #if 0
-	msg.sprintf("68000 exception\n%s at $%06x", text, pcQueue[pcQPtr ? (pcQPtr - 1) : 0x3FF]);
+		msg.sprintf("68000 exception\n%s at $%06x", text, pcQueue[pcQPtr ? (pcQPtr - 1) : 0x3FF]);
 #else
-	msg.sprintf("68000 exception\n$%06x: %s", pcQueue[pcQPtr ? (pcQPtr - 1) : 0x3FF], text);
+		msg.sprintf("68000 exception\n$%06x: %s", pcQueue[pcQPtr ? (pcQPtr - 1) : 0x3FF], text);
 #endif
-	msgBox.setText(msg);
-	msgBox.setStandardButtons(QMessageBox::Abort);
-	msgBox.setDefaultButton(QMessageBox::Abort);
-	msgBox.exec();
+		msgBox.setText(msg);
+		msgBox.setStandardButtons(QMessageBox::Abort);
+		msgBox.setDefaultButton(QMessageBox::Abort);
+		msgBox.exec();
+	}
+
 	return M68KDebugHalt();
 }
 
@@ -1449,7 +1560,7 @@ unsigned int m68k_read_memory_32(unsigned int address)
 {
 #ifdef ALPINE_FUNCTIONS
 	// Check if breakpoint on memory is active, and deal with it
-	if (!startM68KTracing && m68k_brk_check(address))
+	if (!startM68KTracing && !ReverseIsReplaying() && m68k_brk_check(address))
 	{
 		M68KDebugHalt();
 	}
@@ -1457,6 +1568,7 @@ unsigned int m68k_read_memory_32(unsigned int address)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	M68K_READ_SIDE_EFFECT(address);
 //; So, it seems that it stores the returned DWORD at $51136 and $FB074.
 /*	if (address == 0x51136 || address == 0xFB074 || address == 0x1AF05E)
 		WriteLog("[RM32  PC=%08X] Addr: %08X, val: %08X\n", m68k_get_reg(NULL, M68K_REG_PC), address, (m68k_read_memory_16(address) << 16) | m68k_read_memory_16(address + 2));//*/
@@ -1498,15 +1610,22 @@ unsigned int m68k_read_memory_32(unsigned int address)
 		// check ROM or Memory Track access
 		if ((address >= 0x800000) && (address <= 0xDFFEFE))
 		{
+			uint32_t retVal;
+
 			// Memory Track reading...
 			if (((TOMGetMEMCON1() & 0x0006) == (2 << 1)) && (jaguarMainROMCRC32 == 0xFDF37F47))
 			{
-				return MTReadLong(address);
+				retVal = MTReadLong(address);
 			}
 			else
 			{
-				return GET32(jaguarMainROM, address - 0x800000);
+				retVal = GET32(jaguarMainROM, address - 0x800000);
 			}
+
+			// The memory read hooks see two words, as for the other locations
+			HOOKS_CALL(HOOK_MEMREAD, address, (retVal >> 16), 2, M68K);
+			HOOKS_CALL(HOOK_MEMREAD, (address + 2), (retVal & 0xFFFF), 2, M68K);
+			return retVal;
 		}
 	}
 
@@ -1521,6 +1640,12 @@ unsigned int m68k_read_memory_32(unsigned int address)
 // Alert message in case of writing to unknown memory location
 bool m68k_write_unknown_alert(unsigned int address, char *bits, unsigned int value)
 {
+	// The reverse debugger replay halts silently
+	if (ReverseIsReplaying())
+	{
+		return M68KDebugHalt();
+	}
+
 	if (!M68KDebugHaltStatus())
 	{
 		QString msg;
@@ -1543,6 +1668,12 @@ bool m68k_write_unknown_alert(unsigned int address, char *bits, unsigned int val
 // Alert message in case of writing to cartridge/ROM memory location
 bool m68k_write_cartridge_alert(unsigned int address, char *bits, unsigned int value)
 {
+	// The answers are not recorded, the reverse debugger replay takes the default one
+	if (ReverseIsReplaying() && !M68KDebugHaltStatus())
+	{
+		return M68KDebugHalt();
+	}
+
 	if (!M68KDebugHaltStatus())
 	{
 		QString msg;
@@ -1579,6 +1710,8 @@ bool m68k_write_memory_check(unsigned int address, char *bits, unsigned int valu
 {
 	unsigned int address1;
 
+	m68kSideEffectCount++;
+
 #ifdef ALPINE_FUNCTIONS
 	// Check if breakpoint on memory is active, and deal with it
 	if (!M68KDebugHaltStatus() && bpmActive && (address == bpmAddress1))
@@ -1626,6 +1759,8 @@ void m68k_write_memory_8(unsigned int address, unsigned int value)
 	// Check memory write location on 8 bits
 	if (!m68k_write_memory_check(address, "8", value))
 	{
+		HOOKS_CALL(HOOK_MEMWRITE, address, value, 1, M68K);
+
 		// Musashi does this automagically for you, UAE core does not :-P
 		//address &= 0x00FFFFFF;
 #ifdef CPU_DEBUG_MEMORY
@@ -1662,6 +1797,7 @@ void m68k_write_memory_8(unsigned int address, unsigned int value)
 		if ((address >= 0x000000) && (address <= (vjs.DRAM_size - 1)))
 		{
 			jaguarMainRAM[address] = value;
+			MEMORY_PAGE_WRITTEN(address);
 		}
 		else
 		{
@@ -1686,6 +1822,7 @@ void m68k_write_memory_8(unsigned int address, unsigned int value)
 						if ((address >= 0x800000) && (address <= 0xDFFEFF))
 						{
 							jagMemSpace[address] = (uint8_t)value;
+							MEMORY_PAGE_WRITTEN(address);
 						}
 						else
 						{
@@ -1708,6 +1845,8 @@ void m68k_write_memory_16(unsigned int address, unsigned int value)
 	// Check memory write location on 16 bits
 	if (!m68k_write_memory_check(address, "16", value))
 	{
+		HOOKS_CALL(HOOK_MEMWRITE, address, value, 2, M68K);
+
 		// Musashi does this automagically for you, UAE core does not :-P
 		//address &= 0x00FFFFFF;
 #ifdef CPU_DEBUG_MEMORY
@@ -1773,6 +1912,7 @@ void m68k_write_memory_16(unsigned int address, unsigned int value)
 			/*		jaguar_mainRam[address] = value >> 8;
 					jaguar_mainRam[address + 1] = value & 0xFF;*/
 			SET16(jaguarMainRAM, address, value);
+			MEMORY_PAGE_WRITTEN(address);
 		}
 		else
 		{
@@ -1807,6 +1947,7 @@ void m68k_write_memory_16(unsigned int address, unsigned int value)
 						if ((address >= 0x800000) && (address <= 0xDFFEFE))
 						{
 							SET16(jagMemSpace, address, value);
+							MEMORY_PAGE_WRITTEN(address);
 						}
 						else
 						{
@@ -1958,7 +2099,11 @@ void M68K_show_context(void)
 // Catch a byte write to an unknown location
 void jaguar_unknown_writebyte(unsigned address, unsigned data, uint32_t who/*=UNKNOWN*/)
 {
-	if (!vjs.allowWritesToUnknownLocation)
+	if (DEBUGPORT_HIT(address))
+	{
+		DebugPortWriteByte(address, data, who);
+	}
+	else if (!vjs.allowWritesToUnknownLocation)
 	{
 		m68k_write_unknown_alert(address, "8", data);
 #ifdef LOG_UNMAPPED_MEMORY_ACCESSES
@@ -1978,7 +2123,11 @@ void jaguar_unknown_writebyte(unsigned address, unsigned data, uint32_t who/*=UN
 // Catch a word/short write to an unknown location
 void jaguar_unknown_writeword(unsigned address, unsigned data, uint32_t who/*=UNKNOWN*/)
 {
-	if (!vjs.allowWritesToUnknownLocation)
+	if (DEBUGPORT_HIT(address))
+	{
+		DebugPortWriteWord(address, data, who);
+	}
+	else if (!vjs.allowWritesToUnknownLocation)
 	{
 		m68k_write_unknown_alert(address, "16", data);
 #ifdef LOG_UNMAPPED_MEMORY_ACCESSES
@@ -1997,6 +2146,11 @@ void jaguar_unknown_writeword(unsigned address, unsigned data, uint32_t who/*=UN
 
 unsigned jaguar_unknown_readbyte(unsigned address, uint32_t who/*=UNKNOWN*/)
 {
+	if (DEBUGPORT_HIT(address))
+	{
+		return ((DebugPortReadWord(address & ~1) >> ((address & 1) ? 0 : 8)) & 0xFF);
+	}
+
 #ifdef LOG_UNMAPPED_MEMORY_ACCESSES
 	WriteLog("Jaguar: Unknown byte read at %08X by %s (M68K PC=%06X)\n", address, whoName[who], m68k_get_reg(NULL, M68K_REG_PC));
 #endif
@@ -2013,6 +2167,11 @@ unsigned jaguar_unknown_readbyte(unsigned address, uint32_t who/*=UNKNOWN*/)
 
 unsigned jaguar_unknown_readword(unsigned address, uint32_t who/*=UNKNOWN*/)
 {
+	if (DEBUGPORT_HIT(address))
+	{
+		return DebugPortReadWord(address);
+	}
+
 #ifdef LOG_UNMAPPED_MEMORY_ACCESSES
 	WriteLog("Jaguar: Unknown word read at %08X by %s (M68K PC=%06X)\n", address, whoName[who], m68k_get_reg(NULL, M68K_REG_PC));
 #endif
@@ -2094,14 +2253,16 @@ uint8_t JaguarReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 	else
 		data = jaguar_unknown_readbyte(offset, who);
 
+	if (who != DEBUG)
+		HOOKS_CALL(HOOK_MEMREAD, offset, data, 1, who);
+
 	return data;
 }
 
 
-uint16_t JaguarReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
+// Word read, without the memory read hooks
+static uint16_t JaguarReadWordAccess(uint32_t offset, uint32_t who)
 {
-	offset &= 0xFFFFFF;
-
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset < 0x800000)
 	{
@@ -2128,6 +2289,18 @@ uint16_t JaguarReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 }
 
 
+uint16_t JaguarReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
+{
+	offset &= 0xFFFFFF;
+	uint16_t data = JaguarReadWordAccess(offset, who);
+
+	if (who != DEBUG)
+		HOOKS_CALL(HOOK_MEMREAD, offset, data, 2, who);
+
+	return data;
+}
+
+
 void JaguarWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 {
 /*	if ((offset & 0x1FFFFF) >= 0xE00 && (offset & 0x1FFFFF) < 0xE18)
@@ -2142,11 +2315,13 @@ void JaguarWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 		WriteLog("JWB: Byte %02X written at %08X by %s\n", data, offset, whoName[who]);//*/
 
 	offset &= 0xFFFFFF;
+	HOOKS_CALL(HOOK_MEMWRITE, offset, data, 1, who);
 
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset < 0x800000)
 	{
 		jaguarMainRAM[offset & (vjs.DRAM_size - 1)] = data;
+		MEMORY_PAGE_WRITTEN(offset & (vjs.DRAM_size - 1));
 		return;
 	}
 	else if ((offset >= 0xDFFF00) && (offset <= 0xDFFFFF))
@@ -2193,6 +2368,7 @@ if (offset == 0x0102)//64*4)
 	WriteLog("Jaguar: Word %04X written to TOC+%02X by %s\n", data, offset-0x2C00, whoName[who]);//*/
 
 	offset &= 0xFFFFFF;
+	HOOKS_CALL(HOOK_MEMWRITE, offset, data, 2, who);
 
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset <= 0x7FFFFE)
@@ -2285,6 +2461,8 @@ if (offset == 0x11D31A + 0x48000 || offset == 0x11D31A)
 
 		jaguarMainRAM[(offset+0) & (vjs.DRAM_size - 1)] = data >> 8;
 		jaguarMainRAM[(offset+1) & (vjs.DRAM_size - 1)] = data & 0xFF;
+		MEMORY_PAGE_WRITTEN((offset+0) & (vjs.DRAM_size - 1));
+		MEMORY_PAGE_WRITTEN((offset+1) & (vjs.DRAM_size - 1));
 		return;
 	}
 	else if (offset >= 0xDFFF00 && offset <= 0xDFFFFE)
@@ -2311,13 +2489,30 @@ if (offset == 0x11D31A + 0x48000 || offset == 0x11D31A)
 
 
 // We really should re-do this so that it does *real* 32-bit access... !!! FIX !!!
+// TOM & JERRY do it for their plain registers & local RAM; the DRAM is read by words,
+// in the address order, as the watchpoints see the reads
+// The memory read hooks see the long at once
 uint32_t JaguarReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 {
-	return (JaguarReadWord(offset, who) << 16) | JaguarReadWord(offset+2, who);
+	uint32_t address = offset & 0xFFFFFF;
+	uint32_t data;
+
+	if ((address >= 0xF00000) && (address <= 0xF0FFFC))
+		data = TOMReadLong(address, who);
+	else if ((address >= 0xF10000) && (address <= 0xF1FFFC))
+		data = JERRYReadLong(address, who);
+	else
+		data = (JaguarReadWordAccess(address, who) << 16) | JaguarReadWordAccess((offset + 2) & 0xFFFFFF, who);
+
+	if (who != DEBUG)
+		HOOKS_CALL(HOOK_MEMREAD, address, data, 4, who);
+
+	return data;
 }
 
 
-// We really should re-do this so that it does *real* 32-bit access... !!! FIX !!!
+// Real 32-bit access in the DRAM, and by TOM & JERRY for their plain registers & local RAM
+// The memory write hooks see the long at once
 void JaguarWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 {
 /*	extern bool doDSPDis;
@@ -2329,6 +2524,31 @@ void JaguarWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 /*if (offset == 0x0100)//64*4)
 	WriteLog("M68K: %s wrote dword to VI vector value %08X...\n", whoName[who], data);//*/
 
+	uint32_t address = offset & 0xFFFFFF;
+
+	// First 2M is mirrored in the $0 - $7FFFFF range, the long is not split by the mirror end
+	if ((address <= 0x7FFFFC) && ((address & (vjs.DRAM_size - 1)) <= (vjs.DRAM_size - 4)))
+	{
+		HOOKS_CALL(HOOK_MEMWRITE, address, data, 4, who);
+		address &= (vjs.DRAM_size - 1);
+		SET32(jaguarMainRAM, address, data);
+		MEMORY_PAGE_WRITTEN(address);
+		MEMORY_PAGE_WRITTEN(address + 3);
+		return;
+	}
+	else if ((address >= 0xF00000) && (address <= 0xF0FFFC))
+	{
+		HOOKS_CALL(HOOK_MEMWRITE, address, data, 4, who);
+		TOMWriteLong(address, data, who);
+		return;
+	}
+	else if ((address >= 0xF10000) && (address <= 0xF1FFFC))
+	{
+		HOOKS_CALL(HOOK_MEMWRITE, address, data, 4, who);
+		JERRYWriteLong(address, data, who);
+		return;
+	}
+
 	JaguarWriteWord(offset, data >> 16, who);
 	JaguarWriteWord(offset+2, data & 0xFFFF, who);
 }
@@ -2353,6 +2573,9 @@ void JaguarSetScreenPitch(uint32_t pitch)
 //
 void JaguarInit(void)
 {
+	// Back the memory space with huge pages if requested (done before anything is written into it)
+	HostTuningBackMemory(jagMemSpace, 0xF20000, "jagMemSpace");
+
 	// For randomizing RAM
 	srand((unsigned int)time(NULL));
 
@@ -2405,6 +2628,11 @@ void JaguarReset(void)
 
 	// New timer base code stuffola...
 	InitializeEventList();
+	jaguarFrameCount = 0;
+	ReverseReset();
+	SanitizerReset();
+	DebugPortReset();
+	BusReset();
 //Need to change this so it uses the single RAM space and load the BIOS
 //into it somewhere...
 //Also, have to change this here and in JaguarReadXX() currently
@@ -2537,6 +2765,15 @@ void JaguarDone(void)
 	M68K_show_context();
 //#endif
 
+#ifdef OPCODE_STATS
+	// Opcode histograms of the session, in the screenshots folder
+	char opcodeStatsPath[MAX_PATH + 32];
+	sprintf(opcodeStatsPath, "%svj_opcodestats", vjs.screenshotPath);
+	OpcodeStatsDumpCSV(opcodeStatsPath);
+	strcat(opcodeStatsPath, ".prof");
+	OpcodeStatsExportProfile(opcodeStatsPath);
+#endif
+
 	CDROMDone();
 	GPUDone();
 	DSPDone();
@@ -2613,6 +2850,7 @@ uint8_t * GetRamPtr(void)
 //
 void JaguarExecuteNew(void)
 {
+	HOOKS_CALL(HOOK_FRAMESTART, jaguarFrameCount, 0, 0, 0);
 	frameDone = false;
 
 	do
@@ -2620,14 +2858,29 @@ void JaguarExecuteNew(void)
 		double timeToNextEvent = GetTimeToNextEvent();
 //WriteLog("JEN: Time to next event (%u) is %f usec (%u RISC cycles)...\n", nextEvent, timeToNextEvent, USEC_TO_RISC_CYCLES(timeToNextEvent));
 
-		m68k_execute(USEC_TO_M68K_CYCLES(timeToNextEvent));
+		uint32_t m68kCycles = USEC_TO_M68K_CYCLES(timeToNextEvent);
+		uint32_t m68kStall = BusStall(M68K, m68kCycles);
+		watchpointMaster = M68K;
+
+		// The 68K can wait for the bus along the whole slice
+		if (!m68kStall || (m68kCycles > m68kStall))
+			BusCharge(M68K, m68k_execute(m68kCycles - m68kStall));
 
 		if (vjs.GPUEnabled)
-			GPUExec(USEC_TO_RISC_CYCLES(timeToNextEvent));
+		{
+			uint32_t gpuCycles = USEC_TO_RISC_CYCLES(timeToNextEvent);
+			watchpointMaster = GPU;
+			GPUExec(gpuCycles - BusStall(GPU, gpuCycles));
+			BusChargeAccesses(GPU);
+		}
 
+		watchpointMaster = JAGUAR;
 		HandleNextEvent();
  	}
 	while (!frameDone);
+
+	HOOKS_CALL(HOOK_FRAMEEND, jaguarFrameCount, 0, 0, 0);
+	jaguarFrameCount++;
 }
 
 
@@ -2720,12 +2973,20 @@ int	JaguarStepInto(void)
 	int cycles;
 	//	double timeToNextEvent = GetTimeToNextEvent();
 
+	ReverseBeginOp(REVERSE_OP_STEP);
+	watchpointMaster = M68K;
 	cycles = m68k_execute(USEC_TO_M68K_CYCLES(0));
 //	m68k_execute(USEC_TO_M68K_CYCLES(timeToNextEvent));
 
 	if (vjs.GPUEnabled)
+	{
+		watchpointMaster = GPU;
 		GPUExec(USEC_TO_RISC_CYCLES(0));
-	
+	}
+
+	watchpointMaster = JAGUAR;
+	ReverseEndOp();
+
 //	HandleNextEvent();
 #ifdef _MSC_VER
 #pragma message("Warning: !!! Need to verify the Jaguar Step Into function !!!")
@@ -2783,15 +3044,16 @@ void HalflineCallback(void)
 	TOMWriteWord(0xF00006, vc, JAGUAR);
 
 	// Time for Vertical Interrupt?
-	if ((vc & 0x7FF) == vi && (vc & 0x7FF) > 0 && TOMIRQEnabled(IRQ_VIDEO))
+	if ((vc & 0x7FF) == vi && (vc & 0x7FF) > 0)
 	{
 		// We don't have to worry about autovectors & whatnot because the Jaguar
 		// tells you through its HW registers who sent the interrupt...
-		TOMSetPendingVideoInt();
-		m68k_set_irq(2);
+		InterruptTOMRequest(IRQ_VIDEO);
 	}
 
 	TOMExecHalfline(vc, true);
+	BusHalfline();
+	HOOKS_CALL(HOOK_HALFLINE, vc, 0, 0, 0);
 
 //Change this to VBB???
 //Doesn't seem to matter (at least for Flip Out & I-War)
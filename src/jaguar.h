@@ -34,6 +34,7 @@ extern void JaguarWriteLong(uint32_t offset, uint32_t data, uint32_t who = UNKNO
 
 extern bool JaguarInterruptHandlerIsValid(uint32_t i);
 extern void JaguarDasm(uint32_t offset, uint32_t qt);
+extern bool M68KTracebackRepeat(uint64_t count, uint64_t times);
 
 extern void JaguarExecuteNew(void);
 extern int JaguarStepInto(void);
@@ -49,6 +50,8 @@ extern bool bpmActive, bpmSaveActive;
 extern size_t bpmHitCounts;
 extern uint32_t bpmAddress1;
 extern bool startM68KTracing;
+extern uint32_t jaguarFrameCount;
+extern bool lowerField;
 extern S_BrkInfo *brkInfo;
 extern size_t brkNbr;
 
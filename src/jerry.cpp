@@ -16,6 +16,17 @@
 // ---  ----------  -----------------------------------------------------------
 // JLH  11/25/2009  Major rewrite of memory subsystem and handlers
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Timers interrupts requested to the interrupt controller
+// JPM   Oct./2026  Registers accesses dispatched from a register classes map
+// JPM   Oct./2026  Butch word clock from the RISC cycles, and stopped with the Butch I2S path
+// JPM   Oct./2026  Timers underflows anchored to the RISC cycles, and counters reads
+// JPM   Oct./2026  Asynchronous serial interface registers dispatched to the UART
+// JPM   Oct./2026  Timers counters read & timers reloaded after the DSP cycles run in its slice
+// JPM   Oct./2026  Butch word clock remainder in the save state
+// JPM   Oct./2026  Native long accesses for the plain registers & the DSP local RAM
+// JPM   Oct./2026  Butch word clock remainder in its own substate, the older states loaded
+// JPM   Oct./2026  68K & GPU timers accesses placed after the cycles run in their slice
+// JPM   Oct./2026  Interrupt latches & enables moved to the interrupt controller
 //
 
 // ------------------------------------------------------------
@@ -161,11 +172,14 @@
 
 #include <string.h>								// For memcpy
 //#include <math.h>
+#include "asi.h"
 #include "cdrom.h"
 #include "dac.h"
 #include "dsp.h"
 #include "eeprom.h"
 #include "event.h"
+#include "gpu.h"
+#include "interrupt.h"
 #include "jaguar.h"
 #include "joystick.h"
 #include "log.h"
@@ -179,6 +193,11 @@
 
 //Note that 44100 Hz requires samples every 22.675737 usec.
 //#define JERRY_DEBUG
+// Registers accesses log, set by the debug builds
+//#define JERRY_REGISTER_LOG
+#if defined(_DEBUG) && !defined(JERRY_REGISTER_LOG)
+#define JERRY_REGISTER_LOG
+#endif
 
 /*static*/ uint8_t jerry_ram_8[0x10000];
 
@@ -208,24 +227,57 @@ static uint32_t JERRYPIT2Prescaler;
 static uint32_t JERRYPIT2Divider;
 static int32_t jerry_timer_1_counter;
 static int32_t jerry_timer_2_counter;
+// Timers next underflow, in RISC cycles of the JERRY events list time (0: stopped)
+// The counters are evaluated from them when read, and the underflows never drift from the cycles
+enum { JERRY_PIT1 = 0, JERRY_PIT2, JERRY_PITS };
+static uint64_t jerryPITUnderflow[JERRY_PITS];
+static bool jerryPITResync = false;				// Underflows to be taken back from the loaded events
 
 //uint32_t JERRYI2SInterruptDivide = 8;
 int32_t JERRYI2SInterruptTimer = -1;
 uint32_t jerryI2SCycles;
+// Butch word clock (44.1 kHz): RISC cycles remainder of the last word period
+#define JERRY_I2S_BUTCH_RATE	44100
+static uint32_t jerryI2SButchRemainder = 0;
 uint32_t jerryIntPending;
 
-static uint16_t jerryInterruptMask = 0;
-static uint16_t jerryPendingInterrupt = 0;
+
+// Register space dispatch
+// Each byte of the JERRY space ($F10000 - $F1FFFF) has a register class, from the registers ranges;
+// the class gives the handlers for each access width, the word handler is used for the words starting
+// at this byte. The long handlers are used for the aligned longs of a class, without them a long is two words
+enum { JERRY_REG_RAM = 0, JERRY_REG_TIMER, JERRY_REG_TIMER_COUNT, JERRY_REG_INT, JERRY_REG_ASI, JERRY_REG_JOYSTICK, JERRY_REG_EEPROM, JERRY_REG_DSP, JERRY_REG_DSP_RAM, JERRY_REG_DAC, JERRY_REG_CLASSES };
+
+struct JERRYRegisterClass
+{
+	uint8_t (* readByte)(uint32_t offset, uint32_t who);
+	uint16_t (* readWord)(uint32_t offset, uint32_t who);
+	uint32_t (* readLong)(uint32_t offset, uint32_t who);
+	void (* writeByte)(uint32_t offset, uint8_t data, uint32_t who);
+	void (* writeWord)(uint32_t offset, uint16_t data, uint32_t who);
+	void (* writeLong)(uint32_t offset, uint32_t data, uint32_t who);
+};
+
+struct JERRYRegisterRange
+{
+	uint32_t start, end;
+	uint8_t regClass;
+};
+
+static uint8_t jerryRegisterMap[0x10000];
 
 // Private function prototypes
 
-void JERRYResetPIT1(void);
-void JERRYResetPIT2(void);
+void JERRYResetPIT1(uint32_t who);
+void JERRYResetPIT2(uint32_t who);
+static void JERRYResetPIT(uint32_t pit, uint32_t who);
 void JERRYResetI2S(void);
 
 void JERRYPIT1Callback(void);
 void JERRYPIT2Callback(void);
 void JERRYI2SCallback(void);
+static double JERRYI2SButchPeriod(void);
+static void JERRYInitRegisterMap(void);
 
 size_t jerry_dump(FILE *fp)
 {
@@ -240,8 +292,9 @@ size_t jerry_dump(FILE *fp)
 	DUMPS32(JERRYI2SInterruptTimer);
 	DUMP32(jerryI2SCycles);
 	DUMP32(jerryIntPending);
-	DUMP16(jerryInterruptMask);
-	DUMP16(jerryPendingInterrupt);
+	uint16_t enabled = InterruptEnabled(INTERRUPT_JERRY), pending = InterruptPending(INTERRUPT_JERRY);
+	DUMP16(enabled);
+	DUMP16(pending);
 	DUMPARR8(jerry_ram_8);
 
 	return total_dumped;
@@ -260,9 +313,37 @@ size_t jerry_load(FILE *fp)
 	LOADS32(JERRYI2SInterruptTimer);
 	LOAD32(jerryI2SCycles);
 	LOAD32(jerryIntPending);
-	LOAD16(jerryInterruptMask);
-	LOAD16(jerryPendingInterrupt);
+	uint16_t enabled, pending;
+	LOAD16(enabled);
+	LOAD16(pending);
+	InterruptSetEnabled(INTERRUPT_JERRY, enabled);
+	InterruptSetPending(INTERRUPT_JERRY, pending);
 	LOADARR8(jerry_ram_8);
+	jerryPITResync = true;
+	// States without the Butch word clock substate
+	jerryI2SButchRemainder = 0;
+
+	return total_loaded;
+}
+
+
+//
+// Butch word clock substate, apart from the JERRY one which keeps its size
+//
+size_t jerryi2s_dump(FILE *fp)
+{
+	size_t total_dumped = 0;
+
+	DUMP32(jerryI2SButchRemainder);
+
+	return total_dumped;
+}
+
+size_t jerryi2s_load(FILE *fp)
+{
+	size_t total_loaded = 0;
+
+	LOAD32(jerryI2SButchRemainder);
 
 	return total_loaded;
 }
@@ -277,27 +358,159 @@ void JERRYResetI2S(void)
 }
 
 
-void JERRYResetPIT1(void)
+//
+// RISC cycle duration, and the JERRY events list time in RISC cycles
+//
+static inline double JERRYCycleInUsec(void)
+{
+	return (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+}
+
+
+//
+// The processors run along the lists, their reads & writes are placed after the cycles they have run
+// in their slice; the 68K runs at half the RISC clock, and is in its slice while it has cycles left
+//
+static uint64_t JERRYCycles(uint32_t who)
+{
+	uint64_t cycles = (uint64_t)((GetEventListTime(EVENT_JERRY) / JERRYCycleInUsec()) + 0.5);
+
+	if (who == DSP)
+		return cycles + DSPCyclesRun();
+
+	if (who == GPU)
+		return cycles + GPUCyclesRun();
+
+	if ((who == M68K) && (m68k_cycles_remaining() > 0))
+		return cycles + ((uint64_t)m68k_cycles_run() * 2);
+
+	return cycles;
+}
+
+
+//
+// Timer period in RISC cycles, 0 if the timer is stopped
+//
+static uint64_t JERRYPITPeriod(uint32_t pit)
+{
+	uint32_t prescaler = (pit == JERRY_PIT1 ? JERRYPIT1Prescaler : JERRYPIT2Prescaler);
+	uint32_t divider = (pit == JERRY_PIT1 ? JERRYPIT1Divider : JERRYPIT2Divider);
+
+	if (!(prescaler | divider))
+		return 0;
+
+	return (uint64_t)(prescaler + 1) * (uint64_t)(divider + 1);
+}
+
+
+//
+// Take back the timers underflows from their events, after a state load
+// An event already handled (its callback running) gives no underflow, the callback sets it
+//
+static void JERRYPITResyncUnderflows(void)
 {
-	RemoveCallback(JERRYPIT1Callback);
+	static void (* const callback[JERRY_PITS])(void) = { JERRYPIT1Callback, JERRYPIT2Callback };
+	uint64_t now = JERRYCycles(JERRY);
+	jerryPITResync = false;
 
-	if (JERRYPIT1Prescaler | JERRYPIT1Divider)
+	for (uint32_t pit = 0; pit < JERRY_PITS; pit++)
 	{
-		double usecs = (float)(JERRYPIT1Prescaler + 1) * (float)(JERRYPIT1Divider + 1) * RISC_CYCLE_IN_USEC;
-		SetCallbackTime(JERRYPIT1Callback, usecs, EVENT_JERRY);
+		double time = GetCallbackTime(callback[pit]);
+		jerryPITUnderflow[pit] = ((time < 0.0) ? 0 : now + (uint64_t)((time / JERRYCycleInUsec()) + 0.5));
 	}
 }
 
 
-void JERRYResetPIT2(void)
+//
+// Schedule the timer underflow
+// The event time is taken from the underflow cycle, so its rounding is not carried to the next one
+//
+static void JERRYSchedulePIT(uint32_t pit)
+{
+	double usecs = ((double)jerryPITUnderflow[pit] * JERRYCycleInUsec()) - GetEventListTime(EVENT_JERRY);
+	SetCallbackTime((pit == JERRY_PIT1 ? JERRYPIT1Callback : JERRYPIT2Callback), (usecs < 0.0 ? 0.0 : usecs), EVENT_JERRY);
+}
+
+
+//
+// Timer (re)started from now, with its programmed period
+//
+static void JERRYResetPIT(uint32_t pit, uint32_t who)
+{
+	uint64_t period = JERRYPITPeriod(pit);
+
+	if (jerryPITResync)
+		JERRYPITResyncUnderflows();
+
+	RemoveCallback(pit == JERRY_PIT1 ? JERRYPIT1Callback : JERRYPIT2Callback);
+	jerryPITUnderflow[pit] = (period ? JERRYCycles(who) + period : 0);
+
+	if (period)
+		JERRYSchedulePIT(pit);
+}
+
+
+void JERRYResetPIT1(uint32_t who)
+{
+	JERRYResetPIT(JERRY_PIT1, who);
+}
+
+
+void JERRYResetPIT2(uint32_t who)
+{
+	JERRYResetPIT(JERRY_PIT2, who);
+}
+
+
+//
+// Timer underflow handled, the next one is a period after it
+//
+static void JERRYPITUnderflowed(uint32_t pit)
+{
+	uint64_t period = JERRYPITPeriod(pit);
+
+	if (jerryPITResync)
+		JERRYPITResyncUnderflows();
+
+	if (!jerryPITUnderflow[pit])
+		jerryPITUnderflow[pit] = JERRYCycles(JERRY);
+
+	jerryPITUnderflow[pit] = (period ? jerryPITUnderflow[pit] + period : 0);
+
+	if (period)
+		JERRYSchedulePIT(pit);
+}
+
+
+//
+// Timer counters read ($F10036 - $F1003D)
+// Prescaler & divider counts down from the underflow; a stopped timer gives its programmed values
+//
+static uint16_t JERRYReadTimerCountWord(uint32_t offset, uint32_t who)
 {
-	RemoveCallback(JERRYPIT2Callback);
+	uint32_t pit = ((offset & 0x0F) < 0x0A ? JERRY_PIT1 : JERRY_PIT2);
+	uint64_t prescaler = (pit == JERRY_PIT1 ? JERRYPIT1Prescaler : JERRYPIT2Prescaler);
+	uint64_t divider = (pit == JERRY_PIT1 ? JERRYPIT1Divider : JERRYPIT2Divider);
+
+	if (jerryPITResync)
+		JERRYPITResyncUnderflows();
 
-	if (JERRYPIT1Prescaler | JERRYPIT1Divider)
+	if (jerryPITUnderflow[pit])
 	{
-		double usecs = (float)(JERRYPIT2Prescaler + 1) * (float)(JERRYPIT2Divider + 1) * RISC_CYCLE_IN_USEC;
-		SetCallbackTime(JERRYPIT2Callback, usecs, EVENT_JERRY);
+		uint64_t now = JERRYCycles(who);
+		uint64_t remaining = ((jerryPITUnderflow[pit] > now) ? (jerryPITUnderflow[pit] - now - 1) : 0);
+		divider = remaining / (prescaler + 1);
+		prescaler = remaining % (prescaler + 1);
 	}
+
+	return (uint16_t)((offset & 0x02) ? prescaler : divider);
+}
+
+
+static uint8_t JERRYReadTimerCountByte(uint32_t offset, uint32_t who)
+{
+	uint16_t value = JERRYReadTimerCountWord(offset & ~0x01, who);
+	return (uint8_t)((offset & 0x01) ? value : (value >> 8));
 }
 
 
@@ -310,18 +523,14 @@ void JERRYPIT1Callback(void)
 //WriteLog("JERRY: In PIT1 callback, IRQM=$%04X\n", jerryInterruptMask);
 	if (TOMIRQEnabled(IRQ_DSP))
 	{
-		if (jerryInterruptMask & IRQ2_TIMER1)		// CPU Timer 1 IRQ
-		{
 // Not sure, but I think we don't generate another IRQ if one's already going...
 // But this seems to work... :-/
-			jerryPendingInterrupt |= IRQ2_TIMER1;
-			m68k_set_irq(2);						// Generate 68K IPL 2
-		}
+		InterruptJERRYRequest(IRQ2_TIMER1);		// CPU Timer 1 IRQ, generate 68K IPL 2
 	}
 #endif
 
 	DSPSetIRQLine(DSPIRQ_TIMER0, ASSERT_LINE);	// This does the 'IRQ enabled' checking...
-	JERRYResetPIT1();
+	JERRYPITUnderflowed(JERRY_PIT1);
 }
 
 
@@ -331,16 +540,12 @@ void JERRYPIT2Callback(void)
 	if (TOMIRQEnabled(IRQ_DSP))
 	{
 //WriteLog("JERRY: In PIT2 callback, IRQM=$%04X\n", jerryInterruptMask);
-		if (jerryInterruptMask & IRQ2_TIMER2)		// CPU Timer 2 IRQ
-		{
-			jerryPendingInterrupt |= IRQ2_TIMER2;
-			m68k_set_irq(2);						// Generate 68K IPL 2
-		}
+		InterruptJERRYRequest(IRQ2_TIMER2);		// CPU Timer 2 IRQ, generate 68K IPL 2
 	}
 #endif
 
 	DSPSetIRQLine(DSPIRQ_TIMER1, ASSERT_LINE);	// This does the 'IRQ enabled' checking...
-	JERRYResetPIT2();
+	JERRYPITUnderflowed(JERRY_PIT2);
 }
 
 
@@ -391,20 +596,56 @@ void JERRYI2SCallback(void)
 			jerry_i2s_interrupt_timer += 602;
 		}*/
 
+		// Without the Butch I2S path there is no word clock, Butch restarts it (JERRYI2SWake)
 		if (ButchIsReadyToSend())//Not sure this is right spot to check...
 		{
 //	return GetWordFromButchSSI(offset, who);
 			SetSSIWordsXmittedFromButch();
 			DSPSetIRQLine(DSPIRQ_SSI, ASSERT_LINE);
+			SetCallbackTime(JERRYI2SCallback, JERRYI2SButchPeriod(), EVENT_JERRY);
 		}
+	}
+}
+
+
+//
+// Butch word period, a whole number of RISC cycles; the remainders are carried
+// over so the words average 44.1 kHz exactly
+//
+static double JERRYI2SButchPeriod(void)
+{
+	uint32_t cycles = (vjs.hardwareTypeNTSC ? RISC_CLOCK_RATE_NTSC : RISC_CLOCK_RATE_PAL) + jerryI2SButchRemainder;
+	jerryI2SButchRemainder = cycles % JERRY_I2S_BUTCH_RATE;
+	return (double)(cycles / JERRY_I2S_BUTCH_RATE) * (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+}
+
+
+//
+// Restart the stopped word clock, from the next word
+// Called when Butch I2S path is enabled, or when the serial mode changes
+//
+void JERRYI2SWake(void)
+{
+	// Not started yet by a SCLK write
+	if (!jerryI2SCycles || (GetCallbackTime(JERRYI2SCallback) >= 0.0))
+	{
+		return;
+	}
 
-		SetCallbackTime(JERRYI2SCallback, 22.675737, EVENT_JERRY);
+	if (smode & SMODE_INTERNAL)
+	{
+		JERRYI2SCallback();
+	}
+	else if (ButchIsReadyToSend())
+	{
+		SetCallbackTime(JERRYI2SCallback, JERRYI2SButchPeriod(), EVENT_JERRY);
 	}
 }
 
 
 void JERRYInit(void)
 {
+	JERRYInitRegisterMap();
 	JoystickInit();
 	MTInit();
 	memcpy(&jerry_ram_8[0xD000], waveTableROM, 0x1000);
@@ -413,8 +654,7 @@ void JERRYInit(void)
 	JERRYPIT2Prescaler = 0xFFFF;
 	JERRYPIT1Divider = 0xFFFF;
 	JERRYPIT2Divider = 0xFFFF;
-	jerryInterruptMask = 0x0000;
-	jerryPendingInterrupt = 0x0000;
+	InterruptReset(INTERRUPT_JERRY);
 
 	DACInit();
 }
@@ -426,6 +666,7 @@ void JERRYReset(void)
 	EepromReset();
 	MTReset();
 	JERRYResetI2S();
+	ASIReset();
 
 	memset(jerry_ram_8, 0x00, 0xD000);		// Don't clear out the Wavetable ROM...!
 	JERRYPIT1Prescaler = 0xFFFF;
@@ -434,8 +675,11 @@ void JERRYReset(void)
 	JERRYPIT2Divider = 0xFFFF;
 	jerry_timer_1_counter = 0;
 	jerry_timer_2_counter = 0;
-	jerryInterruptMask = 0x0000;
-	jerryPendingInterrupt = 0x0000;
+	jerryPITUnderflow[JERRY_PIT1] = jerryPITUnderflow[JERRY_PIT2] = 0;
+	jerryPITResync = false;
+	InterruptReset(INTERRUPT_JERRY);
+	jerryI2SCycles = 0;
+	jerryI2SButchRemainder = 0;
 
 	DACReset();
 }
@@ -449,24 +693,10 @@ void JERRYDone(void)
 	DACDone();
 	EepromDone();
 	MTDone();
+	ASIDone();
 }
 
 
-bool JERRYIRQEnabled(int irq)
-{
-	// Read the word @ $F10020
-//	return jerry_ram_8[0x21] & (1 << irq);
-	return jerryInterruptMask & irq;
-}
-
-
-void JERRYSetPendingIRQ(int irq)
-{
-	// This is the shadow of INT (it's a split RO/WO register)
-//	jerryIntPending |= (1 << irq);
-	jerryPendingInterrupt |= irq;
-}
-
 //
 // Dump all JERRY register values to the log
 //
@@ -492,6 +722,271 @@ void JERRYDumpIORegistersToLog(void)
 }
 
 
+//
+// Interrupt control read & write (JINTCTRL)
+//
+static uint16_t JERRYReadINTWord(uint32_t offset, uint32_t who)
+{
+	if (offset == 0xF10020)
+//		return jerryIntPending;
+		return InterruptPending(INTERRUPT_JERRY);
+
+	offset &= 0xFFFF;
+	return ((uint16_t)jerry_ram_8[offset] << 8) | jerry_ram_8[(offset + 1) & 0xFFFF];
+}
+
+
+static void JERRYWriteINTByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	if (offset == 0xF10020)
+	{
+		// Clear pending interrupts...
+		InterruptAcknowledge(INTERRUPT_JERRY, data);
+	}
+	else if (offset == 0xF10021)
+		InterruptSetEnabled(INTERRUPT_JERRY, data);
+//WriteLog("JERRY: (68K int en/lat - Unhandled!) Tried to write $%02X to $%08X!\n", data, offset);
+}
+
+
+static void JERRYWriteINTWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	InterruptSetEnabled(INTERRUPT_JERRY, data & 0xFF);
+	InterruptAcknowledge(INTERRUPT_JERRY, data >> 8);
+//WriteLog("JERRY: (68K int en/lat - Unhandled!) Tried to write $%04X to $%08X!\n", data, offset);
+}
+
+
+//
+// PIT prescalers & dividers write
+//
+static void JERRYWriteTimerWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	switch(offset & 0x07)
+	{
+	case 0:
+		JERRYPIT1Prescaler = data;
+		JERRYResetPIT1(who);
+		break;
+	case 2:
+		JERRYPIT1Divider = data;
+		JERRYResetPIT1(who);
+		break;
+	case 4:
+		JERRYPIT2Prescaler = data;
+		JERRYResetPIT2(who);
+		break;
+	case 6:
+		JERRYPIT2Divider = data;
+		JERRYResetPIT2(who);
+	}
+	// Need to handle (unaligned) cases???
+}
+
+
+//
+// Joystick read & write ($F14000 - $F14003), the EEPROM shares the addresses
+//
+static uint8_t JERRYReadJoystickByte(uint32_t offset, uint32_t who)
+{
+//	return JoystickReadByte(offset) | EepromReadByte(offset);
+	uint16_t value = JoystickReadWord(offset & 0xFE);
+
+	if (offset & 0x01)
+		value &= 0xFF;
+	else
+		value >>= 8;
+
+	// This is wrong, should only have the lowest bit from $F14001
+	return value | EepromReadByte(offset);
+}
+
+
+static uint16_t JERRYReadJoystickWord(uint32_t offset, uint32_t who)
+{
+	if (offset == 0xF14000)
+		return (JoystickReadWord(offset) & 0xFFFE) | EepromReadWord(offset);
+	else if (offset == 0xF14002)
+		return JoystickReadWord(offset);
+
+	return EepromReadWord(offset);
+}
+
+
+static void JERRYWriteJoystickByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+//	JoystickWriteByte(offset, data);
+	JoystickWriteWord(offset & 0xFE, (uint16_t)data);
+// This is wrong, EEPROM is never written here
+	EepromWriteByte(offset, data);
+}
+
+
+static void JERRYWriteJoystickWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	if (offset < 0xF14003)
+		JoystickWriteWord(offset, data);
+
+	EepromWriteWord(offset, data);
+}
+
+
+//
+// EEPROM read & write ($F14004 - $F1A0FF)
+//
+static uint8_t JERRYReadEepromByte(uint32_t offset, uint32_t who)
+{
+	return EepromReadByte(offset);
+}
+
+
+static uint16_t JERRYReadEepromWord(uint32_t offset, uint32_t who)
+{
+	return EepromReadWord(offset);
+}
+
+
+static void JERRYWriteEepromByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	EepromWriteByte(offset, data);
+}
+
+
+static void JERRYWriteEepromWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	EepromWriteWord(offset, data);
+}
+
+
+//
+// DAC read & write
+// LRXD/RRXD/SSTAT $F1A148/4C/50 for the reads, LTXD/RTXD/SCLK/SMODE $F1A148/4C/50/54 for the writes
+// (really 16-bit registers...)
+//
+static uint8_t JERRYReadDACByte(uint32_t offset, uint32_t who)
+{
+	if (offset <= 0xF1A153)
+		return DACReadByte(offset, who);
+
+	return jerry_ram_8[offset & 0xFFFF];
+}
+
+
+static uint16_t JERRYReadDACWord(uint32_t offset, uint32_t who)
+{
+	if (offset <= 0xF1A153)
+		return DACReadWord(offset, who);
+
+	offset &= 0xFFFF;
+	return ((uint16_t)jerry_ram_8[offset] << 8) | jerry_ram_8[(offset + 1) & 0xFFFF];
+}
+
+
+static void JERRYWriteDACWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+//NOTE: SCLK should be taken care of in DAC...
+	if (offset <= 0xF1A156)
+		DACWriteWord(offset, data, who);
+}
+
+
+//
+// Register classes
+// A NULL handler is a plain access to the JERRY RAM, without side effects
+//
+static const JERRYRegisterClass jerryRegisterClass[JERRY_REG_CLASSES] =
+{
+	{ NULL, NULL, NULL, NULL, NULL, NULL },																	// JERRY_REG_RAM
+	{ NULL, NULL, NULL, NULL, JERRYWriteTimerWord, NULL },														// JERRY_REG_TIMER
+	{ JERRYReadTimerCountByte, JERRYReadTimerCountWord, NULL, NULL, NULL, NULL },								// JERRY_REG_TIMER_COUNT
+	{ NULL, JERRYReadINTWord, NULL, JERRYWriteINTByte, JERRYWriteINTWord, NULL },								// JERRY_REG_INT
+	{ ASIReadByte, ASIReadWord, NULL, ASIWriteByte, ASIWriteWord, NULL },										// JERRY_REG_ASI
+	{ JERRYReadJoystickByte, JERRYReadJoystickWord, NULL, JERRYWriteJoystickByte, JERRYWriteJoystickWord, NULL },	// JERRY_REG_JOYSTICK
+	{ JERRYReadEepromByte, JERRYReadEepromWord, NULL, JERRYWriteEepromByte, JERRYWriteEepromWord, NULL },		// JERRY_REG_EEPROM
+	{ DSPReadByte, DSPReadWord, NULL, DSPWriteByte, DSPWriteWord, NULL },										// JERRY_REG_DSP
+	{ DSPReadByte, DSPReadWord, DSPReadLong, DSPWriteByte, DSPWriteWord, DSPWriteLong },						// JERRY_REG_DSP_RAM
+	{ JERRYReadDACByte, JERRYReadDACWord, NULL, DACWriteByte, JERRYWriteDACWord, NULL }						// JERRY_REG_DAC
+};
+
+
+//
+// Register ranges, the map is generated from them
+//
+static const JERRYRegisterRange jerryRegisterRange[] =
+{
+	{ 0xF10000, 0xF10007, JERRY_REG_TIMER },
+	{ 0xF10020, 0xF10022, JERRY_REG_INT },
+	{ 0xF10030, 0xF10035, JERRY_REG_ASI },
+	{ 0xF10036, 0xF1003D, JERRY_REG_TIMER_COUNT },
+	{ 0xF14000, 0xF14003, JERRY_REG_JOYSTICK },
+	{ 0xF14004, 0xF1A0FF, JERRY_REG_EEPROM },
+	{ DSP_CONTROL_RAM_BASE, DSP_CONTROL_RAM_BASE + 0x1F, JERRY_REG_DSP },
+	{ 0xF1A148, 0xF1A157, JERRY_REG_DAC },
+	{ DSP_WORK_RAM_BASE, DSP_WORK_RAM_BASE + 0x1FFF, JERRY_REG_DSP_RAM }
+};
+
+
+//
+// Generate the register map
+//
+static void JERRYInitRegisterMap(void)
+{
+	memset(jerryRegisterMap, JERRY_REG_RAM, sizeof(jerryRegisterMap));
+
+	for (uint32_t i = 0; i < (sizeof(jerryRegisterRange) / sizeof(jerryRegisterRange[0])); i++)
+		memset(&jerryRegisterMap[jerryRegisterRange[i].start & 0xFFFF], jerryRegisterRange[i].regClass, jerryRegisterRange[i].end - jerryRegisterRange[i].start + 1);
+}
+
+
+#ifdef JERRY_REGISTER_LOG
+//
+// Registers accesses log, on top of the handlers
+//
+static void JERRYLogRead(uint32_t offset, const char * size)
+{
+	if ((offset >= 0xF10036) && (offset <= 0xF1003D))
+		WriteLog("JERRY: Timer counter read (%s) at %08X: $%04X\n", size, offset, JERRYReadTimerCountWord(offset & ~0x01, UNKNOWN));
+}
+
+
+static void JERRYLogWriteByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	if (offset >= 0xF10000 && offset <= 0xF10007)
+		WriteLog("JERRY: Unhandled timer write (BYTE) at %08X...\n", offset);
+	else if ((offset >= 0xF14000) && (offset <= 0xF14003))
+		WriteLog("JERRYWriteByte: Unhandled byte write to JOYSTICK by %s.\n", whoName[who]);
+}
+
+
+static void JERRYLogWriteWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	if (offset == 0xF10000)
+		WriteLog("JERRY: JPIT1 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10002)
+		WriteLog("JERRY: JPIT2 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10004)
+		WriteLog("JERRY: JPIT3 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10006)
+		WriteLog("JERRY: JPIT4 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10010)
+		WriteLog("JERRY: CLK1 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10012)
+		WriteLog("JERRY: CLK2 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10014)
+		WriteLog("JERRY: CLK3 word written by %s: %u\n", whoName[who], data);
+//	else if (offset == 0xF1A100)
+//		WriteLog("JERRY: D_FLAGS word written by %s: %u\n", whoName[who], data);
+//	else if (offset == 0xF1A102)
+//		WriteLog("JERRY: D_FLAGS+2 word written by %s: %u\n", whoName[who], data);
+	else if (offset == 0xF10020)
+		WriteLog("JERRY: JINTCTRL word written by %s: $%04X (%s%s%s%s%s%s)\n", whoName[who], data,
+			(data & 0x01 ? "Extrnl " : ""), (data & 0x02 ? "DSP " : ""),
+			(data & 0x04 ? "Timer0 " : ""), (data & 0x08 ? "Timer1 " : ""),
+			(data & 0x10 ? "ASI " : ""), (data & 0x20 ? "I2S " : ""));
+}
+#endif
+
+
 //
 // JERRY byte access (read)
 //
@@ -500,47 +995,17 @@ uint8_t JERRYReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("JERRY: Reading byte at %06X\n", offset);
 #endif
-	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE+0x20))
-		return DSPReadByte(offset, who);
-	else if ((offset >= DSP_WORK_RAM_BASE) && (offset < DSP_WORK_RAM_BASE+0x2000))
-		return DSPReadByte(offset, who);
-	// LRXD/RRXD/SSTAT $F1A148/4C/50 (really 16-bit registers...)
-	else if (offset >= 0xF1A148 && offset <= 0xF1A153)
-		return DACReadByte(offset, who);
-//	F10036          R     xxxxxxxx xxxxxxxx   JPIT1 - timer 1 pre-scaler
-//	F10038          R     xxxxxxxx xxxxxxxx   JPIT2 - timer 1 divider
-//	F1003A          R     xxxxxxxx xxxxxxxx   JPIT3 - timer 2 pre-scaler
-//	F1003C          R     xxxxxxxx xxxxxxxx   JPIT4 - timer 2 divider
-//This is WRONG!
-//	else if (offset >= 0xF10000 && offset <= 0xF10007)
-//This is still wrong. What needs to be returned here are the values being counted down
-//in the jerry_timer_n_counter variables... !!! FIX !!! [DONE]
-
-//This is probably the problem with the new timer code... This is invalid
-//under the new system... !!! FIX !!!
-	else if ((offset >= 0xF10036) && (offset <= 0xF1003D))
-	{
-WriteLog("JERRY: Unhandled timer read (BYTE) at %08X...\n", offset);
-	}
+#ifdef JERRY_REGISTER_LOG
+	JERRYLogRead(offset, "BYTE");
+#endif
 //	else if (offset >= 0xF10010 && offset <= 0xF10015)
 //		return clock_byte_read(offset);
 //	else if (offset >= 0xF17C00 && offset <= 0xF17C01)
 //		return anajoy_byte_read(offset);
-	else if (offset >= 0xF14000 && offset <= 0xF14003)
-//		return JoystickReadByte(offset) | EepromReadByte(offset);
-	{
-		uint16_t value = JoystickReadWord(offset & 0xFE);
+	const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
 
-		if (offset & 0x01)
-			value &= 0xFF;
-		else
-			value >>= 8;
-
-		// This is wrong, should only have the lowest bit from $F14001
-		return value | EepromReadByte(offset);
-	}
-	else if (offset >= 0xF14000 && offset <= 0xF1A0FF)
-		return EepromReadByte(offset);
+	if (reg.readByte)
+		return reg.readByte(offset, who);
 
 	return jerry_ram_8[offset & 0xFFFF];
 }
@@ -554,45 +1019,41 @@ uint16_t JERRYReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("JERRY: Reading word at %06X\n", offset);
 #endif
-
-	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE+0x20))
-		return DSPReadWord(offset, who);
-	else if (offset >= DSP_WORK_RAM_BASE && offset <= DSP_WORK_RAM_BASE + 0x1FFF)
-		return DSPReadWord(offset, who);
-	// LRXD/RRXD/SSTAT $F1A148/4C/50 (really 16-bit registers...)
-	else if (offset >= 0xF1A148 && offset <= 0xF1A153)
-		return DACReadWord(offset, who);
-//	F10036          R     xxxxxxxx xxxxxxxx   JPIT1 - timer 1 pre-scaler
-//	F10038          R     xxxxxxxx xxxxxxxx   JPIT2 - timer 1 divider
-//	F1003A          R     xxxxxxxx xxxxxxxx   JPIT3 - timer 2 pre-scaler
-//	F1003C          R     xxxxxxxx xxxxxxxx   JPIT4 - timer 2 divider
-//This is WRONG!
-//	else if ((offset >= 0xF10000) && (offset <= 0xF10007))
-//This is still wrong. What needs to be returned here are the values being counted down
-//in the jerry_timer_n_counter variables... !!! FIX !!! [DONE]
-	else if ((offset >= 0xF10036) && (offset <= 0xF1003D))
-	{
-WriteLog("JERRY: Unhandled timer read (WORD) at %08X...\n", offset);
-	}
+#ifdef JERRY_REGISTER_LOG
+	JERRYLogRead(offset, "WORD");
+#endif
 //	else if ((offset >= 0xF10010) && (offset <= 0xF10015))
 //		return clock_word_read(offset);
-	else if (offset == 0xF10020)
-//		return jerryIntPending;
-		return jerryPendingInterrupt;
 //	else if ((offset >= 0xF17C00) && (offset <= 0xF17C01))
 //		return anajoy_word_read(offset);
-	else if (offset == 0xF14000)
-		return (JoystickReadWord(offset) & 0xFFFE) | EepromReadWord(offset);
-	else if ((offset >= 0xF14002) && (offset < 0xF14003))
-		return JoystickReadWord(offset);
-	else if ((offset >= 0xF14000) && (offset <= 0xF1A0FF))
-		return EepromReadWord(offset);
+	const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
 
-/*if (offset >= 0xF1D000)
-	WriteLog("JERRY: Reading word at %08X [%04X]...\n", offset, ((uint16_t)jerry_ram_8[(offset+0)&0xFFFF] << 8) | jerry_ram_8[(offset+1)&0xFFFF]);//*/
+	if (reg.readWord)
+		return reg.readWord(offset, who);
 
 	offset &= 0xFFFF;				// Prevent crashing...!
-	return ((uint16_t)jerry_ram_8[offset+0] << 8) | jerry_ram_8[offset+1];
+	return ((uint16_t)jerry_ram_8[offset] << 8) | jerry_ram_8[(offset + 1) & 0xFFFF];
+}
+
+
+//
+// JERRY long access (read)
+// Read at once if both words are plain, or by the long handler of their class
+//
+uint32_t JERRYReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
+{
+#if !defined(JERRY_DEBUG) && !defined(JERRY_REGISTER_LOG)
+	const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
+	const JERRYRegisterClass & reg2 = jerryRegisterClass[jerryRegisterMap[(offset + 2) & 0xFFFF]];
+
+	if (!reg.readWord && !reg2.readWord && ((offset & 0xFFFF) <= 0xFFFC))
+		return GET32(jerry_ram_8, offset & 0xFFFF);
+
+	if (reg.readLong && (&reg == &reg2) && !(offset & 0x03))
+		return reg.readLong(offset, who);
+#endif
+
+	return (JERRYReadWord(offset, who) << 16) | JERRYReadWord(offset + 2, who);
 }
 
 
@@ -607,91 +1068,24 @@ void JERRYWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("jerry: writing byte %.2x at 0x%.6x\n",data,offset);
 #endif
-	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE + 0x20))
-	{
-		DSPWriteByte(offset, data, who);
-		return;
-	}
-	else if ((offset >= DSP_WORK_RAM_BASE) && (offset < DSP_WORK_RAM_BASE + 0x2000))
-	{
-		DSPWriteByte(offset, data, who);
-		return;
-	}
-	// SCLK ($F1A150--8 bits wide)
-//NOTE: This should be taken care of in DAC...
-#if 0
-	else if ((offset >= 0xF1A152) && (offset <= 0xF1A153))
-	{
-#if 0
-//		WriteLog("JERRY: Writing %02X to SCLK...\n", data);
-		if ((offset & 0x03) == 2)
-			sclk = (sclk & 0x00FF) | ((uint32_t)data << 8);
-		else
-			sclk = (sclk & 0xFF00) | (uint32_t)data;
-#else
-		sclk = data;
-#endif
-#warning "!!! SCLK should be handled in dac.cpp !!!"
-		JERRYI2SInterruptTimer = -1;
-		RemoveCallback(JERRYI2SCallback);
-		JERRYI2SCallback();
-//		return;
-	}
+#ifdef JERRY_REGISTER_LOG
+	JERRYLogWriteByte(offset, data, who);
 #endif
-	// LTXD/RTXD/SCLK/SMODE $F1A148/4C/50/54 (really 16-bit registers...)
-	else if (offset >= 0xF1A148 && offset <= 0xF1A157)
-	{
-		DACWriteByte(offset, data, who);
-		return;
-	}
-	else if (offset >= 0xF10000 && offset <= 0xF10007)
-	{
-WriteLog("JERRY: Unhandled timer write (BYTE) at %08X...\n", offset);
-		return;
-	}
 /*	else if ((offset >= 0xF10010) && (offset <= 0xF10015))
 	{
 		clock_byte_write(offset, data);
 		return;
 	}//*/
-	// JERRY -> 68K interrupt enables/latches (need to be handled!)
-	else if (offset >= 0xF10020 && offset <= 0xF10021)//WAS:23)
-	{
-		if (offset == 0xF10020)
-		{
-			// Clear pending interrupts...
-			jerryPendingInterrupt &= ~data;
-		}
-		else if (offset == 0xF10021)
-			jerryInterruptMask = data;
-//WriteLog("JERRY: (68K int en/lat - Unhandled!) Tried to write $%02X to $%08X!\n", data, offset);
-//WriteLog("JERRY: (Previous is partially handled... IRQMask=$%04X)\n", jerryInterruptMask);
-	}
 /*	else if ((offset >= 0xF17C00) && (offset <= 0xF17C01))
 	{
 		anajoy_byte_write(offset, data);
 		return;
 	}*/
-	else if ((offset >= 0xF14000) && (offset <= 0xF14003))
-	{
-WriteLog("JERRYWriteByte: Unhandled byte write to JOYSTICK by %s.\n", whoName[who]);
-//		JoystickWriteByte(offset, data);
-		JoystickWriteWord(offset & 0xFE, (uint16_t)data);
-// This is wrong, EEPROM is never written here
-		EepromWriteByte(offset, data);
-		return;
-	}
-	else if ((offset >= 0xF14000) && (offset <= 0xF1A0FF))
-	{
-		EepromWriteByte(offset, data);
-		return;
-	}
-
 //Need to protect write attempts to Wavetable ROM (F1D000-FFF)
-	if (offset >= 0xF1D000 && offset <= 0xF1DFFF)
-		return;
+	const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
 
-//	jerry_ram_8[offset & 0xFFFF] = data;
+	if (reg.writeByte)
+		reg.writeByte(offset, data, who);
 }
 
 
@@ -707,119 +1101,47 @@ void JERRYWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog( "JERRY: Writing word %04X at %06X\n", data, offset);
 #endif
-#if 1
-if (offset == 0xF10000)
-	WriteLog("JERRY: JPIT1 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10002)
-	WriteLog("JERRY: JPIT2 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10004)
-	WriteLog("JERRY: JPIT3 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10006)
-	WriteLog("JERRY: JPIT4 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10010)
-	WriteLog("JERRY: CLK1 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10012)
-	WriteLog("JERRY: CLK2 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10014)
-	WriteLog("JERRY: CLK3 word written by %s: %u\n", whoName[who], data);
-//else if (offset == 0xF1A100)
-//	WriteLog("JERRY: D_FLAGS word written by %s: %u\n", whoName[who], data);
-//else if (offset == 0xF1A102)
-//	WriteLog("JERRY: D_FLAGS+2 word written by %s: %u\n", whoName[who], data);
-else if (offset == 0xF10020)
-	WriteLog("JERRY: JINTCTRL word written by %s: $%04X (%s%s%s%s%s%s)\n", whoName[who], data,
-		(data & 0x01 ? "Extrnl " : ""), (data & 0x02 ? "DSP " : ""),
-		(data & 0x04 ? "Timer0 " : ""), (data & 0x08 ? "Timer1 " : ""),
-		(data & 0x10 ? "ASI " : ""), (data & 0x20 ? "I2S " : ""));
+#ifdef JERRY_REGISTER_LOG
+	JERRYLogWriteWord(offset, data, who);
 #endif
 
-	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE + 0x20))
-	{
-		DSPWriteWord(offset, data, who);
-		return;
-	}
-	else if ((offset >= DSP_WORK_RAM_BASE) && (offset < DSP_WORK_RAM_BASE + 0x2000))
-	{
-		DSPWriteWord(offset, data, who);
-		return;
-	}
-//NOTE: This should be taken care of in DAC...
-#if 0
-	else if (offset == 0xF1A152)					// Bottom half of SCLK ($F1A150)
-	{
-#warning "!!! SCLK should be handled in dac.cpp !!!"
-		WriteLog("JERRY: Writing $%X to SCLK (by %s)...\n", data, whoName[who]);
-//This should *only* be enabled when SMODE has its INTERNAL bit set! !!! FIX !!!
-#if 0
-		sclk = (uint8_t)data;
-#else
-		sclk = data & 0xFF;
-#endif
-		JERRYI2SInterruptTimer = -1;
-		RemoveCallback(JERRYI2SCallback);
-		JERRYI2SCallback();
+//Need to protect write attempts to Wavetable ROM (F1D000-FFF)
+	const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
 
-		DACWriteWord(offset, data, who);
-		return;
-	}
-#endif
-	// LTXD/RTXD/SCLK/SMODE $F1A148/4C/50/54 (really 16-bit registers...)
-	else if (offset >= 0xF1A148 && offset <= 0xF1A156)
-	{
-		DACWriteWord(offset, data, who);
-		return;
-	}
-	else if (offset >= 0xF10000 && offset <= 0xF10007)
+	if (reg.writeWord)
+		reg.writeWord(offset, data, who);
+}
+
+
+//
+// JERRY long access (write)
+// Written at once if both words are plain, or by the long handler of their class
+//
+void JERRYWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
+{
+#if !defined(JERRY_DEBUG) && !defined(JERRY_REGISTER_LOG)
+	if ((offset & 0xFFFF) <= 0xFFFC)
 	{
-		switch(offset & 0x07)
+		const JERRYRegisterClass & reg = jerryRegisterClass[jerryRegisterMap[offset & 0xFFFF]];
+		const JERRYRegisterClass & reg2 = jerryRegisterClass[jerryRegisterMap[(offset + 2) & 0xFFFF]];
+
+		if (!reg.writeWord && !reg2.writeWord)
 		{
-		case 0:
-			JERRYPIT1Prescaler = data;
-			JERRYResetPIT1();
-			break;
-		case 2:
-			JERRYPIT1Divider = data;
-			JERRYResetPIT1();
-			break;
-		case 4:
-			JERRYPIT2Prescaler = data;
-			JERRYResetPIT2();
-			break;
-		case 6:
-			JERRYPIT2Divider = data;
-			JERRYResetPIT2();
+			SET32(jerry_ram_8, offset & 0xFFFF, data);
+			return;
 		}
-		// Need to handle (unaligned) cases???
 
-		return;
-	}
-	// JERRY -> 68K interrupt enables/latches (need to be handled!)
-	else if (offset >= 0xF10020 && offset <= 0xF10022)
-	{
-		jerryInterruptMask = data & 0xFF;
-		jerryPendingInterrupt &= ~(data >> 8);
-//WriteLog("JERRY: (68K int en/lat - Unhandled!) Tried to write $%04X to $%08X!\n", data, offset);
-//WriteLog("JERRY: (Previous is partially handled... IRQMask=$%04X)\n", jerryInterruptMask);
-		return;
-	}
-	else if (offset >= 0xF14000 && offset < 0xF14003)
-	{
-		JoystickWriteWord(offset, data);
-		EepromWriteWord(offset, data);
-		return;
-	}
-	else if (offset >= 0xF14000 && offset <= 0xF1A0FF)
-	{
-		EepromWriteWord(offset, data);
-		return;
+		if (reg.writeLong && (&reg == &reg2) && !(offset & 0x03))
+		{
+			SET32(jerry_ram_8, offset & 0xFFFF, data);
+			reg.writeLong(offset, data, who);
+			return;
+		}
 	}
+#endif
 
-//Need to protect write attempts to Wavetable ROM (F1D000-FFF)
-	if (offset >= 0xF1D000 && offset <= 0xF1DFFF)
-		return;
-
-//	jerry_ram_8[(offset+0) & 0xFFFF] = (data >> 8) & 0xFF;
-//	jerry_ram_8[(offset+1) & 0xFFFF] = data & 0xFF;
+	JERRYWriteWord(offset, data >> 16, who);
+	JERRYWriteWord(offset + 2, data & 0xFFFF, who);
 }
 
 
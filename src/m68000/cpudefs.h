@@ -58,6 +58,11 @@ struct regstruct
 
 	int32_t remainingCycles;
 	uint32_t interruptCycles;
+
+	uint32_t ccOp;						// Last operation recorded for the flags (CC_NONE if made)
+	uint32_t ccSrc;
+	uint32_t ccDst;
+	uint32_t ccRes;
 };
 
 extern struct regstruct regs;	// , lastint_regs;
@@ -77,17 +82,56 @@ extern struct regstruct regs;	// , lastint_regs;
 //#define M68000_EXC_SRC_INT_MFP  3  /* MFP interrupt exception */
 //#define M68000_EXC_SRC_INT_DSP  4  /* DSP interrupt exception */
 
-#define SET_CFLG(x) (CFLG = (x))
-#define SET_NFLG(x) (NFLG = (x))
-#define SET_VFLG(x) (VFLG = (x))
-#define SET_ZFLG(x) (ZFLG = (x))
-#define SET_XFLG(x) (XFLG = (x))
-
-#define GET_CFLG CFLG
-#define GET_NFLG NFLG
-#define GET_VFLG VFLG
-#define GET_ZFLG ZFLG
-#define GET_XFLG XFLG
+/* Lazy condition codes
+ * The logical, add, sub and cmp operations only record their kind, size,
+ * operands and result; the flags are made by MakeFlags() when one of them is
+ * read or written. Logical & cmp do not change X, so a pending X from an add or
+ * sub is made by MakeFlagX() before they are recorded. */
+#define CC_NONE     0
+#define CC_LOGICAL  1
+#define CC_CMP      2
+#define CC_ADD      3
+#define CC_SUB      4
+#define CC_TYPE     0x0F
+#define CC_BYTE     0x10
+#define CC_WORD     0x20
+#define CC_LONG     0x30
+
+#define CC_MASK(op) (ccSizeMask[((op) >> 4) & 3])
+#define CC_SETS_X(op) (((op) & CC_TYPE) >= CC_ADD)
+
+extern const uint32_t ccSizeMask[4];
+extern void MakeFlags(void);
+extern void MakeFlagX(void);
+
+#define CC_FLUSH (regs.ccOp ? MakeFlags() : (void)0)
+
+#define CC_RECORD(op, s, d, r) do { \
+ regs.ccOp = (op); \
+ regs.ccSrc = (uint32_t)(s); \
+ regs.ccDst = (uint32_t)(d); \
+ regs.ccRes = (uint32_t)(r); \
+} while (0)
+
+#define CC_RECORD_KEEPX(op, s, d, r) do { \
+ if (CC_SETS_X(regs.ccOp)) \
+  MakeFlagX(); \
+ CC_RECORD(op, s, d, r); \
+} while (0)
+
+#define CC_RECORD_LOGICAL(size, r) CC_RECORD_KEEPX(CC_LOGICAL | (size), 0, 0, r)
+
+#define SET_CFLG(x) (CC_FLUSH, CFLG = (x))
+#define SET_NFLG(x) (CC_FLUSH, NFLG = (x))
+#define SET_VFLG(x) (CC_FLUSH, VFLG = (x))
+#define SET_ZFLG(x) (CC_FLUSH, ZFLG = (x))
+#define SET_XFLG(x) (CC_FLUSH, XFLG = (x))
+
+#define GET_CFLG (CC_FLUSH, CFLG)
+#define GET_NFLG (CC_FLUSH, NFLG)
+#define GET_VFLG (CC_FLUSH, VFLG)
+#define GET_ZFLG (CC_FLUSH, ZFLG)
+#define GET_XFLG (CC_FLUSH, XFLG)
 
 #define CLEAR_CZNV do { \
  SET_CFLG(0); \
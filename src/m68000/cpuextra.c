@@ -22,6 +22,8 @@ int CurrentInstrCycles;
 
 struct regstruct regs;
 
+const uint32_t ccSizeMask[4] = { 0xFFFFFFFF, 0x000000FF, 0x0000FFFF, 0xFFFFFFFF };
+
 
 //
 // Make displacement effective address for 68000
@@ -54,6 +56,92 @@ uint32_t get_disp_ea_000(uint32_t base, uint32_t dp)
 }
 
 
+//
+// Flags of a recorded operation, X is only changed by an add or a sub
+//
+static inline void MakeRecordedFlags(uint32_t op, uint32_t src, uint32_t dst, uint32_t res, unsigned int * x, unsigned int * n, unsigned int * z, unsigned int * v, unsigned int * c)
+{
+	uint32_t mask = CC_MASK(op);
+	uint32_t sign = mask ^ (mask >> 1);
+	int flgs, flgo, flgn;
+
+	src &= mask;
+	dst &= mask;
+	res &= mask;
+	flgs = ((src & sign) != 0);
+	flgo = ((dst & sign) != 0);
+	flgn = ((res & sign) != 0);
+
+	*z = (res == 0);
+	*n = flgn;
+
+	switch (op & CC_TYPE)
+	{
+	case CC_LOGICAL:
+		*c = 0;
+		*v = 0;
+		break;
+	case CC_ADD:
+		*v = (flgs ^ flgn) & (flgo ^ flgn);
+		*c = *x = ((~dst & mask) < src);
+		break;
+	case CC_SUB:
+		*v = (flgs ^ flgo) & (flgn ^ flgo);
+		*c = *x = (src > dst);
+		break;
+	case CC_CMP:
+		*v = (flgs ^ flgo) & (flgn ^ flgo);
+		*c = (src > dst);
+		break;
+	}
+}
+
+
+//
+// Make the flags from the last recorded operation
+// Same results as the flags computed after the operation by gencpu
+//
+void MakeFlags(void)
+{
+	uint32_t op = regs.ccOp;
+
+	regs.ccOp = CC_NONE;
+	MakeRecordedFlags(op, regs.ccSrc, regs.ccDst, regs.ccRes, &XFLG, &NFLG, &ZFLG, &VFLG, &CFLG);
+}
+
+
+//
+// Status Register from a lazy flags state: the SR with the flags made so far, and
+// the operation recorded since (CC_NONE if none); the CPU registers are left as they are
+//
+uint16_t MakeLazySR(uint16_t sr, uint32_t op, uint32_t src, uint32_t dst, uint32_t res)
+{
+	unsigned int x = (sr >> 4) & 1, n = (sr >> 3) & 1, z = (sr >> 2) & 1, v = (sr >> 1) & 1, c = sr & 1;
+
+	if (op != CC_NONE)
+		MakeRecordedFlags(op, src, dst, res, &x, &n, &z, &v, &c);
+
+	return (sr & 0xFF00) | (x << 4) | (n << 3) | (z << 2) | (v << 1) | c;
+}
+
+
+//
+// Make only the X flag of a recorded add or sub, which is about to be replaced
+// by an operation leaving X unchanged
+//
+void MakeFlagX(void)
+{
+	uint32_t mask = CC_MASK(regs.ccOp);
+	uint32_t src = regs.ccSrc & mask;
+	uint32_t dst = regs.ccDst & mask;
+
+	if ((regs.ccOp & CC_TYPE) == CC_ADD)
+		XFLG = ((~dst & mask) < src);
+	else
+		XFLG = (src > dst);
+}
+
+
 //
 // Create the Status Register from the flags
 //
@@ -26,6 +26,7 @@ extern int CurrentInstrCycles;
 
 extern uint32_t get_disp_ea_000(uint32_t base, uint32_t dp);
 extern void MakeSR(void);
+extern uint16_t MakeLazySR(uint16_t sr, uint32_t op, uint32_t src, uint32_t dst, uint32_t res);
 extern void MakeFromSR(void);
 extern void Exception(int, uint32_t, int);
 extern int getDivu68kCycles(uint32_t dividend, uint16_t divisor);
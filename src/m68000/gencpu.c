@@ -20,6 +20,7 @@
  * Adaptation to Hatari and better cpu timings by Thomas Huth
  * Adaptation to Virtual Jaguar by James Hammons
  * Compilation warning fix in the generated files by Jean-Paul Mari
+ * Lazy condition codes by Jean-Paul Mari
  *
  * This file is distributed under the GNU Public License, version 3 or at
  * your option any later version. Read the file GPLv3 for details.
@@ -676,19 +677,23 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
     char vstr[100], sstr[100], dstr[100];
     char usstr[100], udstr[100];
     char unsstr[100], undstr[100];
+    const char *ccsize;
 
     switch (size) {
      case sz_byte:
 	strcpy (vstr, "((int8_t)(");
 	strcpy (usstr, "((uint8_t)(");
+	ccsize = "CC_BYTE";
 	break;
      case sz_word:
 	strcpy (vstr, "((int16_t)(");
 	strcpy (usstr, "((uint16_t)(");
+	ccsize = "CC_WORD";
 	break;
      case sz_long:
 	strcpy (vstr, "((int32_t)(");
 	strcpy (usstr, "((uint32_t)(");
+	ccsize = "CC_LONG";
 	break;
      default:
 	abort ();
@@ -739,6 +744,25 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 	break;
     }
 
+    /* Lazy condition codes: only the operation, its operands and its result
+       are recorded, the flags are made when they are used (see MakeFlags) */
+    switch (type) {
+     case flag_logical:
+	printf ("\tCC_RECORD_LOGICAL (%s, %s);\n", ccsize, value);
+	return;
+     case flag_add:
+	printf ("\tCC_RECORD (CC_ADD | %s, %s, %s, %s);\n", ccsize, src, dst, value);
+	return;
+     case flag_sub:
+	printf ("\tCC_RECORD (CC_SUB | %s, %s, %s, %s);\n", ccsize, src, dst, value);
+	return;
+     case flag_cmp:
+	printf ("\tCC_RECORD_KEEPX (CC_CMP | %s, %s, %s, %s);\n", ccsize, src, dst, value);
+	return;
+     default:
+	break;
+    }
+
     switch (type) {
      case flag_logical_noclobber:
      case flag_logical:
@@ -14,6 +14,12 @@
 
 STATIC_INLINE int cctrue(const int cc)
 {
+	// The equality tests only need the recorded result, other tests make the flags
+	if (regs.ccOp && ((cc == 6) || (cc == 7)))
+		return ((regs.ccRes & CC_MASK(regs.ccOp)) == 0) == (cc == 7);
+
+	CC_FLUSH;
+
 	switch (cc)
 	{
 		case 0:  return 1;                       /* T */
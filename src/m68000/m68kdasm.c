@@ -25,8 +25,13 @@ extern cpuop_func * cpuFunctionTable[65536];
 // Prototypes
 void HandleMovem(char * output, uint16_t data, int direction);
 
-// Local "global" variables
-static long int m68kpc_offset;
+// Local "global" variables, one set per disassembling thread
+#ifdef _MSC_VER
+#define DASM_THREAD __declspec(thread)
+#else
+#define DASM_THREAD __thread
+#endif
+static DASM_THREAD long int m68kpc_offset;
 
 #if 0
 #define get_ibyte_1(o) get_byte(regs.pc + (regs.pc_p - regs.pc_oldp) + (o) + 1)
@@ -16,6 +16,12 @@
 // JLH  10/28/2011  Created this file ;-)
 // JPM       /201?  Added M68k debug flag handler
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Per opcode execution histogram (OPCODE_STATS)
+// JPM   Oct./2026  Executed instructions count, and halt at an instructions count
+// JPM   Oct./2026  Interrupt requests pushed in the special flags
+// JPM   Oct./2026  Added the number of cycles run in the timeslice
+// JPM   Oct./2026  Timeslices & side effects counts, and the number of cycles left
+// JPM   Oct./2026  Lazy flags state read without making the flags, for the traceback
 //
 
 #include <stdio.h>
@@ -69,16 +75,26 @@ void m68k_set_irq2(unsigned int intLevel);
 // Local "Global" vars
 static int32_t initialCycles;
 cpuop_func * cpuFunctionTable[65536];
+#ifdef OPCODE_STATS
+uint64_t m68kOpcodeCount[65536];
+uint64_t m68kOpcodeCycles[65536];
+#endif
+uint64_t m68kInstructionCount = 0;
+uint64_t m68kHaltInstructionCount = UINT64_MAX;
+uint64_t m68kTimesliceCount = 0;
+uint64_t m68kSideEffectCount = 0;
 
 // By virtue of the fact that m68k_set_irq() can be called asychronously by
 // another thread, we need something along the lines of this:
-static int checkForIRQToHandle = 0;
+// (the request is pushed in the special flags, SPCFLAG_INT, checked with the
+// debugger one before each instruction)
 //static pthread_mutex_t executionLock = PTHREAD_MUTEX_INITIALIZER;
 static int IRQLevelToHandle = 0;
 
 size_t m68k_dump(FILE *fp)
 {
 	size_t total_dumped = 0;
+	int checkForIRQToHandle = ((regs.spcflags & SPCFLAG_INT) ? 1 : 0);
   
 	DUMPS32(initialCycles);
 	DUMPINT(checkForIRQToHandle);
@@ -96,10 +112,17 @@ size_t m68k_dump(FILE *fp)
 size_t m68k_load(FILE *fp)
 {
 	size_t total_loaded = 0;
+	int checkForIRQToHandle;
 
 	LOADS32(initialCycles);
 	LOADINT(checkForIRQToHandle);
 	LOADINT(IRQLevelToHandle);
+
+	if (checkForIRQToHandle)
+		regs.spcflags |= SPCFLAG_INT;
+	else
+		regs.spcflags &= ~SPCFLAG_INT;
+
 	LOAD16(last_op_for_exception_3);
 	LOAD32(last_addr_for_exception_3);
 	LOAD32(last_fault_for_exception_3);
@@ -259,7 +282,6 @@ void m68k_pulse_reset(void)
 	REG_PC = m68ki_read_imm_32();
 	m68ki_jump(REG_PC);
 #else
-	checkForIRQToHandle = 0;
 	regs.spcflags = 0;
 	regs.stopped = 0;
 	regs.remainingCycles = 0;
@@ -299,6 +321,7 @@ int m68k_execute(int num_cycles)
 #else
 	regs.remainingCycles = num_cycles;
 	/*int32_t*/ initialCycles = num_cycles;
+	m68kTimesliceCount++;
 	
 	regs.remainingCycles -= regs.interruptCycles;
 	regs.interruptCycles = 0;
@@ -307,16 +330,33 @@ int m68k_execute(int num_cycles)
 	/* Main loop.  Keep going until we run out of clock cycles */
 	do
 	{
-		// This is so our debugging code can break in on a dime.
-		// Otherwise, this is just extra slow down :-P
-		if (regs.spcflags & SPCFLAG_DEBUGGER)
+		// The replay of the reverse debugger stops at an instructions count
+		if (m68kInstructionCount >= m68kHaltInstructionCount)
 		{
-			// Not sure this is correct... :-P
-			num_cycles = initialCycles - regs.remainingCycles;
-			regs.remainingCycles = 0;	// int32_t
-			regs.interruptCycles = 0;	// uint32_t
+			regs.spcflags |= SPCFLAG_DEBUGGER;
+		}
 
-			return num_cycles;
+		if (regs.spcflags)
+		{
+			// This is so our debugging code can break in on a dime.
+			// Otherwise, this is just extra slow down :-P
+			if (regs.spcflags & SPCFLAG_DEBUGGER)
+			{
+				// Not sure this is correct... :-P
+				num_cycles = initialCycles - regs.remainingCycles;
+				regs.remainingCycles = 0;	// int32_t
+				regs.interruptCycles = 0;	// uint32_t
+
+				return num_cycles;
+			}
+
+//			pthread_mutex_lock(&executionLock);
+			// Interrupt request pushed by the interrupt controller
+			if (regs.spcflags & SPCFLAG_INT)
+			{
+				regs.spcflags &= ~SPCFLAG_INT;
+				m68k_set_irq2(IRQLevelToHandle);
+			}
 		}
 #if 0
 		/* Set tracing accodring to T1. (T0 is done inside instruction) */
@@ -391,13 +431,6 @@ if (inRoutine)
 //94C2: 2452                     MOVEA.L	(A2), A2			; <--- HERE
 //94C4: 4283                     CLR.L	D3
 #endif
-//		pthread_mutex_lock(&executionLock);
-		if (checkForIRQToHandle)
-		{
-			checkForIRQToHandle = 0;
-			m68k_set_irq2(IRQLevelToHandle);
-		}
-
 #ifdef M68K_HOOK_FUNCTION
 		M68KInstructionHook();
 #endif
@@ -414,6 +447,11 @@ if (inRoutine)
 		else
 		{
 			cycles = (int32_t)(*cpuFunctionTable[opcode])(opcode);
+			m68kInstructionCount++;
+#ifdef OPCODE_STATS
+			m68kOpcodeCount[opcode]++;
+			m68kOpcodeCycles[opcode] += cycles;
+#endif
 		}
 		regs.remainingCycles -= cycles;
 //		pthread_mutex_unlock(&executionLock);
@@ -455,7 +493,7 @@ void m68k_set_irq(unsigned int intLevel)
 	// Since this can be called asynchronously, we need to fix it so that it
 	// doesn't fuck up the main execution loop.
 	IRQLevelToHandle = intLevel;
-	checkForIRQToHandle = 1;
+	regs.spcflags |= SPCFLAG_INT;
 }
 
 
@@ -690,6 +728,29 @@ unsigned int m68k_get_reg(void * context, m68k_register_t reg)
 }
 
 
+//
+// Lazy flags state, read without making the flags: the SR with the flags made so far,
+// and the operation recorded since
+//
+void m68k_get_lazy_flags(uint32_t * sr, uint32_t * op, uint32_t * src, uint32_t * dst, uint32_t * res)
+{
+	*sr = (regs.s << 13) | (regs.intmask << 8) | (XFLG << 4) | (NFLG << 3) | (ZFLG << 2) | (VFLG << 1) | CFLG;
+	*op = regs.ccOp;
+	*src = regs.ccSrc;
+	*dst = regs.ccDst;
+	*res = regs.ccRes;
+}
+
+
+//
+// SR of a lazy flags state
+//
+unsigned int m68k_lazy_sr(uint32_t sr, uint32_t op, uint32_t src, uint32_t dst, uint32_t res)
+{
+	return MakeLazySR(sr, op, src, dst, res);
+}
+
+
 void m68k_set_reg(m68k_register_t reg, unsigned int value)
 {
 	if (reg <= M68K_REG_A7)
@@ -720,6 +781,45 @@ unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cp
 }
 
 
+#ifdef OPCODE_STATS
+//
+// Get the variant of an opcode: the opcode of its handler, with the mnemonic,
+// the size & the addressing modes ("" if not used)
+// Returns 0 if the opcode is an illegal one
+//
+unsigned int m68k_opcode_variant(unsigned int opcode, unsigned int * handler, const char ** mnemonic, const char ** size, const char ** smode, const char ** dmode)
+{
+	static const char * sizeName[4] = { "B", "W", "L", "" };
+	static const char * modeName[am_illg + 1] = {
+		"Dn", "An", "(An)", "(An)+", "-(An)", "d16(An)", "d8(An,Xn)",
+		"xxx.W", "xxx.L", "d16(PC)", "d8(PC,Xn)", "#imm", "#imm0", "#imm1", "#imm2", "#immi", "", ""
+	};
+	const struct instr * ins = &table68k[opcode & 0xFFFF];
+	int i;
+
+	if (cpuFunctionTable[opcode & 0xFFFF] == IllegalOpcode)
+		return 0;
+
+	*handler = (ins->handler == -1 ? (opcode & 0xFFFF) : (unsigned int)ins->handler);
+	*mnemonic = "";
+
+	for(i=0; lookuptab[i].name[0]; i++)
+	{
+		if (lookuptab[i].mnemo == ins->mnemo)
+		{
+			*mnemonic = lookuptab[i].name;
+			break;
+		}
+	}
+
+	*size = sizeName[ins->size];
+	*smode = (ins->suse && (ins->smode <= am_illg) ? modeName[ins->smode] : "");
+	*dmode = (ins->duse && (ins->dmode <= am_illg) ? modeName[ins->dmode] : "");
+	return 1;
+}
+#endif
+
+
 // Dummy functions, for now, until we prove the concept here. :-)
 
 // Temp, while we're using the Musashi disassembler...
@@ -736,6 +836,18 @@ unsigned int m68k_disassemble(char * str_buff, unsigned int pc, unsigned int cpu
 //void m68k_end_timeslice(void) {}          /* End timeslice now */
 
 
+int m68k_cycles_run(void)
+{
+	return initialCycles - regs.remainingCycles;
+}
+
+
+int m68k_cycles_remaining(void)
+{
+	return regs.remainingCycles;
+}
+
+
 void m68k_modify_timeslice(int cycles)
 {
 	regs.remainingCycles = cycles;
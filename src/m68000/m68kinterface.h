@@ -13,6 +13,8 @@
 #ifndef __M68KINTERFACE_H__
 #define __M68KINTERFACE_H__
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -117,6 +119,10 @@ extern int M68KDebugHaltStatus(void);
  */
 extern unsigned int m68k_get_reg(void * context, m68k_register_t reg);
 
+/* Lazy flags state read without making the flags, and the SR made from it */
+extern void m68k_get_lazy_flags(uint32_t * sr, uint32_t * op, uint32_t * src, uint32_t * dst, uint32_t * res);
+extern unsigned int m68k_lazy_sr(uint32_t sr, uint32_t op, uint32_t src, uint32_t dst, uint32_t res);
+
 /* Poke values into the internals of the currently running CPU context */
 extern void m68k_set_reg(m68k_register_t reg, unsigned int value);
 
@@ -125,6 +131,21 @@ extern void m68k_set_reg(m68k_register_t reg, unsigned int value);
 /* Check if an instruction is valid for the specified CPU type */
 extern unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type);
 
+/* Instructions executed since the start, and the count where the execution halts (UINT64_MAX for none) */
+extern uint64_t m68kInstructionCount;
+extern uint64_t m68kHaltInstructionCount;
+
+/* Timeslices run, and the writes & the chips registers reads done (accesses with a side effect) */
+extern uint64_t m68kTimesliceCount;
+extern uint64_t m68kSideEffectCount;
+
+#ifdef OPCODE_STATS
+/* Per opcode executions & charged cycles, and the opcode variants */
+extern uint64_t m68kOpcodeCount[65536];
+extern uint64_t m68kOpcodeCycles[65536];
+extern unsigned int m68k_opcode_variant(unsigned int opcode, unsigned int * handler, const char ** mnemonic, const char ** size, const char ** smode, const char ** dmode);
+#endif
+
 /* Disassemble 1 instruction using the epecified CPU type at pc.  Stores
  * disassembly in str_buff and returns the size of the instruction in bytes.
  */
@@ -135,8 +156,8 @@ extern unsigned int m68k_disassemble(char * str_buff, unsigned int pc, unsigned
  * These are useful if the 68k accesses a memory-mapped port on another device
  * that requires immediate processing by another CPU.
  */
-//int m68k_cycles_run(void);              // Number of cycles run so far
-//int m68k_cycles_remaining(void);        // Number of cycles left
+extern int m68k_cycles_run(void);              // Number of cycles run so far
+extern int m68k_cycles_remaining(void);        // Number of cycles left
 extern void m68k_modify_timeslice(int cycles); // Modify cycles left
 extern void m68k_end_timeslice(void);          // End timeslice now
 
@@ -149,6 +170,7 @@ extern void m68k_brk_disable(void);
 extern void m68k_brk_reset(void);
 extern void m68k_brk_close(void);
 extern unsigned int m68k_brk_check(unsigned int adr);
+extern unsigned int m68k_brk_find(unsigned int adr);
 
 #ifdef __cplusplus
 }
@@ -88,9 +88,7 @@ unsigned long CPUFUNC(op_0_4)(uint32_t opcode) /* OR */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -103,9 +101,7 @@ unsigned long CPUFUNC(op_10_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -119,9 +115,7 @@ unsigned long CPUFUNC(op_18_4)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -135,9 +129,7 @@ unsigned long CPUFUNC(op_20_4)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -150,9 +142,7 @@ unsigned long CPUFUNC(op_28_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -166,9 +156,7 @@ unsigned long CPUFUNC(op_30_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -180,9 +168,7 @@ unsigned long CPUFUNC(op_38_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -194,9 +180,7 @@ unsigned long CPUFUNC(op_39_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -219,9 +203,7 @@ unsigned long CPUFUNC(op_40_4)(uint32_t opcode) /* OR */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -234,9 +216,7 @@ unsigned long CPUFUNC(op_50_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -250,9 +230,7 @@ unsigned long CPUFUNC(op_58_4)(uint32_t opcode) /* OR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -266,9 +244,7 @@ unsigned long CPUFUNC(op_60_4)(uint32_t opcode) /* OR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -281,9 +257,7 @@ unsigned long CPUFUNC(op_68_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -297,9 +271,7 @@ unsigned long CPUFUNC(op_70_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -311,9 +283,7 @@ unsigned long CPUFUNC(op_78_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -325,9 +295,7 @@ unsigned long CPUFUNC(op_79_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -351,9 +319,7 @@ unsigned long CPUFUNC(op_80_4)(uint32_t opcode) /* OR */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -366,9 +332,7 @@ unsigned long CPUFUNC(op_90_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -382,9 +346,7 @@ unsigned long CPUFUNC(op_98_4)(uint32_t opcode) /* OR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -398,9 +360,7 @@ unsigned long CPUFUNC(op_a0_4)(uint32_t opcode) /* OR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -413,9 +373,7 @@ unsigned long CPUFUNC(op_a8_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -429,9 +387,7 @@ unsigned long CPUFUNC(op_b0_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -443,9 +399,7 @@ unsigned long CPUFUNC(op_b8_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -457,9 +411,7 @@ unsigned long CPUFUNC(op_b9_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -1121,9 +1073,7 @@ unsigned long CPUFUNC(op_200_4)(uint32_t opcode) /* AND */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -1136,9 +1086,7 @@ unsigned long CPUFUNC(op_210_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1152,9 +1100,7 @@ unsigned long CPUFUNC(op_218_4)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1168,9 +1114,7 @@ unsigned long CPUFUNC(op_220_4)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -1183,9 +1127,7 @@ unsigned long CPUFUNC(op_228_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1199,9 +1141,7 @@ unsigned long CPUFUNC(op_230_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -1213,9 +1153,7 @@ unsigned long CPUFUNC(op_238_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1227,9 +1165,7 @@ unsigned long CPUFUNC(op_239_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -1252,9 +1188,7 @@ unsigned long CPUFUNC(op_240_4)(uint32_t opcode) /* AND */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -1267,9 +1201,7 @@ unsigned long CPUFUNC(op_250_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1283,9 +1215,7 @@ unsigned long CPUFUNC(op_258_4)(uint32_t opcode) /* AND */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1299,9 +1229,7 @@ unsigned long CPUFUNC(op_260_4)(uint32_t opcode) /* AND */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -1314,9 +1242,7 @@ unsigned long CPUFUNC(op_268_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1330,9 +1256,7 @@ unsigned long CPUFUNC(op_270_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -1344,9 +1268,7 @@ unsigned long CPUFUNC(op_278_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1358,9 +1280,7 @@ unsigned long CPUFUNC(op_279_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -1384,9 +1304,7 @@ unsigned long CPUFUNC(op_280_4)(uint32_t opcode) /* AND */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -1399,9 +1317,7 @@ unsigned long CPUFUNC(op_290_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -1415,9 +1331,7 @@ unsigned long CPUFUNC(op_298_4)(uint32_t opcode) /* AND */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -1431,9 +1345,7 @@ unsigned long CPUFUNC(op_2a0_4)(uint32_t opcode) /* AND */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -1446,9 +1358,7 @@ unsigned long CPUFUNC(op_2a8_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -1462,9 +1372,7 @@ unsigned long CPUFUNC(op_2b0_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -1476,9 +1384,7 @@ unsigned long CPUFUNC(op_2b8_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -1490,9 +1396,7 @@ unsigned long CPUFUNC(op_2b9_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -1504,16 +1408,9 @@ unsigned long CPUFUNC(op_400_4)(uint32_t opcode) /* SUB */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_410_4)(uint32_t opcode) /* SUB */
@@ -1524,16 +1421,9 @@ unsigned long CPUFUNC(op_410_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_418_4)(uint32_t opcode) /* SUB */
@@ -1545,16 +1435,9 @@ unsigned long CPUFUNC(op_418_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_420_4)(uint32_t opcode) /* SUB */
@@ -1566,16 +1449,9 @@ unsigned long CPUFUNC(op_420_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_428_4)(uint32_t opcode) /* SUB */
@@ -1586,16 +1462,9 @@ unsigned long CPUFUNC(op_428_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_430_4)(uint32_t opcode) /* SUB */
@@ -1607,16 +1476,9 @@ unsigned long CPUFUNC(op_430_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_438_4)(uint32_t opcode) /* SUB */
@@ -1626,16 +1488,9 @@ unsigned long CPUFUNC(op_438_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_439_4)(uint32_t opcode) /* SUB */
@@ -1645,16 +1500,9 @@ unsigned long CPUFUNC(op_439_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_440_4)(uint32_t opcode) /* SUB */
@@ -1664,16 +1512,9 @@ unsigned long CPUFUNC(op_440_4)(uint32_t opcode) /* SUB */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_450_4)(uint32_t opcode) /* SUB */
@@ -1684,16 +1525,9 @@ unsigned long CPUFUNC(op_450_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_458_4)(uint32_t opcode) /* SUB */
@@ -1705,16 +1539,9 @@ unsigned long CPUFUNC(op_458_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_460_4)(uint32_t opcode) /* SUB */
@@ -1726,16 +1553,9 @@ unsigned long CPUFUNC(op_460_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_468_4)(uint32_t opcode) /* SUB */
@@ -1746,16 +1566,9 @@ unsigned long CPUFUNC(op_468_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_470_4)(uint32_t opcode) /* SUB */
@@ -1767,16 +1580,9 @@ unsigned long CPUFUNC(op_470_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_478_4)(uint32_t opcode) /* SUB */
@@ -1786,16 +1592,9 @@ unsigned long CPUFUNC(op_478_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_479_4)(uint32_t opcode) /* SUB */
@@ -1805,16 +1604,9 @@ unsigned long CPUFUNC(op_479_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_480_4)(uint32_t opcode) /* SUB */
@@ -1824,16 +1616,9 @@ unsigned long CPUFUNC(op_480_4)(uint32_t opcode) /* SUB */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_490_4)(uint32_t opcode) /* SUB */
@@ -1844,16 +1629,9 @@ unsigned long CPUFUNC(op_490_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_498_4)(uint32_t opcode) /* SUB */
@@ -1865,16 +1643,9 @@ unsigned long CPUFUNC(op_498_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_4a0_4)(uint32_t opcode) /* SUB */
@@ -1886,16 +1657,9 @@ unsigned long CPUFUNC(op_4a0_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 30;
 }
 unsigned long CPUFUNC(op_4a8_4)(uint32_t opcode) /* SUB */
@@ -1906,16 +1670,9 @@ unsigned long CPUFUNC(op_4a8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 32;
 }
 unsigned long CPUFUNC(op_4b0_4)(uint32_t opcode) /* SUB */
@@ -1927,16 +1684,9 @@ unsigned long CPUFUNC(op_4b0_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 34;
 }
 unsigned long CPUFUNC(op_4b8_4)(uint32_t opcode) /* SUB */
@@ -1946,16 +1696,9 @@ unsigned long CPUFUNC(op_4b8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 32;
 }
 unsigned long CPUFUNC(op_4b9_4)(uint32_t opcode) /* SUB */
@@ -1965,16 +1708,9 @@ unsigned long CPUFUNC(op_4b9_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 36;
 }
 unsigned long CPUFUNC(op_600_4)(uint32_t opcode) /* ADD */
@@ -1985,16 +1721,9 @@ unsigned long CPUFUNC(op_600_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_610_4)(uint32_t opcode) /* ADD */
@@ -2006,16 +1735,9 @@ unsigned long CPUFUNC(op_610_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_618_4)(uint32_t opcode) /* ADD */
@@ -2028,16 +1750,9 @@ unsigned long CPUFUNC(op_618_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_620_4)(uint32_t opcode) /* ADD */
@@ -2050,16 +1765,9 @@ unsigned long CPUFUNC(op_620_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_628_4)(uint32_t opcode) /* ADD */
@@ -2071,16 +1779,9 @@ unsigned long CPUFUNC(op_628_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_630_4)(uint32_t opcode) /* ADD */
@@ -2093,16 +1794,9 @@ unsigned long CPUFUNC(op_630_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_638_4)(uint32_t opcode) /* ADD */
@@ -2113,16 +1807,9 @@ unsigned long CPUFUNC(op_638_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_639_4)(uint32_t opcode) /* ADD */
@@ -2133,16 +1820,9 @@ unsigned long CPUFUNC(op_639_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_640_4)(uint32_t opcode) /* ADD */
@@ -2153,16 +1833,9 @@ unsigned long CPUFUNC(op_640_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_650_4)(uint32_t opcode) /* ADD */
@@ -2174,16 +1847,9 @@ unsigned long CPUFUNC(op_650_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_658_4)(uint32_t opcode) /* ADD */
@@ -2196,16 +1862,9 @@ unsigned long CPUFUNC(op_658_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_660_4)(uint32_t opcode) /* ADD */
@@ -2218,16 +1877,9 @@ unsigned long CPUFUNC(op_660_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_668_4)(uint32_t opcode) /* ADD */
@@ -2239,16 +1891,9 @@ unsigned long CPUFUNC(op_668_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_670_4)(uint32_t opcode) /* ADD */
@@ -2261,16 +1906,9 @@ unsigned long CPUFUNC(op_670_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_678_4)(uint32_t opcode) /* ADD */
@@ -2281,16 +1919,9 @@ unsigned long CPUFUNC(op_678_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_679_4)(uint32_t opcode) /* ADD */
@@ -2301,16 +1932,9 @@ unsigned long CPUFUNC(op_679_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_680_4)(uint32_t opcode) /* ADD */
@@ -2321,16 +1945,9 @@ unsigned long CPUFUNC(op_680_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_690_4)(uint32_t opcode) /* ADD */
@@ -2342,16 +1959,9 @@ unsigned long CPUFUNC(op_690_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_698_4)(uint32_t opcode) /* ADD */
@@ -2364,16 +1974,9 @@ unsigned long CPUFUNC(op_698_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_6a0_4)(uint32_t opcode) /* ADD */
@@ -2386,16 +1989,9 @@ unsigned long CPUFUNC(op_6a0_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 30;
 }
 unsigned long CPUFUNC(op_6a8_4)(uint32_t opcode) /* ADD */
@@ -2407,16 +2003,9 @@ unsigned long CPUFUNC(op_6a8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 32;
 }
 unsigned long CPUFUNC(op_6b0_4)(uint32_t opcode) /* ADD */
@@ -2429,16 +2018,9 @@ unsigned long CPUFUNC(op_6b0_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 34;
 }
 unsigned long CPUFUNC(op_6b8_4)(uint32_t opcode) /* ADD */
@@ -2449,16 +2031,9 @@ unsigned long CPUFUNC(op_6b8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 32;
 }
 unsigned long CPUFUNC(op_6b9_4)(uint32_t opcode) /* ADD */
@@ -2469,16 +2044,9 @@ unsigned long CPUFUNC(op_6b9_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 36;
 }
 unsigned long CPUFUNC(op_800_4)(uint32_t opcode) /* BTST */
@@ -3051,9 +2619,7 @@ unsigned long CPUFUNC(op_a00_4)(uint32_t opcode) /* EOR */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -3066,9 +2632,7 @@ unsigned long CPUFUNC(op_a10_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3082,9 +2646,7 @@ unsigned long CPUFUNC(op_a18_4)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3098,9 +2660,7 @@ unsigned long CPUFUNC(op_a20_4)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -3113,9 +2673,7 @@ unsigned long CPUFUNC(op_a28_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3129,9 +2687,7 @@ unsigned long CPUFUNC(op_a30_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -3143,9 +2699,7 @@ unsigned long CPUFUNC(op_a38_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3157,9 +2711,7 @@ unsigned long CPUFUNC(op_a39_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -3182,9 +2734,7 @@ unsigned long CPUFUNC(op_a40_4)(uint32_t opcode) /* EOR */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -3197,9 +2747,7 @@ unsigned long CPUFUNC(op_a50_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3213,9 +2761,7 @@ unsigned long CPUFUNC(op_a58_4)(uint32_t opcode) /* EOR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3229,9 +2775,7 @@ unsigned long CPUFUNC(op_a60_4)(uint32_t opcode) /* EOR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -3244,9 +2788,7 @@ unsigned long CPUFUNC(op_a68_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3260,9 +2802,7 @@ unsigned long CPUFUNC(op_a70_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -3274,9 +2814,7 @@ unsigned long CPUFUNC(op_a78_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3288,9 +2826,7 @@ unsigned long CPUFUNC(op_a79_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -3317,9 +2853,7 @@ unsigned long CPUFUNC(op_a80_4)(uint32_t opcode) /* EOR */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -3332,9 +2866,7 @@ unsigned long CPUFUNC(op_a90_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -3348,9 +2880,7 @@ unsigned long CPUFUNC(op_a98_4)(uint32_t opcode) /* EOR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -3364,9 +2894,7 @@ unsigned long CPUFUNC(op_aa0_4)(uint32_t opcode) /* EOR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -3379,9 +2907,7 @@ unsigned long CPUFUNC(op_aa8_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -3395,9 +2921,7 @@ unsigned long CPUFUNC(op_ab0_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -3409,9 +2933,7 @@ unsigned long CPUFUNC(op_ab8_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -3423,9 +2945,7 @@ unsigned long CPUFUNC(op_ab9_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -3437,14 +2957,8 @@ unsigned long CPUFUNC(op_c00_4)(uint32_t opcode) /* CMP */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_c10_4)(uint32_t opcode) /* CMP */
@@ -3455,14 +2969,8 @@ unsigned long CPUFUNC(op_c10_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_c18_4)(uint32_t opcode) /* CMP */
@@ -3474,14 +2982,8 @@ unsigned long CPUFUNC(op_c18_4)(uint32_t opcode) /* CMP */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_c20_4)(uint32_t opcode) /* CMP */
@@ -3493,14 +2995,8 @@ unsigned long CPUFUNC(op_c20_4)(uint32_t opcode) /* CMP */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_c28_4)(uint32_t opcode) /* CMP */
@@ -3511,14 +3007,8 @@ unsigned long CPUFUNC(op_c28_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c30_4)(uint32_t opcode) /* CMP */
@@ -3530,14 +3020,8 @@ unsigned long CPUFUNC(op_c30_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 18;
 }
 unsigned long CPUFUNC(op_c38_4)(uint32_t opcode) /* CMP */
@@ -3547,14 +3031,8 @@ unsigned long CPUFUNC(op_c38_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c39_4)(uint32_t opcode) /* CMP */
@@ -3564,14 +3042,8 @@ unsigned long CPUFUNC(op_c39_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = get_ilong(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 20;
 }
 unsigned long CPUFUNC(op_c3a_4)(uint32_t opcode) /* CMP */
@@ -3583,14 +3055,8 @@ unsigned long CPUFUNC(op_c3a_4)(uint32_t opcode) /* CMP */
 	dsta += (int32_t)(int16_t)get_iword(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c3b_4)(uint32_t opcode) /* CMP */
@@ -3603,14 +3069,8 @@ unsigned long CPUFUNC(op_c3b_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 18;
 }
 unsigned long CPUFUNC(op_c40_4)(uint32_t opcode) /* CMP */
@@ -3620,14 +3080,8 @@ unsigned long CPUFUNC(op_c40_4)(uint32_t opcode) /* CMP */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_c50_4)(uint32_t opcode) /* CMP */
@@ -3638,14 +3092,8 @@ unsigned long CPUFUNC(op_c50_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_c58_4)(uint32_t opcode) /* CMP */
@@ -3657,14 +3105,8 @@ unsigned long CPUFUNC(op_c58_4)(uint32_t opcode) /* CMP */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_c60_4)(uint32_t opcode) /* CMP */
@@ -3676,14 +3118,8 @@ unsigned long CPUFUNC(op_c60_4)(uint32_t opcode) /* CMP */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_c68_4)(uint32_t opcode) /* CMP */
@@ -3694,14 +3130,8 @@ unsigned long CPUFUNC(op_c68_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c70_4)(uint32_t opcode) /* CMP */
@@ -3713,14 +3143,8 @@ unsigned long CPUFUNC(op_c70_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 18;
 }
 unsigned long CPUFUNC(op_c78_4)(uint32_t opcode) /* CMP */
@@ -3730,14 +3154,8 @@ unsigned long CPUFUNC(op_c78_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c79_4)(uint32_t opcode) /* CMP */
@@ -3747,14 +3165,8 @@ unsigned long CPUFUNC(op_c79_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = get_ilong(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 20;
 }
 unsigned long CPUFUNC(op_c7a_4)(uint32_t opcode) /* CMP */
@@ -3766,14 +3178,8 @@ unsigned long CPUFUNC(op_c7a_4)(uint32_t opcode) /* CMP */
 	dsta += (int32_t)(int16_t)get_iword(4);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_c7b_4)(uint32_t opcode) /* CMP */
@@ -3786,14 +3192,8 @@ unsigned long CPUFUNC(op_c7b_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 18;
 }
 unsigned long CPUFUNC(op_c80_4)(uint32_t opcode) /* CMP */
@@ -3803,14 +3203,8 @@ unsigned long CPUFUNC(op_c80_4)(uint32_t opcode) /* CMP */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long CPUFUNC(op_c90_4)(uint32_t opcode) /* CMP */
@@ -3821,14 +3215,8 @@ unsigned long CPUFUNC(op_c90_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_c98_4)(uint32_t opcode) /* CMP */
@@ -3840,14 +3228,8 @@ unsigned long CPUFUNC(op_c98_4)(uint32_t opcode) /* CMP */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_ca0_4)(uint32_t opcode) /* CMP */
@@ -3859,14 +3241,8 @@ unsigned long CPUFUNC(op_ca0_4)(uint32_t opcode) /* CMP */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_ca8_4)(uint32_t opcode) /* CMP */
@@ -3877,14 +3253,8 @@ unsigned long CPUFUNC(op_ca8_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_cb0_4)(uint32_t opcode) /* CMP */
@@ -3896,14 +3266,8 @@ unsigned long CPUFUNC(op_cb0_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 26;
 }
 unsigned long CPUFUNC(op_cb8_4)(uint32_t opcode) /* CMP */
@@ -3913,14 +3277,8 @@ unsigned long CPUFUNC(op_cb8_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_cb9_4)(uint32_t opcode) /* CMP */
@@ -3930,14 +3288,8 @@ unsigned long CPUFUNC(op_cb9_4)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = get_ilong(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(10);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(10);
 return 28;
 }
 unsigned long CPUFUNC(op_cba_4)(uint32_t opcode) /* CMP */
@@ -3949,14 +3301,8 @@ unsigned long CPUFUNC(op_cba_4)(uint32_t opcode) /* CMP */
 	dsta += (int32_t)(int16_t)get_iword(6);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 24;
 }
 unsigned long CPUFUNC(op_cbb_4)(uint32_t opcode) /* CMP */
@@ -3969,14 +3315,8 @@ unsigned long CPUFUNC(op_cbb_4)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 26;
 }
 unsigned long CPUFUNC(op_1000_4)(uint32_t opcode) /* MOVE */
@@ -3985,9 +3325,7 @@ unsigned long CPUFUNC(op_1000_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -3998,9 +3336,7 @@ unsigned long CPUFUNC(op_1008_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -4012,9 +3348,7 @@ unsigned long CPUFUNC(op_1010_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -4027,9 +3361,7 @@ unsigned long CPUFUNC(op_1018_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -4042,9 +3374,7 @@ unsigned long CPUFUNC(op_1020_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -4056,9 +3386,7 @@ unsigned long CPUFUNC(op_1028_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -4071,9 +3399,7 @@ unsigned long CPUFUNC(op_1030_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -4084,9 +3410,7 @@ unsigned long CPUFUNC(op_1038_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -4097,9 +3421,7 @@ unsigned long CPUFUNC(op_1039_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -4111,9 +3433,7 @@ unsigned long CPUFUNC(op_103a_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -4126,9 +3446,7 @@ unsigned long CPUFUNC(op_103b_4)(uint32_t opcode) /* MOVE */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -4138,9 +3456,7 @@ unsigned long CPUFUNC(op_103c_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = get_ibyte(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -4152,9 +3468,7 @@ unsigned long CPUFUNC(op_1080_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4166,9 +3480,7 @@ unsigned long CPUFUNC(op_1088_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4181,9 +3493,7 @@ unsigned long CPUFUNC(op_1090_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4197,9 +3507,7 @@ unsigned long CPUFUNC(op_1098_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4213,9 +3521,7 @@ unsigned long CPUFUNC(op_10a0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -4228,9 +3534,7 @@ unsigned long CPUFUNC(op_10a8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4244,9 +3548,7 @@ unsigned long CPUFUNC(op_10b0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4258,9 +3560,7 @@ unsigned long CPUFUNC(op_10b8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4272,9 +3572,7 @@ unsigned long CPUFUNC(op_10b9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4287,9 +3585,7 @@ unsigned long CPUFUNC(op_10ba_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4303,9 +3599,7 @@ unsigned long CPUFUNC(op_10bb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4316,9 +3610,7 @@ unsigned long CPUFUNC(op_10bc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -4331,9 +3623,7 @@ unsigned long CPUFUNC(op_10c0_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4346,9 +3636,7 @@ unsigned long CPUFUNC(op_10c8_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4362,9 +3650,7 @@ unsigned long CPUFUNC(op_10d0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4379,9 +3665,7 @@ unsigned long CPUFUNC(op_10d8_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4396,9 +3680,7 @@ unsigned long CPUFUNC(op_10e0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -4412,9 +3694,7 @@ unsigned long CPUFUNC(op_10e8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4429,9 +3709,7 @@ unsigned long CPUFUNC(op_10f0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4444,9 +3722,7 @@ unsigned long CPUFUNC(op_10f8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4459,9 +3735,7 @@ unsigned long CPUFUNC(op_10f9_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4475,9 +3749,7 @@ unsigned long CPUFUNC(op_10fa_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4492,9 +3764,7 @@ unsigned long CPUFUNC(op_10fb_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4506,9 +3776,7 @@ unsigned long CPUFUNC(op_10fc_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -4521,9 +3789,7 @@ unsigned long CPUFUNC(op_1100_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4536,9 +3802,7 @@ unsigned long CPUFUNC(op_1108_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -4552,9 +3816,7 @@ unsigned long CPUFUNC(op_1110_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4569,9 +3831,7 @@ unsigned long CPUFUNC(op_1118_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -4586,9 +3846,7 @@ unsigned long CPUFUNC(op_1120_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -4602,9 +3860,7 @@ unsigned long CPUFUNC(op_1128_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4619,9 +3875,7 @@ unsigned long CPUFUNC(op_1130_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4634,9 +3888,7 @@ unsigned long CPUFUNC(op_1138_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4649,9 +3901,7 @@ unsigned long CPUFUNC(op_1139_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4665,9 +3915,7 @@ unsigned long CPUFUNC(op_113a_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4682,9 +3930,7 @@ unsigned long CPUFUNC(op_113b_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4696,9 +3942,7 @@ unsigned long CPUFUNC(op_113c_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -4710,9 +3954,7 @@ unsigned long CPUFUNC(op_1140_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -4724,9 +3966,7 @@ unsigned long CPUFUNC(op_1148_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -4739,9 +3979,7 @@ unsigned long CPUFUNC(op_1150_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4755,9 +3993,7 @@ unsigned long CPUFUNC(op_1158_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -4771,9 +4007,7 @@ unsigned long CPUFUNC(op_1160_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4786,9 +4020,7 @@ unsigned long CPUFUNC(op_1168_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4802,9 +4034,7 @@ unsigned long CPUFUNC(op_1170_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -4816,9 +4046,7 @@ unsigned long CPUFUNC(op_1178_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4830,9 +4058,7 @@ unsigned long CPUFUNC(op_1179_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -4845,9 +4071,7 @@ unsigned long CPUFUNC(op_117a_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -4861,9 +4085,7 @@ unsigned long CPUFUNC(op_117b_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -4874,9 +4096,7 @@ unsigned long CPUFUNC(op_117c_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -4889,9 +4109,7 @@ unsigned long CPUFUNC(op_1180_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -4904,9 +4122,7 @@ unsigned long CPUFUNC(op_1188_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -4920,9 +4136,7 @@ unsigned long CPUFUNC(op_1190_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4937,9 +4151,7 @@ unsigned long CPUFUNC(op_1198_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -4954,9 +4166,7 @@ unsigned long CPUFUNC(op_11a0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 20;
@@ -4970,9 +4180,7 @@ unsigned long CPUFUNC(op_11a8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -4987,9 +4195,7 @@ unsigned long CPUFUNC(op_11b0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -5002,9 +4208,7 @@ unsigned long CPUFUNC(op_11b8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -5017,9 +4221,7 @@ unsigned long CPUFUNC(op_11b9_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -5033,9 +4235,7 @@ unsigned long CPUFUNC(op_11ba_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -5050,9 +4250,7 @@ unsigned long CPUFUNC(op_11bb_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -5064,9 +4262,7 @@ unsigned long CPUFUNC(op_11bc_4)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(6);
 return 18;
@@ -5077,9 +4273,7 @@ unsigned long CPUFUNC(op_11c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -5090,9 +4284,7 @@ unsigned long CPUFUNC(op_11c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -5104,9 +4296,7 @@ unsigned long CPUFUNC(op_11d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5119,9 +4309,7 @@ unsigned long CPUFUNC(op_11d8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5134,9 +4322,7 @@ unsigned long CPUFUNC(op_11e0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -5148,9 +4334,7 @@ unsigned long CPUFUNC(op_11e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5163,9 +4347,7 @@ unsigned long CPUFUNC(op_11f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -5176,9 +4358,7 @@ unsigned long CPUFUNC(op_11f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5189,9 +4369,7 @@ unsigned long CPUFUNC(op_11f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -5203,9 +4381,7 @@ unsigned long CPUFUNC(op_11fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5218,9 +4394,7 @@ unsigned long CPUFUNC(op_11fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -5230,9 +4404,7 @@ unsigned long CPUFUNC(op_11fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -5243,9 +4415,7 @@ unsigned long CPUFUNC(op_13c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -5256,9 +4426,7 @@ unsigned long CPUFUNC(op_13c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -5270,9 +4438,7 @@ unsigned long CPUFUNC(op_13d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5285,9 +4451,7 @@ unsigned long CPUFUNC(op_13d8_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5300,9 +4464,7 @@ unsigned long CPUFUNC(op_13e0_4)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -5314,9 +4476,7 @@ unsigned long CPUFUNC(op_13e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -5329,9 +4489,7 @@ unsigned long CPUFUNC(op_13f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -5342,9 +4500,7 @@ unsigned long CPUFUNC(op_13f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -5355,9 +4511,7 @@ unsigned long CPUFUNC(op_13f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(10);
 return 28;
@@ -5369,9 +4523,7 @@ unsigned long CPUFUNC(op_13fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -5384,9 +4536,7 @@ unsigned long CPUFUNC(op_13fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -5396,9 +4546,7 @@ unsigned long CPUFUNC(op_13fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int8_t src = get_ibyte(2);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}m68k_incpc(8);
 return 20;
@@ -5409,9 +4557,7 @@ unsigned long CPUFUNC(op_2000_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -5422,9 +4568,7 @@ unsigned long CPUFUNC(op_2008_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -5436,9 +4580,7 @@ unsigned long CPUFUNC(op_2010_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5451,9 +4593,7 @@ unsigned long CPUFUNC(op_2018_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5466,9 +4606,7 @@ unsigned long CPUFUNC(op_2020_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 4;
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -5480,9 +4618,7 @@ unsigned long CPUFUNC(op_2028_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5495,9 +4631,7 @@ unsigned long CPUFUNC(op_2030_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -5508,9 +4642,7 @@ unsigned long CPUFUNC(op_2038_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5521,9 +4653,7 @@ unsigned long CPUFUNC(op_2039_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5535,9 +4665,7 @@ unsigned long CPUFUNC(op_203a_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5550,9 +4678,7 @@ unsigned long CPUFUNC(op_203b_4)(uint32_t opcode) /* MOVE */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -5562,9 +4688,7 @@ unsigned long CPUFUNC(op_203c_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int32_t src = get_ilong(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 12;
@@ -5718,9 +4842,7 @@ unsigned long CPUFUNC(op_2080_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -5732,9 +4854,7 @@ unsigned long CPUFUNC(op_2088_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -5747,9 +4867,7 @@ unsigned long CPUFUNC(op_2090_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -5763,9 +4881,7 @@ unsigned long CPUFUNC(op_2098_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -5779,9 +4895,7 @@ unsigned long CPUFUNC(op_20a0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -5794,9 +4908,7 @@ unsigned long CPUFUNC(op_20a8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -5810,9 +4922,7 @@ unsigned long CPUFUNC(op_20b0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -5824,9 +4934,7 @@ unsigned long CPUFUNC(op_20b8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -5838,9 +4946,7 @@ unsigned long CPUFUNC(op_20b9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -5853,9 +4959,7 @@ unsigned long CPUFUNC(op_20ba_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -5869,9 +4973,7 @@ unsigned long CPUFUNC(op_20bb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -5882,9 +4984,7 @@ unsigned long CPUFUNC(op_20bc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -5897,9 +4997,7 @@ unsigned long CPUFUNC(op_20c0_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -5912,9 +5010,7 @@ unsigned long CPUFUNC(op_20c8_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -5928,9 +5024,7 @@ unsigned long CPUFUNC(op_20d0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -5945,9 +5039,7 @@ unsigned long CPUFUNC(op_20d8_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -5962,9 +5054,7 @@ unsigned long CPUFUNC(op_20e0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -5978,9 +5068,7 @@ unsigned long CPUFUNC(op_20e8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -5995,9 +5083,7 @@ unsigned long CPUFUNC(op_20f0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6010,9 +5096,7 @@ unsigned long CPUFUNC(op_20f8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6025,9 +5109,7 @@ unsigned long CPUFUNC(op_20f9_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6041,9 +5123,7 @@ unsigned long CPUFUNC(op_20fa_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6058,9 +5138,7 @@ unsigned long CPUFUNC(op_20fb_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6072,9 +5150,7 @@ unsigned long CPUFUNC(op_20fc_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -6087,9 +5163,7 @@ unsigned long CPUFUNC(op_2100_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -6102,9 +5176,7 @@ unsigned long CPUFUNC(op_2108_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -6118,9 +5190,7 @@ unsigned long CPUFUNC(op_2110_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -6135,9 +5205,7 @@ unsigned long CPUFUNC(op_2118_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -6152,9 +5220,7 @@ unsigned long CPUFUNC(op_2120_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -6168,9 +5234,7 @@ unsigned long CPUFUNC(op_2128_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6185,9 +5249,7 @@ unsigned long CPUFUNC(op_2130_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6200,9 +5262,7 @@ unsigned long CPUFUNC(op_2138_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6218,9 +5278,7 @@ unsigned long CPUFUNC(op_2139_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6234,9 +5292,7 @@ unsigned long CPUFUNC(op_213a_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6251,9 +5307,7 @@ unsigned long CPUFUNC(op_213b_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6265,9 +5319,7 @@ unsigned long CPUFUNC(op_213c_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -6279,9 +5331,7 @@ unsigned long CPUFUNC(op_2140_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -6293,9 +5343,7 @@ unsigned long CPUFUNC(op_2148_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -6308,9 +5356,7 @@ unsigned long CPUFUNC(op_2150_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6324,9 +5370,7 @@ unsigned long CPUFUNC(op_2158_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6340,9 +5384,7 @@ unsigned long CPUFUNC(op_2160_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6355,9 +5397,7 @@ unsigned long CPUFUNC(op_2168_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6371,9 +5411,7 @@ unsigned long CPUFUNC(op_2170_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6385,9 +5423,7 @@ unsigned long CPUFUNC(op_2178_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6399,9 +5435,7 @@ unsigned long CPUFUNC(op_2179_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -6414,9 +5448,7 @@ unsigned long CPUFUNC(op_217a_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6430,9 +5462,7 @@ unsigned long CPUFUNC(op_217b_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6443,9 +5473,7 @@ unsigned long CPUFUNC(op_217c_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(8);
 return 24;
@@ -6458,9 +5486,7 @@ unsigned long CPUFUNC(op_2180_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 18;
@@ -6473,9 +5499,7 @@ unsigned long CPUFUNC(op_2188_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 18;
@@ -6489,9 +5513,7 @@ unsigned long CPUFUNC(op_2190_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6506,9 +5528,7 @@ unsigned long CPUFUNC(op_2198_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6523,9 +5543,7 @@ unsigned long CPUFUNC(op_21a0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 28;
@@ -6539,9 +5557,7 @@ unsigned long CPUFUNC(op_21a8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6556,9 +5572,7 @@ unsigned long CPUFUNC(op_21b0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 32;
@@ -6571,9 +5585,7 @@ unsigned long CPUFUNC(op_21b8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6586,9 +5598,7 @@ unsigned long CPUFUNC(op_21b9_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -6602,9 +5612,7 @@ unsigned long CPUFUNC(op_21ba_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6619,9 +5627,7 @@ unsigned long CPUFUNC(op_21bb_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 32;
@@ -6633,9 +5639,7 @@ unsigned long CPUFUNC(op_21bc_4)(uint32_t opcode) /* MOVE */
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(8);
 return 26;
@@ -6646,9 +5650,7 @@ unsigned long CPUFUNC(op_21c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -6659,9 +5661,7 @@ unsigned long CPUFUNC(op_21c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -6673,9 +5673,7 @@ unsigned long CPUFUNC(op_21d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6688,9 +5686,7 @@ unsigned long CPUFUNC(op_21d8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -6703,9 +5699,7 @@ unsigned long CPUFUNC(op_21e0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -6717,9 +5711,7 @@ unsigned long CPUFUNC(op_21e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6732,9 +5724,7 @@ unsigned long CPUFUNC(op_21f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6745,9 +5735,7 @@ unsigned long CPUFUNC(op_21f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6758,9 +5746,7 @@ unsigned long CPUFUNC(op_21f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -6772,9 +5758,7 @@ unsigned long CPUFUNC(op_21fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6787,9 +5771,7 @@ unsigned long CPUFUNC(op_21fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6799,9 +5781,7 @@ unsigned long CPUFUNC(op_21fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 24; 
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(8);
 return 24;
@@ -6812,9 +5792,7 @@ unsigned long CPUFUNC(op_23c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -6825,9 +5803,7 @@ unsigned long CPUFUNC(op_23c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -6839,9 +5815,7 @@ unsigned long CPUFUNC(op_23d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6854,9 +5828,7 @@ unsigned long CPUFUNC(op_23d8_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -6869,9 +5841,7 @@ unsigned long CPUFUNC(op_23e0_4)(uint32_t opcode) /* MOVE */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -6883,9 +5853,7 @@ unsigned long CPUFUNC(op_23e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -6898,9 +5866,7 @@ unsigned long CPUFUNC(op_23f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -6911,9 +5877,7 @@ unsigned long CPUFUNC(op_23f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -6924,9 +5888,7 @@ unsigned long CPUFUNC(op_23f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -6938,9 +5900,7 @@ unsigned long CPUFUNC(op_23fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -6953,9 +5913,7 @@ unsigned long CPUFUNC(op_23fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -6965,9 +5923,7 @@ unsigned long CPUFUNC(op_23fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 28; 
 {{	int32_t src = get_ilong(2);
 {	uint32_t dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}m68k_incpc(10);
 return 28;
@@ -6978,9 +5934,7 @@ unsigned long CPUFUNC(op_3000_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -6991,9 +5945,7 @@ unsigned long CPUFUNC(op_3008_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -7005,9 +5957,7 @@ unsigned long CPUFUNC(op_3010_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -7020,9 +5970,7 @@ unsigned long CPUFUNC(op_3018_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -7035,9 +5983,7 @@ unsigned long CPUFUNC(op_3020_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 2;
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -7049,9 +5995,7 @@ unsigned long CPUFUNC(op_3028_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -7064,9 +6008,7 @@ unsigned long CPUFUNC(op_3030_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -7077,9 +6019,7 @@ unsigned long CPUFUNC(op_3038_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -7090,9 +6030,7 @@ unsigned long CPUFUNC(op_3039_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -7104,9 +6042,7 @@ unsigned long CPUFUNC(op_303a_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -7119,9 +6055,7 @@ unsigned long CPUFUNC(op_303b_4)(uint32_t opcode) /* MOVE */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -7131,9 +6065,7 @@ unsigned long CPUFUNC(op_303c_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int16_t src = get_iword(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -7287,9 +6219,7 @@ unsigned long CPUFUNC(op_3080_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7301,9 +6231,7 @@ unsigned long CPUFUNC(op_3088_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7316,9 +6244,7 @@ unsigned long CPUFUNC(op_3090_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7332,9 +6258,7 @@ unsigned long CPUFUNC(op_3098_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7348,9 +6272,7 @@ unsigned long CPUFUNC(op_30a0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -7363,9 +6285,7 @@ unsigned long CPUFUNC(op_30a8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7379,9 +6299,7 @@ unsigned long CPUFUNC(op_30b0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7393,9 +6311,7 @@ unsigned long CPUFUNC(op_30b8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7407,9 +6323,7 @@ unsigned long CPUFUNC(op_30b9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7422,9 +6336,7 @@ unsigned long CPUFUNC(op_30ba_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7438,9 +6350,7 @@ unsigned long CPUFUNC(op_30bb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7451,9 +6361,7 @@ unsigned long CPUFUNC(op_30bc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -7466,9 +6374,7 @@ unsigned long CPUFUNC(op_30c0_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7481,9 +6387,7 @@ unsigned long CPUFUNC(op_30c8_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7497,9 +6401,7 @@ unsigned long CPUFUNC(op_30d0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7514,9 +6416,7 @@ unsigned long CPUFUNC(op_30d8_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7531,9 +6431,7 @@ unsigned long CPUFUNC(op_30e0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -7547,9 +6445,7 @@ unsigned long CPUFUNC(op_30e8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7564,9 +6460,7 @@ unsigned long CPUFUNC(op_30f0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7579,9 +6473,7 @@ unsigned long CPUFUNC(op_30f8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7594,9 +6486,7 @@ unsigned long CPUFUNC(op_30f9_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7610,9 +6500,7 @@ unsigned long CPUFUNC(op_30fa_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7627,9 +6515,7 @@ unsigned long CPUFUNC(op_30fb_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7641,9 +6527,7 @@ unsigned long CPUFUNC(op_30fc_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -7656,9 +6540,7 @@ unsigned long CPUFUNC(op_3100_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7671,9 +6553,7 @@ unsigned long CPUFUNC(op_3108_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -7687,9 +6567,7 @@ unsigned long CPUFUNC(op_3110_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7704,9 +6582,7 @@ unsigned long CPUFUNC(op_3118_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -7721,9 +6597,7 @@ unsigned long CPUFUNC(op_3120_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -7737,9 +6611,7 @@ unsigned long CPUFUNC(op_3128_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7754,9 +6626,7 @@ unsigned long CPUFUNC(op_3130_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7769,9 +6639,7 @@ unsigned long CPUFUNC(op_3138_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7784,9 +6652,7 @@ unsigned long CPUFUNC(op_3139_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7800,9 +6666,7 @@ unsigned long CPUFUNC(op_313a_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7817,9 +6681,7 @@ unsigned long CPUFUNC(op_313b_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7831,9 +6693,7 @@ unsigned long CPUFUNC(op_313c_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -7845,9 +6705,7 @@ unsigned long CPUFUNC(op_3140_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -7859,9 +6717,7 @@ unsigned long CPUFUNC(op_3148_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -7874,9 +6730,7 @@ unsigned long CPUFUNC(op_3150_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7890,9 +6744,7 @@ unsigned long CPUFUNC(op_3158_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7906,9 +6758,7 @@ unsigned long CPUFUNC(op_3160_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -7921,9 +6771,7 @@ unsigned long CPUFUNC(op_3168_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7937,9 +6785,7 @@ unsigned long CPUFUNC(op_3170_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -7951,9 +6797,7 @@ unsigned long CPUFUNC(op_3178_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7965,9 +6809,7 @@ unsigned long CPUFUNC(op_3179_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -7980,9 +6822,7 @@ unsigned long CPUFUNC(op_317a_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7996,9 +6836,7 @@ unsigned long CPUFUNC(op_317b_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8009,9 +6847,7 @@ unsigned long CPUFUNC(op_317c_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -8024,9 +6860,7 @@ unsigned long CPUFUNC(op_3180_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -8039,9 +6873,7 @@ unsigned long CPUFUNC(op_3188_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -8055,9 +6887,7 @@ unsigned long CPUFUNC(op_3190_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -8072,9 +6902,7 @@ unsigned long CPUFUNC(op_3198_4)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -8089,9 +6917,7 @@ unsigned long CPUFUNC(op_31a0_4)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 20;
@@ -8105,9 +6931,7 @@ unsigned long CPUFUNC(op_31a8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8122,9 +6946,7 @@ unsigned long CPUFUNC(op_31b0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -8137,9 +6959,7 @@ unsigned long CPUFUNC(op_31b8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8152,9 +6972,7 @@ unsigned long CPUFUNC(op_31b9_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -8168,9 +6986,7 @@ unsigned long CPUFUNC(op_31ba_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8185,9 +7001,7 @@ unsigned long CPUFUNC(op_31bb_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -8199,9 +7013,7 @@ unsigned long CPUFUNC(op_31bc_4)(uint32_t opcode) /* MOVE */
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(6);
 return 18;
@@ -8212,9 +7024,7 @@ unsigned long CPUFUNC(op_31c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -8225,9 +7035,7 @@ unsigned long CPUFUNC(op_31c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -8239,9 +7047,7 @@ unsigned long CPUFUNC(op_31d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -8254,9 +7060,7 @@ unsigned long CPUFUNC(op_31d8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -8269,9 +7073,7 @@ unsigned long CPUFUNC(op_31e0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -8283,9 +7085,7 @@ unsigned long CPUFUNC(op_31e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8298,9 +7098,7 @@ unsigned long CPUFUNC(op_31f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8311,9 +7109,7 @@ unsigned long CPUFUNC(op_31f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8324,9 +7120,7 @@ unsigned long CPUFUNC(op_31f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -8338,9 +7132,7 @@ unsigned long CPUFUNC(op_31fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8353,9 +7145,7 @@ unsigned long CPUFUNC(op_31fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8365,9 +7155,7 @@ unsigned long CPUFUNC(op_31fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -8378,9 +7166,7 @@ unsigned long CPUFUNC(op_33c0_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -8391,9 +7177,7 @@ unsigned long CPUFUNC(op_33c8_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -8405,9 +7189,7 @@ unsigned long CPUFUNC(op_33d0_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8420,9 +7202,7 @@ unsigned long CPUFUNC(op_33d8_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8435,9 +7215,7 @@ unsigned long CPUFUNC(op_33e0_4)(uint32_t opcode) /* MOVE */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -8449,9 +7227,7 @@ unsigned long CPUFUNC(op_33e8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -8464,9 +7240,7 @@ unsigned long CPUFUNC(op_33f0_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -8477,9 +7251,7 @@ unsigned long CPUFUNC(op_33f8_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -8490,9 +7262,7 @@ unsigned long CPUFUNC(op_33f9_4)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(10);
 return 28;
@@ -8504,9 +7274,7 @@ unsigned long CPUFUNC(op_33fa_4)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -8519,9 +7287,7 @@ unsigned long CPUFUNC(op_33fb_4)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -8531,9 +7297,7 @@ unsigned long CPUFUNC(op_33fc_4)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int16_t src = get_iword(2);
 {	uint32_t dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}m68k_incpc(8);
 return 20;
@@ -9312,9 +8076,7 @@ unsigned long CPUFUNC(op_4200_4)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 return 4;
@@ -9325,9 +8087,7 @@ unsigned long CPUFUNC(op_4210_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -9339,9 +8099,7 @@ unsigned long CPUFUNC(op_4218_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -9353,9 +8111,7 @@ unsigned long CPUFUNC(op_4220_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(2);
 return 14;
@@ -9366,9 +8122,7 @@ unsigned long CPUFUNC(op_4228_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -9380,9 +8134,7 @@ unsigned long CPUFUNC(op_4230_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(4);
 return 18;
@@ -9392,9 +8144,7 @@ unsigned long CPUFUNC(op_4238_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -9404,9 +8154,7 @@ unsigned long CPUFUNC(op_4239_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uint32_t srca = get_ilong(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_write_memory_8(srca,0);
 }}m68k_incpc(6);
 return 20;
@@ -9415,9 +8163,7 @@ unsigned long CPUFUNC(op_4240_4)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 return 4;
@@ -9428,9 +8174,7 @@ unsigned long CPUFUNC(op_4250_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -9442,9 +8186,7 @@ unsigned long CPUFUNC(op_4258_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -9456,9 +8198,7 @@ unsigned long CPUFUNC(op_4260_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(2);
 return 14;
@@ -9469,9 +8209,7 @@ unsigned long CPUFUNC(op_4268_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -9486,9 +8224,7 @@ unsigned long CPUFUNC(op_4270_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(4);
 return 18;
@@ -9498,9 +8234,7 @@ unsigned long CPUFUNC(op_4278_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -9510,9 +8244,7 @@ unsigned long CPUFUNC(op_4279_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uint32_t srca = get_ilong(2);
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_write_memory_16(srca,0);
 }}m68k_incpc(6);
 return 20;
@@ -9521,9 +8253,7 @@ unsigned long CPUFUNC(op_4280_4)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 return 6;
@@ -9534,9 +8264,7 @@ unsigned long CPUFUNC(op_4290_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(2);
 return 20;
@@ -9548,9 +8276,7 @@ unsigned long CPUFUNC(op_4298_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(2);
 return 20;
@@ -9562,9 +8288,7 @@ unsigned long CPUFUNC(op_42a0_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(2);
 return 22;
@@ -9575,9 +8299,7 @@ unsigned long CPUFUNC(op_42a8_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(4);
 return 24;
@@ -9589,9 +8311,7 @@ unsigned long CPUFUNC(op_42b0_4)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(4);
 return 26;
@@ -9601,9 +8321,7 @@ unsigned long CPUFUNC(op_42b8_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 24; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(4);
 return 24;
@@ -9613,9 +8331,7 @@ unsigned long CPUFUNC(op_42b9_4)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 28; 
 {{	uint32_t srca = get_ilong(2);
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_write_memory_32(srca,0);
 }}m68k_incpc(6);
 return 28;
@@ -9626,16 +8342,9 @@ unsigned long CPUFUNC(op_4400_4)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_4410_4)(uint32_t opcode) /* NEG */
@@ -9645,16 +8354,9 @@ unsigned long CPUFUNC(op_4410_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_4418_4)(uint32_t opcode) /* NEG */
@@ -9665,16 +8367,9 @@ unsigned long CPUFUNC(op_4418_4)(uint32_t opcode) /* NEG */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_4420_4)(uint32_t opcode) /* NEG */
@@ -9685,16 +8380,9 @@ unsigned long CPUFUNC(op_4420_4)(uint32_t opcode) /* NEG */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_4428_4)(uint32_t opcode) /* NEG */
@@ -9704,16 +8392,9 @@ unsigned long CPUFUNC(op_4428_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_4430_4)(uint32_t opcode) /* NEG */
@@ -9724,16 +8405,9 @@ unsigned long CPUFUNC(op_4430_4)(uint32_t opcode) /* NEG */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_4438_4)(uint32_t opcode) /* NEG */
@@ -9742,16 +8416,9 @@ unsigned long CPUFUNC(op_4438_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_4439_4)(uint32_t opcode) /* NEG */
@@ -9760,16 +8427,9 @@ unsigned long CPUFUNC(op_4439_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_write_memory_8(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_4440_4)(uint32_t opcode) /* NEG */
@@ -9778,16 +8438,9 @@ unsigned long CPUFUNC(op_4440_4)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_4450_4)(uint32_t opcode) /* NEG */
@@ -9797,16 +8450,9 @@ unsigned long CPUFUNC(op_4450_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_4458_4)(uint32_t opcode) /* NEG */
@@ -9817,16 +8463,9 @@ unsigned long CPUFUNC(op_4458_4)(uint32_t opcode) /* NEG */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_4460_4)(uint32_t opcode) /* NEG */
@@ -9837,16 +8476,9 @@ unsigned long CPUFUNC(op_4460_4)(uint32_t opcode) /* NEG */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_4468_4)(uint32_t opcode) /* NEG */
@@ -9856,16 +8488,9 @@ unsigned long CPUFUNC(op_4468_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_4470_4)(uint32_t opcode) /* NEG */
@@ -9876,16 +8501,9 @@ unsigned long CPUFUNC(op_4470_4)(uint32_t opcode) /* NEG */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_4478_4)(uint32_t opcode) /* NEG */
@@ -9894,16 +8512,9 @@ unsigned long CPUFUNC(op_4478_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_4479_4)(uint32_t opcode) /* NEG */
@@ -9912,16 +8523,9 @@ unsigned long CPUFUNC(op_4479_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_write_memory_16(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_4480_4)(uint32_t opcode) /* NEG */
@@ -9930,16 +8534,9 @@ unsigned long CPUFUNC(op_4480_4)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 6;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_4490_4)(uint32_t opcode) /* NEG */
@@ -9949,16 +8546,9 @@ unsigned long CPUFUNC(op_4490_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_4498_4)(uint32_t opcode) /* NEG */
@@ -9969,16 +8559,9 @@ unsigned long CPUFUNC(op_4498_4)(uint32_t opcode) /* NEG */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_44a0_4)(uint32_t opcode) /* NEG */
@@ -9989,16 +8572,9 @@ unsigned long CPUFUNC(op_44a0_4)(uint32_t opcode) /* NEG */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 22;
 }
 unsigned long CPUFUNC(op_44a8_4)(uint32_t opcode) /* NEG */
@@ -10008,16 +8584,9 @@ unsigned long CPUFUNC(op_44a8_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_44b0_4)(uint32_t opcode) /* NEG */
@@ -10028,16 +8597,9 @@ unsigned long CPUFUNC(op_44b0_4)(uint32_t opcode) /* NEG */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 26;
 }
 unsigned long CPUFUNC(op_44b8_4)(uint32_t opcode) /* NEG */
@@ -10046,16 +8608,9 @@ unsigned long CPUFUNC(op_44b8_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_44b9_4)(uint32_t opcode) /* NEG */
@@ -10064,16 +8619,9 @@ unsigned long CPUFUNC(op_44b9_4)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_write_memory_32(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_44c0_4)(uint32_t opcode) /* MV2SR */
@@ -10224,9 +8772,7 @@ unsigned long CPUFUNC(op_4600_4)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -10238,9 +8784,7 @@ unsigned long CPUFUNC(op_4610_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -10253,9 +8797,7 @@ unsigned long CPUFUNC(op_4618_4)(uint32_t opcode) /* NOT */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -10268,9 +8810,7 @@ unsigned long CPUFUNC(op_4620_4)(uint32_t opcode) /* NOT */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(2);
 return 14;
@@ -10282,9 +8822,7 @@ unsigned long CPUFUNC(op_4628_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -10297,9 +8835,7 @@ unsigned long CPUFUNC(op_4630_4)(uint32_t opcode) /* NOT */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(4);
 return 18;
@@ -10310,9 +8846,7 @@ unsigned long CPUFUNC(op_4638_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -10323,9 +8857,7 @@ unsigned long CPUFUNC(op_4639_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_write_memory_8(srca,dst);
 }}}}m68k_incpc(6);
 return 20;
@@ -10336,9 +8868,7 @@ unsigned long CPUFUNC(op_4640_4)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -10350,9 +8880,7 @@ unsigned long CPUFUNC(op_4650_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -10365,9 +8893,7 @@ unsigned long CPUFUNC(op_4658_4)(uint32_t opcode) /* NOT */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -10380,9 +8906,7 @@ unsigned long CPUFUNC(op_4660_4)(uint32_t opcode) /* NOT */
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(2);
 return 14;
@@ -10394,9 +8918,7 @@ unsigned long CPUFUNC(op_4668_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -10409,9 +8931,7 @@ unsigned long CPUFUNC(op_4670_4)(uint32_t opcode) /* NOT */
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(4);
 return 18;
@@ -10422,9 +8942,7 @@ unsigned long CPUFUNC(op_4678_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -10435,9 +8953,7 @@ unsigned long CPUFUNC(op_4679_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_write_memory_16(srca,dst);
 }}}}m68k_incpc(6);
 return 20;
@@ -10448,9 +8964,7 @@ unsigned long CPUFUNC(op_4680_4)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 6;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 6;
@@ -10462,9 +8976,7 @@ unsigned long CPUFUNC(op_4690_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(2);
 return 20;
@@ -10477,9 +8989,7 @@ unsigned long CPUFUNC(op_4698_4)(uint32_t opcode) /* NOT */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(2);
 return 20;
@@ -10492,9 +9002,7 @@ unsigned long CPUFUNC(op_46a0_4)(uint32_t opcode) /* NOT */
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(2);
 return 22;
@@ -10506,9 +9014,7 @@ unsigned long CPUFUNC(op_46a8_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(4);
 return 24;
@@ -10521,9 +9027,7 @@ unsigned long CPUFUNC(op_46b0_4)(uint32_t opcode) /* NOT */
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(4);
 return 26;
@@ -10534,9 +9038,7 @@ unsigned long CPUFUNC(op_46b8_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(4);
 return 24;
@@ -10547,9 +9049,7 @@ unsigned long CPUFUNC(op_46b9_4)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_write_memory_32(srca,dst);
 }}}}m68k_incpc(6);
 return 28;
@@ -10870,9 +9370,7 @@ unsigned long CPUFUNC(op_4840_4)(uint32_t opcode) /* SWAP */
 	OpcodeFamily = 34; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 4;
@@ -10960,9 +9458,7 @@ unsigned long CPUFUNC(op_4880_4)(uint32_t opcode) /* EXT */
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint16_t dst = (int16_t)(int8_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -11057,9 +9553,7 @@ unsigned long CPUFUNC(op_48c0_4)(uint32_t opcode) /* EXT */
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = (int32_t)(int16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 4;
@@ -11153,9 +9647,7 @@ unsigned long CPUFUNC(op_4a00_4)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}m68k_incpc(2);
 return 4;
 }
@@ -11165,9 +9657,7 @@ unsigned long CPUFUNC(op_4a10_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 return 8;
 }
@@ -11178,9 +9668,7 @@ unsigned long CPUFUNC(op_4a18_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 return 8;
 }
@@ -11191,9 +9679,7 @@ unsigned long CPUFUNC(op_4a20_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 return 10;
 }
@@ -11203,9 +9689,7 @@ unsigned long CPUFUNC(op_4a28_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11216,9 +9700,7 @@ unsigned long CPUFUNC(op_4a30_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 return 14;
 }
@@ -11227,9 +9709,7 @@ unsigned long CPUFUNC(op_4a38_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11238,9 +9718,7 @@ unsigned long CPUFUNC(op_4a39_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(6);
 return 16;
 }
@@ -11250,9 +9728,7 @@ unsigned long CPUFUNC(op_4a3a_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11263,9 +9739,7 @@ unsigned long CPUFUNC(op_4a3b_4)(uint32_t opcode) /* TST */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 return 14;
 }
@@ -11273,9 +9747,7 @@ unsigned long CPUFUNC(op_4a3c_4)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	int8_t src = get_ibyte(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}m68k_incpc(4);
 return 8;
 }
@@ -11284,9 +9756,7 @@ unsigned long CPUFUNC(op_4a40_4)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(2);
 return 4;
 }
@@ -11295,9 +9765,7 @@ unsigned long CPUFUNC(op_4a48_4)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(2);
 return 4;
 }
@@ -11307,9 +9775,7 @@ unsigned long CPUFUNC(op_4a50_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(2);
 return 8;
 }
@@ -11320,9 +9786,7 @@ unsigned long CPUFUNC(op_4a58_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(2);
 return 8;
 }
@@ -11333,9 +9797,7 @@ unsigned long CPUFUNC(op_4a60_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 2;
 {	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(2);
 return 10;
 }
@@ -11345,9 +9807,7 @@ unsigned long CPUFUNC(op_4a68_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11358,9 +9818,7 @@ unsigned long CPUFUNC(op_4a70_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(4);
 return 14;
 }
@@ -11369,9 +9827,7 @@ unsigned long CPUFUNC(op_4a78_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11380,9 +9836,7 @@ unsigned long CPUFUNC(op_4a79_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong(2);
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(6);
 return 16;
 }
@@ -11392,9 +9846,7 @@ unsigned long CPUFUNC(op_4a7a_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(4);
 return 12;
 }
@@ -11405,9 +9857,7 @@ unsigned long CPUFUNC(op_4a7b_4)(uint32_t opcode) /* TST */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}m68k_incpc(4);
 return 14;
 }
@@ -11415,9 +9865,7 @@ unsigned long CPUFUNC(op_4a7c_4)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	int16_t src = get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(4);
 return 8;
 }
@@ -11426,9 +9874,7 @@ unsigned long CPUFUNC(op_4a80_4)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(2);
 return 4;
 }
@@ -11437,9 +9883,7 @@ unsigned long CPUFUNC(op_4a88_4)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(2);
 return 4;
 }
@@ -11449,9 +9893,7 @@ unsigned long CPUFUNC(op_4a90_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(2);
 return 12;
 }
@@ -11462,9 +9904,7 @@ unsigned long CPUFUNC(op_4a98_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(2);
 return 12;
 }
@@ -11475,9 +9915,7 @@ unsigned long CPUFUNC(op_4aa0_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - 4;
 {	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(2);
 return 14;
 }
@@ -11487,9 +9925,7 @@ unsigned long CPUFUNC(op_4aa8_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(4);
 return 16;
 }
@@ -11500,9 +9936,7 @@ unsigned long CPUFUNC(op_4ab0_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(4);
 return 18;
 }
@@ -11511,9 +9945,7 @@ unsigned long CPUFUNC(op_4ab8_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(4);
 return 16;
 }
@@ -11522,9 +9954,7 @@ unsigned long CPUFUNC(op_4ab9_4)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 20; 
 {{	uint32_t srca = get_ilong(2);
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(6);
 return 20;
 }
@@ -11534,9 +9964,7 @@ unsigned long CPUFUNC(op_4aba_4)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword(2);
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(4);
 return 16;
 }
@@ -11547,9 +9975,7 @@ unsigned long CPUFUNC(op_4abb_4)(uint32_t opcode) /* TST */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword(2));
 	BusCyclePenalty += 2;
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}m68k_incpc(4);
 return 18;
 }
@@ -11557,9 +9983,7 @@ unsigned long CPUFUNC(op_4abc_4)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	int32_t src = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(6);
 return 12;
 }
@@ -11568,9 +9992,7 @@ unsigned long CPUFUNC(op_4ac0_4)(uint32_t opcode) /* TAS */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 98; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -11582,9 +10004,7 @@ unsigned long CPUFUNC(op_4ad0_4)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 14; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(2);
@@ -11597,9 +10017,7 @@ unsigned long CPUFUNC(op_4ad8_4)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(2);
@@ -11612,9 +10030,7 @@ unsigned long CPUFUNC(op_4ae0_4)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(2);
@@ -11626,9 +10042,7 @@ unsigned long CPUFUNC(op_4ae8_4)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 18; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(4);
@@ -11641,9 +10055,7 @@ unsigned long CPUFUNC(op_4af0_4)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(4);
@@ -11654,9 +10066,7 @@ unsigned long CPUFUNC(op_4af8_4)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 18; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(4);
@@ -11667,9 +10077,7 @@ unsigned long CPUFUNC(op_4af9_4)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 22; 
 {{	uint32_t srca = get_ilong(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_write_memory_8(srca,src);
 }}}m68k_incpc(6);
@@ -12171,16 +10579,9 @@ unsigned long CPUFUNC(op_5000_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_5010_4)(uint32_t opcode) /* ADD */
@@ -12193,16 +10594,9 @@ unsigned long CPUFUNC(op_5010_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5018_4)(uint32_t opcode) /* ADD */
@@ -12216,16 +10610,9 @@ unsigned long CPUFUNC(op_5018_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 #endif
@@ -12242,16 +10629,9 @@ unsigned long CPUFUNC(op_5020_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_5028_4)(uint32_t opcode) /* ADD */
@@ -12264,16 +10644,9 @@ unsigned long CPUFUNC(op_5028_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5030_4)(uint32_t opcode) /* ADD */
@@ -12287,16 +10660,9 @@ unsigned long CPUFUNC(op_5030_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_5038_4)(uint32_t opcode) /* ADD */
@@ -12308,16 +10674,9 @@ unsigned long CPUFUNC(op_5038_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5039_4)(uint32_t opcode) /* ADD */
@@ -12329,16 +10688,9 @@ unsigned long CPUFUNC(op_5039_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_5040_4)(uint32_t opcode) /* ADD */
@@ -12350,16 +10702,9 @@ unsigned long CPUFUNC(op_5040_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_5048_4)(uint32_t opcode) /* ADDA */
@@ -12384,16 +10729,9 @@ unsigned long CPUFUNC(op_5050_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5058_4)(uint32_t opcode) /* ADD */
@@ -12407,16 +10745,9 @@ unsigned long CPUFUNC(op_5058_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5060_4)(uint32_t opcode) /* ADD */
@@ -12430,16 +10761,9 @@ unsigned long CPUFUNC(op_5060_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_5068_4)(uint32_t opcode) /* ADD */
@@ -12452,16 +10776,9 @@ unsigned long CPUFUNC(op_5068_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5070_4)(uint32_t opcode) /* ADD */
@@ -12475,16 +10792,9 @@ unsigned long CPUFUNC(op_5070_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_5078_4)(uint32_t opcode) /* ADD */
@@ -12496,16 +10806,9 @@ unsigned long CPUFUNC(op_5078_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5079_4)(uint32_t opcode) /* ADD */
@@ -12517,16 +10820,9 @@ unsigned long CPUFUNC(op_5079_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_5080_4)(uint32_t opcode) /* ADD */
@@ -12538,16 +10834,9 @@ unsigned long CPUFUNC(op_5080_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_5088_4)(uint32_t opcode) /* ADDA */
@@ -12572,16 +10861,9 @@ unsigned long CPUFUNC(op_5090_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_5098_4)(uint32_t opcode) /* ADD */
@@ -12595,16 +10877,9 @@ unsigned long CPUFUNC(op_5098_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_50a0_4)(uint32_t opcode) /* ADD */
@@ -12618,16 +10893,9 @@ unsigned long CPUFUNC(op_50a0_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 22;
 }
 unsigned long CPUFUNC(op_50a8_4)(uint32_t opcode) /* ADD */
@@ -12640,16 +10908,9 @@ unsigned long CPUFUNC(op_50a8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_50b0_4)(uint32_t opcode) /* ADD */
@@ -12663,16 +10924,9 @@ unsigned long CPUFUNC(op_50b0_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 26;
 }
 unsigned long CPUFUNC(op_50b8_4)(uint32_t opcode) /* ADD */
@@ -12684,16 +10938,9 @@ unsigned long CPUFUNC(op_50b8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_50b9_4)(uint32_t opcode) /* ADD */
@@ -12705,16 +10952,9 @@ unsigned long CPUFUNC(op_50b9_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_50c0_4)(uint32_t opcode) /* Scc */
@@ -12825,16 +11065,9 @@ unsigned long CPUFUNC(op_5100_4)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_5110_4)(uint32_t opcode) /* SUB */
@@ -12846,16 +11079,9 @@ unsigned long CPUFUNC(op_5110_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5118_4)(uint32_t opcode) /* SUB */
@@ -12868,16 +11094,9 @@ unsigned long CPUFUNC(op_5118_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5120_4)(uint32_t opcode) /* SUB */
@@ -12890,16 +11109,9 @@ unsigned long CPUFUNC(op_5120_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_5128_4)(uint32_t opcode) /* SUB */
@@ -12911,16 +11123,9 @@ unsigned long CPUFUNC(op_5128_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5130_4)(uint32_t opcode) /* SUB */
@@ -12933,16 +11138,9 @@ unsigned long CPUFUNC(op_5130_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_5138_4)(uint32_t opcode) /* SUB */
@@ -12953,16 +11151,9 @@ unsigned long CPUFUNC(op_5138_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5139_4)(uint32_t opcode) /* SUB */
@@ -12973,16 +11164,9 @@ unsigned long CPUFUNC(op_5139_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_5140_4)(uint32_t opcode) /* SUB */
@@ -12993,16 +11177,9 @@ unsigned long CPUFUNC(op_5140_4)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_5148_4)(uint32_t opcode) /* SUBA */
@@ -13026,16 +11203,9 @@ unsigned long CPUFUNC(op_5150_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5158_4)(uint32_t opcode) /* SUB */
@@ -13048,16 +11218,9 @@ unsigned long CPUFUNC(op_5158_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_5160_4)(uint32_t opcode) /* SUB */
@@ -13070,16 +11233,9 @@ unsigned long CPUFUNC(op_5160_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_5168_4)(uint32_t opcode) /* SUB */
@@ -13091,16 +11247,9 @@ unsigned long CPUFUNC(op_5168_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5170_4)(uint32_t opcode) /* SUB */
@@ -13113,16 +11262,9 @@ unsigned long CPUFUNC(op_5170_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_5178_4)(uint32_t opcode) /* SUB */
@@ -13133,16 +11275,9 @@ unsigned long CPUFUNC(op_5178_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_5179_4)(uint32_t opcode) /* SUB */
@@ -13153,16 +11288,9 @@ unsigned long CPUFUNC(op_5179_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_5180_4)(uint32_t opcode) /* SUB */
@@ -13173,16 +11301,9 @@ unsigned long CPUFUNC(op_5180_4)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_5188_4)(uint32_t opcode) /* SUBA */
@@ -13206,16 +11327,9 @@ unsigned long CPUFUNC(op_5190_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_5198_4)(uint32_t opcode) /* SUB */
@@ -13228,16 +11342,9 @@ unsigned long CPUFUNC(op_5198_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_51a0_4)(uint32_t opcode) /* SUB */
@@ -13250,16 +11357,9 @@ unsigned long CPUFUNC(op_51a0_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 22;
 }
 unsigned long CPUFUNC(op_51a8_4)(uint32_t opcode) /* SUB */
@@ -13271,16 +11371,9 @@ unsigned long CPUFUNC(op_51a8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_51b0_4)(uint32_t opcode) /* SUB */
@@ -13293,16 +11386,9 @@ unsigned long CPUFUNC(op_51b0_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 26;
 }
 unsigned long CPUFUNC(op_51b8_4)(uint32_t opcode) /* SUB */
@@ -13313,16 +11399,9 @@ unsigned long CPUFUNC(op_51b8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_51b9_4)(uint32_t opcode) /* SUB */
@@ -13333,16 +11412,9 @@ unsigned long CPUFUNC(op_51b9_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_51c0_4)(uint32_t opcode) /* Scc */
@@ -15479,9 +13551,7 @@ unsigned long CPUFUNC(op_7000_4)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uint32_t src = srcreg;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -15494,9 +13564,7 @@ unsigned long CPUFUNC(op_8000_4)(uint32_t opcode) /* OR */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -15510,9 +13578,7 @@ unsigned long CPUFUNC(op_8010_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -15527,9 +13593,7 @@ unsigned long CPUFUNC(op_8018_4)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -15544,9 +13608,7 @@ unsigned long CPUFUNC(op_8020_4)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -15560,9 +13622,7 @@ unsigned long CPUFUNC(op_8028_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15577,9 +13637,7 @@ unsigned long CPUFUNC(op_8030_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -15592,9 +13650,7 @@ unsigned long CPUFUNC(op_8038_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15607,9 +13663,7 @@ unsigned long CPUFUNC(op_8039_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -15623,9 +13677,7 @@ unsigned long CPUFUNC(op_803a_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15640,9 +13692,7 @@ unsigned long CPUFUNC(op_803b_4)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -15654,9 +13704,7 @@ unsigned long CPUFUNC(op_803c_4)(uint32_t opcode) /* OR */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -15669,9 +13717,7 @@ unsigned long CPUFUNC(op_8040_4)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -15685,9 +13731,7 @@ unsigned long CPUFUNC(op_8050_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -15702,9 +13746,7 @@ unsigned long CPUFUNC(op_8058_4)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -15719,9 +13761,7 @@ unsigned long CPUFUNC(op_8060_4)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -15735,9 +13775,7 @@ unsigned long CPUFUNC(op_8068_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15752,9 +13790,7 @@ unsigned long CPUFUNC(op_8070_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -15767,9 +13803,7 @@ unsigned long CPUFUNC(op_8078_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15782,9 +13816,7 @@ unsigned long CPUFUNC(op_8079_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -15798,9 +13830,7 @@ unsigned long CPUFUNC(op_807a_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -15815,9 +13845,7 @@ unsigned long CPUFUNC(op_807b_4)(uint32_t opcode) /* OR */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -15829,9 +13857,7 @@ unsigned long CPUFUNC(op_807c_4)(uint32_t opcode) /* OR */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -15844,9 +13870,7 @@ unsigned long CPUFUNC(op_8080_4)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -15860,9 +13884,7 @@ unsigned long CPUFUNC(op_8090_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -15877,9 +13899,7 @@ unsigned long CPUFUNC(op_8098_4)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -15894,9 +13914,7 @@ unsigned long CPUFUNC(op_80a0_4)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 16;
@@ -15910,9 +13928,7 @@ unsigned long CPUFUNC(op_80a8_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -15927,9 +13943,7 @@ unsigned long CPUFUNC(op_80b0_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -15942,9 +13956,7 @@ unsigned long CPUFUNC(op_80b8_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -15957,9 +13969,7 @@ unsigned long CPUFUNC(op_80b9_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 22;
@@ -15973,9 +13983,7 @@ unsigned long CPUFUNC(op_80ba_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -15990,9 +13998,7 @@ unsigned long CPUFUNC(op_80bb_4)(uint32_t opcode) /* OR */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -16004,9 +14010,7 @@ unsigned long CPUFUNC(op_80bc_4)(uint32_t opcode) /* OR */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -16026,9 +14030,7 @@ m68k_incpc(2);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16053,9 +14055,7 @@ m68k_incpc(2);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16081,9 +14081,7 @@ m68k_incpc(2);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16109,9 +14107,7 @@ m68k_incpc(2);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16136,9 +14132,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16164,9 +14158,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16190,9 +14182,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16216,9 +14206,7 @@ m68k_incpc(6);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16243,9 +14231,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16271,9 +14257,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16296,9 +14280,7 @@ m68k_incpc(4);
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16366,9 +14348,7 @@ unsigned long CPUFUNC(op_8110_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -16383,9 +14363,7 @@ unsigned long CPUFUNC(op_8118_4)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -16400,9 +14378,7 @@ unsigned long CPUFUNC(op_8120_4)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -16416,9 +14392,7 @@ unsigned long CPUFUNC(op_8128_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -16433,9 +14407,7 @@ unsigned long CPUFUNC(op_8130_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -16448,9 +14420,7 @@ unsigned long CPUFUNC(op_8138_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -16463,9 +14433,7 @@ unsigned long CPUFUNC(op_8139_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -16479,9 +14447,7 @@ unsigned long CPUFUNC(op_8150_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -16496,9 +14462,7 @@ unsigned long CPUFUNC(op_8158_4)(uint32_t opcode) /* OR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -16513,9 +14477,7 @@ unsigned long CPUFUNC(op_8160_4)(uint32_t opcode) /* OR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -16529,9 +14491,7 @@ unsigned long CPUFUNC(op_8168_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -16546,9 +14506,7 @@ unsigned long CPUFUNC(op_8170_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -16561,9 +14519,7 @@ unsigned long CPUFUNC(op_8178_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -16576,9 +14532,7 @@ unsigned long CPUFUNC(op_8179_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -16592,9 +14546,7 @@ unsigned long CPUFUNC(op_8190_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -16609,9 +14561,7 @@ unsigned long CPUFUNC(op_8198_4)(uint32_t opcode) /* OR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -16626,9 +14576,7 @@ unsigned long CPUFUNC(op_81a0_4)(uint32_t opcode) /* OR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -16642,9 +14590,7 @@ unsigned long CPUFUNC(op_81a8_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -16659,9 +14605,7 @@ unsigned long CPUFUNC(op_81b0_4)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -16674,9 +14618,7 @@ unsigned long CPUFUNC(op_81b8_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -16689,9 +14631,7 @@ unsigned long CPUFUNC(op_81b9_4)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -16712,9 +14652,7 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16740,9 +14678,7 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16769,9 +14705,7 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16798,9 +14732,7 @@ m68k_incpc(2);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16826,9 +14758,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16855,9 +14785,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16882,9 +14810,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16909,9 +14835,7 @@ m68k_incpc(6);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16937,9 +14861,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16966,9 +14888,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -16992,9 +14912,7 @@ m68k_incpc(4);
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -17011,16 +14929,9 @@ unsigned long CPUFUNC(op_9000_4)(uint32_t opcode) /* SUB */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_9010_4)(uint32_t opcode) /* SUB */
@@ -17032,16 +14943,9 @@ unsigned long CPUFUNC(op_9010_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9018_4)(uint32_t opcode) /* SUB */
@@ -17054,16 +14958,9 @@ unsigned long CPUFUNC(op_9018_4)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9020_4)(uint32_t opcode) /* SUB */
@@ -17076,16 +14973,9 @@ unsigned long CPUFUNC(op_9020_4)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_9028_4)(uint32_t opcode) /* SUB */
@@ -17097,16 +14987,9 @@ unsigned long CPUFUNC(op_9028_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_9030_4)(uint32_t opcode) /* SUB */
@@ -17119,16 +15002,9 @@ unsigned long CPUFUNC(op_9030_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_9038_4)(uint32_t opcode) /* SUB */
@@ -17139,16 +15015,9 @@ unsigned long CPUFUNC(op_9038_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_9039_4)(uint32_t opcode) /* SUB */
@@ -17159,16 +15028,9 @@ unsigned long CPUFUNC(op_9039_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_903a_4)(uint32_t opcode) /* SUB */
@@ -17180,16 +15042,9 @@ unsigned long CPUFUNC(op_903a_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_903b_4)(uint32_t opcode) /* SUB */
@@ -17202,16 +15057,9 @@ unsigned long CPUFUNC(op_903b_4)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_903c_4)(uint32_t opcode) /* SUB */
@@ -17221,16 +15069,9 @@ unsigned long CPUFUNC(op_903c_4)(uint32_t opcode) /* SUB */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_9040_4)(uint32_t opcode) /* SUB */
@@ -17241,16 +15082,9 @@ unsigned long CPUFUNC(op_9040_4)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_9048_4)(uint32_t opcode) /* SUB */
@@ -17261,16 +15095,9 @@ unsigned long CPUFUNC(op_9048_4)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_9050_4)(uint32_t opcode) /* SUB */
@@ -17282,16 +15109,9 @@ unsigned long CPUFUNC(op_9050_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9058_4)(uint32_t opcode) /* SUB */
@@ -17304,16 +15124,9 @@ unsigned long CPUFUNC(op_9058_4)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9060_4)(uint32_t opcode) /* SUB */
@@ -17326,16 +15139,9 @@ unsigned long CPUFUNC(op_9060_4)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_9068_4)(uint32_t opcode) /* SUB */
@@ -17347,16 +15153,9 @@ unsigned long CPUFUNC(op_9068_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_9070_4)(uint32_t opcode) /* SUB */
@@ -17369,16 +15168,9 @@ unsigned long CPUFUNC(op_9070_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_9078_4)(uint32_t opcode) /* SUB */
@@ -17389,16 +15181,9 @@ unsigned long CPUFUNC(op_9078_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_9079_4)(uint32_t opcode) /* SUB */
@@ -17409,16 +15194,9 @@ unsigned long CPUFUNC(op_9079_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_907a_4)(uint32_t opcode) /* SUB */
@@ -17430,16 +15208,9 @@ unsigned long CPUFUNC(op_907a_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_907b_4)(uint32_t opcode) /* SUB */
@@ -17452,16 +15223,9 @@ unsigned long CPUFUNC(op_907b_4)(uint32_t opcode) /* SUB */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_907c_4)(uint32_t opcode) /* SUB */
@@ -17471,16 +15235,9 @@ unsigned long CPUFUNC(op_907c_4)(uint32_t opcode) /* SUB */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_9080_4)(uint32_t opcode) /* SUB */
@@ -17491,16 +15248,9 @@ unsigned long CPUFUNC(op_9080_4)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9088_4)(uint32_t opcode) /* SUB */
@@ -17511,16 +15261,9 @@ unsigned long CPUFUNC(op_9088_4)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_9090_4)(uint32_t opcode) /* SUB */
@@ -17532,16 +15275,9 @@ unsigned long CPUFUNC(op_9090_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_9098_4)(uint32_t opcode) /* SUB */
@@ -17554,16 +15290,9 @@ unsigned long CPUFUNC(op_9098_4)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_90a0_4)(uint32_t opcode) /* SUB */
@@ -17576,16 +15305,9 @@ unsigned long CPUFUNC(op_90a0_4)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 16;
 }
 unsigned long CPUFUNC(op_90a8_4)(uint32_t opcode) /* SUB */
@@ -17597,16 +15319,9 @@ unsigned long CPUFUNC(op_90a8_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_90b0_4)(uint32_t opcode) /* SUB */
@@ -17619,16 +15334,9 @@ unsigned long CPUFUNC(op_90b0_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_90b8_4)(uint32_t opcode) /* SUB */
@@ -17639,16 +15347,9 @@ unsigned long CPUFUNC(op_90b8_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_90b9_4)(uint32_t opcode) /* SUB */
@@ -17659,16 +15360,9 @@ unsigned long CPUFUNC(op_90b9_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_90ba_4)(uint32_t opcode) /* SUB */
@@ -17680,16 +15374,9 @@ unsigned long CPUFUNC(op_90ba_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_90bb_4)(uint32_t opcode) /* SUB */
@@ -17702,16 +15389,9 @@ unsigned long CPUFUNC(op_90bb_4)(uint32_t opcode) /* SUB */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_90bc_4)(uint32_t opcode) /* SUB */
@@ -17721,16 +15401,9 @@ unsigned long CPUFUNC(op_90bc_4)(uint32_t opcode) /* SUB */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_90c0_4)(uint32_t opcode) /* SUBA */
@@ -17940,16 +15613,9 @@ unsigned long CPUFUNC(op_9110_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_9118_4)(uint32_t opcode) /* SUB */
@@ -17962,16 +15628,9 @@ unsigned long CPUFUNC(op_9118_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_9120_4)(uint32_t opcode) /* SUB */
@@ -17984,16 +15643,9 @@ unsigned long CPUFUNC(op_9120_4)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_9128_4)(uint32_t opcode) /* SUB */
@@ -18005,16 +15657,9 @@ unsigned long CPUFUNC(op_9128_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_9130_4)(uint32_t opcode) /* SUB */
@@ -18027,16 +15672,9 @@ unsigned long CPUFUNC(op_9130_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_9138_4)(uint32_t opcode) /* SUB */
@@ -18047,16 +15685,9 @@ unsigned long CPUFUNC(op_9138_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_9139_4)(uint32_t opcode) /* SUB */
@@ -18067,16 +15698,9 @@ unsigned long CPUFUNC(op_9139_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_9140_4)(uint32_t opcode) /* SUBX */
@@ -18132,16 +15756,9 @@ unsigned long CPUFUNC(op_9150_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_9158_4)(uint32_t opcode) /* SUB */
@@ -18154,16 +15771,9 @@ unsigned long CPUFUNC(op_9158_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_9160_4)(uint32_t opcode) /* SUB */
@@ -18176,16 +15786,9 @@ unsigned long CPUFUNC(op_9160_4)(uint32_t opcode) /* SUB */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_9168_4)(uint32_t opcode) /* SUB */
@@ -18197,16 +15800,9 @@ unsigned long CPUFUNC(op_9168_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_9170_4)(uint32_t opcode) /* SUB */
@@ -18219,16 +15815,9 @@ unsigned long CPUFUNC(op_9170_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_9178_4)(uint32_t opcode) /* SUB */
@@ -18239,16 +15828,9 @@ unsigned long CPUFUNC(op_9178_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_9179_4)(uint32_t opcode) /* SUB */
@@ -18259,16 +15841,9 @@ unsigned long CPUFUNC(op_9179_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_9180_4)(uint32_t opcode) /* SUBX */
@@ -18324,16 +15899,9 @@ unsigned long CPUFUNC(op_9190_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_9198_4)(uint32_t opcode) /* SUB */
@@ -18346,16 +15914,9 @@ unsigned long CPUFUNC(op_9198_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_91a0_4)(uint32_t opcode) /* SUB */
@@ -18368,16 +15929,9 @@ unsigned long CPUFUNC(op_91a0_4)(uint32_t opcode) /* SUB */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 22;
 }
 unsigned long CPUFUNC(op_91a8_4)(uint32_t opcode) /* SUB */
@@ -18389,16 +15943,9 @@ unsigned long CPUFUNC(op_91a8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_91b0_4)(uint32_t opcode) /* SUB */
@@ -18411,16 +15958,9 @@ unsigned long CPUFUNC(op_91b0_4)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 26;
 }
 unsigned long CPUFUNC(op_91b8_4)(uint32_t opcode) /* SUB */
@@ -18431,16 +15971,9 @@ unsigned long CPUFUNC(op_91b8_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_91b9_4)(uint32_t opcode) /* SUB */
@@ -18451,16 +15984,9 @@ unsigned long CPUFUNC(op_91b9_4)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_91c0_4)(uint32_t opcode) /* SUBA */
@@ -18625,14 +16151,8 @@ unsigned long CPUFUNC(op_b000_4)(uint32_t opcode) /* CMP */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_b010_4)(uint32_t opcode) /* CMP */
@@ -18644,14 +16164,8 @@ unsigned long CPUFUNC(op_b010_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_b018_4)(uint32_t opcode) /* CMP */
@@ -18664,14 +16178,8 @@ unsigned long CPUFUNC(op_b018_4)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_b020_4)(uint32_t opcode) /* CMP */
@@ -18684,14 +16192,8 @@ unsigned long CPUFUNC(op_b020_4)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_b028_4)(uint32_t opcode) /* CMP */
@@ -18703,14 +16205,8 @@ unsigned long CPUFUNC(op_b028_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b030_4)(uint32_t opcode) /* CMP */
@@ -18723,14 +16219,8 @@ unsigned long CPUFUNC(op_b030_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b038_4)(uint32_t opcode) /* CMP */
@@ -18741,14 +16231,8 @@ unsigned long CPUFUNC(op_b038_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b039_4)(uint32_t opcode) /* CMP */
@@ -18759,14 +16243,8 @@ unsigned long CPUFUNC(op_b039_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_b03a_4)(uint32_t opcode) /* CMP */
@@ -18778,14 +16256,8 @@ unsigned long CPUFUNC(op_b03a_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b03b_4)(uint32_t opcode) /* CMP */
@@ -18798,14 +16270,8 @@ unsigned long CPUFUNC(op_b03b_4)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 #endif
@@ -18818,14 +16284,8 @@ unsigned long CPUFUNC(op_b03c_4)(uint32_t opcode) /* CMP */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_b040_4)(uint32_t opcode) /* CMP */
@@ -18836,14 +16296,8 @@ unsigned long CPUFUNC(op_b040_4)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_b048_4)(uint32_t opcode) /* CMP */
@@ -18854,14 +16308,8 @@ unsigned long CPUFUNC(op_b048_4)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_b050_4)(uint32_t opcode) /* CMP */
@@ -18873,14 +16321,8 @@ unsigned long CPUFUNC(op_b050_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_b058_4)(uint32_t opcode) /* CMP */
@@ -18893,14 +16335,8 @@ unsigned long CPUFUNC(op_b058_4)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_b060_4)(uint32_t opcode) /* CMP */
@@ -18913,14 +16349,8 @@ unsigned long CPUFUNC(op_b060_4)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_b068_4)(uint32_t opcode) /* CMP */
@@ -18932,14 +16362,8 @@ unsigned long CPUFUNC(op_b068_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b070_4)(uint32_t opcode) /* CMP */
@@ -18952,14 +16376,8 @@ unsigned long CPUFUNC(op_b070_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b078_4)(uint32_t opcode) /* CMP */
@@ -18970,14 +16388,8 @@ unsigned long CPUFUNC(op_b078_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b079_4)(uint32_t opcode) /* CMP */
@@ -18988,14 +16400,8 @@ unsigned long CPUFUNC(op_b079_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_b07a_4)(uint32_t opcode) /* CMP */
@@ -19007,14 +16413,8 @@ unsigned long CPUFUNC(op_b07a_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_b07b_4)(uint32_t opcode) /* CMP */
@@ -19027,14 +16427,8 @@ unsigned long CPUFUNC(op_b07b_4)(uint32_t opcode) /* CMP */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b07c_4)(uint32_t opcode) /* CMP */
@@ -19044,14 +16438,8 @@ unsigned long CPUFUNC(op_b07c_4)(uint32_t opcode) /* CMP */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_b080_4)(uint32_t opcode) /* CMP */
@@ -19062,14 +16450,8 @@ unsigned long CPUFUNC(op_b080_4)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b088_4)(uint32_t opcode) /* CMP */
@@ -19080,14 +16462,8 @@ unsigned long CPUFUNC(op_b088_4)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b090_4)(uint32_t opcode) /* CMP */
@@ -19099,14 +16475,8 @@ unsigned long CPUFUNC(op_b090_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_b098_4)(uint32_t opcode) /* CMP */
@@ -19119,14 +16489,8 @@ unsigned long CPUFUNC(op_b098_4)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_b0a0_4)(uint32_t opcode) /* CMP */
@@ -19139,14 +16503,8 @@ unsigned long CPUFUNC(op_b0a0_4)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 16;
 }
 unsigned long CPUFUNC(op_b0a8_4)(uint32_t opcode) /* CMP */
@@ -19158,14 +16516,8 @@ unsigned long CPUFUNC(op_b0a8_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b0b0_4)(uint32_t opcode) /* CMP */
@@ -19178,14 +16530,8 @@ unsigned long CPUFUNC(op_b0b0_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_b0b8_4)(uint32_t opcode) /* CMP */
@@ -19196,14 +16542,8 @@ unsigned long CPUFUNC(op_b0b8_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b0b9_4)(uint32_t opcode) /* CMP */
@@ -19214,14 +16554,8 @@ unsigned long CPUFUNC(op_b0b9_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_b0ba_4)(uint32_t opcode) /* CMP */
@@ -19233,14 +16567,8 @@ unsigned long CPUFUNC(op_b0ba_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b0bb_4)(uint32_t opcode) /* CMP */
@@ -19253,14 +16581,8 @@ unsigned long CPUFUNC(op_b0bb_4)(uint32_t opcode) /* CMP */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_b0bc_4)(uint32_t opcode) /* CMP */
@@ -19270,14 +16592,8 @@ unsigned long CPUFUNC(op_b0bc_4)(uint32_t opcode) /* CMP */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long CPUFUNC(op_b0c0_4)(uint32_t opcode) /* CMPA */
@@ -19288,14 +16604,8 @@ unsigned long CPUFUNC(op_b0c0_4)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b0c8_4)(uint32_t opcode) /* CMPA */
@@ -19306,14 +16616,8 @@ unsigned long CPUFUNC(op_b0c8_4)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b0d0_4)(uint32_t opcode) /* CMPA */
@@ -19325,14 +16629,8 @@ unsigned long CPUFUNC(op_b0d0_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_b0d8_4)(uint32_t opcode) /* CMPA */
@@ -19345,14 +16643,8 @@ unsigned long CPUFUNC(op_b0d8_4)(uint32_t opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 2;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_b0e0_4)(uint32_t opcode) /* CMPA */
@@ -19365,14 +16657,8 @@ unsigned long CPUFUNC(op_b0e0_4)(uint32_t opcode) /* CMPA */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_b0e8_4)(uint32_t opcode) /* CMPA */
@@ -19384,14 +16670,8 @@ unsigned long CPUFUNC(op_b0e8_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b0f0_4)(uint32_t opcode) /* CMPA */
@@ -19404,14 +16684,8 @@ unsigned long CPUFUNC(op_b0f0_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_b0f8_4)(uint32_t opcode) /* CMPA */
@@ -19422,14 +16696,8 @@ unsigned long CPUFUNC(op_b0f8_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b0f9_4)(uint32_t opcode) /* CMPA */
@@ -19440,14 +16708,8 @@ unsigned long CPUFUNC(op_b0f9_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 18;
 }
 unsigned long CPUFUNC(op_b0fa_4)(uint32_t opcode) /* CMPA */
@@ -19459,14 +16721,8 @@ unsigned long CPUFUNC(op_b0fa_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_b0fb_4)(uint32_t opcode) /* CMPA */
@@ -19479,14 +16735,8 @@ unsigned long CPUFUNC(op_b0fb_4)(uint32_t opcode) /* CMPA */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_b0fc_4)(uint32_t opcode) /* CMPA */
@@ -19496,14 +16746,8 @@ unsigned long CPUFUNC(op_b0fc_4)(uint32_t opcode) /* CMPA */
 {{	int16_t src = get_iword(2);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 10;
 }
 unsigned long CPUFUNC(op_b100_4)(uint32_t opcode) /* EOR */
@@ -19514,9 +16758,7 @@ unsigned long CPUFUNC(op_b100_4)(uint32_t opcode) /* EOR */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -19533,14 +16775,8 @@ unsigned long CPUFUNC(op_b108_4)(uint32_t opcode) /* CMPM */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_b110_4)(uint32_t opcode) /* EOR */
@@ -19552,9 +16788,7 @@ unsigned long CPUFUNC(op_b110_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19569,9 +16803,7 @@ unsigned long CPUFUNC(op_b118_4)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19586,9 +16818,7 @@ unsigned long CPUFUNC(op_b120_4)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -19602,9 +16832,7 @@ unsigned long CPUFUNC(op_b128_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19619,9 +16847,7 @@ unsigned long CPUFUNC(op_b130_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -19634,9 +16860,7 @@ unsigned long CPUFUNC(op_b138_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19649,9 +16873,7 @@ unsigned long CPUFUNC(op_b139_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -19664,9 +16886,7 @@ unsigned long CPUFUNC(op_b140_4)(uint32_t opcode) /* EOR */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -19683,14 +16903,8 @@ unsigned long CPUFUNC(op_b148_4)(uint32_t opcode) /* CMPM */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_b150_4)(uint32_t opcode) /* EOR */
@@ -19702,9 +16916,7 @@ unsigned long CPUFUNC(op_b150_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19719,9 +16931,7 @@ unsigned long CPUFUNC(op_b158_4)(uint32_t opcode) /* EOR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19736,9 +16946,7 @@ unsigned long CPUFUNC(op_b160_4)(uint32_t opcode) /* EOR */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -19752,9 +16960,7 @@ unsigned long CPUFUNC(op_b168_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19769,9 +16975,7 @@ unsigned long CPUFUNC(op_b170_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -19784,9 +16988,7 @@ unsigned long CPUFUNC(op_b178_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19799,9 +17001,7 @@ unsigned long CPUFUNC(op_b179_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -19814,9 +17014,7 @@ unsigned long CPUFUNC(op_b180_4)(uint32_t opcode) /* EOR */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -19833,14 +17031,8 @@ unsigned long CPUFUNC(op_b188_4)(uint32_t opcode) /* CMPM */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_b190_4)(uint32_t opcode) /* EOR */
@@ -19852,9 +17044,7 @@ unsigned long CPUFUNC(op_b190_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -19869,9 +17059,7 @@ unsigned long CPUFUNC(op_b198_4)(uint32_t opcode) /* EOR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -19886,9 +17074,7 @@ unsigned long CPUFUNC(op_b1a0_4)(uint32_t opcode) /* EOR */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -19902,9 +17088,7 @@ unsigned long CPUFUNC(op_b1a8_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -19919,9 +17103,7 @@ unsigned long CPUFUNC(op_b1b0_4)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -19934,9 +17116,7 @@ unsigned long CPUFUNC(op_b1b8_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -19949,9 +17129,7 @@ unsigned long CPUFUNC(op_b1b9_4)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -19964,14 +17142,8 @@ unsigned long CPUFUNC(op_b1c0_4)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b1c8_4)(uint32_t opcode) /* CMPA */
@@ -19982,14 +17154,8 @@ unsigned long CPUFUNC(op_b1c8_4)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long CPUFUNC(op_b1d0_4)(uint32_t opcode) /* CMPA */
@@ -20001,14 +17167,8 @@ unsigned long CPUFUNC(op_b1d0_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_b1d8_4)(uint32_t opcode) /* CMPA */
@@ -20021,14 +17181,8 @@ unsigned long CPUFUNC(op_b1d8_4)(uint32_t opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_b1e0_4)(uint32_t opcode) /* CMPA */
@@ -20041,14 +17195,8 @@ unsigned long CPUFUNC(op_b1e0_4)(uint32_t opcode) /* CMPA */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 16;
 }
 unsigned long CPUFUNC(op_b1e8_4)(uint32_t opcode) /* CMPA */
@@ -20060,14 +17208,8 @@ unsigned long CPUFUNC(op_b1e8_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b1f0_4)(uint32_t opcode) /* CMPA */
@@ -20080,14 +17222,8 @@ unsigned long CPUFUNC(op_b1f0_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_b1f8_4)(uint32_t opcode) /* CMPA */
@@ -20098,14 +17234,8 @@ unsigned long CPUFUNC(op_b1f8_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b1f9_4)(uint32_t opcode) /* CMPA */
@@ -20116,14 +17246,8 @@ unsigned long CPUFUNC(op_b1f9_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_b1fa_4)(uint32_t opcode) /* CMPA */
@@ -20135,14 +17259,8 @@ unsigned long CPUFUNC(op_b1fa_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_b1fb_4)(uint32_t opcode) /* CMPA */
@@ -20155,14 +17273,8 @@ unsigned long CPUFUNC(op_b1fb_4)(uint32_t opcode) /* CMPA */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_b1fc_4)(uint32_t opcode) /* CMPA */
@@ -20172,14 +17284,8 @@ unsigned long CPUFUNC(op_b1fc_4)(uint32_t opcode) /* CMPA */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long CPUFUNC(op_c000_4)(uint32_t opcode) /* AND */
@@ -20190,9 +17296,7 @@ unsigned long CPUFUNC(op_c000_4)(uint32_t opcode) /* AND */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -20206,9 +17310,7 @@ unsigned long CPUFUNC(op_c010_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -20223,9 +17325,7 @@ unsigned long CPUFUNC(op_c018_4)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -20240,9 +17340,7 @@ unsigned long CPUFUNC(op_c020_4)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -20256,9 +17354,7 @@ unsigned long CPUFUNC(op_c028_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20273,9 +17369,7 @@ unsigned long CPUFUNC(op_c030_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -20288,9 +17382,7 @@ unsigned long CPUFUNC(op_c038_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20303,9 +17395,7 @@ unsigned long CPUFUNC(op_c039_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -20319,9 +17409,7 @@ unsigned long CPUFUNC(op_c03a_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20336,9 +17424,7 @@ unsigned long CPUFUNC(op_c03b_4)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -20350,9 +17436,7 @@ unsigned long CPUFUNC(op_c03c_4)(uint32_t opcode) /* AND */
 {{	int8_t src = get_ibyte(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -20365,9 +17449,7 @@ unsigned long CPUFUNC(op_c040_4)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -20381,9 +17463,7 @@ unsigned long CPUFUNC(op_c050_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -20398,9 +17478,7 @@ unsigned long CPUFUNC(op_c058_4)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -20415,9 +17493,7 @@ unsigned long CPUFUNC(op_c060_4)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -20431,9 +17507,7 @@ unsigned long CPUFUNC(op_c068_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20448,9 +17522,7 @@ unsigned long CPUFUNC(op_c070_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -20463,9 +17535,7 @@ unsigned long CPUFUNC(op_c078_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20478,9 +17548,7 @@ unsigned long CPUFUNC(op_c079_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -20494,9 +17562,7 @@ unsigned long CPUFUNC(op_c07a_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -20511,9 +17577,7 @@ unsigned long CPUFUNC(op_c07b_4)(uint32_t opcode) /* AND */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -20525,9 +17589,7 @@ unsigned long CPUFUNC(op_c07c_4)(uint32_t opcode) /* AND */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -20540,9 +17602,7 @@ unsigned long CPUFUNC(op_c080_4)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -20556,9 +17616,7 @@ unsigned long CPUFUNC(op_c090_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -20573,9 +17631,7 @@ unsigned long CPUFUNC(op_c098_4)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -20590,9 +17646,7 @@ unsigned long CPUFUNC(op_c0a0_4)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 16;
@@ -20606,9 +17660,7 @@ unsigned long CPUFUNC(op_c0a8_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -20623,9 +17675,7 @@ unsigned long CPUFUNC(op_c0b0_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -20638,9 +17688,7 @@ unsigned long CPUFUNC(op_c0b8_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -20653,9 +17701,7 @@ unsigned long CPUFUNC(op_c0b9_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 22;
@@ -20669,9 +17715,7 @@ unsigned long CPUFUNC(op_c0ba_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -20686,9 +17730,7 @@ unsigned long CPUFUNC(op_c0bb_4)(uint32_t opcode) /* AND */
 {	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -20700,9 +17742,7 @@ unsigned long CPUFUNC(op_c0bc_4)(uint32_t opcode) /* AND */
 {{	int32_t src = get_ilong(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -20716,9 +17756,7 @@ unsigned long CPUFUNC(op_c0c0_4)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}m68k_incpc(2);
@@ -20734,9 +17772,7 @@ unsigned long CPUFUNC(op_c0d0_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -20753,9 +17789,7 @@ unsigned long CPUFUNC(op_c0d8_4)(uint32_t opcode) /* MULU */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -20772,9 +17806,7 @@ unsigned long CPUFUNC(op_c0e0_4)(uint32_t opcode) /* MULU */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -20790,9 +17822,7 @@ unsigned long CPUFUNC(op_c0e8_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -20809,9 +17839,7 @@ unsigned long CPUFUNC(op_c0f0_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -20826,9 +17854,7 @@ unsigned long CPUFUNC(op_c0f8_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -20843,9 +17869,7 @@ unsigned long CPUFUNC(op_c0f9_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(6);
@@ -20861,9 +17885,7 @@ unsigned long CPUFUNC(op_c0fa_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -20880,9 +17902,7 @@ unsigned long CPUFUNC(op_c0fb_4)(uint32_t opcode) /* MULU */
 {	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -20896,9 +17916,7 @@ unsigned long CPUFUNC(op_c0fc_4)(uint32_t opcode) /* MULU */
 {{	int16_t src = get_iword(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}m68k_incpc(4);
@@ -20963,9 +17981,7 @@ unsigned long CPUFUNC(op_c110_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -20980,9 +17996,7 @@ unsigned long CPUFUNC(op_c118_4)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -20997,9 +18011,7 @@ unsigned long CPUFUNC(op_c120_4)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -21013,9 +18025,7 @@ unsigned long CPUFUNC(op_c128_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -21030,9 +18040,7 @@ unsigned long CPUFUNC(op_c130_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -21045,9 +18053,7 @@ unsigned long CPUFUNC(op_c138_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -21060,9 +18066,7 @@ unsigned long CPUFUNC(op_c139_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_write_memory_8(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -21100,9 +18104,7 @@ unsigned long CPUFUNC(op_c150_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -21117,9 +18119,7 @@ unsigned long CPUFUNC(op_c158_4)(uint32_t opcode) /* AND */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -21134,9 +18134,7 @@ unsigned long CPUFUNC(op_c160_4)(uint32_t opcode) /* AND */
 {	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -21150,9 +18148,7 @@ unsigned long CPUFUNC(op_c168_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -21167,9 +18163,7 @@ unsigned long CPUFUNC(op_c170_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -21182,9 +18176,7 @@ unsigned long CPUFUNC(op_c178_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -21197,9 +18189,7 @@ unsigned long CPUFUNC(op_c179_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(2);
 {	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_write_memory_16(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -21225,9 +18215,7 @@ unsigned long CPUFUNC(op_c190_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -21242,9 +18230,7 @@ unsigned long CPUFUNC(op_c198_4)(uint32_t opcode) /* AND */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -21259,9 +18245,7 @@ unsigned long CPUFUNC(op_c1a0_4)(uint32_t opcode) /* AND */
 {	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -21275,9 +18259,7 @@ unsigned long CPUFUNC(op_c1a8_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -21292,9 +18274,7 @@ unsigned long CPUFUNC(op_c1b0_4)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -21307,9 +18287,7 @@ unsigned long CPUFUNC(op_c1b8_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -21322,9 +18300,7 @@ unsigned long CPUFUNC(op_c1b9_4)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong(2);
 {	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_write_memory_32(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -21339,9 +18315,7 @@ unsigned long CPUFUNC(op_c1c0_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21359,9 +18333,7 @@ unsigned long CPUFUNC(op_c1d0_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21380,9 +18352,7 @@ unsigned long CPUFUNC(op_c1d8_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21401,9 +18371,7 @@ unsigned long CPUFUNC(op_c1e0_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21421,9 +18389,7 @@ unsigned long CPUFUNC(op_c1e8_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21442,9 +18408,7 @@ unsigned long CPUFUNC(op_c1f0_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21461,9 +18425,7 @@ unsigned long CPUFUNC(op_c1f8_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21480,9 +18442,7 @@ unsigned long CPUFUNC(op_c1f9_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21500,9 +18460,7 @@ unsigned long CPUFUNC(op_c1fa_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21521,9 +18479,7 @@ unsigned long CPUFUNC(op_c1fb_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21539,9 +18495,7 @@ unsigned long CPUFUNC(op_c1fc_4)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -21557,16 +18511,9 @@ unsigned long CPUFUNC(op_d000_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_d010_4)(uint32_t opcode) /* ADD */
@@ -21579,16 +18526,9 @@ unsigned long CPUFUNC(op_d010_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d018_4)(uint32_t opcode) /* ADD */
@@ -21602,16 +18542,9 @@ unsigned long CPUFUNC(op_d018_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d020_4)(uint32_t opcode) /* ADD */
@@ -21625,16 +18558,9 @@ unsigned long CPUFUNC(op_d020_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_d028_4)(uint32_t opcode) /* ADD */
@@ -21647,16 +18573,9 @@ unsigned long CPUFUNC(op_d028_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d030_4)(uint32_t opcode) /* ADD */
@@ -21670,16 +18589,9 @@ unsigned long CPUFUNC(op_d030_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_d038_4)(uint32_t opcode) /* ADD */
@@ -21691,16 +18603,9 @@ unsigned long CPUFUNC(op_d038_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d039_4)(uint32_t opcode) /* ADD */
@@ -21712,16 +18617,9 @@ unsigned long CPUFUNC(op_d039_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_d03a_4)(uint32_t opcode) /* ADD */
@@ -21734,16 +18632,9 @@ unsigned long CPUFUNC(op_d03a_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d03b_4)(uint32_t opcode) /* ADD */
@@ -21757,16 +18648,9 @@ unsigned long CPUFUNC(op_d03b_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_d03c_4)(uint32_t opcode) /* ADD */
@@ -21777,16 +18661,9 @@ unsigned long CPUFUNC(op_d03c_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_d040_4)(uint32_t opcode) /* ADD */
@@ -21798,16 +18675,9 @@ unsigned long CPUFUNC(op_d040_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_d048_4)(uint32_t opcode) /* ADD */
@@ -21819,16 +18689,9 @@ unsigned long CPUFUNC(op_d048_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long CPUFUNC(op_d050_4)(uint32_t opcode) /* ADD */
@@ -21841,16 +18704,9 @@ unsigned long CPUFUNC(op_d050_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d058_4)(uint32_t opcode) /* ADD */
@@ -21864,16 +18720,9 @@ unsigned long CPUFUNC(op_d058_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d060_4)(uint32_t opcode) /* ADD */
@@ -21887,16 +18736,9 @@ unsigned long CPUFUNC(op_d060_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long CPUFUNC(op_d068_4)(uint32_t opcode) /* ADD */
@@ -21909,16 +18751,9 @@ unsigned long CPUFUNC(op_d068_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d070_4)(uint32_t opcode) /* ADD */
@@ -21932,16 +18767,9 @@ unsigned long CPUFUNC(op_d070_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_d078_4)(uint32_t opcode) /* ADD */
@@ -21953,16 +18781,9 @@ unsigned long CPUFUNC(op_d078_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d079_4)(uint32_t opcode) /* ADD */
@@ -21974,16 +18795,9 @@ unsigned long CPUFUNC(op_d079_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_d07a_4)(uint32_t opcode) /* ADD */
@@ -21996,16 +18810,9 @@ unsigned long CPUFUNC(op_d07a_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long CPUFUNC(op_d07b_4)(uint32_t opcode) /* ADD */
@@ -22019,16 +18826,9 @@ unsigned long CPUFUNC(op_d07b_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 14;
 }
 unsigned long CPUFUNC(op_d07c_4)(uint32_t opcode) /* ADD */
@@ -22039,16 +18839,9 @@ unsigned long CPUFUNC(op_d07c_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long CPUFUNC(op_d080_4)(uint32_t opcode) /* ADD */
@@ -22060,16 +18853,9 @@ unsigned long CPUFUNC(op_d080_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d088_4)(uint32_t opcode) /* ADD */
@@ -22081,16 +18867,9 @@ unsigned long CPUFUNC(op_d088_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 8;
 }
 unsigned long CPUFUNC(op_d090_4)(uint32_t opcode) /* ADD */
@@ -22103,16 +18882,9 @@ unsigned long CPUFUNC(op_d090_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_d098_4)(uint32_t opcode) /* ADD */
@@ -22126,16 +18898,9 @@ unsigned long CPUFUNC(op_d098_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_d0a0_4)(uint32_t opcode) /* ADD */
@@ -22149,16 +18914,9 @@ unsigned long CPUFUNC(op_d0a0_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 16;
 }
 unsigned long CPUFUNC(op_d0a8_4)(uint32_t opcode) /* ADD */
@@ -22171,16 +18929,9 @@ unsigned long CPUFUNC(op_d0a8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_d0b0_4)(uint32_t opcode) /* ADD */
@@ -22194,16 +18945,9 @@ unsigned long CPUFUNC(op_d0b0_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_d0b8_4)(uint32_t opcode) /* ADD */
@@ -22215,16 +18959,9 @@ unsigned long CPUFUNC(op_d0b8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_d0b9_4)(uint32_t opcode) /* ADD */
@@ -22236,16 +18973,9 @@ unsigned long CPUFUNC(op_d0b9_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 22;
 }
 unsigned long CPUFUNC(op_d0ba_4)(uint32_t opcode) /* ADD */
@@ -22258,16 +18988,9 @@ unsigned long CPUFUNC(op_d0ba_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_d0bb_4)(uint32_t opcode) /* ADD */
@@ -22281,16 +19004,9 @@ unsigned long CPUFUNC(op_d0bb_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 20;
 }
 unsigned long CPUFUNC(op_d0bc_4)(uint32_t opcode) /* ADD */
@@ -22301,16 +19017,9 @@ unsigned long CPUFUNC(op_d0bc_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 16;
 }
 unsigned long CPUFUNC(op_d0c0_4)(uint32_t opcode) /* ADDA */
@@ -22521,16 +19230,9 @@ unsigned long CPUFUNC(op_d110_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_d118_4)(uint32_t opcode) /* ADD */
@@ -22544,16 +19246,9 @@ unsigned long CPUFUNC(op_d118_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_d120_4)(uint32_t opcode) /* ADD */
@@ -22567,16 +19262,9 @@ unsigned long CPUFUNC(op_d120_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_d128_4)(uint32_t opcode) /* ADD */
@@ -22589,16 +19277,9 @@ unsigned long CPUFUNC(op_d128_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_d130_4)(uint32_t opcode) /* ADD */
@@ -22612,16 +19293,9 @@ unsigned long CPUFUNC(op_d130_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_d138_4)(uint32_t opcode) /* ADD */
@@ -22633,16 +19307,9 @@ unsigned long CPUFUNC(op_d138_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_d139_4)(uint32_t opcode) /* ADD */
@@ -22654,16 +19321,9 @@ unsigned long CPUFUNC(op_d139_4)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_d140_4)(uint32_t opcode) /* ADDX */
@@ -22720,16 +19380,9 @@ unsigned long CPUFUNC(op_d150_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_d158_4)(uint32_t opcode) /* ADD */
@@ -22743,16 +19396,9 @@ unsigned long CPUFUNC(op_d158_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 12;
 }
 unsigned long CPUFUNC(op_d160_4)(uint32_t opcode) /* ADD */
@@ -22766,16 +19412,9 @@ unsigned long CPUFUNC(op_d160_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 14;
 }
 unsigned long CPUFUNC(op_d168_4)(uint32_t opcode) /* ADD */
@@ -22788,16 +19427,9 @@ unsigned long CPUFUNC(op_d168_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_d170_4)(uint32_t opcode) /* ADD */
@@ -22811,16 +19443,9 @@ unsigned long CPUFUNC(op_d170_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 18;
 }
 unsigned long CPUFUNC(op_d178_4)(uint32_t opcode) /* ADD */
@@ -22832,16 +19457,9 @@ unsigned long CPUFUNC(op_d178_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 16;
 }
 unsigned long CPUFUNC(op_d179_4)(uint32_t opcode) /* ADD */
@@ -22853,16 +19471,9 @@ unsigned long CPUFUNC(op_d179_4)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 20;
 }
 unsigned long CPUFUNC(op_d180_4)(uint32_t opcode) /* ADDX */
@@ -22919,16 +19530,9 @@ unsigned long CPUFUNC(op_d190_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_d198_4)(uint32_t opcode) /* ADD */
@@ -22942,16 +19546,9 @@ unsigned long CPUFUNC(op_d198_4)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 20;
 }
 unsigned long CPUFUNC(op_d1a0_4)(uint32_t opcode) /* ADD */
@@ -22965,16 +19562,9 @@ unsigned long CPUFUNC(op_d1a0_4)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 22;
 }
 unsigned long CPUFUNC(op_d1a8_4)(uint32_t opcode) /* ADD */
@@ -22987,16 +19577,9 @@ unsigned long CPUFUNC(op_d1a8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_d1b0_4)(uint32_t opcode) /* ADD */
@@ -23010,16 +19593,9 @@ unsigned long CPUFUNC(op_d1b0_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 26;
 }
 unsigned long CPUFUNC(op_d1b8_4)(uint32_t opcode) /* ADD */
@@ -23031,16 +19607,9 @@ unsigned long CPUFUNC(op_d1b8_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 24;
 }
 unsigned long CPUFUNC(op_d1b9_4)(uint32_t opcode) /* ADD */
@@ -23052,16 +19621,9 @@ unsigned long CPUFUNC(op_d1b9_4)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 28;
 }
 unsigned long CPUFUNC(op_d1c0_4)(uint32_t opcode) /* ADDA */
@@ -23936,9 +20498,7 @@ unsigned long CPUFUNC(op_e0d0_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -23956,9 +20516,7 @@ unsigned long CPUFUNC(op_e0d8_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -23976,9 +20534,7 @@ unsigned long CPUFUNC(op_e0e0_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -23995,9 +20551,7 @@ unsigned long CPUFUNC(op_e0e8_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24015,9 +20569,7 @@ unsigned long CPUFUNC(op_e0f0_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24033,9 +20585,7 @@ unsigned long CPUFUNC(op_e0f8_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24051,9 +20601,7 @@ unsigned long CPUFUNC(op_e0f9_4)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24772,9 +21320,7 @@ unsigned long CPUFUNC(op_e1d0_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24794,9 +21340,7 @@ unsigned long CPUFUNC(op_e1d8_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24816,9 +21360,7 @@ unsigned long CPUFUNC(op_e1e0_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24837,9 +21379,7 @@ unsigned long CPUFUNC(op_e1e8_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24859,9 +21399,7 @@ unsigned long CPUFUNC(op_e1f0_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24879,9 +21417,7 @@ unsigned long CPUFUNC(op_e1f8_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24899,9 +21435,7 @@ unsigned long CPUFUNC(op_e1f9_4)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -24919,9 +21453,7 @@ unsigned long CPUFUNC(op_e2d0_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24938,9 +21470,7 @@ unsigned long CPUFUNC(op_e2d8_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24957,9 +21487,7 @@ unsigned long CPUFUNC(op_e2e0_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24975,9 +21503,7 @@ unsigned long CPUFUNC(op_e2e8_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -24994,9 +21520,7 @@ unsigned long CPUFUNC(op_e2f0_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25011,9 +21535,7 @@ unsigned long CPUFUNC(op_e2f8_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25028,9 +21550,7 @@ unsigned long CPUFUNC(op_e2f9_4)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25046,9 +21566,7 @@ unsigned long CPUFUNC(op_e3d0_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25065,9 +21583,7 @@ unsigned long CPUFUNC(op_e3d8_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25084,9 +21600,7 @@ unsigned long CPUFUNC(op_e3e0_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25102,9 +21616,7 @@ unsigned long CPUFUNC(op_e3e8_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25121,9 +21633,7 @@ unsigned long CPUFUNC(op_e3f0_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25138,9 +21648,7 @@ unsigned long CPUFUNC(op_e3f8_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25155,9 +21663,7 @@ unsigned long CPUFUNC(op_e3f9_4)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25174,9 +21680,7 @@ unsigned long CPUFUNC(op_e4d0_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25194,9 +21698,7 @@ unsigned long CPUFUNC(op_e4d8_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25214,9 +21716,7 @@ unsigned long CPUFUNC(op_e4e0_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25233,9 +21733,7 @@ unsigned long CPUFUNC(op_e4e8_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25253,9 +21751,7 @@ unsigned long CPUFUNC(op_e4f0_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25271,9 +21767,7 @@ unsigned long CPUFUNC(op_e4f8_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25289,9 +21783,7 @@ unsigned long CPUFUNC(op_e4f9_4)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25308,9 +21800,7 @@ unsigned long CPUFUNC(op_e5d0_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25328,9 +21818,7 @@ unsigned long CPUFUNC(op_e5d8_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25348,9 +21836,7 @@ unsigned long CPUFUNC(op_e5e0_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25367,9 +21853,7 @@ unsigned long CPUFUNC(op_e5e8_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25387,9 +21871,7 @@ unsigned long CPUFUNC(op_e5f0_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25405,9 +21887,7 @@ unsigned long CPUFUNC(op_e5f8_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25423,9 +21903,7 @@ unsigned long CPUFUNC(op_e5f9_4)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	m68k_write_memory_16(dataa,val);
@@ -25442,9 +21920,7 @@ unsigned long CPUFUNC(op_e6d0_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25461,9 +21937,7 @@ unsigned long CPUFUNC(op_e6d8_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25480,9 +21954,7 @@ unsigned long CPUFUNC(op_e6e0_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25498,9 +21970,7 @@ unsigned long CPUFUNC(op_e6e8_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25517,9 +21987,7 @@ unsigned long CPUFUNC(op_e6f0_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25534,9 +22002,7 @@ unsigned long CPUFUNC(op_e6f8_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25551,9 +22017,7 @@ unsigned long CPUFUNC(op_e6f9_4)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(6);
@@ -25569,9 +22033,7 @@ unsigned long CPUFUNC(op_e7d0_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25588,9 +22050,7 @@ unsigned long CPUFUNC(op_e7d8_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25607,9 +22067,7 @@ unsigned long CPUFUNC(op_e7e0_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(2);
@@ -25625,9 +22083,7 @@ unsigned long CPUFUNC(op_e7e8_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25644,9 +22100,7 @@ unsigned long CPUFUNC(op_e7f0_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25661,9 +22115,7 @@ unsigned long CPUFUNC(op_e7f8_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(4);
@@ -25678,9 +22130,7 @@ unsigned long CPUFUNC(op_e7f9_4)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	m68k_write_memory_16(dataa,val);
 }}}}m68k_incpc(6);
@@ -25708,9 +22158,7 @@ unsigned long CPUFUNC(op_0_5)(uint32_t opcode) /* OR */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -25724,9 +22172,7 @@ unsigned long CPUFUNC(op_10_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25741,9 +22187,7 @@ unsigned long CPUFUNC(op_18_5)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25758,9 +22202,7 @@ unsigned long CPUFUNC(op_20_5)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25774,9 +22216,7 @@ unsigned long CPUFUNC(op_28_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25791,9 +22231,7 @@ unsigned long CPUFUNC(op_30_5)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25806,9 +22244,7 @@ unsigned long CPUFUNC(op_38_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25821,9 +22257,7 @@ unsigned long CPUFUNC(op_39_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -25848,9 +22282,7 @@ unsigned long CPUFUNC(op_40_5)(uint32_t opcode) /* OR */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -25871,9 +22303,7 @@ unsigned long CPUFUNC(op_50_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -25896,9 +22326,7 @@ unsigned long CPUFUNC(op_58_5)(uint32_t opcode) /* OR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -25921,9 +22349,7 @@ unsigned long CPUFUNC(op_60_5)(uint32_t opcode) /* OR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -25945,9 +22371,7 @@ unsigned long CPUFUNC(op_68_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -25970,9 +22394,7 @@ unsigned long CPUFUNC(op_70_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -25993,9 +22415,7 @@ unsigned long CPUFUNC(op_78_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -26016,9 +22436,7 @@ unsigned long CPUFUNC(op_79_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -26045,9 +22463,7 @@ unsigned long CPUFUNC(op_80_5)(uint32_t opcode) /* OR */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -26068,9 +22484,7 @@ unsigned long CPUFUNC(op_90_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26093,9 +22507,7 @@ unsigned long CPUFUNC(op_98_5)(uint32_t opcode) /* OR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26118,9 +22530,7 @@ unsigned long CPUFUNC(op_a0_5)(uint32_t opcode) /* OR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26142,9 +22552,7 @@ unsigned long CPUFUNC(op_a8_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26167,9 +22575,7 @@ unsigned long CPUFUNC(op_b0_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26190,9 +22596,7 @@ unsigned long CPUFUNC(op_b8_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26213,9 +22617,7 @@ unsigned long CPUFUNC(op_b9_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -26924,9 +23326,7 @@ unsigned long CPUFUNC(op_200_5)(uint32_t opcode) /* AND */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -26940,9 +23340,7 @@ unsigned long CPUFUNC(op_210_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -26957,9 +23355,7 @@ unsigned long CPUFUNC(op_218_5)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -26974,9 +23370,7 @@ unsigned long CPUFUNC(op_220_5)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -26990,9 +23384,7 @@ unsigned long CPUFUNC(op_228_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -27007,9 +23399,7 @@ unsigned long CPUFUNC(op_230_5)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -27022,9 +23412,7 @@ unsigned long CPUFUNC(op_238_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -27037,9 +23425,7 @@ unsigned long CPUFUNC(op_239_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -27064,9 +23450,7 @@ unsigned long CPUFUNC(op_240_5)(uint32_t opcode) /* AND */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -27087,9 +23471,7 @@ unsigned long CPUFUNC(op_250_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27112,9 +23494,7 @@ unsigned long CPUFUNC(op_258_5)(uint32_t opcode) /* AND */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27137,9 +23517,7 @@ unsigned long CPUFUNC(op_260_5)(uint32_t opcode) /* AND */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27161,9 +23539,7 @@ unsigned long CPUFUNC(op_268_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27186,9 +23562,7 @@ unsigned long CPUFUNC(op_270_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27209,9 +23583,7 @@ unsigned long CPUFUNC(op_278_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27232,9 +23604,7 @@ unsigned long CPUFUNC(op_279_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -27261,9 +23631,7 @@ unsigned long CPUFUNC(op_280_5)(uint32_t opcode) /* AND */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -27284,9 +23652,7 @@ unsigned long CPUFUNC(op_290_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27309,9 +23675,7 @@ unsigned long CPUFUNC(op_298_5)(uint32_t opcode) /* AND */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27334,9 +23698,7 @@ unsigned long CPUFUNC(op_2a0_5)(uint32_t opcode) /* AND */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27358,9 +23720,7 @@ unsigned long CPUFUNC(op_2a8_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27383,9 +23743,7 @@ unsigned long CPUFUNC(op_2b0_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27406,9 +23764,7 @@ unsigned long CPUFUNC(op_2b8_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27429,9 +23785,7 @@ unsigned long CPUFUNC(op_2b9_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -27445,16 +23799,9 @@ unsigned long CPUFUNC(op_400_5)(uint32_t opcode) /* SUB */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -27466,18 +23813,11 @@ unsigned long CPUFUNC(op_410_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_418_5)(uint32_t opcode) /* SUB */
 {
@@ -27488,18 +23828,11 @@ unsigned long CPUFUNC(op_418_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_420_5)(uint32_t opcode) /* SUB */
 {
@@ -27510,18 +23843,11 @@ unsigned long CPUFUNC(op_420_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_428_5)(uint32_t opcode) /* SUB */
 {
@@ -27531,18 +23857,11 @@ unsigned long CPUFUNC(op_428_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_430_5)(uint32_t opcode) /* SUB */
 {
@@ -27553,18 +23872,11 @@ unsigned long CPUFUNC(op_430_5)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 22;
+}}}}}}return 22;
 }
 unsigned long CPUFUNC(op_438_5)(uint32_t opcode) /* SUB */
 {
@@ -27573,18 +23885,11 @@ unsigned long CPUFUNC(op_438_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_439_5)(uint32_t opcode) /* SUB */
 {
@@ -27593,18 +23898,11 @@ unsigned long CPUFUNC(op_439_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 24;
+}}}}}}return 24;
 }
 unsigned long CPUFUNC(op_440_5)(uint32_t opcode) /* SUB */
 {
@@ -27613,16 +23911,9 @@ unsigned long CPUFUNC(op_440_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -27641,18 +23932,11 @@ unsigned long CPUFUNC(op_450_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1687: ;
+}}}}}}}endlabel1687: ;
 return 16;
 }
 unsigned long CPUFUNC(op_458_5)(uint32_t opcode) /* SUB */
@@ -27671,18 +23955,11 @@ unsigned long CPUFUNC(op_458_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1688: ;
+}}}}}}}endlabel1688: ;
 return 16;
 }
 unsigned long CPUFUNC(op_460_5)(uint32_t opcode) /* SUB */
@@ -27701,18 +23978,11 @@ unsigned long CPUFUNC(op_460_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1689: ;
+}}}}}}}endlabel1689: ;
 return 18;
 }
 unsigned long CPUFUNC(op_468_5)(uint32_t opcode) /* SUB */
@@ -27730,18 +24000,11 @@ unsigned long CPUFUNC(op_468_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1690: ;
+}}}}}}}endlabel1690: ;
 return 20;
 }
 unsigned long CPUFUNC(op_470_5)(uint32_t opcode) /* SUB */
@@ -27760,18 +24023,11 @@ unsigned long CPUFUNC(op_470_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1691: ;
+}}}}}}}endlabel1691: ;
 return 22;
 }
 unsigned long CPUFUNC(op_478_5)(uint32_t opcode) /* SUB */
@@ -27788,18 +24044,11 @@ unsigned long CPUFUNC(op_478_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1692: ;
+}}}}}}}endlabel1692: ;
 return 20;
 }
 unsigned long CPUFUNC(op_479_5)(uint32_t opcode) /* SUB */
@@ -27816,18 +24065,11 @@ unsigned long CPUFUNC(op_479_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1693: ;
+}}}}}}}endlabel1693: ;
 return 24;
 }
 unsigned long CPUFUNC(op_480_5)(uint32_t opcode) /* SUB */
@@ -27837,16 +24079,9 @@ unsigned long CPUFUNC(op_480_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -27865,18 +24100,11 @@ unsigned long CPUFUNC(op_490_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1695: ;
+}}}}}}}endlabel1695: ;
 return 28;
 }
 unsigned long CPUFUNC(op_498_5)(uint32_t opcode) /* SUB */
@@ -27895,18 +24123,11 @@ unsigned long CPUFUNC(op_498_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1696: ;
+}}}}}}}endlabel1696: ;
 return 28;
 }
 unsigned long CPUFUNC(op_4a0_5)(uint32_t opcode) /* SUB */
@@ -27925,18 +24146,11 @@ unsigned long CPUFUNC(op_4a0_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1697: ;
+}}}}}}}endlabel1697: ;
 return 30;
 }
 unsigned long CPUFUNC(op_4a8_5)(uint32_t opcode) /* SUB */
@@ -27954,18 +24168,11 @@ unsigned long CPUFUNC(op_4a8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1698: ;
+}}}}}}}endlabel1698: ;
 return 32;
 }
 unsigned long CPUFUNC(op_4b0_5)(uint32_t opcode) /* SUB */
@@ -27984,18 +24191,11 @@ unsigned long CPUFUNC(op_4b0_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1699: ;
+}}}}}}}endlabel1699: ;
 return 34;
 }
 unsigned long CPUFUNC(op_4b8_5)(uint32_t opcode) /* SUB */
@@ -28012,18 +24212,11 @@ unsigned long CPUFUNC(op_4b8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1700: ;
+}}}}}}}endlabel1700: ;
 return 32;
 }
 unsigned long CPUFUNC(op_4b9_5)(uint32_t opcode) /* SUB */
@@ -28040,18 +24233,11 @@ unsigned long CPUFUNC(op_4b9_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1701: ;
+}}}}}}}endlabel1701: ;
 return 36;
 }
 unsigned long CPUFUNC(op_600_5)(uint32_t opcode) /* ADD */
@@ -28062,16 +24248,9 @@ unsigned long CPUFUNC(op_600_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -28084,18 +24263,11 @@ unsigned long CPUFUNC(op_610_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_618_5)(uint32_t opcode) /* ADD */
 {
@@ -28107,18 +24279,11 @@ unsigned long CPUFUNC(op_618_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_620_5)(uint32_t opcode) /* ADD */
 {
@@ -28130,18 +24295,11 @@ unsigned long CPUFUNC(op_620_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_628_5)(uint32_t opcode) /* ADD */
 {
@@ -28152,18 +24310,11 @@ unsigned long CPUFUNC(op_628_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_630_5)(uint32_t opcode) /* ADD */
 {
@@ -28175,18 +24326,11 @@ unsigned long CPUFUNC(op_630_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 22;
+}}}}}}return 22;
 }
 unsigned long CPUFUNC(op_638_5)(uint32_t opcode) /* ADD */
 {
@@ -28196,18 +24340,11 @@ unsigned long CPUFUNC(op_638_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_639_5)(uint32_t opcode) /* ADD */
 {
@@ -28217,18 +24354,11 @@ unsigned long CPUFUNC(op_639_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 24;
+}}}}}}return 24;
 }
 unsigned long CPUFUNC(op_640_5)(uint32_t opcode) /* ADD */
 {
@@ -28238,16 +24368,9 @@ unsigned long CPUFUNC(op_640_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -28267,18 +24390,11 @@ unsigned long CPUFUNC(op_650_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1711: ;
+}}}}}}}endlabel1711: ;
 return 16;
 }
 unsigned long CPUFUNC(op_658_5)(uint32_t opcode) /* ADD */
@@ -28298,18 +24414,11 @@ unsigned long CPUFUNC(op_658_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1712: ;
+}}}}}}}endlabel1712: ;
 return 16;
 }
 unsigned long CPUFUNC(op_660_5)(uint32_t opcode) /* ADD */
@@ -28329,18 +24438,11 @@ unsigned long CPUFUNC(op_660_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1713: ;
+}}}}}}}endlabel1713: ;
 return 18;
 }
 unsigned long CPUFUNC(op_668_5)(uint32_t opcode) /* ADD */
@@ -28359,18 +24461,11 @@ unsigned long CPUFUNC(op_668_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1714: ;
+}}}}}}}endlabel1714: ;
 return 20;
 }
 unsigned long CPUFUNC(op_670_5)(uint32_t opcode) /* ADD */
@@ -28390,18 +24485,11 @@ unsigned long CPUFUNC(op_670_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1715: ;
+}}}}}}}endlabel1715: ;
 return 22;
 }
 unsigned long CPUFUNC(op_678_5)(uint32_t opcode) /* ADD */
@@ -28419,18 +24507,11 @@ unsigned long CPUFUNC(op_678_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1716: ;
+}}}}}}}endlabel1716: ;
 return 20;
 }
 unsigned long CPUFUNC(op_679_5)(uint32_t opcode) /* ADD */
@@ -28448,18 +24529,11 @@ unsigned long CPUFUNC(op_679_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel1717: ;
+}}}}}}}endlabel1717: ;
 return 24;
 }
 unsigned long CPUFUNC(op_680_5)(uint32_t opcode) /* ADD */
@@ -28470,16 +24544,9 @@ unsigned long CPUFUNC(op_680_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -28499,18 +24566,11 @@ unsigned long CPUFUNC(op_690_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1719: ;
+}}}}}}}endlabel1719: ;
 return 28;
 }
 unsigned long CPUFUNC(op_698_5)(uint32_t opcode) /* ADD */
@@ -28530,18 +24590,11 @@ unsigned long CPUFUNC(op_698_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1720: ;
+}}}}}}}endlabel1720: ;
 return 28;
 }
 unsigned long CPUFUNC(op_6a0_5)(uint32_t opcode) /* ADD */
@@ -28561,18 +24614,11 @@ unsigned long CPUFUNC(op_6a0_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1721: ;
+}}}}}}}endlabel1721: ;
 return 30;
 }
 unsigned long CPUFUNC(op_6a8_5)(uint32_t opcode) /* ADD */
@@ -28591,18 +24637,11 @@ unsigned long CPUFUNC(op_6a8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1722: ;
+}}}}}}}endlabel1722: ;
 return 32;
 }
 unsigned long CPUFUNC(op_6b0_5)(uint32_t opcode) /* ADD */
@@ -28622,18 +24661,11 @@ unsigned long CPUFUNC(op_6b0_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1723: ;
+}}}}}}}endlabel1723: ;
 return 34;
 }
 unsigned long CPUFUNC(op_6b8_5)(uint32_t opcode) /* ADD */
@@ -28651,18 +24683,11 @@ unsigned long CPUFUNC(op_6b8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1724: ;
+}}}}}}}endlabel1724: ;
 return 32;
 }
 unsigned long CPUFUNC(op_6b9_5)(uint32_t opcode) /* ADD */
@@ -28680,18 +24705,11 @@ unsigned long CPUFUNC(op_6b9_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel1725: ;
+}}}}}}}endlabel1725: ;
 return 36;
 }
 unsigned long CPUFUNC(op_800_5)(uint32_t opcode) /* BTST */
@@ -29305,9 +25323,7 @@ unsigned long CPUFUNC(op_a00_5)(uint32_t opcode) /* EOR */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -29321,9 +25337,7 @@ unsigned long CPUFUNC(op_a10_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29338,9 +25352,7 @@ unsigned long CPUFUNC(op_a18_5)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29355,9 +25367,7 @@ unsigned long CPUFUNC(op_a20_5)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29371,9 +25381,7 @@ unsigned long CPUFUNC(op_a28_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29388,9 +25396,7 @@ unsigned long CPUFUNC(op_a30_5)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29403,9 +25409,7 @@ unsigned long CPUFUNC(op_a38_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29418,9 +25422,7 @@ unsigned long CPUFUNC(op_a39_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -29445,9 +25447,7 @@ unsigned long CPUFUNC(op_a40_5)(uint32_t opcode) /* EOR */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -29468,9 +25468,7 @@ unsigned long CPUFUNC(op_a50_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29493,9 +25491,7 @@ unsigned long CPUFUNC(op_a58_5)(uint32_t opcode) /* EOR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29518,9 +25514,7 @@ unsigned long CPUFUNC(op_a60_5)(uint32_t opcode) /* EOR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29542,9 +25536,7 @@ unsigned long CPUFUNC(op_a68_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29567,9 +25559,7 @@ unsigned long CPUFUNC(op_a70_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29590,9 +25580,7 @@ unsigned long CPUFUNC(op_a78_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29613,9 +25601,7 @@ unsigned long CPUFUNC(op_a79_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -29645,9 +25631,7 @@ unsigned long CPUFUNC(op_a80_5)(uint32_t opcode) /* EOR */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -29668,9 +25652,7 @@ unsigned long CPUFUNC(op_a90_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29693,9 +25675,7 @@ unsigned long CPUFUNC(op_a98_5)(uint32_t opcode) /* EOR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29718,9 +25698,7 @@ unsigned long CPUFUNC(op_aa0_5)(uint32_t opcode) /* EOR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29742,9 +25720,7 @@ unsigned long CPUFUNC(op_aa8_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29767,9 +25743,7 @@ unsigned long CPUFUNC(op_ab0_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29790,9 +25764,7 @@ unsigned long CPUFUNC(op_ab8_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29813,9 +25785,7 @@ unsigned long CPUFUNC(op_ab9_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -29829,14 +25799,8 @@ unsigned long CPUFUNC(op_c00_5)(uint32_t opcode) /* CMP */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -29848,14 +25812,8 @@ unsigned long CPUFUNC(op_c10_5)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -29868,14 +25826,8 @@ unsigned long CPUFUNC(op_c18_5)(uint32_t opcode) /* CMP */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -29888,14 +25840,8 @@ unsigned long CPUFUNC(op_c20_5)(uint32_t opcode) /* CMP */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -29907,14 +25853,8 @@ unsigned long CPUFUNC(op_c28_5)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -29927,14 +25867,8 @@ unsigned long CPUFUNC(op_c30_5)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 18;
 }
@@ -29945,14 +25879,8 @@ unsigned long CPUFUNC(op_c38_5)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -29963,14 +25891,8 @@ unsigned long CPUFUNC(op_c39_5)(uint32_t opcode) /* CMP */
 {	uint32_t dsta = get_ilong_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 return 20;
 }
@@ -29983,14 +25905,8 @@ unsigned long CPUFUNC(op_c3a_5)(uint32_t opcode) /* CMP */
 	dsta += (int32_t)(int16_t)get_iword_prefetch(4);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -30004,14 +25920,8 @@ unsigned long CPUFUNC(op_c3b_5)(uint32_t opcode) /* CMP */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 18;
 }
@@ -30022,14 +25932,8 @@ unsigned long CPUFUNC(op_c40_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -30048,14 +25952,8 @@ unsigned long CPUFUNC(op_c50_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel1804: ;
 return 12;
@@ -30076,14 +25974,8 @@ unsigned long CPUFUNC(op_c58_5)(uint32_t opcode) /* CMP */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel1805: ;
 return 12;
@@ -30104,14 +25996,8 @@ unsigned long CPUFUNC(op_c60_5)(uint32_t opcode) /* CMP */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel1806: ;
 return 14;
@@ -30131,14 +26017,8 @@ unsigned long CPUFUNC(op_c68_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1807: ;
 return 16;
@@ -30159,14 +26039,8 @@ unsigned long CPUFUNC(op_c70_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1808: ;
 return 18;
@@ -30185,14 +26059,8 @@ unsigned long CPUFUNC(op_c78_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1809: ;
 return 16;
@@ -30211,14 +26079,8 @@ unsigned long CPUFUNC(op_c79_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1810: ;
 return 20;
@@ -30239,14 +26101,8 @@ unsigned long CPUFUNC(op_c7a_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1811: ;
 return 16;
@@ -30268,14 +26124,8 @@ unsigned long CPUFUNC(op_c7b_5)(uint32_t opcode) /* CMP */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1812: ;
 return 18;
@@ -30287,14 +26137,8 @@ unsigned long CPUFUNC(op_c80_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
 }
@@ -30313,14 +26157,8 @@ unsigned long CPUFUNC(op_c90_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1814: ;
 return 20;
@@ -30341,14 +26179,8 @@ unsigned long CPUFUNC(op_c98_5)(uint32_t opcode) /* CMP */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1815: ;
 return 20;
@@ -30369,14 +26201,8 @@ unsigned long CPUFUNC(op_ca0_5)(uint32_t opcode) /* CMP */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel1816: ;
 return 22;
@@ -30396,14 +26222,8 @@ unsigned long CPUFUNC(op_ca8_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1817: ;
 return 24;
@@ -30424,14 +26244,8 @@ unsigned long CPUFUNC(op_cb0_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1818: ;
 return 26;
@@ -30450,14 +26264,8 @@ unsigned long CPUFUNC(op_cb8_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1819: ;
 return 24;
@@ -30476,14 +26284,8 @@ unsigned long CPUFUNC(op_cb9_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(10);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(10);
 fill_prefetch_0 ();
 endlabel1820: ;
 return 28;
@@ -30504,14 +26306,8 @@ unsigned long CPUFUNC(op_cba_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1821: ;
 return 24;
@@ -30533,14 +26329,8 @@ unsigned long CPUFUNC(op_cbb_5)(uint32_t opcode) /* CMP */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(8);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel1822: ;
 return 26;
@@ -30551,9 +26341,7 @@ unsigned long CPUFUNC(op_1000_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -30565,9 +26353,7 @@ unsigned long CPUFUNC(op_1008_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -30580,9 +26366,7 @@ unsigned long CPUFUNC(op_1010_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -30596,9 +26380,7 @@ unsigned long CPUFUNC(op_1018_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -30612,9 +26394,7 @@ unsigned long CPUFUNC(op_1020_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -30627,9 +26407,7 @@ unsigned long CPUFUNC(op_1028_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30643,9 +26421,7 @@ unsigned long CPUFUNC(op_1030_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30657,9 +26433,7 @@ unsigned long CPUFUNC(op_1038_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30671,9 +26445,7 @@ unsigned long CPUFUNC(op_1039_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -30686,9 +26458,7 @@ unsigned long CPUFUNC(op_103a_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30702,9 +26472,7 @@ unsigned long CPUFUNC(op_103b_5)(uint32_t opcode) /* MOVE */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30715,9 +26483,7 @@ unsigned long CPUFUNC(op_103c_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = get_ibyte_prefetch(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -30730,9 +26496,7 @@ unsigned long CPUFUNC(op_1080_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30745,9 +26509,7 @@ unsigned long CPUFUNC(op_1088_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30761,9 +26523,7 @@ unsigned long CPUFUNC(op_1090_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30778,9 +26538,7 @@ unsigned long CPUFUNC(op_1098_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30795,9 +26553,7 @@ unsigned long CPUFUNC(op_10a0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30811,9 +26567,7 @@ unsigned long CPUFUNC(op_10a8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30828,9 +26582,7 @@ unsigned long CPUFUNC(op_10b0_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30843,9 +26595,7 @@ unsigned long CPUFUNC(op_10b8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30858,9 +26608,7 @@ unsigned long CPUFUNC(op_10b9_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30874,9 +26622,7 @@ unsigned long CPUFUNC(op_10ba_5)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30891,9 +26637,7 @@ unsigned long CPUFUNC(op_10bb_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30905,9 +26649,7 @@ unsigned long CPUFUNC(op_10bc_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -30921,9 +26663,7 @@ unsigned long CPUFUNC(op_10c0_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30937,9 +26677,7 @@ unsigned long CPUFUNC(op_10c8_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30954,9 +26692,7 @@ unsigned long CPUFUNC(op_10d0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30972,9 +26708,7 @@ unsigned long CPUFUNC(op_10d8_5)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -30990,9 +26724,7 @@ unsigned long CPUFUNC(op_10e0_5)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31007,9 +26739,7 @@ unsigned long CPUFUNC(op_10e8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31025,9 +26755,7 @@ unsigned long CPUFUNC(op_10f0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31041,9 +26769,7 @@ unsigned long CPUFUNC(op_10f8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31057,9 +26783,7 @@ unsigned long CPUFUNC(op_10f9_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31074,9 +26798,7 @@ unsigned long CPUFUNC(op_10fa_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31092,9 +26814,7 @@ unsigned long CPUFUNC(op_10fb_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31107,9 +26827,7 @@ unsigned long CPUFUNC(op_10fc_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31123,9 +26841,7 @@ unsigned long CPUFUNC(op_1100_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31139,9 +26855,7 @@ unsigned long CPUFUNC(op_1108_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31156,9 +26870,7 @@ unsigned long CPUFUNC(op_1110_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31174,9 +26886,7 @@ unsigned long CPUFUNC(op_1118_5)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31192,9 +26902,7 @@ unsigned long CPUFUNC(op_1120_5)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -31209,9 +26917,7 @@ unsigned long CPUFUNC(op_1128_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31227,9 +26933,7 @@ unsigned long CPUFUNC(op_1130_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31243,9 +26947,7 @@ unsigned long CPUFUNC(op_1138_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31259,9 +26961,7 @@ unsigned long CPUFUNC(op_1139_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31276,9 +26976,7 @@ unsigned long CPUFUNC(op_113a_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31294,9 +26992,7 @@ unsigned long CPUFUNC(op_113b_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31309,9 +27005,7 @@ unsigned long CPUFUNC(op_113c_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31324,9 +27018,7 @@ unsigned long CPUFUNC(op_1140_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31339,9 +27031,7 @@ unsigned long CPUFUNC(op_1148_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31355,9 +27045,7 @@ unsigned long CPUFUNC(op_1150_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31372,9 +27060,7 @@ unsigned long CPUFUNC(op_1158_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31389,9 +27075,7 @@ unsigned long CPUFUNC(op_1160_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31405,9 +27089,7 @@ unsigned long CPUFUNC(op_1168_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31422,9 +27104,7 @@ unsigned long CPUFUNC(op_1170_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31437,9 +27117,7 @@ unsigned long CPUFUNC(op_1178_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31452,9 +27130,7 @@ unsigned long CPUFUNC(op_1179_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31468,9 +27144,7 @@ unsigned long CPUFUNC(op_117a_5)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31485,9 +27159,7 @@ unsigned long CPUFUNC(op_117b_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31499,9 +27171,7 @@ unsigned long CPUFUNC(op_117c_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31515,9 +27185,7 @@ unsigned long CPUFUNC(op_1180_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31531,9 +27199,7 @@ unsigned long CPUFUNC(op_1188_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31548,9 +27214,7 @@ unsigned long CPUFUNC(op_1190_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31566,9 +27230,7 @@ unsigned long CPUFUNC(op_1198_5)(uint32_t opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31584,9 +27246,7 @@ unsigned long CPUFUNC(op_11a0_5)(uint32_t opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31601,9 +27261,7 @@ unsigned long CPUFUNC(op_11a8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31619,9 +27277,7 @@ unsigned long CPUFUNC(op_11b0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31635,9 +27291,7 @@ unsigned long CPUFUNC(op_11b8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31651,9 +27305,7 @@ unsigned long CPUFUNC(op_11b9_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(6));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31668,9 +27320,7 @@ unsigned long CPUFUNC(op_11ba_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31686,9 +27336,7 @@ unsigned long CPUFUNC(op_11bb_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31701,9 +27349,7 @@ unsigned long CPUFUNC(op_11bc_5)(uint32_t opcode) /* MOVE */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31715,9 +27361,7 @@ unsigned long CPUFUNC(op_11c0_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31729,9 +27373,7 @@ unsigned long CPUFUNC(op_11c8_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31744,9 +27386,7 @@ unsigned long CPUFUNC(op_11d0_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31760,9 +27400,7 @@ unsigned long CPUFUNC(op_11d8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31776,9 +27414,7 @@ unsigned long CPUFUNC(op_11e0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31791,9 +27427,7 @@ unsigned long CPUFUNC(op_11e8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31807,9 +27441,7 @@ unsigned long CPUFUNC(op_11f0_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31821,9 +27453,7 @@ unsigned long CPUFUNC(op_11f8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31835,9 +27465,7 @@ unsigned long CPUFUNC(op_11f9_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31850,9 +27478,7 @@ unsigned long CPUFUNC(op_11fa_5)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31866,9 +27492,7 @@ unsigned long CPUFUNC(op_11fb_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31879,9 +27503,7 @@ unsigned long CPUFUNC(op_11fc_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31893,9 +27515,7 @@ unsigned long CPUFUNC(op_13c0_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dsta = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31907,9 +27527,7 @@ unsigned long CPUFUNC(op_13c8_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 16; 
 {{	int8_t src = m68k_areg(regs, srcreg);
 {	uint32_t dsta = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31922,9 +27540,7 @@ unsigned long CPUFUNC(op_13d0_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31938,9 +27554,7 @@ unsigned long CPUFUNC(op_13d8_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dsta = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31954,9 +27568,7 @@ unsigned long CPUFUNC(op_13e0_5)(uint32_t opcode) /* MOVE */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dsta = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31969,9 +27581,7 @@ unsigned long CPUFUNC(op_13e8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31985,9 +27595,7 @@ unsigned long CPUFUNC(op_13f0_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -31999,9 +27607,7 @@ unsigned long CPUFUNC(op_13f8_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -32013,9 +27619,7 @@ unsigned long CPUFUNC(op_13f9_5)(uint32_t opcode) /* MOVE */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -32028,9 +27632,7 @@ unsigned long CPUFUNC(op_13fa_5)(uint32_t opcode) /* MOVE */
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -32044,9 +27646,7 @@ unsigned long CPUFUNC(op_13fb_5)(uint32_t opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -32057,9 +27657,7 @@ unsigned long CPUFUNC(op_13fc_5)(uint32_t opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 20; 
 {{	int8_t src = get_ibyte_prefetch(2);
 {	uint32_t dsta = get_ilong_prefetch(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -32071,9 +27669,7 @@ unsigned long CPUFUNC(op_2000_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -32085,9 +27681,7 @@ unsigned long CPUFUNC(op_2008_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -32107,9 +27701,7 @@ unsigned long CPUFUNC(op_2010_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1921;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -32131,9 +27723,7 @@ unsigned long CPUFUNC(op_2018_5)(uint32_t opcode) /* MOVE */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -32155,9 +27745,7 @@ unsigned long CPUFUNC(op_2020_5)(uint32_t opcode) /* MOVE */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -32178,9 +27766,7 @@ unsigned long CPUFUNC(op_2028_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1924;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -32202,9 +27788,7 @@ unsigned long CPUFUNC(op_2030_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1925;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -32224,9 +27808,7 @@ unsigned long CPUFUNC(op_2038_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1926;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -32246,9 +27828,7 @@ unsigned long CPUFUNC(op_2039_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1927;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -32269,9 +27849,7 @@ unsigned long CPUFUNC(op_203a_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1928;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -32293,9 +27871,7 @@ unsigned long CPUFUNC(op_203b_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1929;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -32307,9 +27883,7 @@ unsigned long CPUFUNC(op_203c_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	int32_t src = get_ilong_prefetch(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -32555,9 +28129,7 @@ unsigned long CPUFUNC(op_2080_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1943;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32578,9 +28150,7 @@ unsigned long CPUFUNC(op_2088_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1944;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32609,9 +28179,7 @@ unsigned long CPUFUNC(op_2090_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1945;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32641,9 +28209,7 @@ unsigned long CPUFUNC(op_2098_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1946;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32673,9 +28239,7 @@ unsigned long CPUFUNC(op_20a0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1947;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32704,9 +28268,7 @@ unsigned long CPUFUNC(op_20a8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1948;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32736,9 +28298,7 @@ unsigned long CPUFUNC(op_20b0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1949;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32766,9 +28326,7 @@ unsigned long CPUFUNC(op_20b8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1950;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32796,9 +28354,7 @@ unsigned long CPUFUNC(op_20b9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1951;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32827,9 +28383,7 @@ unsigned long CPUFUNC(op_20ba_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1952;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32859,9 +28413,7 @@ unsigned long CPUFUNC(op_20bb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1953;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32881,9 +28433,7 @@ unsigned long CPUFUNC(op_20bc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1954;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -32905,9 +28455,7 @@ unsigned long CPUFUNC(op_20c0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1955;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32929,9 +28477,7 @@ unsigned long CPUFUNC(op_20c8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1956;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32961,9 +28507,7 @@ unsigned long CPUFUNC(op_20d0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1957;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -32994,9 +28538,7 @@ unsigned long CPUFUNC(op_20d8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1958;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33027,9 +28569,7 @@ unsigned long CPUFUNC(op_20e0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1959;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33059,9 +28599,7 @@ unsigned long CPUFUNC(op_20e8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1960;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33092,9 +28630,7 @@ unsigned long CPUFUNC(op_20f0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1961;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33123,9 +28659,7 @@ unsigned long CPUFUNC(op_20f8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1962;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33154,9 +28688,7 @@ unsigned long CPUFUNC(op_20f9_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1963;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33186,9 +28718,7 @@ unsigned long CPUFUNC(op_20fa_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1964;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33219,9 +28749,7 @@ unsigned long CPUFUNC(op_20fb_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1965;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33242,9 +28770,7 @@ unsigned long CPUFUNC(op_20fc_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1966;
 	}
 {	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33266,9 +28792,7 @@ unsigned long CPUFUNC(op_2100_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1967;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33290,9 +28814,7 @@ unsigned long CPUFUNC(op_2108_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1968;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33322,9 +28844,7 @@ unsigned long CPUFUNC(op_2110_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1969;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33355,9 +28875,7 @@ unsigned long CPUFUNC(op_2118_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1970;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33388,9 +28906,7 @@ unsigned long CPUFUNC(op_2120_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1971;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -33420,9 +28936,7 @@ unsigned long CPUFUNC(op_2128_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1972;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33453,9 +28967,7 @@ unsigned long CPUFUNC(op_2130_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1973;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33484,9 +28996,7 @@ unsigned long CPUFUNC(op_2138_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1974;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33518,9 +29028,7 @@ unsigned long CPUFUNC(op_2139_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1975;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33550,9 +29058,7 @@ unsigned long CPUFUNC(op_213a_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1976;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33583,9 +29089,7 @@ unsigned long CPUFUNC(op_213b_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1977;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33606,9 +29110,7 @@ unsigned long CPUFUNC(op_213c_5)(uint32_t opcode) /* MOVE */
 		goto endlabel1978;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33629,9 +29131,7 @@ unsigned long CPUFUNC(op_2140_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1979;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33652,9 +29152,7 @@ unsigned long CPUFUNC(op_2148_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1980;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33683,9 +29181,7 @@ unsigned long CPUFUNC(op_2150_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1981;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33715,9 +29211,7 @@ unsigned long CPUFUNC(op_2158_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1982;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33747,9 +29241,7 @@ unsigned long CPUFUNC(op_2160_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1983;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33778,9 +29270,7 @@ unsigned long CPUFUNC(op_2168_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1984;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33810,9 +29300,7 @@ unsigned long CPUFUNC(op_2170_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1985;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33840,9 +29328,7 @@ unsigned long CPUFUNC(op_2178_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1986;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33870,9 +29356,7 @@ unsigned long CPUFUNC(op_2179_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1987;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33901,9 +29385,7 @@ unsigned long CPUFUNC(op_217a_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1988;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33933,9 +29415,7 @@ unsigned long CPUFUNC(op_217b_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1989;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33955,9 +29435,7 @@ unsigned long CPUFUNC(op_217c_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1990;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -33979,9 +29457,7 @@ unsigned long CPUFUNC(op_2180_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1991;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34003,9 +29479,7 @@ unsigned long CPUFUNC(op_2188_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1992;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34035,9 +29509,7 @@ unsigned long CPUFUNC(op_2190_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1993;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34068,9 +29540,7 @@ unsigned long CPUFUNC(op_2198_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1994;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34101,9 +29571,7 @@ unsigned long CPUFUNC(op_21a0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1995;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34133,9 +29601,7 @@ unsigned long CPUFUNC(op_21a8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1996;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34166,9 +29632,7 @@ unsigned long CPUFUNC(op_21b0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1997;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34197,9 +29661,7 @@ unsigned long CPUFUNC(op_21b8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1998;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34228,9 +29690,7 @@ unsigned long CPUFUNC(op_21b9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel1999;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34260,9 +29720,7 @@ unsigned long CPUFUNC(op_21ba_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2000;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34293,9 +29751,7 @@ unsigned long CPUFUNC(op_21bb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2001;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34316,9 +29772,7 @@ unsigned long CPUFUNC(op_21bc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2002;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34338,9 +29792,7 @@ unsigned long CPUFUNC(op_21c0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2003;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34360,9 +29812,7 @@ unsigned long CPUFUNC(op_21c8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2004;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34390,9 +29840,7 @@ unsigned long CPUFUNC(op_21d0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2005;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34421,9 +29869,7 @@ unsigned long CPUFUNC(op_21d8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2006;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34452,9 +29898,7 @@ unsigned long CPUFUNC(op_21e0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2007;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34482,9 +29926,7 @@ unsigned long CPUFUNC(op_21e8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2008;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34513,9 +29955,7 @@ unsigned long CPUFUNC(op_21f0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2009;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34542,9 +29982,7 @@ unsigned long CPUFUNC(op_21f8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2010;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34571,9 +30009,7 @@ unsigned long CPUFUNC(op_21f9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2011;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34601,9 +30037,7 @@ unsigned long CPUFUNC(op_21fa_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2012;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34632,9 +30066,7 @@ unsigned long CPUFUNC(op_21fb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2013;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34653,9 +30085,7 @@ unsigned long CPUFUNC(op_21fc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2014;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34675,9 +30105,7 @@ unsigned long CPUFUNC(op_23c0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2015;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34697,9 +30125,7 @@ unsigned long CPUFUNC(op_23c8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2016;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34727,9 +30153,7 @@ unsigned long CPUFUNC(op_23d0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2017;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34758,9 +30182,7 @@ unsigned long CPUFUNC(op_23d8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2018;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34789,9 +30211,7 @@ unsigned long CPUFUNC(op_23e0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2019;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34819,9 +30239,7 @@ unsigned long CPUFUNC(op_23e8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2020;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34850,9 +30268,7 @@ unsigned long CPUFUNC(op_23f0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2021;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34879,9 +30295,7 @@ unsigned long CPUFUNC(op_23f8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2022;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34908,9 +30322,7 @@ unsigned long CPUFUNC(op_23f9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2023;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34938,9 +30350,7 @@ unsigned long CPUFUNC(op_23fa_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2024;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34969,9 +30379,7 @@ unsigned long CPUFUNC(op_23fb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2025;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -34990,9 +30398,7 @@ unsigned long CPUFUNC(op_23fc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2026;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -35005,9 +30411,7 @@ unsigned long CPUFUNC(op_3000_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -35019,9 +30423,7 @@ unsigned long CPUFUNC(op_3008_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -35041,9 +30443,7 @@ unsigned long CPUFUNC(op_3010_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2029;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -35065,9 +30465,7 @@ unsigned long CPUFUNC(op_3018_5)(uint32_t opcode) /* MOVE */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -35089,9 +30487,7 @@ unsigned long CPUFUNC(op_3020_5)(uint32_t opcode) /* MOVE */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -35112,9 +30508,7 @@ unsigned long CPUFUNC(op_3028_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2032;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35136,9 +30530,7 @@ unsigned long CPUFUNC(op_3030_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2033;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35158,9 +30550,7 @@ unsigned long CPUFUNC(op_3038_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2034;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35180,9 +30570,7 @@ unsigned long CPUFUNC(op_3039_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2035;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -35203,9 +30591,7 @@ unsigned long CPUFUNC(op_303a_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2036;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35227,9 +30613,7 @@ unsigned long CPUFUNC(op_303b_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2037;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35241,9 +30625,7 @@ unsigned long CPUFUNC(op_303c_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	int16_t src = get_iword_prefetch(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35489,9 +30871,7 @@ unsigned long CPUFUNC(op_3080_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2051;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35512,9 +30892,7 @@ unsigned long CPUFUNC(op_3088_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2052;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35543,9 +30921,7 @@ unsigned long CPUFUNC(op_3090_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2053;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35575,9 +30951,7 @@ unsigned long CPUFUNC(op_3098_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2054;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35607,9 +30981,7 @@ unsigned long CPUFUNC(op_30a0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2055;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35638,9 +31010,7 @@ unsigned long CPUFUNC(op_30a8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2056;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35670,9 +31040,7 @@ unsigned long CPUFUNC(op_30b0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2057;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35700,9 +31068,7 @@ unsigned long CPUFUNC(op_30b8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2058;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35730,9 +31096,7 @@ unsigned long CPUFUNC(op_30b9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2059;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35761,9 +31125,7 @@ unsigned long CPUFUNC(op_30ba_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2060;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35793,9 +31155,7 @@ unsigned long CPUFUNC(op_30bb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2061;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35815,9 +31175,7 @@ unsigned long CPUFUNC(op_30bc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2062;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -35839,9 +31197,7 @@ unsigned long CPUFUNC(op_30c0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2063;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35863,9 +31219,7 @@ unsigned long CPUFUNC(op_30c8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2064;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35895,9 +31249,7 @@ unsigned long CPUFUNC(op_30d0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2065;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35928,9 +31280,7 @@ unsigned long CPUFUNC(op_30d8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2066;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35961,9 +31311,7 @@ unsigned long CPUFUNC(op_30e0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2067;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -35993,9 +31341,7 @@ unsigned long CPUFUNC(op_30e8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2068;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36026,9 +31372,7 @@ unsigned long CPUFUNC(op_30f0_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2069;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36057,9 +31401,7 @@ unsigned long CPUFUNC(op_30f8_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2070;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36088,9 +31430,7 @@ unsigned long CPUFUNC(op_30f9_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2071;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36120,9 +31460,7 @@ unsigned long CPUFUNC(op_30fa_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2072;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36153,9 +31491,7 @@ unsigned long CPUFUNC(op_30fb_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2073;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36176,9 +31512,7 @@ unsigned long CPUFUNC(op_30fc_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2074;
 	}
 {	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36200,9 +31534,7 @@ unsigned long CPUFUNC(op_3100_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2075;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -36224,9 +31556,7 @@ unsigned long CPUFUNC(op_3108_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2076;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -36256,9 +31586,7 @@ unsigned long CPUFUNC(op_3110_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2077;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -36289,9 +31617,7 @@ unsigned long CPUFUNC(op_3118_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2078;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -36322,9 +31648,7 @@ unsigned long CPUFUNC(op_3120_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2079;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -36354,9 +31678,7 @@ unsigned long CPUFUNC(op_3128_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2080;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36387,9 +31709,7 @@ unsigned long CPUFUNC(op_3130_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2081;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36418,9 +31738,7 @@ unsigned long CPUFUNC(op_3138_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2082;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36449,9 +31767,7 @@ unsigned long CPUFUNC(op_3139_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2083;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36481,9 +31797,7 @@ unsigned long CPUFUNC(op_313a_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2084;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36514,9 +31828,7 @@ unsigned long CPUFUNC(op_313b_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2085;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36537,9 +31849,7 @@ unsigned long CPUFUNC(op_313c_5)(uint32_t opcode) /* MOVE */
 		goto endlabel2086;
 	}
 {	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36560,9 +31870,7 @@ unsigned long CPUFUNC(op_3140_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2087;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36583,9 +31891,7 @@ unsigned long CPUFUNC(op_3148_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2088;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36614,9 +31920,7 @@ unsigned long CPUFUNC(op_3150_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2089;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36646,9 +31950,7 @@ unsigned long CPUFUNC(op_3158_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2090;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36678,9 +31980,7 @@ unsigned long CPUFUNC(op_3160_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2091;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36709,9 +32009,7 @@ unsigned long CPUFUNC(op_3168_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2092;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36741,9 +32039,7 @@ unsigned long CPUFUNC(op_3170_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2093;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36771,9 +32067,7 @@ unsigned long CPUFUNC(op_3178_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2094;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36801,9 +32095,7 @@ unsigned long CPUFUNC(op_3179_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2095;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36832,9 +32124,7 @@ unsigned long CPUFUNC(op_317a_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2096;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36864,9 +32154,7 @@ unsigned long CPUFUNC(op_317b_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2097;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36886,9 +32174,7 @@ unsigned long CPUFUNC(op_317c_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2098;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36910,9 +32196,7 @@ unsigned long CPUFUNC(op_3180_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2099;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36934,9 +32218,7 @@ unsigned long CPUFUNC(op_3188_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2100;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36966,9 +32248,7 @@ unsigned long CPUFUNC(op_3190_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2101;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -36999,9 +32279,7 @@ unsigned long CPUFUNC(op_3198_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2102;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37032,9 +32310,7 @@ unsigned long CPUFUNC(op_31a0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2103;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37064,9 +32340,7 @@ unsigned long CPUFUNC(op_31a8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2104;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37097,9 +32371,7 @@ unsigned long CPUFUNC(op_31b0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2105;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37128,9 +32400,7 @@ unsigned long CPUFUNC(op_31b8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2106;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37159,9 +32429,7 @@ unsigned long CPUFUNC(op_31b9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2107;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37191,9 +32459,7 @@ unsigned long CPUFUNC(op_31ba_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2108;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37224,9 +32490,7 @@ unsigned long CPUFUNC(op_31bb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2109;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37247,9 +32511,7 @@ unsigned long CPUFUNC(op_31bc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2110;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37269,9 +32531,7 @@ unsigned long CPUFUNC(op_31c0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2111;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37291,9 +32551,7 @@ unsigned long CPUFUNC(op_31c8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2112;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37321,9 +32579,7 @@ unsigned long CPUFUNC(op_31d0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2113;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37352,9 +32608,7 @@ unsigned long CPUFUNC(op_31d8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2114;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37383,9 +32637,7 @@ unsigned long CPUFUNC(op_31e0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2115;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37413,9 +32665,7 @@ unsigned long CPUFUNC(op_31e8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2116;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37444,9 +32694,7 @@ unsigned long CPUFUNC(op_31f0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2117;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37473,9 +32721,7 @@ unsigned long CPUFUNC(op_31f8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2118;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37502,9 +32748,7 @@ unsigned long CPUFUNC(op_31f9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2119;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37532,9 +32776,7 @@ unsigned long CPUFUNC(op_31fa_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2120;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37563,9 +32805,7 @@ unsigned long CPUFUNC(op_31fb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2121;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37584,9 +32824,7 @@ unsigned long CPUFUNC(op_31fc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2122;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37606,9 +32844,7 @@ unsigned long CPUFUNC(op_33c0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2123;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37628,9 +32864,7 @@ unsigned long CPUFUNC(op_33c8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2124;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37658,9 +32892,7 @@ unsigned long CPUFUNC(op_33d0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2125;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37689,9 +32921,7 @@ unsigned long CPUFUNC(op_33d8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2126;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37720,9 +32950,7 @@ unsigned long CPUFUNC(op_33e0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2127;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37750,9 +32978,7 @@ unsigned long CPUFUNC(op_33e8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2128;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37781,9 +33007,7 @@ unsigned long CPUFUNC(op_33f0_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2129;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37810,9 +33034,7 @@ unsigned long CPUFUNC(op_33f8_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2130;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37839,9 +33061,7 @@ unsigned long CPUFUNC(op_33f9_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2131;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37869,9 +33089,7 @@ unsigned long CPUFUNC(op_33fa_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2132;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37900,9 +33118,7 @@ unsigned long CPUFUNC(op_33fb_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2133;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -37921,9 +33137,7 @@ unsigned long CPUFUNC(op_33fc_5)(uint32_t opcode) /* MOVE */
 		Exception(3, 0, M68000_EXC_SRC_CPU);
 		goto endlabel2134;
 	}
-{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -38985,9 +34199,7 @@ unsigned long CPUFUNC(op_4200_5)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_BYTE, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -38999,9 +34211,7 @@ unsigned long CPUFUNC(op_4210_5)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,0);
@@ -39014,9 +34224,7 @@ unsigned long CPUFUNC(op_4218_5)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,0);
@@ -39029,9 +34237,7 @@ unsigned long CPUFUNC(op_4220_5)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,0);
@@ -39043,9 +34249,7 @@ unsigned long CPUFUNC(op_4228_5)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,0);
@@ -39058,9 +34262,7 @@ unsigned long CPUFUNC(op_4230_5)(uint32_t opcode) /* CLR */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,0);
@@ -39071,9 +34273,7 @@ unsigned long CPUFUNC(op_4238_5)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 16; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,0);
@@ -39084,9 +34284,7 @@ unsigned long CPUFUNC(op_4239_5)(uint32_t opcode) /* CLR */
 	OpcodeFamily = 18; CurrentInstrCycles = 20; 
 {{	uint32_t srca = get_ilong_prefetch(2);
 	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(0)) == 0);
-	SET_NFLG (((int8_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,0);
@@ -39096,9 +34294,7 @@ unsigned long CPUFUNC(op_4240_5)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_WORD, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -39117,9 +34313,7 @@ unsigned long CPUFUNC(op_4250_5)(uint32_t opcode) /* CLR */
 		goto endlabel2194;
 	}
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,0);
@@ -39140,9 +34334,7 @@ unsigned long CPUFUNC(op_4258_5)(uint32_t opcode) /* CLR */
 	}
 {	m68k_areg(regs, srcreg) += 2;
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,0);
@@ -39163,9 +34355,7 @@ unsigned long CPUFUNC(op_4260_5)(uint32_t opcode) /* CLR */
 	}
 {	m68k_areg (regs, srcreg) = srca;
 	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,0);
@@ -39185,9 +34375,7 @@ unsigned long CPUFUNC(op_4268_5)(uint32_t opcode) /* CLR */
 		goto endlabel2197;
 	}
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,0);
@@ -39211,9 +34399,7 @@ unsigned long CPUFUNC(op_4270_5)(uint32_t opcode) /* CLR */
 		goto endlabel2198;
 	}
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,0);
@@ -39232,9 +34418,7 @@ unsigned long CPUFUNC(op_4278_5)(uint32_t opcode) /* CLR */
 		goto endlabel2199;
 	}
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,0);
@@ -39253,9 +34437,7 @@ unsigned long CPUFUNC(op_4279_5)(uint32_t opcode) /* CLR */
 		goto endlabel2200;
 	}
 {	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(0)) == 0);
-	SET_NFLG (((int16_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,0);
@@ -39266,9 +34448,7 @@ unsigned long CPUFUNC(op_4280_5)(uint32_t opcode) /* CLR */
 {
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
-{{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+{{	CC_RECORD_LOGICAL (CC_LONG, 0);
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -39287,9 +34467,7 @@ unsigned long CPUFUNC(op_4290_5)(uint32_t opcode) /* CLR */
 		goto endlabel2202;
 	}
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,0);
@@ -39310,9 +34488,7 @@ unsigned long CPUFUNC(op_4298_5)(uint32_t opcode) /* CLR */
 	}
 {	m68k_areg(regs, srcreg) += 4;
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,0);
@@ -39333,9 +34509,7 @@ unsigned long CPUFUNC(op_42a0_5)(uint32_t opcode) /* CLR */
 	}
 {	m68k_areg (regs, srcreg) = srca;
 	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,0);
@@ -39355,9 +34529,7 @@ unsigned long CPUFUNC(op_42a8_5)(uint32_t opcode) /* CLR */
 		goto endlabel2205;
 	}
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,0);
@@ -39378,9 +34550,7 @@ unsigned long CPUFUNC(op_42b0_5)(uint32_t opcode) /* CLR */
 		goto endlabel2206;
 	}
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,0);
@@ -39399,9 +34569,7 @@ unsigned long CPUFUNC(op_42b8_5)(uint32_t opcode) /* CLR */
 		goto endlabel2207;
 	}
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,0);
@@ -39420,9 +34588,7 @@ unsigned long CPUFUNC(op_42b9_5)(uint32_t opcode) /* CLR */
 		goto endlabel2208;
 	}
 {	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(0)) == 0);
-	SET_NFLG (((int32_t)(0)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,0);
@@ -39435,16 +34601,9 @@ unsigned long CPUFUNC(op_4400_5)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -39455,18 +34614,11 @@ unsigned long CPUFUNC(op_4410_5)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 12;
+}}}}}return 12;
 }
 unsigned long CPUFUNC(op_4418_5)(uint32_t opcode) /* NEG */
 {
@@ -39476,18 +34628,11 @@ unsigned long CPUFUNC(op_4418_5)(uint32_t opcode) /* NEG */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 12;
+}}}}}return 12;
 }
 unsigned long CPUFUNC(op_4420_5)(uint32_t opcode) /* NEG */
 {
@@ -39497,18 +34642,11 @@ unsigned long CPUFUNC(op_4420_5)(uint32_t opcode) /* NEG */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 14;
+}}}}}return 14;
 }
 unsigned long CPUFUNC(op_4428_5)(uint32_t opcode) /* NEG */
 {
@@ -39517,18 +34655,11 @@ unsigned long CPUFUNC(op_4428_5)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 16;
+}}}}}return 16;
 }
 unsigned long CPUFUNC(op_4430_5)(uint32_t opcode) /* NEG */
 {
@@ -39538,18 +34669,11 @@ unsigned long CPUFUNC(op_4430_5)(uint32_t opcode) /* NEG */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 18;
+}}}}}return 18;
 }
 unsigned long CPUFUNC(op_4438_5)(uint32_t opcode) /* NEG */
 {
@@ -39557,18 +34681,11 @@ unsigned long CPUFUNC(op_4438_5)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 16;
+}}}}}return 16;
 }
 unsigned long CPUFUNC(op_4439_5)(uint32_t opcode) /* NEG */
 {
@@ -39576,18 +34693,11 @@ unsigned long CPUFUNC(op_4439_5)(uint32_t opcode) /* NEG */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {{uint32_t dst = ((int8_t)(0)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(0)) < 0;
-	int flgn = ((int8_t)(dst)) < 0;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, 0, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
-}}}}}}return 20;
+}}}}}return 20;
 }
 unsigned long CPUFUNC(op_4440_5)(uint32_t opcode) /* NEG */
 {
@@ -39595,16 +34705,9 @@ unsigned long CPUFUNC(op_4440_5)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -39622,18 +34725,11 @@ unsigned long CPUFUNC(op_4450_5)(uint32_t opcode) /* NEG */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2218: ;
+}}}}}}endlabel2218: ;
 return 12;
 }
 unsigned long CPUFUNC(op_4458_5)(uint32_t opcode) /* NEG */
@@ -39651,18 +34747,11 @@ unsigned long CPUFUNC(op_4458_5)(uint32_t opcode) /* NEG */
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2219: ;
+}}}}}}endlabel2219: ;
 return 12;
 }
 unsigned long CPUFUNC(op_4460_5)(uint32_t opcode) /* NEG */
@@ -39680,18 +34769,11 @@ unsigned long CPUFUNC(op_4460_5)(uint32_t opcode) /* NEG */
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2220: ;
+}}}}}}endlabel2220: ;
 return 14;
 }
 unsigned long CPUFUNC(op_4468_5)(uint32_t opcode) /* NEG */
@@ -39708,18 +34790,11 @@ unsigned long CPUFUNC(op_4468_5)(uint32_t opcode) /* NEG */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2221: ;
+}}}}}}endlabel2221: ;
 return 16;
 }
 unsigned long CPUFUNC(op_4470_5)(uint32_t opcode) /* NEG */
@@ -39737,18 +34812,11 @@ unsigned long CPUFUNC(op_4470_5)(uint32_t opcode) /* NEG */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2222: ;
+}}}}}}endlabel2222: ;
 return 18;
 }
 unsigned long CPUFUNC(op_4478_5)(uint32_t opcode) /* NEG */
@@ -39764,18 +34832,11 @@ unsigned long CPUFUNC(op_4478_5)(uint32_t opcode) /* NEG */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2223: ;
+}}}}}}endlabel2223: ;
 return 16;
 }
 unsigned long CPUFUNC(op_4479_5)(uint32_t opcode) /* NEG */
@@ -39791,18 +34852,11 @@ unsigned long CPUFUNC(op_4479_5)(uint32_t opcode) /* NEG */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {{uint32_t dst = ((int16_t)(0)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(0)) < 0;
-	int flgn = ((int16_t)(dst)) < 0;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, 0, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
-}}}}}}}endlabel2224: ;
+}}}}}}endlabel2224: ;
 return 20;
 }
 unsigned long CPUFUNC(op_4480_5)(uint32_t opcode) /* NEG */
@@ -39811,16 +34865,9 @@ unsigned long CPUFUNC(op_4480_5)(uint32_t opcode) /* NEG */
 	OpcodeFamily = 15; CurrentInstrCycles = 6;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -39838,18 +34885,11 @@ unsigned long CPUFUNC(op_4490_5)(uint32_t opcode) /* NEG */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2226: ;
+}}}}}}endlabel2226: ;
 return 20;
 }
 unsigned long CPUFUNC(op_4498_5)(uint32_t opcode) /* NEG */
@@ -39867,18 +34907,11 @@ unsigned long CPUFUNC(op_4498_5)(uint32_t opcode) /* NEG */
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2227: ;
+}}}}}}endlabel2227: ;
 return 20;
 }
 unsigned long CPUFUNC(op_44a0_5)(uint32_t opcode) /* NEG */
@@ -39896,18 +34929,11 @@ unsigned long CPUFUNC(op_44a0_5)(uint32_t opcode) /* NEG */
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2228: ;
+}}}}}}endlabel2228: ;
 return 22;
 }
 unsigned long CPUFUNC(op_44a8_5)(uint32_t opcode) /* NEG */
@@ -39924,18 +34950,11 @@ unsigned long CPUFUNC(op_44a8_5)(uint32_t opcode) /* NEG */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2229: ;
+}}}}}}endlabel2229: ;
 return 24;
 }
 unsigned long CPUFUNC(op_44b0_5)(uint32_t opcode) /* NEG */
@@ -39953,18 +34972,11 @@ unsigned long CPUFUNC(op_44b0_5)(uint32_t opcode) /* NEG */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2230: ;
+}}}}}}endlabel2230: ;
 return 26;
 }
 unsigned long CPUFUNC(op_44b8_5)(uint32_t opcode) /* NEG */
@@ -39980,18 +34992,11 @@ unsigned long CPUFUNC(op_44b8_5)(uint32_t opcode) /* NEG */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2231: ;
+}}}}}}endlabel2231: ;
 return 24;
 }
 unsigned long CPUFUNC(op_44b9_5)(uint32_t opcode) /* NEG */
@@ -40007,18 +35012,11 @@ unsigned long CPUFUNC(op_44b9_5)(uint32_t opcode) /* NEG */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {{uint32_t dst = ((int32_t)(0)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(0)) < 0;
-	int flgn = ((int32_t)(dst)) < 0;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, 0, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
-}}}}}}}endlabel2232: ;
+}}}}}}endlabel2232: ;
 return 28;
 }
 unsigned long CPUFUNC(op_44c0_5)(uint32_t opcode) /* MV2SR */
@@ -40252,9 +35250,7 @@ unsigned long CPUFUNC(op_4600_5)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40267,9 +35263,7 @@ unsigned long CPUFUNC(op_4610_5)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
@@ -40283,9 +35277,7 @@ unsigned long CPUFUNC(op_4618_5)(uint32_t opcode) /* NOT */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
@@ -40299,9 +35291,7 @@ unsigned long CPUFUNC(op_4620_5)(uint32_t opcode) /* NOT */
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(srca,dst);
@@ -40314,9 +35304,7 @@ unsigned long CPUFUNC(op_4628_5)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
@@ -40330,9 +35318,7 @@ unsigned long CPUFUNC(op_4630_5)(uint32_t opcode) /* NOT */
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
@@ -40344,9 +35330,7 @@ unsigned long CPUFUNC(op_4638_5)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
@@ -40358,9 +35342,7 @@ unsigned long CPUFUNC(op_4639_5)(uint32_t opcode) /* NOT */
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(dst)) == 0);
-	SET_NFLG (((int8_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(srca,dst);
@@ -40372,9 +35354,7 @@ unsigned long CPUFUNC(op_4640_5)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40394,9 +35374,7 @@ unsigned long CPUFUNC(op_4650_5)(uint32_t opcode) /* NOT */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
@@ -40418,9 +35396,7 @@ unsigned long CPUFUNC(op_4658_5)(uint32_t opcode) /* NOT */
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
@@ -40442,9 +35418,7 @@ unsigned long CPUFUNC(op_4660_5)(uint32_t opcode) /* NOT */
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(srca,dst);
@@ -40465,9 +35439,7 @@ unsigned long CPUFUNC(op_4668_5)(uint32_t opcode) /* NOT */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
@@ -40489,9 +35461,7 @@ unsigned long CPUFUNC(op_4670_5)(uint32_t opcode) /* NOT */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
@@ -40511,9 +35481,7 @@ unsigned long CPUFUNC(op_4678_5)(uint32_t opcode) /* NOT */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
@@ -40533,9 +35501,7 @@ unsigned long CPUFUNC(op_4679_5)(uint32_t opcode) /* NOT */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(srca,dst);
@@ -40548,9 +35514,7 @@ unsigned long CPUFUNC(op_4680_5)(uint32_t opcode) /* NOT */
 	OpcodeFamily = 19; CurrentInstrCycles = 6;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40570,9 +35534,7 @@ unsigned long CPUFUNC(op_4690_5)(uint32_t opcode) /* NOT */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
@@ -40594,9 +35556,7 @@ unsigned long CPUFUNC(op_4698_5)(uint32_t opcode) /* NOT */
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
@@ -40618,9 +35578,7 @@ unsigned long CPUFUNC(op_46a0_5)(uint32_t opcode) /* NOT */
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(srca,dst);
@@ -40641,9 +35599,7 @@ unsigned long CPUFUNC(op_46a8_5)(uint32_t opcode) /* NOT */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
@@ -40665,9 +35621,7 @@ unsigned long CPUFUNC(op_46b0_5)(uint32_t opcode) /* NOT */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
@@ -40687,9 +35641,7 @@ unsigned long CPUFUNC(op_46b8_5)(uint32_t opcode) /* NOT */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
@@ -40709,9 +35661,7 @@ unsigned long CPUFUNC(op_46b9_5)(uint32_t opcode) /* NOT */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 {	uint32_t dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(srca,dst);
@@ -41116,9 +36066,7 @@ unsigned long CPUFUNC(op_4840_5)(uint32_t opcode) /* SWAP */
 	OpcodeFamily = 34; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41270,9 +36218,7 @@ unsigned long CPUFUNC(op_4880_5)(uint32_t opcode) /* EXT */
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint16_t dst = (int16_t)(int8_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(dst)) == 0);
-	SET_NFLG (((int16_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41422,9 +36368,7 @@ unsigned long CPUFUNC(op_48c0_5)(uint32_t opcode) /* EXT */
 	OpcodeFamily = 36; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	uint32_t dst = (int32_t)(int16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(dst)) == 0);
-	SET_NFLG (((int32_t)(dst)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41573,9 +36517,7 @@ unsigned long CPUFUNC(op_4a00_5)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -41586,9 +36528,7 @@ unsigned long CPUFUNC(op_4a10_5)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -41600,9 +36540,7 @@ unsigned long CPUFUNC(op_4a18_5)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -41614,9 +36552,7 @@ unsigned long CPUFUNC(op_4a20_5)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
@@ -41627,9 +36563,7 @@ unsigned long CPUFUNC(op_4a28_5)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -41641,9 +36575,7 @@ unsigned long CPUFUNC(op_4a30_5)(uint32_t opcode) /* TST */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -41653,9 +36585,7 @@ unsigned long CPUFUNC(op_4a38_5)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -41665,9 +36595,7 @@ unsigned long CPUFUNC(op_4a39_5)(uint32_t opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 16; 
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -41678,9 +36606,7 @@ unsigned long CPUFUNC(op_4a3a_5)(uint32_t opcode) /* TST */
 {{	uint32_t srca = m68k_getpc () + 2;
 	srca += (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -41692,9 +36618,7 @@ unsigned long CPUFUNC(op_4a3b_5)(uint32_t opcode) /* TST */
 	uint32_t srca = get_disp_ea_000(tmppc, get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -41703,9 +36627,7 @@ unsigned long CPUFUNC(op_4a3c_5)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	int8_t src = get_ibyte_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 }}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -41715,9 +36637,7 @@ unsigned long CPUFUNC(op_4a40_5)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -41727,9 +36647,7 @@ unsigned long CPUFUNC(op_4a48_5)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int16_t src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -41747,9 +36665,7 @@ unsigned long CPUFUNC(op_4a50_5)(uint32_t opcode) /* TST */
 		goto endlabel2322;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2322: ;
@@ -41769,9 +36685,7 @@ unsigned long CPUFUNC(op_4a58_5)(uint32_t opcode) /* TST */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2323: ;
@@ -41791,9 +36705,7 @@ unsigned long CPUFUNC(op_4a60_5)(uint32_t opcode) /* TST */
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2324: ;
@@ -41812,9 +36724,7 @@ unsigned long CPUFUNC(op_4a68_5)(uint32_t opcode) /* TST */
 		goto endlabel2325;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2325: ;
@@ -41834,9 +36744,7 @@ unsigned long CPUFUNC(op_4a70_5)(uint32_t opcode) /* TST */
 		goto endlabel2326;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2326: ;
@@ -41854,9 +36762,7 @@ unsigned long CPUFUNC(op_4a78_5)(uint32_t opcode) /* TST */
 		goto endlabel2327;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2327: ;
@@ -41874,9 +36780,7 @@ unsigned long CPUFUNC(op_4a79_5)(uint32_t opcode) /* TST */
 		goto endlabel2328;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2328: ;
@@ -41895,9 +36799,7 @@ unsigned long CPUFUNC(op_4a7a_5)(uint32_t opcode) /* TST */
 		goto endlabel2329;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2329: ;
@@ -41917,9 +36819,7 @@ unsigned long CPUFUNC(op_4a7b_5)(uint32_t opcode) /* TST */
 		goto endlabel2330;
 	}
 {{	int16_t src = m68k_read_memory_16(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2330: ;
@@ -41929,9 +36829,7 @@ unsigned long CPUFUNC(op_4a7c_5)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	int16_t src = get_iword_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 }}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -41941,9 +36839,7 @@ unsigned long CPUFUNC(op_4a80_5)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -41953,9 +36849,7 @@ unsigned long CPUFUNC(op_4a88_5)(uint32_t opcode) /* TST */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	int32_t src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -41973,9 +36867,7 @@ unsigned long CPUFUNC(op_4a90_5)(uint32_t opcode) /* TST */
 		goto endlabel2334;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2334: ;
@@ -41995,9 +36887,7 @@ unsigned long CPUFUNC(op_4a98_5)(uint32_t opcode) /* TST */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2335: ;
@@ -42017,9 +36907,7 @@ unsigned long CPUFUNC(op_4aa0_5)(uint32_t opcode) /* TST */
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2336: ;
@@ -42038,9 +36926,7 @@ unsigned long CPUFUNC(op_4aa8_5)(uint32_t opcode) /* TST */
 		goto endlabel2337;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2337: ;
@@ -42060,9 +36946,7 @@ unsigned long CPUFUNC(op_4ab0_5)(uint32_t opcode) /* TST */
 		goto endlabel2338;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2338: ;
@@ -42080,9 +36964,7 @@ unsigned long CPUFUNC(op_4ab8_5)(uint32_t opcode) /* TST */
 		goto endlabel2339;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2339: ;
@@ -42100,9 +36982,7 @@ unsigned long CPUFUNC(op_4ab9_5)(uint32_t opcode) /* TST */
 		goto endlabel2340;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2340: ;
@@ -42121,9 +37001,7 @@ unsigned long CPUFUNC(op_4aba_5)(uint32_t opcode) /* TST */
 		goto endlabel2341;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2341: ;
@@ -42143,9 +37021,7 @@ unsigned long CPUFUNC(op_4abb_5)(uint32_t opcode) /* TST */
 		goto endlabel2342;
 	}
 {{	int32_t src = m68k_read_memory_32(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2342: ;
@@ -42155,9 +37031,7 @@ unsigned long CPUFUNC(op_4abc_5)(uint32_t opcode) /* TST */
 {
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	int32_t src = get_ilong_prefetch(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 }}m68k_incpc(6);
 fill_prefetch_0 ();
 return 12;
@@ -42167,9 +37041,7 @@ unsigned long CPUFUNC(op_4ac0_5)(uint32_t opcode) /* TAS */
 	uint32_t srcreg = (opcode & 7);
 	OpcodeFamily = 98; CurrentInstrCycles = 4;  
 {{	int8_t src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -42182,9 +37054,7 @@ unsigned long CPUFUNC(op_4ad0_5)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 14; 
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -42198,9 +37068,7 @@ unsigned long CPUFUNC(op_4ad8_5)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = m68k_areg(regs, srcreg);
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -42214,9 +37082,7 @@ unsigned long CPUFUNC(op_4ae0_5)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	int8_t src = m68k_read_memory_8(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -42229,9 +37095,7 @@ unsigned long CPUFUNC(op_4ae8_5)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 18; 
 {{	uint32_t srca = m68k_areg(regs, srcreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -42245,9 +37109,7 @@ unsigned long CPUFUNC(op_4af0_5)(uint32_t opcode) /* TAS */
 {{	uint32_t srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -42259,9 +37121,7 @@ unsigned long CPUFUNC(op_4af8_5)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 18; 
 {{	uint32_t srca = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -42273,9 +37133,7 @@ unsigned long CPUFUNC(op_4af9_5)(uint32_t opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 22; 
 {{	uint32_t srca = get_ilong_prefetch(2);
 {	int8_t src = m68k_read_memory_8(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	src |= 0x80;
 m68k_incpc(6);
 fill_prefetch_0 ();
@@ -43088,16 +37946,9 @@ unsigned long CPUFUNC(op_5000_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -43111,18 +37962,11 @@ unsigned long CPUFUNC(op_5010_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_5018_5)(uint32_t opcode) /* ADD */
 {
@@ -43135,18 +37979,11 @@ unsigned long CPUFUNC(op_5018_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 #endif
 
@@ -43162,18 +37999,11 @@ unsigned long CPUFUNC(op_5020_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 14;
+}}}}}}return 14;
 }
 unsigned long CPUFUNC(op_5028_5)(uint32_t opcode) /* ADD */
 {
@@ -43185,18 +38015,11 @@ unsigned long CPUFUNC(op_5028_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_5030_5)(uint32_t opcode) /* ADD */
 {
@@ -43209,18 +38032,11 @@ unsigned long CPUFUNC(op_5030_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_5038_5)(uint32_t opcode) /* ADD */
 {
@@ -43231,18 +38047,11 @@ unsigned long CPUFUNC(op_5038_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_5039_5)(uint32_t opcode) /* ADD */
 {
@@ -43253,18 +38062,11 @@ unsigned long CPUFUNC(op_5039_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_5040_5)(uint32_t opcode) /* ADD */
 {
@@ -43275,16 +38077,9 @@ unsigned long CPUFUNC(op_5040_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -43318,18 +38113,11 @@ unsigned long CPUFUNC(op_5050_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2405: ;
+}}}}}}}endlabel2405: ;
 return 12;
 }
 unsigned long CPUFUNC(op_5058_5)(uint32_t opcode) /* ADD */
@@ -43350,18 +38138,11 @@ unsigned long CPUFUNC(op_5058_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2406: ;
+}}}}}}}endlabel2406: ;
 return 12;
 }
 unsigned long CPUFUNC(op_5060_5)(uint32_t opcode) /* ADD */
@@ -43382,18 +38163,11 @@ unsigned long CPUFUNC(op_5060_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2407: ;
+}}}}}}}endlabel2407: ;
 return 14;
 }
 unsigned long CPUFUNC(op_5068_5)(uint32_t opcode) /* ADD */
@@ -43413,18 +38187,11 @@ unsigned long CPUFUNC(op_5068_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2408: ;
+}}}}}}}endlabel2408: ;
 return 16;
 }
 unsigned long CPUFUNC(op_5070_5)(uint32_t opcode) /* ADD */
@@ -43445,18 +38212,11 @@ unsigned long CPUFUNC(op_5070_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2409: ;
+}}}}}}}endlabel2409: ;
 return 18;
 }
 unsigned long CPUFUNC(op_5078_5)(uint32_t opcode) /* ADD */
@@ -43475,18 +38235,11 @@ unsigned long CPUFUNC(op_5078_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2410: ;
+}}}}}}}endlabel2410: ;
 return 16;
 }
 unsigned long CPUFUNC(op_5079_5)(uint32_t opcode) /* ADD */
@@ -43505,18 +38258,11 @@ unsigned long CPUFUNC(op_5079_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2411: ;
+}}}}}}}endlabel2411: ;
 return 20;
 }
 unsigned long CPUFUNC(op_5080_5)(uint32_t opcode) /* ADD */
@@ -43528,16 +38274,9 @@ unsigned long CPUFUNC(op_5080_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -43571,18 +38310,11 @@ unsigned long CPUFUNC(op_5090_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2414: ;
+}}}}}}}endlabel2414: ;
 return 20;
 }
 unsigned long CPUFUNC(op_5098_5)(uint32_t opcode) /* ADD */
@@ -43603,18 +38335,11 @@ unsigned long CPUFUNC(op_5098_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2415: ;
+}}}}}}}endlabel2415: ;
 return 20;
 }
 unsigned long CPUFUNC(op_50a0_5)(uint32_t opcode) /* ADD */
@@ -43635,18 +38360,11 @@ unsigned long CPUFUNC(op_50a0_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2416: ;
+}}}}}}}endlabel2416: ;
 return 22;
 }
 unsigned long CPUFUNC(op_50a8_5)(uint32_t opcode) /* ADD */
@@ -43666,18 +38384,11 @@ unsigned long CPUFUNC(op_50a8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2417: ;
+}}}}}}}endlabel2417: ;
 return 24;
 }
 unsigned long CPUFUNC(op_50b0_5)(uint32_t opcode) /* ADD */
@@ -43698,18 +38409,11 @@ unsigned long CPUFUNC(op_50b0_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2418: ;
+}}}}}}}endlabel2418: ;
 return 26;
 }
 unsigned long CPUFUNC(op_50b8_5)(uint32_t opcode) /* ADD */
@@ -43728,18 +38432,11 @@ unsigned long CPUFUNC(op_50b8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2419: ;
+}}}}}}}endlabel2419: ;
 return 24;
 }
 unsigned long CPUFUNC(op_50b9_5)(uint32_t opcode) /* ADD */
@@ -43758,18 +38455,11 @@ unsigned long CPUFUNC(op_50b9_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2420: ;
+}}}}}}}endlabel2420: ;
 return 28;
 }
 unsigned long CPUFUNC(op_50c0_5)(uint32_t opcode) /* Scc */
@@ -43897,16 +38587,9 @@ unsigned long CPUFUNC(op_5100_5)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -43919,18 +38602,11 @@ unsigned long CPUFUNC(op_5110_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_5118_5)(uint32_t opcode) /* SUB */
 {
@@ -43942,18 +38618,11 @@ unsigned long CPUFUNC(op_5118_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_5120_5)(uint32_t opcode) /* SUB */
 {
@@ -43965,18 +38634,11 @@ unsigned long CPUFUNC(op_5120_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 14;
+}}}}}}return 14;
 }
 unsigned long CPUFUNC(op_5128_5)(uint32_t opcode) /* SUB */
 {
@@ -43987,18 +38649,11 @@ unsigned long CPUFUNC(op_5128_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_5130_5)(uint32_t opcode) /* SUB */
 {
@@ -44010,18 +38665,11 @@ unsigned long CPUFUNC(op_5130_5)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_5138_5)(uint32_t opcode) /* SUB */
 {
@@ -44031,18 +38679,11 @@ unsigned long CPUFUNC(op_5138_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_5139_5)(uint32_t opcode) /* SUB */
 {
@@ -44052,18 +38693,11 @@ unsigned long CPUFUNC(op_5139_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_5140_5)(uint32_t opcode) /* SUB */
 {
@@ -44073,16 +38707,9 @@ unsigned long CPUFUNC(op_5140_5)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -44115,18 +38742,11 @@ unsigned long CPUFUNC(op_5150_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2440: ;
+}}}}}}}endlabel2440: ;
 return 12;
 }
 unsigned long CPUFUNC(op_5158_5)(uint32_t opcode) /* SUB */
@@ -44146,18 +38766,11 @@ unsigned long CPUFUNC(op_5158_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2441: ;
+}}}}}}}endlabel2441: ;
 return 12;
 }
 unsigned long CPUFUNC(op_5160_5)(uint32_t opcode) /* SUB */
@@ -44177,18 +38790,11 @@ unsigned long CPUFUNC(op_5160_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2442: ;
+}}}}}}}endlabel2442: ;
 return 14;
 }
 unsigned long CPUFUNC(op_5168_5)(uint32_t opcode) /* SUB */
@@ -44207,18 +38813,11 @@ unsigned long CPUFUNC(op_5168_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2443: ;
+}}}}}}}endlabel2443: ;
 return 16;
 }
 unsigned long CPUFUNC(op_5170_5)(uint32_t opcode) /* SUB */
@@ -44238,18 +38837,11 @@ unsigned long CPUFUNC(op_5170_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2444: ;
+}}}}}}}endlabel2444: ;
 return 18;
 }
 unsigned long CPUFUNC(op_5178_5)(uint32_t opcode) /* SUB */
@@ -44267,18 +38859,11 @@ unsigned long CPUFUNC(op_5178_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2445: ;
+}}}}}}}endlabel2445: ;
 return 16;
 }
 unsigned long CPUFUNC(op_5179_5)(uint32_t opcode) /* SUB */
@@ -44296,18 +38881,11 @@ unsigned long CPUFUNC(op_5179_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2446: ;
+}}}}}}}endlabel2446: ;
 return 20;
 }
 unsigned long CPUFUNC(op_5180_5)(uint32_t opcode) /* SUB */
@@ -44318,16 +38896,9 @@ unsigned long CPUFUNC(op_5180_5)(uint32_t opcode) /* SUB */
 {{	uint32_t src = srcreg;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -44360,18 +38931,11 @@ unsigned long CPUFUNC(op_5190_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2449: ;
+}}}}}}}endlabel2449: ;
 return 20;
 }
 unsigned long CPUFUNC(op_5198_5)(uint32_t opcode) /* SUB */
@@ -44391,18 +38955,11 @@ unsigned long CPUFUNC(op_5198_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2450: ;
+}}}}}}}endlabel2450: ;
 return 20;
 }
 unsigned long CPUFUNC(op_51a0_5)(uint32_t opcode) /* SUB */
@@ -44422,18 +38979,11 @@ unsigned long CPUFUNC(op_51a0_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2451: ;
+}}}}}}}endlabel2451: ;
 return 22;
 }
 unsigned long CPUFUNC(op_51a8_5)(uint32_t opcode) /* SUB */
@@ -44452,18 +39002,11 @@ unsigned long CPUFUNC(op_51a8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2452: ;
+}}}}}}}endlabel2452: ;
 return 24;
 }
 unsigned long CPUFUNC(op_51b0_5)(uint32_t opcode) /* SUB */
@@ -44483,18 +39026,11 @@ unsigned long CPUFUNC(op_51b0_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2453: ;
+}}}}}}}endlabel2453: ;
 return 26;
 }
 unsigned long CPUFUNC(op_51b8_5)(uint32_t opcode) /* SUB */
@@ -44512,18 +39048,11 @@ unsigned long CPUFUNC(op_51b8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2454: ;
+}}}}}}}endlabel2454: ;
 return 24;
 }
 unsigned long CPUFUNC(op_51b9_5)(uint32_t opcode) /* SUB */
@@ -44541,18 +39070,11 @@ unsigned long CPUFUNC(op_51b9_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2455: ;
+}}}}}}}endlabel2455: ;
 return 28;
 }
 unsigned long CPUFUNC(op_51c0_5)(uint32_t opcode) /* Scc */
@@ -47310,9 +41832,7 @@ unsigned long CPUFUNC(op_7000_5)(uint32_t opcode) /* MOVE */
 	uint32_t dstreg = (opcode >> 9) & 7;
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uint32_t src = srcreg;
-{	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+{	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47326,9 +41846,7 @@ unsigned long CPUFUNC(op_8000_5)(uint32_t opcode) /* OR */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47343,9 +41861,7 @@ unsigned long CPUFUNC(op_8010_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47361,9 +41877,7 @@ unsigned long CPUFUNC(op_8018_5)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47379,9 +41893,7 @@ unsigned long CPUFUNC(op_8020_5)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47396,9 +41908,7 @@ unsigned long CPUFUNC(op_8028_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47414,9 +41924,7 @@ unsigned long CPUFUNC(op_8030_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47430,9 +41938,7 @@ unsigned long CPUFUNC(op_8038_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47446,9 +41952,7 @@ unsigned long CPUFUNC(op_8039_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -47463,9 +41967,7 @@ unsigned long CPUFUNC(op_803a_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47481,9 +41983,7 @@ unsigned long CPUFUNC(op_803b_5)(uint32_t opcode) /* OR */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47496,9 +41996,7 @@ unsigned long CPUFUNC(op_803c_5)(uint32_t opcode) /* OR */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47512,9 +42010,7 @@ unsigned long CPUFUNC(op_8040_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47536,9 +42032,7 @@ unsigned long CPUFUNC(op_8050_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47562,9 +42056,7 @@ unsigned long CPUFUNC(op_8058_5)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47588,9 +42080,7 @@ unsigned long CPUFUNC(op_8060_5)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47613,9 +42103,7 @@ unsigned long CPUFUNC(op_8068_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47639,9 +42127,7 @@ unsigned long CPUFUNC(op_8070_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47663,9 +42149,7 @@ unsigned long CPUFUNC(op_8078_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47687,9 +42171,7 @@ unsigned long CPUFUNC(op_8079_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -47712,9 +42194,7 @@ unsigned long CPUFUNC(op_807a_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47738,9 +42218,7 @@ unsigned long CPUFUNC(op_807b_5)(uint32_t opcode) /* OR */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47754,9 +42232,7 @@ unsigned long CPUFUNC(op_807c_5)(uint32_t opcode) /* OR */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47770,9 +42246,7 @@ unsigned long CPUFUNC(op_8080_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47794,9 +42268,7 @@ unsigned long CPUFUNC(op_8090_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47820,9 +42292,7 @@ unsigned long CPUFUNC(op_8098_5)(uint32_t opcode) /* OR */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47846,9 +42316,7 @@ unsigned long CPUFUNC(op_80a0_5)(uint32_t opcode) /* OR */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -47871,9 +42339,7 @@ unsigned long CPUFUNC(op_80a8_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47897,9 +42363,7 @@ unsigned long CPUFUNC(op_80b0_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47921,9 +42385,7 @@ unsigned long CPUFUNC(op_80b8_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47945,9 +42407,7 @@ unsigned long CPUFUNC(op_80b9_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -47970,9 +42430,7 @@ unsigned long CPUFUNC(op_80ba_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -47996,9 +42454,7 @@ unsigned long CPUFUNC(op_80bb_5)(uint32_t opcode) /* OR */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -48012,9 +42468,7 @@ unsigned long CPUFUNC(op_80bc_5)(uint32_t opcode) /* OR */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -48036,9 +42490,7 @@ fill_prefetch_2 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48071,9 +42523,7 @@ fill_prefetch_2 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48107,9 +42557,7 @@ fill_prefetch_2 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48143,9 +42591,7 @@ fill_prefetch_2 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48178,9 +42624,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48214,9 +42658,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48248,9 +42690,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48282,9 +42722,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48317,9 +42755,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48353,9 +42789,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48379,9 +42813,7 @@ fill_prefetch_0 ();
 	uint32_t rem = (uint32_t)dst % (uint32_t)(uint16_t)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48451,9 +42883,7 @@ unsigned long CPUFUNC(op_8110_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -48469,9 +42899,7 @@ unsigned long CPUFUNC(op_8118_5)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -48487,9 +42915,7 @@ unsigned long CPUFUNC(op_8120_5)(uint32_t opcode) /* OR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -48504,9 +42930,7 @@ unsigned long CPUFUNC(op_8128_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -48522,9 +42946,7 @@ unsigned long CPUFUNC(op_8130_5)(uint32_t opcode) /* OR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -48538,9 +42960,7 @@ unsigned long CPUFUNC(op_8138_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -48554,9 +42974,7 @@ unsigned long CPUFUNC(op_8139_5)(uint32_t opcode) /* OR */
 {	uint32_t dsta = get_ilong_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -48578,9 +42996,7 @@ unsigned long CPUFUNC(op_8150_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -48604,9 +43020,7 @@ unsigned long CPUFUNC(op_8158_5)(uint32_t opcode) /* OR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -48630,9 +43044,7 @@ unsigned long CPUFUNC(op_8160_5)(uint32_t opcode) /* OR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -48655,9 +43067,7 @@ unsigned long CPUFUNC(op_8168_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -48681,9 +43091,7 @@ unsigned long CPUFUNC(op_8170_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -48705,9 +43113,7 @@ unsigned long CPUFUNC(op_8178_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -48729,9 +43135,7 @@ unsigned long CPUFUNC(op_8179_5)(uint32_t opcode) /* OR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -48754,9 +43158,7 @@ unsigned long CPUFUNC(op_8190_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -48780,9 +43182,7 @@ unsigned long CPUFUNC(op_8198_5)(uint32_t opcode) /* OR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -48806,9 +43206,7 @@ unsigned long CPUFUNC(op_81a0_5)(uint32_t opcode) /* OR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -48831,9 +43229,7 @@ unsigned long CPUFUNC(op_81a8_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -48857,9 +43253,7 @@ unsigned long CPUFUNC(op_81b0_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -48881,9 +43275,7 @@ unsigned long CPUFUNC(op_81b8_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -48905,9 +43297,7 @@ unsigned long CPUFUNC(op_81b9_5)(uint32_t opcode) /* OR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -48931,9 +43321,7 @@ fill_prefetch_2 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -48967,9 +43355,7 @@ fill_prefetch_2 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49004,9 +43390,7 @@ fill_prefetch_2 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49041,9 +43425,7 @@ fill_prefetch_2 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49077,9 +43459,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49114,9 +43494,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49149,9 +43527,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49184,9 +43560,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49220,9 +43594,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49257,9 +43629,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49284,9 +43654,7 @@ fill_prefetch_0 ();
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((int16_t)rem < 0) != ((int32_t)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_NFLG (((int16_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, newv);
 	newv = (newv & 0xffff) | ((uint32_t)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -49303,16 +43671,9 @@ unsigned long CPUFUNC(op_9000_5)(uint32_t opcode) /* SUB */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -49325,16 +43686,9 @@ unsigned long CPUFUNC(op_9010_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -49348,16 +43702,9 @@ unsigned long CPUFUNC(op_9018_5)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -49371,16 +43718,9 @@ unsigned long CPUFUNC(op_9020_5)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
 }
@@ -49393,16 +43733,9 @@ unsigned long CPUFUNC(op_9028_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -49416,16 +43749,9 @@ unsigned long CPUFUNC(op_9030_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -49437,16 +43763,9 @@ unsigned long CPUFUNC(op_9038_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -49458,16 +43777,9 @@ unsigned long CPUFUNC(op_9039_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -49480,16 +43792,9 @@ unsigned long CPUFUNC(op_903a_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -49503,16 +43808,9 @@ unsigned long CPUFUNC(op_903b_5)(uint32_t opcode) /* SUB */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -49523,16 +43821,9 @@ unsigned long CPUFUNC(op_903c_5)(uint32_t opcode) /* SUB */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -49544,16 +43835,9 @@ unsigned long CPUFUNC(op_9040_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -49565,16 +43849,9 @@ unsigned long CPUFUNC(op_9048_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -49594,16 +43871,9 @@ unsigned long CPUFUNC(op_9050_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2731: ;
 return 8;
@@ -49625,16 +43895,9 @@ unsigned long CPUFUNC(op_9058_5)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2732: ;
 return 8;
@@ -49656,16 +43919,9 @@ unsigned long CPUFUNC(op_9060_5)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2733: ;
 return 10;
@@ -49686,16 +43942,9 @@ unsigned long CPUFUNC(op_9068_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2734: ;
 return 12;
@@ -49717,16 +43966,9 @@ unsigned long CPUFUNC(op_9070_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2735: ;
 return 14;
@@ -49746,16 +43988,9 @@ unsigned long CPUFUNC(op_9078_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2736: ;
 return 12;
@@ -49775,16 +44010,9 @@ unsigned long CPUFUNC(op_9079_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2737: ;
 return 16;
@@ -49805,16 +44033,9 @@ unsigned long CPUFUNC(op_907a_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2738: ;
 return 12;
@@ -49836,16 +44057,9 @@ unsigned long CPUFUNC(op_907b_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2739: ;
 return 14;
@@ -49857,16 +44071,9 @@ unsigned long CPUFUNC(op_907c_5)(uint32_t opcode) /* SUB */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -49878,16 +44085,9 @@ unsigned long CPUFUNC(op_9080_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -49899,16 +44099,9 @@ unsigned long CPUFUNC(op_9088_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -49928,16 +44121,9 @@ unsigned long CPUFUNC(op_9090_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2743: ;
 return 14;
@@ -49959,16 +44145,9 @@ unsigned long CPUFUNC(op_9098_5)(uint32_t opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2744: ;
 return 14;
@@ -49990,16 +44169,9 @@ unsigned long CPUFUNC(op_90a0_5)(uint32_t opcode) /* SUB */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2745: ;
 return 16;
@@ -50020,16 +44192,9 @@ unsigned long CPUFUNC(op_90a8_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2746: ;
 return 18;
@@ -50051,16 +44216,9 @@ unsigned long CPUFUNC(op_90b0_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2747: ;
 return 20;
@@ -50080,16 +44238,9 @@ unsigned long CPUFUNC(op_90b8_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2748: ;
 return 18;
@@ -50109,16 +44260,9 @@ unsigned long CPUFUNC(op_90b9_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2749: ;
 return 22;
@@ -50139,16 +44283,9 @@ unsigned long CPUFUNC(op_90ba_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2750: ;
 return 18;
@@ -50170,16 +44307,9 @@ unsigned long CPUFUNC(op_90bb_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2751: ;
 return 20;
@@ -50191,16 +44321,9 @@ unsigned long CPUFUNC(op_90bc_5)(uint32_t opcode) /* SUB */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -50497,18 +44620,11 @@ unsigned long CPUFUNC(op_9110_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_9118_5)(uint32_t opcode) /* SUB */
 {
@@ -50520,18 +44636,11 @@ unsigned long CPUFUNC(op_9118_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_9120_5)(uint32_t opcode) /* SUB */
 {
@@ -50543,18 +44652,11 @@ unsigned long CPUFUNC(op_9120_5)(uint32_t opcode) /* SUB */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 14;
+}}}}}}return 14;
 }
 unsigned long CPUFUNC(op_9128_5)(uint32_t opcode) /* SUB */
 {
@@ -50565,18 +44667,11 @@ unsigned long CPUFUNC(op_9128_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_9130_5)(uint32_t opcode) /* SUB */
 {
@@ -50588,18 +44683,11 @@ unsigned long CPUFUNC(op_9130_5)(uint32_t opcode) /* SUB */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_9138_5)(uint32_t opcode) /* SUB */
 {
@@ -50609,18 +44697,11 @@ unsigned long CPUFUNC(op_9138_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_9139_5)(uint32_t opcode) /* SUB */
 {
@@ -50630,18 +44711,11 @@ unsigned long CPUFUNC(op_9139_5)(uint32_t opcode) /* SUB */
 {	uint32_t dsta = get_ilong_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_9140_5)(uint32_t opcode) /* SUBX */
 {
@@ -50720,18 +44794,11 @@ unsigned long CPUFUNC(op_9150_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2776: ;
+}}}}}}}endlabel2776: ;
 return 12;
 }
 unsigned long CPUFUNC(op_9158_5)(uint32_t opcode) /* SUB */
@@ -50751,18 +44818,11 @@ unsigned long CPUFUNC(op_9158_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2777: ;
+}}}}}}}endlabel2777: ;
 return 12;
 }
 unsigned long CPUFUNC(op_9160_5)(uint32_t opcode) /* SUB */
@@ -50782,18 +44842,11 @@ unsigned long CPUFUNC(op_9160_5)(uint32_t opcode) /* SUB */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2778: ;
+}}}}}}}endlabel2778: ;
 return 14;
 }
 unsigned long CPUFUNC(op_9168_5)(uint32_t opcode) /* SUB */
@@ -50812,18 +44865,11 @@ unsigned long CPUFUNC(op_9168_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2779: ;
+}}}}}}}endlabel2779: ;
 return 16;
 }
 unsigned long CPUFUNC(op_9170_5)(uint32_t opcode) /* SUB */
@@ -50843,18 +44889,11 @@ unsigned long CPUFUNC(op_9170_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2780: ;
+}}}}}}}endlabel2780: ;
 return 18;
 }
 unsigned long CPUFUNC(op_9178_5)(uint32_t opcode) /* SUB */
@@ -50872,18 +44911,11 @@ unsigned long CPUFUNC(op_9178_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2781: ;
+}}}}}}}endlabel2781: ;
 return 16;
 }
 unsigned long CPUFUNC(op_9179_5)(uint32_t opcode) /* SUB */
@@ -50901,18 +44933,11 @@ unsigned long CPUFUNC(op_9179_5)(uint32_t opcode) /* SUB */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel2782: ;
+}}}}}}}endlabel2782: ;
 return 20;
 }
 unsigned long CPUFUNC(op_9180_5)(uint32_t opcode) /* SUBX */
@@ -50992,18 +45017,11 @@ unsigned long CPUFUNC(op_9190_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2785: ;
+}}}}}}}endlabel2785: ;
 return 20;
 }
 unsigned long CPUFUNC(op_9198_5)(uint32_t opcode) /* SUB */
@@ -51023,18 +45041,11 @@ unsigned long CPUFUNC(op_9198_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2786: ;
+}}}}}}}endlabel2786: ;
 return 20;
 }
 unsigned long CPUFUNC(op_91a0_5)(uint32_t opcode) /* SUB */
@@ -51054,18 +45065,11 @@ unsigned long CPUFUNC(op_91a0_5)(uint32_t opcode) /* SUB */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2787: ;
+}}}}}}}endlabel2787: ;
 return 22;
 }
 unsigned long CPUFUNC(op_91a8_5)(uint32_t opcode) /* SUB */
@@ -51084,18 +45088,11 @@ unsigned long CPUFUNC(op_91a8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2788: ;
+}}}}}}}endlabel2788: ;
 return 24;
 }
 unsigned long CPUFUNC(op_91b0_5)(uint32_t opcode) /* SUB */
@@ -51115,18 +45112,11 @@ unsigned long CPUFUNC(op_91b0_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2789: ;
+}}}}}}}endlabel2789: ;
 return 26;
 }
 unsigned long CPUFUNC(op_91b8_5)(uint32_t opcode) /* SUB */
@@ -51144,18 +45134,11 @@ unsigned long CPUFUNC(op_91b8_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2790: ;
+}}}}}}}endlabel2790: ;
 return 24;
 }
 unsigned long CPUFUNC(op_91b9_5)(uint32_t opcode) /* SUB */
@@ -51173,18 +45156,11 @@ unsigned long CPUFUNC(op_91b9_5)(uint32_t opcode) /* SUB */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_SUB | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel2791: ;
+}}}}}}}endlabel2791: ;
 return 28;
 }
 unsigned long CPUFUNC(op_91c0_5)(uint32_t opcode) /* SUBA */
@@ -51433,14 +45409,8 @@ unsigned long CPUFUNC(op_b000_5)(uint32_t opcode) /* CMP */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -51453,14 +45423,8 @@ unsigned long CPUFUNC(op_b010_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -51474,14 +45438,8 @@ unsigned long CPUFUNC(op_b018_5)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -51495,14 +45453,8 @@ unsigned long CPUFUNC(op_b020_5)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
 }
@@ -51515,14 +45467,8 @@ unsigned long CPUFUNC(op_b028_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -51536,14 +45482,8 @@ unsigned long CPUFUNC(op_b030_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -51555,14 +45495,8 @@ unsigned long CPUFUNC(op_b038_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -51574,14 +45508,8 @@ unsigned long CPUFUNC(op_b039_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -51594,14 +45522,8 @@ unsigned long CPUFUNC(op_b03a_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -51615,14 +45537,8 @@ unsigned long CPUFUNC(op_b03b_5)(uint32_t opcode) /* CMP */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -51636,14 +45552,8 @@ unsigned long CPUFUNC(op_b03c_5)(uint32_t opcode) /* CMP */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -51655,14 +45565,8 @@ unsigned long CPUFUNC(op_b040_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -51674,14 +45578,8 @@ unsigned long CPUFUNC(op_b048_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -51701,14 +45599,8 @@ unsigned long CPUFUNC(op_b050_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2817: ;
 return 8;
@@ -51730,14 +45622,8 @@ unsigned long CPUFUNC(op_b058_5)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2818: ;
 return 8;
@@ -51759,14 +45645,8 @@ unsigned long CPUFUNC(op_b060_5)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2819: ;
 return 10;
@@ -51787,14 +45667,8 @@ unsigned long CPUFUNC(op_b068_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2820: ;
 return 12;
@@ -51816,14 +45690,8 @@ unsigned long CPUFUNC(op_b070_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2821: ;
 return 14;
@@ -51843,14 +45711,8 @@ unsigned long CPUFUNC(op_b078_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2822: ;
 return 12;
@@ -51870,14 +45732,8 @@ unsigned long CPUFUNC(op_b079_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2823: ;
 return 16;
@@ -51898,14 +45754,8 @@ unsigned long CPUFUNC(op_b07a_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2824: ;
 return 12;
@@ -51927,14 +45777,8 @@ unsigned long CPUFUNC(op_b07b_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2825: ;
 return 14;
@@ -51946,14 +45790,8 @@ unsigned long CPUFUNC(op_b07c_5)(uint32_t opcode) /* CMP */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -51965,14 +45803,8 @@ unsigned long CPUFUNC(op_b080_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -51984,14 +45816,8 @@ unsigned long CPUFUNC(op_b088_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -52011,14 +45837,8 @@ unsigned long CPUFUNC(op_b090_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2829: ;
 return 14;
@@ -52040,14 +45860,8 @@ unsigned long CPUFUNC(op_b098_5)(uint32_t opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2830: ;
 return 14;
@@ -52069,14 +45883,8 @@ unsigned long CPUFUNC(op_b0a0_5)(uint32_t opcode) /* CMP */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2831: ;
 return 16;
@@ -52097,14 +45905,8 @@ unsigned long CPUFUNC(op_b0a8_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2832: ;
 return 18;
@@ -52126,14 +45928,8 @@ unsigned long CPUFUNC(op_b0b0_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2833: ;
 return 20;
@@ -52153,14 +45949,8 @@ unsigned long CPUFUNC(op_b0b8_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2834: ;
 return 18;
@@ -52180,14 +45970,8 @@ unsigned long CPUFUNC(op_b0b9_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2835: ;
 return 22;
@@ -52208,14 +45992,8 @@ unsigned long CPUFUNC(op_b0ba_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2836: ;
 return 18;
@@ -52237,14 +46015,8 @@ unsigned long CPUFUNC(op_b0bb_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2837: ;
 return 20;
@@ -52256,14 +46028,8 @@ unsigned long CPUFUNC(op_b0bc_5)(uint32_t opcode) /* CMP */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
 }
@@ -52275,14 +46041,8 @@ unsigned long CPUFUNC(op_b0c0_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -52294,14 +46054,8 @@ unsigned long CPUFUNC(op_b0c8_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -52321,14 +46075,8 @@ unsigned long CPUFUNC(op_b0d0_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2841: ;
 return 10;
@@ -52350,14 +46098,8 @@ unsigned long CPUFUNC(op_b0d8_5)(uint32_t opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 2;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2842: ;
 return 10;
@@ -52379,14 +46121,8 @@ unsigned long CPUFUNC(op_b0e0_5)(uint32_t opcode) /* CMPA */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2843: ;
 return 12;
@@ -52407,14 +46143,8 @@ unsigned long CPUFUNC(op_b0e8_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2844: ;
 return 14;
@@ -52436,14 +46166,8 @@ unsigned long CPUFUNC(op_b0f0_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2845: ;
 return 16;
@@ -52463,14 +46187,8 @@ unsigned long CPUFUNC(op_b0f8_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2846: ;
 return 14;
@@ -52490,14 +46208,8 @@ unsigned long CPUFUNC(op_b0f9_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2847: ;
 return 18;
@@ -52518,14 +46230,8 @@ unsigned long CPUFUNC(op_b0fa_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2848: ;
 return 14;
@@ -52547,14 +46253,8 @@ unsigned long CPUFUNC(op_b0fb_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2849: ;
 return 16;
@@ -52566,14 +46266,8 @@ unsigned long CPUFUNC(op_b0fc_5)(uint32_t opcode) /* CMPA */
 {{	int16_t src = get_iword_prefetch(2);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 10;
 }
@@ -52585,9 +46279,7 @@ unsigned long CPUFUNC(op_b100_5)(uint32_t opcode) /* EOR */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -52605,14 +46297,8 @@ unsigned long CPUFUNC(op_b108_5)(uint32_t opcode) /* CMPM */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uint32_t newv = ((int8_t)(dst)) - ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint8_t)(src)) > ((uint8_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_BYTE, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 12;
 }
@@ -52625,9 +46311,7 @@ unsigned long CPUFUNC(op_b110_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -52643,9 +46327,7 @@ unsigned long CPUFUNC(op_b118_5)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -52661,9 +46343,7 @@ unsigned long CPUFUNC(op_b120_5)(uint32_t opcode) /* EOR */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -52678,9 +46358,7 @@ unsigned long CPUFUNC(op_b128_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -52696,9 +46374,7 @@ unsigned long CPUFUNC(op_b130_5)(uint32_t opcode) /* EOR */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -52712,9 +46388,7 @@ unsigned long CPUFUNC(op_b138_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -52728,9 +46402,7 @@ unsigned long CPUFUNC(op_b139_5)(uint32_t opcode) /* EOR */
 {	uint32_t dsta = get_ilong_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -52744,9 +46416,7 @@ unsigned long CPUFUNC(op_b140_5)(uint32_t opcode) /* EOR */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -52778,14 +46448,8 @@ unsigned long CPUFUNC(op_b148_5)(uint32_t opcode) /* CMPM */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uint32_t newv = ((int16_t)(dst)) - ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint16_t)(src)) > ((uint16_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_WORD, src, dst, newv);
+}}}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2861: ;
 return 12;
@@ -52806,9 +46470,7 @@ unsigned long CPUFUNC(op_b150_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -52832,9 +46494,7 @@ unsigned long CPUFUNC(op_b158_5)(uint32_t opcode) /* EOR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -52858,9 +46518,7 @@ unsigned long CPUFUNC(op_b160_5)(uint32_t opcode) /* EOR */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -52883,9 +46541,7 @@ unsigned long CPUFUNC(op_b168_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -52909,9 +46565,7 @@ unsigned long CPUFUNC(op_b170_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -52933,9 +46587,7 @@ unsigned long CPUFUNC(op_b178_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -52957,9 +46609,7 @@ unsigned long CPUFUNC(op_b179_5)(uint32_t opcode) /* EOR */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -52974,9 +46624,7 @@ unsigned long CPUFUNC(op_b180_5)(uint32_t opcode) /* EOR */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53008,14 +46656,8 @@ unsigned long CPUFUNC(op_b188_5)(uint32_t opcode) /* CMPM */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2870: ;
 return 20;
@@ -53036,9 +46678,7 @@ unsigned long CPUFUNC(op_b190_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -53062,9 +46702,7 @@ unsigned long CPUFUNC(op_b198_5)(uint32_t opcode) /* EOR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -53088,9 +46726,7 @@ unsigned long CPUFUNC(op_b1a0_5)(uint32_t opcode) /* EOR */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -53113,9 +46749,7 @@ unsigned long CPUFUNC(op_b1a8_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -53139,9 +46773,7 @@ unsigned long CPUFUNC(op_b1b0_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -53163,9 +46795,7 @@ unsigned long CPUFUNC(op_b1b8_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -53187,9 +46817,7 @@ unsigned long CPUFUNC(op_b1b9_5)(uint32_t opcode) /* EOR */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -53204,14 +46832,8 @@ unsigned long CPUFUNC(op_b1c0_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -53223,14 +46845,8 @@ unsigned long CPUFUNC(op_b1c8_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_areg(regs, srcreg);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
 }
@@ -53250,14 +46866,8 @@ unsigned long CPUFUNC(op_b1d0_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2880: ;
 return 14;
@@ -53279,14 +46889,8 @@ unsigned long CPUFUNC(op_b1d8_5)(uint32_t opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2881: ;
 return 14;
@@ -53308,14 +46912,8 @@ unsigned long CPUFUNC(op_b1e0_5)(uint32_t opcode) /* CMPA */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2882: ;
 return 16;
@@ -53336,14 +46934,8 @@ unsigned long CPUFUNC(op_b1e8_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2883: ;
 return 18;
@@ -53365,14 +46957,8 @@ unsigned long CPUFUNC(op_b1f0_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2884: ;
 return 20;
@@ -53392,14 +46978,8 @@ unsigned long CPUFUNC(op_b1f8_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2885: ;
 return 18;
@@ -53419,14 +46999,8 @@ unsigned long CPUFUNC(op_b1f9_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2886: ;
 return 22;
@@ -53447,14 +47021,8 @@ unsigned long CPUFUNC(op_b1fa_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2887: ;
 return 18;
@@ -53476,14 +47044,8 @@ unsigned long CPUFUNC(op_b1fb_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(4);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2888: ;
 return 20;
@@ -53495,14 +47057,8 @@ unsigned long CPUFUNC(op_b1fc_5)(uint32_t opcode) /* CMPA */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_areg(regs, dstreg);
 {{uint32_t newv = ((int32_t)(dst)) - ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uint32_t)(src)) > ((uint32_t)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	CC_RECORD_KEEPX (CC_CMP | CC_LONG, src, dst, newv);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
 }
@@ -53514,9 +47070,7 @@ unsigned long CPUFUNC(op_c000_5)(uint32_t opcode) /* AND */
 {{	int8_t src = m68k_dreg(regs, srcreg);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53531,9 +47085,7 @@ unsigned long CPUFUNC(op_c010_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53549,9 +47101,7 @@ unsigned long CPUFUNC(op_c018_5)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53567,9 +47117,7 @@ unsigned long CPUFUNC(op_c020_5)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53584,9 +47132,7 @@ unsigned long CPUFUNC(op_c028_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53602,9 +47148,7 @@ unsigned long CPUFUNC(op_c030_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53618,9 +47162,7 @@ unsigned long CPUFUNC(op_c038_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53634,9 +47176,7 @@ unsigned long CPUFUNC(op_c039_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -53651,9 +47191,7 @@ unsigned long CPUFUNC(op_c03a_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53669,9 +47207,7 @@ unsigned long CPUFUNC(op_c03b_5)(uint32_t opcode) /* AND */
 {	int8_t src = m68k_read_memory_8(srca);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53684,9 +47220,7 @@ unsigned long CPUFUNC(op_c03c_5)(uint32_t opcode) /* AND */
 {{	int8_t src = get_ibyte_prefetch(2);
 {	int8_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53700,9 +47234,7 @@ unsigned long CPUFUNC(op_c040_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53724,9 +47256,7 @@ unsigned long CPUFUNC(op_c050_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53750,9 +47280,7 @@ unsigned long CPUFUNC(op_c058_5)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53776,9 +47304,7 @@ unsigned long CPUFUNC(op_c060_5)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53801,9 +47327,7 @@ unsigned long CPUFUNC(op_c068_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53827,9 +47351,7 @@ unsigned long CPUFUNC(op_c070_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53851,9 +47373,7 @@ unsigned long CPUFUNC(op_c078_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53875,9 +47395,7 @@ unsigned long CPUFUNC(op_c079_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -53900,9 +47418,7 @@ unsigned long CPUFUNC(op_c07a_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53926,9 +47442,7 @@ unsigned long CPUFUNC(op_c07b_5)(uint32_t opcode) /* AND */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53942,9 +47456,7 @@ unsigned long CPUFUNC(op_c07c_5)(uint32_t opcode) /* AND */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -53958,9 +47470,7 @@ unsigned long CPUFUNC(op_c080_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_dreg(regs, srcreg);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53982,9 +47492,7 @@ unsigned long CPUFUNC(op_c090_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -54008,9 +47516,7 @@ unsigned long CPUFUNC(op_c098_5)(uint32_t opcode) /* AND */
 	m68k_areg(regs, srcreg) += 4;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -54034,9 +47540,7 @@ unsigned long CPUFUNC(op_c0a0_5)(uint32_t opcode) /* AND */
 	m68k_areg (regs, srcreg) = srca;
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -54059,9 +47563,7 @@ unsigned long CPUFUNC(op_c0a8_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -54085,9 +47587,7 @@ unsigned long CPUFUNC(op_c0b0_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -54109,9 +47609,7 @@ unsigned long CPUFUNC(op_c0b8_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -54133,9 +47631,7 @@ unsigned long CPUFUNC(op_c0b9_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -54158,9 +47654,7 @@ unsigned long CPUFUNC(op_c0ba_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -54184,9 +47678,7 @@ unsigned long CPUFUNC(op_c0bb_5)(uint32_t opcode) /* AND */
 {{	int32_t src = m68k_read_memory_32(srca);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -54200,9 +47692,7 @@ unsigned long CPUFUNC(op_c0bc_5)(uint32_t opcode) /* AND */
 {{	int32_t src = get_ilong_prefetch(2);
 {	int32_t dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -54217,9 +47707,7 @@ unsigned long CPUFUNC(op_c0c0_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_dreg(regs, srcreg);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}m68k_incpc(2);
@@ -54243,9 +47731,7 @@ unsigned long CPUFUNC(op_c0d0_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -54271,9 +47757,7 @@ unsigned long CPUFUNC(op_c0d8_5)(uint32_t opcode) /* MULU */
 	m68k_areg(regs, srcreg) += 2;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -54299,9 +47783,7 @@ unsigned long CPUFUNC(op_c0e0_5)(uint32_t opcode) /* MULU */
 	m68k_areg (regs, srcreg) = srca;
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -54326,9 +47808,7 @@ unsigned long CPUFUNC(op_c0e8_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -54354,9 +47834,7 @@ unsigned long CPUFUNC(op_c0f0_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -54380,9 +47858,7 @@ unsigned long CPUFUNC(op_c0f8_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -54406,9 +47882,7 @@ unsigned long CPUFUNC(op_c0f9_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(6);
@@ -54433,9 +47907,7 @@ unsigned long CPUFUNC(op_c0fa_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -54461,9 +47933,7 @@ unsigned long CPUFUNC(op_c0fb_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = m68k_read_memory_16(srca);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -54479,9 +47949,7 @@ unsigned long CPUFUNC(op_c0fc_5)(uint32_t opcode) /* MULU */
 {{	int16_t src = get_iword_prefetch(2);
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (uint32_t)(uint16_t)dst * (uint32_t)(uint16_t)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uint16_t)src >> 1; }
 }}}}m68k_incpc(4);
@@ -54549,9 +48017,7 @@ unsigned long CPUFUNC(op_c110_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -54567,9 +48033,7 @@ unsigned long CPUFUNC(op_c118_5)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -54585,9 +48049,7 @@ unsigned long CPUFUNC(op_c120_5)(uint32_t opcode) /* AND */
 {	int8_t dst = m68k_read_memory_8(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,src);
@@ -54602,9 +48064,7 @@ unsigned long CPUFUNC(op_c128_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = m68k_areg(regs, dstreg) + (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -54620,9 +48080,7 @@ unsigned long CPUFUNC(op_c130_5)(uint32_t opcode) /* AND */
 	BusCyclePenalty += 2;
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -54636,9 +48094,7 @@ unsigned long CPUFUNC(op_c138_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = (int32_t)(int16_t)get_iword_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -54652,9 +48108,7 @@ unsigned long CPUFUNC(op_c139_5)(uint32_t opcode) /* AND */
 {	uint32_t dsta = get_ilong_prefetch(2);
 {	int8_t dst = m68k_read_memory_8(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int8_t)(src)) == 0);
-	SET_NFLG (((int8_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_BYTE, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,src);
@@ -54702,9 +48156,7 @@ unsigned long CPUFUNC(op_c150_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -54728,9 +48180,7 @@ unsigned long CPUFUNC(op_c158_5)(uint32_t opcode) /* AND */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -54754,9 +48204,7 @@ unsigned long CPUFUNC(op_c160_5)(uint32_t opcode) /* AND */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,src);
@@ -54779,9 +48227,7 @@ unsigned long CPUFUNC(op_c168_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -54805,9 +48251,7 @@ unsigned long CPUFUNC(op_c170_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -54829,9 +48273,7 @@ unsigned long CPUFUNC(op_c178_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -54853,9 +48295,7 @@ unsigned long CPUFUNC(op_c179_5)(uint32_t opcode) /* AND */
 	}
 {{	int16_t dst = m68k_read_memory_16(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(src)) == 0);
-	SET_NFLG (((int16_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,src);
@@ -54891,9 +48331,7 @@ unsigned long CPUFUNC(op_c190_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -54917,9 +48355,7 @@ unsigned long CPUFUNC(op_c198_5)(uint32_t opcode) /* AND */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -54943,9 +48379,7 @@ unsigned long CPUFUNC(op_c1a0_5)(uint32_t opcode) /* AND */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,src);
@@ -54968,9 +48402,7 @@ unsigned long CPUFUNC(op_c1a8_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -54994,9 +48426,7 @@ unsigned long CPUFUNC(op_c1b0_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -55018,9 +48448,7 @@ unsigned long CPUFUNC(op_c1b8_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -55042,9 +48470,7 @@ unsigned long CPUFUNC(op_c1b9_5)(uint32_t opcode) /* AND */
 	}
 {{	int32_t dst = m68k_read_memory_32(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(src)) == 0);
-	SET_NFLG (((int32_t)(src)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, src);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,src);
@@ -55061,9 +48487,7 @@ unsigned long CPUFUNC(op_c1c0_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55089,9 +48513,7 @@ unsigned long CPUFUNC(op_c1d0_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55119,9 +48541,7 @@ unsigned long CPUFUNC(op_c1d8_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55149,9 +48569,7 @@ unsigned long CPUFUNC(op_c1e0_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55178,9 +48596,7 @@ unsigned long CPUFUNC(op_c1e8_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55208,9 +48624,7 @@ unsigned long CPUFUNC(op_c1f0_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55236,9 +48650,7 @@ unsigned long CPUFUNC(op_c1f8_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55264,9 +48676,7 @@ unsigned long CPUFUNC(op_c1f9_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55293,9 +48703,7 @@ unsigned long CPUFUNC(op_c1fa_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55323,9 +48731,7 @@ unsigned long CPUFUNC(op_c1fb_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55343,9 +48749,7 @@ unsigned long CPUFUNC(op_c1fc_5)(uint32_t opcode) /* MULS */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	uint32_t newv = (int32_t)(int16_t)dst * (int32_t)(int16_t)src;
 	uint32_t src2;
-	CLEAR_CZNV;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_NFLG (((int32_t)(newv)) < 0);
+	CC_RECORD_LOGICAL (CC_LONG, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uint32_t)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -55362,16 +48766,9 @@ unsigned long CPUFUNC(op_d000_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -55385,16 +48782,9 @@ unsigned long CPUFUNC(op_d010_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -55409,16 +48799,9 @@ unsigned long CPUFUNC(op_d018_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -55433,16 +48816,9 @@ unsigned long CPUFUNC(op_d020_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
 }
@@ -55456,16 +48832,9 @@ unsigned long CPUFUNC(op_d028_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -55480,16 +48849,9 @@ unsigned long CPUFUNC(op_d030_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -55502,16 +48864,9 @@ unsigned long CPUFUNC(op_d038_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -55524,16 +48879,9 @@ unsigned long CPUFUNC(op_d039_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -55547,16 +48895,9 @@ unsigned long CPUFUNC(op_d03a_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
 }
@@ -55571,16 +48912,9 @@ unsigned long CPUFUNC(op_d03b_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
 }
@@ -55592,16 +48926,9 @@ unsigned long CPUFUNC(op_d03c_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -55614,16 +48941,9 @@ unsigned long CPUFUNC(op_d040_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -55636,16 +48956,9 @@ unsigned long CPUFUNC(op_d048_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
 }
@@ -55666,16 +48979,9 @@ unsigned long CPUFUNC(op_d050_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2984: ;
 return 8;
@@ -55698,16 +49004,9 @@ unsigned long CPUFUNC(op_d058_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2985: ;
 return 8;
@@ -55730,16 +49029,9 @@ unsigned long CPUFUNC(op_d060_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2986: ;
 return 10;
@@ -55761,16 +49053,9 @@ unsigned long CPUFUNC(op_d068_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2987: ;
 return 12;
@@ -55793,16 +49078,9 @@ unsigned long CPUFUNC(op_d070_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2988: ;
 return 14;
@@ -55823,16 +49101,9 @@ unsigned long CPUFUNC(op_d078_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2989: ;
 return 12;
@@ -55853,16 +49124,9 @@ unsigned long CPUFUNC(op_d079_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2990: ;
 return 16;
@@ -55884,16 +49148,9 @@ unsigned long CPUFUNC(op_d07a_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2991: ;
 return 12;
@@ -55916,16 +49173,9 @@ unsigned long CPUFUNC(op_d07b_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2992: ;
 return 14;
@@ -55938,16 +49188,9 @@ unsigned long CPUFUNC(op_d07c_5)(uint32_t opcode) /* ADD */
 {	int16_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
 }
@@ -55960,16 +49203,9 @@ unsigned long CPUFUNC(op_d080_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -55982,16 +49218,9 @@ unsigned long CPUFUNC(op_d088_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
 }
@@ -56012,16 +49241,9 @@ unsigned long CPUFUNC(op_d090_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2996: ;
 return 14;
@@ -56044,16 +49266,9 @@ unsigned long CPUFUNC(op_d098_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2997: ;
 return 14;
@@ -56076,16 +49291,9 @@ unsigned long CPUFUNC(op_d0a0_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(2);
+}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2998: ;
 return 16;
@@ -56107,16 +49315,9 @@ unsigned long CPUFUNC(op_d0a8_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2999: ;
 return 18;
@@ -56139,16 +49340,9 @@ unsigned long CPUFUNC(op_d0b0_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3000: ;
 return 20;
@@ -56169,16 +49363,9 @@ unsigned long CPUFUNC(op_d0b8_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3001: ;
 return 18;
@@ -56199,16 +49386,9 @@ unsigned long CPUFUNC(op_d0b9_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3002: ;
 return 22;
@@ -56230,16 +49410,9 @@ unsigned long CPUFUNC(op_d0ba_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3003: ;
 return 18;
@@ -56262,16 +49435,9 @@ unsigned long CPUFUNC(op_d0bb_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3004: ;
 return 20;
@@ -56284,16 +49450,9 @@ unsigned long CPUFUNC(op_d0bc_5)(uint32_t opcode) /* ADD */
 {	int32_t dst = m68k_dreg(regs, dstreg);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
 }
@@ -56591,18 +49750,11 @@ unsigned long CPUFUNC(op_d110_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_d118_5)(uint32_t opcode) /* ADD */
 {
@@ -56615,18 +49767,11 @@ unsigned long CPUFUNC(op_d118_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 12;
+}}}}}}return 12;
 }
 unsigned long CPUFUNC(op_d120_5)(uint32_t opcode) /* ADD */
 {
@@ -56639,18 +49784,11 @@ unsigned long CPUFUNC(op_d120_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 14;
+}}}}}}return 14;
 }
 unsigned long CPUFUNC(op_d128_5)(uint32_t opcode) /* ADD */
 {
@@ -56662,18 +49800,11 @@ unsigned long CPUFUNC(op_d128_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_d130_5)(uint32_t opcode) /* ADD */
 {
@@ -56686,18 +49817,11 @@ unsigned long CPUFUNC(op_d130_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 18;
+}}}}}}return 18;
 }
 unsigned long CPUFUNC(op_d138_5)(uint32_t opcode) /* ADD */
 {
@@ -56708,18 +49832,11 @@ unsigned long CPUFUNC(op_d138_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 16;
+}}}}}}return 16;
 }
 unsigned long CPUFUNC(op_d139_5)(uint32_t opcode) /* ADD */
 {
@@ -56730,18 +49847,11 @@ unsigned long CPUFUNC(op_d139_5)(uint32_t opcode) /* ADD */
 {	int8_t dst = m68k_read_memory_8(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int8_t)(dst)) + ((int8_t)(src));
-{	int flgs = ((int8_t)(src)) < 0;
-	int flgo = ((int8_t)(dst)) < 0;
-	int flgn = ((int8_t)(newv)) < 0;
-	SET_ZFLG (((int8_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint8_t)(~dst)) < ((uint8_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_BYTE, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_8(dsta,newv);
-}}}}}}}return 20;
+}}}}}}return 20;
 }
 unsigned long CPUFUNC(op_d140_5)(uint32_t opcode) /* ADDX */
 {
@@ -56821,18 +49931,11 @@ unsigned long CPUFUNC(op_d150_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3029: ;
+}}}}}}}endlabel3029: ;
 return 12;
 }
 unsigned long CPUFUNC(op_d158_5)(uint32_t opcode) /* ADD */
@@ -56853,18 +49956,11 @@ unsigned long CPUFUNC(op_d158_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 2;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3030: ;
+}}}}}}}endlabel3030: ;
 return 12;
 }
 unsigned long CPUFUNC(op_d160_5)(uint32_t opcode) /* ADD */
@@ -56885,18 +49981,11 @@ unsigned long CPUFUNC(op_d160_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3031: ;
+}}}}}}}endlabel3031: ;
 return 14;
 }
 unsigned long CPUFUNC(op_d168_5)(uint32_t opcode) /* ADD */
@@ -56916,18 +50005,11 @@ unsigned long CPUFUNC(op_d168_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3032: ;
+}}}}}}}endlabel3032: ;
 return 16;
 }
 unsigned long CPUFUNC(op_d170_5)(uint32_t opcode) /* ADD */
@@ -56948,18 +50030,11 @@ unsigned long CPUFUNC(op_d170_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3033: ;
+}}}}}}}endlabel3033: ;
 return 18;
 }
 unsigned long CPUFUNC(op_d178_5)(uint32_t opcode) /* ADD */
@@ -56978,18 +50053,11 @@ unsigned long CPUFUNC(op_d178_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3034: ;
+}}}}}}}endlabel3034: ;
 return 16;
 }
 unsigned long CPUFUNC(op_d179_5)(uint32_t opcode) /* ADD */
@@ -57008,18 +50076,11 @@ unsigned long CPUFUNC(op_d179_5)(uint32_t opcode) /* ADD */
 {{	int16_t dst = m68k_read_memory_16(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int16_t)(dst)) + ((int16_t)(src));
-{	int flgs = ((int16_t)(src)) < 0;
-	int flgo = ((int16_t)(dst)) < 0;
-	int flgn = ((int16_t)(newv)) < 0;
-	SET_ZFLG (((int16_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint16_t)(~dst)) < ((uint16_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_WORD, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_16(dsta,newv);
-}}}}}}}}endlabel3035: ;
+}}}}}}}endlabel3035: ;
 return 20;
 }
 unsigned long CPUFUNC(op_d180_5)(uint32_t opcode) /* ADDX */
@@ -57100,18 +50161,11 @@ unsigned long CPUFUNC(op_d190_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3038: ;
+}}}}}}}endlabel3038: ;
 return 20;
 }
 unsigned long CPUFUNC(op_d198_5)(uint32_t opcode) /* ADD */
@@ -57132,18 +50186,11 @@ unsigned long CPUFUNC(op_d198_5)(uint32_t opcode) /* ADD */
 	m68k_areg(regs, dstreg) += 4;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3039: ;
+}}}}}}}endlabel3039: ;
 return 20;
 }
 unsigned long CPUFUNC(op_d1a0_5)(uint32_t opcode) /* ADD */
@@ -57164,18 +50211,11 @@ unsigned long CPUFUNC(op_d1a0_5)(uint32_t opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3040: ;
+}}}}}}}endlabel3040: ;
 return 22;
 }
 unsigned long CPUFUNC(op_d1a8_5)(uint32_t opcode) /* ADD */
@@ -57195,18 +50235,11 @@ unsigned long CPUFUNC(op_d1a8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3041: ;
+}}}}}}}endlabel3041: ;
 return 24;
 }
 unsigned long CPUFUNC(op_d1b0_5)(uint32_t opcode) /* ADD */
@@ -57227,18 +50260,11 @@ unsigned long CPUFUNC(op_d1b0_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3042: ;
+}}}}}}}endlabel3042: ;
 return 26;
 }
 unsigned long CPUFUNC(op_d1b8_5)(uint32_t opcode) /* ADD */
@@ -57257,18 +50283,11 @@ unsigned long CPUFUNC(op_d1b8_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3043: ;
+}}}}}}}endlabel3043: ;
 return 24;
 }
 unsigned long CPUFUNC(op_d1b9_5)(uint32_t opcode) /* ADD */
@@ -57287,18 +50306,11 @@ unsigned long CPUFUNC(op_d1b9_5)(uint32_t opcode) /* ADD */
 {{	int32_t dst = m68k_read_memory_32(dsta);
 {	refill_prefetch (m68k_getpc(), 2);
 {uint32_t newv = ((int32_t)(dst)) + ((int32_t)(src));
-{	int flgs = ((int32_t)(src)) < 0;
-	int flgo = ((int32_t)(dst)) < 0;
-	int flgn = ((int32_t)(newv)) < 0;
-	SET_ZFLG (((int32_t)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uint32_t)(~dst)) < ((uint32_t)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	CC_RECORD (CC_ADD | CC_LONG, src, dst, newv);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	m68k_write_memory_32(dsta,newv);
-}}}}}}}}endlabel3044: ;
+}}}}}}}endlabel3044: ;
 return 28;
 }
 unsigned long CPUFUNC(op_d1c0_5)(uint32_t opcode) /* ADDA */
@@ -58288,9 +51300,7 @@ unsigned long CPUFUNC(op_e0d0_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -58317,9 +51327,7 @@ unsigned long CPUFUNC(op_e0d8_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -58346,9 +51354,7 @@ unsigned long CPUFUNC(op_e0e0_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -58374,9 +51380,7 @@ unsigned long CPUFUNC(op_e0e8_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -58403,9 +51407,7 @@ unsigned long CPUFUNC(op_e0f0_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -58430,9 +51432,7 @@ unsigned long CPUFUNC(op_e0f8_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -58457,9 +51457,7 @@ unsigned long CPUFUNC(op_e0f9_5)(uint32_t opcode) /* ASRW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -59211,9 +52209,7 @@ unsigned long CPUFUNC(op_e1d0_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59242,9 +52238,7 @@ unsigned long CPUFUNC(op_e1d8_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59273,9 +52267,7 @@ unsigned long CPUFUNC(op_e1e0_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59303,9 +52295,7 @@ unsigned long CPUFUNC(op_e1e8_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59334,9 +52324,7 @@ unsigned long CPUFUNC(op_e1f0_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59363,9 +52351,7 @@ unsigned long CPUFUNC(op_e1f8_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59392,9 +52378,7 @@ unsigned long CPUFUNC(op_e1f9_5)(uint32_t opcode) /* ASLW */
 	uint32_t sign = 0x8000 & val;
 	uint32_t sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -59421,9 +52405,7 @@ unsigned long CPUFUNC(op_e2d0_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59449,9 +52431,7 @@ unsigned long CPUFUNC(op_e2d8_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59477,9 +52457,7 @@ unsigned long CPUFUNC(op_e2e0_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59504,9 +52482,7 @@ unsigned long CPUFUNC(op_e2e8_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59532,9 +52508,7 @@ unsigned long CPUFUNC(op_e2f0_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59558,9 +52532,7 @@ unsigned long CPUFUNC(op_e2f8_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59584,9 +52556,7 @@ unsigned long CPUFUNC(op_e2f9_5)(uint32_t opcode) /* LSRW */
 {	uint32_t val = (uint16_t)data;
 	uint32_t carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -59611,9 +52581,7 @@ unsigned long CPUFUNC(op_e3d0_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59639,9 +52607,7 @@ unsigned long CPUFUNC(op_e3d8_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59667,9 +52633,7 @@ unsigned long CPUFUNC(op_e3e0_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59694,9 +52658,7 @@ unsigned long CPUFUNC(op_e3e8_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59722,9 +52684,7 @@ unsigned long CPUFUNC(op_e3f0_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59748,9 +52708,7 @@ unsigned long CPUFUNC(op_e3f8_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59774,9 +52732,7 @@ unsigned long CPUFUNC(op_e3f9_5)(uint32_t opcode) /* LSLW */
 {	uint16_t val = data;
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -59802,9 +52758,7 @@ unsigned long CPUFUNC(op_e4d0_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59831,9 +52785,7 @@ unsigned long CPUFUNC(op_e4d8_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59860,9 +52812,7 @@ unsigned long CPUFUNC(op_e4e0_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -59888,9 +52838,7 @@ unsigned long CPUFUNC(op_e4e8_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59917,9 +52865,7 @@ unsigned long CPUFUNC(op_e4f0_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59944,9 +52890,7 @@ unsigned long CPUFUNC(op_e4f8_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -59971,9 +52915,7 @@ unsigned long CPUFUNC(op_e4f9_5)(uint32_t opcode) /* ROXRW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -59999,9 +52941,7 @@ unsigned long CPUFUNC(op_e5d0_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -60028,9 +52968,7 @@ unsigned long CPUFUNC(op_e5d8_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -60057,9 +52995,7 @@ unsigned long CPUFUNC(op_e5e0_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -60085,9 +53021,7 @@ unsigned long CPUFUNC(op_e5e8_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -60114,9 +53048,7 @@ unsigned long CPUFUNC(op_e5f0_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -60141,9 +53073,7 @@ unsigned long CPUFUNC(op_e5f8_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -60168,9 +53098,7 @@ unsigned long CPUFUNC(op_e5f9_5)(uint32_t opcode) /* ROXLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -60196,9 +53124,7 @@ unsigned long CPUFUNC(op_e6d0_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60224,9 +53150,7 @@ unsigned long CPUFUNC(op_e6d8_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60252,9 +53176,7 @@ unsigned long CPUFUNC(op_e6e0_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60279,9 +53201,7 @@ unsigned long CPUFUNC(op_e6e8_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60307,9 +53227,7 @@ unsigned long CPUFUNC(op_e6f0_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60333,9 +53251,7 @@ unsigned long CPUFUNC(op_e6f8_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60359,9 +53275,7 @@ unsigned long CPUFUNC(op_e6f9_5)(uint32_t opcode) /* RORW */
 	uint32_t carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry);
 m68k_incpc(6);
 fill_prefetch_0 ();
@@ -60386,9 +53300,7 @@ unsigned long CPUFUNC(op_e7d0_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60414,9 +53326,7 @@ unsigned long CPUFUNC(op_e7d8_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60442,9 +53352,7 @@ unsigned long CPUFUNC(op_e7e0_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -60469,9 +53377,7 @@ unsigned long CPUFUNC(op_e7e8_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60497,9 +53403,7 @@ unsigned long CPUFUNC(op_e7f0_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60523,9 +53427,7 @@ unsigned long CPUFUNC(op_e7f8_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60549,9 +53451,7 @@ unsigned long CPUFUNC(op_e7f9_5)(uint32_t opcode) /* ROLW */
 	uint32_t carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((int16_t)(val)) == 0);
-	SET_NFLG (((int16_t)(val)) < 0);
+	CC_RECORD_LOGICAL (CC_WORD, val);
 SET_CFLG (carry >> 15);
 m68k_incpc(6);
 fill_prefetch_0 ();
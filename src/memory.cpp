@@ -8,6 +8,8 @@
 // WHO  WHEN        WHAT
 // ---  ----------  -----------------------------------------------------------
 // JLH  12/10/2009  Repurposed this file. :-)
+// JPM   Oct./2026  Memory space aligned for the huge pages backing
+// JPM   Oct./2026  Memory space pages write epochs
 //
 
 /*
@@ -28,8 +30,10 @@ N.B.: Jaguar RAM is only 2 megs. ROM is 6 megs max, IO is 128K
 */
 
 #include "memory.h"
+#include "hosttuning.h"
 
-uint8_t jagMemSpace[0xF20000];					// The entire memory space of the Jaguar...!
+// Aligned on a huge page boundary, so it can be backed by huge pages
+HOST_HUGEPAGE_ALIGN uint8_t jagMemSpace[0xF20000];	// The entire memory space of the Jaguar...!
 
 uint8_t * jaguarMainRAM = &jagMemSpace[0x000000];
 uint8_t * jaguarMainROM = &jagMemSpace[0x800000];
@@ -37,6 +41,38 @@ uint8_t * cdRAM         = &jagMemSpace[0xDFFF00];
 //uint8_t * gpuRAM        = &jagMemSpace[0xF03000];
 //uint8_t * dspRAM        = &jagMemSpace[0xF1B000];
 
+// The pages never written are at epoch 0, before the first one
+uint64_t memoryPageEpoch[MEMORY_PAGES];
+uint64_t memoryEpoch = 1;
+
+
+//
+// Start a new epoch, the pages written from now on will have it
+//
+uint64_t MemoryNewEpoch(void)
+{
+	return ++memoryEpoch;
+}
+
+
+//
+// Mark the memory space written out of the bus functions
+//
+void MemoryPagesWritten(uint32_t address, uint32_t size)
+{
+	if (!size || (address >= 0xF20000))
+	{
+		return;
+	}
+
+	uint32_t last = (((size - 1) > (0xF20000 - 1 - address)) ? (0xF20000 - 1) : (address + size - 1));
+
+	for (uint32_t page = (address >> MEMORY_PAGE_SHIFT); page <= (last >> MEMORY_PAGE_SHIFT); page++)
+	{
+		memoryPageEpoch[page] = memoryEpoch;
+	}
+}
+
 #if 0
 union Word
 {
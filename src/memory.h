@@ -8,6 +8,7 @@
 // Who  When        What
 // ---  ----------  -------------------------------------------------------------
 // JPM  06/16/2016  Added a Big to Little endian
+// JPM   Oct./2026  Memory space pages write epochs
 //
 
 #ifndef __MEMORY_H__
@@ -22,6 +23,20 @@ extern uint8_t * jaguarMainROM;
 //extern uint8_t * gpuRAM;
 //extern uint8_t * dspRAM;
 
+// Memory space pages write epochs: a page written since the start of an epoch
+// has this epoch, or a later one
+#define MEMORY_PAGE_SHIFT	12
+#define MEMORY_PAGES		(0xF20000 >> MEMORY_PAGE_SHIFT)
+
+extern uint64_t memoryPageEpoch[MEMORY_PAGES];
+extern uint64_t memoryEpoch;
+
+// Used by the bus write functions, the address must be in the memory space
+#define MEMORY_PAGE_WRITTEN(address)	(memoryPageEpoch[(address) >> MEMORY_PAGE_SHIFT] = memoryEpoch)
+
+extern uint64_t MemoryNewEpoch(void);
+extern void MemoryPagesWritten(uint32_t address, uint32_t size);
+
 #if 1
 extern uint32_t & butch, & dscntrl;
 extern uint16_t & ds_data;
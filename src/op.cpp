@@ -18,18 +18,34 @@
 // JLH  01/16/2010  Created this log ;-)
 // JPM  06/06/2016  Visual Studio support
 // JPM  March/2022  Fix the Object list at $0, added the save state patch from PvtLewis
+// JPM   Oct./2026  Speculative rendering of the next halfline on a worker thread
+// JPM   Oct./2026  STOP object interrupt requested to the interrupt controller
+// JPM   Oct./2026  Object Processor marked as the bus master for the data watchpoints
+// JPM   Oct./2026  Objects bus cycles counted for the main bus arbitration
+// JPM   Oct./2026  Scaled bitmap clipping without a zero scaled phrase width (found by the core fuzzing)
+// JPM   Oct./2026  Speculation accesses not recorded by the data watchpoints, off with a read watchpoint
+// JPM   Oct./2026  Write epochs check documented at the commit
 //
 
 #include "op.h"
 
 #include <stdlib.h>
 #include <string.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bus.h"
 #include "gpu.h"
+#include "hosttuning.h"
+#include "interrupt.h"
 #include "jaguar.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
 #include "memory.h"
+#include "settings.h"
 #include "tom.h"
+#include "watchpoint.h"
 #include "state.h"
 
 //#define OP_DEBUG
@@ -67,6 +83,7 @@ void DumpScaledObject(uint64_t p0, uint64_t p1, uint64_t p2);
 void DumpFixedObject(uint64_t p0, uint64_t p1);
 void DumpBitmapCore(uint64_t p0, uint64_t p1);
 uint64_t OPLoadPhrase(uint32_t offset);
+static void OPSpecStop(void);
 
 // Local global variables
 
@@ -88,6 +105,131 @@ static uint32_t op_pointer;
 
 int32_t phraseWidthToPixels[8] = { 64, 32, 16, 8, 4, 2, 0, 0 };
 
+// Object Processor speculation: the next halfline is rendered ahead by a
+// worker thread, on a copy of the TOM RAM, while the emulation goes on up to
+// it. The worker records the memory space pages it reads; at the halfline, the
+// rendering is committed if none of these pages has been written since the
+// launch, and if the TOM RAM is unchanged. Otherwise, or if the worker met
+// something it cannot do on its own (I/O read, HC, log), the halfline is
+// rendered again, serially. The object write-backs and the interrupts are
+// recorded by the worker, and done at the commit. The worker may read a page
+// while the emulation writes it; the page has then been written since the
+// launch, and the halfline is rendered again.
+#define OPSPEC_TOM_START	0x0008				// TOM RAM compared & committed, without MEMCON & HC/VC...
+#define OPSPEC_TOM_END		0x3000				// ...and the GPU RAM
+#define OPSPEC_TOM_MARGIN	0x1000				// For the line buffer writes out of the TOM RAM
+#define OPSPEC_GPU_IRQ		0xFFFFFFFF			// Event address of the GPU interrupt
+
+// Object write-back, or GPU interrupt, in the order of the object list
+struct OPSpecEvent
+{
+	uint32_t offset;							// Address written by the OP
+	uint32_t address;							// Memory space address (RAM mirror removed)
+	uint64_t phrase;
+};
+
+struct OPSpecJob
+{
+	int halfline;
+	uint64_t epoch;								// Memory space pages write epoch at the launch
+	bool unsafe;								// Must be rendered serially
+	bool stopIRQ;								// Stop object with the interrupt flag
+	uint32_t busCycles;							// Bus cycles of the objects, charged at the commit
+	std::vector<OPSpecEvent> events;
+	std::vector<uint32_t> pages;				// Memory space pages read
+	uint8_t pageRead[MEMORY_PAGES];
+	uint8_t pageStored[MEMORY_PAGES];
+	uint8_t tomSnapshot[0x4000];				// TOM RAM at the launch
+	uint8_t tomRam[OPSPEC_TOM_MARGIN + 0x4000 + OPSPEC_TOM_MARGIN];	// TOM RAM rendered by the worker
+};
+
+enum { OPSPEC_JOB_IDLE = 0, OPSPEC_JOB_QUEUED, OPSPEC_JOB_DONE, OPSPEC_JOB_QUIT };
+
+static OPSpecJob * opSpecJob = NULL;
+static thread_local OPSpecJob * opSpec = NULL;	// Set in the worker thread only
+static thread_local uint32_t opBusCycles = 0;		// Bus cycles of the objects processed, taken by the halfline
+static std::thread opSpecThread;
+static std::mutex opSpecMutex;
+static std::condition_variable opSpecWakeUp;
+static uint32_t opSpecState = OPSPEC_JOB_IDLE;
+static OPSpecStats opSpecStats;
+
+// The worker can't log, the log order would change
+#define OPLog(...)	do { if (!opSpec) WriteLog(__VA_ARGS__); else if (LogGet()) opSpec->unsafe = true; } while (0)
+
+
+//
+// TOM RAM used by the OP: the worker one, or TOM's
+//
+static inline uint8_t * OPTomRam(void)
+{
+	return (opSpec ? &opSpec->tomRam[OPSPEC_TOM_MARGIN] : tomRam8);
+}
+
+
+//
+// Memory space byte read by the worker, with the write-backs already done
+//
+static uint8_t OPSpecReadByte(uint32_t offset)
+{
+	uint32_t address = offset & 0xFFFFFF;
+
+	// RAM (mirrored), ROM and BIOS only, the rest are I/O
+	if (address < 0x800000)
+	{
+		address &= (vjs.DRAM_size - 1);
+	}
+	else if (!(address < 0xDFFF00) && !((address >= 0xE00000) && (address < 0xE40000)))
+	{
+		opSpec->unsafe = true;
+		return 0;
+	}
+
+	uint32_t page = address >> MEMORY_PAGE_SHIFT;
+
+	if (!opSpec->pageRead[page])
+	{
+		opSpec->pageRead[page] = 1;
+		opSpec->pages.push_back(page);
+	}
+
+	if (opSpec->pageStored[page])
+	{
+		for (size_t i = opSpec->events.size(); i-- > 0;)
+		{
+			OPSpecEvent & event = opSpec->events[i];
+
+			if ((event.address != OPSPEC_GPU_IRQ) && (address >= event.address) && (address < (event.address + 8)))
+			{
+				return (uint8_t)(event.phrase >> ((7 - (address - event.address)) * 8));
+			}
+		}
+	}
+
+	return jagMemSpace[address];
+}
+
+
+static inline uint32_t OPReadLong(uint32_t offset)
+{
+	if (!opSpec)
+	{
+		return JaguarReadLong(offset, OP);
+	}
+
+	return ((uint32_t)OPSpecReadByte(offset) << 24) | ((uint32_t)OPSpecReadByte(offset + 1) << 16)
+		| ((uint32_t)OPSpecReadByte(offset + 2) << 8) | (uint32_t)OPSpecReadByte(offset + 3);
+}
+
+
+//
+// Bitmap data phrase
+//
+static inline uint64_t OPLoadPixels(uint32_t offset)
+{
+	return ((uint64_t)OPReadLong(offset) << 32) | OPReadLong(offset + 4);
+}
+
 
 //
 // Object Processor initialization
@@ -142,6 +284,7 @@ void OPInit(void)
 void OPReset(void)
 {
 //	memset(objectp_ram, 0x00, 0x40);
+	OPSpecCancel();
 	objectp_running = 0;
 }
 
@@ -159,6 +302,7 @@ static uint32_t numberOfObjects;
 size_t op_dump(FILE *fp)
 {
 	size_t total_dumped = 0;
+	OPSpecCancel();
 
 	DUMPARR32(object);
 	DUMP32(numberOfObjects);
@@ -171,6 +315,7 @@ size_t op_dump(FILE *fp)
 size_t op_load(FILE *fp)
 {
 	size_t total_loaded = 0;
+	OPSpecCancel();
 
 	LOADARR32(object);
 	LOAD32(numberOfObjects);
@@ -190,6 +335,8 @@ void OPDone(void)
 //	const char * ccType[8] =
 //		{ "\"==\"", "\"<\"", "\">\"", "(opflag set)", "(second half line)", "?", "?", "?" };
 
+	OPSpecStop();
+
 	uint32_t olp = OPGetListPointer();
 	WriteLog("\nOP: OLP = $%08X\n", olp);
 	WriteLog("OP: Phrase dump\n    ----------\n");
@@ -364,6 +511,8 @@ WriteLog("OP: Setting hi list pointer: %04X\n", data);//*/
 
 uint32_t OPGetListPointer(void)
 {
+	uint8_t * tomRam8 = OPTomRam();
+
 	// Note: This register is LO / HI WORD, hence the funky look of this...
 	return GET16(tomRam8, 0x20) | (GET16(tomRam8, 0x22) << 16);
 }
@@ -373,6 +522,8 @@ uint32_t OPGetListPointer(void)
 
 uint32_t OPGetStatusRegister(void)
 {
+	uint8_t * tomRam8 = OPTomRam();
+
 	return GET16(tomRam8, 0x26);
 }
 
@@ -388,6 +539,8 @@ void OPSetStatusRegister(uint32_t data)
 
 void OPSetCurrentObject(uint64_t object)
 {
+	uint8_t * tomRam8 = OPTomRam();
+
 //Not sure this is right... Wouldn't it just be stored 64 bit BE?
 	// Stored as least significant 32 bits first, ms32 last in big endian
 /*	objectp_ram[0x13] = object & 0xFF; object >>= 8;
@@ -415,15 +568,310 @@ void OPSetCurrentObject(uint64_t object)
 uint64_t OPLoadPhrase(uint32_t offset)
 {
 	offset &= ~0x07;						// 8 byte alignment
-	return ((uint64_t)JaguarReadLong(offset, OP) << 32) | (uint64_t)JaguarReadLong(offset+4, OP);
+	return ((uint64_t)OPReadLong(offset) << 32) | (uint64_t)OPReadLong(offset+4);
 }
 
 
 void OPStorePhrase(uint32_t offset, uint64_t p)
 {
 	offset &= ~0x07;						// 8 byte alignment
+
+	// The worker records the write-backs in RAM, they are done at the commit
+	if (opSpec)
+	{
+		uint32_t address = offset & 0xFFFFFF;
+
+		if (address < 0x800000)
+		{
+			OPSpecEvent event = { offset, (address & (uint32_t)(vjs.DRAM_size - 1)), p };
+			opSpec->events.push_back(event);
+			opSpec->pageStored[event.address >> MEMORY_PAGE_SHIFT] = 1;
+		}
+		else
+		{
+			opSpec->unsafe = true;
+		}
+
+		return;
+	}
+
+	uint32_t master = watchpointMaster;
+	watchpointMaster = OP;
+	opBusCycles += BUS_PAGE_MISS;
 	JaguarWriteLong(offset, p >> 32, OP);
 	JaguarWriteLong(offset + 4, p & 0xFFFFFFFF, OP);
+	watchpointMaster = master;
+}
+
+
+//
+// Bus cycles of the objects processed since the last call, for the main bus arbitration
+//
+uint32_t OPTakeBusCycles(void)
+{
+	uint32_t cycles = opBusCycles;
+	opBusCycles = 0;
+	return cycles;
+}
+
+
+//
+// Object Processor speculation worker thread
+//
+static void OPSpecWorker(void)
+{
+	HostTuningApplyThread(HOST_THREAD_WORKER);
+	opSpec = opSpecJob;
+	watchpointMaster = WATCHPOINT_UNWATCHED;
+	std::unique_lock<std::mutex> lock(opSpecMutex);
+
+	while (true)
+	{
+		opSpecWakeUp.wait(lock, [] { return ((opSpecState == OPSPEC_JOB_QUEUED) || (opSpecState == OPSPEC_JOB_QUIT)); });
+
+		if (opSpecState == OPSPEC_JOB_QUIT)
+		{
+			break;
+		}
+
+		lock.unlock();
+
+		// Previous job records cleared
+		for (size_t i = 0; i < opSpec->pages.size(); i++)
+		{
+			opSpec->pageRead[opSpec->pages[i]] = 0;
+		}
+
+		for (size_t i = 0; i < opSpec->events.size(); i++)
+		{
+			if (opSpec->events[i].address != OPSPEC_GPU_IRQ)
+			{
+				opSpec->pageStored[opSpec->events[i].address >> MEMORY_PAGE_SHIFT] = 0;
+			}
+		}
+
+		opSpec->pages.clear();
+		opSpec->events.clear();
+		opSpec->unsafe = opSpec->stopIRQ = false;
+
+		memcpy(&opSpec->tomRam[OPSPEC_TOM_MARGIN], opSpec->tomSnapshot, 0x4000);
+		TOMClearLineBuffer(&opSpec->tomRam[OPSPEC_TOM_MARGIN]);
+		opBusCycles = 0;
+		OPProcessList(opSpec->halfline, true);
+		opSpec->busCycles = opBusCycles;
+
+		lock.lock();
+		opSpecState = OPSPEC_JOB_DONE;
+		opSpecWakeUp.notify_all();
+	}
+}
+
+
+//
+// Wait for the worker, and take back its job
+// Returns true if there was a job
+//
+static bool OPSpecTakeJob(void)
+{
+	std::unique_lock<std::mutex> lock(opSpecMutex);
+	opSpecWakeUp.wait(lock, [] { return (opSpecState != OPSPEC_JOB_QUEUED); });
+
+	if (opSpecState != OPSPEC_JOB_DONE)
+	{
+		return false;
+	}
+
+	opSpecState = OPSPEC_JOB_IDLE;
+	return true;
+}
+
+
+//
+// Render the halfline ahead, on the worker thread
+//
+void OPSpecLaunch(int halfline)
+{
+	extern int op_start_log, start_logging;
+	extern bool interactiveMode;
+
+	// A job not committed is dropped
+	if (opSpecJob && OPSpecTakeJob())
+	{
+		opSpecStats.discarded++;
+	}
+
+	// The debug logs & the interactive mode stay on the emulation thread, the OP reads are watched on it
+	if ((vjs.opSpeculation == OPSPEC_OFF) || op_start_log || start_logging || interactiveMode || WatchpointReadWatched())
+	{
+		return;
+	}
+
+	if (!opSpecJob)
+	{
+		opSpecJob = new OPSpecJob();
+		opSpecThread = std::thread(OPSpecWorker);
+	}
+
+	std::lock_guard<std::mutex> lock(opSpecMutex);
+	opSpecJob->halfline = halfline;
+	opSpecJob->epoch = MemoryNewEpoch();
+	memcpy(opSpecJob->tomSnapshot, tomRam8, 0x4000);
+	opSpecState = OPSPEC_JOB_QUEUED;
+	opSpecWakeUp.notify_all();
+}
+
+
+//
+// Verify mode: the halfline rendered serially must be the same
+//
+static bool OPSpecVerify(void)
+{
+	if (memcmp(&tomRam8[OPSPEC_TOM_START], &opSpecJob->tomRam[OPSPEC_TOM_MARGIN + OPSPEC_TOM_START], (OPSPEC_TOM_END - OPSPEC_TOM_START)))
+	{
+		return false;
+	}
+
+	// Only the last write-back at an address is in the memory
+	for (size_t i = 0; i < opSpecJob->events.size(); i++)
+	{
+		OPSpecEvent & event = opSpecJob->events[i];
+		bool last = (event.address != OPSPEC_GPU_IRQ);
+
+		for (size_t j = i + 1; last && (j < opSpecJob->events.size()); j++)
+		{
+			last = (opSpecJob->events[j].address != event.address);
+		}
+
+		if (last && (OPLoadPhrase(event.offset) != event.phrase))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//
+// Commit the halfline rendered ahead
+// Returns false if the halfline has to be rendered serially
+//
+bool OPSpecCommit(int halfline)
+{
+	if (!opSpecJob || !OPSpecTakeJob())
+	{
+		return false;
+	}
+
+	if (opSpecJob->halfline != halfline)
+	{
+		opSpecStats.discarded++;
+		return false;
+	}
+
+	if (opSpecJob->unsafe)
+	{
+		opSpecStats.unsafe++;
+		return false;
+	}
+
+	// Pages written, or TOM RAM changed, since the launch
+	// The source data is not copied for the worker (the bitmaps can cover the whole RAM), it reads the
+	// memory space live: a page the emulation writes meanwhile can be read torn, but the write has
+	// stamped the page with the launch epoch or a later one, on this thread, before this check. This
+	// holds as long as every write to the memory space marks its page: the bus functions do, the
+	// writes out of them (state load, file load, fuzzing) call MemoryPagesWritten.
+	bool conflict = (memcmp(&tomRam8[OPSPEC_TOM_START], &opSpecJob->tomSnapshot[OPSPEC_TOM_START], (OPSPEC_TOM_END - OPSPEC_TOM_START)) != 0);
+
+	for (size_t i = 0; !conflict && (i < opSpecJob->pages.size()); i++)
+	{
+		conflict = (memoryPageEpoch[opSpecJob->pages[i]] >= opSpecJob->epoch);
+	}
+
+	if (conflict)
+	{
+		opSpecStats.conflicts++;
+		return false;
+	}
+
+	if (vjs.opSpeculation == OPSPEC_VERIFY)
+	{
+		TOMClearLineBuffer(tomRam8);
+		OPProcessList(halfline, true);
+		opSpecStats.verified++;
+
+		if (!OPSpecVerify())
+		{
+			opSpecStats.mismatches++;
+			WriteLog("OP: Halfline %i rendered ahead is not the same as the serial one\n", halfline);
+		}
+
+		return true;
+	}
+
+	memcpy(&tomRam8[OPSPEC_TOM_START], &opSpecJob->tomRam[OPSPEC_TOM_MARGIN + OPSPEC_TOM_START], (OPSPEC_TOM_END - OPSPEC_TOM_START));
+	opBusCycles += opSpecJob->busCycles;
+
+	for (size_t i = 0; i < opSpecJob->events.size(); i++)
+	{
+		if (opSpecJob->events[i].address == OPSPEC_GPU_IRQ)
+		{
+			GPUSetIRQLine(3, ASSERT_LINE);
+		}
+		else
+		{
+			OPStorePhrase(opSpecJob->events[i].offset, opSpecJob->events[i].phrase);
+		}
+	}
+
+	if (opSpecJob->stopIRQ)
+	{
+		InterruptTOMRequest(IRQ_OPFLAG);
+	}
+
+	opSpecStats.committed++;
+	return true;
+}
+
+
+//
+// Drop the halfline rendered ahead (reset, state load...)
+//
+void OPSpecCancel(void)
+{
+	if (opSpecJob && OPSpecTakeJob())
+	{
+		opSpecStats.discarded++;
+	}
+}
+
+
+void OPSpecGetStats(OPSpecStats * stats)
+{
+	*stats = opSpecStats;
+}
+
+
+//
+// Stop the worker thread
+//
+static void OPSpecStop(void)
+{
+	if (!opSpecJob)
+	{
+		return;
+	}
+
+	OPSpecCancel();
+	{
+		std::lock_guard<std::mutex> lock(opSpecMutex);
+		opSpecState = OPSPEC_JOB_QUIT;
+		opSpecWakeUp.notify_all();
+	}
+	opSpecThread.join();
+	delete opSpecJob;
+	opSpecJob = NULL;
+	opSpecState = OPSPEC_JOB_IDLE;
 }
 
 
@@ -532,6 +980,7 @@ else
 //			return;
 
 		uint64_t p0 = OPLoadPhrase(op_pointer);
+		opBusCycles += BUS_PAGE_MISS;
 		op_pointer += 8;
 //WriteLog("\t%08X type %i\n", op_pointer, (uint8_t)p0 & 0x07);
 
@@ -644,6 +1093,7 @@ if (!inhibit)	// For OP testing only!
 				// Believe it or not, this is what the OP actually does...
 				// which is why they're required to be on a dphrase boundary!
 				uint64_t p1 = OPLoadPhrase(oldOPP | 0x08);
+				opBusCycles += BUS_PAGE_HIT + BusBurst(((p0 >> 43) & 0x1FFFFF) << 3, (p1 >> 28) & 0x3FF);
 //unneeded				op_pointer += 8;
 //WriteLog("OP: Writing halfline %d with ypos == %d...\n", halfline, ypos);
 //WriteLog("--> Writing %u BPP bitmap...\n", op_bitmap_bit_depth[(p1 >> 12) & 0x07]);
@@ -700,6 +1150,7 @@ if (!inhibit)	// For OP testing only!
 				// which is why they're required to be on a qphrase boundary!
 				uint64_t p1 = OPLoadPhrase(oldOPP | 0x08);
 				uint64_t p2 = OPLoadPhrase(oldOPP | 0x10);
+				opBusCycles += (2 * BUS_PAGE_HIT) + BusBurst(((p0 >> 43) & 0x1FFFFF) << 3, (p1 >> 28) & 0x3FF);
 //unneeded				op_pointer += 16;
 				OPProcessScaledBitmap(p0, p1, p2, render);
 
@@ -828,7 +1279,14 @@ OP: Scaled bitmap 4x? 4bpp at 34,? hscale=80 fpix=0 data=000756E8 pitch 1 hflipp
 #warning "Need to fix OP GPU IRQ handling! !!! FIX !!!"
 #endif // _MSC_VER
 			OPSetCurrentObject(p0);
-			GPUSetIRQLine(3, ASSERT_LINE);
+
+			if (opSpec)
+			{
+				OPSpecEvent event = { 0, OPSPEC_GPU_IRQ, 0 };
+				opSpec->events.push_back(event);
+			}
+			else
+				GPUSetIRQLine(3, ASSERT_LINE);
 //Also, OP processing is suspended from this point until OBF (F00026) is written to...
 // !!! FIX !!!
 //Do something like:
@@ -864,13 +1322,15 @@ OP: Scaled bitmap 4x? 4bpp at 34,? hscale=80 fpix=0 data=000756E8 pitch 1 hflipp
 					op_pointer = link;
 				break;
 			case CONDITION_SECOND_HALF_LINE:
-				// Branch if bit 10 of HC is set...
-				if (TOMGetHC() & 0x0400)
+				// Branch if bit 10 of HC is set... (not known by the worker)
+				if (opSpec)
+					opSpec->unsafe = true;
+				else if (TOMGetHC() & 0x0400)
 					op_pointer = link;
 				break;
 			default:
 				// Basically, if you do this, the OP does nothing. :-)
-				WriteLog("OP: Unimplemented branch condition %i\n", cc);
+				OPLog("OP: Unimplemented branch condition %i\n", cc);
 				break;
 			}
 			break;
@@ -879,17 +1339,17 @@ OP: Scaled bitmap 4x? 4bpp at 34,? hscale=80 fpix=0 data=000756E8 pitch 1 hflipp
 		{
 			OPSetCurrentObject(p0);
 
-			if ((p0 & 0x08) && TOMIRQEnabled(IRQ_OPFLAG))
-			{
-				TOMSetPendingObjectInt();
-				m68k_set_irq(2);		// Cause a 68K IPL 2 to occur...
-			}
+			// The interrupt enable is checked at the commit
+			if (opSpec)
+				opSpec->stopIRQ = ((p0 & 0x08) != 0);
+			else if (p0 & 0x08)
+				InterruptTOMRequest(IRQ_OPFLAG);		// Cause a 68K IPL 2 to occur...
 
 			// Bail out, we're done...
 			return;
 		}
 		default:
-			WriteLog("OP: Unknown object type %i\n", (uint8_t)p0 & 0x07);
+			OPLog("OP: Unknown object type %i\n", (uint8_t)p0 & 0x07);
 			break;
 		}
 
@@ -906,6 +1366,10 @@ OP: Scaled bitmap 4x? 4bpp at 34,? hscale=80 fpix=0 data=000756E8 pitch 1 hflipp
 
 		if (!opCyclesToRun)
 			return;
+
+		// The worker rendering will not be committed
+		if (opSpec && opSpec->unsafe)
+			return;
 	}
 	while (op_pointer);
 }
@@ -942,7 +1406,7 @@ void OPProcessFixedBitmap(uint64_t p0, uint64_t p1, bool render)
 	pitch <<= 3;							// Optimization: Multiply pitch by 8
 
 //	int16_t scanlineWidth = tom_getVideoModeWidth();
-	uint8_t * tomRam8 = TOMGetRamPointer();
+	uint8_t * tomRam8 = OPTomRam();
 	uint8_t * paletteRAM = &tomRam8[0x400];
 	// This is OK as long as it's used correctly: For 16-bit RAM to RAM direct
 	// copies--NOT for use when using endian-corrected data (i.e., any of the
@@ -1053,7 +1517,7 @@ if (depth == 5)	// i.e., 24bpp mode...
 //		rightMargin = lbufWidth;
 */
 if (depth > 5)
-	WriteLog("OP: We're about to encounter a divide by zero error!\n");
+	OPLog("OP: We're about to encounter a divide by zero error!\n");
 	// NOTE: We're just using endPos to figure out how much, if any, to clip by.
 	// ALSO: There may be another case where we start out of bounds and end out
 	// of bounds...!
@@ -1116,7 +1580,7 @@ if (depth > 5)
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		// Fetch 1st phrase...
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 //Note that firstPix should only be honored *if* we start with the 1st phrase of the bitmap
 //i.e., we didn't clip on the margin... !!! FIX !!!
 		pixels <<= firstPix;						// Skip first N pixels (N=firstPix)...
@@ -1154,13 +1618,13 @@ if (depth > 5)
 			i = 0;
 			// Fetch next phrase...
 			data += pitch;
-			pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			pixels = OPLoadPixels(data);
 		}
 	}
 	else if (depth == 1)							// 2 BPP
 	{
 if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 2 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
+	OPLog("OP: Fixed bitmap @ 2 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
 		index &= 0xFC;								// Top six bits form CLUT index
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
@@ -1168,7 +1632,7 @@ if (firstPix)
 		while (iwidth--)
 		{
 			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			uint64_t pixels = OPLoadPixels(data);
 			data += pitch;
 
 			for(int i=0; i<32; i++)
@@ -1204,7 +1668,7 @@ if (firstPix)
 	else if (depth == 2)							// 4 BPP
 	{
 if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 4 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
+	OPLog("OP: Fixed bitmap @ 4 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
 		index &= 0xF0;								// Top four bits form CLUT index
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
@@ -1212,7 +1676,7 @@ if (firstPix)
 		while (iwidth--)
 		{
 			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			uint64_t pixels = OPLoadPixels(data);
 			data += pitch;
 
 			for(int i=0; i<16; i++)
@@ -1251,7 +1715,7 @@ if (firstPix)
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		// Fetch 1st phrase...
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 //Note that firstPix should only be honored *if* we start with the 1st phrase of the bitmap
 //i.e., we didn't clip on the margin... !!! FIX !!!
 		firstPix &= 0x30;							// Only top two bits are valid for 8 BPP
@@ -1294,20 +1758,20 @@ if (firstPix)
 			i = 0;
 			// Fetch next phrase...
 			data += pitch;
-			pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			pixels = OPLoadPixels(data);
 		}
 	}
 	else if (depth == 4)							// 16 BPP
 	{
 if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 16 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
+	OPLog("OP: Fixed bitmap @ 16 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		while (iwidth--)
 		{
 			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			uint64_t pixels = OPLoadPixels(data);
 			data += pitch;
 
 			for(int i=0; i<4; i++)
@@ -1347,7 +1811,7 @@ if (firstPix)
 //There *might* be others...
 //WriteLog("OP: Writing 24 BPP bitmap!\n");
 if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 24 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
+	OPLog("OP: Fixed bitmap @ 24 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
 		// Not sure, but I think RMW only works with 16 BPP and below, and only in CRY mode...
 		// The LSB of flags is OPFLAG_REFLECT, so sign extend it and OR 4 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 4) | 0x04;
@@ -1355,7 +1819,7 @@ if (firstPix)
 		while (iwidth--)
 		{
 			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			uint64_t pixels = OPLoadPixels(data);
 			data += pitch;
 
 			for(int i=0; i<2; i++)
@@ -1397,7 +1861,7 @@ void OPProcessScaledBitmap(uint64_t p0, uint64_t p1, uint64_t p2, bool render)
 	uint32_t firstPix = (p1 >> 49) & 0x3F;
 //This is WEIRD! I'm sure I saw Atari Karts request 8 BPP FIRSTPIX! What happened???
 if (firstPix)
-	WriteLog("OP: FIRSTPIX != 0! (Scaled BM)\n");
+	OPLog("OP: FIRSTPIX != 0! (Scaled BM)\n");
 //#endif
 // We can ignore the RELEASE (high order) bit for now--probably forever...!
 //	uint8_t flags = (p1 >> 45) & 0x0F;	// REFLECT, RMW, TRANS, RELEASE
@@ -1409,7 +1873,7 @@ if (firstPix)
 	uint8_t index = (p1 >> 37) & 0xFE;				// CLUT index offset (upper pix, 1-4 bpp)
 	uint32_t pitch = (p1 >> 15) & 0x07;				// Phrase pitch
 
-	uint8_t * tomRam8 = TOMGetRamPointer();
+	uint8_t * tomRam8 = OPTomRam();
 	uint8_t * paletteRAM = &tomRam8[0x400];
 	// This is OK as long as it's used correctly: For 16-bit RAM to RAM direct
 	// copies--NOT for use when using endian-corrected data (i.e., any of the
@@ -1429,7 +1893,8 @@ if (firstPix)
 //		iwidth, op_bitmap_bit_depth[bitdepth], xpos, ptr, pitch, (flags&OPFLAG_REFLECT ? "yes" : "no"), (flags&OPFLAG_RMW ? "yes" : "no"), (flags&OPFLAG_TRANS ? "yes" : "no"));
 
 // Looks like an hscale of zero means don't draw!
-	if (!render || iwidth == 0 || hscale == 0)
+// The depths 6 & 7 have no pixels in a phrase, and would also give a zero scaled phrase width
+	if (!render || iwidth == 0 || hscale == 0 || phraseWidthToPixels[depth] == 0)
 		return;
 
 /*extern int start_logging;
@@ -1510,6 +1975,10 @@ if (start_logging)
 	WriteLog("OP: [Scaled] We're about to encounter a divide by zero error!\n");
 	DumpScaledObject(p0, p1, p2);
 }//*/
+// A phrase scaled below one pixel is clipped as a one pixel phrase
+	if (scaledPhrasePixels == 0)
+		scaledPhrasePixels = 1;
+
 //NOTE: I'm almost 100% sure that this is wrong... And it is! :-p
 
 //Try a simple example...
@@ -1611,12 +2080,12 @@ if (op_start_log && startPos == 13)
 	if (depth == 0)									// 1 BPP
 	{
 if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 1 BPP requesting FIRSTPIX!\n");
+	OPLog("OP: Scaled bitmap @ 1 BPP requesting FIRSTPIX!\n");
 		// The LSB of flags is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 
 		while ((int32_t)iwidth > 0)
 		{
@@ -1669,7 +2138,7 @@ wide, so we could probably go back to that (as long as we make it an int16_t and
 				int phrasesToSkip = pixCount / 64, pixelShift = pixCount % 64;
 
 				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+				pixels = OPLoadPixels(data);
 				pixels <<= 1 * pixelShift;
 				iwidth -= phrasesToSkip;
 				pixCount = pixelShift;
@@ -1679,13 +2148,13 @@ wide, so we could probably go back to that (as long as we make it an int16_t and
 	else if (depth == 1)							// 2 BPP
 	{
 if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 2 BPP requesting FIRSTPIX!\n");
+	OPLog("OP: Scaled bitmap @ 2 BPP requesting FIRSTPIX!\n");
 		index &= 0xFC;								// Top six bits form CLUT index
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 
 		while ((int32_t)iwidth > 0)
 		{
@@ -1733,7 +2202,7 @@ if (firstPix != 0)
 				int phrasesToSkip = pixCount / 32, pixelShift = pixCount % 32;
 
 				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+				pixels = OPLoadPixels(data);
 				pixels <<= 2 * pixelShift;
 				iwidth -= phrasesToSkip;
 				pixCount = pixelShift;
@@ -1743,13 +2212,13 @@ if (firstPix != 0)
 	else if (depth == 2)							// 4 BPP
 	{
 if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 4 BPP requesting FIRSTPIX!\n");
+	OPLog("OP: Scaled bitmap @ 4 BPP requesting FIRSTPIX!\n");
 		index &= 0xF0;								// Top four bits form CLUT index
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 
 		while ((int32_t)iwidth > 0)
 		{
@@ -1797,7 +2266,7 @@ if (firstPix != 0)
 				int phrasesToSkip = pixCount / 16, pixelShift = pixCount % 16;
 
 				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+				pixels = OPLoadPixels(data);
 				pixels <<= 4 * pixelShift;
 				iwidth -= phrasesToSkip;
 				pixCount = pixelShift;
@@ -1807,12 +2276,12 @@ if (firstPix != 0)
 	else if (depth == 3)							// 8 BPP
 	{
 if (firstPix)
-	WriteLog("OP: Scaled bitmap @ 8 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
+	OPLog("OP: Scaled bitmap @ 8 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 
 		while ((int32_t)iwidth > 0)
 		{
@@ -1857,7 +2326,7 @@ if (firstPix)
 				int phrasesToSkip = pixCount / 8, pixelShift = pixCount % 8;
 
 				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+				pixels = OPLoadPixels(data);
 				pixels <<= 8 * pixelShift;
 				iwidth -= phrasesToSkip;
 				pixCount = pixelShift;
@@ -1867,12 +2336,12 @@ if (firstPix)
 	else if (depth == 4)							// 16 BPP
 	{
 if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 16 BPP requesting FIRSTPIX!\n");
+	OPLog("OP: Scaled bitmap @ 16 BPP requesting FIRSTPIX!\n");
 		// The LSB is OPFLAG_REFLECT, so sign extend it and OR 2 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
 
 		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+		uint64_t pixels = OPLoadPixels(data);
 
 		while ((int32_t)iwidth > 0)
 		{
@@ -1918,7 +2387,7 @@ if (firstPix != 0)
 				int phrasesToSkip = pixCount / 4, pixelShift = pixCount % 4;
 
 				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+				pixels = OPLoadPixels(data);
 				pixels <<= 16 * pixelShift;
 
 				iwidth -= phrasesToSkip;
@@ -1930,9 +2399,9 @@ if (firstPix != 0)
 	else if (depth == 5)							// 24 BPP
 	{
 //I'm not sure that you can scale a 24 BPP bitmap properly--the JTRM seem to indicate as much.
-WriteLog("OP: Writing 24 BPP scaled bitmap!\n");
+OPLog("OP: Writing 24 BPP scaled bitmap!\n");
 if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 24 BPP requesting FIRSTPIX!\n");
+	OPLog("OP: Scaled bitmap @ 24 BPP requesting FIRSTPIX!\n");
 		// Not sure, but I think RMW only works with 16 BPP and below, and only in CRY mode...
 		// The LSB is OPFLAG_REFLECT, so sign extend it and or 4 into it.
 		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 4) | 0x04;
@@ -1940,7 +2409,7 @@ if (firstPix != 0)
 		while (iwidth--)
 		{
 			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+			uint64_t pixels = OPLoadPixels(data);
 			data += pitch << 3;						// Multiply pitch * 8 (optimize: precompute this value)
 
 			for(int i=0; i<2; i++)
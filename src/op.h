@@ -18,6 +18,23 @@ uint32_t OPGetListPointer(void);
 void OPSetStatusRegister(uint32_t data);
 uint32_t OPGetStatusRegister(void);
 void OPSetCurrentObject(uint64_t object);
+uint32_t OPTakeBusCycles(void);
+
+// Object Processor speculation, the next halfline rendered ahead on a worker thread
+struct OPSpecStats
+{
+	uint32_t committed;							// Halflines rendered ahead, and committed
+	uint32_t conflicts;							// Memory space pages or TOM RAM written since the launch
+	uint32_t unsafe;							// I/O read, HC or log met by the worker
+	uint32_t discarded;							// Not committed (reset, state, halfline out of order)
+	uint32_t verified;							// Verify mode: compared with the serial rendering...
+	uint32_t mismatches;						// ...and not the same
+};
+
+void OPSpecLaunch(int halfline);
+bool OPSpecCommit(int halfline);
+void OPSpecCancel(void);
+void OPSpecGetStats(OPSpecStats * stats);
 
 #define OPFLAG_RELEASE		8					// Bus release bit
 #define OPFLAG_TRANS		4					// Transparency bit
@@ -0,0 +1,254 @@
+//
+// Per opcode execution histograms
+//
+// The 68K dispatch counts each of the 65536 opcodes, and the GPU & DSP
+// dispatches count their 64 opcodes, with the cycles charged by the opcodes.
+// The 68K opcodes are gathered by their handler, so a line is an instruction
+// variant with its size & addressing modes. The tables are dumped sorted by
+// cycles in CSV files, and can be exported as a sample profile for the
+// profile guided optimisation of the core build.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "opcodestats.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "dsp.h"
+#include "gpu.h"
+#include "log.h"
+#include "m68000/m68kinterface.h"
+#include "settings.h"
+
+#ifdef OPCODE_STATS
+OpcodeStats gpuOpcodeStats[64];
+OpcodeStats dspOpcodeStats[65];
+
+
+//
+// Gather the 68K opcodes by handler
+// Returns the handlers opcodes sorted by cycles
+//
+static std::vector<uint32_t> OpcodeStatsM68K(std::vector<OpcodeStats> & stats)
+{
+	std::vector<uint32_t> handlers;
+	const char * mnemonic, * size, * smode, * dmode;
+	uint32_t handler;
+
+	stats.assign(65536, OpcodeStats());
+
+	for (uint32_t opcode = 0; opcode < 65536; opcode++)
+	{
+		if (m68kOpcodeCount[opcode] && m68k_opcode_variant(opcode, &handler, &mnemonic, &size, &smode, &dmode))
+		{
+			if (!stats[handler].count)
+			{
+				handlers.push_back(handler);
+			}
+
+			stats[handler].count += m68kOpcodeCount[opcode];
+			stats[handler].cycles += m68kOpcodeCycles[opcode];
+		}
+	}
+
+	std::sort(handlers.begin(), handlers.end(), [&stats](uint32_t a, uint32_t b) { return (stats[a].cycles != stats[b].cycles) ? (stats[a].cycles > stats[b].cycles) : (stats[a].count > stats[b].count); });
+	return handlers;
+}
+
+
+//
+// Executed RISC opcodes sorted by cycles
+//
+static std::vector<uint32_t> OpcodeStatsRISC(const OpcodeStats * stats, uint32_t number)
+{
+	std::vector<uint32_t> opcodes;
+
+	for (uint32_t i = 0; i < number; i++)
+	{
+		if (stats[i].count)
+		{
+			opcodes.push_back(i);
+		}
+	}
+
+	std::sort(opcodes.begin(), opcodes.end(), [stats](uint32_t a, uint32_t b) { return (stats[a].cycles != stats[b].cycles) ? (stats[a].cycles > stats[b].cycles) : (stats[a].count > stats[b].count); });
+	return opcodes;
+}
+
+
+static uint64_t OpcodeStatsTotalCycles(const OpcodeStats * stats, const std::vector<uint32_t> & opcodes)
+{
+	uint64_t total = 0;
+
+	for (uint32_t i = 0; i < opcodes.size(); i++)
+	{
+		total += stats[opcodes[i]].cycles;
+	}
+
+	return (total ? total : 1);
+}
+
+
+static FILE * OpcodeStatsCreate(const char * prefix, const char * name)
+{
+	char path[1024];
+
+	snprintf(path, sizeof(path), "%s_%s.csv", prefix, name);
+	FILE * fp = fopen(path, "w");
+
+	if (!fp)
+	{
+		WriteLog("OPCODESTATS: Cannot create %s\n", path);
+	}
+
+	return fp;
+}
+
+
+static bool OpcodeStatsDumpRISC(const char * prefix, const char * name, const OpcodeStats * stats, uint32_t number, const char ** opcodeName)
+{
+	std::vector<uint32_t> opcodes = OpcodeStatsRISC(stats, number);
+	uint64_t total = OpcodeStatsTotalCycles(stats, opcodes);
+	FILE * fp = OpcodeStatsCreate(prefix, name);
+
+	if (!fp)
+	{
+		return false;
+	}
+
+	fprintf(fp, "opcode,name,count,cycles,cycles_percent\n");
+
+	for (uint32_t i = 0; i < opcodes.size(); i++)
+	{
+		const OpcodeStats & s = stats[opcodes[i]];
+		fprintf(fp, "%u,%s,%llu,%llu,%.3f\n", opcodes[i], opcodeName[opcodes[i]], (unsigned long long)s.count, (unsigned long long)s.cycles, (s.cycles * 100.0) / total);
+	}
+
+	fclose(fp);
+	return true;
+}
+#endif
+
+
+//
+// Clear the histograms
+//
+void OpcodeStatsReset(void)
+{
+#ifdef OPCODE_STATS
+	memset(m68kOpcodeCount, 0, sizeof(m68kOpcodeCount));
+	memset(m68kOpcodeCycles, 0, sizeof(m68kOpcodeCycles));
+	memset(gpuOpcodeStats, 0, sizeof(gpuOpcodeStats));
+	memset(dspOpcodeStats, 0, sizeof(dspOpcodeStats));
+#endif
+}
+
+
+//
+// Dump the histograms sorted by cycles in <prefix>_m68k.csv, <prefix>_gpu.csv & <prefix>_dsp.csv
+//
+bool OpcodeStatsDumpCSV(const char * prefix)
+{
+#ifdef OPCODE_STATS
+	std::vector<OpcodeStats> stats;
+	std::vector<uint32_t> handlers = OpcodeStatsM68K(stats);
+	uint64_t total = OpcodeStatsTotalCycles(stats.data(), handlers);
+	const char * mnemonic, * size, * smode, * dmode;
+	uint32_t handler;
+	FILE * fp = OpcodeStatsCreate(prefix, "m68k");
+
+	if (!fp)
+	{
+		return false;
+	}
+
+	fprintf(fp, "opcode,mnemonic,size,source,destination,count,cycles,cycles_percent\n");
+
+	for (uint32_t i = 0; i < handlers.size(); i++)
+	{
+		const OpcodeStats & s = stats[handlers[i]];
+		m68k_opcode_variant(handlers[i], &handler, &mnemonic, &size, &smode, &dmode);
+		fprintf(fp, "$%04X,%s,%s,%s,%s,%llu,%llu,%.3f\n", handlers[i], mnemonic, size, smode, dmode, (unsigned long long)s.count, (unsigned long long)s.cycles, (s.cycles * 100.0) / total);
+	}
+
+	fclose(fp);
+
+	if (!OpcodeStatsDumpRISC(prefix, "gpu", gpuOpcodeStats, 64, gpu_opcode_str) || !OpcodeStatsDumpRISC(prefix, "dsp", dspOpcodeStats, 65, dsp_opcode_str))
+	{
+		return false;
+	}
+
+	WriteLog("OPCODESTATS: %u 68K opcode variants dumped in %s_m68k.csv\n", (uint32_t)handlers.size(), prefix);
+	return true;
+#else
+	(void)prefix;
+	WriteLog("OPCODESTATS: Opcode statistics are not compiled in (build with OPCODESTATS=1)\n");
+	return false;
+#endif
+}
+
+
+//
+// Export the histograms as a text sample profile (LLVM format), one entry per opcode handler
+// The RISC opcodes handlers are static C++ functions, hence their mangled names
+//
+bool OpcodeStatsExportProfile(const char * path)
+{
+#ifdef OPCODE_STATS
+	std::vector<OpcodeStats> stats;
+	std::vector<uint32_t> handlers = OpcodeStatsM68K(stats);
+	FILE * fp = fopen(path, "w");
+
+	if (!fp)
+	{
+		WriteLog("OPCODESTATS: Cannot create %s\n", path);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < handlers.size(); i++)
+	{
+		unsigned long long count = stats[handlers[i]].count;
+		fprintf(fp, "op_%x_5_ff:%llu:%llu\n 0: %llu\n", handlers[i], count, count, count);
+	}
+
+	std::vector<uint32_t> opcodes = OpcodeStatsRISC(gpuOpcodeStats, 64);
+
+	for (uint32_t i = 0; i < opcodes.size(); i++)
+	{
+		unsigned long long count = gpuOpcodeStats[opcodes[i]].count;
+		fprintf(fp, "_ZL%ugpu_opcode_%sv:%llu:%llu\n 0: %llu\n", (uint32_t)(strlen(gpu_opcode_str[opcodes[i]]) + 11), gpu_opcode_str[opcodes[i]], count, count, count);
+	}
+
+	// The pipelined DSP has its own opcodes handlers, named apart
+	opcodes = OpcodeStatsRISC(dspOpcodeStats, 64);
+
+	for (uint32_t i = 0; i < opcodes.size(); i++)
+	{
+		unsigned long long count = dspOpcodeStats[opcodes[i]].count;
+
+		if (vjs.usePipelinedDSP)
+		{
+			fprintf(fp, "_ZL%u%sv:%llu:%llu\n 0: %llu\n", (uint32_t)strlen(DSPOpcodeName[opcodes[i]]), DSPOpcodeName[opcodes[i]], count, count, count);
+		}
+		else
+		{
+			fprintf(fp, "_ZL%udsp_opcode_%sv:%llu:%llu\n 0: %llu\n", (uint32_t)(strlen(dsp_opcode_str[opcodes[i]]) + 11), dsp_opcode_str[opcodes[i]], count, count, count);
+		}
+	}
+
+	fclose(fp);
+	WriteLog("OPCODESTATS: Sample profile exported in %s\n", path);
+	return true;
+#else
+	(void)path;
+	WriteLog("OPCODESTATS: Opcode statistics are not compiled in (build with OPCODESTATS=1)\n");
+	return false;
+#endif
+}
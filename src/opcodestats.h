@@ -0,0 +1,33 @@
+//
+// opcodestats.h: Header file
+//
+// Per opcode execution histograms of the 68K, GPU & DSP
+// The counting is compiled in only with OPCODE_STATS defined (make OPCODESTATS=1)
+//
+
+#ifndef __OPCODESTATS_H__
+#define __OPCODESTATS_H__
+
+#include <stdint.h>
+
+struct OpcodeStats
+{
+	uint64_t count;
+	uint64_t cycles;
+};
+
+#ifdef OPCODE_STATS
+extern OpcodeStats gpuOpcodeStats[64];
+extern OpcodeStats dspOpcodeStats[65];
+
+// Count an executed opcode and its charged cycles
+#define OPCODE_STATS_ADD(stats, index, charged)	{ stats[index].count++; stats[index].cycles += (charged); }
+#else
+#define OPCODE_STATS_ADD(stats, index, charged)
+#endif
+
+extern void OpcodeStatsReset(void);
+extern bool OpcodeStatsDumpCSV(const char * prefix);
+extern bool OpcodeStatsExportProfile(const char * path);
+
+#endif	// __OPCODESTATS_H__
@@ -0,0 +1,768 @@
+//
+// Reverse debugger
+//
+// The emulation in the debugger is recorded as a timeline of operations, the
+// trace steps and the frames, and the machine state is checkpointed in memory
+// at the operations boundaries. A position in the timeline is a count of
+// executed 68K instructions: going to a position restores the nearest
+// checkpoint before it, and replays the operations up to it, the last one
+// being stopped at the instructions count. The checkpoints are taken after an
+// amount of measured emulation time, so a step backward stays within the
+// budget whatever the software. The checkpoints pages identical to the
+// previous checkpoint are shared, and the oldest checkpoints are dropped
+// above the memory limit.
+//
+// The replay is deterministic as long as the operations only depend on the
+// machine state: the joypads, the M68K halt and the memory breakpoint are
+// recorded with each operation, and the DSP is run along the recorded frames
+// instead of the audio thread. The changes made from the debugger windows are
+// not recorded. A live operation started back in the history discards the
+// operations after the position.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Checkpoint dropped when it cannot be loaded back, truncation without checkpoint
+// JPM   Oct./2026  Sanitizer allocations forgotten at a checkpoint restore
+//
+
+#include "reverse.h"
+
+#include <deque>
+#include <memory>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "dac.h"
+#include "frametiming.h"
+#include "jaguar.h"
+#include "joystick.h"
+#include "log.h"
+#include "sanitizer.h"
+#include "settings.h"
+#include "state.h"
+#include "m68000/m68kinterface.h"
+
+// Checkpoints pages size
+#define REVERSE_PAGE_SIZE		0x1000
+// Emulation time between two checkpoints & the restore of one (ns), a step backward stays under 50 ms
+#define REVERSE_STEP_BUDGET		40000000
+// Memory used by the checkpoints pages
+#define REVERSE_MEMORY_MAX		(512 * 1024 * 1024)
+
+// M68K opcodes families (see M68KGetCurrentOpcodeFamily)
+#define REVERSE_FAMILY_RTS		49
+#define REVERSE_FAMILY_JSR		52
+#define REVERSE_FAMILY_BSR		54
+
+// Positions scan conditions
+enum { REVERSE_SCAN_STACK = 0, REVERSE_SCAN_BREAKPOINT };
+
+struct ReverseOp
+{
+	uint32_t type;
+	uint32_t calls;							// Trace steps merged in the operation
+	uint64_t start, end;					// Instructions counts
+	bool haltStart, haltEnd;				// M68K halted at the start, and at the end count
+	bool bpmActive;
+	uint32_t bpmAddress;
+	uint8_t joypad0[21], joypad1[21];
+};
+
+typedef std::shared_ptr<std::vector<uint8_t> > ReversePage;
+
+struct ReverseCheckpoint
+{
+	size_t op;								// Operation following the checkpoint
+	uint64_t count;
+	size_t size;
+	std::vector<ReversePage> pages;
+};
+
+struct ReverseScanEntry
+{
+	uint64_t count;
+	uint32_t pc, a7;
+};
+
+static std::deque<ReverseOp> reverseOps;
+static std::deque<ReverseCheckpoint> reverseCheckpoints;
+static size_t reverseMemory = 0;
+static bool reverseRecording = false;
+static bool reverseReplaying = false;
+static bool reverseMerge = false;
+static uint64_t reverseOpTime = 0;
+static uint64_t reverseElapsed = 0;
+static uint64_t reverseRestoreTime = 0;
+
+// Position back in the history: operation where the replay has stopped, and its replayed part
+static bool reverseInHistory = false;
+static size_t reverseHistoryOp = 0;
+static bool reverseHistoryPartial = false;
+static ReverseOp reversePartialOp;
+
+// Positions scan during a replay
+static bool reverseScanning = false;
+static uint64_t reverseScanFrom = 0;
+static std::vector<ReverseScanEntry> reverseScan;
+
+
+//
+// Emulation time between two checkpoints, what is left of the budget after a restore
+//
+static uint64_t ReverseInterval(void)
+{
+	if (reverseRestoreTime >= ((REVERSE_STEP_BUDGET * 3) / 4))
+	{
+		return (REVERSE_STEP_BUDGET / 4);
+	}
+
+	return (REVERSE_STEP_BUDGET - reverseRestoreTime);
+}
+
+
+static void ReverseFreePages(const ReverseCheckpoint & checkpoint)
+{
+	for (size_t i = 0; i < checkpoint.pages.size(); i++)
+	{
+		if (checkpoint.pages[i].use_count() == 1)
+		{
+			reverseMemory -= checkpoint.pages[i]->size();
+		}
+	}
+}
+
+
+//
+// Drop the oldest checkpoint, and the operations which cannot be replayed anymore
+//
+static void ReverseDropOldest(void)
+{
+	ReverseFreePages(reverseCheckpoints.front());
+	reverseCheckpoints.pop_front();
+	size_t dropped = reverseCheckpoints.front().op;
+	reverseOps.erase(reverseOps.begin(), reverseOps.begin() + dropped);
+
+	for (size_t i = 0; i < reverseCheckpoints.size(); i++)
+	{
+		reverseCheckpoints[i].op -= dropped;
+	}
+}
+
+
+//
+// Checkpoint the machine state
+// The state is loaded back, as its dump is not exact (the events times are dumped as text),
+// so the execution goes on from the same state as a replay
+//
+static bool ReverseTakeCheckpoint(void)
+{
+	uint64_t start = FrameTimingNow();
+	size_t size;
+	uint8_t * buffer = StateDumpToMemory(&size);
+
+	if (!buffer)
+	{
+		WriteLog("REVERSE: Cannot checkpoint the machine state\n");
+		return false;
+	}
+
+	if (!StateLoadFromMemory(buffer, size))
+	{
+		WriteLog("REVERSE: Cannot load the checkpoint of the machine state back\n");
+		free(buffer);
+		return false;
+	}
+
+	ReverseCheckpoint checkpoint;
+	const ReverseCheckpoint * previous = (reverseCheckpoints.empty() ? NULL : &reverseCheckpoints.back());
+	checkpoint.op = reverseOps.size();
+	checkpoint.count = m68kInstructionCount;
+	checkpoint.size = size;
+
+	for (size_t offset = 0; offset < size; offset += REVERSE_PAGE_SIZE)
+	{
+		size_t length = ((size - offset) < REVERSE_PAGE_SIZE ? (size - offset) : REVERSE_PAGE_SIZE);
+		size_t index = offset / REVERSE_PAGE_SIZE;
+
+		// Pages identical to the previous checkpoint are shared
+		if (previous && (index < previous->pages.size()) && (previous->pages[index]->size() == length) && !memcmp(previous->pages[index]->data(), buffer + offset, length))
+		{
+			checkpoint.pages.push_back(previous->pages[index]);
+		}
+		else
+		{
+			checkpoint.pages.push_back(std::make_shared<std::vector<uint8_t> >(buffer + offset, buffer + offset + length));
+			reverseMemory += length;
+		}
+	}
+
+	free(buffer);
+	reverseCheckpoints.push_back(checkpoint);
+
+	while ((reverseMemory > REVERSE_MEMORY_MAX) && (reverseCheckpoints.size() > 1))
+	{
+		ReverseDropOldest();
+	}
+
+	// The capture costs more than a restore, so the budget is kept
+	reverseRestoreTime = FrameTimingNow() - start;
+	reverseElapsed = 0;
+	return true;
+}
+
+
+//
+// Restore a checkpoint
+//
+static bool ReverseRestore(const ReverseCheckpoint & checkpoint)
+{
+	std::vector<uint8_t> buffer;
+	buffer.reserve(checkpoint.size);
+
+	for (size_t i = 0; i < checkpoint.pages.size(); i++)
+	{
+		buffer.insert(buffer.end(), checkpoint.pages[i]->begin(), checkpoint.pages[i]->end());
+	}
+
+	if (!StateLoadFromMemory(buffer.data(), buffer.size()))
+	{
+		WriteLog("REVERSE: Cannot restore the checkpoint at instruction %llu\n", (unsigned long long)checkpoint.count);
+		return false;
+	}
+
+	m68kInstructionCount = checkpoint.count;
+	SanitizerForget();
+	return true;
+}
+
+
+//
+// Discard the operations after the position in the history, the live execution goes on from there
+//
+static void ReverseTruncate(void)
+{
+	reverseOps.resize(reverseHistoryOp);
+
+	if (reverseHistoryPartial)
+	{
+		reverseOps.push_back(reversePartialOp);
+	}
+
+	while (!reverseCheckpoints.empty() && (reverseCheckpoints.back().op > reverseHistoryOp))
+	{
+		ReverseFreePages(reverseCheckpoints.back());
+		reverseCheckpoints.pop_back();
+	}
+
+	reverseInHistory = false;
+	reverseMerge = false;
+}
+
+
+//
+// Execute a frame, with the DSP run for the frame time
+//
+static void ReverseFrame(void)
+{
+	JaguarExecuteNew();
+
+	if (vjs.DSPEnabled)
+	{
+		DACExecHeadless(vjs.hardwareTypeNTSC ? (48000 / 60) : (48000 / 50));
+	}
+}
+
+
+//
+// Replay an operation, up to the target instructions count
+// The replayed part of the operation is given back
+//
+static void ReverseReplayOp(const ReverseOp & op, uint64_t target, ReverseOp & replayed)
+{
+	bool full = (target >= op.end);
+	uint32_t calls = 0;
+
+	// Conditions at the start of the operation
+	if (op.haltStart)
+	{
+		M68KDebugHalt();
+	}
+	else
+	{
+		M68KDebugResume();
+	}
+
+	bpmActive = op.bpmActive;
+	bpmAddress1 = op.bpmAddress;
+	memcpy(joypad0Buttons, op.joypad0, sizeof(op.joypad0));
+	memcpy(joypad1Buttons, op.joypad1, sizeof(op.joypad1));
+	m68kHaltInstructionCount = (full ? (op.haltEnd ? op.end : UINT64_MAX) : target);
+
+	if (op.type == REVERSE_OP_STEP)
+	{
+		while ((calls < op.calls) && (full || (m68kInstructionCount < target)))
+		{
+			JaguarStepInto();
+			calls++;
+		}
+	}
+	else
+	{
+		ReverseFrame();
+	}
+
+	m68kHaltInstructionCount = UINT64_MAX;
+
+	if (full && (m68kInstructionCount != op.end))
+	{
+		WriteLog("REVERSE: Replay diverged, instruction %llu reached instead of %llu\n", (unsigned long long)m68kInstructionCount, (unsigned long long)op.end);
+	}
+
+	replayed = op;
+	replayed.calls = calls;
+	replayed.end = m68kInstructionCount;
+	replayed.haltEnd = (M68KDebugHaltStatus() != 0);
+}
+
+
+//
+// Restore a checkpoint and replay the operations up to the target instructions count (UINT64_MAX for the present)
+//
+static bool ReverseReplay(size_t index, uint64_t target)
+{
+	const ReverseCheckpoint & checkpoint = reverseCheckpoints[index];
+	bool tracing = startM68KTracing, bpm = bpmActive;
+	uint32_t bpmAddress = bpmAddress1;
+	uint8_t joypad0[21], joypad1[21];
+	size_t i = checkpoint.op;
+
+	memcpy(joypad0, joypad0Buttons, sizeof(joypad0));
+	memcpy(joypad1, joypad1Buttons, sizeof(joypad1));
+	reverseReplaying = true;
+	reverseHistoryPartial = false;
+
+	if (!ReverseRestore(checkpoint))
+	{
+		reverseReplaying = false;
+		return false;
+	}
+
+	// The breakpoints halts are replayed at their instructions counts, and the instructions are not traced in the log
+	startM68KTracing = false;
+
+	for (; (i < reverseOps.size()) && (m68kInstructionCount < target); i++)
+	{
+		if (reverseOps[i].end < target)
+		{
+			ReverseReplayOp(reverseOps[i], reverseOps[i].end, reversePartialOp);
+		}
+		else
+		{
+			ReverseReplayOp(reverseOps[i], target, reversePartialOp);
+			reverseHistoryPartial = true;
+			break;
+		}
+	}
+
+	reverseHistoryOp = i;
+	reverseInHistory = (target != UINT64_MAX);
+	reverseMerge = false;
+	reverseReplaying = false;
+
+	// Debugger conditions of the present, the M68K is stopped as after a halt
+	startM68KTracing = tracing;
+	bpmActive = bpm;
+	bpmAddress1 = bpmAddress;
+	memcpy(joypad0Buttons, joypad0, sizeof(joypad0));
+	memcpy(joypad1Buttons, joypad1, sizeof(joypad1));
+	M68KDebugResume();
+	return true;
+}
+
+
+//
+// Scan the positions of a checkpoint interval, the positions before the end count are kept
+//
+static bool ReverseScanInterval(size_t index, uint64_t from, uint64_t end)
+{
+	reverseScan.clear();
+	reverseScanFrom = from;
+	reverseScanning = true;
+	bool retVal = ReverseReplay(index, end);
+	reverseScanning = false;
+
+	while (!reverseScan.empty() && (reverseScan.back().count >= end))
+	{
+		reverseScan.pop_back();
+	}
+
+	return retVal;
+}
+
+
+static bool ReverseScanMatch(const ReverseScanEntry & entry, uint32_t condition, uint32_t a7)
+{
+	if (condition == REVERSE_SCAN_STACK)
+	{
+		return (entry.a7 >= a7);
+	}
+
+	return (m68k_brk_find(entry.pc) != 0);
+}
+
+
+//
+// Find the last position before the current one matching the condition
+// The history start is given if none matches
+//
+static uint64_t ReverseFindBackward(uint32_t condition, uint32_t a7)
+{
+	uint64_t current = m68kInstructionCount;
+	size_t index = reverseCheckpoints.size() - 1;
+
+	while ((index > 0) && (reverseCheckpoints[index].count >= current))
+	{
+		index--;
+	}
+
+	for (uint64_t end = current; ; index--)
+	{
+		if (!ReverseScanInterval(index, reverseCheckpoints[index].count, end))
+		{
+			break;
+		}
+
+		for (size_t i = reverseScan.size(); i > 0; i--)
+		{
+			if (ReverseScanMatch(reverseScan[i - 1], condition, a7))
+			{
+				return reverseScan[i - 1].count;
+			}
+		}
+
+		if (index == 0)
+		{
+			break;
+		}
+
+		end = reverseCheckpoints[index].count;
+	}
+
+	return reverseCheckpoints.front().count;
+}
+
+
+//
+// Find the first position after the one given matching the condition
+// The present is given if none matches
+//
+static uint64_t ReverseFindForward(uint64_t position, uint32_t condition, uint32_t a7)
+{
+	size_t index = reverseCheckpoints.size() - 1;
+
+	while ((index > 0) && (reverseCheckpoints[index].count > position))
+	{
+		index--;
+	}
+
+	for (; index < reverseCheckpoints.size(); index++)
+	{
+		uint64_t end = ((index + 1) < reverseCheckpoints.size() ? reverseCheckpoints[index + 1].count : UINT64_MAX);
+
+		if (!ReverseScanInterval(index, position + 1, end))
+		{
+			break;
+		}
+
+		for (size_t i = 0; i < reverseScan.size(); i++)
+		{
+			if (ReverseScanMatch(reverseScan[i], condition, a7))
+			{
+				return reverseScan[i].count;
+			}
+		}
+	}
+
+	return UINT64_MAX;
+}
+
+
+//
+// Positions scan, called before each M68K instruction
+// The instructions count is the position of the state before the instruction
+//
+void ReverseInstructionHook(void)
+{
+	if (reverseScanning && (m68kInstructionCount >= reverseScanFrom))
+	{
+		ReverseScanEntry entry = { m68kInstructionCount, m68k_get_reg(NULL, M68K_REG_PC), m68k_get_reg(NULL, M68K_REG_A7) };
+		reverseScan.push_back(entry);
+	}
+}
+
+
+//
+// Discard the history
+//
+void ReverseReset(void)
+{
+	reverseOps.clear();
+	reverseCheckpoints.clear();
+	reverseScan.clear();
+	reverseMemory = 0;
+	reverseElapsed = 0;
+	reverseInHistory = reverseHistoryPartial = reverseMerge = false;
+	m68kHaltInstructionCount = UINT64_MAX;
+}
+
+
+//
+// Start or stop the recording, the history starts with the next operation
+//
+void ReverseSetRecording(bool state)
+{
+	ReverseReset();
+	reverseRecording = state;
+	WriteLog("REVERSE: Recording %s\n", (state ? "started" : "stopped"));
+}
+
+
+bool ReverseIsRecording(void)
+{
+	return reverseRecording;
+}
+
+
+bool ReverseIsReplaying(void)
+{
+	return reverseReplaying;
+}
+
+
+bool ReverseIsInHistory(void)
+{
+	return (reverseRecording && reverseInHistory);
+}
+
+
+//
+// Start of a live operation
+// The consecutive trace steps are merged in one operation
+//
+void ReverseBeginOp(uint32_t type)
+{
+	if (!reverseRecording || reverseReplaying)
+	{
+		return;
+	}
+
+	if (reverseInHistory)
+	{
+		ReverseTruncate();
+	}
+
+	if ((reverseCheckpoints.empty() || (reverseElapsed >= ReverseInterval())) && ReverseTakeCheckpoint())
+	{
+		reverseMerge = false;
+	}
+
+	// Without checkpoint, there is nothing to replay from
+	if (reverseCheckpoints.empty())
+	{
+		return;
+	}
+
+	ReverseOp op;
+	memset(&op, 0, sizeof(op));
+	op.type = type;
+	op.calls = 1;
+	op.start = op.end = m68kInstructionCount;
+	op.haltStart = (M68KDebugHaltStatus() != 0);
+	op.bpmActive = bpmActive;
+	op.bpmAddress = bpmAddress1;
+	memcpy(op.joypad0, joypad0Buttons, sizeof(op.joypad0));
+	memcpy(op.joypad1, joypad1Buttons, sizeof(op.joypad1));
+
+	const ReverseOp * last = (reverseOps.empty() ? NULL : &reverseOps.back());
+	reverseMerge = (reverseMerge && (type == REVERSE_OP_STEP) && last && (last->type == REVERSE_OP_STEP) && !last->haltEnd && !op.haltStart
+		&& (last->end == op.start) && (last->bpmActive == op.bpmActive) && (last->bpmAddress == op.bpmAddress)
+		&& !memcmp(last->joypad0, op.joypad0, sizeof(op.joypad0)) && !memcmp(last->joypad1, op.joypad1, sizeof(op.joypad1)));
+
+	if (!reverseMerge)
+	{
+		reverseOps.push_back(op);
+	}
+
+	reverseOpTime = FrameTimingNow();
+}
+
+
+//
+// End of a live operation
+//
+void ReverseEndOp(void)
+{
+	if (!reverseRecording || reverseReplaying || reverseCheckpoints.empty() || reverseOps.empty())
+	{
+		return;
+	}
+
+	ReverseOp & op = reverseOps.back();
+
+	if (reverseMerge)
+	{
+		op.calls++;
+	}
+
+	op.end = m68kInstructionCount;
+	op.haltEnd = (M68KDebugHaltStatus() != 0);
+	reverseMerge = (op.type == REVERSE_OP_STEP);
+	reverseElapsed += FrameTimingNow() - reverseOpTime;
+}
+
+
+//
+// Execute a frame and record it
+// The DSP is run for the frame time, instead of the audio thread
+//
+void ReverseExecuteFrame(void)
+{
+	ReverseBeginOp(REVERSE_OP_FRAME);
+	ReverseFrame();
+	ReverseEndOp();
+}
+
+
+//
+// Go to a position of the history (instructions count)
+// A position after the history goes to the present
+//
+bool ReverseGoto(uint64_t position)
+{
+	if (!reverseRecording || reverseCheckpoints.empty())
+	{
+		return false;
+	}
+
+	uint64_t present = ReverseGetPresent();
+	size_t index = reverseCheckpoints.size() - 1;
+
+	if (position >= present)
+	{
+		return ReverseReplay(index, UINT64_MAX);
+	}
+
+	while ((index > 0) && (reverseCheckpoints[index].count > position))
+	{
+		index--;
+	}
+
+	if (reverseCheckpoints[index].count > position)
+	{
+		return false;
+	}
+
+	return ReverseReplay(index, position);
+}
+
+
+//
+// Step backward one instruction
+//
+bool ReverseStepInto(void)
+{
+	if (!reverseRecording || reverseCheckpoints.empty() || (m68kInstructionCount <= ReverseGetStart()))
+	{
+		return false;
+	}
+
+	return ReverseGoto(m68kInstructionCount - 1);
+}
+
+
+//
+// Step backward one instruction, or back to the call of the subroutine just returned from
+//
+bool ReverseStepOver(void)
+{
+	if (!reverseRecording || reverseCheckpoints.empty() || (m68kInstructionCount <= ReverseGetStart()))
+	{
+		return false;
+	}
+
+	if (M68KGetCurrentOpcodeFamily() != REVERSE_FAMILY_RTS)
+	{
+		return ReverseGoto(m68kInstructionCount - 1);
+	}
+
+	// The call is the last position with the stack as it is after the return
+	return ReverseGoto(ReverseFindBackward(REVERSE_SCAN_STACK, m68k_get_reg(NULL, M68K_REG_A7)));
+}
+
+
+//
+// Go back to the last position with an instruction at a breakpoint address
+// The history start is reached if there is none
+//
+bool ReverseContinue(void)
+{
+	if (!reverseRecording || reverseCheckpoints.empty() || (m68kInstructionCount <= ReverseGetStart()))
+	{
+		return false;
+	}
+
+	return ReverseGoto(ReverseFindBackward(REVERSE_SCAN_BREAKPOINT, 0));
+}
+
+
+//
+// Step forward in the history, by replay
+// Stepping over a subroutine call goes to the first position with the stack as it was before the call
+//
+bool ReverseStepForward(bool over)
+{
+	if (!ReverseIsInHistory())
+	{
+		return false;
+	}
+
+	uint64_t position = m68kInstructionCount + 1;
+	uint32_t a7 = m68k_get_reg(NULL, M68K_REG_A7);
+
+	if (!ReverseGoto(position))
+	{
+		return false;
+	}
+
+	int family = M68KGetCurrentOpcodeFamily();
+
+	if (over && ReverseIsInHistory() && ((family == REVERSE_FAMILY_JSR) || (family == REVERSE_FAMILY_BSR)) && (m68k_get_reg(NULL, M68K_REG_A7) < a7))
+	{
+		return ReverseGoto(ReverseFindForward(position, REVERSE_SCAN_STACK, a7));
+	}
+
+	return true;
+}
+
+
+//
+// History start & present, as instructions counts
+//
+uint64_t ReverseGetStart(void)
+{
+	return (reverseCheckpoints.empty() ? m68kInstructionCount : reverseCheckpoints.front().count);
+}
+
+
+uint64_t ReverseGetPresent(void)
+{
+	if (reverseCheckpoints.empty())
+	{
+		return m68kInstructionCount;
+	}
+
+	return (reverseOps.size() > reverseCheckpoints.back().op ? reverseOps.back().end : reverseCheckpoints.back().count);
+}
@@ -0,0 +1,32 @@
+//
+// reverse.h: Header file
+//
+// Reverse debugger of the 68K, with in-memory checkpoints and deterministic replay
+//
+
+#ifndef __REVERSE_H__
+#define __REVERSE_H__
+
+#include <stdint.h>
+
+// Recorded operations
+enum { REVERSE_OP_STEP = 0, REVERSE_OP_FRAME };
+
+extern void ReverseReset(void);
+extern void ReverseSetRecording(bool state);
+extern bool ReverseIsRecording(void);
+extern bool ReverseIsReplaying(void);
+extern bool ReverseIsInHistory(void);
+extern void ReverseBeginOp(uint32_t type);
+extern void ReverseEndOp(void);
+extern void ReverseExecuteFrame(void);
+extern void ReverseInstructionHook(void);
+extern bool ReverseGoto(uint64_t position);
+extern bool ReverseStepInto(void);
+extern bool ReverseStepOver(void);
+extern bool ReverseContinue(void);
+extern bool ReverseStepForward(bool over);
+extern uint64_t ReverseGetStart(void);
+extern uint64_t ReverseGetPresent(void);
+
+#endif	// __REVERSE_H__
@@ -0,0 +1,522 @@
+//
+// Guest memory writes sanitizer
+//
+// Each byte of the main RAM and of the GPU/DSP local RAM has a shadow byte.
+// The allocations are learned from the guest allocator: its entry points
+// (malloc, calloc, realloc & free, found in the symbols table by the caller)
+// are watched by the M68K instruction hook, the arguments are taken from the
+// stack at the entry, and the returned pointer from D0 at the return address.
+// From the heap base to the top of the RAM, the bytes are poisoned until they
+// are allocated, the stack from the SP is live. The writes of all the bus
+// masters are checked through the memory write hooks, the emulation costs
+// nothing as long as the sanitizer is off.
+//
+// A write to a freed allocation, out of the allocations, or below the stack
+// halts the M68K; the report gives the faulting master, its PC, the address,
+// and the owning allocation with its allocating call stack.
+//
+// The allocator is supposed to use the C calling convention, with 32-bit
+// arguments on the stack; its own writes, in the blocks headers, are not
+// checked.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Allocating call stacks taken from the stack unwinder
+// JPM   Oct./2026  Allocations out of the RAM ignored, allocations forgotten at a state load
+//
+
+#include "sanitizer.h"
+
+#include <map>
+#include <stdlib.h>
+#include <string.h>
+#include "dsp.h"
+#include "gpu.h"
+#include "jaguar.h"
+#include "log.h"
+#include "memory.h"
+#include "settings.h"
+#include "unwind.h"
+#include "m68000/m68kinterface.h"
+
+#define SANITIZER_GPU_RAM_BASE	0xF03000
+#define SANITIZER_GPU_RAM_SIZE	0x1000
+#define SANITIZER_DSP_RAM_SIZE	0x2000
+// Bytes below the SP still live: the M68K core can write a predecrement before updating the SP (MOVEM)
+#define SANITIZER_STACK_SLACK	64
+// Allocator calls in progress (the allocator can call itself)
+#define SANITIZER_CALLS_MAX		8
+
+// Allocator call in progress
+struct SanitizerCall
+{
+	uint32_t entry;
+	uint32_t returnAddress, sp;
+	uint32_t address, size;						// Arguments
+	uint32_t depth;
+	uint32_t callStack[SANITIZER_CALLSTACK_DEPTH];
+};
+
+bool sanitizerActive = false;
+static uint32_t sanitizerEntry[SANITIZER_ENTRIES];
+static uint32_t sanitizerHeapBase;
+static uint8_t * sanitizerShadow = NULL;
+static size_t sanitizerShadowSize;
+static uint8_t sanitizerShadowGPU[SANITIZER_GPU_RAM_SIZE];
+static uint8_t sanitizerShadowDSP[SANITIZER_DSP_RAM_SIZE];
+static std::map<uint32_t, SanitizerAllocation> sanitizerAllocations;
+static SanitizerCall sanitizerCalls[SANITIZER_CALLS_MAX];
+static uint32_t sanitizerCallsCount;
+static uint32_t sanitizerM68KPC;
+static bool sanitizerReportPending;
+static SanitizerReport sanitizerReport;
+
+const char * sanitizerShadowName[] = { "unchecked", "allocated", "freed", "poisoned" };
+
+// Private function prototypes
+
+static void SanitizerWriteHook(void * userData, uint32_t address, uint32_t value, uint32_t size, uint32_t who);
+
+
+//
+// Shadow byte of an address, NULL if the address has no shadow
+//
+static uint8_t * SanitizerShadow(uint32_t address)
+{
+	if (address < 0x800000)
+	{
+		address &= (vjs.DRAM_size - 1);
+		return ((address < sanitizerShadowSize) ? &sanitizerShadow[address] : NULL);
+	}
+	else if ((address >= SANITIZER_GPU_RAM_BASE) && (address < (SANITIZER_GPU_RAM_BASE + SANITIZER_GPU_RAM_SIZE)))
+	{
+		return &sanitizerShadowGPU[address - SANITIZER_GPU_RAM_BASE];
+	}
+	else if ((address >= DSP_WORK_RAM_BASE) && (address < (DSP_WORK_RAM_BASE + SANITIZER_DSP_RAM_SIZE)))
+	{
+		return &sanitizerShadowDSP[address - DSP_WORK_RAM_BASE];
+	}
+
+	return NULL;
+}
+
+
+//
+// Start the sanitizer on the allocator entry points
+// The heap base is required, an entry point can be missing (0)
+//
+bool SanitizerEnable(const uint32_t entry[SANITIZER_ENTRIES], uint32_t heapBase)
+{
+	SanitizerDisable();
+
+	if (!heapBase || (heapBase >= vjs.DRAM_size) || (!entry[SANITIZER_MALLOC] && !entry[SANITIZER_CALLOC] && !entry[SANITIZER_REALLOC]))
+	{
+		WriteLog("SANITIZER: No heap base or no allocation entry point, the sanitizer stays off\n");
+		return false;
+	}
+
+	memcpy(sanitizerEntry, entry, sizeof(sanitizerEntry));
+	sanitizerHeapBase = heapBase;
+
+	if (!HooksRegister(HOOK_MEMWRITE, SanitizerWriteHook, NULL))
+	{
+		return false;
+	}
+
+	sanitizerActive = true;
+	SanitizerReset();
+	WriteLog("SANITIZER: Started, heap base $%06X, malloc $%06X, calloc $%06X, realloc $%06X, free $%06X\n", heapBase, entry[SANITIZER_MALLOC], entry[SANITIZER_CALLOC], entry[SANITIZER_REALLOC], entry[SANITIZER_FREE]);
+	return true;
+}
+
+
+//
+// Stop the sanitizer
+//
+void SanitizerDisable(void)
+{
+	if (sanitizerActive)
+	{
+		HooksUnregister(HOOK_MEMWRITE, SanitizerWriteHook, NULL);
+		WriteLog("SANITIZER: Stopped\n");
+	}
+
+	sanitizerActive = false;
+	free(sanitizerShadow);
+	sanitizerShadow = NULL;
+	sanitizerShadowSize = 0;
+	sanitizerAllocations.clear();
+	sanitizerCallsCount = 0;
+	sanitizerReportPending = false;
+}
+
+
+//
+// Forget the allocations, the heap is poisoned back
+//
+void SanitizerReset(void)
+{
+	if (!sanitizerActive)
+	{
+		return;
+	}
+
+	if (sanitizerShadowSize != vjs.DRAM_size)
+	{
+		free(sanitizerShadow);
+
+		if (!(sanitizerShadow = (uint8_t *)malloc(vjs.DRAM_size)))
+		{
+			WriteLog("SANITIZER: Cannot allocate the shadow memory\n");
+			sanitizerShadowSize = 0;
+			SanitizerDisable();
+			return;
+		}
+
+		sanitizerShadowSize = vjs.DRAM_size;
+	}
+
+	memset(sanitizerShadow, SANITIZER_UNCHECKED, sanitizerHeapBase);
+	memset(&sanitizerShadow[sanitizerHeapBase], SANITIZER_POISONED, sanitizerShadowSize - sanitizerHeapBase);
+	memset(sanitizerShadowGPU, SANITIZER_UNCHECKED, sizeof(sanitizerShadowGPU));
+	memset(sanitizerShadowDSP, SANITIZER_UNCHECKED, sizeof(sanitizerShadowDSP));
+	sanitizerAllocations.clear();
+	sanitizerCallsCount = 0;
+	sanitizerReportPending = false;
+}
+
+
+//
+// Forget the allocations after a state load, or a reverse restore
+// The allocations made before are unknown, the heap is unchecked until allocated again
+//
+void SanitizerForget(void)
+{
+	if (!sanitizerActive)
+	{
+		return;
+	}
+
+	SanitizerReset();
+
+	if (sanitizerShadow)
+	{
+		memset(&sanitizerShadow[sanitizerHeapBase], SANITIZER_UNCHECKED, sanitizerShadowSize - sanitizerHeapBase);
+	}
+}
+
+
+//
+// Set the shadow bytes of a range (i.e. to poison a local RAM area)
+//
+void SanitizerPoison(uint32_t address, uint32_t size, uint8_t shadow)
+{
+	if (!sanitizerActive)
+	{
+		return;
+	}
+
+	for (uint8_t * s; size--; address++)
+	{
+		if ((s = SanitizerShadow(address)))
+		{
+			*s = shadow;
+		}
+	}
+}
+
+
+//
+// Get the violation report, if any since the previous call
+//
+bool SanitizerGetReport(SanitizerReport * report)
+{
+	if (!sanitizerReportPending)
+	{
+		return false;
+	}
+
+	*report = sanitizerReport;
+	sanitizerReportPending = false;
+	return true;
+}
+
+
+//
+// Main RAM long read, 0 out of the RAM
+//
+static uint32_t SanitizerReadLong(uint32_t address)
+{
+	return (((address + 4) <= vjs.DRAM_size) ? GET32(jaguarMainRAM, address) : 0);
+}
+
+
+//
+// Call stack from the allocator entry: the return address, then the unwound callers
+//
+static uint32_t SanitizerCallStack(uint32_t sp, uint32_t * callStack)
+{
+	UnwindFrame frames[SANITIZER_CALLSTACK_DEPTH];
+	uint32_t depth = UnwindStack(frames, SANITIZER_CALLSTACK_DEPTH);
+
+	if (!depth)
+	{
+		callStack[depth++] = SanitizerReadLong(sp);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < depth; i++)
+		{
+			callStack[i] = frames[i].returnAddress;
+		}
+	}
+
+	return depth;
+}
+
+
+//
+// Allocation made, the freed allocations it covers are forgotten
+//
+static void SanitizerAllocated(const SanitizerCall & call, uint32_t address, uint32_t size)
+{
+	if (!address || (address < sanitizerHeapBase) || (size > sanitizerShadowSize) || (address > (sanitizerShadowSize - size)))
+	{
+		WriteLog("SANITIZER: Allocation $%08X of %u bytes out of the heap, ignored\n", address, size);
+		return;
+	}
+
+	std::map<uint32_t, SanitizerAllocation>::iterator it = sanitizerAllocations.lower_bound(address);
+
+	if ((it != sanitizerAllocations.begin()) && ((--it)->first + it->second.size <= address))
+	{
+		it++;
+	}
+
+	while ((it != sanitizerAllocations.end()) && (it->first < (address + size)))
+	{
+		it = sanitizerAllocations.erase(it);
+	}
+
+	SanitizerAllocation & allocation = sanitizerAllocations[address];
+	allocation.address = address;
+	allocation.size = size;
+	allocation.live = true;
+	allocation.depth = call.depth;
+	memcpy(allocation.callStack, call.callStack, sizeof(allocation.callStack));
+	memset(&sanitizerShadow[address], SANITIZER_ADDRESSABLE, size);
+}
+
+
+//
+// Allocation freed, kept to report its later uses
+//
+static void SanitizerFreed(uint32_t address)
+{
+	std::map<uint32_t, SanitizerAllocation>::iterator it = sanitizerAllocations.find(address);
+
+	if ((it != sanitizerAllocations.end()) && it->second.live)
+	{
+		it->second.live = false;
+		memset(&sanitizerShadow[address], SANITIZER_FREED, it->second.size);
+	}
+}
+
+
+//
+// Allocator entry reached
+//
+static void SanitizerCallEntry(uint32_t entry, uint32_t sp)
+{
+	// The oldest call is dropped (i.e. left by a longjmp)
+	if (sanitizerCallsCount == SANITIZER_CALLS_MAX)
+	{
+		memmove(&sanitizerCalls[0], &sanitizerCalls[1], sizeof(SanitizerCall) * (SANITIZER_CALLS_MAX - 1));
+		sanitizerCallsCount--;
+	}
+
+	SanitizerCall & call = sanitizerCalls[sanitizerCallsCount++];
+	call.entry = entry;
+	call.sp = sp;
+	call.returnAddress = SanitizerReadLong(sp);
+	call.depth = SanitizerCallStack(sp, call.callStack);
+
+	switch (entry)
+	{
+	case SANITIZER_MALLOC:
+		call.address = 0;
+		call.size = SanitizerReadLong(sp + 4);
+		break;
+
+	case SANITIZER_CALLOC:
+		call.address = 0;
+		call.size = SanitizerReadLong(sp + 4) * SanitizerReadLong(sp + 8);
+		break;
+
+	case SANITIZER_REALLOC:
+		call.address = SanitizerReadLong(sp + 4);
+		call.size = SanitizerReadLong(sp + 8);
+		break;
+
+	case SANITIZER_FREE:
+		call.address = SanitizerReadLong(sp + 4);
+		call.size = 0;
+		// Freed at the entry, the allocator can reuse the block before the return
+		SanitizerFreed(call.address);
+		break;
+	}
+}
+
+
+//
+// Allocator call returned, D0 has the pointer
+//
+static void SanitizerCallReturn(void)
+{
+	SanitizerCall call = sanitizerCalls[--sanitizerCallsCount];
+	uint32_t address = m68k_get_reg(NULL, M68K_REG_D0);
+
+	switch (call.entry)
+	{
+	case SANITIZER_REALLOC:
+		// Failed, the block is kept
+		if (!address)
+		{
+			break;
+		}
+
+		if (address == call.address)
+		{
+			// Shrunk or grown in place, the allocation keeps its allocating call stack
+			std::map<uint32_t, SanitizerAllocation>::iterator it = sanitizerAllocations.find(address);
+
+			if (it != sanitizerAllocations.end())
+			{
+				memset(&sanitizerShadow[address], SANITIZER_POISONED, it->second.size);
+				call.depth = it->second.depth;
+				memcpy(call.callStack, it->second.callStack, sizeof(call.callStack));
+			}
+		}
+		else
+		{
+			SanitizerFreed(call.address);
+		}
+		// fall through
+	case SANITIZER_MALLOC:
+	case SANITIZER_CALLOC:
+		SanitizerAllocated(call, address, call.size);
+		break;
+	}
+}
+
+
+//
+// Allocator entries & returns, called before each M68K instruction
+//
+void SanitizerInstructionHook(uint32_t pc)
+{
+	sanitizerM68KPC = pc;
+	uint32_t sp = m68k_get_reg(NULL, M68K_REG_A7);
+
+	// The return address is reached with the arguments still on the stack
+	if (sanitizerCallsCount && (pc == sanitizerCalls[sanitizerCallsCount - 1].returnAddress) && (sp == (sanitizerCalls[sanitizerCallsCount - 1].sp + 4)))
+	{
+		SanitizerCallReturn();
+	}
+
+	for (uint32_t i = 0; i < SANITIZER_ENTRIES; i++)
+	{
+		if (sanitizerEntry[i] && (pc == sanitizerEntry[i]))
+		{
+			SanitizerCallEntry(i, sp);
+			break;
+		}
+	}
+}
+
+
+//
+// Owning allocation of an address: the one containing it, or the closest one below
+//
+static bool SanitizerFindAllocation(uint32_t address, SanitizerAllocation * allocation)
+{
+	std::map<uint32_t, SanitizerAllocation>::iterator it = sanitizerAllocations.upper_bound(address);
+
+	if (it == sanitizerAllocations.begin())
+	{
+		return false;
+	}
+
+	*allocation = (--it)->second;
+	return true;
+}
+
+
+//
+// Violation, the M68K is halted
+// Only the first violation is kept until the report is taken
+//
+static void SanitizerViolation(uint32_t address, uint32_t value, uint32_t size, uint32_t who, uint8_t shadow)
+{
+	if (!sanitizerReportPending)
+	{
+		sanitizerReportPending = true;
+		sanitizerReport.who = who;
+		sanitizerReport.pc = ((who == M68K) ? sanitizerM68KPC : ((who == GPU) ? GPUGetPC() : ((who == DSP) ? DSPGetPC() : 0)));
+		sanitizerReport.address = address;
+		sanitizerReport.size = size;
+		sanitizerReport.value = value;
+		sanitizerReport.shadow = shadow;
+		sanitizerReport.allocationFound = ((address < 0x800000) && SanitizerFindAllocation(address & (vjs.DRAM_size - 1), &sanitizerReport.allocation));
+
+		WriteLog("SANITIZER: %s write of %u byte(s) ($%X) at $%06X, PC $%06X, %s memory\n", whoName[who], size, value, address, sanitizerReport.pc, sanitizerShadowName[shadow]);
+
+		if (sanitizerReport.allocationFound)
+		{
+			const SanitizerAllocation & allocation = sanitizerReport.allocation;
+			WriteLog("SANITIZER: Allocation $%06X - $%06X (%u bytes, %s), allocated from:\n", allocation.address, allocation.address + allocation.size, allocation.size, (allocation.live ? "live" : "freed"));
+
+			for (uint32_t i = 0; i < allocation.depth; i++)
+			{
+				WriteLog("SANITIZER:     $%06X\n", allocation.callStack[i]);
+			}
+		}
+	}
+
+	M68KDebugHalt();
+}
+
+
+//
+// Memory write check, all bus masters
+//
+static void SanitizerWriteHook(void * userData, uint32_t address, uint32_t value, uint32_t size, uint32_t who)
+{
+	// The debugger, and the allocator itself, are not checked
+	if ((who == DEBUG) || ((who == M68K) && sanitizerCallsCount))
+	{
+		return;
+	}
+
+	for (uint32_t i = 0; i < size; i++)
+	{
+		uint8_t * shadow = SanitizerShadow(address + i);
+
+		if (!shadow || (*shadow <= SANITIZER_ADDRESSABLE))
+		{
+			continue;
+		}
+
+		// Live stack
+		if ((*shadow == SANITIZER_POISONED) && ((address + i) < 0x800000) && (((address + i) & (vjs.DRAM_size - 1)) >= (m68k_get_reg(NULL, M68K_REG_A7) - SANITIZER_STACK_SLACK)))
+		{
+			continue;
+		}
+
+		SanitizerViolation(address, value, size, who, *shadow);
+		return;
+	}
+}
@@ -0,0 +1,57 @@
+//
+// sanitizer.h: Header file
+//
+// Guest memory writes sanitizer, with shadow bytes for the main RAM and the
+// GPU/DSP local RAM
+//
+
+#ifndef __SANITIZER_H__
+#define __SANITIZER_H__
+
+#include <stdint.h>
+#include "hooks.h"
+
+// Shadow bytes
+// SANITIZER_UNCHECKED     not checked (code, data, local RAM by default)
+// SANITIZER_ADDRESSABLE   live allocation
+// SANITIZER_FREED         freed allocation
+// SANITIZER_POISONED      heap not allocated, dead stack, or poisoned range
+enum { SANITIZER_UNCHECKED = 0, SANITIZER_ADDRESSABLE, SANITIZER_FREED, SANITIZER_POISONED };
+
+// Allocator entry points
+enum { SANITIZER_MALLOC = 0, SANITIZER_CALLOC, SANITIZER_REALLOC, SANITIZER_FREE, SANITIZER_ENTRIES };
+
+#define SANITIZER_CALLSTACK_DEPTH	8
+
+struct SanitizerAllocation
+{
+	uint32_t address, size;
+	bool live;
+	uint32_t depth;								// Return addresses in the call stack
+	uint32_t callStack[SANITIZER_CALLSTACK_DEPTH];
+};
+
+struct SanitizerReport
+{
+	uint32_t who, pc;							// Faulting bus master, and its PC (0 for the blitter & the OP)
+	uint32_t address, size, value;
+	uint8_t shadow;								// Shadow byte of the faulting address
+	bool allocationFound;						// Owning allocation (containing the address, or the closest below)
+	SanitizerAllocation allocation;
+};
+
+extern bool sanitizerActive;
+extern const char * sanitizerShadowName[];
+
+extern bool SanitizerEnable(const uint32_t entry[SANITIZER_ENTRIES], uint32_t heapBase);
+extern void SanitizerDisable(void);
+extern void SanitizerReset(void);
+extern void SanitizerForget(void);
+extern void SanitizerPoison(uint32_t address, uint32_t size, uint8_t shadow);
+extern bool SanitizerGetReport(SanitizerReport * report);
+extern void SanitizerInstructionHook(uint32_t pc);
+
+// Called before each M68K instruction, only one test when the sanitizer is off
+#define SANITIZER_INSTRUCTION_HOOK(pc)	do { if (HOOKS_UNLIKELY(sanitizerActive)) SanitizerInstructionHook(pc); } while (0)
+
+#endif	// __SANITIZER_H__
@@ -0,0 +1,569 @@
+//
+// Lua scripting
+//
+// A script registers Lua functions on the emulation events through the 'vj'
+// table, and can read/write the memory & the M68K registers, inject the
+// joypads input and access the frame buffer. Each registered function uses a
+// hooks list entry, so the emulation doesn't pay anything without script.
+//
+// vj.on_frame_start(fn)         fn(frame) before the frame emulation, input injection goes here
+// vj.on_frame(fn)               fn(frame) after the frame emulation, the frame buffer is complete
+// vj.on_halfline(fn)            fn(vc) after each halfline
+// vj.on_write(low, high, fn)    fn(address, value, size, who) before a write in the [low, high] range
+// vj.on_read(low, high, fn)     fn(address, value, size, who) after a read in the [low, high] range
+// vj.on_breakpoint(fn)          fn(address) on a M68K breakpoint, return true to continue the emulation
+// vj.remove(id)                 remove a function, id is returned by the vj.on_xxx functions
+// vj.add_breakpoint(address)    add a M68K breakpoint
+// vj.read8/16/32(address)       read the memory
+// vj.write8/16/32(address, v)   write the memory
+// vj.get_reg(name)              read a M68K register ("d0".."d7", "a0".."a7", "pc", "sr", "sp", "usp")
+// vj.set_reg(name, value)       write a M68K register
+// vj.set_input(port, button, pressed)  set a joypad button state, buttons are in vj.button
+// vj.screen_size()              width & height of the frame buffer
+// vj.get_pixel(x, y)            read a frame buffer pixel
+// vj.set_pixel(x, y, color)     write a frame buffer pixel
+// vj.frame()                    current frame number
+// vj.log(text)                  write in the log file
+// vj.poison(address, size)      poison a range for the memory sanitizer (i.e. in the GPU/DSP local RAM)
+// vj.unpoison(address, size)    make a range writable again for the memory sanitizer
+// vj.watch(address, size, mode)  add a data watchpoint, mode has 'r', 'w' (default) and 'h' (halt), returns its id
+// vj.unwatch(id)                remove a data watchpoint
+//
+// The DSP accesses come from the audio thread; the functions are called under
+// a lock, one at a time, so the audio thread waits for a running function.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Memory sanitizer ranges poisoning
+// JPM   Oct./2026  Data watchpoints
+// JPM   Oct./2026  Functions called under a lock, for the DSP accesses from the audio thread, and memory reads
+//
+
+#include "scripting.h"
+
+#include <string.h>
+#include "log.h"
+
+#ifdef HAVE_LIB_LUA
+#include <lua.hpp>
+#include <mutex>
+#include "hooks.h"
+#include "jaguar.h"
+#include "joystick.h"
+#include "m68000/m68kinterface.h"
+#include "sanitizer.h"
+#include "tom.h"
+#include "watchpoint.h"
+
+
+// Lua function registered on an event
+struct ScriptHook
+{
+	bool used;
+	uint32_t type;
+	int ref;									// Lua registry reference of the function
+};
+
+static lua_State * L;
+static ScriptHook scriptHooks[HOOK_END * HOOK_MAX_CALLBACKS];
+static std::mutex scriptMutex;					// Lua state used by one thread at a time
+static thread_local bool scriptBusy;			// Avoid the script to hook its own accesses
+
+static const char * m68kRegName[] = { "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "pc", "sr", "sp", "usp" };
+
+static const struct { const char * name; int button; } buttonName[] =
+{
+	{ "up", BUTTON_U }, { "down", BUTTON_D }, { "left", BUTTON_L }, { "right", BUTTON_R },
+	{ "a", BUTTON_A }, { "b", BUTTON_B }, { "c", BUTTON_C }, { "option", BUTTON_OPTION }, { "pause", BUTTON_PAUSE },
+	{ "star", BUTTON_s }, { "hash", BUTTON_d }, { "0", BUTTON_0 }, { "1", BUTTON_1 }, { "2", BUTTON_2 }, { "3", BUTTON_3 },
+	{ "4", BUTTON_4 }, { "5", BUTTON_5 }, { "6", BUTTON_6 }, { "7", BUTTON_7 }, { "8", BUTTON_8 }, { "9", BUTTON_9 }
+};
+
+
+// Function prototypes
+static void ScriptHookRemove(ScriptHook * hook);
+static void ScriptClose(void);
+
+
+//
+// Call the Lua function registered on the event
+// The function may have been removed by another thread while this one was waiting for the lock
+//
+static void ScriptHookCallback(void * userData, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+	ScriptHook * hook = (ScriptHook *)userData;
+	int nargs = 1;
+
+	if (scriptBusy)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(scriptMutex);
+
+	if (!L || !hook->used)
+	{
+		return;
+	}
+
+	scriptBusy = true;
+	lua_rawgeti(L, LUA_REGISTRYINDEX, hook->ref);
+	lua_pushinteger(L, arg0);
+
+	if ((hook->type == HOOK_MEMWRITE) || (hook->type == HOOK_MEMREAD))
+	{
+		lua_pushinteger(L, arg1);
+		lua_pushinteger(L, arg2);
+		lua_pushstring(L, ((arg3 < 10) ? whoName[arg3] : "Unknown"));
+		nargs = 4;
+	}
+
+	if (lua_pcall(L, nargs, 1, 0) != LUA_OK)
+	{
+		WriteLog("SCRIPT: %s, function removed\n", lua_tostring(L, -1));
+		ScriptHookRemove(hook);
+	}
+	else
+	{
+		if ((hook->type == HOOK_BREAKPOINT) && lua_toboolean(L, -1))
+		{
+			hooksBreakpointResume = true;
+		}
+	}
+
+	lua_pop(L, 1);
+	scriptBusy = false;
+}
+
+
+//
+// Remove a Lua function from its event
+//
+static void ScriptHookRemove(ScriptHook * hook)
+{
+	HooksUnregister(hook->type, ScriptHookCallback, hook);
+	luaL_unref(L, LUA_REGISTRYINDEX, hook->ref);
+	hook->used = false;
+}
+
+
+//
+// Register the Lua function, at the stack index, on the event
+// Return the function id to the script
+//
+static int ScriptHookAdd(lua_State * l, uint32_t type, int index, uint32_t low = 0, uint32_t high = 0xFFFFFFFF)
+{
+	luaL_checktype(l, index, LUA_TFUNCTION);
+
+	for (size_t i = 0; i < (sizeof(scriptHooks) / sizeof(ScriptHook)); i++)
+	{
+		ScriptHook * hook = &scriptHooks[i];
+
+		if (!hook->used)
+		{
+			lua_pushvalue(l, index);
+			hook->ref = luaL_ref(l, LUA_REGISTRYINDEX);
+			hook->type = type;
+
+			if (!HooksRegister(type, ScriptHookCallback, hook, low, high))
+			{
+				luaL_unref(l, LUA_REGISTRYINDEX, hook->ref);
+				return luaL_error(l, "too many functions on this event");
+			}
+
+			hook->used = true;
+			lua_pushinteger(l, i + 1);
+			return 1;
+		}
+	}
+
+	return luaL_error(l, "too many functions registered");
+}
+
+
+static int ScriptOnFrameStart(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_FRAMESTART, 1);
+}
+
+
+static int ScriptOnFrame(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_FRAMEEND, 1);
+}
+
+
+static int ScriptOnHalfline(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_HALFLINE, 1);
+}
+
+
+static int ScriptOnWrite(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_MEMWRITE, 3, (uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2));
+}
+
+
+static int ScriptOnRead(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_MEMREAD, 3, (uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2));
+}
+
+
+static int ScriptOnBreakpoint(lua_State * l)
+{
+	return ScriptHookAdd(l, HOOK_BREAKPOINT, 1);
+}
+
+
+static int ScriptRemove(lua_State * l)
+{
+	lua_Integer id = luaL_checkinteger(l, 1);
+
+	if ((id >= 1) && (id <= (lua_Integer)(sizeof(scriptHooks) / sizeof(ScriptHook))) && scriptHooks[id - 1].used)
+	{
+		ScriptHookRemove(&scriptHooks[id - 1]);
+	}
+
+	return 0;
+}
+
+
+static int ScriptAddBreakpoint(lua_State * l)
+{
+	S_BrkInfo info;
+
+	memset(&info, 0, sizeof(info));
+	info.Adr = (size_t)luaL_checkinteger(l, 1);
+	lua_pushboolean(l, m68k_brk_add(&info));
+	return 1;
+}
+
+
+static int ScriptRead8(lua_State * l)
+{
+	lua_pushinteger(l, JaguarReadByte((uint32_t)luaL_checkinteger(l, 1), DEBUG));
+	return 1;
+}
+
+
+static int ScriptRead16(lua_State * l)
+{
+	lua_pushinteger(l, JaguarReadWord((uint32_t)luaL_checkinteger(l, 1), DEBUG));
+	return 1;
+}
+
+
+static int ScriptRead32(lua_State * l)
+{
+	lua_pushinteger(l, JaguarReadLong((uint32_t)luaL_checkinteger(l, 1), DEBUG));
+	return 1;
+}
+
+
+static int ScriptWrite8(lua_State * l)
+{
+	JaguarWriteByte((uint32_t)luaL_checkinteger(l, 1), (uint8_t)luaL_checkinteger(l, 2), DEBUG);
+	return 0;
+}
+
+
+static int ScriptWrite16(lua_State * l)
+{
+	JaguarWriteWord((uint32_t)luaL_checkinteger(l, 1), (uint16_t)luaL_checkinteger(l, 2), DEBUG);
+	return 0;
+}
+
+
+static int ScriptWrite32(lua_State * l)
+{
+	JaguarWriteLong((uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2), DEBUG);
+	return 0;
+}
+
+
+//
+// Get the M68K register from its name
+//
+static m68k_register_t ScriptGetRegister(lua_State * l)
+{
+	const char * name = luaL_checkstring(l, 1);
+
+	for (size_t i = 0; i < (sizeof(m68kRegName) / sizeof(char *)); i++)
+	{
+		if (!strcmp(name, m68kRegName[i]))
+		{
+			return (m68k_register_t)(M68K_REG_D0 + i);
+		}
+	}
+
+	luaL_error(l, "unknown register '%s'", name);
+	return M68K_REG_D0;
+}
+
+
+static int ScriptGetReg(lua_State * l)
+{
+	lua_pushinteger(l, m68k_get_reg(NULL, ScriptGetRegister(l)));
+	return 1;
+}
+
+
+static int ScriptSetReg(lua_State * l)
+{
+	m68k_set_reg(ScriptGetRegister(l), (unsigned int)luaL_checkinteger(l, 2));
+	return 0;
+}
+
+
+static int ScriptSetInput(lua_State * l)
+{
+	lua_Integer port = luaL_checkinteger(l, 1);
+	lua_Integer button = luaL_checkinteger(l, 2);
+
+	if ((port < 0) || (port > 1) || (button < BUTTON_FIRST) || (button > BUTTON_LAST))
+	{
+		return luaL_error(l, "invalid joypad port or button");
+	}
+
+	(port ? joypad1Buttons : joypad0Buttons)[button] = (lua_toboolean(l, 3) ? 0x01 : 0x00);
+	return 0;
+}
+
+
+static int ScriptScreenSize(lua_State * l)
+{
+	lua_pushinteger(l, TOMGetVideoModeWidth());
+	lua_pushinteger(l, TOMGetVideoModeHeight());
+	return 2;
+}
+
+
+//
+// Get the frame buffer pixel pointer, NULL if outside the screen
+//
+static uint32_t * ScriptGetPixel(lua_State * l)
+{
+	lua_Integer x = luaL_checkinteger(l, 1);
+	lua_Integer y = luaL_checkinteger(l, 2);
+
+	if (!screenBuffer || (x < 0) || (y < 0) || (x >= (lua_Integer)TOMGetVideoModeWidth()) || (y >= (lua_Integer)TOMGetVideoModeHeight()))
+	{
+		return NULL;
+	}
+
+	return &screenBuffer[(y * screenPitch) + x];
+}
+
+
+static int ScriptGetPixelValue(lua_State * l)
+{
+	uint32_t * pixel = ScriptGetPixel(l);
+
+	lua_pushinteger(l, (pixel ? *pixel : 0));
+	return 1;
+}
+
+
+static int ScriptSetPixelValue(lua_State * l)
+{
+	uint32_t * pixel = ScriptGetPixel(l);
+
+	if (pixel)
+	{
+		*pixel = (uint32_t)luaL_checkinteger(l, 3);
+	}
+
+	return 0;
+}
+
+
+static int ScriptFrame(lua_State * l)
+{
+	lua_pushinteger(l, jaguarFrameCount);
+	return 1;
+}
+
+
+static int ScriptLog(lua_State * l)
+{
+	WriteLog("SCRIPT: %s\n", luaL_checkstring(l, 1));
+	return 0;
+}
+
+
+static int ScriptPoison(lua_State * l)
+{
+	SanitizerPoison((uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2), SANITIZER_POISONED);
+	return 0;
+}
+
+
+static int ScriptUnpoison(lua_State * l)
+{
+	SanitizerPoison((uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2), SANITIZER_UNCHECKED);
+	return 0;
+}
+
+
+static int ScriptWatch(lua_State * l)
+{
+	const char * mode = luaL_optstring(l, 3, "w");
+	uint32_t type = (strchr(mode, 'r') ? WATCHPOINT_READ : 0) | (strchr(mode, 'w') ? WATCHPOINT_WRITE : 0) | (strchr(mode, 'h') ? WATCHPOINT_HALT : 0);
+	uint32_t id = WatchpointAdd((uint32_t)luaL_checkinteger(l, 1), (uint32_t)luaL_checkinteger(l, 2), type);
+
+	if (!id)
+	{
+		return 0;
+	}
+
+	lua_pushinteger(l, id);
+	return 1;
+}
+
+
+static int ScriptUnwatch(lua_State * l)
+{
+	WatchpointRemove((uint32_t)luaL_checkinteger(l, 1));
+	return 0;
+}
+
+
+static const luaL_Reg scriptFunctions[] =
+{
+	{ "on_frame_start", ScriptOnFrameStart },
+	{ "on_frame", ScriptOnFrame },
+	{ "on_halfline", ScriptOnHalfline },
+	{ "on_write", ScriptOnWrite },
+	{ "on_read", ScriptOnRead },
+	{ "on_breakpoint", ScriptOnBreakpoint },
+	{ "remove", ScriptRemove },
+	{ "add_breakpoint", ScriptAddBreakpoint },
+	{ "read8", ScriptRead8 },
+	{ "read16", ScriptRead16 },
+	{ "read32", ScriptRead32 },
+	{ "write8", ScriptWrite8 },
+	{ "write16", ScriptWrite16 },
+	{ "write32", ScriptWrite32 },
+	{ "get_reg", ScriptGetReg },
+	{ "set_reg", ScriptSetReg },
+	{ "set_input", ScriptSetInput },
+	{ "screen_size", ScriptScreenSize },
+	{ "get_pixel", ScriptGetPixelValue },
+	{ "set_pixel", ScriptSetPixelValue },
+	{ "frame", ScriptFrame },
+	{ "log", ScriptLog },
+	{ "poison", ScriptPoison },
+	{ "unpoison", ScriptUnpoison },
+	{ "watch", ScriptWatch },
+	{ "unwatch", ScriptUnwatch },
+	{ NULL, NULL }
+};
+
+
+//
+// Load and run the script, the script registers its functions on the events
+//
+bool ScriptLoad(const char * path)
+{
+	std::lock_guard<std::mutex> lock(scriptMutex);
+
+	ScriptClose();
+
+	if (!(L = luaL_newstate()))
+	{
+		WriteLog("SCRIPT: Cannot create the Lua state\n");
+		return false;
+	}
+
+	luaL_openlibs(L);
+
+	// vj table with the functions and the joypad buttons
+	lua_newtable(L);
+	luaL_setfuncs(L, scriptFunctions, 0);
+	lua_newtable(L);
+
+	for (size_t i = 0; i < (sizeof(buttonName) / sizeof(buttonName[0])); i++)
+	{
+		lua_pushinteger(L, buttonName[i].button);
+		lua_setfield(L, -2, buttonName[i].name);
+	}
+
+	lua_setfield(L, -2, "button");
+	lua_setglobal(L, "vj");
+
+	scriptBusy = true;
+	bool loaded = ((luaL_loadfile(L, path) == LUA_OK) && (lua_pcall(L, 0, 0, 0) == LUA_OK));
+	scriptBusy = false;
+
+	if (!loaded)
+	{
+		WriteLog("SCRIPT: Cannot run %s: %s\n", path, lua_tostring(L, -1));
+		ScriptClose();
+		return false;
+	}
+
+	WriteLog("SCRIPT: %s loaded\n", path);
+	return true;
+}
+
+
+//
+// Remove the script functions from the events and close the script
+// The lock is already taken
+//
+static void ScriptClose(void)
+{
+	if (L)
+	{
+		for (size_t i = 0; i < (sizeof(scriptHooks) / sizeof(ScriptHook)); i++)
+		{
+			if (scriptHooks[i].used)
+			{
+				ScriptHookRemove(&scriptHooks[i]);
+			}
+		}
+
+		lua_close(L);
+		L = NULL;
+	}
+}
+
+
+void ScriptDone(void)
+{
+	std::lock_guard<std::mutex> lock(scriptMutex);
+
+	ScriptClose();
+}
+
+
+bool ScriptIsLoaded(void)
+{
+	return (L != NULL);
+}
+
+#else
+
+bool ScriptLoad(const char * path)
+{
+	WriteLog("SCRIPT: Lua support has not been built, %s cannot be loaded\n", path);
+	return false;
+}
+
+
+void ScriptDone(void)
+{
+}
+
+
+bool ScriptIsLoaded(void)
+{
+	return false;
+}
+
+#endif	// HAVE_LIB_LUA
@@ -0,0 +1,14 @@
+//
+// scripting.h: Header file
+//
+// Lua scripts hooked on the emulation events
+//
+
+#ifndef __SCRIPTING_H__
+#define __SCRIPTING_H__
+
+extern bool ScriptLoad(const char * path);
+extern void ScriptDone(void);
+extern bool ScriptIsLoaded(void);
+
+#endif	// __SCRIPTING_H__
@@ -15,6 +15,14 @@
 // JPM  04/06/2019  Added ELF sections check
 //  RG   Jan./2021  Linux build fix
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Added host threads and memory tuning settings
+// JPM   Oct./2026  Added the frame timing overlay setting
+// JPM   Oct./2026  Added the Object Processor speculation setting
+// JPM   Oct./2026  Added the 68K beam polling loops skip setting
+// JPM   Oct./2026  Added the guest memory sanitizer setting
+// JPM   Oct./2026  Added the guest debug port setting
+// JPM   Oct./2026  Added the main bus arbitration setting
+// JPM   Oct./2026  Added the asynchronous serial interface host end
 //
 
 #ifndef __SETTINGS_H__
@@ -86,6 +94,8 @@ struct VJSettings
 	bool allowM68KExceptionCatch;								// Allow M68K exception catch
 	bool allowWritesToROM;										// Allow writes to ROM cartdridge
 	bool allowWritesToUnknownLocation;							// Allow writes to unknown memory location
+	bool allowGuestSanitizer;									// Allow the guest memory writes sanitizer (heap & stack)
+	bool allowDebugPort;										// Allow the guest debug port (text, markers & assertions)
 	uint32_t biosType;											// Bios type used
 	uint32_t jaguarModel;										// Jaguar model
 	size_t nbrdisasmlines;										// Number of lines to show in the M68K tracing window
@@ -98,6 +108,17 @@ struct VJSettings
 	bool cygdriveDirRemoval;
 	size_t nbrmemory1browserwindow;								// Number of memory browser windows
 	size_t DRAM_size;											// DRAM size
+	int32_t emulationThreadCPU;									// Host CPU core for the emulation thread (-1 = no pinning)
+	int32_t audioThreadCPU;										// Host CPU core for the audio thread (-1 = no pinning)
+	int32_t workerThreadCPU;									// Host CPU core for the worker threads (-1 = no pinning)
+	uint32_t emulationThreadPriority;							// Real-time priority of the emulation thread (0 = normal scheduling)
+	uint32_t audioThreadPriority;								// Real-time priority of the audio thread (0 = normal scheduling)
+	bool useRoundRobinScheduling;								// SCHED_RR instead of SCHED_FIFO for the real-time priorities
+	uint32_t hugePagesType;										// Huge pages backing of the emulator memory
+	bool frameTimingOverlay;									// Display the frame timing graph over the screen
+	uint32_t opSpeculation;										// Object Processor halflines rendered ahead on a worker thread
+	bool beamPollSkip;											// 68K loops polling HC or VC fast-forwarded, cycle-identical
+	bool busArbitration;										// Main bus shared by the bus masters, the stolen cycles slow the executors
 
 	// Keybindings in order of U, D, L, R, C, B, A, Op, Pa, 0-9, #, *
 	uint32_t p1KeyBindings[21];
@@ -117,6 +138,7 @@ struct VJSettings
 	char SaveStatePath[MAX_PATH];
 	char screenshotPath[MAX_PATH];
 	char sourcefilesearchPaths[4096];
+	char asiHost[MAX_PATH];										// Serial line host end: "pty", a UNIX socket path, or none (empty)
 };
 
 // Render types
@@ -128,6 +150,9 @@ enum { JAG_NULL_SERIES, JAG_K_SERIES, JAG_M_SERIES };
 // BIOS types
 enum { BT_NULL, BT_K_SERIES, BT_M_SERIES, BT_STUBULATOR_1, BT_STUBULATOR_2 };
 
+// Object Processor speculation (verify: the halflines are also rendered serially, and compared)
+enum { OPSPEC_OFF = 0, OPSPEC_ON, OPSPEC_VERIFY };
+
 // Exported variables
 extern VJSettings vjs;
 
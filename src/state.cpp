@@ -15,6 +15,17 @@
 // ---  ----------  -------------------------------------------------------------
 // JLH  01/16/2010  Created this log ;-)
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  M68K lazy flags made before the dump
+// JPM   Oct./2026  Added the machine state CRC32
+// JPM   Oct./2026  Machine state dump & load in memory
+// JPM   Oct./2026  Chips state dump & load without the memory space contents
+// JPM   Oct./2026  OP speculation cancelled at the memory load
+// JPM   Oct./2026  Sections directory file format, written & loaded in memory
+// JPM   Oct./2026  Main bus arbitration substate
+// JPM   Oct./2026  Memory space sections CRC32, and segments written by batches
+// JPM   Oct./2026  Sanitizer allocations forgotten at a state file load
+// JPM   Oct./2026  Butch word clock substate
+// JPM   Oct./2026  ASI substate
 //
 
 #include "jaguar.h"
@@ -30,13 +41,23 @@
 #include "jerry.h"
 #include "joystick.h"
 #include "log.h"
+#include "memory.h"
+#include "op.h"
 //#include "mmu.h"
+#include "sanitizer.h"
 #include "settings.h"
 #include "tom.h"
 #include "state.h"
 #include <string.h>
 #include <errno.h>
 #include <zlib.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 #include "m68000/m68kinterface.h"
 #include "m68000/cpudefs.h"
 
@@ -50,14 +71,24 @@
 // First two bytes: VJ (ASCII letters)
 // Third byte: flags
 //   Values: least significant bit: 0: uncompressed, 1: compressed by deflate/gzip
-// Fourth byte: version number: 1
+// Fourth byte: version number: 2 (1 is still loaded)
 //   Note: The version number should not be incremented unless the new format
 //         cannot be used with older versions of the software.
 //
 // If the deflate/gzip flag is set, then the rest of the file must be decompressed
 // before processing.
 //
-// The actual data is stored in chunks as below:
+// Version 2: the data is stored in sections, found from a directory:
+// +-------------------------------------------------------------------------+
+// | count (32 bits) | count x [ type | offset | size | CRC32 ] (32 bits each) |
+// +-------------------------------------------------------------------------+
+// offset: from the start of the file, each section starts on a 16 bytes boundary
+// CRC32: of the section data, checked before the state is loaded
+// The substates are dumped without the memory space contents, the RAM (0x1001)
+// and the Butch/TOM/JERRY (0x1002) memory space sections are written as they are,
+// and are checked for their size too. The unknown sections are skipped.
+//
+// Version 1: the data is stored in chunks as below:
 // +--------------------------------------------------------+
 // | type (32 bits) | size (32 bits) | data ............... |
 // +--------------------------------------------------------+
@@ -89,6 +120,9 @@ extern uint32_t d7Queue[0x400];
 extern uint32_t pcQPtr;
 extern bool startM68KTracing;
 
+// Substates dumped & loaded without the memory space contents
+static bool stateWithoutMemory = false;
+
 
 size_t jag_dump(FILE *fp)
 {
@@ -125,6 +159,7 @@ size_t jag_dump(FILE *fp)
 	DUMP8(regs.stopped);
 	DUMPINT(regs.intmask);
 	DUMPINT(regs.intLevel);
+	CC_FLUSH;
 	DUMPUINT(regs.c);
 	DUMPUINT(regs.z);
 	DUMPUINT(regs.n);
@@ -137,7 +172,7 @@ size_t jag_dump(FILE *fp)
 	DUMPS32(regs.remainingCycles);
 	DUMP32(regs.interruptCycles);
   
-	uint32_t memsize = 0x200000;
+	uint32_t memsize = (stateWithoutMemory ? 0 : 0x200000);
 	if (fwrite(jaguarMainRAM, 1, memsize, fp) != memsize)
 	{
 		WriteLog("DUMP RAM error\n");
@@ -188,6 +223,7 @@ size_t jag_load(FILE *fp)
 	LOADUINT(regs.n);
 	LOADUINT(regs.v);
 	LOADUINT(regs.x);
+	regs.ccOp = CC_NONE;
 	LOAD32(regs.pc);
 	LOAD32(regs.spcflags);
 	LOAD32(regs.prefetch_pc);
@@ -195,7 +231,8 @@ size_t jag_load(FILE *fp)
 	LOADS32(regs.remainingCycles);
 	LOAD32(regs.interruptCycles);
 
-	uint32_t memsize = 0x200000;
+	uint32_t memsize = (stateWithoutMemory ? 0 : 0x200000);
+	MemoryPagesWritten(0, memsize);
 	if (fread(jaguarMainRAM, 1, memsize, fp) != memsize)
 	{
 		WriteLog("LOAD RAM error\n");
@@ -211,7 +248,7 @@ size_t mem_dump(FILE *fp)
 	size_t total_dumped = 0;
 
 	// No need to dump the ROM
-	uint32_t ramSize = 0x800000; //0xF20000;
+	uint32_t ramSize = (stateWithoutMemory ? 0 : 0x800000); //0xF20000;
 	if (fwrite(jagMemSpace, 1, ramSize, fp) != ramSize)
 	{
 		WriteLog("DUMP MAIN RAM error\n");
@@ -219,7 +256,7 @@ size_t mem_dump(FILE *fp)
 	}
 	total_dumped += ramSize;
 
-	uint32_t otherSize = 0xF20000 - 0xDFFF00;
+	uint32_t otherSize = (stateWithoutMemory ? 0 : (0xF20000 - 0xDFFF00));
 	if (fwrite(&jagMemSpace[0xDFFF00], 1, otherSize, fp) != otherSize)
 	{
 		WriteLog("DUMP OTHER RAM error\n");
@@ -240,8 +277,10 @@ size_t mem_dump(FILE *fp)
 size_t mem_load(FILE *fp)
 {
 	size_t total_loaded = 0;
+	OPSpecCancel();
 
-	uint32_t ramSize = 0x800000; //0xF20000;
+	uint32_t ramSize = (stateWithoutMemory ? 0 : 0x800000); //0xF20000;
+	MemoryPagesWritten(0, ramSize);
 	if (fread(jagMemSpace, 1, ramSize, fp) != ramSize)
 	{
 		WriteLog("LOAD MAIN RAM error\n");
@@ -249,7 +288,7 @@ size_t mem_load(FILE *fp)
 	}
 	total_loaded += ramSize;
 
-	uint32_t otherSize = 0xF20000 - 0xDFFF00;
+	uint32_t otherSize = (stateWithoutMemory ? 0 : (0xF20000 - 0xDFFF00));
 	if (fread(&jagMemSpace[0xDFFF00], 1, otherSize, fp) != otherSize)
 	{
 		WriteLog("LOAD OTHER RAM error\n");
@@ -284,23 +323,64 @@ static substate_t substates[] = {
 	SUBSTATE(0x103, mem),
 	SUBSTATE(0x201, tom),
 	SUBSTATE(0x301, jerry),
+	SUBSTATE(0x302, jerryi2s),
+	SUBSTATE(0x303, asi),
 	SUBSTATE(0x401, gpu),
 	SUBSTATE(0x501, dsp),
 	SUBSTATE(0x601, blitter),
 	SUBSTATE(0x602, op),
 	SUBSTATE(0x603, events),
 	SUBSTATE(0x604, dac),
+	SUBSTATE(0x605, bus),
 	SUBSTATE(0x701, eeprom),
 	//SUBSTATE(0x702, eeprom2),
 	SUBSTATE(0x801, joystick),
 	SUBSTATE(0x901, cdrom),
 };
 
-#define COMPATIBILITY_VERSION 0x01
+#define STATE_VERSION_CHUNKS	0x01			// Substates chunks stream
+#define COMPATIBILITY_VERSION	0x02			// Sections directory
+#define STATE_DIRECTORY			4				// Sections count & directory position in the file
+#define STATE_SECTION_ALIGN		16
+#define STATE_MAX_SIZE			0x4000000		// Inflated state size limit (64 MB)
+#define STATE_ALIGN(_x)			(((_x) + (STATE_SECTION_ALIGN - 1)) & ~(size_t)(STATE_SECTION_ALIGN - 1))
+#define STATE_IOV_BATCH			8				// Segments written by a single gather write
+
+// Memory space sections, written & loaded straight from the memory space
+struct memsection {
+  uint32_t type;
+  uint32_t start;
+  uint32_t size;
+};
+
+typedef struct memsection memsection_t;
+
+static const memsection_t memsections[] = {
+	{ 0x1001, 0x000000, 0x800000 },					// No need to dump the ROM
+	{ 0x1002, 0xDFFF00, (0xF20000 - 0xDFFF00) },	// Butch, TOM & JERRY
+};
 
-// zlib deflate/inflate function prototypes
-int def(FILE *source, FILE *dest, int level);
-int inf(FILE *source, FILE *dest);
+#define SUBSTATES_COUNT		(sizeof(substates) / sizeof(substates[0]))
+#define MEMSECTIONS_COUNT	(sizeof(memsections) / sizeof(memsections[0]))
+#define SECTIONS_COUNT		(SUBSTATES_COUNT + MEMSECTIONS_COUNT)
+
+// Sections directory entry, offset from the start of the file
+struct statesection {
+  uint32_t type;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t crc;
+};
+
+typedef struct statesection statesection_t;
+
+// Data written by a single gather write
+struct statesegment {
+  const void *data;
+  size_t size;
+};
+
+typedef struct statesegment statesegment_t;
 
 // [save state directory] / [ROMCRC32] - memdump - [slot number] .vjs
 static const char *save_file_pattern = "%s%08X-memdump-%d.vjs";
@@ -308,218 +388,655 @@ static const char *save_file_pattern_tmp = "%s%08X-memdump-%d.vjs.tmp";
 static char save_sprintf_buf[MAX_PATH+512];
 int save_slot = 0;
 
-size_t DumpSaveState(void)
+substate_t *find_substate(uint32_t type)
 {
-	int r;
+	for (int substate_idx = 0; substate_idx < SUBSTATES_COUNT; substate_idx++)
+	{
+		substate_t *substate = &substates[substate_idx];
+		if (type == substate->type)
+		{
+			return substate;
+		}
+	}
+	return NULL;
+}
 
-	if (save_slot == -1)
+static const memsection_t *find_memsection(uint32_t type)
+{
+	for (int memsection_idx = 0; memsection_idx < MEMSECTIONS_COUNT; memsection_idx++)
 	{
-		return -1;
+		if (type == memsections[memsection_idx].type)
+		{
+			return &memsections[memsection_idx];
+		}
 	}
-	else
+	return NULL;
+}
+
+// Open a memory buffer as a file, for the substates loading
+static FILE *StateOpenBuffer(const uint8_t *buffer, size_t size)
+{
+	// An empty buffer cannot be opened, there is nothing to load from it anyway
+	static uint8_t empty = 0;
+
+	if (size == 0)
 	{
-		bool compress = vjs.compressSaveStates;
-		char const *file_pattern = compress ? save_file_pattern_tmp : save_file_pattern;
-		sprintf(save_sprintf_buf, file_pattern, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-		FILE *fp = fopen(save_sprintf_buf, "wb");
+		buffer = &empty;
+		size = 1;
+	}
 
-		if (fp == NULL)
+#if defined(_WIN32)
+	FILE *fp = tmpfile();
+
+	if ((fp != NULL) && (fwrite(buffer, 1, size, fp) == size))
+	{
+		rewind(fp);
+	}
+	else if (fp != NULL)
+	{
+		fclose(fp);
+		fp = NULL;
+	}
+
+	return fp;
+#else
+	return fmemopen((void *)buffer, size, "rb");
+#endif
+}
+
+// Dump the substates in a memory buffer
+// If the offsets are requested, each substate is aligned on a section boundary
+// The buffer must be freed by the caller; returns NULL if the substates cannot be dumped
+static uint8_t *StateDumpSubstates(size_t *size, uint32_t *offsets, uint32_t *sizes)
+{
+#if defined(_WIN32)
+	FILE *fp = tmpfile();
+#else
+	char *buffer = NULL;
+	size_t bufferSize = 0;
+	FILE *fp = open_memstream(&buffer, &bufferSize);
+#endif
+
+	if (fp == NULL)
+	{
+		WriteLog("StateDumpToMemory: cannot create the state buffer\n");
+		return NULL;
+	}
+
+	size_t total_dumped = 0;
+
+	for (int substate_idx = 0; substate_idx < SUBSTATES_COUNT; substate_idx++)
+	{
+		size_t subtotal = substates[substate_idx].dump(fp);
+		bool error = (subtotal == -1);
+
+		if (!error && (offsets != NULL))
 		{
-			return -1;
+			offsets[substate_idx] = (uint32_t)total_dumped;
+			sizes[substate_idx] = (uint32_t)subtotal;
+
+			for (total_dumped += subtotal; !error && (total_dumped != STATE_ALIGN(total_dumped)); total_dumped++)
+			{
+				error = (fputc(0, fp) == EOF);
+			}
 		}
-		else
+
+		if (error)
 		{
-			uint32_t m68kPC = m68k_get_reg(NULL, M68K_REG_PC);
-			WriteLog("SaveState file %s m68kPC: %08X\n", save_sprintf_buf, m68kPC);
+			WriteLog("StateDumpToMemory: error dumping %04X\n", substates[substate_idx].type);
+			fclose(fp);
+#if !defined(_WIN32)
+			free(buffer);
+#endif
+			return NULL;
+		}
+	}
+
+#if defined(_WIN32)
+	size_t bufferSize = (size_t)ftell(fp);
+	uint8_t *buffer = (uint8_t *)malloc(bufferSize ? bufferSize : 1);
+	rewind(fp);
 
-			size_t total_dumped = 0;
+	if ((buffer != NULL) && (fread(buffer, 1, bufferSize, fp) != bufferSize))
+	{
+		WriteLog("StateDumpToMemory: cannot read the state buffer\n");
+		free(buffer);
+		buffer = NULL;
+	}
+#endif
+	fclose(fp);
+	*size = bufferSize;
+	return (uint8_t *)buffer;
+}
 
-			uint8_t magic[4] = { 'V', 'J', 0x00, COMPATIBILITY_VERSION };
-			DUMP8(magic);
+// Load a substate from its section
+// Returns 0 if the substate cannot be loaded
+static int StateLoadSubstate(substate_t *substate, const uint8_t *buffer, size_t size)
+{
+	FILE *fp = StateOpenBuffer(buffer, size);
 
-			for (int substate_idx = 0; substate_idx < sizeof(substates) / sizeof(substates[0]); substate_idx++)
+	if (fp == NULL)
+	{
+		WriteLog("SaveState cannot open the substate %04X buffer\n", substate->type);
+		return 0;
+	}
+
+	size_t subtotal = substate->load(fp);
+	fclose(fp);
+
+	if (subtotal == -1)
+	{
+		WriteLog("SaveState substate %04X load error\n", substate->type);
+		return 0;
+	}
+
+	return 1;
+}
+
+// Write the segments, deflated with the fastest compression level (1) if requested
+// Returns 0 if the segments cannot be written
+static int StateWriteSegments(FILE *fp, const statesegment_t *segments, int count, bool compress)
+{
+	if (!compress)
+	{
+#if defined(_WIN32)
+		for (int i = 0; i < count; i++)
+		{
+			if (fwrite(segments[i].data, 1, segments[i].size, fp) != segments[i].size)
 			{
-				substate_t *substate = &substates[substate_idx];
-				DUMP32(substate->type);
-				DUMP32(substate->size);
-				size_t subtotal = substate->dump(fp);
-				if (subtotal == -1)
+				return 0;
+			}
+		}
+#else
+		if (fflush(fp) != 0)
+		{
+			return 0;
+		}
+
+		for (int first = 0; first < count; first += STATE_IOV_BATCH)
+		{
+			struct iovec iov[STATE_IOV_BATCH];
+			int iovcnt = 0;
+
+			for (int i = first; (i < count) && (i < (first + STATE_IOV_BATCH)); i++)
+			{
+				if (segments[i].size)
 				{
-					WriteLog("SaveState file %s error dumping %04X\n", save_sprintf_buf, substate->type);
-					goto error;
+					iov[iovcnt].iov_base = (void *)segments[i].data;
+					iov[iovcnt++].iov_len = segments[i].size;
 				}
-				else
+			}
+
+			for (struct iovec *vec = iov; iovcnt > 0;)
+			{
+				ssize_t written = writev(fileno(fp), vec, iovcnt);
+
+				if (written < 0)
 				{
-					long size_offset = total_dumped - sizeof(substate->type);
-					r = fseek(fp, size_offset, SEEK_SET);
-					if (r == -1)
-					{
-						WriteLog("fseek error %d: %s\n", errno, strerror(errno));
-						goto error;
-					}
-					else
+					if (errno == EINTR)
 					{
-						substate->size = (uint32_t)(subtotal & 0x7fffffff);
-						//WriteLog("dumping size %u at %ld\n", substate->size, size_offset);
-						DUMP32(substate->size);
-						total_dumped -= sizeof(substate->size);
-						total_dumped += subtotal;
-						r = fseek(fp, total_dumped, SEEK_SET);
-						if (r == -1)
-						{
-							WriteLog("fseek error %d: %s\n", errno, strerror(errno));
-							goto error;
-						}
-						else
-						{
-							WriteLog("SaveState file %s substate wrote %04X  size: %ld  pos now %ld\n", save_sprintf_buf, substate->type, subtotal, total_dumped);
-						}
+						continue;
 					}
-				}
-			}
 
-			fflush(fp);
-			fclose(fp);
+					return 0;
+				}
 
-			if (compress)
-			{
-				FILE *infp = fopen(save_sprintf_buf, "rb");
-				if (fp == NULL)
+				// Partial write, go on from where it has stopped
+				while ((iovcnt > 0) && ((size_t)written >= vec->iov_len))
 				{
-					WriteLog("SaveState file %s fopen failed\n", save_sprintf_buf);
-					return -1;
+					written -= vec->iov_len;
+					vec++, iovcnt--;
 				}
-				else
+
+				if (iovcnt > 0)
 				{
-					sprintf(save_sprintf_buf, save_file_pattern, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-					WriteLog("compressing save state to %s\n", save_sprintf_buf);
-					FILE *outfp = fopen(save_sprintf_buf, "wb");
-					if (fp == NULL)
-					{
-						WriteLog("SaveState file %s fopen failed\n", save_sprintf_buf);
-						fclose(infp);
-						return -1;
-					}
-					else
-					{
-						magic[2] = 0x01;
-						r = fwrite(magic, 1, 4, outfp);
-						if (r != 4)
-						{
-							WriteLog("SaveState file %s fwrite failed. error %d: %s\n", save_sprintf_buf, errno, strerror(errno));
-							fclose(outfp);
-							fclose(infp);
-							return -1;
-						}
-						else
-						{
-							r = fseek(infp, 4, SEEK_SET);
-							if (r == -1)
-							{
-								WriteLog("fseek error %d: %s\n", errno, strerror(errno));
-								fclose(outfp);
-								fclose(infp);
-								return -1;
-							}
-							else
-							{
-								// use the fastest compression level (1)
-								r = def(infp, outfp, 1);
-								if (r != Z_OK)
-								{
-									WriteLog("SaveState file %s deflate failed.", save_sprintf_buf);
-									fclose(outfp);
-									fclose(infp);
-									return -1;
-								}
-								else
-								{
-									fflush(outfp);
-									fclose(outfp);
-									fclose(infp);
-									sprintf(save_sprintf_buf, save_file_pattern_tmp, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-									remove(save_sprintf_buf);
-								}
-							}
-						}
-					}
+					vec->iov_base = (uint8_t *)vec->iov_base + written;
+					vec->iov_len -= written;
 				}
 			}
+		}
+#endif
+		return 1;
+	}
 
-			return total_dumped;
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
 
-error:
-			fclose(fp);
-			return -1;
+	if (deflateInit(&strm, 1) != Z_OK)
+	{
+		return 0;
+	}
+
+	uint8_t out[0x10000];
+	int ret = Z_OK;
+
+	for (int i = 0; i < count; i++)
+	{
+		strm.next_in = (Bytef *)segments[i].data;
+		strm.avail_in = (uInt)segments[i].size;
+		int flush = ((i == (count - 1)) ? Z_FINISH : Z_NO_FLUSH);
+
+		do
+		{
+			strm.next_out = out;
+			strm.avail_out = sizeof(out);
+			ret = deflate(&strm, flush);
+			size_t have = sizeof(out) - strm.avail_out;
+
+			if ((ret == Z_STREAM_ERROR) || (fwrite(out, 1, have, fp) != have))
+			{
+				deflateEnd(&strm);
+				return 0;
+			}
 		}
+		while (strm.avail_out == 0);
 	}
+
+	deflateEnd(&strm);
+	return (ret == Z_STREAM_END);
 }
 
-substate_t *find_substate(uint32_t type)
+// Inflate a compressed state, the file header is kept in front of the inflated data
+// The buffer must be freed by the caller; returns NULL if the state cannot be inflated
+static uint8_t *StateInflate(const uint8_t *buffer, size_t size, size_t *inflatedSize)
 {
-	for (int substate_idx = 0; substate_idx < sizeof(substates)/sizeof(substates[0]); substate_idx++)
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
+
+	if (inflateInit(&strm) != Z_OK)
 	{
-		substate_t *substate = &substates[substate_idx];
-		if (type == substate->type)
+		return NULL;
+	}
+
+	size_t bufferSize = ((size < (STATE_MAX_SIZE / 4)) ? STATE_ALIGN((size * 4) + 0x10000) : STATE_MAX_SIZE);
+	uint8_t *inflated = (uint8_t *)malloc(bufferSize);
+	size_t total = STATE_DIRECTORY;
+	int ret = Z_OK;
+
+	if (inflated != NULL)
+	{
+		memcpy(inflated, buffer, STATE_DIRECTORY);
+		strm.next_in = (Bytef *)(buffer + STATE_DIRECTORY);
+		strm.avail_in = (uInt)(size - STATE_DIRECTORY);
+	}
+
+	while ((inflated != NULL) && (ret == Z_OK))
+	{
+		if (total == bufferSize)
 		{
-			return substate;
+			uint8_t *larger = (((bufferSize * 2) <= STATE_MAX_SIZE) ? (uint8_t *)realloc(inflated, bufferSize * 2) : NULL);
+
+			if (larger == NULL)
+			{
+				WriteLog("SaveState inflated state too large\n");
+				free(inflated);
+				inflated = NULL;
+				break;
+			}
+
+			inflated = larger;
+			bufferSize *= 2;
+		}
+
+		strm.next_out = inflated + total;
+		strm.avail_out = (uInt)(bufferSize - total);
+		ret = inflate(&strm, Z_NO_FLUSH);
+		total = bufferSize - strm.avail_out;
+
+		// Room left in the buffer, the input has ended before the stream
+		if ((ret == Z_BUF_ERROR) && (total != bufferSize))
+		{
+			break;
+		}
+		else if (ret == Z_BUF_ERROR)
+		{
+			ret = Z_OK;
 		}
 	}
-	return NULL;
+
+	inflateEnd(&strm);
+
+	if ((inflated != NULL) && (ret != Z_STREAM_END))
+	{
+		WriteLog("SaveState inflate failed\n");
+		free(inflated);
+		return NULL;
+	}
+
+	*inflatedSize = total;
+	return inflated;
 }
 
-size_t CanTryToLoadSaveState(void)
+// Load the version 1 substates chunks
+// Returns 0 if the state cannot be loaded
+static int StateLoadChunks(const uint8_t *buffer, size_t size)
 {
-	if (save_slot == -1)
+	InitializeEventList();
+
+	for (size_t pos = STATE_DIRECTORY; (size - pos) >= 8;)
 	{
-		return -1;
+		uint32_t type = GET32(buffer, pos);
+		uint32_t chunkSize = GET32(buffer, pos + 4);
+		pos += 8;
+
+		if (chunkSize > (size - pos))
+		{
+			WriteLog("SaveState substate %04X truncated. size: %u  at %ld\n", type, chunkSize, (long)pos);
+			return 0;
+		}
+
+		substate_t *substate = find_substate(type);
+
+		if (substate == NULL)
+		{
+			WriteLog("SaveState substate %04X unknown. size: %u  at %ld\n", type, chunkSize, (long)pos);
+		}
+		else if (!StateLoadSubstate(substate, &buffer[pos], chunkSize))
+		{
+			return 0;
+		}
+
+		pos += chunkSize;
 	}
-	else
+
+	return 1;
+}
+
+// Load the version 2 sections
+// The whole directory is checked before anything is loaded; the memory sections are loaded
+// first, as the memory substate was in the chunks, and the unknown sections are skipped
+// Returns 0 if the state cannot be loaded
+static int StateLoadSections(const uint8_t *buffer, size_t size)
+{
+	if (size < (STATE_DIRECTORY + 4))
 	{
-		sprintf(save_sprintf_buf, save_file_pattern, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-		FILE *fp = fopen(save_sprintf_buf, "rb");
+		WriteLog("SaveState sections directory truncated\n");
+		return 0;
+	}
 
-		if (fp == NULL)
+	uint32_t count = GET32(buffer, STATE_DIRECTORY);
+	const uint8_t *directory = &buffer[STATE_DIRECTORY + 4];
+
+	if (count > ((size - STATE_DIRECTORY - 4) / sizeof(statesection_t)))
+	{
+		WriteLog("SaveState sections directory truncated (%u sections)\n", count);
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t type = GET32(directory, (i * sizeof(statesection_t)) + 0);
+		uint32_t offset = GET32(directory, (i * sizeof(statesection_t)) + 4);
+		uint32_t sectionSize = GET32(directory, (i * sizeof(statesection_t)) + 8);
+		uint32_t crc = GET32(directory, (i * sizeof(statesection_t)) + 12);
+		const memsection_t *memsection = find_memsection(type);
+
+		if ((offset > size) || (sectionSize > (size - offset)) || (memsection && (sectionSize != memsection->size))
+			|| (crc32(crc32(0L, Z_NULL, 0), (const Bytef *)&buffer[offset], sectionSize) != crc))
 		{
-			WriteLog("SaveState file %s fopen failed\n", save_sprintf_buf);
-			return -1;
+			WriteLog("SaveState section %04X invalid. offset: %u  size: %u\n", type, offset, sectionSize);
+			return 0;
 		}
-		else
-		{
-			size_t total_loaded = 0;
+	}
 
-			uint32_t magic;
-			LOAD32(magic);
-			fclose(fp);
+	OPSpecCancel();
+	InitializeEventList();
 
-			uint8_t firstByte = ((magic & 0xff000000) >> 24) & 0xff;
-			uint8_t secondByte = ((magic & 0x00ff0000) >> 16) & 0xff;
-			if ((firstByte != 'V') || (secondByte != 'J'))
+	for (int pass = 0; pass < 2; pass++)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t type = GET32(directory, (i * sizeof(statesection_t)) + 0);
+			const uint8_t *section = &buffer[GET32(directory, (i * sizeof(statesection_t)) + 4)];
+			uint32_t sectionSize = GET32(directory, (i * sizeof(statesection_t)) + 8);
+			const memsection_t *memsection = find_memsection(type);
+			substate_t *substate = find_substate(type);
+
+			if ((pass == 0) && (memsection != NULL))
 			{
-				WriteLog("SaveState file %s does not begin with VJ\n", save_sprintf_buf);
-				return -1;
+				memcpy(&jagMemSpace[memsection->start], section, memsection->size);
+				MemoryPagesWritten(memsection->start, memsection->size);
 			}
-			else
+			else if ((pass == 1) && (substate != NULL))
 			{
-				uint8_t compatibilityVersion = magic & 0xff;
-				if (compatibilityVersion > COMPATIBILITY_VERSION)
-				{
-					WriteLog("SaveState file %s incompatible version 0x%02X > 0x%02X\n", save_sprintf_buf, compatibilityVersion, COMPATIBILITY_VERSION);
-					return -1;
-				}
-				else
+				stateWithoutMemory = true;
+				int retVal = StateLoadSubstate(substate, section, sectionSize);
+				stateWithoutMemory = false;
+
+				if (!retVal)
 				{
 					return 0;
 				}
 			}
+			else if ((pass == 1) && (memsection == NULL))
+			{
+				WriteLog("SaveState section %04X unknown. size: %u\n", type, sectionSize);
+			}
 		}
 	}
+
+	return 1;
 }
- 
-size_t LoadSaveState(void)
+
+// Load a save state file contents, compressed or not, from any compatible version
+// Returns 0 if the state cannot be loaded
+int StateLoadFromFile(const uint8_t *buffer, size_t size)
 {
-	int r;
+	if ((size < STATE_DIRECTORY) || (buffer[0] != 'V') || (buffer[1] != 'J'))
+	{
+		WriteLog("SaveState does not begin with VJ\n");
+		return 0;
+	}
+
+	uint8_t compatibilityVersion = buffer[3];
+
+	if (compatibilityVersion > COMPATIBILITY_VERSION)
+	{
+		WriteLog("SaveState incompatible version 0x%02X > 0x%02X\n", compatibilityVersion, COMPATIBILITY_VERSION);
+		return 0;
+	}
 
+	uint8_t *inflated = NULL;
+
+	if (buffer[2] & 0x01)
+	{
+		if ((inflated = StateInflate(buffer, size, &size)) == NULL)
+		{
+			return 0;
+		}
+
+		buffer = inflated;
+	}
+
+	int retVal = ((compatibilityVersion <= STATE_VERSION_CHUNKS) ? StateLoadChunks(buffer, size) : StateLoadSections(buffer, size));
+	free(inflated);
+
+	// The sanitizer shadow belongs to the previous heap
+	if (retVal)
+	{
+		SanitizerForget();
+	}
+
+	return retVal;
+}
+
+// Save state file layout:
+// header, sections count & directory, substates sections, memory space sections
+// The substates are dumped without the memory space contents, which is written
+// straight from the memory space; the file is written as one gather write
+size_t DumpSaveState(void)
+{
+	if (save_slot == -1)
+	{
+		return -1;
+	}
+
+	uint32_t offsets[SECTIONS_COUNT], sizes[SECTIONS_COUNT];
+	size_t substatesSize;
+	stateWithoutMemory = true;
+	uint8_t *substatesBuffer = StateDumpSubstates(&substatesSize, offsets, sizes);
+	stateWithoutMemory = false;
+
+	if (substatesBuffer == NULL)
+	{
+		return -1;
+	}
+
+	uint8_t header[STATE_ALIGN(STATE_DIRECTORY + 4 + (SECTIONS_COUNT * sizeof(statesection_t)))];
+	memset(header, 0, sizeof(header));
+	header[0] = 'V';
+	header[1] = 'J';
+	header[2] = (vjs.compressSaveStates ? 0x01 : 0x00);
+	header[3] = COMPATIBILITY_VERSION;
+	SET32(header, STATE_DIRECTORY, SECTIONS_COUNT);
+
+	statesegment_t segments[3 + MEMSECTIONS_COUNT];
+	segments[0].data = header;
+	segments[0].size = STATE_DIRECTORY;
+	segments[1].data = &header[STATE_DIRECTORY];
+	segments[1].size = sizeof(header) - STATE_DIRECTORY;
+	segments[2].data = substatesBuffer;
+	segments[2].size = substatesSize;
+	size_t total_dumped = sizeof(header) + substatesSize;
+
+	for (int i = 0; i < SECTIONS_COUNT; i++)
+	{
+		uint8_t *entry = &header[STATE_DIRECTORY + 4 + (i * sizeof(statesection_t))];
+
+		if (i < SUBSTATES_COUNT)
+		{
+			uint32_t crc = (uint32_t)crc32(crc32(0L, Z_NULL, 0), (const Bytef *)&substatesBuffer[offsets[i]], sizes[i]);
+			SET32(entry, 0, substates[i].type);
+			SET32(entry, 4, (uint32_t)(sizeof(header) + offsets[i]));
+			SET32(entry, 8, sizes[i]);
+			SET32(entry, 12, crc);
+		}
+		else
+		{
+			const memsection_t *memsection = &memsections[i - SUBSTATES_COUNT];
+			segments[3 + i - SUBSTATES_COUNT].data = &jagMemSpace[memsection->start];
+			segments[3 + i - SUBSTATES_COUNT].size = memsection->size;
+			SET32(entry, 0, memsection->type);
+			SET32(entry, 4, (uint32_t)total_dumped);
+			SET32(entry, 8, memsection->size);
+			SET32(entry, 12, (uint32_t)crc32(crc32(0L, Z_NULL, 0), (const Bytef *)&jagMemSpace[memsection->start], memsection->size));
+			total_dumped += memsection->size;
+		}
+	}
+
+	// Written in a temporary file first, so the previous state is kept if something fails
+	sprintf(save_sprintf_buf, save_file_pattern_tmp, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
+	FILE *fp = fopen(save_sprintf_buf, "wb");
+
+	if (fp == NULL)
+	{
+		WriteLog("SaveState file %s fopen failed\n", save_sprintf_buf);
+		free(substatesBuffer);
+		return -1;
+	}
+
+	uint32_t m68kPC = m68k_get_reg(NULL, M68K_REG_PC);
+	WriteLog("SaveState file %s m68kPC: %08X\n", save_sprintf_buf, m68kPC);
+
+	// The file header is never compressed
+	int r = (StateWriteSegments(fp, segments, 1, false) && StateWriteSegments(fp, &segments[1], (sizeof(segments) / sizeof(segments[0])) - 1, vjs.compressSaveStates));
+	free(substatesBuffer);
+
+	if ((fclose(fp) != 0) || !r)
+	{
+		WriteLog("SaveState file %s write failed. error %d: %s\n", save_sprintf_buf, errno, strerror(errno));
+		remove(save_sprintf_buf);
+		return -1;
+	}
+
+	char tmpName[sizeof(save_sprintf_buf)];
+	strcpy(tmpName, save_sprintf_buf);
+	sprintf(save_sprintf_buf, save_file_pattern, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
+	remove(save_sprintf_buf);
+
+	if (rename(tmpName, save_sprintf_buf) != 0)
+	{
+		WriteLog("SaveState file %s rename failed. error %d: %s\n", save_sprintf_buf, errno, strerror(errno));
+		return -1;
+	}
+
+	return total_dumped;
+}
+
+// Dump the machine state substates in a memory buffer
+// The buffer must be freed by the caller; returns NULL if the state cannot be dumped
+uint8_t *StateDumpToMemory(size_t *size)
+{
+	return StateDumpSubstates(size, NULL, NULL);
+}
+
+// Load the machine state substates from a memory buffer made by StateDumpToMemory
+// Returns 0 if the state cannot be loaded
+int StateLoadFromMemory(const uint8_t *buffer, size_t size)
+{
+	FILE *fp = StateOpenBuffer(buffer, size);
+
+	if (fp == NULL)
+	{
+		WriteLog("StateLoadFromMemory: cannot open the state buffer\n");
+		return 0;
+	}
+
+	InitializeEventList();
+
+	for (int substate_idx = 0; substate_idx < SUBSTATES_COUNT; substate_idx++)
+	{
+		if (substates[substate_idx].load(fp) == -1)
+		{
+			WriteLog("StateLoadFromMemory: error loading %04X\n", substates[substate_idx].type);
+			fclose(fp);
+			return 0;
+		}
+	}
+
+	fclose(fp);
+	return 1;
+}
+
+// Dump the chips state, without the memory space contents
+// The buffer must be freed by the caller; returns NULL if the state cannot be dumped
+uint8_t *StateDumpChipsToMemory(size_t *size)
+{
+	stateWithoutMemory = true;
+	uint8_t *buffer = StateDumpToMemory(size);
+	stateWithoutMemory = false;
+	return buffer;
+}
+
+// Load the chips state made by StateDumpChipsToMemory, the memory space is left as it is
+// Returns 0 if the state cannot be loaded
+int StateLoadChipsFromMemory(const uint8_t *buffer, size_t size)
+{
+	stateWithoutMemory = true;
+	int retVal = StateLoadFromMemory(buffer, size);
+	stateWithoutMemory = false;
+	return retVal;
+}
+
+// CRC32 of the machine state, as the substates would be dumped
+// Used to compare runs; returns 0 if the state cannot be dumped
+uint32_t StateCRC32(void)
+{
+	size_t size;
+	uint8_t *buffer = StateDumpToMemory(&size);
+
+	if (buffer == NULL)
+	{
+		return 0;
+	}
+
+	uint32_t crc = crc32(crc32(0L, Z_NULL, 0), (const Bytef *)buffer, (uInt)size);
+	free(buffer);
+	return crc;
+}
+
+size_t CanTryToLoadSaveState(void)
+{
 	if (save_slot == -1)
 	{
 		return -1;
@@ -540,12 +1057,13 @@ size_t LoadSaveState(void)
 
 			uint32_t magic;
 			LOAD32(magic);
+			fclose(fp);
+
 			uint8_t firstByte = ((magic & 0xff000000) >> 24) & 0xff;
 			uint8_t secondByte = ((magic & 0x00ff0000) >> 16) & 0xff;
 			if ((firstByte != 'V') || (secondByte != 'J'))
 			{
 				WriteLog("SaveState file %s does not begin with VJ\n", save_sprintf_buf);
-				fclose(fp);
 				return -1;
 			}
 			else
@@ -554,302 +1072,117 @@ size_t LoadSaveState(void)
 				if (compatibilityVersion > COMPATIBILITY_VERSION)
 				{
 					WriteLog("SaveState file %s incompatible version 0x%02X > 0x%02X\n", save_sprintf_buf, compatibilityVersion, COMPATIBILITY_VERSION);
-					fclose(fp);
 					return -1;
 				}
 				else
 				{
-					uint8_t thirdByte = ((magic & 0x0000ff00) >> 8) & 0xff;
-					bool compressed = (thirdByte & 0x01) == 0x01;
-					if (compressed)
-					{
-						sprintf(save_sprintf_buf, save_file_pattern_tmp, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-						WriteLog("decompressing save state to %s\n", save_sprintf_buf);
-						FILE *outfp = fopen(save_sprintf_buf, "wb");
-						if (outfp == NULL)
-						{
-							WriteLog("SaveState file %s fopen failed\n", save_sprintf_buf);
-							return -1;
-						}
-						else
-						{
-							uint8_t magicBytes[4] = { 'V', 'J', 0x00, compatibilityVersion };
-							r = fwrite(magicBytes, 1, 4, outfp);
-							if (r != 4)
-							{
-								WriteLog("SaveState file %s fwrite failed. error %d: %s\n", save_sprintf_buf, errno, strerror(errno));
-								fclose(outfp);
-								fclose(fp);
-								return -1;
-							}
-							else
-							{
-								r = inf(fp, outfp);
-								if (r != Z_OK)
-								{
-									WriteLog("SaveState file %s inflate failed.", save_sprintf_buf);
-									fclose(outfp);
-									fclose(fp);
-									return -1;
-								}
-								else
-								{
-									fflush(outfp);
-									fclose(outfp);
-									fclose(fp);
-
-									sprintf(save_sprintf_buf, save_file_pattern_tmp, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-									fp = fopen(save_sprintf_buf, "rb");
-									if (fp == NULL)
-									{
-										WriteLog("SaveState file %s fopen failed after decompression\n", save_sprintf_buf);
-										return -1;
-									}
-									else
-									{
-										total_loaded = 4;
-										r = fseek(fp, total_loaded, SEEK_SET);
-										if (r == -1)
-										{
-											WriteLog("SaveState fseek error %d: %s\n", errno, strerror(errno));
-											goto error;
-										}
-									}
-								}
-
-								InitializeEventList();
-
-								while (!feof(fp) && !ferror(fp))
-								{
-									//WriteLog("ftell: %ld  feof: %d\n", ftell(fp), feof(fp));
-									uint32_t type;
-									uint32_t size;
-
-									if (fread(&type, sizeof(type), 1, fp) != 1)
-									{
-										break;
-									}
-									total_loaded += sizeof(type);
-									type = FTOH32(type);
-
-									LOAD32(size);
-									substate_t *substate = find_substate(type);
-									if (substate == NULL)
-									{
-										WriteLog("SaveState file %s substate %04X unknown. size: %u  at %ld\n", save_sprintf_buf, type, substate, size, total_loaded);
-										total_loaded += size;
-										r = fseek(fp, total_loaded, SEEK_SET);
-										if (r == -1)
-										{
-											WriteLog("SaveState fseek error %d: %s\n", errno, strerror(errno));
-											goto error;
-										}
-									}
-									else
-									{
-										WriteLog("SaveState file %s substate %04X  size: %u  starting load at %ld\n", save_sprintf_buf, type, size, total_loaded);
-										size_t subtotal = substate->load(fp);
-										if (subtotal == -1)
-										{
-											WriteLog("SaveState file %s substate %04X load error\n", save_sprintf_buf, type);
-											goto error;
-										}
-										WriteLog("SaveState file %s substate %04X  subtotal %ld  size: %u  at %ld\n", save_sprintf_buf, type, subtotal, size, total_loaded);
-										total_loaded += size;
-										size_t diff = size - subtotal;
-										if (diff > 0)
-										{
-											// skip
-											r = fseek(fp, total_loaded, SEEK_SET);
-											if (r == -1)
-											{
-												WriteLog("SaveState fseek error %d: %s\n", errno, strerror(errno));
-												goto error;
-											}
-										}
-									}
-								}
-								//if (feof(fp)) {
-								//  WriteLog("load eof at %ld  ftell: %ld\n", total_loaded, ftell(fp));
-								//}
-								if (ferror(fp))
-								{
-									WriteLog("SaveState load ferror %d: %s\n", errno, strerror(errno));
-								}
-
-								{
-									uint32_t m68kPC = m68k_get_reg(NULL, M68K_REG_PC);
-									WriteLog("SaveState file %s loaded m68kPC: %08X\n",	save_sprintf_buf, m68kPC);
-								}
-
-								fclose(fp);
-
-								if (compressed)
-								{
-									sprintf(save_sprintf_buf, save_file_pattern_tmp, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
-									remove(save_sprintf_buf);
-								}
-
-								return total_loaded;
-
-error:
-								fclose(fp);
-								return -1;
-							}
-						}
-					}
+					return 0;
 				}
 			}
 		}
 	}
 }
 
-/* zpipe.c: example of proper use of zlib's inflate() and deflate()
-   Not copyrighted -- provided to the public domain
-   Version 1.4  11 December 2005  Mark Adler */
-
-/* Version history:
-   1.0  30 Oct 2004  First version
-   1.1   8 Nov 2004  Add void casting for unused return values
-                     Use switch statement for inflate() return values
-   1.2   9 Nov 2004  Add assertions to document zlib guarantees
-   1.3   6 Apr 2005  Remove incorrect assertion in inf()
-   1.4  11 Dec 2005  Add hack to avoid MSDOS end-of-line conversions
-                     Avoid some compiler warnings for input and output buffers
- */
-
-#include <stdio.h>
-#include <string.h>
-#include <assert.h>
+// Map the save state file, or read it if it cannot be mapped
+// Returns NULL if the file cannot be opened; *mapped tells how to release it
+static uint8_t *StateMapFile(const char *path, size_t *size, bool *mapped)
+{
+	*mapped = false;
+#if defined(_WIN32)
+	FILE *fp = fopen(path, "rb");
 
-#if defined(MSDOS) || defined(OS2) || defined(WIN32) || defined(__CYGWIN__)
-#  include <fcntl.h>
-#  include <io.h>
-#  define SET_BINARY_MODE(file) setmode(fileno(file), O_BINARY)
+	if (fp == NULL)
+	{
+		return NULL;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	*size = (size_t)ftell(fp);
+	rewind(fp);
+	uint8_t *data = (uint8_t *)malloc(*size ? *size : 1);
+
+	if ((data != NULL) && (fread(data, 1, *size, fp) != *size))
+	{
+		free(data);
+		data = NULL;
+	}
+
+	fclose(fp);
+	return data;
 #else
-#  define SET_BINARY_MODE(file)
-#endif
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+	{
+		return NULL;
+	}
 
-#define CHUNK 16384
+	struct stat st;
 
-/* Compress from file source to file dest until EOF on source.
-   def() returns Z_OK on success, Z_MEM_ERROR if memory could not be
-   allocated for processing, Z_STREAM_ERROR if an invalid compression
-   level is supplied, Z_VERSION_ERROR if the version of zlib.h and the
-   version of the library linked do not match, or Z_ERRNO if there is
-   an error reading or writing the files. */
-int def(FILE *source, FILE *dest, int level)
-{
-    int ret, flush;
-    unsigned have;
-    z_stream strm;
-    unsigned char in[CHUNK];
-    unsigned char out[CHUNK];
-
-    /* allocate deflate state */
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    ret = deflateInit(&strm, level);
-    if (ret != Z_OK)
-        return ret;
-
-    /* compress until end of file */
-    do {
-        strm.avail_in = fread(in, 1, CHUNK, source);
-        if (ferror(source)) {
-            (void)deflateEnd(&strm);
-            return Z_ERRNO;
-        }
-        flush = feof(source) ? Z_FINISH : Z_NO_FLUSH;
-        strm.next_in = in;
-
-        /* run deflate() on input until output buffer not full, finish
-           compression if all of source has been read in */
-        do {
-            strm.avail_out = CHUNK;
-            strm.next_out = out;
-            ret = deflate(&strm, flush);    /* no bad return value */
-            assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-            have = CHUNK - strm.avail_out;
-            if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-                (void)deflateEnd(&strm);
-                return Z_ERRNO;
-            }
-        } while (strm.avail_out == 0);
-        assert(strm.avail_in == 0);     /* all input will be used */
-
-        /* done when last data in file processed */
-    } while (flush != Z_FINISH);
-    assert(ret == Z_STREAM_END);        /* stream will be complete */
-
-    /* clean up and return */
-    (void)deflateEnd(&strm);
-    return Z_OK;
+	if ((fstat(fd, &st) != 0) || !st.st_size)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	*size = (size_t)st.st_size;
+	void *data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (data != MAP_FAILED)
+	{
+		*mapped = true;
+	}
+	else if (((data = malloc(*size)) != NULL) && (pread(fd, data, *size, 0) != (ssize_t)*size))
+	{
+		free(data);
+		data = NULL;
+	}
+
+	close(fd);
+	return (uint8_t *)data;
+#endif
 }
 
-/* Decompress from file source to file dest until stream ends or EOF.
-   inf() returns Z_OK on success, Z_MEM_ERROR if memory could not be
-   allocated for processing, Z_DATA_ERROR if the deflate data is
-   invalid or incomplete, Z_VERSION_ERROR if the version of zlib.h and
-   the version of the library linked do not match, or Z_ERRNO if there
-   is an error reading or writing the files. */
-int inf(FILE *source, FILE *dest)
+size_t LoadSaveState(void)
 {
-    int ret;
-    unsigned have;
-    z_stream strm;
-    unsigned char in[CHUNK];
-    unsigned char out[CHUNK];
-
-    /* allocate inflate state */
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    strm.avail_in = 0;
-    strm.next_in = Z_NULL;
-    ret = inflateInit(&strm);
-    if (ret != Z_OK)
-        return ret;
-
-    /* decompress until deflate stream ends or end of file */
-    do {
-        strm.avail_in = fread(in, 1, CHUNK, source);
-        if (ferror(source)) {
-            (void)inflateEnd(&strm);
-            return Z_ERRNO;
-        }
-        if (strm.avail_in == 0)
-            break;
-        strm.next_in = in;
-
-        /* run inflate() on input until output buffer not full */
-        do {
-            strm.avail_out = CHUNK;
-            strm.next_out = out;
-            ret = inflate(&strm, Z_NO_FLUSH);
-            assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-            switch (ret) {
-            case Z_NEED_DICT:
-                ret = Z_DATA_ERROR;     /* and fall through */
-            case Z_DATA_ERROR:
-            case Z_MEM_ERROR:
-                (void)inflateEnd(&strm);
-                return ret;
-            }
-            have = CHUNK - strm.avail_out;
-            if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-                (void)inflateEnd(&strm);
-                return Z_ERRNO;
-            }
-        } while (strm.avail_out == 0);
-
-        /* done when inflate() says it's done */
-    } while (ret != Z_STREAM_END);
-
-    /* clean up and return */
-    (void)inflateEnd(&strm);
-    return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
+	if (save_slot == -1)
+	{
+		return -1;
+	}
+
+	sprintf(save_sprintf_buf, save_file_pattern, vjs.SaveStatePath, (unsigned int)jaguarMainROMCRC32, save_slot);
+	size_t size;
+	bool mapped;
+	uint8_t *data = StateMapFile(save_sprintf_buf, &size, &mapped);
+
+	if (data == NULL)
+	{
+		WriteLog("SaveState file %s open failed\n", save_sprintf_buf);
+		return -1;
+	}
+
+	int r = StateLoadFromFile(data, size);
+
+#if !defined(_WIN32)
+	if (mapped)
+	{
+		munmap(data, size);
+	}
+	else
+#endif
+	{
+		free(data);
+	}
+
+	if (!r)
+	{
+		WriteLog("SaveState file %s load failed\n", save_sprintf_buf);
+		return -1;
+	}
+
+	uint32_t m68kPC = m68k_get_reg(NULL, M68K_REG_PC);
+	WriteLog("SaveState file %s loaded m68kPC: %08X\n", save_sprintf_buf, m68kPC);
+	return size;
 }
 #if 0
 bool SaveState(void)
@@ -11,6 +11,14 @@
 //
 // Who  When        What
 // JPM  March/2022  Added, and modified, the save state patch from PvtLewis
+// JPM   Oct./2026  Added the machine state CRC32
+// JPM   Oct./2026  Machine state dump & load in memory
+// JPM   Oct./2026  Chips state dump & load without the memory space contents
+// JPM   Oct./2026  Save state file contents load
+// JPM   Oct./2026  Main bus arbitration substate
+// JPM   Oct./2026  Arrays indexed by a size_t
+// JPM   Oct./2026  Butch word clock substate
+// JPM   Oct./2026  ASI substate
 //
 
 #ifndef __STATE_H__
@@ -49,6 +57,12 @@ inline uint64_t htonll(uint64_t value)
 extern size_t DumpSaveState(void);
 extern size_t LoadSaveState(void);
 extern size_t CanTryToLoadSaveState(void);
+extern uint32_t StateCRC32(void);
+extern uint8_t *StateDumpToMemory(size_t *size);
+extern int StateLoadFromMemory(const uint8_t *buffer, size_t size);
+extern uint8_t *StateDumpChipsToMemory(size_t *size);
+extern int StateLoadChipsFromMemory(const uint8_t *buffer, size_t size);
+extern int StateLoadFromFile(const uint8_t *buffer, size_t size);
 
 #define DUMP(_x) do { if (fwrite(&_x, sizeof(_x), 1, fp) != 1) { /* WriteLog("SaveState DUMP error at %s:%d\n", __FILE__, __LINE__); */ return -1; } total_dumped += sizeof(_x); } while (0)
 #define DUMPBYTES(_x, _len) do { int _r; _r = fwrite(_x, 1, _len, fp); if (_r != _len) { /* WriteLog("SaveState DUMP error at %s:%d: expected %d got %d\n", __FILE__, __LINE__, _len, _r); */ return -1; } total_dumped += _len; } while (0)
@@ -91,10 +105,10 @@ extern size_t CanTryToLoadSaveState(void);
 
 #define DUMPARR8(_z) DUMPBYTES(_z, sizeof(_z))
 #define LOADARR8(_z) LOADBYTES(_z, sizeof(_z))
-#define DUMPARR16(_z) do { uint16_t _tmp_arr[sizeof(_z)/sizeof(_z[0])]; for (int _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _tmp_arr[_arr_idx] = HTOF16(_z[_arr_idx]); } DUMPARR(_tmp_arr); } while (0)
-#define LOADARR16(_z) do { LOADARR(_z); for (int _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _z[_arr_idx] = FTOH16(_z[_arr_idx]); } } while (0)
-#define DUMPARR32(_z) do { uint32_t _tmp_arr[sizeof(_z)/sizeof(_z[0])]; for (int _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _tmp_arr[_arr_idx] = HTOF32(_z[_arr_idx]); } DUMPARR(_tmp_arr); } while (0)
-#define LOADARR32(_z) do { LOADARR(_z); for (int _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _z[_arr_idx] = FTOH32(_z[_arr_idx]); } } while (0)
+#define DUMPARR16(_z) do { uint16_t _tmp_arr[sizeof(_z)/sizeof(_z[0])]; for (size_t _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _tmp_arr[_arr_idx] = HTOF16(_z[_arr_idx]); } DUMPARR(_tmp_arr); } while (0)
+#define LOADARR16(_z) do { LOADARR(_z); for (size_t _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _z[_arr_idx] = FTOH16(_z[_arr_idx]); } } while (0)
+#define DUMPARR32(_z) do { uint32_t _tmp_arr[sizeof(_z)/sizeof(_z[0])]; for (size_t _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _tmp_arr[_arr_idx] = HTOF32(_z[_arr_idx]); } DUMPARR(_tmp_arr); } while (0)
+#define LOADARR32(_z) do { LOADARR(_z); for (size_t _arr_idx = 0; _arr_idx < sizeof(_z)/sizeof(_z[0]); _arr_idx++) { _z[_arr_idx] = FTOH32(_z[_arr_idx]); } } while (0)
 
 // dump/load functions for each subsystem
 
@@ -109,6 +123,10 @@ extern size_t tom_dump (FILE *);
 extern size_t tom_load (FILE *);
 extern size_t jerry_dump (FILE *);
 extern size_t jerry_load (FILE *);
+extern size_t jerryi2s_dump (FILE *);
+extern size_t jerryi2s_load (FILE *);
+extern size_t asi_dump (FILE *);
+extern size_t asi_load (FILE *);
 extern size_t op_dump (FILE *);
 extern size_t op_load (FILE *);
 extern size_t blitter_dump (FILE *fp);
@@ -127,6 +145,8 @@ extern size_t joystick_dump (FILE *fp);
 extern size_t joystick_load (FILE *fp);
 extern size_t cdrom_dump (FILE *fp);
 extern size_t cdrom_load (FILE *fp);
+extern size_t bus_dump (FILE *fp);
+extern size_t bus_load (FILE *fp);
 #ifdef __cplusplus
 }
 #endif
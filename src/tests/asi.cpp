@@ -0,0 +1,381 @@
+//
+// JERRY asynchronous serial interface, looped back by a socket client
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Stream at the fastest clock, and save state
+//
+
+#include "coretest.h"
+
+#include "asi.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "settings.h"
+#include "state.h"
+#include "m68000/m68kinterface.h"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define ASITEST_FRAMES		600						// Frames run, at the most, for a character
+#define ASITEST_TIMEOUT		1000					// Host wait, in ms
+
+// Registers offsets
+#define ASITEST_DATA		0xF10030
+#define ASITEST_STAT		0xF10032
+#define ASITEST_CLK			0xF10034
+
+// Stream echoed by the client, the received bytes are written by the program in a buffer
+#define ASITEST_STREAM		0x100000				// 1 MB
+#define ASITEST_BUFFER		0x080000
+#define ASITEST_STREAM_FRAMES	3000
+
+static const char asiTestMessage[] = "Atari Jaguar, 64 bits\r\n";
+
+
+//
+// Socket client of the host end, -1 if it cannot connect
+//
+static int ASITestConnect(const char * path)
+{
+	struct sockaddr_un address;
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	snprintf(address.sun_path, sizeof(address.sun_path), "%s", path);
+
+	if ((fd >= 0) && connect(fd, (struct sockaddr *)&address, sizeof(address)))
+	{
+		close(fd);
+		fd = -1;
+	}
+
+	return fd;
+}
+
+
+//
+// Bytes read by the client, up to the size, or until the timeout
+//
+static size_t ASITestHostRead(int fd, char * buffer, size_t size)
+{
+	struct pollfd pfd = { fd, POLLIN, 0 };
+	size_t count = 0;
+
+	while ((count < size) && (poll(&pfd, 1, ASITEST_TIMEOUT) > 0))
+	{
+		ssize_t n = read(fd, &buffer[count], size - count);
+
+		if (n <= 0)
+		{
+			break;
+		}
+
+		count += n;
+	}
+
+	return count;
+}
+
+
+//
+// Files opened by the process
+//
+static uint32_t ASITestOpenFiles(void)
+{
+	DIR * dir = opendir("/proc/self/fd");
+	uint32_t count = 0;
+
+	while (dir && readdir(dir))
+	{
+		count++;
+	}
+
+	if (dir)
+	{
+		closedir(dir);
+	}
+
+	return count;
+}
+
+
+//
+// Frames run until the status bit is set, false if it does not come
+//
+static bool ASITestWait(uint16_t bit)
+{
+	for (uint32_t i = 0; i < ASITEST_FRAMES; i++)
+	{
+		if (ASIReadWord(ASITEST_STAT, M68K) & bit)
+		{
+			return true;
+		}
+
+		CoreTestRunFrames(1);
+		// The host I/O thread runs along
+		usleep(1000);
+	}
+
+	return false;
+}
+
+
+//
+// 68K program: a byte sent when the transmit buffer is empty, a byte received
+// when the receive buffer is full, until the whole stream is back
+// The byte i is (i + (i >> 8)) & $FF, so a lost or doubled byte changes the sequence
+//
+static const uint16_t asiTestStreamProgram[] =
+{
+	0x207C, 0x00F1, 0x0030,		// MOVEA.L #ASIDATA, A0
+	0x227C, 0x0008, 0x0000,		// MOVEA.L #BUFFER, A1
+	0x247C, 0x0018, 0x0000,		// MOVEA.L #BUFFER + STREAM, A2
+	0x7200,						// MOVEQ #0, D1
+	0x263C, 0x0010, 0x0000,		// MOVE.L #STREAM, D3
+	0x3028, 0x0002,				// loop: MOVE.W 2(A0), D0
+	0x0800, 0x0007,				// BTST #7, D0 (RBF)
+	0x6704,						// BEQ.S send
+	0x3810,						// MOVE.W (A0), D4
+	0x12C4,						// MOVE.B D4, (A1)+
+	0xB283,						// send: CMP.L D3, D1
+	0x6710,						// BEQ.S next
+	0x0800, 0x0008,				// BTST #8, D0 (TBE)
+	0x670A,						// BEQ.S next
+	0x2401,						// MOVE.L D1, D2
+	0xE08A,						// LSR.L #8, D2
+	0xD401,						// ADD.B D1, D2
+	0x3082,						// MOVE.W D2, (A0)
+	0x5281,						// ADDQ.L #1, D1
+	0xB3CA,						// next: CMPA.L A2, A1
+	0x66DA,						// BNE.S loop
+	0x60FE						// BRA.S *
+};
+
+
+static inline uint8_t ASITestStreamByte(uint32_t i)
+{
+	return (uint8_t)(i + (i >> 8));
+}
+
+
+//
+// Client echoing the stream back, the bytes count & sequence are checked
+// It gives up if nothing comes or goes for the timeout
+//
+static void ASITestEcho(int fd, uint32_t * received, bool * sequence)
+{
+	static uint8_t buffer[0x1000];
+	struct pollfd pfd = { fd, POLLIN, 0 };
+
+	fcntl(fd, F_SETFL, O_NONBLOCK);
+	*received = 0;
+	*sequence = true;
+
+	while ((*received < ASITEST_STREAM) && (poll(&pfd, 1, ASITEST_TIMEOUT * 5) > 0))
+	{
+		ssize_t n = read(fd, buffer, sizeof(buffer));
+
+		if (n <= 0)
+		{
+			break;
+		}
+
+		for (ssize_t i = 0; i < n; i++)
+		{
+			*sequence = *sequence && (buffer[i] == ASITestStreamByte(*received + i));
+		}
+
+		*received += n;
+
+		for (ssize_t sent = 0; sent < n; )
+		{
+			struct pollfd wfd = { fd, POLLOUT, 0 };
+			ssize_t w = ((poll(&wfd, 1, ASITEST_TIMEOUT * 5) > 0) ? write(fd, &buffer[sent], n - sent) : -1);
+
+			if (w <= 0)
+			{
+				return;
+			}
+
+			sent += w;
+		}
+	}
+
+	// Nothing more than the stream
+	if (*received == ASITEST_STREAM)
+	{
+		usleep(ASITEST_TIMEOUT * 100);
+		*received += ((read(fd, buffer, sizeof(buffer)) > 0) ? 1 : 0);
+	}
+}
+
+
+//
+// Characters sent to the client, echoed back, and received
+// The debugger reads leave the received character in the buffer
+//
+CORE_TEST(ASILoopback)
+{
+	const uint16_t idle[] = { 0x60FE };				// BRA.S *
+	char path[64], echo[sizeof(asiTestMessage)];
+	size_t length = strlen(asiTestMessage);
+
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, idle, 1);
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+	snprintf(path, sizeof(path), "/tmp/vj-asitest-%d", (int)getpid());
+	snprintf(vjs.asiHost, sizeof(vjs.asiHost), "%s", path);
+	ASIReset();
+	CORE_CHECK(ASIHostName() && !strcmp(ASIHostName(), path));
+	int fd = ASITestConnect(path);
+	bool passed = (fd >= 0);
+
+	for (size_t i = 0; passed && (i < length); i++)
+	{
+		passed = ASITestWait(ASI_STAT_TBE);
+		ASIWriteWord(ASITEST_DATA, (uint8_t)asiTestMessage[i], M68K);
+	}
+
+	// The last character shifted out
+	CoreTestRunFrames(1);
+	passed = passed && (ASITestHostRead(fd, echo, length) == length) && !memcmp(echo, asiTestMessage, length);
+	passed = passed && (write(fd, echo, length) == (ssize_t)length);
+
+	for (size_t i = 0; passed && (i < length); i++)
+	{
+		passed = ASITestWait(ASI_STAT_RBF);
+		passed = passed && ((ASIReadWord(ASITEST_DATA, DEBUG) & 0xFF) == (uint8_t)asiTestMessage[i]);
+		passed = passed && (ASIReadWord(ASITEST_STAT, DEBUG) & ASI_STAT_RBF);
+		passed = passed && ((ASIReadWord(ASITEST_DATA, M68K) & 0xFF) == (uint8_t)asiTestMessage[i]);
+		passed = passed && !(ASIReadWord(ASITEST_STAT, M68K) & ASI_STAT_RBF);
+	}
+
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+
+	vjs.asiHost[0] = 0;
+	ASIReset();
+	CORE_CHECK(ASIHostName() == NULL);
+	CORE_CHECK(access(path, F_OK) != 0);
+	CORE_CHECK(passed);
+	return true;
+}
+
+
+//
+// 1 MB sent to the client at the fastest clock, echoed back, and received
+//
+CORE_TEST(ASIStream)
+{
+	char path[64];
+	uint32_t received = 0;
+	bool sequence = false;
+
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, asiTestStreamProgram, sizeof(asiTestStreamProgram) / sizeof(asiTestStreamProgram[0]));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+	snprintf(path, sizeof(path), "/tmp/vj-asitest-%d", (int)getpid());
+	snprintf(vjs.asiHost, sizeof(vjs.asiHost), "%s", path);
+	ASIReset();
+	ASIWriteWord(ASITEST_CLK, 0, M68K);
+	int fd = ASITestConnect(path);
+	CORE_CHECK(fd >= 0);
+	std::thread client(ASITestEcho, fd, &received, &sequence);
+
+	const uint32_t end = CORETEST_RUN_ADDRESS + (sizeof(asiTestStreamProgram) - 2);
+	uint32_t frames = 0;
+
+	while ((frames < ASITEST_STREAM_FRAMES) && (m68k_get_reg(NULL, M68K_REG_PC) != end))
+	{
+		CoreTestRunFrames(1);
+		frames++;
+	}
+
+	client.join();
+	close(fd);
+	vjs.asiHost[0] = 0;
+	ASIReset();
+
+	bool echoed = true;
+
+	for (uint32_t i = 0; echoed && (i < ASITEST_STREAM); i++)
+	{
+		echoed = (jaguarMainRAM[ASITEST_BUFFER + i] == ASITestStreamByte(i));
+	}
+
+	printf("    %u bytes echoed in %u frames\n", received, frames);
+	CORE_CHECK(m68k_get_reg(NULL, M68K_REG_PC) == end);
+	CORE_CHECK_EQUAL(m68k_get_reg(NULL, M68K_REG_D1), ASITEST_STREAM);
+	CORE_CHECK_EQUAL(received, ASITEST_STREAM);
+	CORE_CHECK(sequence);
+	CORE_CHECK(echoed);
+	return true;
+}
+
+
+//
+// UART buffers & shift register carried over a state load
+//
+CORE_TEST(ASIStateLoad)
+{
+	size_t size;
+
+	ASIWriteWord(ASITEST_CLK, 20, M68K);
+	ASIWriteWord(ASITEST_STAT, ASI_CTRL_PAREN, M68K);
+	ASIWriteWord(ASITEST_DATA, 0x55, M68K);
+	ASIWriteWord(ASITEST_DATA, 0xAA, M68K);
+	uint16_t status = ASIReadWord(ASITEST_STAT, M68K);
+	uint8_t * state = StateDumpToMemory(&size);
+	CORE_CHECK(state != NULL);
+
+	ASIReset();
+	int loaded = StateLoadFromMemory(state, size);
+	free(state);
+	CORE_CHECK(loaded);
+	CORE_CHECK_EQUAL(ASIReadWord(ASITEST_STAT, M68K), status);
+	CORE_CHECK_EQUAL(ASIReadWord(ASITEST_CLK, M68K), 20);
+	CORE_CHECK(!(status & ASI_STAT_TBE));
+
+	// Both characters shifted out, 2 x 11 x 16 x 21 system clocks
+	CoreTestRunFrames(1);
+	CORE_CHECK(ASIReadWord(ASITEST_STAT, M68K) & ASI_STAT_TBE);
+	return true;
+}
+
+
+//
+// Socket path longer than the socket address, the host end is not opened, and nothing is left open
+//
+CORE_TEST(ASISocketPathTooLong)
+{
+	uint32_t files = ASITestOpenFiles();
+
+	memset(vjs.asiHost, 'a', sizeof(vjs.asiHost) - 1);
+	vjs.asiHost[0] = '/';
+	vjs.asiHost[sizeof(vjs.asiHost) - 1] = 0;
+	ASIReset();
+	CORE_CHECK(ASIHostName() == NULL);
+	CORE_CHECK_EQUAL(ASITestOpenFiles(), files);
+
+	vjs.asiHost[0] = 0;
+	ASIReset();
+	return true;
+}
+#endif
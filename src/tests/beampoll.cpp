@@ -0,0 +1,135 @@
+//
+// 68K HC & VC polling loops fast-forward, cycle for cycle the same as the loops run
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <vector>
+#include <zlib.h>
+#include "hooks.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "settings.h"
+#include "state.h"
+#include "tom.h"
+#include "m68000/m68kinterface.h"
+
+#define BEAMPOLLTEST_FRAMES		10
+#define BEAMPOLLTEST_TRAIL		0x10000				// Counts & HC values written by the program
+#define BEAMPOLLTEST_TRAIL_SIZE	0x10000
+
+static std::vector<uint32_t> beamPollTestCRCs;
+
+
+//
+// 68K program: wait for the next halfline (VC), then for the second half of it (HC), written in a trail
+//
+static const uint16_t beamPollTestProgram[] =
+{
+	0x7400,						// MOVEQ #0, D2
+	0x41F9, 0x0001, 0x0000,		// LEA $10000, A0
+	0x3039, 0x00F0, 0x0006,		// vc: MOVE.W VC, D0
+	0xB240,						// CMP.W D0, D1
+	0x67F6,						// BEQ.S vc
+	0x3200,						// MOVE.W D0, D1
+	0x5282,						// ADDQ.L #1, D2
+	0x20C2,						// MOVE.L D2, (A0)+
+	0x3639, 0x00F0, 0x0004,		// hc: MOVE.W HC, D3
+	0x0243, 0x03FF,				// ANDI.W #$3FF, D3
+	0x0C43, 0x0001,				// CMPI.W #1, D3
+	0x65F0,						// BCS.S hc
+	0x30C3,						// MOVE.W D3, (A0)+
+	0xB1FC, 0x0002, 0x0000,		// CMPA.L #$20000, A0
+	0x65D6,						// BCS.S vc
+	0x41F9, 0x0001, 0x0000,		// LEA $10000, A0
+	0x60CE						// BRA.S vc
+};
+
+
+//
+// Trail, 68K registers & instructions count at each halfline
+//
+static void BeamPollTestHalfline(void * userData, uint32_t vc, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+	(void)userData; (void)vc; (void)arg1; (void)arg2; (void)arg3;
+	uint32_t regs[18];
+
+	for (uint32_t i = 0; i < 18; i++)
+	{
+		regs[i] = m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + i));
+	}
+
+	uint32_t crc = crc32(0, &jaguarMainRAM[BEAMPOLLTEST_TRAIL], BEAMPOLLTEST_TRAIL_SIZE);
+	crc = crc32(crc, (uint8_t *)regs, sizeof(regs));
+	beamPollTestCRCs.push_back(crc32(crc, (uint8_t *)&m68kInstructionCount, sizeof(m68kInstructionCount)));
+}
+
+
+//
+// Frames run with the fast-forward setting, the halflines CRC32, the state CRC32 at each frame
+// & the iterations fast-forwarded are returned
+//
+static void BeamPollTestRun(bool skip, std::vector<uint32_t> & crcs, std::vector<uint32_t> & states, uint64_t & hc, uint64_t & vc)
+{
+	uint64_t hcBefore, vcBefore;
+
+	CoreTestReset();
+	vjs.beamPollSkip = skip;
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, beamPollTestProgram, sizeof(beamPollTestProgram) / sizeof(beamPollTestProgram[0]));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	JaguarWriteWord(0xF0002E, 1, M68K);			// HP, HC counts the halves of the halfline
+	TOMGetBeamPollSkipped(&hcBefore, &vcBefore);
+
+	beamPollTestCRCs.clear();
+	HooksRegister(HOOK_HALFLINE, BeamPollTestHalfline, NULL);
+
+	for (uint32_t i = 0; i < BEAMPOLLTEST_FRAMES; i++)
+	{
+		CoreTestRunFrames(1);
+		states.push_back(StateCRC32());
+	}
+
+	HooksUnregister(HOOK_HALFLINE, BeamPollTestHalfline, NULL);
+	TOMGetBeamPollSkipped(&hc, &vc);
+	vjs.beamPollSkip = false;
+
+	crcs = beamPollTestCRCs;
+	hc -= hcBefore;
+	vc -= vcBefore;
+}
+
+
+//
+// Halflines & states bit for bit the same, with HC & VC polling iterations fast-forwarded
+//
+CORE_TEST(BeamPollFastForward)
+{
+	std::vector<uint32_t> crcs, skippedCRCs, states, skippedStates;
+	uint64_t hc, vc;
+
+	BeamPollTestRun(false, crcs, states, hc, vc);
+	CORE_CHECK_EQUAL(hc + vc, 0);
+	BeamPollTestRun(true, skippedCRCs, skippedStates, hc, vc);
+
+	CORE_CHECK(!crcs.empty());
+	CORE_CHECK_EQUAL(skippedCRCs.size(), crcs.size());
+	size_t first = 0;
+
+	while ((first < crcs.size()) && (crcs[first] == skippedCRCs[first]))
+	{
+		first++;
+	}
+
+	CORE_CHECK_EQUAL(first, crcs.size());
+	CORE_CHECK(skippedStates == states);
+	CORE_CHECK(hc > 0);
+	CORE_CHECK(vc > 0);
+	return true;
+}
@@ -0,0 +1,174 @@
+//
+// Main bus arbitration, with synthetic blitter, OP & executors workloads
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdlib.h>
+#include "bus.h"
+#include "event.h"
+#include "gpu.h"
+#include "memory.h"
+#include "settings.h"
+#include "state.h"
+
+
+//
+// Halfline budget, in RISC cycles
+//
+static uint32_t BusTestHalfline(void)
+{
+	return USEC_TO_RISC_CYCLES(vjs.hardwareTypeNTSC ? (HORIZ_PERIOD_IN_USEC_NTSC / 2.0) : (HORIZ_PERIOD_IN_USEC_PAL / 2.0));
+}
+
+
+//
+// DRAM costs of the bursts, a page miss at the start & at each page crossed
+//
+CORE_TEST(BusBursts)
+{
+	CORE_CHECK_EQUAL(BusBurst(0x1000, 0), 0);
+	CORE_CHECK_EQUAL(BusBurst(0x1000, 1), BUS_PAGE_MISS);
+	CORE_CHECK_EQUAL(BusBurst(0x1000, 256), BUS_PAGE_MISS + (255 * BUS_PAGE_HIT));
+	CORE_CHECK_EQUAL(BusBurst(0x1004, 256), BUS_PAGE_MISS + (255 * BUS_PAGE_HIT));
+	CORE_CHECK_EQUAL(BusBurst(0x17F8, 2), (2 * BUS_PAGE_MISS));
+	CORE_CHECK_EQUAL(BusBurst(0x1008, 256), (2 * BUS_PAGE_MISS) + (254 * BUS_PAGE_HIT));
+	return true;
+}
+
+
+//
+// OP & blitter transfers over the halflines, granted in the priority order
+// The blitter transfer not granted goes on, the 68K is stalled
+//
+CORE_TEST(BusContention)
+{
+	uint32_t halfline = BusTestHalfline();
+	uint32_t op = (halfline * 3) / 4, gpu = halfline / 8, m68k = halfline / 16;
+	uint32_t blitter = halfline - op - gpu;
+	BusStats stats;
+
+	vjs.busArbitration = true;
+	BusReset();
+
+	// Three quarters of each halfline for the OP, a blit of four halflines
+	BusCharge(BLITTER, 4 * halfline);
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		BusCharge(OP, op);
+		BusCharge(GPU, gpu);
+		BusCharge(M68K, m68k);
+		BusHalfline();
+	}
+
+	BusGetStats(&stats);
+	CORE_CHECK_EQUAL(stats.halflines, 8);
+	CORE_CHECK_EQUAL(stats.saturated, 8);
+	CORE_CHECK_EQUAL(stats.granted[OP], 8 * op);
+	CORE_CHECK_EQUAL(stats.granted[GPU], 8 * gpu);
+	CORE_CHECK_EQUAL(stats.stalled[GPU], 0);
+	// The blitter gets the rest of the halflines, before the 68K
+	CORE_CHECK_EQUAL(stats.requested[BLITTER], 4 * halfline);
+	CORE_CHECK_EQUAL(stats.granted[BLITTER], 8 * blitter);
+	CORE_CHECK_EQUAL(stats.granted[M68K], 0);
+	// The 68K requests are in its own clock
+	CORE_CHECK_EQUAL(stats.stalled[M68K], 8 * 2 * m68k);
+
+	// Stalls taken back from the next slices, up to their cycles, and charged again
+	CORE_CHECK_EQUAL(BusStall(M68K, 10), 10);
+	CORE_CHECK_EQUAL(BusStall(M68K, 8 * halfline), (8 * m68k) - 10);
+	CORE_CHECK_EQUAL(BusStall(M68K, 8 * halfline), 0);
+	CORE_CHECK_EQUAL(BusStall(GPU, 8 * halfline), 0);
+
+	// The blitter ends alone, the 68K waits for its first halfline
+	uint32_t remaining = (4 * halfline) - (8 * blitter);
+	CORE_CHECK((remaining > halfline) && (remaining % halfline));
+
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		BusHalfline();
+	}
+
+	BusGetStats(&stats);
+	CORE_CHECK_EQUAL(stats.granted[BLITTER], 4 * halfline);
+	CORE_CHECK_EQUAL(stats.saturated, 8 + (remaining / halfline));
+	CORE_CHECK_EQUAL(stats.stalled[M68K], 2 * 8 * 2 * m68k);
+	return true;
+}
+
+
+//
+// Nothing charged nor stalled, and no GPU access counted, without the arbitration
+//
+CORE_TEST(BusArbitrationOff)
+{
+	BusStats stats;
+
+	vjs.busArbitration = false;
+	BusReset();
+	BusCharge(OP, 10 * BusTestHalfline());
+	BusCharge(GPU, 10 * BusTestHalfline());
+	BusHalfline();
+	GPUReadLong(0x1000, GPU);
+	GPUReadWord(0x1000, GPU);
+	CORE_CHECK_EQUAL(busAccesses[GPU], 0);
+	CORE_CHECK_EQUAL(BusStall(GPU, 1000), 0);
+
+	BusGetStats(&stats);
+	CORE_CHECK_EQUAL(stats.halflines, 0);
+	CORE_CHECK_EQUAL(stats.requested[OP], 0);
+
+	vjs.busArbitration = true;
+	GPUReadLong(0x1000, GPU);
+	GPUReadWord(0x1000, GPU);
+	GPUReadLong(GPU_WORK_RAM_BASE, GPU);
+	CORE_CHECK_EQUAL(busAccesses[GPU], 2);
+	return true;
+}
+
+
+//
+// Requests, transfers not granted & stalls kept by a chips state
+//
+CORE_TEST(BusState)
+{
+	uint32_t halfline = BusTestHalfline();
+	size_t size;
+
+	// The OP takes the first halfline, the GPU is stalled
+	vjs.busArbitration = true;
+	BusReset();
+	BusCharge(OP, halfline);
+	BusCharge(BLITTER, 3 * halfline);
+	BusCharge(GPU, halfline / 2);
+	BusHalfline();
+	BusCharge(OP, halfline / 4);
+	BusCharge(M68K, 100);
+
+	uint8_t * state = StateDumpChipsToMemory(&size);
+	CORE_CHECK(state != NULL);
+	BusReset();
+	int loaded = StateLoadChipsFromMemory(state, size);
+	free(state);
+	CORE_CHECK(loaded);
+
+	// The GPU stall is charged again, before the blitter transfer not granted
+	CORE_CHECK_EQUAL(BusStall(GPU, halfline), halfline / 2);
+	BusHalfline();
+
+	BusStats stats;
+	BusGetStats(&stats);
+	CORE_CHECK_EQUAL(stats.granted[OP], halfline / 4);
+	CORE_CHECK_EQUAL(stats.granted[GPU], halfline / 2);
+	CORE_CHECK_EQUAL(stats.requested[BLITTER], 0);
+	CORE_CHECK_EQUAL(stats.granted[BLITTER], halfline - (halfline / 4) - (halfline / 2));
+	CORE_CHECK_EQUAL(stats.stalled[M68K], 200);
+	return true;
+}
@@ -0,0 +1,173 @@
+//
+// Butch I2S words fed to JERRY from a synthetic CD, by sector bursts
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zlib.h>
+#include "cdintf.h"
+#include "event.h"
+#include "frametiming.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "settings.h"
+#include "state.h"
+
+#define BUTCHTEST_SECTOR		2352
+#define BUTCHTEST_SECOND		44100					// Words in an emulated second
+#define BUTCHTEST_SMODE			0xF1A156				// WSEN | FALLING, Butch word clock
+#define BUTCHTEST_SCLK			0xF1A152
+#define BUTCHTEST_I2CNTRL		0xDFFF12				// Butch I2S path to JERRY
+
+static uint32_t butchTestReads;
+
+
+//
+// Synthetic CD sector, its bytes from their position on the CD
+//
+static uint8_t ButchTestByte(uint64_t position)
+{
+	return (uint8_t)((position * 0x9E3779B1) >> 13);
+}
+
+
+static bool ButchTestSector(uint32_t sector, uint8_t * buffer)
+{
+	for (uint32_t i = 0; i < BUTCHTEST_SECTOR; i++)
+	{
+		buffer[i] = ButchTestByte(((uint64_t)sector * BUTCHTEST_SECTOR) + i);
+	}
+
+	butchTestReads++;
+	return true;
+}
+
+
+//
+// Synthetic CD read by Butch from its start, the word clock started by the I2S path
+//
+static void ButchTestStart(void)
+{
+	butchTestReads = 0;
+	CDIntfSetReader(ButchTestSector);
+	JaguarWriteWord(BUTCHTEST_SMODE, 0x14, M68K);
+	JaguarWriteWord(BUTCHTEST_SCLK, 19, M68K);
+	JaguarWriteWord(BUTCHTEST_I2CNTRL, 0x0002, M68K);
+}
+
+
+//
+// JERRY events list run for a number of words, only the word clock is in the list
+// The words CRC32 is updated, and the words times kept if asked for
+//
+static void ButchTestRun(uint32_t words, uint32_t & crc, double * times = NULL)
+{
+	double start = GetEventListTime(EVENT_JERRY);
+
+	for (uint32_t i = 0; i < words; i++)
+	{
+		GetTimeToNextEvent(EVENT_JERRY);
+		HandleNextEvent(EVENT_JERRY);
+
+		uint8_t word[4] = { (uint8_t)(lrxd >> 8), (uint8_t)lrxd, (uint8_t)(rrxd >> 8), (uint8_t)rrxd };
+		crc = crc32(crc, word, 4);
+
+		if (times)
+		{
+			times[i] = GetEventListTime(EVENT_JERRY) - start;
+		}
+	}
+}
+
+
+//
+// Words CRC32 from the CD bytes; the drive data is a word late, the words start
+// at the third byte of the CD
+//
+static uint32_t ButchTestReference(uint32_t words)
+{
+	uint32_t crc = 0;
+
+	for (uint64_t i = 0; i < words; i++)
+	{
+		uint64_t position = (i * 4) + 2;
+		uint8_t word[4] = { ButchTestByte(position + 3), ButchTestByte(position + 2), ButchTestByte(position + 1), ButchTestByte(position) };
+		crc = crc32(crc, word, 4);
+	}
+
+	return crc;
+}
+
+
+//
+// Ten emulated seconds of CD words: the sequence from the CD, one CD read per sector,
+// and the words at 44.1 kHz on average; the host time is reported
+//
+CORE_TEST(ButchBurst)
+{
+	const uint32_t words = 10 * BUTCHTEST_SECOND;
+	double cycleInUsec = (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+	uint32_t crc = 0;
+
+	ButchTestStart();
+	double start = GetEventListTime(EVENT_JERRY);
+	uint64_t host = FrameTimingNow();
+	ButchTestRun(words, crc);
+	host = FrameTimingNow() - host;
+	double elapsed = GetEventListTime(EVENT_JERRY) - start;
+	CDIntfSetReader(NULL);
+
+	// The first burst reads the next sector too
+	uint32_t sectors = ((words * 4) + (BUTCHTEST_SECTOR - 1)) / BUTCHTEST_SECTOR;
+	printf("    %u words, %u CD reads, %.3f s host\n", words, butchTestReads, (double)host / 1000000000.0);
+
+	CORE_CHECK_EQUAL(crc, ButchTestReference(words));
+	CORE_CHECK_EQUAL(butchTestReads, sectors + 1);
+	CORE_CHECK(fabs(elapsed - 10000000.0) < (cycleInUsec * 2.0));
+	return true;
+}
+
+
+//
+// Word clock carried over a state load, each word comes at the same time
+//
+CORE_TEST(ButchStateLoad)
+{
+	const uint32_t words = 1000;
+	static double times[words], loadedTimes[words];
+	uint32_t crc = 0;
+	size_t size;
+
+	ButchTestStart();
+	ButchTestRun(1001, crc);
+	uint8_t * state = StateDumpToMemory(&size);
+	CORE_CHECK(state != NULL);
+
+	uint32_t loadedCRC = crc;
+	ButchTestRun(words, crc, times);
+
+	int loaded = StateLoadFromMemory(state, size);
+	free(state);
+	ButchTestRun(words, loadedCRC, loadedTimes);
+	CDIntfSetReader(NULL);
+	CORE_CHECK(loaded);
+
+	double cycleInUsec = (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+	for (uint32_t i = 0; i < words; i++)
+	{
+		CORE_CHECK(fabs(loadedTimes[i] - times[i]) < (cycleInUsec / 2.0));
+	}
+
+	CORE_CHECK_EQUAL(loadedCRC, crc);
+	CORE_CHECK_EQUAL(crc, ButchTestReference(1001 + words));
+	return true;
+}
@@ -0,0 +1,225 @@
+//
+// Core tests driver
+//
+// The machine is initialised once, without BIOS, and captured as the fast
+// reset baseline; each test starts from the baseline. The tests are run in
+// their registration order, or only the ones named on the command line:
+//     coretest [-l] [test...]
+// The exit code is the number of failed tests.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fastreset.h"
+#include "hosttuning.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "modelsBIOS.h"
+#include "settings.h"
+#include "m68000/m68kinterface.h"
+
+#define CORETEST_SEED			0x4A414755		// Random seed for the baseline RAM
+
+// Same frame buffer size as the GL widget texture
+#define CORETEST_SCREEN_PITCH	1024
+#define CORETEST_SCREEN_HEIGHT	512
+
+VJSettings vjs;
+static uint32_t coreTestScreenBuffer[CORETEST_SCREEN_PITCH * CORETEST_SCREEN_HEIGHT];
+static CoreTest * coreTests = NULL, ** coreTestsLast = &coreTests;
+
+
+//
+// Test registration, in the link order
+//
+CoreTest::CoreTest(const char * testName, CoreTestFunction testFunction) : name(testName), function(testFunction), next(NULL)
+{
+	*coreTestsLast = this;
+	coreTestsLast = &next;
+}
+
+
+//
+// Failed check report
+//
+void CoreTestFailure(const char * file, int line, const char * text)
+{
+	printf("    %s:%i: check failed: %s\n", file, line, text);
+}
+
+
+void CoreTestFailureValues(const char * file, int line, const char * text, uint64_t value, uint64_t expected)
+{
+	printf("    %s:%i: check failed: %s ($%llX, expected $%llX)\n", file, line, text, (unsigned long long)value, (unsigned long long)expected);
+}
+
+
+//
+// Settings of the baseline machine
+//
+static void CoreTestSettings(void)
+{
+	memset(&vjs, 0, sizeof(vjs));
+	vjs.hardwareTypeNTSC = true;
+	vjs.biosType = BT_M_SERIES;
+	vjs.jaguarModel = JAG_M_SERIES;
+	vjs.GPUEnabled = true;
+	vjs.DSPEnabled = true;
+	vjs.allowWritesToROM = true;
+	vjs.allowM68KExceptionCatch = false;
+	vjs.allowWritesToUnknownLocation = true;
+	vjs.emulationThreadCPU = vjs.audioThreadCPU = vjs.workerThreadCPU = -1;
+	vjs.hugePagesType = HOST_HUGEPAGES_NONE;
+	vjs.DRAM_size = 0x200000;
+}
+
+
+//
+// Initialise the machine, and capture the baseline
+//
+static bool CoreTestInit(void)
+{
+	CoreTestSettings();
+	JaguarSetScreenPitch(CORETEST_SCREEN_PITCH);
+	JaguarSetScreenBuffer(coreTestScreenBuffer);
+	JaguarInit();
+	SelectBIOS(vjs.biosType);
+	// The RAM contents are randomized at the reset, the same ones for each session
+	srand(CORETEST_SEED);
+	JaguarReset();
+
+	jaguarRunAddress = CORETEST_RUN_ADDRESS;
+	SET32(jaguarMainRAM, 0, CORETEST_STACK);
+	SET32(jaguarMainRAM, 4, jaguarRunAddress);
+	m68k_pulse_reset();
+
+	return CoreFastResetCapture();
+}
+
+
+//
+// Machine brought back to the baseline, the settings changed by a test too
+//
+void CoreTestReset(void)
+{
+	CoreTestSettings();
+	CoreFastReset();
+}
+
+
+//
+// Memory loaded out of the bus functions, its pages are marked for the next reset
+//
+void CoreTestLoad(uint32_t address, const uint8_t * data, size_t size)
+{
+	memcpy(&jagMemSpace[address], data, size);
+	MemoryPagesWritten(address, (uint32_t)size);
+}
+
+
+void CoreTestLoad16(uint32_t address, const uint16_t * words, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		SET16(jagMemSpace, address + (i * 2), words[i]);
+	}
+
+	MemoryPagesWritten(address, (uint32_t)(count * 2));
+}
+
+
+void CoreTestLoad32(uint32_t address, const uint32_t * longs, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		SET32(jagMemSpace, address + (i * 4), longs[i]);
+	}
+
+	MemoryPagesWritten(address, (uint32_t)(count * 4));
+}
+
+
+//
+// 68K started at an address, from its reset vectors
+//
+void CoreTestStart68K(uint32_t address)
+{
+	uint32_t vectors[2] = { CORETEST_STACK, address };
+
+	CoreTestLoad32(0, vectors, 2);
+	m68k_pulse_reset();
+}
+
+
+void CoreTestRunFrames(uint32_t frames)
+{
+	while (frames--)
+	{
+		JaguarExecuteNew();
+	}
+}
+
+
+int main(int argc, char * argv[])
+{
+	bool list = false;
+	int failed = 0, run = 0;
+
+	if ((argc > 1) && !strcmp(argv[1], "-l"))
+	{
+		list = true;
+		argc--, argv++;
+	}
+
+	if (!list && !CoreTestInit())
+	{
+		printf("Cannot capture the machine baseline\n");
+		return 1;
+	}
+
+	for (CoreTest * test = coreTests; test; test = test->next)
+	{
+		bool selected = (argc == 1);
+
+		for (int i = 1; !selected && (i < argc); i++)
+		{
+			selected = !strcmp(argv[i], test->name);
+		}
+
+		if (!selected)
+		{
+			continue;
+		}
+
+		if (list)
+		{
+			printf("%s\n", test->name);
+			continue;
+		}
+
+		CoreTestReset();
+		bool passed = test->function();
+		printf("%s %s\n", (passed ? "PASS" : "FAIL"), test->name);
+		fflush(stdout);
+		failed += !passed;
+		run++;
+	}
+
+	if (!list)
+	{
+		printf("%i tests, %i failed\n", run, failed);
+		CoreFastResetDone();
+		JaguarDone();
+	}
+
+	return failed;
+}
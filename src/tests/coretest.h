@@ -0,0 +1,52 @@
+//
+// coretest.h: Header file
+//
+// Core tests, registered at the program start and run by the coretest driver
+//
+
+#ifndef __CORETEST_H__
+#define __CORETEST_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef bool (* CoreTestFunction)(void);
+
+// Test registration, the tests are kept in a list
+struct CoreTest
+{
+	const char * name;
+	CoreTestFunction function;
+	CoreTest * next;
+
+	CoreTest(const char * testName, CoreTestFunction testFunction);
+};
+
+// Test definition, the function returns false at the first failed check
+#define CORE_TEST(_name) \
+	static bool CoreTest_##_name(void); \
+	static CoreTest coreTest_##_name(#_name, CoreTest_##_name); \
+	static bool CoreTest_##_name(void)
+
+// Checks, a failure is reported with its location and stops the test
+#define CORE_CHECK(_x) \
+	do { if (!(_x)) { CoreTestFailure(__FILE__, __LINE__, #_x); return false; } } while (0)
+#define CORE_CHECK_EQUAL(_a, _b) \
+	do { uint64_t _va = (uint64_t)(_a), _vb = (uint64_t)(_b); \
+		if (_va != _vb) { CoreTestFailureValues(__FILE__, __LINE__, #_a " == " #_b, _va, _vb); return false; } } while (0)
+
+extern void CoreTestFailure(const char * file, int line, const char * text);
+extern void CoreTestFailureValues(const char * file, int line, const char * text, uint64_t value, uint64_t expected);
+
+// Machine, brought back to the baseline (no BIOS, NTSC, 2 MB) before each test
+#define CORETEST_RUN_ADDRESS	0x4000
+#define CORETEST_STACK			0x1FFFF0
+
+extern void CoreTestReset(void);
+extern void CoreTestLoad(uint32_t address, const uint8_t * data, size_t size);
+extern void CoreTestLoad16(uint32_t address, const uint16_t * words, size_t count);
+extern void CoreTestLoad32(uint32_t address, const uint32_t * longs, size_t count);
+extern void CoreTestStart68K(uint32_t address);
+extern void CoreTestRunFrames(uint32_t frames);
+
+#endif	// __CORETEST_H__
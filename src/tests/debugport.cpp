@@ -0,0 +1,297 @@
+//
+// Guest debug port: lines, markers, assertions, full ring, and concurrent masters
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "debugport.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "settings.h"
+
+#define DEBUGPORTTEST_RING		1024				// Ring size of the port
+#define DEBUGPORTTEST_LINES		20000				// Lines written by each master of the concurrent test
+
+
+//
+// Events left by the previous tests are read out
+//
+static void DebugPortTestDrain(void)
+{
+	DebugPortEvent event;
+
+	while (DebugPortRead(&event))
+		;
+}
+
+
+static void DebugPortTestString(uint32_t who, const char * string)
+{
+	while (*string)
+	{
+		DebugPortWriteByte(DEBUGPORT_BASE + DEBUGPORT_CHAR + 1, *string++, who);
+	}
+}
+
+
+//
+// Long register written, the high word first
+//
+static void DebugPortTestLong(uint32_t reg, uint32_t value, uint32_t who)
+{
+	DebugPortWriteWord(DEBUGPORT_BASE + reg, value >> 16, who);
+	DebugPortWriteWord(DEBUGPORT_BASE + reg + 2, value & 0xFFFF, who);
+}
+
+
+//
+// Lines of two masters, interleaved, built with the characters and the values
+//
+CORE_TEST(DebugPortText)
+{
+	DebugPortEvent event;
+
+	vjs.allowDebugPort = true;
+	DebugPortTestDrain();
+	DebugPortTestString(M68K, "68K ");
+	DebugPortTestString(GPU, "GPU\n");
+	DebugPortTestLong(DEBUGPORT_HEX, 0xCAFE1234, M68K);
+	DebugPortTestString(M68K, " ");
+	DebugPortTestLong(DEBUGPORT_DEC, (uint32_t)-42, M68K);
+	DebugPortTestString(M68K, "\r\n");
+
+	CORE_CHECK(DebugPortRead(&event));
+	CORE_CHECK_EQUAL(event.type, DEBUGPORT_TEXT);
+	CORE_CHECK_EQUAL(event.who, GPU);
+	CORE_CHECK(!strcmp(event.text, "GPU"));
+	CORE_CHECK(DebugPortRead(&event));
+	CORE_CHECK_EQUAL(event.who, M68K);
+	CORE_CHECK(!strcmp(event.text, "68K CAFE1234 -42"));
+	CORE_CHECK(!DebugPortRead(&event));
+	return true;
+}
+
+
+//
+// Begin & end markers, the end marker gets the cycles from the begin marker of its identifier
+//
+CORE_TEST(DebugPortMarkers)
+{
+	const uint16_t idle[] = { 0x60FE };				// BRA.S *
+	DebugPortEvent begin, end, other;
+
+	vjs.allowDebugPort = true;
+	DebugPortTestDrain();
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, idle, 1);
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+	DebugPortTestLong(DEBUGPORT_BEGIN, 7, DSP);
+	CoreTestRunFrames(1);
+	DebugPortTestLong(DEBUGPORT_END, 7, M68K);
+	DebugPortTestLong(DEBUGPORT_END, 7, M68K);
+
+	CORE_CHECK(DebugPortRead(&begin));
+	CORE_CHECK(DebugPortRead(&end));
+	CORE_CHECK(DebugPortRead(&other));
+	CORE_CHECK_EQUAL(begin.type, DEBUGPORT_MARK_BEGIN);
+	CORE_CHECK_EQUAL(begin.id, 7);
+	CORE_CHECK_EQUAL(end.type, DEBUGPORT_MARK_END);
+	CORE_CHECK_EQUAL(end.id, 7);
+	CORE_CHECK(end.cycles > begin.cycles);
+	CORE_CHECK_EQUAL(end.duration, end.cycles - begin.cycles);
+
+	// The begin marker is used once
+	CORE_CHECK_EQUAL(other.type, DEBUGPORT_MARK_END);
+	CORE_CHECK_EQUAL(other.duration, 0);
+	return true;
+}
+
+
+//
+// Failed assertion, the line of its master is its message
+//
+CORE_TEST(DebugPortAssertion)
+{
+	DebugPortEvent event;
+	char line[256];
+
+	vjs.allowDebugPort = true;
+	DebugPortTestDrain();
+	DebugPortTestString(DSP, "x < 10");
+	DebugPortTestLong(DEBUGPORT_ASSERT, 1234, DSP);
+	DebugPortTestLong(DEBUGPORT_ASSERT, 1235, DSP);
+
+	CORE_CHECK(DebugPortRead(&event));
+	CORE_CHECK_EQUAL(event.type, DEBUGPORT_ASSERTION);
+	CORE_CHECK_EQUAL(event.who, DSP);
+	CORE_CHECK_EQUAL(event.id, 1234);
+	CORE_CHECK(!strcmp(event.text, "x < 10"));
+	DebugPortFormat(&event, line, sizeof(line));
+	CORE_CHECK(strstr(line, "assertion #1234 failed: x < 10") != NULL);
+
+	// The line is taken by the assertion
+	CORE_CHECK(DebugPortRead(&event));
+	CORE_CHECK_EQUAL(event.id, 1235);
+	CORE_CHECK(!strcmp(event.text, ""));
+	return true;
+}
+
+
+//
+// Full ring, the events over its size are dropped and counted
+//
+CORE_TEST(DebugPortOverflow)
+{
+	DebugPortEvent event;
+	char line[16];
+
+	vjs.allowDebugPort = true;
+	DebugPortTestDrain();
+	uint32_t dropped = DebugPortDropped();
+
+	for (uint32_t i = 0; i < (DEBUGPORTTEST_RING + 10); i++)
+	{
+		sprintf(line, "%u\n", i);
+		DebugPortTestString(GPU, line);
+	}
+
+	uint32_t count = 0;
+
+	while (DebugPortRead(&event))
+	{
+		sprintf(line, "%u", count++);
+		CORE_CHECK(!strcmp(event.text, line));
+	}
+
+	CORE_CHECK_EQUAL(count, DEBUGPORTTEST_RING);
+	CORE_CHECK_EQUAL(DebugPortDropped() - dropped, 10);
+	return true;
+}
+
+
+//
+// Port off, its range is unmapped space again; on, the identifier is read and the lines sent
+//
+CORE_TEST(DebugPortOff)
+{
+	DebugPortEvent event;
+
+	DebugPortTestDrain();
+	vjs.allowDebugPort = false;
+	CORE_CHECK(JaguarReadWord(DEBUGPORT_BASE, M68K) != DEBUGPORT_ID);
+	JaguarWriteByte(DEBUGPORT_BASE + 1, 'A', M68K);
+	JaguarWriteByte(DEBUGPORT_BASE + 1, '\n', M68K);
+	CORE_CHECK(!DebugPortRead(&event));
+
+	vjs.allowDebugPort = true;
+	CORE_CHECK_EQUAL(JaguarReadWord(DEBUGPORT_BASE, M68K), DEBUGPORT_ID);
+	JaguarWriteByte(DEBUGPORT_BASE + 1, 'B', M68K);
+	JaguarWriteByte(DEBUGPORT_BASE + 1, '\n', M68K);
+	CORE_CHECK(DebugPortRead(&event));
+	CORE_CHECK(!strcmp(event.text, "B"));
+	vjs.allowDebugPort = false;
+	return true;
+}
+
+
+//
+// Lines numbered by a master, with begin & end markers of the same identifiers as the other master
+//
+static void DebugPortTestWriter(uint32_t who, std::atomic<uint32_t> * finished)
+{
+	char line[32];
+
+	for (uint32_t i = 0; i < DEBUGPORTTEST_LINES; i++)
+	{
+		sprintf(line, "%s %u\n", whoName[who], i);
+		DebugPortTestLong(DEBUGPORT_BEGIN, i & 0x0F, who);
+		DebugPortTestString(who, line);
+		DebugPortTestLong(DEBUGPORT_END, i & 0x0F, who);
+	}
+
+	finished->fetch_add(1);
+}
+
+
+//
+// Event read by the concurrent test, a line must be whole & numbered after the previous one of its master
+//
+static bool DebugPortTestCheck(const DebugPortEvent & event, int64_t * last)
+{
+	char line[32];
+	uint32_t number;
+	uint32_t m = (event.who == M68K ? 0 : 1);
+
+	if (event.type != DEBUGPORT_TEXT)
+	{
+		return true;
+	}
+
+	if (((event.who != M68K) && (event.who != DSP)) || (sscanf(event.text + strlen(whoName[event.who]), " %u", &number) != 1))
+	{
+		return false;
+	}
+
+	sprintf(line, "%s %u", whoName[event.who], number);
+
+	if (strcmp(event.text, line) || ((int64_t)number <= last[m]))
+	{
+		return false;
+	}
+
+	last[m] = number;
+	return true;
+}
+
+
+//
+// The DSP writes from the audio thread while the 68K writes from the emulation thread
+// The consumer may fall behind; the lines read are whole & in order, and each event is read or dropped
+//
+CORE_TEST(DebugPortConcurrent)
+{
+	std::atomic<uint32_t> finished(0);
+	int64_t last[2] = { -1, -1 };
+	uint32_t events = 0;
+	bool whole = true;
+	DebugPortEvent event;
+
+	vjs.allowDebugPort = true;
+	DebugPortTestDrain();
+	uint32_t dropped = DebugPortDropped();
+	std::thread m68k(DebugPortTestWriter, (uint32_t)M68K, &finished);
+	std::thread dsp(DebugPortTestWriter, (uint32_t)DSP, &finished);
+
+	while (finished.load() < 2)
+	{
+		while (DebugPortRead(&event))
+		{
+			whole = whole && DebugPortTestCheck(event, last);
+			events++;
+		}
+	}
+
+	m68k.join();
+	dsp.join();
+
+	while (DebugPortRead(&event))
+	{
+		whole = whole && DebugPortTestCheck(event, last);
+		events++;
+	}
+
+	vjs.allowDebugPort = false;
+	CORE_CHECK(whole);
+	CORE_CHECK_EQUAL(events + (DebugPortDropped() - dropped), 2 * 3 * DEBUGPORTTEST_LINES);
+	return true;
+}
@@ -0,0 +1,403 @@
+//
+// 68K lazy condition codes, run in lockstep against the flags made after each instruction
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <vector>
+#include "jaguar.h"
+#include "m68000/cpudefs.h"
+#include "m68000/m68kinterface.h"
+
+#define FLAGSTEST_PROGRAMS		300
+#define FLAGSTEST_LENGTH		64					// Instructions of each program body
+#define FLAGSTEST_DATA			0x10000				// Long used by the memory operands
+#define FLAGSTEST_STEPS			1000
+#define FLAGSTEST_BOUNDARY		17					// PC, SR, D0-D7 & A0-A6 at each instruction boundary
+
+static uint32_t flagsTestSeed;
+
+extern uint32_t srQueue[0x400], ccOpQueue[0x400], ccSrcQueue[0x400], ccDstQueue[0x400], ccResQueue[0x400];
+extern uint32_t pcQPtr;
+
+// Instruction templates, the register & size fields are random
+static const uint16_t flagsTestALU[] = { 0xD000, 0x9000, 0xB000, 0xC000, 0x8000, 0xB100, 0xD100, 0x9100 };	// ADD, SUB, CMP, AND, OR, EOR, ADDX, SUBX
+static const uint16_t flagsTestMemory[] = { 0xD110, 0x9110, 0xC110, 0x8110 };						// ADD, SUB, AND, OR Dx,(A0)
+static const uint16_t flagsTestSingle[] = { 0x4400, 0x4000, 0x4600, 0x4200, 0x4A00 };				// NEG, NEGX, NOT, CLR, TST
+static const uint16_t flagsTestImmediate[] = { 0x0C00, 0x0600, 0x0400, 0x0200, 0x0000, 0x0A00 };	// CMPI, ADDI, SUBI, ANDI, ORI, EORI
+static const uint16_t flagsTestMove[] = { 0x1000, 0x3000, 0x2000 };									// MOVE.B, MOVE.W, MOVE.L
+static const uint16_t flagsTestOther[] = { 0x40C0, 0x44C0, 0x4880, 0x48C0, 0x4840, 0x4800 };		// MOVE SR, MOVE CCR, EXT.W, EXT.L, SWAP, NBCD
+
+#define FLAGSTEST_COUNT(a)		(sizeof(a) / sizeof(a[0]))
+
+
+static uint32_t FlagsTestRandom(void)
+{
+	flagsTestSeed = (flagsTestSeed * 1103515245) + 12345;
+	return (flagsTestSeed >> 8);
+}
+
+
+//
+// Random instruction, or instructions kept together
+//
+static void FlagsTestInstruction(std::vector<uint16_t> & words)
+{
+	uint32_t r = FlagsTestRandom();
+	uint32_t x = (r >> 4) & 7, y = (r >> 7) & 7, size = ((r >> 10) & 3) % 3, cc = (r >> 12) & 0x0F, bit = (r >> 16) & 1;
+	uint32_t imm = FlagsTestRandom();
+
+	switch (r & 0x0F)
+	{
+	case 0:
+	case 1:
+	case 2:
+		words.push_back(flagsTestALU[imm % FLAGSTEST_COUNT(flagsTestALU)] | (x << 9) | (size << 6) | y);
+		break;
+	case 3:
+		words.push_back(flagsTestMemory[imm % FLAGSTEST_COUNT(flagsTestMemory)] | (x << 9) | (size << 6));
+		break;
+	// ADDQ, SUBQ
+	case 4:
+		words.push_back(0x5000 | (x << 9) | (bit << 8) | (size << 6) | y);
+		break;
+	case 5:
+		words.push_back(flagsTestSingle[imm % FLAGSTEST_COUNT(flagsTestSingle)] | (size << 6) | y);
+		break;
+	case 6:
+		words.push_back(flagsTestImmediate[(imm >> 16) % FLAGSTEST_COUNT(flagsTestImmediate)] | (size << 6) | y);
+
+		if (size == 2)
+		{
+			words.push_back(imm >> 8);
+		}
+
+		words.push_back(imm & ((size == 0) ? 0xFF : 0xFFFF));
+		break;
+	// MOVE Dy,Dx, MOVEQ
+	case 7:
+		words.push_back(bit ? (flagsTestMove[imm % FLAGSTEST_COUNT(flagsTestMove)] | (x << 9) | y) : (0x7000 | (x << 9) | (imm & 0xFF)));
+		break;
+	// ASd, LSd, ROXd, ROd, by an immediate count or by Dx
+	case 8:
+	case 9:
+		words.push_back(0xE000 | (x << 9) | (bit << 8) | (size << 6) | ((imm & 1) << 5) | (((imm >> 1) & 3) << 3) | y);
+		break;
+	case 10:
+		words.push_back(0x50C0 | (cc << 8) | y);
+		break;
+	// Bcc.S over the next instruction, BRA & BSR excepted; its displacement is set with the next instruction
+	case 11:
+		words.push_back(0x6000 | (((cc < 2) ? (cc + 2) : cc) << 8));
+		break;
+	// MULU, MULS
+	case 12:
+		words.push_back((bit ? 0xC0C0 : 0xC1C0) | (x << 9) | y);
+		break;
+	// ORI.W #1,Dy before DIVU or DIVS Dy,Dx, no division by zero
+	case 13:
+		words.push_back(0x0040 | y);
+		words.push_back(0x0001);
+		words.push_back((bit ? 0x80C0 : 0x81C0) | (x << 9) | y);
+		break;
+	// ABCD, SBCD
+	case 14:
+		words.push_back((bit ? 0xC100 : 0x8100) | (x << 9) | y);
+		break;
+	default:
+		words.push_back(flagsTestOther[imm % FLAGSTEST_COUNT(flagsTestOther)] | y);
+		break;
+	}
+}
+
+
+//
+// Program: registers, flags & memory operand set, a random body, and a loop on itself
+//
+static void FlagsTestProgram(std::vector<uint16_t> & program)
+{
+	program.clear();
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		uint32_t value = FlagsTestRandom() ^ (FlagsTestRandom() << 16);
+		// MOVE.L #value,Di
+		program.push_back(0x203C | (i << 9));
+		program.push_back(value >> 16);
+		program.push_back(value & 0xFFFF);
+	}
+
+	for (uint32_t i = 0; i < 7; i++)
+	{
+		uint32_t value = ((i == 0) ? FLAGSTEST_DATA : FlagsTestRandom());
+		// MOVEA.L #value,Ai
+		program.push_back(0x207C | (i << 9));
+		program.push_back(value >> 16);
+		program.push_back(value & 0xFFFF);
+	}
+
+	uint32_t value = FlagsTestRandom() ^ (FlagsTestRandom() << 16);
+	// MOVE.L #value,(A0), MOVE #ccr,CCR
+	program.push_back(0x20BC);
+	program.push_back(value >> 16);
+	program.push_back(value & 0xFFFF);
+	program.push_back(0x44FC);
+	program.push_back(FlagsTestRandom() & 0x1F);
+
+	size_t branch = 0;
+
+	for (uint32_t i = 0; i < FLAGSTEST_LENGTH; i++)
+	{
+		size_t start = program.size();
+		FlagsTestInstruction(program);
+
+		if (branch)
+		{
+			program[branch] |= (uint16_t)((program.size() - start) * 2);
+			branch = 0;
+		}
+
+		if ((program[start] & 0xF000) == 0x6000)
+		{
+			branch = start;
+		}
+	}
+
+	// NOP, for a last Bcc.S to skip; BRA.S *
+	program.push_back(0x4E71);
+	program.push_back(0x60FE);
+
+	if (branch)
+	{
+		program[branch] |= 2;
+	}
+}
+
+
+//
+// Program run one instruction at a time, the registers & status kept at each boundary
+// Lazy: the flags made for the boundary are thrown away, the operation stays recorded
+// Eager: the flags are made after each instruction, as they were before the lazy flags
+//
+static void FlagsTestRun(const std::vector<uint16_t> & program, bool eager, std::vector<uint32_t> & boundaries)
+{
+	uint32_t end = CORETEST_RUN_ADDRESS + ((uint32_t)program.size() * 2) - 2;
+
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, &program[0], program.size());
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	m68k_set_reg(M68K_REG_SR, 0x2700);
+	boundaries.clear();
+
+	// Nothing left by the previous run
+	for (uint32_t j = 0; j < (FLAGSTEST_BOUNDARY - 2); j++)
+	{
+		m68k_set_reg((m68k_register_t)(M68K_REG_D0 + j), 0);
+	}
+
+	for (uint32_t i = 0; (i < FLAGSTEST_STEPS) && (m68k_get_reg(NULL, M68K_REG_PC) != end); i++)
+	{
+		JaguarStepInto();
+
+		if (eager)
+		{
+			CC_FLUSH;
+		}
+
+		struct regstruct lazy = regs;
+		boundaries.push_back(m68k_get_reg(NULL, M68K_REG_PC));
+		boundaries.push_back(m68k_get_reg(NULL, M68K_REG_SR));
+
+		for (uint32_t j = 0; j < (FLAGSTEST_BOUNDARY - 2); j++)
+		{
+			boundaries.push_back(m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + j)));
+		}
+
+		regs = lazy;
+	}
+}
+
+
+//
+// Random programs, the same PC, SR & registers at each instruction boundary with the lazy and the eager flags
+//
+CORE_TEST(FlagsLazyLockstep)
+{
+	std::vector<uint16_t> program;
+	std::vector<uint32_t> lazy, eager;
+
+	flagsTestSeed = 0x68000;
+
+	for (uint32_t p = 0; p < FLAGSTEST_PROGRAMS; p++)
+	{
+		FlagsTestProgram(program);
+		FlagsTestRun(program, false, lazy);
+		FlagsTestRun(program, true, eager);
+
+		CORE_CHECK(lazy.size() > (FLAGSTEST_LENGTH * FLAGSTEST_BOUNDARY / 2));
+		size_t first = 0;
+
+		while ((first < lazy.size()) && (first < eager.size()) && (lazy[first] == eager[first]))
+		{
+			first++;
+		}
+
+		// Boundary, and its value, of the first difference
+		CORE_CHECK_EQUAL(first / FLAGSTEST_BOUNDARY, lazy.size() / FLAGSTEST_BOUNDARY);
+		CORE_CHECK_EQUAL(first, lazy.size());
+		CORE_CHECK_EQUAL(eager.size(), lazy.size());
+	}
+
+	return true;
+}
+
+
+//
+// Random programs, the traceback SR made from the lazy flags state kept before each instruction,
+// the same as the SR at the previous boundary; keeping the state does not make the flags
+//
+CORE_TEST(FlagsTracebackSR)
+{
+	std::vector<uint16_t> program;
+	uint32_t pending = 0;
+
+	flagsTestSeed = 0x68000;
+
+	for (uint32_t p = 0; p < (FLAGSTEST_PROGRAMS / 10); p++)
+	{
+		FlagsTestProgram(program);
+		uint32_t end = CORETEST_RUN_ADDRESS + ((uint32_t)program.size() * 2) - 2;
+
+		CoreTestLoad16(CORETEST_RUN_ADDRESS, &program[0], program.size());
+		CoreTestStart68K(CORETEST_RUN_ADDRESS);
+		m68k_set_reg(M68K_REG_SR, 0x2700);
+		uint32_t sr = 0x2700;
+
+		for (uint32_t i = 0; (i < FLAGSTEST_STEPS) && (m68k_get_reg(NULL, M68K_REG_PC) != end); i++)
+		{
+			JaguarStepInto();
+
+			uint32_t q = (pcQPtr - 1) & 0x3FF;
+			CORE_CHECK_EQUAL(m68k_lazy_sr(srQueue[q], ccOpQueue[q], ccSrcQueue[q], ccDstQueue[q], ccResQueue[q]), sr);
+
+			uint32_t op = regs.ccOp;
+			pending += (op != CC_NONE);
+			struct regstruct lazy = regs;
+			sr = m68k_get_reg(NULL, M68K_REG_SR);
+			regs = lazy;
+			CORE_CHECK_EQUAL(regs.ccOp, op);
+		}
+	}
+
+	CORE_CHECK(pending > (FLAGSTEST_PROGRAMS / 10) * (FLAGSTEST_LENGTH / 4));
+	return true;
+}
+
+
+//
+// N, Z, V, C & X of an operation, as the 68000 defines them
+//
+enum { FLAGSTEST_ADD = 0, FLAGSTEST_SUB, FLAGSTEST_CMP, FLAGSTEST_AND, FLAGSTEST_OR, FLAGSTEST_EOR, FLAGSTEST_ADDX, FLAGSTEST_SUBX, FLAGSTEST_NEG, FLAGSTEST_NEGX, FLAGSTEST_END };
+
+// Opcodes of the operations, on D0 (source) & D1 (destination)
+static const uint16_t flagsTestOpcodes[FLAGSTEST_END] = { 0xD200, 0x9200, 0xB200, 0xC200, 0x8200, 0xB101, 0xD300, 0x9300, 0x4401, 0x4001 };
+
+static uint32_t FlagsTestReference(uint32_t op, uint32_t size, uint32_t src, uint32_t dst, uint32_t ccr, uint32_t & result)
+{
+	uint64_t mask = (size == 0 ? 0xFF : (size == 1 ? 0xFFFF : 0xFFFFFFFF)), sign = (mask + 1) >> 1;
+	uint64_t s = src & mask, d = dst & mask, x = (ccr >> 4) & 1, r;
+	uint32_t flags = ccr & 0x10, carry = 0, overflow = 0;
+	bool sticky = false;
+
+	switch (op)
+	{
+	case FLAGSTEST_ADDX:
+		sticky = true;
+		// Fall through
+	case FLAGSTEST_ADD:
+		x = (op == FLAGSTEST_ADDX ? x : 0);
+		r = d + s + x;
+		carry = (r > mask);
+		overflow = ((~(d ^ s) & (d ^ r) & sign) != 0);
+		break;
+	case FLAGSTEST_NEGX:
+	case FLAGSTEST_NEG:
+		s = d;
+		d = 0;
+		// Fall through
+	case FLAGSTEST_SUBX:
+	case FLAGSTEST_SUB:
+	case FLAGSTEST_CMP:
+		sticky = ((op == FLAGSTEST_SUBX) || (op == FLAGSTEST_NEGX));
+		x = (sticky ? x : 0);
+		r = d - s - x;
+		carry = ((s + x) > d);
+		overflow = (((d ^ s) & (d ^ r) & sign) != 0);
+		break;
+	case FLAGSTEST_AND:
+		r = d & s;
+		break;
+	case FLAGSTEST_OR:
+		r = d | s;
+		break;
+	default:
+		r = d ^ s;
+		break;
+	}
+
+	r &= mask;
+	result = (op == FLAGSTEST_CMP ? dst : ((dst & ~(uint32_t)mask) | (uint32_t)r));
+
+	// X is set like C by the arithmetic operations, but CMP; Z is only cleared by ADDX, SUBX & NEGX
+	if ((op <= FLAGSTEST_SUB) || (op >= FLAGSTEST_ADDX))
+	{
+		flags = carry << 4;
+	}
+
+	return (flags | ((r & sign) ? 0x08 : 0) | ((r == 0) && (!sticky || (ccr & 0x04)) ? 0x04 : 0) | (overflow << 1) | carry);
+}
+
+
+//
+// Each operation & size, over the edge operands and the X & Z flags in, against the 68000 definitions
+//
+CORE_TEST(FlagsReference)
+{
+	const uint32_t values[] = { 0x00000000, 0x00000001, 0x0000007F, 0x00000080, 0x000000FF, 0x00007FFF, 0x00008000, 0x0000FFFF,
+		0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0x12345678, 0xFEDCBA98 };
+	const uint32_t count = sizeof(values) / sizeof(values[0]);
+
+	for (uint32_t op = 0; op < FLAGSTEST_END; op++)
+	{
+		for (uint32_t size = 0; size < 3; size++)
+		{
+			for (uint32_t i = 0; i < (count * count * 4); i++)
+			{
+				uint32_t src = values[i % count], dst = values[(i / count) % count], ccr = ((i / (count * count)) & 1 ? 0x10 : 0) | ((i / (count * count)) & 2 ? 0x04 : 0x0B);
+				// MOVE.L #src,D0, MOVE.L #dst,D1, MOVE #ccr,CCR, the operation
+				const uint16_t program[] = { 0x203C, (uint16_t)(src >> 16), (uint16_t)src, 0x223C, (uint16_t)(dst >> 16), (uint16_t)dst,
+					0x44FC, (uint16_t)ccr, (uint16_t)(flagsTestOpcodes[op] | (size << 6)), 0x60FE };
+				uint32_t result, flags = FlagsTestReference(op, size, src, dst, ccr, result);
+
+				CoreTestLoad16(CORETEST_RUN_ADDRESS, program, sizeof(program) / sizeof(program[0]));
+				CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+				for (uint32_t step = 0; step < 4; step++)
+				{
+					JaguarStepInto();
+				}
+
+				CORE_CHECK_EQUAL(m68k_get_reg(NULL, M68K_REG_D1), result);
+				CORE_CHECK_EQUAL((op << 16) | (size << 8) | (m68k_get_reg(NULL, M68K_REG_SR) & 0x1F), (op << 16) | (size << 8) | flags);
+			}
+		}
+	}
+
+	return true;
+}
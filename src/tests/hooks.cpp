@@ -0,0 +1,114 @@
+//
+// Memory read hooks, from the M68K and from the other masters
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <string.h>
+#include "hooks.h"
+#include "jaguar.h"
+#include "memory.h"
+
+#define HOOKSTEST_DATA			0x10000				// Data read by the tests
+#define HOOKSTEST_MAX			16
+
+struct HooksTestRead
+{
+	uint32_t address, value, size, who;
+};
+
+static HooksTestRead hooksTestRead[HOOKSTEST_MAX];
+static uint32_t hooksTestCount;
+
+
+static void HooksTestHook(void * userData, uint32_t address, uint32_t value, uint32_t size, uint32_t who)
+{
+	(void)userData;
+
+	if (hooksTestCount < HOOKSTEST_MAX)
+	{
+		HooksTestRead read = { address, value, size, who };
+		hooksTestRead[hooksTestCount] = read;
+	}
+
+	hooksTestCount++;
+}
+
+
+static void HooksTestStart(void)
+{
+	const uint16_t data[] = { 0x1234, 0x5678, 0x9ABC, 0xDEF0, 0x0102, 0x0304, 0x0506, 0x0708 };
+
+	CoreTestReset();
+	CoreTestLoad16(HOOKSTEST_DATA, data, 8);
+	memset(hooksTestRead, 0, sizeof(hooksTestRead));
+	hooksTestCount = 0;
+	HooksRegister(HOOK_MEMREAD, HooksTestHook, NULL, HOOKSTEST_DATA, HOOKSTEST_DATA + 0x0F);
+}
+
+
+static bool HooksTestCheck(uint32_t index, uint32_t address, uint32_t value, uint32_t size, uint32_t who)
+{
+	const HooksTestRead & read = hooksTestRead[index];
+
+	return ((read.address == address) && (read.value == value) && (read.size == size) && (read.who == who));
+}
+
+
+//
+// M68K reads in the range, the long is read as two words; the instruction fetches are outside the range
+//
+CORE_TEST(HooksMemRead68K)
+{
+	const uint16_t program[] =
+	{
+		0x3039, 0x0001, 0x0000,						// MOVE.W $10000,D0
+		0x2239, 0x0001, 0x0004,						// MOVE.L $10004,D1
+		0x1439, 0x0001, 0x0009,						// MOVE.B $10009,D2
+		0x60FE										// BRA.S *
+	};
+
+	HooksTestStart();
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, program, sizeof(program) / sizeof(uint16_t));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	CoreTestRunFrames(1);
+	HooksUnregister(HOOK_MEMREAD, HooksTestHook, NULL);
+
+	CORE_CHECK_EQUAL(hooksTestCount, 4);
+	CORE_CHECK(HooksTestCheck(0, HOOKSTEST_DATA, 0x1234, 2, M68K));
+	CORE_CHECK(HooksTestCheck(1, HOOKSTEST_DATA + 4, 0x9ABC, 2, M68K));
+	CORE_CHECK(HooksTestCheck(2, HOOKSTEST_DATA + 6, 0xDEF0, 2, M68K));
+	CORE_CHECK(HooksTestCheck(3, HOOKSTEST_DATA + 9, 0x02, 1, M68K));
+	return true;
+}
+
+
+//
+// Other masters reads, the long is read at once and an overlapping read is reported;
+// the debugger reads and the reads outside the range are not
+//
+CORE_TEST(HooksMemReadMasters)
+{
+	HooksTestStart();
+	uint32_t value = JaguarReadLong(HOOKSTEST_DATA + 4, DSP);
+	JaguarReadByte(HOOKSTEST_DATA + 8, BLITTER);
+	uint32_t overlap = JaguarReadLong(HOOKSTEST_DATA - 2, GPU);
+	JaguarReadWord(HOOKSTEST_DATA, DEBUG);
+	JaguarReadLong(HOOKSTEST_DATA, DEBUG);
+	JaguarReadWord(HOOKSTEST_DATA + 0x10, GPU);
+	HooksUnregister(HOOK_MEMREAD, HooksTestHook, NULL);
+
+	CORE_CHECK_EQUAL(value, 0x9ABCDEF0);
+	CORE_CHECK_EQUAL(hooksTestCount, 3);
+	CORE_CHECK(HooksTestCheck(0, HOOKSTEST_DATA + 4, 0x9ABCDEF0, 4, DSP));
+	CORE_CHECK(HooksTestCheck(1, HOOKSTEST_DATA + 8, 0x01, 1, BLITTER));
+	CORE_CHECK_EQUAL(overlap & 0xFFFF, 0x1234);
+	CORE_CHECK(HooksTestCheck(2, HOOKSTEST_DATA - 2, overlap, 4, GPU));
+	return true;
+}
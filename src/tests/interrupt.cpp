@@ -0,0 +1,418 @@
+//
+// Interrupts masked & nested, of the 68K, the GPU and the DSP
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Interrupt controller units, thru their registers & the save state
+//
+
+#include "coretest.h"
+
+#include <stdlib.h>
+#include "dsp.h"
+#include "gpu.h"
+#include "interrupt.h"
+#include "jaguar.h"
+#include "jerry.h"
+#include "state.h"
+#include "tom.h"
+
+#define INTERRUPTTEST_HANDLER	0x4100
+#define INTERRUPTTEST_VECTOR	0x100					// TOM interrupts vector (64)
+#define INTERRUPTTEST_TRAIL		0x10000					// Return address & counts written by the handlers
+#define INTERRUPTTEST_VI		101						// Halfline of the video interrupt
+
+// RISC local RAM layout: vectors, main program, handlers, stack & trail
+#define INTERRUPTTEST_RISC_MAIN		0x40
+#define INTERRUPTTEST_RISC_IDLE		0x54				// JR T, * of the main program
+#define INTERRUPTTEST_RISC_H0		0x100
+#define INTERRUPTTEST_RISC_H3		0x180
+#define INTERRUPTTEST_RISC_STACK	0x700
+#define INTERRUPTTEST_RISC_COUNT0	0x800
+#define INTERRUPTTEST_RISC_COUNT3	0x804
+#define INTERRUPTTEST_RISC_GO		0x808				// Set to leave the interrupt #0 handler
+#define INTERRUPTTEST_RISC_RETURN3	0x80C				// Return address of the interrupt #3
+
+// JRISC instructions
+#define RISC(op, first, second)		(uint16_t)(((op) << 10) | (((first) & 0x1F) << 5) | (second))
+#define RISC_MOVEI(value, reg)		RISC(38, 0, reg), (uint16_t)(value), (uint16_t)((value) >> 16)
+#define RISC_ADDQ	2
+#define RISC_BSET	14
+#define RISC_BCLR	15
+#define RISC_CMPQ	31
+#define RISC_LOAD	41
+#define RISC_STORE	47
+#define RISC_JUMP	52
+#define RISC_JR		53
+#define RISC_NOP	RISC(57, 0, 0)
+
+
+//
+// 68K program: the video interrupt enabled with the interrupts masked, and
+// waited for pending; the interrupts unmasked, it is taken around the NOP
+//
+static const uint16_t interruptTestMasked[] =
+{
+	0x46FC, 0x2700,							// MOVE #$2700, SR
+	0x33FC, 0x0001, 0x00F0, 0x00E0,			// MOVE.W #1, INT1
+	0x0839, 0x0000, 0x00F0, 0x00E1,			// wait: BTST #0, INT1 + 1
+	0x67F6,									// BEQ.S wait
+	0x46FC, 0x2000,							// MOVE #$2000, SR
+	0x4E71,									// NOP ($401A)
+	0x60FE									// BRA.S *
+};
+
+// Return address & count kept, the video interrupt cleared
+static const uint16_t interruptTestMaskedHandler[] =
+{
+	0x23EF, 0x0002, 0x0001, 0x0000,			// MOVE.L (2, A7), $10000
+	0x52B9, 0x0001, 0x0004,					// ADDQ.L #1, $10004
+	0x33FC, 0x0101, 0x00F0, 0x00E0,			// MOVE.W #$101, INT1
+	0x4E73									// RTE
+};
+
+
+//
+// 68K program: the video & the GPU interrupts enabled
+//
+static const uint16_t interruptTestNested[] =
+{
+	0x46FC, 0x2000,							// MOVE #$2000, SR
+	0x33FC, 0x0003, 0x00F0, 0x00E0,			// MOVE.W #3, INT1
+	0x60FE									// BRA.S *
+};
+
+// Entries, depth & the deepest kept; the video interrupt handler unmasks the
+// interrupts and raises the GPU interrupt, nested before the NOP
+static const uint16_t interruptTestNestedHandler[] =
+{
+	0x52B9, 0x0001, 0x0004,					// ADDQ.L #1, $10004
+	0x52B9, 0x0001, 0x0008,					// ADDQ.L #1, $10008
+	0x2039, 0x0001, 0x0008,					// MOVE.L $10008, D0
+	0xB0B9, 0x0001, 0x000C,					// CMP.L $1000C, D0
+	0x6F06,									// BLE.S pending
+	0x23C0, 0x0001, 0x000C,					// MOVE.L D0, $1000C
+	0x3039, 0x00F0, 0x00E0,					// pending: MOVE.W INT1, D0
+	0x0800, 0x0000,							// BTST #0, D0
+	0x671A,									// BEQ.S gpu
+	0x33FC, 0x0103, 0x00F0, 0x00E0,			// MOVE.W #$103, INT1
+	0x46FC, 0x2000,							// MOVE #$2000, SR
+	0x23FC, 0x0000, 0x0002, 0x00F0, 0x2114,	// MOVE.L #2, G_CTRL
+	0x4E71,									// NOP ($4142)
+	0x6010,									// BRA.S out
+	0x23EF, 0x0002, 0x0001, 0x0010,			// gpu: MOVE.L (2, A7), $10010
+	0x33FC, 0x0203, 0x00F0, 0x00E0,			// MOVE.W #$203, INT1
+	0x53B9, 0x0001, 0x0008,					// out: SUBQ.L #1, $10008
+	0x4E73									// RTE
+};
+
+
+//
+// Program & its handler loaded, the trail cleared, and the frame run
+//
+static void InterruptTestM68K(const uint16_t * program, size_t programCount, const uint16_t * handler, size_t handlerCount)
+{
+	const uint32_t vector[] = { INTERRUPTTEST_HANDLER };
+	const uint32_t trail[5] = { 0, 0, 0, 0, 0 };
+
+	CoreTestReset();
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, program, programCount);
+	CoreTestLoad16(INTERRUPTTEST_HANDLER, handler, handlerCount);
+	CoreTestLoad32(INTERRUPTTEST_VECTOR, vector, 1);
+	CoreTestLoad32(INTERRUPTTEST_TRAIL, trail, 5);
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	JaguarWriteWord(0xF0004E, INTERRUPTTEST_VI, M68K);
+	CoreTestRunFrames(1);
+}
+
+
+//
+// Interrupt pending while masked, taken once unmasked (the core takes it up to
+// one instruction after the unmask, as the 68000 samples the level ahead)
+//
+CORE_TEST(InterruptM68KMasked)
+{
+	InterruptTestM68K(interruptTestMasked, sizeof(interruptTestMasked) / sizeof(interruptTestMasked[0]), interruptTestMaskedHandler, sizeof(interruptTestMaskedHandler) / sizeof(interruptTestMaskedHandler[0]));
+
+	CORE_CHECK_EQUAL(JaguarReadLong(INTERRUPTTEST_TRAIL + 4, M68K), 1);
+	uint32_t pc = JaguarReadLong(INTERRUPTTEST_TRAIL, M68K);
+	CORE_CHECK((pc == 0x401A) || (pc == 0x401C));
+	return true;
+}
+
+
+//
+// GPU interrupt nested in the video interrupt handler, both handlers left
+//
+CORE_TEST(InterruptM68KNested)
+{
+	InterruptTestM68K(interruptTestNested, sizeof(interruptTestNested) / sizeof(interruptTestNested[0]), interruptTestNestedHandler, sizeof(interruptTestNestedHandler) / sizeof(interruptTestNestedHandler[0]));
+
+	CORE_CHECK_EQUAL(JaguarReadLong(INTERRUPTTEST_TRAIL + 4, M68K), 2);
+	CORE_CHECK_EQUAL(JaguarReadLong(INTERRUPTTEST_TRAIL + 8, M68K), 0);
+	CORE_CHECK_EQUAL(JaguarReadLong(INTERRUPTTEST_TRAIL + 12, M68K), 2);
+	CORE_CHECK_EQUAL(JaguarReadLong(INTERRUPTTEST_TRAIL + 16, M68K), 0x4142);
+	return true;
+}
+
+
+//
+// RISC processor, its local RAM & registers, and how it is run
+//
+struct InterruptTestRISC
+{
+	uint32_t ram;
+	uint32_t flags;
+	void (* exec)(int32_t);
+	void (* setIRQLine)(int, int);
+};
+
+
+//
+// Vector jumping to a handler
+//
+static void InterruptTestRISCVector(uint32_t address, uint32_t handler)
+{
+	const uint16_t vector[] =
+	{
+		RISC_MOVEI(handler, 30),
+		RISC(RISC_JUMP, 30, 0),				// JUMP T, (r30)
+		RISC_NOP
+	};
+
+	for (size_t i = 0; i < (sizeof(vector) / sizeof(vector[0])); i++)
+	{
+		JaguarWriteWord(address + (i * 2), vector[i], M68K);
+	}
+}
+
+
+//
+// Program loaded in the local RAM: the main program enables the interrupts #0 & #3 and idles;
+// the interrupt #0 handler counts and waits for the go, the interrupt #3 one counts and keeps
+// its return address; both return clearing IMASK & their latch in the jump delay slot
+//
+static void InterruptTestRISCLoad(const InterruptTestRISC & risc)
+{
+	const uint32_t ram = risc.ram;
+	const uint16_t program[] =
+	{
+		// Main
+		RISC_MOVEI(risc.flags, 29),
+		RISC_MOVEI(ram + INTERRUPTTEST_RISC_STACK, 31),
+		RISC_MOVEI(0x90, 0),					// INT_ENA0 | INT_ENA3
+		RISC(RISC_STORE, 29, 0),				// STORE r0, (r29)
+		RISC(RISC_JR, -1, 0),					// JR T, *
+		RISC_NOP
+	};
+	const uint16_t handler0[] =
+	{
+		RISC_MOVEI(ram + INTERRUPTTEST_RISC_COUNT0, 1),
+		RISC(RISC_LOAD, 1, 2),					// LOAD (r1), r2
+		RISC(RISC_ADDQ, 1, 2),					// ADDQ #1, r2
+		RISC(RISC_STORE, 1, 2),					// STORE r2, (r1)
+		RISC_MOVEI(ram + INTERRUPTTEST_RISC_GO, 3),
+		RISC(RISC_LOAD, 3, 4),					// wait: LOAD (r3), r4
+		RISC(RISC_CMPQ, 0, 4),					// CMPQ #0, r4
+		RISC(RISC_JR, -3, 2),					// JR Z, wait
+		RISC_NOP,
+		RISC(RISC_LOAD, 29, 28),				// LOAD (r29), r28
+		RISC(RISC_BCLR, 3, 28),					// BCLR #3, r28 (IMASK)
+		RISC(RISC_BSET, 9, 28),					// BSET #9, r28 (CINT0)
+		RISC(RISC_LOAD, 31, 30),				// LOAD (r31), r30
+		RISC(RISC_ADDQ, 2, 30),					// ADDQ #2, r30
+		RISC(RISC_ADDQ, 4, 31),					// ADDQ #4, r31
+		RISC(RISC_JUMP, 30, 0),					// JUMP T, (r30)
+		RISC(RISC_STORE, 29, 28)				// STORE r28, (r29)
+	};
+	const uint16_t handler3[] =
+	{
+		RISC_MOVEI(ram + INTERRUPTTEST_RISC_COUNT3, 1),
+		RISC(RISC_LOAD, 1, 2),					// LOAD (r1), r2
+		RISC(RISC_ADDQ, 1, 2),					// ADDQ #1, r2
+		RISC(RISC_STORE, 1, 2),					// STORE r2, (r1)
+		RISC(RISC_LOAD, 31, 5),					// LOAD (r31), r5
+		RISC_MOVEI(ram + INTERRUPTTEST_RISC_RETURN3, 6),
+		RISC(RISC_STORE, 6, 5),					// STORE r5, (r6)
+		RISC(RISC_LOAD, 29, 28),				// LOAD (r29), r28
+		RISC(RISC_BCLR, 3, 28),					// BCLR #3, r28 (IMASK)
+		RISC(RISC_BSET, 12, 28),				// BSET #12, r28 (CINT3)
+		RISC(RISC_LOAD, 31, 30),				// LOAD (r31), r30
+		RISC(RISC_ADDQ, 2, 30),					// ADDQ #2, r30
+		RISC(RISC_ADDQ, 4, 31),					// ADDQ #4, r31
+		RISC(RISC_JUMP, 30, 0),					// JUMP T, (r30)
+		RISC(RISC_STORE, 29, 28)				// STORE r28, (r29)
+	};
+
+	InterruptTestRISCVector(ram, ram + INTERRUPTTEST_RISC_H0);
+	InterruptTestRISCVector(ram + 0x30, ram + INTERRUPTTEST_RISC_H3);
+
+	for (size_t i = 0; i < (sizeof(program) / sizeof(program[0])); i++)
+	{
+		JaguarWriteWord(ram + INTERRUPTTEST_RISC_MAIN + (i * 2), program[i], M68K);
+	}
+
+	for (size_t i = 0; i < (sizeof(handler0) / sizeof(handler0[0])); i++)
+	{
+		JaguarWriteWord(ram + INTERRUPTTEST_RISC_H0 + (i * 2), handler0[i], M68K);
+	}
+
+	for (size_t i = 0; i < (sizeof(handler3) / sizeof(handler3[0])); i++)
+	{
+		JaguarWriteWord(ram + INTERRUPTTEST_RISC_H3 + (i * 2), handler3[i], M68K);
+	}
+
+	for (uint32_t i = INTERRUPTTEST_RISC_COUNT0; i <= INTERRUPTTEST_RISC_RETURN3; i += 4)
+	{
+		JaguarWriteLong(ram + i, 0, M68K);
+	}
+
+	JaguarWriteLong(risc.flags + 0x10, ram + INTERRUPTTEST_RISC_MAIN, M68K);	// PC
+	JaguarWriteLong(risc.flags + 0x14, 0x01, M68K);								// GO
+}
+
+
+//
+// Interrupt #3 latched in the interrupt #0 handler: masked up to its return, then taken
+// after the return jump, IMASK being cleared in its delay slot
+//
+static bool InterruptTestRISCMasked(const InterruptTestRISC & risc)
+{
+	const uint32_t ram = risc.ram;
+
+	risc.exec(200);
+	CORE_CHECK_EQUAL(JaguarReadLong(risc.flags + 0x10, M68K), ram + INTERRUPTTEST_RISC_IDLE);
+	risc.setIRQLine(0, ASSERT_LINE);
+	risc.exec(200);
+	CORE_CHECK_EQUAL(JaguarReadLong(ram + INTERRUPTTEST_RISC_COUNT0, M68K), 1);
+
+	// In the handler, IMASK set
+	risc.setIRQLine(3, ASSERT_LINE);
+	risc.exec(200);
+	CORE_CHECK_EQUAL(JaguarReadLong(ram + INTERRUPTTEST_RISC_COUNT3, M68K), 0);
+
+	// Handler left, the interrupted main program returned to before the interrupt #3
+	JaguarWriteLong(ram + INTERRUPTTEST_RISC_GO, 1, M68K);
+	risc.exec(200);
+	CORE_CHECK_EQUAL(JaguarReadLong(ram + INTERRUPTTEST_RISC_COUNT0, M68K), 1);
+	CORE_CHECK_EQUAL(JaguarReadLong(ram + INTERRUPTTEST_RISC_COUNT3, M68K), 1);
+	CORE_CHECK_EQUAL(JaguarReadLong(ram + INTERRUPTTEST_RISC_RETURN3, M68K) + 2, ram + INTERRUPTTEST_RISC_IDLE);
+	CORE_CHECK_EQUAL(JaguarReadLong(risc.flags, M68K) & 0x08, 0);
+	CORE_CHECK_EQUAL(JaguarReadLong(risc.flags + 0x10, M68K), ram + INTERRUPTTEST_RISC_IDLE);
+	return true;
+}
+
+
+CORE_TEST(InterruptGPUMasked)
+{
+	const InterruptTestRISC gpu = { 0xF03000, 0xF02100, GPUExec, GPUSetIRQLine };
+
+	CoreTestReset();
+	InterruptTestRISCLoad(gpu);
+	return InterruptTestRISCMasked(gpu);
+}
+
+
+CORE_TEST(InterruptDSPMasked)
+{
+	const InterruptTestRISC dsp = { 0xF1B000, 0xF1A100, DSPExec, DSPSetIRQLine };
+
+	CoreTestReset();
+	InterruptTestRISCLoad(dsp);
+	return InterruptTestRISCMasked(dsp);
+}
+
+
+//
+// GPU interrupt latched while disabled, then enabled: taken at the next timeslice start
+//
+CORE_TEST(InterruptGPUEnabled)
+{
+	const InterruptTestRISC gpu = { 0xF03000, 0xF02100, GPUExec, GPUSetIRQLine };
+
+	CoreTestReset();
+	InterruptTestRISCLoad(gpu);
+	GPUSetIRQLine(0, ASSERT_LINE);
+	GPUExec(200);
+	GPUExec(200);
+
+	CORE_CHECK_EQUAL(JaguarReadLong(0xF03000 + INTERRUPTTEST_RISC_COUNT0, M68K), 1);
+	CORE_CHECK_EQUAL(JaguarReadLong(0xF02100, M68K) & 0x08, 0x08);
+	return true;
+}
+
+
+//
+// Latches & enables of the four units, written & read thru the chips registers
+// (not taken: the latched interrupts are not enabled), and kept by the save state
+//
+CORE_TEST(InterruptControllerUnits)
+{
+	size_t size;
+
+	CoreTestReset();
+
+	// TOM: the enables byte written alone, then the word with a latch cleared
+	JaguarWriteByte(0xF000E1, 0x18, M68K);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_TOM), 0x18);
+	CORE_CHECK(!InterruptTOMRequest(IRQ_VIDEO));
+	CORE_CHECK(InterruptTOMRequest(IRQ_TIMER));
+	InterruptLatch(INTERRUPT_TOM, 1 << IRQ_OPFLAG);
+	CORE_CHECK_EQUAL(JaguarReadWord(0xF000E0, M68K), 0x0C);
+	JaguarWriteWord(0xF000E0, 0x0410, M68K);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_TOM), 0x10);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_TOM), 0x08);
+
+	// JERRY: the latches cleared by the high byte
+	JaguarWriteWord(0xF10020, 0x0014, M68K);
+	CORE_CHECK(!InterruptJERRYRequest(IRQ2_DSP));
+	CORE_CHECK(InterruptJERRYRequest(IRQ2_TIMER1));
+	CORE_CHECK(InterruptJERRYRequest(IRQ2_ASI));
+	CORE_CHECK_EQUAL(JaguarReadWord(0xF10020, M68K), 0x14);
+	JaguarWriteWord(0xF10020, 0x0414, M68K);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_JERRY), 0x10);
+
+	// GPU: latches in G_CTRL, enables in G_FLAGS, a latch cleared by G_FLAGS
+	GPUWriteLong(0xF02100, 0x0100, M68K);
+	GPUSetIRQLine(GPUIRQ_DSP, ASSERT_LINE);
+	GPUSetIRQLine(GPUIRQ_TIMER, ASSERT_LINE);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_GPU), 0x10);
+	CORE_CHECK_EQUAL(GPUReadLong(0xF02114, M68K), 0x2800 | 0x0180);
+	GPUWriteLong(0xF02100, 0x0100 | 0x0400, M68K);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_GPU), 0x04);
+	CORE_CHECK_EQUAL(GPUReadLong(0xF02100, M68K) & 0x01F8, 0x0100);
+
+	// DSP: the external interrupt #1 enable, latch & clear are the bits 16 & 17 of D_FLAGS & D_CTRL
+	DSPWriteLong(0xF1A100, 0x0020, M68K);
+	DSPSetIRQLine(DSPIRQ_TIMER0, ASSERT_LINE);
+	DSPSetIRQLine(DSPIRQ_EXT1, ASSERT_LINE);
+	CORE_CHECK_EQUAL(DSPReadLong(0xF1A114, M68K), 0x2000 | 0x10100);
+	DSPWriteLong(0xF1A100, 0x30020, M68K);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_DSP), 0x22);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_DSP), 0x04);
+	CORE_CHECK_EQUAL(DSPReadLong(0xF1A100, M68K) & 0x101F8, 0x10020);
+
+	// Units cleared by a reset, set back by a state load
+	uint8_t * state = StateDumpToMemory(&size);
+	CORE_CHECK(state != NULL);
+	CoreTestReset();
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_DSP), 0);
+	int loaded = StateLoadFromMemory(state, size);
+	free(state);
+	CORE_CHECK(loaded);
+
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_TOM), 0x10);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_TOM), 0x08);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_JERRY), 0x14);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_JERRY), 0x10);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_GPU), 0x10);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_GPU), 0x04);
+	CORE_CHECK_EQUAL(InterruptEnabled(INTERRUPT_DSP), 0x22);
+	CORE_CHECK_EQUAL(InterruptPending(INTERRUPT_DSP), 0x04);
+	CORE_CHECK_EQUAL(GPUReadLong(0xF02114, M68K), 0x2800 | 0x0100);
+	CORE_CHECK_EQUAL(DSPReadLong(0xF1A114, M68K), 0x2000 | 0x0100);
+	return true;
+}
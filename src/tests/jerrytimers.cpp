@@ -0,0 +1,284 @@
+//
+// JERRY timers, counters & underflows against the RISC cycles
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Long drift case, 68K & GPU reads
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include "dac.h"
+#include "dsp.h"
+#include "event.h"
+#include "gpu.h"
+#include "jaguar.h"
+#include "jerry.h"
+#include "settings.h"
+#include "m68000/m68kinterface.h"
+
+// Timer 1 registers, and its counters
+#define JERRYTIMERS_PIT1_PRESCALER		0xF10000
+#define JERRYTIMERS_PIT1_DIVIDER		0xF10002
+#define JERRYTIMERS_PIT1_PRESCALER_COUNT	0xF10036
+#define JERRYTIMERS_PIT1_DIVIDER_COUNT	0xF10038
+
+// DSP & GPU programs, and their results
+#define JERRYTIMERS_DSP_PROGRAM			0xF1B000
+#define JERRYTIMERS_DSP_RESULTS			0xF1B100
+#define JERRYTIMERS_GPU_PROGRAM			0xF03000
+#define JERRYTIMERS_GPU_RESULTS			0xF03100
+
+// RISC instructions
+#define RISC_OP(_op, _r1, _r2)		(uint16_t)(((_op) << 10) | ((_r1) << 5) | (_r2))
+#define RISC_MOVEI(_r, _value)		RISC_OP(38, 0, _r), (uint16_t)(_value), (uint16_t)((_value) >> 16)
+#define RISC_LOADW(_ra, _r)			RISC_OP(40, _ra, _r)
+#define RISC_STOREW(_r, _ra)		RISC_OP(46, _ra, _r)
+#define RISC_STORE(_r, _ra)			RISC_OP(47, _ra, _r)
+#define RISC_NOP					RISC_OP(57, 0, 0)
+#define RISC_JR_SELF				RISC_OP(53, 0x1F, 0)
+
+static bool jerryTimersStop;
+
+
+static void JERRYTimersTestStop(void)
+{
+	jerryTimersStop = true;
+}
+
+
+//
+// JERRY events list run for a number of RISC cycles, without the DSP
+//
+static void JERRYTimersTestRun(uint64_t cycles)
+{
+	double cycleInUsec = (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+
+	jerryTimersStop = false;
+	SetCallbackTime(JERRYTimersTestStop, (double)cycles * cycleInUsec, EVENT_JERRY);
+
+	// The next event is picked by the time to it
+	while (!jerryTimersStop)
+	{
+		GetTimeToNextEvent(EVENT_JERRY);
+		HandleNextEvent(EVENT_JERRY);
+	}
+}
+
+
+//
+// Timer 1 counters, as a count of cycles before its underflow
+//
+static uint32_t JERRYTimersTestRemaining(uint32_t prescaler)
+{
+	uint32_t divider = JaguarReadWord(JERRYTIMERS_PIT1_DIVIDER_COUNT, M68K);
+	return (divider * (prescaler + 1)) + JaguarReadWord(JERRYTIMERS_PIT1_PRESCALER_COUNT, M68K);
+}
+
+
+//
+// Timer 1 counters over a thousand underflows, then reloaded
+// Each underflow is anchored to the cycles from the start, the counters don't drift
+//
+static bool JERRYTimersTestDrift(void)
+{
+	const uint32_t prescaler = 99, divider = 9, period = 1000;
+
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, prescaler, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, divider, M68K);
+	CORE_CHECK_EQUAL(JERRYTimersTestRemaining(prescaler), period - 1);
+
+	JERRYTimersTestRun((1000 * period) + 357);
+	CORE_CHECK_EQUAL(JERRYTimersTestRemaining(prescaler), period - 357 - 1);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_DIVIDER_COUNT, M68K), 6);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_PRESCALER_COUNT, M68K), 42);
+
+	// Reload, the count restarts from the write with the new period
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 19, M68K);
+	CORE_CHECK_EQUAL(JERRYTimersTestRemaining(prescaler), (2 * period) - 1);
+	JERRYTimersTestRun((500 * 2 * period) + 1234);
+	CORE_CHECK_EQUAL(JERRYTimersTestRemaining(prescaler), (2 * period) - 1234 - 1);
+
+	// Stopped timer, the counters give the programmed values
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, 0, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 0, M68K);
+	JERRYTimersTestRun(5000);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_DIVIDER_COUNT, M68K), 0);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_PRESCALER_COUNT, M68K), 0);
+
+	// A million underflows, the counters still on the cycles from the reload
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, prescaler, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, divider, M68K);
+	JERRYTimersTestRun(1000000000ULL + 357);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_DIVIDER_COUNT, M68K), 6);
+	CORE_CHECK_EQUAL(JaguarReadWord(JERRYTIMERS_PIT1_PRESCALER_COUNT, M68K), 42);
+	return true;
+}
+
+
+CORE_TEST(JERRYTimersDriftNTSC)
+{
+	return JERRYTimersTestDrift();
+}
+
+
+CORE_TEST(JERRYTimersDriftPAL)
+{
+	vjs.hardwareTypeNTSC = false;
+	return JERRYTimersTestDrift();
+}
+
+
+//
+// Counters read twice by the 68K in a slice, they follow the cycles it has run at half the RISC clock
+//
+CORE_TEST(JERRYTimers68KReads)
+{
+	const uint16_t program[] =
+	{
+		0x3039, 0x00F1, 0x0038,		// MOVE.W PIT1 divider count, D0
+		0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71,		// NOP x 10
+		0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71,
+		0x3239, 0x00F1, 0x0038,		// MOVE.W PIT1 divider count, D1
+		0x60FE						// BRA.S *
+	};
+
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, 0, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 0xFFFF, M68K);
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, program, sizeof(program) / sizeof(program[0]));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	CoreTestRunFrames(1);
+
+	// MOVE.W (16 cycles) and 10 NOP (4 cycles each)
+	uint32_t first = m68k_get_reg(NULL, M68K_REG_D0) & 0xFFFF;
+	uint32_t second = m68k_get_reg(NULL, M68K_REG_D1) & 0xFFFF;
+	CORE_CHECK_EQUAL(first - second, 2 * (16 + (10 * 4)));
+	return true;
+}
+
+
+//
+// Counters read twice by the GPU in a slice
+//
+CORE_TEST(JERRYTimersGPUReads)
+{
+	const uint16_t program[] =
+	{
+		RISC_MOVEI(1, JERRYTIMERS_PIT1_DIVIDER_COUNT),
+		RISC_MOVEI(4, JERRYTIMERS_GPU_RESULTS),
+		RISC_MOVEI(5, JERRYTIMERS_GPU_RESULTS + 4),
+		RISC_LOADW(1, 2),
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_LOADW(1, 3),
+		RISC_STORE(2, 4),
+		RISC_STORE(3, 5),
+		RISC_JR_SELF,
+		RISC_NOP
+	};
+
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, 0, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 0xFFFF, M68K);
+
+	for (size_t i = 0; i < sizeof(program) / sizeof(program[0]); i++)
+	{
+		GPUWriteWord(JERRYTIMERS_GPU_PROGRAM + (i * 2), program[i], M68K);
+	}
+
+	GPUWriteLong(0xF02110, JERRYTIMERS_GPU_PROGRAM, M68K);
+	GPUWriteLong(0xF02114, 0x01, M68K);
+	GPUExec(200);
+
+	uint32_t first = JaguarReadLong(JERRYTIMERS_GPU_RESULTS, M68K);
+	uint32_t second = JaguarReadLong(JERRYTIMERS_GPU_RESULTS + 4, M68K);
+	// LOADW and 10 NOP, after 3 MOVEI; the GPU core gives a cycle to each instruction
+	CORE_CHECK_EQUAL(first - second, 1 + 10);
+	CORE_CHECK_EQUAL(first, 0xFFFF - 3);
+	return true;
+}
+
+
+//
+// DSP program run for one audio sample
+//
+static void JERRYTimersTestDSP(const uint16_t * program, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		DSPWriteWord(JERRYTIMERS_DSP_PROGRAM + (i * 2), program[i], M68K);
+	}
+
+	DSPWriteLong(0xF1A110, JERRYTIMERS_DSP_PROGRAM, M68K);
+	DSPWriteLong(0xF1A114, 0x01, M68K);
+	DACExecHeadless(1);
+}
+
+
+//
+// Counters read twice by the DSP in a slice, they follow the cycles it has run
+//
+CORE_TEST(JERRYTimersDSPReads)
+{
+	const uint16_t program[] =
+	{
+		RISC_MOVEI(1, JERRYTIMERS_PIT1_DIVIDER_COUNT),
+		RISC_MOVEI(4, JERRYTIMERS_DSP_RESULTS),
+		RISC_MOVEI(5, JERRYTIMERS_DSP_RESULTS + 4),
+		RISC_LOADW(1, 2),
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_LOADW(1, 3),
+		RISC_STORE(2, 4),
+		RISC_STORE(3, 5),
+		RISC_JR_SELF,
+		RISC_NOP
+	};
+
+	// Divider count on each cycle
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, 0, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 0xFFFF, M68K);
+	JERRYTimersTestDSP(program, sizeof(program) / sizeof(program[0]));
+
+	uint32_t first = JaguarReadLong(JERRYTIMERS_DSP_RESULTS, M68K);
+	uint32_t second = JaguarReadLong(JERRYTIMERS_DSP_RESULTS + 4, M68K);
+	// LOADW (2 cycles), and 10 NOP
+	CORE_CHECK_EQUAL(first - second, 2 + 10);
+	// 3 MOVEI run before the first read
+	CORE_CHECK_EQUAL(first, 0xFFFF - 3);
+	return true;
+}
+
+
+//
+// Timer reloaded by the DSP in a slice, the count restarts from its write
+//
+CORE_TEST(JERRYTimersDSPReload)
+{
+	const uint16_t program[] =
+	{
+		RISC_MOVEI(1, JERRYTIMERS_PIT1_DIVIDER_COUNT),
+		RISC_MOVEI(4, JERRYTIMERS_DSP_RESULTS),
+		RISC_MOVEI(6, JERRYTIMERS_PIT1_DIVIDER),
+		RISC_MOVEI(7, 0x1000),
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_STOREW(7, 6),
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP, RISC_NOP,
+		RISC_LOADW(1, 2),
+		RISC_STORE(2, 4),
+		RISC_JR_SELF,
+		RISC_NOP
+	};
+
+	JaguarWriteWord(JERRYTIMERS_PIT1_PRESCALER, 0, M68K);
+	JaguarWriteWord(JERRYTIMERS_PIT1_DIVIDER, 0xFFFF, M68K);
+	JERRYTimersTestDSP(program, sizeof(program) / sizeof(program[0]));
+
+	// Period of $1001 cycles, STOREW (1 cycle) and 10 NOP run since the reload
+	CORE_CHECK_EQUAL(JaguarReadLong(JERRYTIMERS_DSP_RESULTS, M68K), 0x1001 - (1 + 10) - 1);
+	return true;
+}
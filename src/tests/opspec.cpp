@@ -0,0 +1,198 @@
+//
+// Object Processor speculation, halflines rendered ahead against the serial rendering
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <vector>
+#include <zlib.h>
+#include "hooks.h"
+#include "jaguar.h"
+#include "memory.h"
+#include "op.h"
+#include "settings.h"
+#include "tom.h"
+
+#define OPSPECTEST_FRAMES		30
+#define OPSPECTEST_LIST			0x10000				// Object list
+#define OPSPECTEST_DATA1		0x30000				// Bitmaps data
+#define OPSPECTEST_DATA2		0x31000
+#define OPSPECTEST_LINE_BUFFER	0x1800				// TOM line buffer, and its size
+#define OPSPECTEST_LINE_SIZE	(0x5A0 * 2)
+
+static std::vector<uint32_t> opSpecTestCRCs;
+
+
+//
+// Object phrases
+//
+static uint64_t OPSpecTestBitmap0(uint32_t data, uint32_t link, uint32_t height, uint32_t ypos, uint32_t type)
+{
+	return ((uint64_t)(data >> 3) << 43) | ((uint64_t)(link >> 3) << 24) | ((uint64_t)height << 14) | ((uint64_t)ypos << 3) | type;
+}
+
+
+static uint64_t OPSpecTestBitmap1(uint32_t flags, uint32_t index, uint32_t iwidth, uint32_t dwidth, uint32_t pitch, uint32_t depth, uint32_t xpos)
+{
+	return ((uint64_t)flags << 45) | ((uint64_t)index << 37) | ((uint64_t)iwidth << 28) | ((uint64_t)dwidth << 18) | ((uint64_t)pitch << 15) | ((uint64_t)depth << 12) | (xpos & 0xFFF);
+}
+
+
+static void OPSpecTestPhrase(uint32_t address, uint64_t phrase)
+{
+	JaguarWriteLong(address, phrase >> 32, M68K);
+	JaguarWriteLong(address + 4, (uint32_t)phrase, M68K);
+}
+
+
+//
+// Video set up, and the object list written again, moving, at each frame
+// Bitmap, scaled, CLUT bitmap, branch & stop objects
+//
+static void OPSpecTestFrameStart(void * userData, uint32_t frame, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+	(void)userData; (void)arg1; (void)arg2; (void)arg3;
+
+	JaguarWriteWord(0xF00028, 0x0687, M68K);		// VMODE
+	JaguarWriteWord(0xF0003E, 523, M68K);			// VP
+	JaguarWriteWord(0xF00046, 40, M68K);			// VDB
+	JaguarWriteWord(0xF00048, 500, M68K);			// VDE
+	// OLP, the low word first
+	JaguarWriteWord(0xF00020, OPSPECTEST_LIST & 0xFFFF, M68K);
+	JaguarWriteWord(0xF00022, OPSPECTEST_LIST >> 16, M68K);
+	JaguarWriteWord(0xF00058, 0x1234, M68K);		// BG
+
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x00, OPSpecTestBitmap0(0x9000, OPSPECTEST_LIST + 0x20, 60, 100, 0));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x08, OPSpecTestBitmap1(0, 0, 20, 20, 1, 4, 20 + (frame % 40)));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x20, OPSpecTestBitmap0(OPSPECTEST_DATA1, OPSPECTEST_LIST + 0x40, 80, 150, 1));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x28, OPSpecTestBitmap1(0, 0, 10, 10, 1, 3, 100 - (frame % 30)));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x30, 0x00201830 | (frame & 7));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x40, OPSpecTestBitmap0(OPSPECTEST_DATA2, OPSPECTEST_LIST + 0x60, 50, 120, 0));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x48, OPSpecTestBitmap1(4, 0x20, 8, 8, 1, 2, 200));
+	// Branch to the stop object while the halfline is below $1F0
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x60, OPSpecTestBitmap0(0, OPSPECTEST_LIST + 0x70, 0, 0x1F0, 3) | (1ULL << 14));
+	OPSpecTestPhrase(OPSPECTEST_LIST + 0x70, 4);
+}
+
+
+//
+// Line buffer of each halfline kept, the background & a bitmap changed in the frame
+//
+static void OPSpecTestHalfline(void * userData, uint32_t vc, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+	(void)userData; (void)arg1; (void)arg2; (void)arg3;
+
+	opSpecTestCRCs.push_back(crc32(0, &tomRam8[OPSPECTEST_LINE_BUFFER], OPSPECTEST_LINE_SIZE));
+
+	if ((vc & 0x7FF) == 200)
+	{
+		JaguarWriteWord(0xF00058, 0x4321 + vc, M68K);
+	}
+	else if ((vc & 0x7FF) == 260)
+	{
+		// Each row of the scaled bitmap, the one of the halfline rendered ahead too
+		for (uint32_t row = 0; row < 80; row++)
+		{
+			JaguarWriteLong(OPSPECTEST_DATA1 + (row * 80) + 8, 0xDEADBEEF ^ opSpecTestCRCs.back(), M68K);
+		}
+	}
+}
+
+
+//
+// Frames rendered with a speculation setting, the line buffers CRC32 & the statistics are returned
+//
+static void OPSpecTestRun(uint32_t speculation, std::vector<uint32_t> & crcs, OPSpecStats & stats)
+{
+	const uint16_t idle[] = { 0x60FE };				// BRA.S *
+	OPSpecStats before;
+
+	CoreTestReset();
+	vjs.opSpeculation = speculation;
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, idle, 1);
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+	for (uint32_t i = 0; i < 0x800; i++)
+	{
+		JaguarWriteByte(OPSPECTEST_DATA1 + i, (uint8_t)(i * 7), M68K);
+	}
+
+	for (uint32_t i = 0; i < 0x400; i++)
+	{
+		JaguarWriteByte(OPSPECTEST_DATA2 + i, (uint8_t)(i * 13), M68K);
+	}
+
+	// CLUT
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		JaguarWriteWord(0xF00400 + (i * 2), (uint16_t)((i * 0x0101) + 3), M68K);
+	}
+
+	opSpecTestCRCs.clear();
+	OPSpecGetStats(&before);
+	HooksRegister(HOOK_FRAMESTART, OPSpecTestFrameStart, NULL);
+	HooksRegister(HOOK_HALFLINE, OPSpecTestHalfline, NULL);
+	CoreTestRunFrames(OPSPECTEST_FRAMES);
+	HooksUnregister(HOOK_FRAMESTART, OPSpecTestFrameStart, NULL);
+	HooksUnregister(HOOK_HALFLINE, OPSpecTestHalfline, NULL);
+	OPSpecGetStats(&stats);
+	vjs.opSpeculation = OPSPEC_OFF;
+
+	crcs = opSpecTestCRCs;
+	stats.committed -= before.committed;
+	stats.conflicts -= before.conflicts;
+	stats.verified -= before.verified;
+	stats.mismatches -= before.mismatches;
+}
+
+
+//
+// Line buffers bit for bit the same as the serial rendering, halfline by halfline
+// The writes to the bitmaps in the frame are conflicts, the other halflines are committed
+//
+CORE_TEST(OPSpecDeterminism)
+{
+	std::vector<uint32_t> serial, speculative;
+	OPSpecStats stats;
+
+	OPSpecTestRun(OPSPEC_OFF, serial, stats);
+	OPSpecTestRun(OPSPEC_ON, speculative, stats);
+
+	CORE_CHECK(!serial.empty());
+	CORE_CHECK_EQUAL(speculative.size(), serial.size());
+	size_t first = 0;
+
+	while ((first < serial.size()) && (serial[first] == speculative[first]))
+	{
+		first++;
+	}
+
+	CORE_CHECK_EQUAL(first, serial.size());
+	CORE_CHECK(stats.committed > 0);
+	CORE_CHECK(stats.conflicts > 0);
+	return true;
+}
+
+
+//
+// Verify mode, each halfline rendered ahead is rendered again serially, and found the same
+//
+CORE_TEST(OPSpecVerify)
+{
+	std::vector<uint32_t> serial, verified;
+	OPSpecStats stats;
+
+	OPSpecTestRun(OPSPEC_OFF, serial, stats);
+	OPSpecTestRun(OPSPEC_VERIFY, verified, stats);
+
+	CORE_CHECK(verified == serial);
+	CORE_CHECK(stats.verified > 0);
+	CORE_CHECK_EQUAL(stats.mismatches, 0);
+	return true;
+}
@@ -0,0 +1,224 @@
+//
+// Long accesses conformance, done at once against two word accesses, in the DRAM, TOM & JERRY, and HC bytes
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <zlib.h>
+#include "event.h"
+#include "hooks.h"
+#include "jaguar.h"
+
+// Ranges without side effects: DRAM across the end of its mirror, TOM & JERRY plain registers,
+// line buffers, "fast" GPU writes & GPU/DSP local RAM
+struct RegistersTestRange
+{
+	uint32_t start, end;
+};
+
+static const RegistersTestRange registersTestRanges[] =
+{
+	{ 0x1FF000, 0x201000 },
+	{ 0xF00008, 0xF00028 },
+	{ 0xF00054, 0xF000E0 },
+	{ 0xF000E4, 0xF00400 },
+	{ 0xF00800, 0xF02100 },
+	{ 0xF022A0, 0xF04000 },
+	{ 0xF04000, 0xF08000 },
+	{ 0xF0B000, 0xF10000 },
+	{ 0xF10008, 0xF10020 },
+	{ 0xF10040, 0xF14000 },
+	{ 0xF1A120, 0xF1A148 },
+	{ 0xF1A158, 0xF20000 }
+};
+
+#define REGISTERSTEST_RANGES	(sizeof(registersTestRanges) / sizeof(registersTestRanges[0]))
+
+// Value classes
+static const uint32_t registersTestValues[] = { 0x00000000, 0xFFFFFFFF, 0x80000001, 0x12345678 };
+
+static uint32_t registersTestHookCalls, registersTestHookBytes;
+static uint32_t registersTestHCReads, registersTestHCMismatches, registersTestHCLowBytes;
+
+#define REGISTERSTEST_HC_READS		2000
+#define REGISTERSTEST_HC_PERIOD		7.3						// Between the HC reads, in usec
+
+
+//
+// Ranges read back by words, the reference accesses
+//
+static uint32_t RegistersTestCRC32(void)
+{
+	uint32_t crc = 0;
+
+	for (uint32_t i = 0; i < REGISTERSTEST_RANGES; i++)
+	{
+		for (uint32_t address = registersTestRanges[i].start; address < registersTestRanges[i].end; address += 2)
+		{
+			uint8_t word[2];
+			uint16_t data = JaguarReadWord(address, DEBUG);
+
+			word[0] = data >> 8;
+			word[1] = data & 0xFF;
+			crc = crc32(crc, word, 2);
+		}
+	}
+
+	return crc;
+}
+
+
+//
+// Ranges written by longs, aligned or not, for each value class
+//
+static void RegistersTestWrite(bool words, uint32_t who, uint32_t misalignment, uint32_t value)
+{
+	for (uint32_t i = 0; i < REGISTERSTEST_RANGES; i++)
+	{
+		for (uint32_t address = registersTestRanges[i].start + misalignment; (address + 4) <= registersTestRanges[i].end; address += 4)
+		{
+			uint32_t data = value ^ (address & ((value == 0x12345678) ? 0xFFFFFFFF : 0));
+
+			if (words)
+			{
+				JaguarWriteWord(address, data >> 16, who);
+				JaguarWriteWord(address + 2, data & 0xFFFF, who);
+			}
+			else
+			{
+				JaguarWriteLong(address, data, who);
+			}
+		}
+	}
+}
+
+
+//
+// Memory written by each master, the same as by two word writes
+//
+CORE_TEST(RegistersLongWrite)
+{
+	const uint32_t masters[] = { M68K, GPU, DSP, BLITTER };
+
+	for (uint32_t m = 0; m < (sizeof(masters) / sizeof(masters[0])); m++)
+	{
+		for (uint32_t v = 0; v < (sizeof(registersTestValues) / sizeof(registersTestValues[0])); v++)
+		{
+			for (uint32_t misalignment = 0; misalignment <= 2; misalignment += 2)
+			{
+				CoreTestReset();
+				RegistersTestWrite(true, masters[m], misalignment, registersTestValues[v]);
+				uint32_t reference = RegistersTestCRC32();
+				CoreTestReset();
+				RegistersTestWrite(false, masters[m], misalignment, registersTestValues[v]);
+
+				CORE_CHECK_EQUAL(RegistersTestCRC32(), reference);
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//
+// Longs read, aligned or not, the same as two word reads
+//
+CORE_TEST(RegistersLongRead)
+{
+	CoreTestReset();
+	RegistersTestWrite(false, M68K, 0, 0x12345678);
+
+	for (uint32_t i = 0; i < REGISTERSTEST_RANGES; i++)
+	{
+		for (uint32_t address = registersTestRanges[i].start; (address + 4) <= registersTestRanges[i].end; address += 2)
+		{
+			uint32_t words = (JaguarReadWord(address, M68K) << 16) | JaguarReadWord(address + 2, M68K);
+			CORE_CHECK_EQUAL(JaguarReadLong(address, M68K), words);
+		}
+	}
+
+	return true;
+}
+
+
+static void RegistersTestHook(void * userData, uint32_t address, uint32_t value, uint32_t size, uint32_t who)
+{
+	(void)userData; (void)address; (void)value; (void)who;
+	registersTestHookCalls++;
+	registersTestHookBytes += size;
+}
+
+
+//
+// Long written at once: one memory write hook call, for the 4 bytes
+//
+CORE_TEST(RegistersLongHook)
+{
+	const uint32_t addresses[] = { 0x10000, 0xF03000, 0xF1B000, 0xF1D000 };
+
+	CoreTestReset();
+
+	for (uint32_t i = 0; i < (sizeof(addresses) / sizeof(addresses[0])); i++)
+	{
+		registersTestHookCalls = registersTestHookBytes = 0;
+		HooksRegister(HOOK_MEMWRITE, RegistersTestHook, NULL, addresses[i], addresses[i] + 3);
+		JaguarWriteLong(addresses[i], 0xCAFEF00D, BLITTER);
+		HooksUnregister(HOOK_MEMWRITE, RegistersTestHook, NULL);
+
+		CORE_CHECK_EQUAL(registersTestHookCalls, 1);
+		CORE_CHECK_EQUAL(registersTestHookBytes, 4);
+		CORE_CHECK_EQUAL(JaguarReadLong(addresses[i], DEBUG), 0xCAFEF00D);
+	}
+
+	return true;
+}
+
+
+//
+// HC read by bytes and by a word at the same time, across the halflines
+//
+static void RegistersTestHCCallback(void)
+{
+	uint16_t hc = JaguarReadWord(0xF00004, DEBUG);
+
+	if ((JaguarReadByte(0xF00004, DEBUG) != (hc >> 8)) || (JaguarReadByte(0xF00005, DEBUG) != (hc & 0xFF)))
+	{
+		registersTestHCMismatches++;
+	}
+
+	registersTestHCLowBytes += ((hc & 0xFF) != 0);
+
+	if (++registersTestHCReads < REGISTERSTEST_HC_READS)
+	{
+		SetCallbackTime(RegistersTestHCCallback, REGISTERSTEST_HC_PERIOD);
+	}
+}
+
+
+//
+// HC bytes, the bytes of the HC word
+//
+CORE_TEST(RegistersHCByte)
+{
+	CoreTestReset();
+	JaguarWriteWord(0xF0002E, 0x03FF, M68K);			// HP, HC counts up to 1023 in each halfline
+	registersTestHCReads = registersTestHCMismatches = registersTestHCLowBytes = 0;
+	SetCallbackTime(RegistersTestHCCallback, REGISTERSTEST_HC_PERIOD);
+
+	while (registersTestHCReads < REGISTERSTEST_HC_READS)
+	{
+		GetTimeToNextEvent(EVENT_MAIN);
+		HandleNextEvent(EVENT_MAIN);
+	}
+
+	CORE_CHECK_EQUAL(registersTestHCMismatches, 0u);
+	CORE_CHECK(registersTestHCLowBytes > (REGISTERSTEST_HC_READS / 2));
+	return true;
+}
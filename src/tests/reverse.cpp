@@ -0,0 +1,155 @@
+//
+// Reverse debugger, positions reached backward & forward give the same machine state
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <vector>
+#include "jaguar.h"
+#include "reverse.h"
+#include "settings.h"
+#include "state.h"
+#include "m68000/m68kinterface.h"
+
+#define REVERSE_TEST_STEPS	200
+
+
+//
+// 68K loop calling a subroutine, which writes in a RAM ring
+//
+static const uint16_t reverseTestProgram[] =
+{
+	0x41F9, 0x0001, 0x0000,		// LEA $10000, A0
+	0x7000,						// MOVEQ #0, D0
+	0x5280,						// loop: ADDQ.L #1, D0
+	0x6104,						// BSR.S sub
+	0x60FA,						// BRA.S loop
+	0x4E71,						// NOP
+	0x2200,						// sub: MOVE.L D0, D1
+	0xC2FC, 0x0003,				// MULU #3, D1
+	0x2400,						// MOVE.L D0, D2
+	0x0282, 0x0000, 0x0FFC,		// ANDI.L #$FFC, D2
+	0x2181, 0x2800,				// MOVE.L D1, (0, A0, D2.L)
+	0x4E75						// RTS
+};
+
+
+//
+// History of frames & trace steps, the state CRC32 is kept at each step
+//
+static void ReverseTestRecord(std::vector<uint64_t> & positions, std::vector<uint32_t> & crcs)
+{
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, reverseTestProgram, sizeof(reverseTestProgram) / sizeof(reverseTestProgram[0]));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	ReverseSetRecording(true);
+
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		ReverseExecuteFrame();
+	}
+
+	for (uint32_t i = 0; i < REVERSE_TEST_STEPS; i++)
+	{
+		JaguarStepInto();
+		positions.push_back(m68kInstructionCount);
+		crcs.push_back(StateCRC32());
+	}
+
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		ReverseExecuteFrame();
+	}
+}
+
+
+//
+// Reverse N, then forward N, back to the present state
+//
+CORE_TEST(ReverseForward)
+{
+	std::vector<uint64_t> positions;
+	std::vector<uint32_t> crcs;
+
+	ReverseTestRecord(positions, crcs);
+	uint64_t present = m68kInstructionCount;
+	uint32_t presentCRC = StateCRC32();
+	CORE_CHECK_EQUAL(ReverseGetPresent(), present);
+
+	uint64_t counts[] = { 1, 7, 20, 150, 5000, present - ReverseGetStart() };
+	bool passed = true;
+
+	for (size_t i = 0; passed && (i < (sizeof(counts) / sizeof(counts[0]))); i++)
+	{
+		uint64_t n = counts[i];
+
+		// Instruction by instruction for the short ones
+		if (n <= 20)
+		{
+			for (uint64_t j = 0; passed && (j < n); j++)
+			{
+				passed = ReverseStepInto();
+			}
+		}
+		else
+		{
+			passed = ReverseGoto(present - n);
+		}
+
+		uint32_t backCRC = StateCRC32();
+		passed = passed && (m68kInstructionCount == (present - n)) && ReverseIsInHistory();
+
+		if (n <= 20)
+		{
+			for (uint64_t j = 0; passed && (j < n); j++)
+			{
+				passed = ReverseStepForward(false);
+			}
+		}
+		else
+		{
+			passed = passed && ReverseGoto(present);
+		}
+
+		passed = passed && (m68kInstructionCount == present) && !ReverseIsInHistory() && (StateCRC32() == presentCRC);
+
+		// The same position again, the same state
+		passed = passed && ReverseGoto(present - n) && (StateCRC32() == backCRC) && ReverseGoto(present);
+
+		if (!passed)
+		{
+			CoreTestFailureValues(__FILE__, __LINE__, "reverse & forward count", n, n);
+		}
+	}
+
+	ReverseSetRecording(false);
+	CORE_CHECK(passed);
+	return true;
+}
+
+
+//
+// Positions of the trace steps, reached again with the states they had live
+//
+CORE_TEST(ReverseLivePositions)
+{
+	std::vector<uint64_t> positions;
+	std::vector<uint32_t> crcs;
+	size_t failed = 0;
+
+	ReverseTestRecord(positions, crcs);
+
+	for (size_t i = 0; i < positions.size(); i += 7)
+	{
+		failed += (!ReverseGoto(positions[i]) || (m68kInstructionCount != positions[i]) || (StateCRC32() != crcs[i]));
+	}
+
+	ReverseSetRecording(false);
+	CORE_CHECK_EQUAL(failed, 0);
+	return true;
+}
@@ -0,0 +1,329 @@
+//
+// GPU & DSP divides and matrix multiplies, against the bit-serial divide and the generic matrix loop
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <vector>
+#include "dsp.h"
+#include "gpu.h"
+#include "jaguar.h"
+
+#define RISCMATHTEST_TABLE		0x40000					// Operands read by the program
+#define RISCMATHTEST_RESULTS	0x80000					// Results written by the program
+#define RISCMATHTEST_LOCAL		0x800					// Matrices in the local RAM
+#define RISCMATHTEST_MATRIX_SIZE	0x400
+#define RISCMATHTEST_RANDOM		16384
+
+// JRISC instructions
+#define RISC(op, first, second)		(uint16_t)(((op) << 10) | (((first) & 0x1F) << 5) | (second))
+#define RISC_MOVEI(value, reg)		RISC(38, 0, reg), (uint16_t)(value), (uint16_t)((value) >> 16)
+#define RISC_ADDQ	2
+#define RISC_SUBQ	6
+#define RISC_DIV	21
+#define RISC_MOVETA	36
+#define RISC_LOAD	41
+#define RISC_STORE	47
+#define RISC_JR		53
+#define RISC_MMULT	54
+#define RISC_NOP	RISC(57, 0, 0)
+
+
+//
+// RISC processor, its local RAM & registers, how it is run, and the matrices copy
+// (the DSP matrix address is hardwired to its local RAM, the copy is kept there)
+//
+struct RISCMathTestRISC
+{
+	uint32_t ram;
+	uint32_t flags;
+	void (* exec)(int32_t);
+	uint32_t matrix;
+};
+
+static const RISCMathTestRISC riscMathTestGPU = { 0xF03000, 0xF02100, GPUExec, 0x20000 };
+static const RISCMathTestRISC riscMathTestDSP = { 0xF1B000, 0xF1A100, DSPExec, 0xF1B400 };
+
+static uint32_t riscMathTestSeed;
+
+
+static uint32_t RISCMathTestRandom(void)
+{
+	riscMathTestSeed = (riscMathTestSeed * 1103515245) + 12345;
+	uint32_t high = riscMathTestSeed >> 16;
+	riscMathTestSeed = (riscMathTestSeed * 1103515245) + 12345;
+	return (high << 16) | (riscMathTestSeed >> 16);
+}
+
+
+//
+// Program loaded at the local RAM start, its operands table written, and run
+// up to its final JR T, *; the results are read back
+//
+static bool RISCMathTestRun(const RISCMathTestRISC & risc, const uint16_t * program, size_t programCount, const std::vector<uint32_t> & table, size_t resultsCount, std::vector<uint32_t> & results)
+{
+	const uint32_t idle = risc.ram + ((programCount - 2) * 2);
+
+	for (size_t i = 0; i < programCount; i++)
+	{
+		JaguarWriteWord(risc.ram + (i * 2), program[i], M68K);
+	}
+
+	for (size_t i = 0; i < table.size(); i++)
+	{
+		JaguarWriteLong(RISCMATHTEST_TABLE + (i * 4), table[i], M68K);
+	}
+
+	JaguarWriteLong(risc.flags + 0x10, risc.ram, M68K);			// PC
+	JaguarWriteLong(risc.flags + 0x14, 0x01, M68K);				// GO
+
+	for (uint32_t i = 0; (i < 256) && (JaguarReadLong(risc.flags + 0x10, M68K) != idle); i++)
+	{
+		risc.exec(0x10000);
+	}
+
+	CORE_CHECK_EQUAL(JaguarReadLong(risc.flags + 0x10, M68K), idle);
+	results.resize(resultsCount);
+
+	for (size_t i = 0; i < resultsCount; i++)
+	{
+		results[i] = JaguarReadLong(RISCMATHTEST_RESULTS + (i * 4), M68K);
+	}
+
+	return true;
+}
+
+
+//
+// Reference divide: the bit-serial algorithm, a quotient bit per step
+//
+static void RISCMathTestDivide(uint32_t dividend, uint32_t divisor, bool fraction, uint32_t & quotient, uint32_t & remainder)
+{
+	uint32_t q = dividend, r = 0;
+
+	if (fraction)
+		q <<= 16, r = dividend >> 16;
+
+	for (int i = 0; i < 32; i++)
+	{
+		uint32_t sign = r & 0x80000000;
+		r = (r << 1) | (q >> 31);
+		r += (sign ? divisor : -divisor);
+		q = (q << 1) | ((~r) >> 31);
+	}
+
+	quotient = q;
+	remainder = r;
+}
+
+
+//
+// Every pair of edge values (powers of two, and around them), then random values
+// of random magnitudes; divided in a mode, and checked with the remainder
+//
+static bool RISCMathTestDivides(const RISCMathTestRISC & risc, bool fraction)
+{
+	std::vector<uint32_t> edges, table, results;
+
+	edges.push_back(0);
+	edges.push_back(1);
+	edges.push_back(2);
+
+	for (uint32_t bit = 2; bit < 32; bit++)
+	{
+		edges.push_back((1 << bit) - 1);
+		edges.push_back(1 << bit);
+		edges.push_back((1 << bit) + 1);
+	}
+
+	edges.push_back(0xFFFFFFFE);
+	edges.push_back(0xFFFFFFFF);
+
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		for (size_t j = 0; j < edges.size(); j++)
+		{
+			table.push_back(edges[i]);
+			table.push_back(edges[j]);
+		}
+	}
+
+	riscMathTestSeed = 0xD1D1;
+
+	for (uint32_t i = 0; i < RISCMATHTEST_RANDOM; i++)
+	{
+		uint32_t dividend = RISCMathTestRandom() >> (RISCMathTestRandom() & 0x1F);
+		uint32_t divisor = RISCMathTestRandom() >> (RISCMathTestRandom() & 0x1F);
+		table.push_back(dividend);
+		table.push_back(divisor);
+	}
+
+	const uint32_t count = table.size() / 2;
+	const uint16_t program[] =
+	{
+		RISC_MOVEI(RISCMATHTEST_TABLE, 1),
+		RISC_MOVEI(RISCMATHTEST_RESULTS, 2),
+		RISC_MOVEI(count, 3),
+		RISC_MOVEI(risc.flags + 0x1C, 4),		// REMAIN
+		RISC(RISC_LOAD, 1, 5),					// loop: LOAD (r1), r5
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_LOAD, 1, 6),					// LOAD (r1), r6
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_DIV, 6, 5),					// DIV r6, r5
+		RISC(RISC_STORE, 2, 5),					// STORE r5, (r2)
+		RISC(RISC_ADDQ, 4, 2),					// ADDQ #4, r2
+		RISC(RISC_LOAD, 4, 7),					// LOAD (r4), r7 (REMAIN)
+		RISC(RISC_STORE, 2, 7),					// STORE r7, (r2)
+		RISC(RISC_ADDQ, 4, 2),					// ADDQ #4, r2
+		RISC(RISC_SUBQ, 1, 3),					// SUBQ #1, r3
+		RISC(RISC_JR, -12, 1),					// JR NZ, loop
+		RISC_NOP,
+		RISC(RISC_JR, -1, 0),					// JR T, *
+		RISC_NOP
+	};
+
+	CoreTestReset();
+	JaguarWriteLong(risc.flags + 0x1C, (fraction ? 0x01 : 0x00), M68K);		// DIVCTRL
+
+	if (!RISCMathTestRun(risc, program, sizeof(program) / sizeof(program[0]), table, count * 2, results))
+		return false;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t quotient, remainder;
+		RISCMathTestDivide(table[i * 2], table[(i * 2) + 1], fraction, quotient, remainder);
+
+		CORE_CHECK_EQUAL(results[i * 2], quotient);
+		CORE_CHECK_EQUAL(results[(i * 2) + 1], remainder);
+	}
+
+	return true;
+}
+
+
+//
+// Divides of 32 bits & 16.16 quotients, the same as the bit-serial divide
+//
+CORE_TEST(RISCMathDivide)
+{
+	CORE_CHECK(RISCMathTestDivides(riscMathTestGPU, false));
+	CORE_CHECK(RISCMathTestDivides(riscMathTestGPU, true));
+	CORE_CHECK(RISCMathTestDivides(riscMathTestDSP, false));
+	CORE_CHECK(RISCMathTestDivides(riscMathTestDSP, true));
+	return true;
+}
+
+
+//
+// Random matrices 2, 3 & 4 wide, by rows & by columns, in the local RAM (3 & 4 wide read
+// directly) and in the copy (the generic loop from the DRAM, for the GPU), up to the
+// matrices area end; each one checked with the products summed over the words written
+//
+static bool RISCMathTestMatrices(const RISCMathTestRISC & risc)
+{
+	const uint16_t program[] =
+	{
+		RISC_MOVEI(RISCMATHTEST_TABLE, 1),
+		RISC_MOVEI(RISCMATHTEST_RESULTS, 2),
+		RISC_MOVEI(RISCMATHTEST_RANDOM, 3),
+		RISC_MOVEI(risc.flags + 0x04, 6),		// MTXC
+		RISC_MOVEI(risc.flags + 0x08, 7),		// MTXA
+		RISC(RISC_LOAD, 1, 5),					// loop: LOAD (r1), r5
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_MOVETA, 5, 10),				// MOVETA r5, r10
+		RISC(RISC_LOAD, 1, 5),					// LOAD (r1), r5
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_MOVETA, 5, 11),				// MOVETA r5, r11
+		RISC(RISC_LOAD, 1, 5),					// LOAD (r1), r5
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_STORE, 6, 5),					// STORE r5, (r6)
+		RISC(RISC_LOAD, 1, 5),					// LOAD (r1), r5
+		RISC(RISC_ADDQ, 4, 1),					// ADDQ #4, r1
+		RISC(RISC_STORE, 7, 5),					// STORE r5, (r7)
+		RISC(RISC_MMULT, 10, 8),				// MMULT r10, r8
+		RISC(RISC_STORE, 2, 8),					// STORE r8, (r2)
+		RISC(RISC_SUBQ, 1, 3),					// SUBQ #1, r3
+		RISC(RISC_JR, -16, 1),					// JR NZ, loop
+		RISC(RISC_ADDQ, 4, 2),					// ADDQ #4, r2 (delay slot)
+		RISC(RISC_JR, -1, 0),					// JR T, *
+		RISC_NOP
+	};
+	const uint32_t halves[] = { 0x0000, 0x0001, 0x7FFF, 0x8000, 0xFFFF };
+	uint16_t words[RISCMATHTEST_MATRIX_SIZE / 4];
+	std::vector<uint32_t> table, results;
+
+	riscMathTestSeed = 0x3434;
+	CoreTestReset();
+
+	// Same matrices area in the local RAM & in the copy, with edge words
+	for (uint32_t i = 0; i < (RISCMATHTEST_MATRIX_SIZE / 4); i++)
+	{
+		uint32_t value = RISCMathTestRandom();
+
+		if ((value & 0x300) == 0)
+			value = (value & 0xFFFF0000) | halves[(value >> 10) % 5];
+
+		words[i] = value & 0xFFFF;
+		JaguarWriteLong(risc.ram + RISCMATHTEST_LOCAL + (i * 4), value, M68K);
+		JaguarWriteLong(risc.matrix + (i * 4), value, M68K);
+	}
+
+	for (uint32_t i = 0; i < RISCMATHTEST_RANDOM; i++)
+	{
+		uint32_t a0 = RISCMathTestRandom(), a1 = RISCMathTestRandom(), select = RISCMathTestRandom();
+
+		if (select & 0x01)
+			a0 = (halves[(select >> 8) % 5] << 16) | halves[(select >> 12) % 5];
+
+		uint32_t count = 2 + ((select >> 24) % 3);
+		uint32_t control = count | (select & 0x04 ? 0x10 : 0x00);
+		uint32_t stride = (control & 0x10 ? 4 * count : 4);
+		uint32_t last = RISCMATHTEST_MATRIX_SIZE - (stride * (count - 1)) - 4;
+		uint32_t offset = ((select & 0x70) == 0 ? last : ((select >> 16) % ((last / 4) + 1)) * 4);
+		uint32_t base = (select & 0x08 ? risc.matrix : risc.ram + RISCMATHTEST_LOCAL);
+
+		table.push_back(a0);
+		table.push_back(a1);
+		table.push_back(control);
+		table.push_back(base + offset);
+	}
+
+	if (!RISCMathTestRun(risc, program, sizeof(program) / sizeof(program[0]), table, RISCMATHTEST_RANDOM, results))
+		return false;
+
+	for (uint32_t i = 0; i < RISCMATHTEST_RANDOM; i++)
+	{
+		const uint32_t * entry = &table[i * 4];
+		uint32_t count = entry[2] & 0x0F;
+		uint32_t stride = (entry[2] & 0x10 ? 4 * count : 4);
+		uint32_t word = entry[3] - (entry[3] >= (risc.ram + RISCMATHTEST_LOCAL) ? risc.ram + RISCMATHTEST_LOCAL : risc.matrix);
+		int64_t accum = 0;
+
+		for (uint32_t j = 0; j < count; j++)
+		{
+			int16_t a = (int16_t)(entry[j >> 1] >> (j & 0x01 ? 16 : 0));
+			accum += a * (int16_t)words[(word + (j * stride)) / 4];
+		}
+
+		CORE_CHECK_EQUAL(results[i], (uint32_t)accum);
+	}
+
+	return true;
+}
+
+
+//
+// Matrix multiplies, the same in the local RAM and through the generic loop
+//
+CORE_TEST(RISCMathMatrix)
+{
+	CORE_CHECK(RISCMathTestMatrices(riscMathTestGPU));
+	CORE_CHECK(RISCMathTestMatrices(riscMathTestDSP));
+	return true;
+}
@@ -0,0 +1,141 @@
+//
+// Guest memory writes sanitizer, allocations learned from a 68K allocator
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "jaguar.h"
+#include "sanitizer.h"
+#include "settings.h"
+#include "state.h"
+#include "m68000/m68kinterface.h"
+
+#define SANITIZERTEST_MALLOC	0x5000
+#define SANITIZERTEST_HEAP		0x100000
+#define SANITIZERTEST_SIZE		16
+
+extern int save_slot;
+
+
+//
+// 68K program: malloc(16), a long written at the end of the block, then past it
+// The allocator returns the pointer given
+//
+static void SanitizerTestLoad(uint32_t pointer)
+{
+	const uint16_t program[] =
+	{
+		0x2F3C, 0x0000, SANITIZERTEST_SIZE,		// MOVE.L #16, -(A7)
+		0x4EB9, 0x0000, SANITIZERTEST_MALLOC,	// JSR malloc
+		0x588F,									// ADDQ.L #4, A7
+		0x2040,									// MOVEA.L D0, A0
+		0x217C, 0x1234, 0x5678, 0x000C,			// MOVE.L #$12345678, (12, A0)
+		0x217C, 0x1234, 0x5678, 0x0010,			// MOVE.L #$12345678, (16, A0)
+		0x60FE									// BRA.S *
+	};
+	const uint16_t allocator[] =
+	{
+		0x203C, (uint16_t)(pointer >> 16), (uint16_t)pointer,	// MOVE.L #pointer, D0
+		0x4E75									// RTS
+	};
+	uint32_t entry[SANITIZER_ENTRIES] = { SANITIZERTEST_MALLOC, 0, 0, 0 };
+
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, program, sizeof(program) / sizeof(program[0]));
+	CoreTestLoad16(SANITIZERTEST_MALLOC, allocator, sizeof(allocator) / sizeof(allocator[0]));
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+	SanitizerEnable(entry, SANITIZERTEST_HEAP);
+}
+
+
+//
+// Write past the allocation reported, with the owning allocation
+//
+CORE_TEST(SanitizerOverflow)
+{
+	SanitizerReport report;
+
+	SanitizerTestLoad(SANITIZERTEST_HEAP);
+	CoreTestRunFrames(1);
+	bool reported = SanitizerGetReport(&report);
+	M68KDebugResume();
+	SanitizerDisable();
+
+	CORE_CHECK(reported);
+	CORE_CHECK_EQUAL(report.address, SANITIZERTEST_HEAP + SANITIZERTEST_SIZE);
+	CORE_CHECK_EQUAL(report.shadow, SANITIZER_POISONED);
+	CORE_CHECK(!strcmp(sanitizerShadowName[report.shadow], "poisoned"));
+	CORE_CHECK(report.allocationFound && report.allocation.live);
+	CORE_CHECK_EQUAL(report.allocation.address, SANITIZERTEST_HEAP);
+	CORE_CHECK_EQUAL(report.allocation.size, SANITIZERTEST_SIZE);
+	return true;
+}
+
+
+//
+// Allocation wrapping around the address space ignored, its writes are not reported
+//
+CORE_TEST(SanitizerAllocationWrap)
+{
+	SanitizerReport report;
+
+	SanitizerTestLoad(0xFFFFFFF8);
+	CoreTestRunFrames(1);
+	bool reported = SanitizerGetReport(&report);
+	M68KDebugResume();
+	SanitizerDisable();
+
+	CORE_CHECK(!reported);
+	return true;
+}
+
+
+//
+// State file loaded, the allocations made before are forgotten, the heap is not reported
+//
+CORE_TEST(SanitizerStateLoad)
+{
+	SanitizerReport report;
+	char path[64], name[MAX_PATH + 64];
+
+	SanitizerTestLoad(SANITIZERTEST_HEAP);
+	snprintf(path, sizeof(path), "/tmp/vj-sanitizertest-%d/", (int)getpid());
+	mkdir(path, 0700);
+	snprintf(vjs.SaveStatePath, sizeof(vjs.SaveStatePath), "%s", path);
+	save_slot = 0;
+	size_t dumped = DumpSaveState();
+	snprintf(name, sizeof(name), "%s%08X-memdump-0.vjs", path, (unsigned int)jaguarMainROMCRC32);
+
+	// The heap poisoned at the start: the write past the allocation is reported
+	CoreTestRunFrames(1);
+	bool reported = SanitizerGetReport(&report);
+	M68KDebugResume();
+
+	// Loaded back, the heap is unchecked until the next allocations
+	size_t loaded = LoadSaveState();
+	remove(name);
+	rmdir(path);
+	bool forgotten = (loaded != (size_t)-1);
+
+	if (forgotten)
+	{
+		CoreTestRunFrames(1);
+		forgotten = !SanitizerGetReport(&report);
+	}
+
+	M68KDebugResume();
+	SanitizerDisable();
+	CORE_CHECK(dumped != (size_t)-1);
+	CORE_CHECK(reported);
+	CORE_CHECK(forgotten);
+	return true;
+}
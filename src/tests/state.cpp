@@ -0,0 +1,232 @@
+//
+// Save state files, written & loaded back
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "jaguar.h"
+#include "memory.h"
+#include "settings.h"
+#include "state.h"
+
+#define STATETEST_RAM		0x10000					// Pattern written in the RAM
+#define STATETEST_SIZE		0x1000
+
+extern int save_slot;
+
+
+//
+// Save state file contents, NULL if it cannot be read
+//
+static uint8_t * StateTestRead(const char * name, size_t * size)
+{
+	FILE * fp = fopen(name, "rb");
+	uint8_t * buffer = NULL;
+
+	if (fp && !fseek(fp, 0, SEEK_END) && ((long)(*size = ftell(fp)) > 0) && !fseek(fp, 0, SEEK_SET) && (buffer = (uint8_t *)malloc(*size)))
+	{
+		if (fread(buffer, 1, *size, fp) != *size)
+		{
+			free(buffer);
+			buffer = NULL;
+		}
+	}
+
+	if (fp)
+	{
+		fclose(fp);
+	}
+
+	return buffer;
+}
+
+
+//
+// Section of the directory, offset & size
+//
+static bool StateTestSection(const uint8_t * buffer, size_t size, uint32_t type, uint32_t * offset, uint32_t * sectionSize)
+{
+	uint32_t count = GET32(buffer, 4);
+
+	for (uint32_t i = 0; (i < count) && ((8 + (i * 16) + 16) <= size); i++)
+	{
+		if (GET32(buffer, 8 + (i * 16)) == type)
+		{
+			*offset = GET32(buffer, 8 + (i * 16) + 4);
+			*sectionSize = GET32(buffer, 8 + (i * 16) + 8);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+// State file written and read back, NULL if it cannot be
+//
+static uint8_t * StateTestDump(bool compress, size_t * size)
+{
+	char path[64], name[MAX_PATH + 64];
+
+	snprintf(path, sizeof(path), "/tmp/vj-statetest-%d/", (int)getpid());
+	mkdir(path, 0700);
+	snprintf(vjs.SaveStatePath, sizeof(vjs.SaveStatePath), "%s", path);
+	vjs.compressSaveStates = compress;
+	save_slot = 0;
+
+	size_t dumped = DumpSaveState();
+	snprintf(name, sizeof(name), "%s%08X-memdump-0.vjs", path, (unsigned int)jaguarMainROMCRC32);
+	uint8_t * buffer = StateTestRead(name, size);
+	remove(name);
+	rmdir(path);
+
+	if (dumped == (size_t)-1)
+	{
+		free(buffer);
+		return NULL;
+	}
+
+	return buffer;
+}
+
+
+//
+// State file written, uncompressed or compressed, and loaded back
+// A memory space section changed in the file is found by its CRC32, nothing is loaded
+//
+static bool StateTestFile(bool compress)
+{
+	uint8_t pattern[STATETEST_SIZE], zero[STATETEST_SIZE] = { 0 };
+	size_t size;
+
+	for (size_t i = 0; i < sizeof(pattern); i++)
+	{
+		pattern[i] = (uint8_t)rand();
+	}
+
+	CoreTestLoad(STATETEST_RAM, pattern, sizeof(pattern));
+	uint32_t crc = StateCRC32();
+	uint8_t * buffer = StateTestDump(compress, &size);
+	CORE_CHECK(buffer != NULL);
+
+	CoreTestLoad(STATETEST_RAM, zero, sizeof(zero));
+	int loaded = StateLoadFromFile(buffer, size);
+	uint32_t loadedCRC = StateCRC32();
+	bool restored = !memcmp(&jagMemSpace[STATETEST_RAM], pattern, sizeof(pattern));
+
+	if (!compress)
+	{
+		uint32_t offset = 0, sectionSize = 0;
+
+		if (StateTestSection(buffer, size, 0x1001, &offset, &sectionSize) && (sectionSize > STATETEST_RAM))
+		{
+			buffer[offset + STATETEST_RAM] ^= 0x01;
+			CoreTestLoad(STATETEST_RAM, zero, sizeof(zero));
+			loaded = (loaded && !StateLoadFromFile(buffer, size) && !memcmp(&jagMemSpace[STATETEST_RAM], zero, sizeof(zero)));
+		}
+		else
+		{
+			loaded = 0;
+		}
+	}
+
+	free(buffer);
+	CORE_CHECK(loaded);
+	CORE_CHECK(restored);
+	CORE_CHECK_EQUAL(loadedCRC, crc);
+	return true;
+}
+
+
+CORE_TEST(StateFile)
+{
+	return StateTestFile(false);
+}
+
+
+CORE_TEST(StateFileCompressed)
+{
+	return StateTestFile(true);
+}
+
+
+//
+// Version 1 chunk, its data from a section of the dump; the memory substates hold
+// the memory space contents too, the 68K RAM after the jaguar data, the whole
+// memory space before the memory data
+//
+static size_t StateTestChunk(uint8_t * chunks, size_t pos, uint32_t type, const uint8_t * state, size_t size)
+{
+	uint32_t offset, sectionSize, ramOffset, ramSize, otherOffset, otherSize;
+
+	if (!StateTestSection(state, size, type, &offset, &sectionSize) || !StateTestSection(state, size, 0x1001, &ramOffset, &ramSize)
+		|| !StateTestSection(state, size, 0x1002, &otherOffset, &otherSize))
+	{
+		return 0;
+	}
+
+	size_t start = pos;
+	pos += 8;
+
+	if (type == 0x103)
+	{
+		memcpy(&chunks[pos], &state[ramOffset], ramSize);
+		memcpy(&chunks[pos + ramSize], &state[otherOffset], otherSize);
+		pos += ramSize + otherSize;
+	}
+
+	memcpy(&chunks[pos], &state[offset], sectionSize);
+	pos += sectionSize;
+
+	if (type == 0x101)
+	{
+		memcpy(&chunks[pos], &state[ramOffset], 0x200000);
+		pos += 0x200000;
+	}
+
+	SET32(chunks, start, type);
+	SET32(chunks, start + 4, (uint32_t)(pos - start - 8));
+	return pos;
+}
+
+
+//
+// Version 1 state, without the substates added since, loaded as the dump it comes from
+//
+CORE_TEST(StateFileVersion1)
+{
+	static const uint32_t types[] = { 0x101, 0x102, 0x103, 0x201, 0x301, 0x401, 0x501, 0x601, 0x602, 0x603, 0x604, 0x605, 0x701, 0x801, 0x901 };
+	size_t size, pos = 4;
+
+	uint32_t crc = StateCRC32();
+	uint8_t * state = StateTestDump(false, &size);
+	uint8_t * chunks = (uint8_t *)malloc(size + 0x200000 + (sizeof(types) * 8));
+	CORE_CHECK(state != NULL);
+	CORE_CHECK(chunks != NULL);
+
+	memcpy(chunks, "VJ\x00\x01", 4);
+
+	for (size_t i = 0; (i < (sizeof(types) / sizeof(types[0]))) && pos; i++)
+	{
+		pos = StateTestChunk(chunks, pos, types[i], state, size);
+	}
+
+	free(state);
+	int loaded = (pos && StateLoadFromFile(chunks, pos));
+	free(chunks);
+	CORE_CHECK(loaded);
+	CORE_CHECK_EQUAL(StateCRC32(), crc);
+	return true;
+}
@@ -0,0 +1,213 @@
+//
+// M68K call stack unwinder, with and without a frame pointer, and from the call frame information
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+#include "coretest.h"
+
+#include <stdio.h>
+#include "jaguar.h"
+#include "unwind.h"
+#include "m68000/m68kinterface.h"
+
+#define UNWINDTEST_F1		0x4100
+#define UNWINDTEST_F2		0x4200
+#define UNWINDTEST_STOP		0x4206					// PC in F2, where the stack is unwound
+#define UNWINDTEST_F1_RETURN	0x410C				// Return address in F1
+#define UNWINDTEST_MAIN_RETURN	0x4008				// Return address in the main program
+
+
+//
+// Main program: A6 cleared, F1 called
+//
+static const uint16_t unwindTestMain[] =
+{
+	0x9DCE,							// SUBA.L A6, A6
+	0x4EB9, 0x0000, 0x4100,			// JSR F1
+	0x60FE							// BRA.S *
+};
+
+// With a frame pointer
+static const uint16_t unwindTestLinkF1[] =
+{
+	0x4E56, 0xFFF8,					// LINK A6, #-8
+	0x2F02,							// MOVE.L D2, -(SP)
+	0x4EB9, 0x0000, 0x4200,			// JSR F2
+	0x241F,							// MOVE.L (SP)+, D2
+	0x4E5E,							// UNLK A6
+	0x4E75							// RTS
+};
+
+static const uint16_t unwindTestLinkF2[] =
+{
+	0x4E56, 0x0000,					// LINK A6, #0
+	0x7001,							// MOVEQ #1, D0
+	0x4E71,							// NOP
+	0x4E5E,							// UNLK A6
+	0x4E75							// RTS
+};
+
+// Without a frame pointer, each function follows the RTS of a previous one
+static const uint16_t unwindTestPushF1[] =
+{
+	0x48E7, 0x3020,					// MOVEM.L D2-D3/A2, -(SP)
+	0x518F,							// SUBQ.L #8, SP
+	0x4EB9, 0x0000, 0x4200,			// JSR F2
+	0x508F,							// ADDQ.L #8, SP
+	0x4CDF, 0x040C,					// MOVEM.L (SP)+, D2-D3/A2
+	0x4E75							// RTS
+};
+
+static const uint16_t unwindTestPushF2[] =
+{
+	0x2F02,							// MOVE.L D2, -(SP)
+	0x2F0E,							// MOVE.L A6, -(SP)
+	0x7001,							// MOVEQ #1, D0
+	0x4E71,							// NOP
+	0x2C5F,							// MOVEA.L (SP)+, A6
+	0x241F,							// MOVE.L (SP)+, D2
+	0x4E75							// RTS
+};
+
+// Call frame information of the functions without a frame pointer
+// CIE: version 1, code alignment 2, data alignment -4, return address column 24, CFA = SP + 4, return address at CFA - 4
+#define UNWINDTEST_CIE \
+	0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x02, 0x7C, 0x18, 0x0C, 0x0F, 0x04, \
+	0x98, 0x01
+
+// FDE of F1: advance_loc (4 bytes) CFA = SP + 16, advance_loc4 (2 bytes) CFA = SP + 24
+#define UNWINDTEST_FDE_F1 \
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x20, \
+	0x42, 0x0E, 0x10, 0x04, 0x00, 0x00, 0x00, 0x01, 0x0E, 0x18
+
+static const uint8_t unwindTestFrameInfo[] =
+{
+	UNWINDTEST_CIE,
+	UNWINDTEST_FDE_F1,
+	// FDE of F2: advance_loc1 (2 bytes) CFA = SP + 8, D2 at CFA - 8, advance_loc2 (2 bytes) CFA = SP + 12, A6 at CFA - 12
+	0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x02, 0x01, 0x0E, 0x08, 0x82, 0x02, 0x03, 0x00, 0x01, 0x0E, 0x0C, 0x8E, 0x03
+};
+
+// F2 call frame information with a wrong CFA, and an advance_loc4 cut by the end of its FDE
+static const uint8_t unwindTestTruncated[] =
+{
+	UNWINDTEST_CIE,
+	0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x0E, 0x40, 0x04,
+	UNWINDTEST_FDE_F1
+};
+
+
+//
+// Functions loaded, run up to the stop, and the stack unwound
+//
+static uint32_t UnwindTestRun(const uint16_t * f1, size_t f1Count, const uint16_t * f2, size_t f2Count, UnwindFrame * frames)
+{
+	const uint16_t rts[] = { 0x4E75 };
+
+	CoreTestLoad16(CORETEST_RUN_ADDRESS, unwindTestMain, sizeof(unwindTestMain) / sizeof(unwindTestMain[0]));
+	CoreTestLoad16(UNWINDTEST_F1 - 2, rts, 1);
+	CoreTestLoad16(UNWINDTEST_F1, f1, f1Count);
+	CoreTestLoad16(UNWINDTEST_F2 - 2, rts, 1);
+	CoreTestLoad16(UNWINDTEST_F2, f2, f2Count);
+	CoreTestStart68K(CORETEST_RUN_ADDRESS);
+
+	for (uint32_t i = 0; (i < 100) && (m68k_get_reg(NULL, M68K_REG_PC) != UNWINDTEST_STOP); i++)
+	{
+		JaguarStepInto();
+	}
+
+	return ((m68k_get_reg(NULL, M68K_REG_PC) == UNWINDTEST_STOP) ? UnwindStack(frames, UNWIND_FRAMES_MAX) : 0);
+}
+
+
+//
+// F2 & F1 frames, unwound by the method, back to the main program
+//
+static bool UnwindTestFrames(const UnwindFrame * frames, uint32_t count, uint32_t method)
+{
+	CORE_CHECK(count >= 2);
+	CORE_CHECK_EQUAL(frames[0].pc, UNWINDTEST_STOP);
+	CORE_CHECK_EQUAL(frames[0].method, method);
+	CORE_CHECK_EQUAL(frames[0].returnAddress, UNWINDTEST_F1_RETURN);
+	CORE_CHECK_EQUAL(frames[1].pc, UNWINDTEST_F1_RETURN);
+	CORE_CHECK_EQUAL(frames[1].method, method);
+	CORE_CHECK_EQUAL(frames[1].returnAddress, UNWINDTEST_MAIN_RETURN);
+	// F1 pushes, and the return address
+	CORE_CHECK_EQUAL(frames[1].cfa - frames[0].cfa, 12 + 8 + 4);
+	return true;
+}
+
+
+//
+// LINK A6 in each function
+//
+CORE_TEST(UnwindFramePointer)
+{
+	UnwindFrame frames[UNWIND_FRAMES_MAX];
+
+	UnwindReset();
+	uint32_t count = UnwindTestRun(unwindTestLinkF1, sizeof(unwindTestLinkF1) / sizeof(unwindTestLinkF1[0]), unwindTestLinkF2, sizeof(unwindTestLinkF2) / sizeof(unwindTestLinkF2[0]), frames);
+
+	CORE_CHECK(count >= 2);
+	CORE_CHECK_EQUAL(frames[0].method, UNWIND_PROLOGUE);
+	CORE_CHECK_EQUAL(frames[0].returnAddress, UNWINDTEST_F1_RETURN);
+	CORE_CHECK_EQUAL(frames[1].returnAddress, UNWINDTEST_MAIN_RETURN);
+	// Return address, saved A6, LINK A6, #-8 and D2 pushed by F1
+	CORE_CHECK_EQUAL(frames[1].cfa - frames[0].cfa, 4 + 4 + 8 + 4);
+	return true;
+}
+
+
+//
+// Registers pushed, no frame pointer: the return addresses are found from the prologues
+//
+CORE_TEST(UnwindNoFramePointer)
+{
+	UnwindFrame frames[UNWIND_FRAMES_MAX];
+
+	UnwindReset();
+	uint32_t count = UnwindTestRun(unwindTestPushF1, sizeof(unwindTestPushF1) / sizeof(unwindTestPushF1[0]), unwindTestPushF2, sizeof(unwindTestPushF2) / sizeof(unwindTestPushF2[0]), frames);
+	return UnwindTestFrames(frames, count, UNWIND_PROLOGUE);
+}
+
+
+//
+// No frame pointer, the call frame information gives the CFA (advance_loc, advance_loc1/2/4)
+//
+CORE_TEST(UnwindCallFrameInfo)
+{
+	UnwindFrame frames[UNWIND_FRAMES_MAX];
+
+	UnwindReset();
+	CORE_CHECK(UnwindSetFrameInfo(unwindTestFrameInfo, sizeof(unwindTestFrameInfo)));
+	uint32_t count = UnwindTestRun(unwindTestPushF1, sizeof(unwindTestPushF1) / sizeof(unwindTestPushF1[0]), unwindTestPushF2, sizeof(unwindTestPushF2) / sizeof(unwindTestPushF2[0]), frames);
+	UnwindReset();
+	return UnwindTestFrames(frames, count, UNWIND_CFI);
+}
+
+
+//
+// advance_loc4 cut by the end of its FDE: not read from the next entry, F2 falls back to its prologue
+//
+CORE_TEST(UnwindTruncatedAdvance)
+{
+	UnwindFrame frames[UNWIND_FRAMES_MAX];
+
+	UnwindReset();
+	CORE_CHECK(UnwindSetFrameInfo(unwindTestTruncated, sizeof(unwindTestTruncated)));
+	uint32_t count = UnwindTestRun(unwindTestPushF1, sizeof(unwindTestPushF1) / sizeof(unwindTestPushF1[0]), unwindTestPushF2, sizeof(unwindTestPushF2) / sizeof(unwindTestPushF2[0]), frames);
+	UnwindReset();
+
+	CORE_CHECK(count >= 2);
+	CORE_CHECK_EQUAL(frames[0].method, UNWIND_PROLOGUE);
+	CORE_CHECK_EQUAL(frames[0].returnAddress, UNWINDTEST_F1_RETURN);
+	CORE_CHECK_EQUAL(frames[1].method, UNWIND_CFI);
+	CORE_CHECK_EQUAL(frames[1].returnAddress, UNWINDTEST_MAIN_RETURN);
+	return true;
+}
@@ -0,0 +1,158 @@
+//
+// ZIP archives kept in the cache once closed
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+#include "unzip.h"
+
+#define UNZIPTEST_MEMBER	"software.j64"
+
+
+static void UnzipTestPut(uint8_t * & p, uint32_t value, uint32_t bytes)
+{
+	for (uint32_t i = 0; i < bytes; i++)
+	{
+		*p++ = (uint8_t)(value >> (i * 8));
+	}
+}
+
+
+//
+// Archive file with one stored member, its bytes filled with a value
+//
+static bool UnzipTestWrite(const char * path, uint32_t size, uint8_t value)
+{
+	uint32_t nameLength = strlen(UNZIPTEST_MEMBER);
+	uint8_t * archive = (uint8_t *)malloc(30 + 46 + 22 + (nameLength * 2) + size);
+	uint8_t * data = (uint8_t *)malloc(size);
+	memset(data, value, size);
+	uint32_t crc = crc32(0, data, size);
+	uint8_t * p = archive;
+
+	// Local header & data
+	UnzipTestPut(p, 0x04034B50, 4);
+	UnzipTestPut(p, 10, 2);
+	UnzipTestPut(p, 0, 2 + 2 + 2 + 2);
+	UnzipTestPut(p, crc, 4);
+	UnzipTestPut(p, size, 4);
+	UnzipTestPut(p, size, 4);
+	UnzipTestPut(p, nameLength, 2);
+	UnzipTestPut(p, 0, 2);
+	memcpy(p, UNZIPTEST_MEMBER, nameLength);
+	p += nameLength;
+	memcpy(p, data, size);
+	p += size;
+
+	// Central directory
+	uint32_t directory = p - archive;
+	UnzipTestPut(p, 0x02014B50, 4);
+	UnzipTestPut(p, 10, 2);
+	UnzipTestPut(p, 10, 2);
+	UnzipTestPut(p, 0, 2 + 2 + 2 + 2);
+	UnzipTestPut(p, crc, 4);
+	UnzipTestPut(p, size, 4);
+	UnzipTestPut(p, size, 4);
+	UnzipTestPut(p, nameLength, 2);
+	UnzipTestPut(p, 0, 2 + 2 + 2 + 2 + 4 + 4);
+	memcpy(p, UNZIPTEST_MEMBER, nameLength);
+	p += nameLength;
+
+	// End of central directory
+	uint32_t directorySize = (p - archive) - directory;
+	UnzipTestPut(p, 0x06054B50, 4);
+	UnzipTestPut(p, 0, 2 + 2);
+	UnzipTestPut(p, 1, 2);
+	UnzipTestPut(p, 1, 2);
+	UnzipTestPut(p, directorySize, 4);
+	UnzipTestPut(p, directory, 4);
+	UnzipTestPut(p, 0, 2);
+
+	FILE * fp = fopen(path, "wb");
+	bool written = (fp && (fwrite(archive, p - archive, 1, fp) == 1));
+
+	if (fp)
+	{
+		written = (fclose(fp) == 0) && written;
+	}
+
+	free(data);
+	free(archive);
+	return written;
+}
+
+
+//
+// Member of an opened archive checked against its size & fill value
+//
+static bool UnzipTestMember(ZipArchive * zip, uint32_t size, uint8_t value)
+{
+	if (!zip || (zip->count != 1) || (zip->entry[0].uncompressedSize != size))
+	{
+		return false;
+	}
+
+	uint8_t * buffer = (uint8_t *)malloc(size);
+	bool same = (UncompressFileFromZIP(zip, 0, buffer, size) == Z_OK);
+
+	for (uint32_t i = 0; same && (i < size); i++)
+	{
+		same = (buffer[i] == value);
+	}
+
+	free(buffer);
+	return same;
+}
+
+
+//
+// A closed archive is reopened from the cache, until its file is changed
+//
+CORE_TEST(UnzipCache)
+{
+	char path[] = "/tmp/vjunzipXXXXXX";
+	int fd = mkstemp(path);
+	CORE_CHECK(fd >= 0);
+	close(fd);
+	CORE_CHECK(UnzipTestWrite(path, 4096, 0x5A));
+
+	// The scanner opens & closes the archive, the loading takes the same one
+	ZipArchive * zip = ZIPOpen(path);
+	CORE_CHECK(UnzipTestMember(zip, 4096, 0x5A));
+	uint8_t * data = zip->data;
+	ZIPClose(zip);
+	ZipArchive * loaded = ZIPOpen(path);
+	bool reused = ((loaded == zip) && (loaded->data == data));
+	bool member = UnzipTestMember(loaded, 4096, 0x5A);
+
+	// File replaced while still opened, the opened archive is left alone
+	char newPath[sizeof(path) + 4];
+	sprintf(newPath, "%s.new", path);
+	bool rewritten = UnzipTestWrite(newPath, 8192, 0xA5) && (rename(newPath, path) == 0);
+	ZipArchive * changed = ZIPOpen(path);
+	bool stillOpened = UnzipTestMember(loaded, 4096, 0x5A);
+	bool changedMember = UnzipTestMember(changed, 8192, 0xA5);
+	ZIPClose(loaded);
+	ZIPClose(changed);
+	ZIPFlushCache();
+	remove(path);
+
+	CORE_CHECK(reused);
+	CORE_CHECK(member);
+	CORE_CHECK(rewritten);
+	CORE_CHECK(changed != loaded);
+	CORE_CHECK(stillOpened);
+	CORE_CHECK(changedMember);
+	return true;
+}
@@ -0,0 +1,179 @@
+//
+// Variables location programs, compared with the DBG manager values
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory.h"
+#include "settings.h"
+#include "debugger/DBGManager.h"
+#include "debugger/VARPROGManager.h"
+#include "m68000/m68kinterface.h"
+
+#define VARPROG_TEST_VARIABLES	20000
+
+static const size_t varProgTestEncodings[] = { DBG_ATE_boolean, DBG_ATE_float, DBG_ATE_signed, DBG_ATE_unsigned, DBG_ATE_unsigned_char, DBG_ATE_signed_char, DBG_ATE_ptr };
+static const size_t varProgTestSizes[] = { 1, 2, 4, 8 };
+
+
+//
+// Variable with a location expression, and a type
+//
+static void VarProgTestVariable(S_VariablesStruct * variable, unsigned char * location, size_t size)
+{
+	memset(variable, 0, sizeof(S_VariablesStruct));
+	variable->Op = location[0];
+	variable->PtrLocation = location;
+	variable->LocationSize = size;
+	variable->TypeEncoding = varProgTestEncodings[rand() % (sizeof(varProgTestEncodings) / sizeof(varProgTestEncodings[0]))];
+	variable->TypeByteSize = varProgTestSizes[rand() % (sizeof(varProgTestSizes) / sizeof(varProgTestSizes[0]))];
+
+	if ((variable->TypeEncoding == DBG_ATE_boolean) || (variable->TypeEncoding == DBG_ATE_unsigned_char))
+	{
+		variable->TypeByteSize = 1;
+	}
+}
+
+
+//
+// Globals at a DW_OP_addr, the values read by the DBG manager
+//
+CORE_TEST(VarProgGlobals)
+{
+	S_VariablesStruct variable;
+	unsigned char location[5];
+	char expected[1000];
+	size_t adr;
+
+	VARPROGManager_Init();
+	srand(1);
+
+	for (size_t i = 0; i < VARPROG_TEST_VARIABLES; i++)
+	{
+		uint32_t address = 4 + (rand() % (vjs.DRAM_size - 12));
+
+		location[0] = DBG_OP_addr;
+		SET32(location, 1, address);
+		VarProgTestVariable(&variable, location, sizeof(location));
+		variable.Addr = address;
+		strcpy(expected, DBGManager_GetVariableValueFromAdr(address, variable.TypeEncoding, variable.TypeByteSize));
+
+		// Each program is run twice, the second time from the cache
+		for (size_t j = 0; j < 2; j++)
+		{
+			char * value = VARPROGManager_Run(VARPROGManager_GetProgram(&variable, 0x1000 + i, 0x2000 + i), &adr);
+			CORE_CHECK(value != NULL);
+			CORE_CHECK(!strcmp(value, expected));
+			CORE_CHECK_EQUAL(adr, address);
+		}
+
+		VARPROGManager_Reset();
+	}
+
+	VARPROGManager_Close();
+	return true;
+}
+
+
+//
+// Locals from the frame base (A6), or from a register, as the locals browser reads them
+//
+CORE_TEST(VarProgLocals)
+{
+	S_VariablesStruct variable;
+	unsigned char location[3];
+	char expected[1000];
+	size_t adr;
+
+	VARPROGManager_Init();
+	srand(2);
+
+	for (size_t i = 0; i < VARPROG_TEST_VARIABLES; i++)
+	{
+		uint32_t frame = 0x1000 + (rand() % (vjs.DRAM_size - 0x2000));
+		int offset = (rand() % 512) - 256;
+		size_t kind = rand() % 3;
+		uint32_t reg = rand() % 16;
+
+		m68k_set_reg((m68k_register_t)(M68K_REG_D0 + reg), rand());
+		m68k_set_reg(M68K_REG_A6, frame);
+
+		if (kind == 2)
+		{
+			location[0] = DBG_OP_reg0 + reg;
+			VarProgTestVariable(&variable, location, 1);
+			sprintf(expected, "0x%x", m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + reg)));
+		}
+		else
+		{
+			location[0] = (kind ? (DBG_OP_breg0 + 14) : DBG_OP_fbreg);
+			location[1] = (offset & 0x7F) | 0x80;
+			location[2] = (offset >> 7) & 0x7F;
+			VarProgTestVariable(&variable, location, 3);
+			variable.Offset = offset;
+			strcpy(expected, DBGManager_GetVariableValueFromAdr(frame + offset, variable.TypeEncoding, variable.TypeByteSize));
+		}
+
+		char * value = VARPROGManager_Run(VARPROGManager_GetProgram(&variable, 0x1000 + i, 0x2000 + i), &adr);
+		CORE_CHECK(value != NULL);
+		CORE_CHECK(!strcmp(value, expected));
+		CORE_CHECK_EQUAL(adr, ((kind == 2) ? 0 : frame + offset));
+	}
+
+	VARPROGManager_Close();
+	return true;
+}
+
+
+//
+// Full expressions: pointer dereference, and the addresses out of the memory
+//
+CORE_TEST(VarProgExpressions)
+{
+	S_VariablesStruct variable;
+	size_t adr;
+
+	VARPROGManager_Init();
+
+	// *(A6 - 4) + 8
+	unsigned char location[] = { DBG_OP_breg0 + 14, 0x7C, DBG_OP_deref, DBG_OP_plus_uconst, 8 };
+	VarProgTestVariable(&variable, location, sizeof(location));
+	variable.TypeEncoding = DBG_ATE_unsigned;
+	variable.TypeByteSize = 4;
+	m68k_set_reg(M68K_REG_A6, 0x1000);
+	uint32_t pointer = 0x2000, pointed = 1234;
+	CoreTestLoad32(0xFFC, &pointer, 1);
+	CoreTestLoad32(0x2008, &pointed, 1);
+	char * value = VARPROGManager_Run(VARPROGManager_GetProgram(&variable, 1, 2), &adr);
+	CORE_CHECK(value && !strcmp(value, "1234"));
+	CORE_CHECK_EQUAL(adr, 0x2008);
+
+	// Dereferences at the end of the memory, and past it without the address wrap
+	unsigned char deref[] = { DBG_OP_const4u, 0, 0, 0, 0, DBG_OP_deref };
+	uint32_t addresses[] = { (uint32_t)vjs.DRAM_size - 4, (uint32_t)vjs.DRAM_size - 3, 0xFFFFFFFC, 0xFFFFFFFF };
+	uint32_t last = 0x2008;
+	CoreTestLoad32(vjs.DRAM_size - 4, &last, 1);
+
+	for (size_t i = 0; i < (sizeof(addresses) / sizeof(addresses[0])); i++)
+	{
+		SET32(deref, 1, addresses[i]);
+		VarProgTestVariable(&variable, deref, sizeof(deref));
+		variable.TypeEncoding = DBG_ATE_unsigned;
+		variable.TypeByteSize = 4;
+		VARPROGManager_Reset();
+		value = VARPROGManager_Run(VARPROGManager_GetProgram(&variable, 1, 2), &adr);
+		CORE_CHECK(i ? (value == NULL) : (value && !strcmp(value, "1234")));
+	}
+
+	VARPROGManager_Close();
+	return true;
+}
@@ -0,0 +1,220 @@
+//
+// Data watchpoints, accesses of each bus master around a host page boundary
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include "coretest.h"
+
+#include "jaguar.h"
+#include "memory.h"
+#include "watchpoint.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+#define WATCHTEST_PAGE		0x20000						// Host page boundary
+#define WATCHTEST_SIZE		4
+
+
+//
+// Hit by the master at the address holding the byte, first of the access
+// The memory handlers store a byte at a time: the other watched bytes of the
+// access can be hits of their own, after it; nothing else is recorded
+// The memory is not read back, it would be a read hit
+//
+static bool WatchTestHit(uint32_t who, uint32_t address, bool write, uint8_t byte)
+{
+	WatchpointHit hit, next;
+
+	if (!WatchpointGetHit(&hit) || (hit.who != who) || (hit.address != address) || (hit.write != write) || ((hit.value >> 24) != byte))
+	{
+		return false;
+	}
+
+	for (uint32_t last = hit.address; WatchpointGetHit(&next); last = next.address)
+	{
+		if ((next.who != who) || (next.write != write) || (next.address <= last) || (next.address >= (address + WATCHTEST_SIZE)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//
+// Nothing recorded
+//
+static bool WatchTestNoHit(void)
+{
+	WatchpointHit hit;
+	return !WatchpointGetHit(&hit);
+}
+
+
+//
+// Byte, word, long & phrase (two longs) accesses of a master, from below the watched page up to it
+// The words & the longs straddle the boundary, the hits are at the first watched byte
+//
+static bool WatchTestMaster(uint32_t who)
+{
+	WatchpointHit hit;
+	uint32_t master = watchpointMaster;
+	uint32_t id = WatchpointAdd(WATCHTEST_PAGE, WATCHTEST_SIZE, WATCHPOINT_READ | WATCHPOINT_WRITE);
+	bool passed = (id != 0);
+
+	while (WatchpointGetHit(&hit));
+
+	watchpointMaster = who;
+
+	// Writes
+	JaguarWriteByte(WATCHTEST_PAGE - 1, 0x11, who);
+	passed = passed && WatchTestNoHit();
+	JaguarWriteByte(WATCHTEST_PAGE, 0x22, who);
+	passed = passed && WatchTestHit(who, WATCHTEST_PAGE, true, 0x22);
+	JaguarWriteWord(WATCHTEST_PAGE - 1, 0x3344, who);
+	passed = passed && WatchTestHit(who, WATCHTEST_PAGE, true, 0x44);
+	JaguarWriteLong(WATCHTEST_PAGE - 2, 0x55667788, who);
+	passed = passed && WatchTestHit(who, WATCHTEST_PAGE, true, 0x77);
+	JaguarWriteLong(WATCHTEST_PAGE - 4, 0x99AABBCC, who);
+	JaguarWriteLong(WATCHTEST_PAGE, 0xDDEEFF00, who);
+	passed = passed && WatchTestHit(who, WATCHTEST_PAGE, true, 0xDD);
+
+	// Reads
+	passed = passed && (JaguarReadByte(WATCHTEST_PAGE - 1, who) == 0xCC) && WatchTestNoHit();
+	passed = passed && (JaguarReadByte(WATCHTEST_PAGE, who) == 0xDD) && WatchTestHit(who, WATCHTEST_PAGE, false, 0xDD);
+	passed = passed && (JaguarReadWord(WATCHTEST_PAGE - 1, who) == 0xCCDD) && WatchTestHit(who, WATCHTEST_PAGE, false, 0xDD);
+	passed = passed && (JaguarReadLong(WATCHTEST_PAGE - 2, who) == 0xBBCCDDEE) && WatchTestHit(who, WATCHTEST_PAGE, false, 0xDD);
+	passed = passed && (JaguarReadLong(WATCHTEST_PAGE - 4, who) == 0x99AABBCC) && (JaguarReadLong(WATCHTEST_PAGE, who) == 0xDDEEFF00);
+	passed = passed && WatchTestHit(who, WATCHTEST_PAGE, false, 0xDD);
+
+	// Past the range, in the same page
+	JaguarWriteByte(WATCHTEST_PAGE + WATCHTEST_SIZE, 0x00, who);
+	passed = passed && WatchTestNoHit();
+
+	watchpointMaster = master;
+	passed = WatchpointRemove(id) && passed;
+	CORE_CHECK(passed);
+	return true;
+}
+
+
+CORE_TEST(WatchpointM68K)
+{
+	return WatchTestMaster(M68K);
+}
+
+
+CORE_TEST(WatchpointGPU)
+{
+	return WatchTestMaster(GPU);
+}
+
+
+CORE_TEST(WatchpointDSP)
+{
+	return WatchTestMaster(DSP);
+}
+
+
+CORE_TEST(WatchpointBlitter)
+{
+	return WatchTestMaster(BLITTER);
+}
+
+
+CORE_TEST(WatchpointOP)
+{
+	return WatchTestMaster(OP);
+}
+
+
+//
+// Phrase accessed by one host instruction over both pages, watched on each side: one hit
+//
+CORE_TEST(WatchpointHostPhrase)
+{
+	uint8_t * phrase = &jagMemSpace[WATCHTEST_PAGE - 4];
+	uint64_t value = 0x0123456789ABCDEFULL;
+	uint32_t id = WatchpointAdd(WATCHTEST_PAGE - 2, WATCHTEST_SIZE, WATCHPOINT_WRITE);
+	uint32_t master = watchpointMaster;
+	WatchpointHit hit;
+
+	while (WatchpointGetHit(&hit));
+
+	watchpointMaster = BLITTER;
+	__asm__ volatile ("movq %1, (%0)" : : "r"(phrase), "r"(value) : "memory");
+	watchpointMaster = master;
+	WatchpointRemove(id);
+
+	CORE_CHECK(id != 0);
+	CORE_CHECK(WatchpointGetHit(&hit));
+	CORE_CHECK((hit.who == BLITTER) && hit.write);
+	CORE_CHECK_EQUAL(hit.address, WATCHTEST_PAGE - 2);
+	CORE_CHECK(WatchTestNoHit());
+	return true;
+}
+
+
+//
+// Accesses of an unwatched thread (the OP speculation worker) stepped, not recorded
+//
+CORE_TEST(WatchpointUnwatched)
+{
+	uint32_t id = WatchpointAdd(WATCHTEST_PAGE, WATCHTEST_SIZE, WATCHPOINT_READ | WATCHPOINT_WRITE);
+	uint32_t master = watchpointMaster;
+	WatchpointHit hit;
+
+	while (WatchpointGetHit(&hit));
+
+	CORE_CHECK(WatchpointReadWatched());
+	watchpointMaster = WATCHPOINT_UNWATCHED;
+	JaguarWriteLong(WATCHTEST_PAGE, 0x12345678, OP);
+	uint32_t value = JaguarReadLong(WATCHTEST_PAGE, OP);
+	watchpointMaster = master;
+	WatchpointRemove(id);
+
+	CORE_CHECK_EQUAL(value, 0x12345678);
+	CORE_CHECK(WatchTestNoHit());
+	CORE_CHECK(!WatchpointReadWatched());
+	return true;
+}
+
+
+//
+// Full ring, the hits past it are dropped & counted, the ring is usable again once read
+//
+CORE_TEST(WatchpointRingFull)
+{
+	uint32_t id = WatchpointAdd(WATCHTEST_PAGE, WATCHTEST_SIZE, WATCHPOINT_WRITE);
+	uint32_t master = watchpointMaster, dropped = WatchpointDropped(), count = 0;
+	WatchpointHit hit;
+
+	while (WatchpointGetHit(&hit));
+
+	watchpointMaster = GPU;
+
+	for (uint32_t i = 0; i < 300; i++)
+	{
+		JaguarWriteByte(WATCHTEST_PAGE, i, GPU);
+	}
+
+	while (WatchpointGetHit(&hit))
+	{
+		count++;
+	}
+
+	JaguarWriteByte(WATCHTEST_PAGE, 0, GPU);
+	watchpointMaster = master;
+	WatchpointRemove(id);
+
+	CORE_CHECK_EQUAL(count, 256);
+	CORE_CHECK_EQUAL(WatchpointDropped() - dropped, 300 - 256);
+	CORE_CHECK(WatchTestHit(GPU, WATCHTEST_PAGE, true, 0x00));
+	return true;
+}
+#endif
@@ -19,6 +19,19 @@
 // JLH  01/20/2011  Change rendering to RGBA, removed unnecessary code
 // JPM  06/06/2016  Visual Studio support
 // JPM  March/2022  Added the save state patch from PvtLewis
+// JPM   Oct./2026  Colour lookup tables can be backed by huge pages
+// JPM   Oct./2026  Lower field flag restored from VC at the state load
+// JPM   Oct./2026  Next halfline rendered ahead by the OP speculation
+// JPM   Oct./2026  Interrupt latches & requests moved to the interrupt controller
+// JPM   Oct./2026  HC read from the halfline time, and VC polling loops fast-forward
+// JPM   Oct./2026  Registers accesses dispatched from a register classes map
+// JPM   Oct./2026  Object Processor bus cycles charged at each halfline
+// JPM   Oct./2026  HC & VC polling loops fast-forwarded by whole iterations, cycle-identical
+// JPM   Oct./2026  Native long accesses for the plain registers & the GPU local RAM
+// JPM   Oct./2026  Interrupt enables moved to the interrupt controller
+// JPM   Oct./2026  HC read by bytes
+// JPM   Oct./2026  Colour lookup tables allocated on their own huge page
+// JPM   Oct./2026  Scanlines not written past their end when the start position is beyond the width
 //
 // Note: TOM has only a 16K memory space
 //
@@ -260,18 +273,23 @@
 #include "tom.h"
 
 #include <string.h>								// For memset()
-#include <stdlib.h>								// For rand()
+#include <stdlib.h>
 #include "blitter.h"
+#include "bus.h"
 #include "cry2rgb.h"
 #include "event.h"
 #include "gpu.h"
+#include "hosttuning.h"
+#include "interrupt.h"
 #include "jaguar.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
 //#include "memory.h"
 #include "op.h"
+#include "reverse.h"
 #include "settings.h"
 #include "state.h"
+#include "watchpoint.h"
 
 #define NEW_TIMER_SYSTEM
 
@@ -353,14 +371,57 @@
 //This can be defined in the makefile as well...
 //(It's easier to do it here, though...)
 //#define TOM_DEBUG
+// Registers writes log, set by the debug builds
+//#define TOM_REGISTER_LOG
+#if defined(_DEBUG) && !defined(TOM_REGISTER_LOG)
+#define TOM_REGISTER_LOG
+#endif
 
 uint8_t tomRam8[0x4000];
 uint32_t tomWidth, tomHeight;
 uint32_t tomTimerPrescaler;
 uint32_t tomTimerDivider;
 int32_t tomTimerCounter;
-uint16_t tom_jerry_int_pending, tom_timer_int_pending, tom_object_int_pending,
-	tom_gpu_int_pending, tom_video_int_pending;
+
+// 68K HC & VC polling loop detection (register, value, registers & position at the previous beam read)
+#define TOM_BEAM_POLL_REGS		18			// D0-D7, A0-A7, PC & SR
+static uint32_t beamPollRegs[TOM_BEAM_POLL_REGS];
+static uint32_t beamPollOffset;
+static uint16_t beamPollValue;
+static int32_t beamPollCycles;
+static uint64_t beamPollInstructions;
+static uint64_t beamPollTimeslice;
+static uint64_t beamPollSideEffects;
+static uint64_t beamPollSkipped[2];			// HC & VC iterations fast-forwarded
+
+extern void HalflineCallback(void);
+
+// Register space dispatch
+// Each byte of the TOM space ($F00000 - $F0FFFF) has a register class, from the registers ranges;
+// the class gives the handlers for each access width, the word handler is used for the words starting
+// at this byte. The writes are looked up once the "fast" GPU writes are folded back
+// The long handlers are used for the aligned longs of a class, without them a long is two words
+enum { TOM_REG_RAM = 0, TOM_REG_HC, TOM_REG_VC, TOM_REG_VIDEO, TOM_REG_TIMER, TOM_REG_INT, TOM_REG_INT_ENABLE, TOM_REG_CLUT, TOM_REG_GPU, TOM_REG_GPU_RAM, TOM_REG_BLITTER, TOM_REG_CLASSES };
+
+struct TOMRegisterClass
+{
+	uint8_t (* readByte)(uint32_t offset, uint32_t who);
+	uint16_t (* readWord)(uint32_t offset, uint32_t who);
+	uint32_t (* readLong)(uint32_t offset, uint32_t who);
+	void (* writeByte)(uint32_t offset, uint8_t data, uint32_t who);
+	void (* writeWord)(uint32_t offset, uint16_t data, uint32_t who);
+	void (* writeLong)(uint32_t offset, uint32_t data, uint32_t who);
+};
+
+struct TOMRegisterRange
+{
+	uint32_t start, end;
+	uint8_t regClass;
+};
+
+static uint8_t tomRegisterMap[0x10000];
+
+static void TOMInitRegisterMap(void);
 
 
 size_t tom_dump(FILE *fp)
@@ -372,11 +433,14 @@ size_t tom_dump(FILE *fp)
 	DUMP32(tomTimerPrescaler);
 	DUMP32(tomTimerDivider);
 	DUMPS32(tomTimerCounter);
-	DUMP16(tom_jerry_int_pending);
-	DUMP16(tom_timer_int_pending);
-	DUMP16(tom_object_int_pending);
-	DUMP16(tom_gpu_int_pending);
-	DUMP16(tom_video_int_pending);
+
+	// Interrupt latches, a word each from the JERRY one to the video one
+	for (int irq = IRQ_DSP; irq >= IRQ_VIDEO; irq--)
+	{
+		uint16_t latch = (InterruptPending(INTERRUPT_TOM) >> irq) & 0x01;
+		DUMP16(latch);
+	}
+
 	DUMPARR8(tomRam8);
 
 	return total_dumped;
@@ -391,12 +455,21 @@ size_t tom_load(FILE *fp)
 	LOAD32(tomTimerPrescaler);
 	LOAD32(tomTimerDivider);
 	LOADS32(tomTimerCounter);
-	LOAD16(tom_jerry_int_pending);
-	LOAD16(tom_timer_int_pending);
-	LOAD16(tom_object_int_pending);
-	LOAD16(tom_gpu_int_pending);
-	LOAD16(tom_video_int_pending);
+
+	uint16_t pending = 0;
+
+	for (int irq = IRQ_DSP; irq >= IRQ_VIDEO; irq--)
+	{
+		uint16_t latch;
+		LOAD16(latch);
+		pending |= ((latch ? 1 : 0) << irq);
+	}
+
+	InterruptSetPending(INTERRUPT_TOM, pending);
 	LOADARR8(tomRam8);
+	InterruptSetEnabled(INTERRUPT_TOM, tomRam8[INT1 + 1]);
+	// The field being generated is not in the state, VC has it
+	lowerField = ((tomRam8[VC] & 0x08) != 0);
 
 	return total_loaded;
 }
@@ -605,9 +678,13 @@ Vertical resolution: 238 lines
 */
 
 // 16-bit color lookup tables
-uint32_t RGB16ToRGB32[0x10000];
-uint32_t CRY16ToRGB32[0x10000];
-uint32_t MIX16ToRGB32[0x10000];
+// Kept together and allocated on their own huge page, so they can be backed by a huge page
+static struct ColorLookupTables
+{
+	uint32_t RGB16ToRGB32[0x10000];
+	uint32_t CRY16ToRGB32[0x10000];
+	uint32_t MIX16ToRGB32[0x10000];
+} * colorLUT = NULL;
 
 
 #ifdef _MSC_VER
@@ -620,7 +697,7 @@ void TOMFillLookupTables(void)
 	// NOTE: Jaguar 16-bit (non-CRY) color is RBG 556 like so:
 	//       RRRR RBBB BBGG GGGG
 	for(uint32_t i=0; i<0x10000; i++)
-		RGB16ToRGB32[i] = 0x000000FF
+		colorLUT->RGB16ToRGB32[i] = 0x000000FF
 			| ((i & 0xF800) << 16)					// Red
 			| ((i & 0x003F) << 18)					// Green
 			| ((i & 0x07C0) << 5);					// Blue
@@ -635,42 +712,12 @@ void TOMFillLookupTables(void)
 			g = (((uint32_t)greencv[cyan][red]) * intensity) >> 8,
 			b = (((uint32_t)bluecv[cyan][red]) * intensity) >> 8;
 
-		CRY16ToRGB32[i] = 0x000000FF | (r << 24) | (g << 16) | (b << 8);
-		MIX16ToRGB32[i] = (i & 0x01 ? RGB16ToRGB32[i] : CRY16ToRGB32[i]);
+		colorLUT->CRY16ToRGB32[i] = 0x000000FF | (r << 24) | (g << 16) | (b << 8);
+		colorLUT->MIX16ToRGB32[i] = (i & 0x01 ? colorLUT->RGB16ToRGB32[i] : colorLUT->CRY16ToRGB32[i]);
 	}
 }
 
 
-void TOMSetPendingJERRYInt(void)
-{
-	tom_jerry_int_pending = 1;
-}
-
-
-void TOMSetPendingTimerInt(void)
-{
-	tom_timer_int_pending = 1;
-}
-
-
-void TOMSetPendingObjectInt(void)
-{
-	tom_object_int_pending = 1;
-}
-
-
-void TOMSetPendingGPUInt(void)
-{
-	tom_gpu_int_pending = 1;
-}
-
-
-void TOMSetPendingVideoInt(void)
-{
-	tom_video_int_pending = 1;
-}
-
-
 uint8_t * TOMGetRamPointer(void)
 {
 	return tomRam8;
@@ -750,17 +797,17 @@ void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer)
 		for(int16_t i=0; i<startPos; i++)
 			*backbuffer++ = pixel;
 
-		width -= startPos;
+		width = (startPos < width ? width - startPos : 0);
 	}
 #else
-		backbuffer += 2 * startPos, width -= startPos;
+		backbuffer += 2 * startPos, width = (startPos < width ? width - startPos : 0);
 #endif
 
 	while (width)
 	{
 		uint16_t color = (*current_line_buffer++) << 8;
 		color |= *current_line_buffer++;
-		*backbuffer++ = MIX16ToRGB32[color];
+		*backbuffer++ = colorLUT->MIX16ToRGB32[color];
 		width--;
 	}
 }
@@ -792,18 +839,18 @@ void tom_render_16bpp_cry_scanline(uint32_t * backbuffer)
 		for(int16_t i=0; i<startPos; i++)
 			*backbuffer++ = pixel;
 
-		width -= startPos;
+		width = (startPos < width ? width - startPos : 0);
 	}
 #else
 //This should likely be 4 instead of 2 (?--not sure)
-		backbuffer += 2 * startPos, width -= startPos;
+		backbuffer += 2 * startPos, width = (startPos < width ? width - startPos : 0);
 #endif
 
 	while (width)
 	{
 		uint16_t color = (*current_line_buffer++) << 8;
 		color |= *current_line_buffer++;
-		*backbuffer++ = CRY16ToRGB32[color];
+		*backbuffer++ = colorLUT->CRY16ToRGB32[color];
 		width--;
 	}
 }
@@ -835,11 +882,11 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 		for(int16_t i=0; i<startPos; i++)
 			*backbuffer++ = pixel;
 
-		width -= startPos;
+		width = (startPos < width ? width - startPos : 0);
 	}
 #else
 //This should likely be 4 instead of 2 (?--not sure)
-		backbuffer += 2 * startPos, width -= startPos;
+		backbuffer += 2 * startPos, width = (startPos < width ? width - startPos : 0);
 #endif
 
 	while (width)
@@ -902,23 +949,37 @@ void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer)
 		for(int16_t i=0; i<startPos; i++)
 			*backbuffer++ = pixel;
 
-		width -= startPos;
+		width = (startPos < width ? width - startPos : 0);
 	}
 #else
 //This should likely be 4 instead of 2 (?--not sure)
-		backbuffer += 2 * startPos, width -= startPos;
+		backbuffer += 2 * startPos, width = (startPos < width ? width - startPos : 0);
 #endif
 
 	while (width)
 	{
 		uint32_t color = (*current_line_buffer++) << 8;
 		color |= *current_line_buffer++;
-		*backbuffer++ = RGB16ToRGB32[color];
+		*backbuffer++ = colorLUT->RGB16ToRGB32[color];
 		width--;
 	}
 }
 
 
+//
+// Clear line buffer with BG, the RAM is TOM's or a copy of it
+//
+void TOMClearLineBuffer(uint8_t * ram)
+{
+	uint8_t * current_line_buffer = &ram[0x1800];
+	uint8_t bgHI = ram[BG], bgLO = ram[BG + 1];
+
+	if (GET16(ram, VMODE) & BGEN) // && (CRY or RGB16)...
+		for(uint32_t i=0; i<720; i++)
+			*current_line_buffer++ = bgHI, *current_line_buffer++ = bgLO;
+}
+
+
 //
 // Process a single halfline
 //
@@ -1001,20 +1062,24 @@ TOM: Vertical Interrupt written by M68K: 491
 	{
 		if (render)
 		{
-			uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
-			uint8_t bgHI = tomRam8[BG], bgLO = tomRam8[BG + 1];
-
-			// Clear line buffer with BG
-			if (GET16(tomRam8, VMODE) & BGEN) // && (CRY or RGB16)...
-				for(uint32_t i=0; i<720; i++)
-					*current_line_buffer++ = bgHI, *current_line_buffer++ = bgLO;
+			// The halfline may have been rendered ahead by the OP speculation
+			if (!OPSpecCommit(halfline))
+			{
+				TOMClearLineBuffer(tomRam8);
+				OPProcessList(halfline, render);
+			}
 
-			OPProcessList(halfline, render);
+			BusCharge(OP, OPTakeBusCycles());
 		}
 	}
 	else
 		inActiveDisplayArea = false;
 
+	// The next halfline is rendered ahead, while the emulation goes on up to it
+	if (render && ((halfline + 2) >= startingHalfline) && ((halfline + 2) < endingHalfline)
+		&& ((halfline + 2) <= GET16(tomRam8, VP)))
+		OPSpecLaunch(halfline + 2);
+
 	// Take PAL into account...
 
 	uint16_t topVisible = (vjs.hardwareTypeNTSC ? TOP_VISIBLE_VC : TOP_VISIBLE_VC_PAL),
@@ -1089,7 +1154,7 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 		current_line_buffer += 4 * -startPos;
 	else
 //This should likely be 4 instead of 2 (?--not sure)
-		backbuffer += 2 * startPos, width -= startPos;
+		backbuffer += 2 * startPos, width = (startPos < width ? width - startPos : 0);
 
 	while (width)
 	{
@@ -1125,7 +1190,9 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 //
 void TOMInit(void)
 {
+	colorLUT = (ColorLookupTables *)HostTuningAllocMemory(sizeof(ColorLookupTables), "TOM colour lookup tables");
 	TOMFillLookupTables();
+	TOMInitRegisterMap();
 	OPInit();
 	BlitterInit();
 	TOMReset();
@@ -1139,6 +1206,8 @@ void TOMDone(void)
 	BlitterDone();
 	WriteLog("TOM: Resolution %i x %i %s\n", TOMGetVideoModeWidth(),
 		TOMGetVideoModeHeight(), videoMode_to_str[TOMGetVideoMode()]);
+	HostTuningFreeMemory(colorLUT, sizeof(ColorLookupTables));
+	colorLUT = NULL;
 }
 
 
@@ -1267,15 +1336,13 @@ void TOMReset(void)
 	tomWidth = 0;
 	tomHeight = 0;
 
-	tom_jerry_int_pending = 0;
-	tom_timer_int_pending = 0;
-	tom_object_int_pending = 0;
-	tom_gpu_int_pending = 0;
-	tom_video_int_pending = 0;
+	InterruptReset(INTERRUPT_TOM);
 
 	tomTimerPrescaler = 0;					// TOM PIT is disabled
 	tomTimerDivider = 0;
 	tomTimerCounter = 0;
+	beamPollOffset = 0;
+	beamPollSkipped[0] = beamPollSkipped[1] = 0;
 }
 
 
@@ -1323,6 +1390,440 @@ void TOMDumpIORegistersToLog(void)
 }
 
 
+//
+// Time elapsed in the current halfline
+// The GPU & the DSP run after the 68K for the same timeslice, they see its start; the 68K sees the cycles it has run
+//
+static double TOMHalflineTime(uint32_t who, int32_t cycles)
+{
+	double period = (vjs.hardwareTypeNTSC ? HORIZ_PERIOD_IN_USEC_NTSC : HORIZ_PERIOD_IN_USEC_PAL) / 2.0;
+	double remaining = GetCallbackTime(HalflineCallback);
+
+	if (remaining < 0.0)
+		return 0.0;
+
+	double elapsed = period - remaining;
+
+	if (who == M68K)
+		elapsed += cycles * (vjs.hardwareTypeNTSC ? M68K_CYCLE_IN_USEC : M68K_CYCLE_PAL_IN_USEC);
+
+	return (elapsed < 0.0 ? 0.0 : elapsed);
+}
+
+
+//
+// HC value, with the cycles run by the 68K in its timeslice
+// The counter goes from 0 to HP for each halfline, bit 10 is set for the second half of the line
+//
+static uint16_t TOMHCValue(uint32_t who, int32_t cycles)
+{
+	double period = (vjs.hardwareTypeNTSC ? HORIZ_PERIOD_IN_USEC_NTSC : HORIZ_PERIOD_IN_USEC_PAL) / 2.0;
+	uint32_t hp = (GET16(tomRam8, HP) & 0x03FF) + 1;
+	uint32_t count = (uint32_t)(TOMHalflineTime(who, cycles) * hp / period);
+
+	if (count >= hp)
+		count = hp - 1;
+
+	return ((GET16(tomRam8, VC) & 0x0001) << 10) | count;
+}
+
+
+//
+// Beam counter value, with the cycles run by the 68K in its timeslice (VC only changes at the halfline events)
+//
+static uint16_t TOMBeamValue(uint32_t offset, int32_t cycles)
+{
+	return ((offset & 0xFE) == HC ? TOMHCValue(M68K, cycles) : GET16(tomRam8, VC));
+}
+
+
+//
+// Beam counter read by the 68K, polling loops fast-forward
+// A loop polling HC or VC reads it again from the same PC, with the same registers & the same value, and
+// no other access with a side effect; each iteration then runs the same instructions in the same cycles.
+// The iterations left while the value read stays the same, in the timeslice & before the instructions count
+// halt, are accounted at once: the read is done at the cycle & the instructions count of the last of them
+// The traceback gets the iterations skipped, the opcode statistics do not
+//
+static uint16_t TOMBeamPoll(uint32_t offset, uint16_t value)
+{
+	uint32_t regs[TOM_BEAM_POLL_REGS];
+	int32_t cycles = m68k_cycles_run();
+
+	for (uint32_t i = 0; i < TOM_BEAM_POLL_REGS; i++)
+		regs[i] = m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + i));
+
+	int32_t period = cycles - beamPollCycles;
+	uint64_t instructions = m68kInstructionCount - beamPollInstructions;
+
+	if ((offset == beamPollOffset) && (value == beamPollValue) && (m68kTimesliceCount == beamPollTimeslice)
+		&& ((m68kSideEffectCount - beamPollSideEffects) == 1) && (period > 0) && instructions
+		&& !memcmp(regs, beamPollRegs, sizeof(regs)) && !M68KDebugHaltStatus() && !ReverseIsReplaying()
+		&& !WatchpointReadWatched())
+	{
+		int32_t remaining = m68k_cycles_remaining();
+		uint64_t count = 0;
+
+		while (((remaining - (int64_t)(count + 1) * period) > 0)
+			&& ((m68kInstructionCount + ((count + 1) * instructions)) < m68kHaltInstructionCount)
+			&& (TOMBeamValue(offset, cycles + (int32_t)(count + 1) * period) == value))
+			count++;
+
+		if (count && M68KTracebackRepeat(instructions, count))
+		{
+			cycles += (int32_t)count * period;
+			m68k_modify_timeslice(remaining - ((int32_t)count * period));
+			m68kInstructionCount += count * instructions;
+			beamPollSkipped[(offset & 0xFE) == VC] += count;
+		}
+	}
+
+	memcpy(beamPollRegs, regs, sizeof(regs));
+	beamPollOffset = offset;
+	beamPollValue = value;
+	beamPollCycles = cycles;
+	beamPollInstructions = m68kInstructionCount;
+	beamPollTimeslice = m68kTimesliceCount;
+	beamPollSideEffects = m68kSideEffectCount;
+	return value;
+}
+
+
+//
+// HC & VC reads, the 68K polling loops are fast-forwarded (option)
+//
+static uint16_t TOMReadHC(uint32_t offset, uint32_t who)
+{
+	uint16_t hc = TOMHCValue(who, (who == M68K ? m68k_cycles_run() : 0));
+	return ((vjs.beamPollSkip && (who == M68K)) ? TOMBeamPoll(offset, hc) : hc);
+}
+
+
+static uint8_t TOMReadHCByte(uint32_t offset, uint32_t who)
+{
+	uint16_t hc = TOMReadHC(offset, who);
+	return ((offset & 0x01) ? (hc & 0xFF) : (hc >> 8));
+}
+
+
+static uint16_t TOMReadVC(uint32_t offset, uint32_t who)
+{
+	uint16_t vc = GET16(tomRam8, VC);
+	return ((vjs.beamPollSkip && (who == M68K)) ? TOMBeamPoll(offset, vc) : vc);
+}
+
+
+//
+// 68K polling loops iterations fast-forwarded, on HC & on VC
+//
+void TOMGetBeamPollSkipped(uint64_t * hc, uint64_t * vc)
+{
+	*hc = beamPollSkipped[0];
+	*vc = beamPollSkipped[1];
+}
+
+
+//
+// Interrupt control read & write (INT1)
+// The enables are in its low byte, which can be written alone
+//
+static uint16_t TOMReadINT1(uint32_t offset, uint32_t who)
+{
+	// For reading, should only return the lower 5 bits...
+	return InterruptPending(INTERRUPT_TOM);
+}
+
+
+static void TOMWriteINT1(uint32_t offset, uint16_t data, uint32_t who)
+{
+//Check this out...
+	InterruptSetEnabled(INTERRUPT_TOM, data & 0xFF);
+	// Latches cleared by the bits 8 - 12
+	InterruptAcknowledge(INTERRUPT_TOM, (data >> 8) & 0x1F);
+}
+
+
+static void TOMWriteINT1Byte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	InterruptSetEnabled(INTERRUPT_TOM, data);
+}
+
+
+//
+// PIT prescaler & divider read & write
+//
+static uint8_t TOMReadTimerByte(uint32_t offset, uint32_t who)
+{
+	switch (offset & 0x03)
+	{
+	case 0:
+		return tomTimerPrescaler >> 8;
+	case 1:
+		return tomTimerPrescaler & 0xFF;
+	case 2:
+		return tomTimerDivider >> 8;
+	default:
+		return tomTimerDivider & 0xFF;
+	}
+}
+
+
+static uint16_t TOMReadTimerWord(uint32_t offset, uint32_t who)
+{
+	if (offset == 0xF00050)
+		return tomTimerPrescaler;
+	else if (offset == 0xF00052)
+		return tomTimerDivider;
+
+	return (tomRam8[offset & 0x3FFF] << 8) | tomRam8[(offset + 1) & 0x3FFF];
+}
+
+
+static void TOMWriteTimerByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	switch (offset & 0x03)
+	{
+	case 0:
+		tomTimerPrescaler = (tomTimerPrescaler & 0x00FF) | (data << 8);
+		break;
+	case 1:
+		tomTimerPrescaler = (tomTimerPrescaler & 0xFF00) | data;
+		break;
+	case 2:
+		tomTimerDivider = (tomTimerDivider & 0x00FF) | (data << 8);
+		break;
+	default:
+		tomTimerDivider = (tomTimerDivider & 0xFF00) | data;
+	}
+
+	TOMResetPIT();
+}
+
+
+static void TOMWriteTimerWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	if (offset == 0xF00050)
+		tomTimerPrescaler = data;
+	else if (offset == 0xF00052)
+		tomTimerDivider = data;
+	else
+		// Need to handle (unaligned) cases???
+		return;
+
+	TOMResetPIT();
+}
+
+
+//
+// CLUT write
+// Writing to one CLUT writes to the other
+//
+static void TOMWriteCLUTByte(uint32_t offset, uint8_t data, uint32_t who)
+{
+	offset &= 0x5FF;		// Mask out $F00600 (restrict to $F00400-5FF)
+	tomRam8[offset] = data, tomRam8[offset + 0x200] = data;
+}
+
+
+static void TOMWriteCLUTWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	if (offset > 0xF007FE)
+		return;
+
+	offset &= 0x5FF;		// Mask out $F00600 (restrict to $F00400-5FF)
+// Watch out for unaligned writes here! (Not fixed yet)
+#ifdef _MSC_VER
+#pragma message("Warning: !!! Watch out for unaligned writes here !!! FIX !!!")
+#else
+#warning "!!! Watch out for unaligned writes here !!! FIX !!!"
+#endif // _MSC_VER
+	SET16(tomRam8, offset, data);
+	SET16(tomRam8, offset + 0x200, data);
+}
+
+
+//
+// Video registers write ($F00028 - $F0004F)
+//
+static void TOMWriteVideoWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	offset &= 0x3FFF;
+	if (offset == VMODE)			// VMODE (Why? Why not OBF?)
+//Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!
+#ifdef _MSC_VER
+#pragma message("Warning: Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!")
+#else
+#warning "Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!"
+#endif // _MSC_VER
+		objectp_running = 1;
+
+	// detect screen resolution changes
+//This may go away in the future, if we do the virtualized screen thing...
+//This may go away soon!
+// TOM Shouldn't be mucking around with this, it's up to the host system to properly
+// handle this kind of crap.
+// NOTE: This is needed somehow, need to get rid of the dependency on this crap.
+//       N.B.: It's used in the rendering functions... So...
+#ifdef _MSC_VER
+#pragma message("Warning: !!! Need to get rid of this dependency !!!")
+#else
+#warning "!!! Need to get rid of this dependency !!!"
+#endif // _MSC_VER
+	uint32_t width = TOMGetVideoModeWidth(), height = TOMGetVideoModeHeight();
+
+	if ((width != tomWidth) || (height != tomHeight))
+	{
+		tomWidth = width, tomHeight = height;
+
+#ifdef _MSC_VER
+#pragma message("Warning: !!! TOM: ResizeScreen commented out !!!")
+#else
+#warning "!!! TOM: ResizeScreen commented out !!!"
+#endif // _MSC_VER
+// No need to resize anything, since we're prepared for this...
+//			if (vjs.renderType == RT_NORMAL)
+//				ResizeScreen(tomWidth, tomHeight);
+	}
+}
+
+
+//
+// Register classes
+// A NULL handler is a plain access to the TOM RAM, without side effects
+//
+static const TOMRegisterClass tomRegisterClass[TOM_REG_CLASSES] =
+{
+	{ NULL, NULL, NULL, NULL, NULL, NULL },											// TOM_REG_RAM
+	{ TOMReadHCByte, TOMReadHC, NULL, NULL, NULL, NULL },							// TOM_REG_HC
+	{ NULL, TOMReadVC, NULL, NULL, NULL, NULL },									// TOM_REG_VC
+	{ NULL, NULL, NULL, NULL, TOMWriteVideoWord, NULL },							// TOM_REG_VIDEO
+	{ TOMReadTimerByte, TOMReadTimerWord, NULL, TOMWriteTimerByte, TOMWriteTimerWord, NULL },	// TOM_REG_TIMER
+	{ NULL, TOMReadINT1, NULL, NULL, TOMWriteINT1, NULL },							// TOM_REG_INT
+	{ NULL, NULL, NULL, TOMWriteINT1Byte, NULL, NULL },								// TOM_REG_INT_ENABLE
+	{ NULL, NULL, NULL, TOMWriteCLUTByte, TOMWriteCLUTWord, NULL },					// TOM_REG_CLUT
+	{ GPUReadByte, GPUReadWord, NULL, GPUWriteByte, GPUWriteWord, NULL },			// TOM_REG_GPU
+	{ GPUReadByte, GPUReadWord, GPUReadLong, GPUWriteByte, GPUWriteWord, GPUWriteLong },	// TOM_REG_GPU_RAM
+	{ BlitterReadByte, BlitterReadWord, NULL, BlitterWriteByte, BlitterWriteWord, NULL }	// TOM_REG_BLITTER
+};
+
+
+//
+// Register ranges, the map is generated from them
+//
+static const TOMRegisterRange tomRegisterRange[] =
+{
+	{ 0xF00004, 0xF00005, TOM_REG_HC },
+	{ 0xF00006, 0xF00006, TOM_REG_VC },
+	{ 0xF00028, 0xF0004F, TOM_REG_VIDEO },
+	{ 0xF00050, 0xF00053, TOM_REG_TIMER },
+	{ 0xF000E0, 0xF000E0, TOM_REG_INT },
+	{ 0xF000E1, 0xF000E1, TOM_REG_INT_ENABLE },
+	{ 0xF00400, 0xF007FF, TOM_REG_CLUT },								// CLUT (A & B)
+	{ GPU_CONTROL_RAM_BASE, GPU_CONTROL_RAM_BASE + 0x1F, TOM_REG_GPU },
+	{ 0xF02200, 0xF0229F, TOM_REG_BLITTER },
+	{ GPU_WORK_RAM_BASE, GPU_WORK_RAM_BASE + 0xFFF, TOM_REG_GPU_RAM }
+};
+
+
+//
+// Generate the register map
+//
+static void TOMInitRegisterMap(void)
+{
+	memset(tomRegisterMap, TOM_REG_RAM, sizeof(tomRegisterMap));
+
+	for (uint32_t i = 0; i < (sizeof(tomRegisterRange) / sizeof(tomRegisterRange[0])); i++)
+		memset(&tomRegisterMap[tomRegisterRange[i].start & 0xFFFF], tomRegisterRange[i].regClass, tomRegisterRange[i].end - tomRegisterRange[i].start + 1);
+}
+
+
+#ifdef TOM_REGISTER_LOG
+//
+// Registers accesses log, on top of the handlers
+//
+static void TOMLogReadWord(uint32_t offset, uint32_t who)
+{
+	if (offset >= 0xF02000 && offset <= 0xF020FF)
+		WriteLog("TOM: ReadWord attempted from GPU register file by %s (unimplemented)!\n", whoName[who]);
+}
+
+
+static void TOMLogWriteWord(uint32_t offset, uint16_t data, uint32_t who)
+{
+	if (offset >= 0xF02000 && offset <= 0xF020FF)
+		WriteLog("TOM: WriteWord attempted to GPU register file by %s (unimplemented)!\n", whoName[who]);
+
+	offset &= 0x3FFF;
+
+	if (offset >= 0x30 && offset <= 0x4E)
+		data &= 0x07FF;			// These are (mostly) 11-bit registers
+	if (offset == 0x2E || offset == 0x36 || offset == 0x54)
+		data &= 0x03FF;			// These are all 10-bit registers
+
+	if (offset == MEMCON1)
+		WriteLog("TOM: Memory Config 1 written by %s: $%04X\n", whoName[who], data);
+	if (offset == MEMCON2)
+		WriteLog("TOM: Memory Config 2 written by %s: $%04X\n", whoName[who], data);
+//	if (offset == OLP)
+//		WriteLog("TOM: Object List Pointer written by %s: $%04X\n", whoName[who], data);
+//	if (offset == OLP + 2)
+//		WriteLog("TOM: Object List Pointer +2 written by %s: $%04X\n", whoName[who], data);
+//	if (offset == OBF)
+//		WriteLog("TOM: Object Processor Flag written by %s: %u\n", whoName[who], data);
+	if (offset == VMODE)
+		WriteLog("TOM: Video Mode written by %s: %04X. PWIDTH = %u, MODE = %s, flags:%s%s (VC = %u) (M68K PC = %06X)\n", whoName[who], data, ((data >> 9) & 0x07) + 1, videoMode_to_str[(data & MODE) >> 1], (data & BGEN ? " BGEN" : ""), (data & VARMOD ? " VARMOD" : ""), GET16(tomRam8, VC), m68k_get_reg(NULL, M68K_REG_PC));
+	if (offset == BORD1)
+		WriteLog("TOM: Border 1 written by %s: $%04X\n", whoName[who], data);
+	if (offset == BORD2)
+		WriteLog("TOM: Border 2 written by %s: $%04X\n", whoName[who], data);
+	if (offset == HP)
+		WriteLog("TOM: Horizontal Period written by %s: %u (+1*2 = %u)\n", whoName[who], data, (data + 1) * 2);
+	if (offset == HBB)
+		WriteLog("TOM: Horizontal Blank Begin written by %s: %u\n", whoName[who], data);
+	if (offset == HBE)
+		WriteLog("TOM: Horizontal Blank End written by %s: %u\n", whoName[who], data);
+	if (offset == HS)
+		WriteLog("TOM: Horizontal Sync written by %s: %u\n", whoName[who], data);
+	if (offset == HVS)
+		WriteLog("TOM: Horizontal Vertical Sync written by %s: %u\n", whoName[who], data);
+	if (offset == HDB1)
+		WriteLog("TOM: Horizontal Display Begin 1 written by %s: %u\n", whoName[who], data);
+	if (offset == HDB2)
+		WriteLog("TOM: Horizontal Display Begin 2 written by %s: %u\n", whoName[who], data);
+	if (offset == HDE)
+		WriteLog("TOM: Horizontal Display End written by %s: %u\n", whoName[who], data);
+	if (offset == VP)
+		WriteLog("TOM: Vertical Period written by %s: %u (%sinterlaced)\n", whoName[who], data, (data & 0x01 ? "non-" : ""));
+	if (offset == VBB)
+		WriteLog("TOM: Vertical Blank Begin written by %s: %u\n", whoName[who], data);
+	if (offset == VBE)
+		WriteLog("TOM: Vertical Blank End written by %s: %u\n", whoName[who], data);
+	if (offset == VS)
+		WriteLog("TOM: Vertical Sync written by %s: %u\n", whoName[who], data);
+	if (offset == VDB)
+		WriteLog("TOM: Vertical Display Begin written by %s: %u\n", whoName[who], data);
+	if (offset == VDE)
+		WriteLog("TOM: Vertical Display End written by %s: %u\n", whoName[who], data);
+	if (offset == VEB)
+		WriteLog("TOM: Vertical Equalization Begin written by %s: %u\n", whoName[who], data);
+	if (offset == VEE)
+		WriteLog("TOM: Vertical Equalization End written by %s: %u\n", whoName[who], data);
+	if (offset == VI)
+		WriteLog("TOM: Vertical Interrupt written by %s: %u\n", whoName[who], data);
+	if (offset == PIT0)
+		WriteLog("TOM: PIT0 written by %s: %u\n", whoName[who], data);
+	if (offset == PIT1)
+		WriteLog("TOM: PIT1 written by %s: %u\n", whoName[who], data);
+	if (offset == HEQ)
+		WriteLog("TOM: Horizontal Equalization End written by %s: %u\n", whoName[who], data);
+//	if (offset == BG)
+//		WriteLog("TOM: Background written by %s: %u\n", whoName[who], data);
+//	if (offset == INT1)
+//		WriteLog("TOM: CPU Interrupt Control written by %s: $%04X (%s%s%s%s%s)\n", whoName[who], data, (data & 0x01 ? "Video" : ""), (data & 0x02 ? " GPU" : ""), (data & 0x04 ? " OP" : ""), (data & 0x08 ? " TOMPIT" : ""), (data & 0x10 ? " Jerry" : ""));
+}
+#endif
+
+
 //
 // TOM byte access (read)
 //
@@ -1338,22 +1839,10 @@ uint8_t TOMReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 	WriteLog("TOM: Reading byte at %06X for %s\n", offset, whoName[who]);
 #endif
 
-	if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE+0x20))
-		return GPUReadByte(offset, who);
-	else if ((offset >= GPU_WORK_RAM_BASE) && (offset < GPU_WORK_RAM_BASE+0x1000))
-		return GPUReadByte(offset, who);
-/*	else if ((offset >= 0xF00010) && (offset < 0xF00028))
-		return OPReadByte(offset, who);*/
-	else if ((offset >= 0xF02200) && (offset < 0xF022A0))
-		return BlitterReadByte(offset, who);
-	else if (offset == 0xF00050)
-		return tomTimerPrescaler >> 8;
-	else if (offset == 0xF00051)
-		return tomTimerPrescaler & 0xFF;
-	else if (offset == 0xF00052)
-		return tomTimerDivider >> 8;
-	else if (offset == 0xF00053)
-		return tomTimerDivider & 0xFF;
+	const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[offset & 0xFFFF]];
+
+	if (reg.readByte)
+		return reg.readByte(offset, who);
 
 	return tomRam8[offset & 0x3FFF];
 }
@@ -1369,18 +1858,10 @@ uint16_t TOMReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 #ifdef TOM_DEBUG
 	WriteLog("TOM: Reading word at %06X for %s\n", offset, whoName[who]);
 #endif
-if (offset >= 0xF02000 && offset <= 0xF020FF)
-	WriteLog("TOM: ReadWord attempted from GPU register file by %s (unimplemented)!\n", whoName[who]);
+#ifdef TOM_REGISTER_LOG
+	TOMLogReadWord(offset, who);
+#endif
 
-	if (offset == 0xF000E0)
-	{
-		// For reading, should only return the lower 5 bits...
-		uint16_t data = (tom_jerry_int_pending << 4) | (tom_timer_int_pending << 3)
-			| (tom_object_int_pending << 2) | (tom_gpu_int_pending << 1)
-			| (tom_video_int_pending << 0);
-		//WriteLog("tom: interrupt status is 0x%.4x \n",data);
-		return data;
-	}
 //Shoud be handled by the jaguar main loop now... And it is! ;-)
 /*	else if (offset == 0xF00006)	// VC
 	// What if we're in interlaced mode?
@@ -1394,26 +1875,33 @@ if (offset >= 0xF02000 && offset <= 0xF020FF)
 //	                      -----x-- --------      (which half of the display)
 //	                      ------xx xxxxxxxx      (10-bit counter)
 */
-// This is a kludge to get the HC working somewhat... What we really should do here
-// is check what the global time is at the time of the read and calculate the correct HC...
-// !!! FIX !!!
-	else if (offset == 0xF00004)
-		return rand() & 0x03FF;
-	else if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE + 0x20))
-		return GPUReadWord(offset, who);
-	else if ((offset >= GPU_WORK_RAM_BASE) && (offset < GPU_WORK_RAM_BASE + 0x1000))
-		return GPUReadWord(offset, who);
-/*	else if ((offset >= 0xF00010) && (offset < 0xF00028))
-		return OPReadWord(offset, who);*/
-	else if ((offset >= 0xF02200) && (offset < 0xF022A0))
-		return BlitterReadWord(offset, who);
-	else if (offset == 0xF00050)
-		return tomTimerPrescaler;
-	else if (offset == 0xF00052)
-		return tomTimerDivider;
+	const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[offset & 0xFFFF]];
 
-	offset &= 0x3FFF;
-	return (TOMReadByte(offset, who) << 8) | TOMReadByte(offset + 1, who);
+	if (reg.readWord)
+		return reg.readWord(offset, who);
+
+	return (tomRam8[offset & 0x3FFF] << 8) | tomRam8[(offset + 1) & 0x3FFF];
+}
+
+
+//
+// TOM long access (read)
+// Read at once if both words are plain, or by the long handler of their class
+//
+uint32_t TOMReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
+{
+#if !defined(TOM_DEBUG) && !defined(TOM_REGISTER_LOG)
+	const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[offset & 0xFFFF]];
+	const TOMRegisterClass & reg2 = tomRegisterClass[tomRegisterMap[(offset + 2) & 0xFFFF]];
+
+	if (!reg.readWord && !reg2.readWord && ((offset & 0x3FFF) <= 0x3FFC))
+		return GET32(tomRam8, offset & 0x3FFF);
+
+	if (reg.readLong && (&reg == &reg2) && !(offset & 0x03))
+		return reg.readLong(offset, who);
+#endif
+
+	return (TOMReadWord(offset, who) << 16) | TOMReadWord(offset + 2, who);
 }
 
 
@@ -1449,58 +1937,10 @@ void TOMWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 		return;
 #endif
 
-	if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE+0x20))
-	{
-		GPUWriteByte(offset, data, who);
-		return;
-	}
-	else if ((offset >= GPU_WORK_RAM_BASE) && (offset < GPU_WORK_RAM_BASE+0x1000))
-	{
-		GPUWriteByte(offset, data, who);
-		return;
-	}
-/*	else if ((offset >= 0xF00010) && (offset < 0xF00028))
-	{
-		OPWriteByte(offset, data, who);
-		return;
-	}*/
-	else if ((offset >= 0xF02200) && (offset < 0xF022A0))
-	{
-		BlitterWriteByte(offset, data, who);
-		return;
-	}
-	else if (offset == 0xF00050)
-	{
-		tomTimerPrescaler = (tomTimerPrescaler & 0x00FF) | (data << 8);
-		TOMResetPIT();
-		return;
-	}
-	else if (offset == 0xF00051)
-	{
-		tomTimerPrescaler = (tomTimerPrescaler & 0xFF00) | data;
-		TOMResetPIT();
-		return;
-	}
-	else if (offset == 0xF00052)
-	{
-		tomTimerDivider = (tomTimerDivider & 0x00FF) | (data << 8);
-		TOMResetPIT();
-		return;
-	}
-	else if (offset == 0xF00053)
-	{
-		tomTimerDivider = (tomTimerDivider & 0xFF00) | data;
-		TOMResetPIT();
-		return;
-	}
-	else if (offset >= 0xF00400 && offset <= 0xF007FF)	// CLUT (A & B)
-	{
-		// Writing to one CLUT writes to the other
-		offset &= 0x5FF;		// Mask out $F00600 (restrict to $F00400-5FF)
-		tomRam8[offset] = data, tomRam8[offset + 0x200] = data;
-	}
+	const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[offset & 0xFFFF]];
 
-//	tomRam8[offset & 0x3FFF] = data;
+	if (reg.writeByte)
+		reg.writeByte(offset, data, who);
 }
 
 
@@ -1535,193 +1975,53 @@ void TOMWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 		return;
 #endif
 
-//if (offset == 0xF00000 + MEMCON1)
-//	WriteLog("TOM: Memory Configuration 1 written by %s: %04X\n", whoName[who], data);
-//if (offset == 0xF00000 + MEMCON2)
-//	WriteLog("TOM: Memory Configuration 2 written by %s: %04X\n", whoName[who], data);
-if (offset >= 0xF02000 && offset <= 0xF020FF)
-	WriteLog("TOM: WriteWord attempted to GPU register file by %s (unimplemented)!\n", whoName[who]);
-
-	if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE+0x20))
-	{
-		GPUWriteWord(offset, data, who);
-		return;
-	}
-	else if ((offset >= GPU_WORK_RAM_BASE) && (offset < GPU_WORK_RAM_BASE+0x1000))
-	{
-		GPUWriteWord(offset, data, who);
-		return;
-	}
-//What's so special about this?
-/*	else if ((offset >= 0xF00000) && (offset < 0xF00002))
-	{
-		TOMWriteByte(offset, data >> 8);
-		TOMWriteByte(offset+1, data & 0xFF);
-	}*/
-/*	else if ((offset >= 0xF00010) && (offset < 0xF00028))
-	{
-		OPWriteWord(offset, data, who);
-		return;
-	}*/
-	else if (offset == 0xF00050)
-	{
-		tomTimerPrescaler = data;
-		TOMResetPIT();
-		return;
-	}
-	else if (offset == 0xF00052)
-	{
-		tomTimerDivider = data;
-		TOMResetPIT();
-		return;
-	}
-	else if (offset == 0xF000E0)
-	{
-//Check this out...
-		if (data & 0x0100)
-			tom_video_int_pending = 0;
-		if (data & 0x0200)
-			tom_gpu_int_pending = 0;
-		if (data & 0x0400)
-			tom_object_int_pending = 0;
-		if (data & 0x0800)
-			tom_timer_int_pending = 0;
-		if (data & 0x1000)
-			tom_jerry_int_pending = 0;
-
-//		return;
-	}
-	else if ((offset >= 0xF02200) && (offset <= 0xF0229F))
-	{
-		BlitterWriteWord(offset, data, who);
-		return;
-	}
-	else if (offset >= 0xF00400 && offset <= 0xF007FE)	// CLUT (A & B)
-	{
-		// Writing to one CLUT writes to the other
-		offset &= 0x5FF;		// Mask out $F00600 (restrict to $F00400-5FF)
-// Watch out for unaligned writes here! (Not fixed yet)
-#ifdef _MSC_VER
-#pragma message("Warning: !!! Watch out for unaligned writes here !!! FIX !!!")
-#else
-#warning "!!! Watch out for unaligned writes here !!! FIX !!!"
-#endif // _MSC_VER
-		SET16(tomRam8, offset, data);
-		SET16(tomRam8, offset + 0x200, data);
-	}
+#ifdef TOM_REGISTER_LOG
+	TOMLogWriteWord(offset, data, who);
+#endif
 
-	offset &= 0x3FFF;
-	if (offset == 0x28)			// VMODE (Why? Why not OBF?)
-//Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!
-#ifdef _MSC_VER
-#pragma message("Warning: Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!")
-#else
-#warning "Actually, we should check to see if the Enable bit of VMODE is set before doing this... !!! FIX !!!"
-#endif // _MSC_VER
-		objectp_running = 1;
+	const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[offset & 0xFFFF]];
 
-	if (offset >= 0x30 && offset <= 0x4E)
-		data &= 0x07FF;			// These are (mostly) 11-bit registers
-	if (offset == 0x2E || offset == 0x36 || offset == 0x54)
-		data &= 0x03FF;			// These are all 10-bit registers
+	if (reg.writeWord)
+		reg.writeWord(offset, data, who);
+}
 
-// Fix a lockup bug... :-P
-//	TOMWriteByte(0xF00000 | offset, data >> 8, who);
-//	TOMWriteByte(0xF00000 | (offset+1), data & 0xFF, who);
-
-if (offset == MEMCON1)
-	WriteLog("TOM: Memory Config 1 written by %s: $%04X\n", whoName[who], data);
-if (offset == MEMCON2)
-	WriteLog("TOM: Memory Config 2 written by %s: $%04X\n", whoName[who], data);
-//if (offset == OLP)
-//	WriteLog("TOM: Object List Pointer written by %s: $%04X\n", whoName[who], data);
-//if (offset == OLP + 2)
-//	WriteLog("TOM: Object List Pointer +2 written by %s: $%04X\n", whoName[who], data);
-//if (offset == OBF)
-//	WriteLog("TOM: Object Processor Flag written by %s: %u\n", whoName[who], data);
-if (offset == VMODE)
-	WriteLog("TOM: Video Mode written by %s: %04X. PWIDTH = %u, MODE = %s, flags:%s%s (VC = %u) (M68K PC = %06X)\n", whoName[who], data, ((data >> 9) & 0x07) + 1, videoMode_to_str[(data & MODE) >> 1], (data & BGEN ? " BGEN" : ""), (data & VARMOD ? " VARMOD" : ""), GET16(tomRam8, VC), m68k_get_reg(NULL, M68K_REG_PC));
-if (offset == BORD1)
-	WriteLog("TOM: Border 1 written by %s: $%04X\n", whoName[who], data);
-if (offset == BORD2)
-	WriteLog("TOM: Border 2 written by %s: $%04X\n", whoName[who], data);
-if (offset == HP)
-	WriteLog("TOM: Horizontal Period written by %s: %u (+1*2 = %u)\n", whoName[who], data, (data + 1) * 2);
-if (offset == HBB)
-	WriteLog("TOM: Horizontal Blank Begin written by %s: %u\n", whoName[who], data);
-if (offset == HBE)
-	WriteLog("TOM: Horizontal Blank End written by %s: %u\n", whoName[who], data);
-if (offset == HS)
-	WriteLog("TOM: Horizontal Sync written by %s: %u\n", whoName[who], data);
-if (offset == HVS)
-	WriteLog("TOM: Horizontal Vertical Sync written by %s: %u\n", whoName[who], data);
-if (offset == HDB1)
-	WriteLog("TOM: Horizontal Display Begin 1 written by %s: %u\n", whoName[who], data);
-if (offset == HDB2)
-	WriteLog("TOM: Horizontal Display Begin 2 written by %s: %u\n", whoName[who], data);
-if (offset == HDE)
-	WriteLog("TOM: Horizontal Display End written by %s: %u\n", whoName[who], data);
-if (offset == VP)
-	WriteLog("TOM: Vertical Period written by %s: %u (%sinterlaced)\n", whoName[who], data, (data & 0x01 ? "non-" : ""));
-if (offset == VBB)
-	WriteLog("TOM: Vertical Blank Begin written by %s: %u\n", whoName[who], data);
-if (offset == VBE)
-	WriteLog("TOM: Vertical Blank End written by %s: %u\n", whoName[who], data);
-if (offset == VS)
-	WriteLog("TOM: Vertical Sync written by %s: %u\n", whoName[who], data);
-if (offset == VDB)
-	WriteLog("TOM: Vertical Display Begin written by %s: %u\n", whoName[who], data);
-if (offset == VDE)
-	WriteLog("TOM: Vertical Display End written by %s: %u\n", whoName[who], data);
-if (offset == VEB)
-	WriteLog("TOM: Vertical Equalization Begin written by %s: %u\n", whoName[who], data);
-if (offset == VEE)
-	WriteLog("TOM: Vertical Equalization End written by %s: %u\n", whoName[who], data);
-if (offset == VI)
-	WriteLog("TOM: Vertical Interrupt written by %s: %u\n", whoName[who], data);
-if (offset == PIT0)
-	WriteLog("TOM: PIT0 written by %s: %u\n", whoName[who], data);
-if (offset == PIT1)
-	WriteLog("TOM: PIT1 written by %s: %u\n", whoName[who], data);
-if (offset == HEQ)
-	WriteLog("TOM: Horizontal Equalization End written by %s: %u\n", whoName[who], data);
-//if (offset == BG)
-//	WriteLog("TOM: Background written by %s: %u\n", whoName[who], data);
-//if (offset == INT1)
-//	WriteLog("TOM: CPU Interrupt Control written by %s: $%04X (%s%s%s%s%s)\n", whoName[who], data, (data & 0x01 ? "Video" : ""), (data & 0x02 ? " GPU" : ""), (data & 0x04 ? " OP" : ""), (data & 0x08 ? " TOMPIT" : ""), (data & 0x10 ? " Jerry" : ""));
 
-	// detect screen resolution changes
-//This may go away in the future, if we do the virtualized screen thing...
-//This may go away soon!
-// TOM Shouldn't be mucking around with this, it's up to the host system to properly
-// handle this kind of crap.
-// NOTE: This is needed somehow, need to get rid of the dependency on this crap.
-//       N.B.: It's used in the rendering functions... So...
-#ifdef _MSC_VER
-#pragma message("Warning: !!! Need to get rid of this dependency !!!")
-#else
-#warning "!!! Need to get rid of this dependency !!!"
-#endif // _MSC_VER
-#if 1
-	if ((offset >= 0x28) && (offset <= 0x4F))
+//
+// TOM long access (write)
+// Written at once if both words are plain, or by the long handler of their class
+//
+void TOMWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
+{
+#if !defined(TOM_DEBUG) && !defined(TOM_REGISTER_LOG) && defined(TOM_STRICT_MEMORY_ACCESS)
+	if ((offset & 0x3FFF) <= 0x3FFC)
 	{
-		uint32_t width = TOMGetVideoModeWidth(), height = TOMGetVideoModeHeight();
+		uint32_t address = offset;
+
+		// "Fast" (32-bit only) write access to the GPU
+		if ((address >= 0xF08000) && (address <= 0xF0BFFF))
+			address &= 0xFF7FFF;
+
+		const TOMRegisterClass & reg = tomRegisterClass[tomRegisterMap[address & 0xFFFF]];
+		const TOMRegisterClass & reg2 = tomRegisterClass[tomRegisterMap[(address + 2) & 0xFFFF]];
 
-		if ((width != tomWidth) || (height != tomHeight))
+		// Out of the registers, only the TOM RAM is written
+		if ((address < 0xF00000) || (address > 0xF03FFF) || (!reg.writeWord && !reg2.writeWord))
 		{
-			tomWidth = width, tomHeight = height;
+			SET32(tomRam8, offset & 0x3FFF, data);
+			return;
+		}
 
-#ifdef _MSC_VER
-#pragma message("Warning: !!! TOM: ResizeScreen commented out !!!")
-#else
-#warning "!!! TOM: ResizeScreen commented out !!!"
-#endif // _MSC_VER
-// No need to resize anything, since we're prepared for this...
-//			if (vjs.renderType == RT_NORMAL)
-//				ResizeScreen(tomWidth, tomHeight);
+		if (reg.writeLong && (&reg == &reg2) && !(address & 0x03))
+		{
+			SET32(tomRam8, offset & 0x3FFF, data);
+			reg.writeLong(address, data, who);
+			return;
 		}
 	}
 #endif
+
+	TOMWriteWord(offset, data >> 16, who);
+	TOMWriteWord(offset + 2, data & 0xFFFF, who);
 }
 
 
@@ -1729,7 +2029,7 @@ int TOMIRQEnabled(int irq)
 {
 	// This is the correct byte in big endian... D'oh!
 //	return jaguar_byte_read(0xF000E1) & (1 << irq);
-	return tomRam8[INT1 + 1/*0xE1*/] & (1 << irq);
+	return InterruptEnabled(INTERRUPT_TOM) & (1 << irq);
 }
 
 
@@ -1778,11 +2078,9 @@ void TOMExecPIT(uint32_t cycles)
 
 		if (tomTimerCounter <= 0)
 		{
-			TOMSetPendingTimerInt();
+			InterruptLatch(INTERRUPT_TOM, 1 << IRQ_TIMER);
 			GPUSetIRQLine(GPUIRQ_TIMER, ASSERT_LINE);	// GPUSetIRQLine does the 'IRQ enabled' checking
-
-			if (TOMIRQEnabled(IRQ_TIMER))
-				m68k_set_irq(2);				// Cause a 68000 IPL 2...
+			InterruptTOMRequest(IRQ_TIMER);		// Cause a 68000 IPL 2...
 
 			TOMResetPIT();
 		}
@@ -1793,12 +2091,11 @@ void TOMExecPIT(uint32_t cycles)
 void TOMPITCallback(void)
 {
 //	INT1_RREG |= 0x08;							// Set TOM PIT interrupt pending
-	TOMSetPendingTimerInt();
+	InterruptLatch(INTERRUPT_TOM, 1 << IRQ_TIMER);
     GPUSetIRQLine(GPUIRQ_TIMER, ASSERT_LINE);	// It does the 'IRQ enabled' checking
 
 //	if (INT1_WREG & 0x08)
-	if (TOMIRQEnabled(IRQ_TIMER))
-		m68k_set_irq(2);						// Generate a 68K IPL 2...
+	InterruptTOMRequest(IRQ_TIMER);				// Generate a 68K IPL 2...
 
 	TOMResetPIT();
 }
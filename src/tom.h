@@ -31,9 +31,12 @@ void TOMDone(void);
 
 uint8_t TOMReadByte(uint32_t offset, uint32_t who = UNKNOWN);
 uint16_t TOMReadWord(uint32_t offset, uint32_t who = UNKNOWN);
+uint32_t TOMReadLong(uint32_t offset, uint32_t who = UNKNOWN);
 void TOMWriteByte(uint32_t offset, uint8_t data, uint32_t who = UNKNOWN);
 void TOMWriteWord(uint32_t offset, uint16_t data, uint32_t who = UNKNOWN);
+void TOMWriteLong(uint32_t offset, uint32_t data, uint32_t who = UNKNOWN);
 
+void TOMClearLineBuffer(uint8_t * ram);
 void TOMExecHalfline(uint16_t halfline, bool render);
 uint32_t TOMGetVideoModeWidth(void);
 uint32_t TOMGetVideoModeHeight(void);
@@ -45,17 +48,13 @@ uint16_t TOMGetHC(void);
 uint16_t TOMGetVP(void);
 uint16_t TOMGetMEMCON1(void);
 void TOMDumpIORegistersToLog(void);
+void TOMGetBeamPollSkipped(uint64_t * hc, uint64_t * vc);
 
 
 int TOMIRQEnabled(int irq);
 uint16_t TOMIRQControlReg(void);
 void TOMSetIRQLatch(int irq, int enabled);
 void TOMExecPIT(uint32_t cycles);
-void TOMSetPendingJERRYInt(void);
-void TOMSetPendingTimerInt(void);
-void TOMSetPendingObjectInt(void);
-void TOMSetPendingGPUInt(void);
-void TOMSetPendingVideoInt(void);
 void TOMResetPIT(void);
 
 // Exported variables
@@ -0,0 +1,860 @@
+//
+// M68K call stack unwinder
+//
+// A frame is unwound with the first method giving a plausible return address:
+// the DWARF call frame information of the program (.debug_frame, big endian),
+// then the function prologue (the entry is found back from the PC, at a LINK
+// or after the RTS of the previous function, and the stack pushes are
+// simulated up to the PC), then the A6 frames chain. Without a LINK, the
+// return address is searched up the stack from the prologue pushes, and must
+// follow a JSR/BSR; so the functions built without a frame pointer can be
+// unwound even without call frame information.
+//
+// The rule of a PC (where the CFA, the return address and the saved A6 are)
+// is cached; a rule found from the code is dropped as soon as a page of its
+// function up to the PC is written. The call frame information is only
+// replaced by a new program.
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  advance_loc1/2/4 operands checked against the entry end
+//
+
+#include "unwind.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include "log.h"
+#include "memory.h"
+#include "settings.h"
+#include "m68000/m68kinterface.h"
+
+// DWARF registers numbers
+#define UNWIND_REG_A6		14
+#define UNWIND_REG_A7		15
+#define UNWIND_COLUMNS		32
+// remember_state depth
+#define UNWIND_STATES_MAX	8
+// Bytes scanned back from the PC for the function entry
+#define UNWIND_SCAN_MAX		0x1000
+// Bytes scanned up the stack for the return address, when the function has pushed more than its prologue
+#define UNWIND_STACK_SCAN	256
+// Cached rules, the cache is emptied when full
+#define UNWIND_RULES_MAX	0x10000
+
+// Register rules
+enum { UNWIND_SAME = 0, UNWIND_UNDEFINED, UNWIND_OFFSET, UNWIND_OTHER };
+
+struct UnwindRule
+{
+	uint32_t method;
+	uint32_t cfaReg;							// A6 or A7
+	int32_t cfaOffset;
+	int32_t raOffset;							// Return address and saved A6 slots, from the CFA
+	bool a6Saved;
+	int32_t a6Offset;
+	bool scan;									// Return address searched up from the CFA
+	uint32_t start;								// Code the rule depends on, from start to the PC
+	uint64_t epoch;								// 0 for the call frame information
+};
+
+struct UnwindState
+{
+	uint32_t cfaReg;
+	int32_t cfaOffset;
+	bool cfaExpression;
+	uint8_t rule[UNWIND_COLUMNS];
+	int32_t offset[UNWIND_COLUMNS];
+};
+
+struct UnwindCIE
+{
+	uint32_t codeAlign;
+	int32_t dataAlign;
+	uint32_t raColumn;
+	uint32_t instructions, end;					// Offsets in the section
+};
+
+struct UnwindFDE
+{
+	uint32_t low, high;
+	uint32_t cie;
+	uint32_t instructions, end;
+};
+
+static std::vector<uint8_t> unwindFrameInfo;
+static std::map<uint32_t, UnwindCIE> unwindCIEs;
+static std::vector<UnwindFDE> unwindFDEs;		// Sorted by address
+static std::unordered_map<uint32_t, UnwindRule> unwindRules;
+
+
+//
+// Forget the call frame information and the cached rules
+//
+void UnwindReset(void)
+{
+	unwindFrameInfo.clear();
+	unwindCIEs.clear();
+	unwindFDEs.clear();
+	unwindRules.clear();
+}
+
+
+//
+static uint32_t UnwindGet32(const uint8_t * p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+
+//
+// LEB128 readers, the offset is left at the end on a truncated value
+//
+static uint32_t UnwindULEB(const uint8_t * p, uint32_t & offset, uint32_t end)
+{
+	uint32_t value = 0, shift = 0;
+
+	while (offset < end)
+	{
+		uint8_t byte = p[offset++];
+
+		if (shift < 32)
+		{
+			value |= (uint32_t)(byte & 0x7F) << shift;
+		}
+
+		shift += 7;
+
+		if (!(byte & 0x80))
+		{
+			break;
+		}
+	}
+
+	return value;
+}
+
+
+//
+static int32_t UnwindSLEB(const uint8_t * p, uint32_t & offset, uint32_t end)
+{
+	uint32_t value = 0, shift = 0;
+	uint8_t byte = 0;
+
+	while (offset < end)
+	{
+		byte = p[offset++];
+
+		if (shift < 32)
+		{
+			value |= (uint32_t)(byte & 0x7F) << shift;
+		}
+
+		shift += 7;
+
+		if (!(byte & 0x80))
+		{
+			break;
+		}
+	}
+
+	if ((shift < 32) && (byte & 0x40))
+	{
+		value |= ~0u << shift;
+	}
+
+	return (int32_t)value;
+}
+
+
+//
+// Copy and index the .debug_frame section
+// The CIEs with an augmentation, and the 64-bit entries, are skipped
+//
+bool UnwindSetFrameInfo(const uint8_t * section, uint32_t size)
+{
+	UnwindReset();
+	unwindFrameInfo.assign(section, section + size);
+	const uint8_t * p = unwindFrameInfo.data();
+
+	for (uint32_t offset = 0; (offset + 8) <= size; )
+	{
+		uint32_t length = UnwindGet32(p + offset);
+
+		if (!length)
+		{
+			offset += 4;
+			continue;
+		}
+
+		if ((length == 0xFFFFFFFF) || (length > (size - offset - 4)))
+		{
+			WriteLog("UNWIND: Unsupported or truncated .debug_frame entry at $%X\n", offset);
+			break;
+		}
+
+		uint32_t entry = offset, end = offset + 4 + length, id = UnwindGet32(p + offset + 4);
+		offset += 8;
+
+		if (id == 0xFFFFFFFF)
+		{
+			UnwindCIE cie;
+			uint8_t version = p[offset++];
+
+			if (p[offset] || ((version != 1) && (version != 3) && (version != 4)))
+			{
+				WriteLog("UNWIND: CIE at $%X not supported\n", entry);
+			}
+			else
+			{
+				offset++;
+
+				if (version == 4)
+				{
+					offset += 2;						// Address and segment sizes
+				}
+
+				cie.codeAlign = UnwindULEB(p, offset, end);
+				cie.dataAlign = UnwindSLEB(p, offset, end);
+				cie.raColumn = (version == 1) ? p[offset++] : UnwindULEB(p, offset, end);
+				cie.instructions = offset;
+				cie.end = end;
+				unwindCIEs[entry] = cie;
+			}
+		}
+		else if ((offset + 8) <= end)
+		{
+			UnwindFDE fde;
+			fde.cie = id;
+			fde.low = UnwindGet32(p + offset);
+			fde.high = fde.low + UnwindGet32(p + offset + 4);
+			fde.instructions = offset + 8;
+			fde.end = end;
+			unwindFDEs.push_back(fde);
+		}
+
+		offset = end;
+	}
+
+	std::sort(unwindFDEs.begin(), unwindFDEs.end(), [](const UnwindFDE & a, const UnwindFDE & b) { return a.low < b.low; });
+	WriteLog("UNWIND: %u CIE and %u FDE found\n", (uint32_t)unwindCIEs.size(), (uint32_t)unwindFDEs.size());
+
+	return !unwindFDEs.empty();
+}
+
+
+//
+// Run the call frame instructions up to the address
+// The instructions of a FDE restore from the CIE initial state
+//
+static bool UnwindExecute(const UnwindCIE & cie, uint32_t offset, uint32_t end, uint32_t location, uint32_t address, UnwindState & state, const UnwindState & initial)
+{
+	const uint8_t * p = unwindFrameInfo.data();
+	UnwindState stack[UNWIND_STATES_MAX];
+	uint32_t depth = 0, reg, delta;
+
+	while (offset < end)
+	{
+		uint8_t op = p[offset++];
+		delta = 0;
+
+		switch (op & 0xC0)
+		{
+		case 0x40:									// advance_loc
+			delta = (op & 0x3F) * cie.codeAlign;
+			break;
+
+		case 0x80:									// offset
+			reg = op & 0x3F;
+
+			if (reg < UNWIND_COLUMNS)
+			{
+				state.rule[reg] = UNWIND_OFFSET;
+				state.offset[reg] = (int32_t)UnwindULEB(p, offset, end) * cie.dataAlign;
+			}
+			else
+			{
+				UnwindULEB(p, offset, end);
+			}
+			break;
+
+		case 0xC0:									// restore
+			reg = op & 0x3F;
+
+			if (reg < UNWIND_COLUMNS)
+			{
+				state.rule[reg] = initial.rule[reg];
+				state.offset[reg] = initial.offset[reg];
+			}
+			break;
+
+		default:
+			switch (op)
+			{
+			case 0x00:								// nop
+				break;
+
+			case 0x2E:								// GNU_args_size
+				UnwindULEB(p, offset, end);
+				break;
+
+			case 0x01:								// set_loc
+				if ((offset + 4) > end)
+				{
+					return false;
+				}
+
+				if ((reg = UnwindGet32(p + offset)) > address)
+				{
+					return true;
+				}
+
+				location = reg;
+				offset += 4;
+				break;
+
+			case 0x02:								// advance_loc1
+				if ((offset + 1) > end)
+				{
+					return false;
+				}
+
+				delta = p[offset++] * cie.codeAlign;
+				break;
+
+			case 0x03:								// advance_loc2
+				if ((offset + 2) > end)
+				{
+					return false;
+				}
+
+				delta = ((p[offset] << 8) | p[offset + 1]) * cie.codeAlign;
+				offset += 2;
+				break;
+
+			case 0x04:								// advance_loc4
+				if ((offset + 4) > end)
+				{
+					return false;
+				}
+
+				delta = UnwindGet32(p + offset) * cie.codeAlign;
+				offset += 4;
+				break;
+
+			case 0x05:								// offset_extended
+			case 0x11:								// offset_extended_sf
+			case 0x2F:								// GNU_negative_offset_extended
+				if ((reg = UnwindULEB(p, offset, end)) < UNWIND_COLUMNS)
+				{
+					state.rule[reg] = UNWIND_OFFSET;
+					state.offset[reg] = ((op == 0x11) ? UnwindSLEB(p, offset, end) : (int32_t)UnwindULEB(p, offset, end)) * cie.dataAlign * ((op == 0x2F) ? -1 : 1);
+				}
+				else
+				{
+					UnwindULEB(p, offset, end);
+				}
+				break;
+
+			case 0x06:								// restore_extended
+				if ((reg = UnwindULEB(p, offset, end)) < UNWIND_COLUMNS)
+				{
+					state.rule[reg] = initial.rule[reg];
+					state.offset[reg] = initial.offset[reg];
+				}
+				break;
+
+			case 0x07:								// undefined
+			case 0x08:								// same_value
+				if ((reg = UnwindULEB(p, offset, end)) < UNWIND_COLUMNS)
+				{
+					state.rule[reg] = (op == 0x07) ? UNWIND_UNDEFINED : UNWIND_SAME;
+				}
+				break;
+
+			case 0x09:								// register
+			case 0x14:								// val_offset
+			case 0x15:								// val_offset_sf
+				if ((reg = UnwindULEB(p, offset, end)) < UNWIND_COLUMNS)
+				{
+					state.rule[reg] = UNWIND_OTHER;
+				}
+
+				UnwindULEB(p, offset, end);
+				break;
+
+			case 0x10:								// expression
+			case 0x16:								// val_expression
+				if ((reg = UnwindULEB(p, offset, end)) < UNWIND_COLUMNS)
+				{
+					state.rule[reg] = UNWIND_OTHER;
+				}
+
+				offset += UnwindULEB(p, offset, end);
+				break;
+
+			case 0x0A:								// remember_state
+				if (depth == UNWIND_STATES_MAX)
+				{
+					return false;
+				}
+
+				stack[depth++] = state;
+				break;
+
+			case 0x0B:								// restore_state
+				if (!depth)
+				{
+					return false;
+				}
+
+				{
+					// The CFA is not part of the remembered state
+					UnwindState current = state;
+					state = stack[--depth];
+					state.cfaReg = current.cfaReg;
+					state.cfaOffset = current.cfaOffset;
+					state.cfaExpression = current.cfaExpression;
+				}
+				break;
+
+			case 0x0C:								// def_cfa
+				state.cfaReg = UnwindULEB(p, offset, end);
+				state.cfaOffset = UnwindULEB(p, offset, end);
+				state.cfaExpression = false;
+				break;
+
+			case 0x12:								// def_cfa_sf
+				state.cfaReg = UnwindULEB(p, offset, end);
+				state.cfaOffset = UnwindSLEB(p, offset, end) * cie.dataAlign;
+				state.cfaExpression = false;
+				break;
+
+			case 0x0D:								// def_cfa_register
+				state.cfaReg = UnwindULEB(p, offset, end);
+				state.cfaExpression = false;
+				break;
+
+			case 0x0E:								// def_cfa_offset
+				state.cfaOffset = UnwindULEB(p, offset, end);
+				break;
+
+			case 0x13:								// def_cfa_offset_sf
+				state.cfaOffset = UnwindSLEB(p, offset, end) * cie.dataAlign;
+				break;
+
+			case 0x0F:								// def_cfa_expression
+				state.cfaExpression = true;
+				offset += UnwindULEB(p, offset, end);
+				break;
+
+			default:
+				WriteLog("UNWIND: Call frame instruction $%02X not supported\n", op);
+				return false;
+			}
+			break;
+		}
+
+		if (delta)
+		{
+			if ((location + delta) > address)
+			{
+				return true;
+			}
+
+			location += delta;
+		}
+	}
+
+	return (offset == end);
+}
+
+
+//
+// Rule of an address from the call frame information
+//
+static bool UnwindRuleFromCFI(uint32_t address, UnwindRule & rule)
+{
+	std::vector<UnwindFDE>::const_iterator fde = std::upper_bound(unwindFDEs.begin(), unwindFDEs.end(), address, [](uint32_t a, const UnwindFDE & f) { return a < f.low; });
+
+	if ((fde == unwindFDEs.begin()) || (address >= (--fde)->high))
+	{
+		return false;
+	}
+
+	std::map<uint32_t, UnwindCIE>::const_iterator cie = unwindCIEs.find(fde->cie);
+
+	if ((cie == unwindCIEs.end()) || (cie->second.raColumn >= UNWIND_COLUMNS))
+	{
+		return false;
+	}
+
+	UnwindState initial = {}, state;
+
+	if (!UnwindExecute(cie->second, cie->second.instructions, cie->second.end, fde->low, 0xFFFFFFFF, initial, initial))
+	{
+		return false;
+	}
+
+	state = initial;
+
+	if (!UnwindExecute(cie->second, fde->instructions, fde->end, fde->low, address, state, initial) || state.cfaExpression
+		|| ((state.cfaReg != UNWIND_REG_A6) && (state.cfaReg != UNWIND_REG_A7)) || (state.rule[cie->second.raColumn] != UNWIND_OFFSET))
+	{
+		return false;
+	}
+
+	rule.method = UNWIND_CFI;
+	rule.cfaReg = state.cfaReg;
+	rule.cfaOffset = state.cfaOffset;
+	rule.raOffset = state.offset[cie->second.raColumn];
+	rule.a6Saved = (state.rule[UNWIND_REG_A6] == UNWIND_OFFSET);
+	rule.a6Offset = state.offset[UNWIND_REG_A6];
+	rule.scan = false;
+	rule.start = address;
+	rule.epoch = 0;
+
+	return true;
+}
+
+
+//
+// Code word, false out of the RAM and of the ROM/BIOS
+//
+static bool UnwindReadCode(uint32_t address, uint32_t & value)
+{
+	if ((address & 1) || !((address < vjs.DRAM_size) || ((address >= 0x800000) && (address < 0xE20000))))
+	{
+		return false;
+	}
+
+	value = GET16(jagMemSpace, address);
+	return true;
+}
+
+
+//
+static bool UnwindReadStack(uint32_t address, uint32_t & value)
+{
+	if ((address & 1) || ((address + 4) > vjs.DRAM_size))
+	{
+		return false;
+	}
+
+	value = GET32(jaguarMainRAM, address);
+	return true;
+}
+
+
+//
+// A return address follows a JSR or a BSR
+//
+static bool UnwindPlausibleReturn(uint32_t address)
+{
+	uint32_t opcode;
+
+	if ((address < 6) || !UnwindReadCode(address, opcode))
+	{
+		return false;
+	}
+
+	// JSR (An), BSR.S
+	if (UnwindReadCode(address - 2, opcode) && (((opcode & 0xFFF8) == 0x4E90) || (((opcode & 0xFF00) == 0x6100) && ((opcode & 0xFF) != 0x00) && ((opcode & 0xFF) != 0xFF))))
+	{
+		return true;
+	}
+
+	// JSR d16(An), JSR d8(An,Xn), JSR abs.W, JSR d16(PC), JSR d8(PC,Xn), BSR.W
+	if (UnwindReadCode(address - 4, opcode) && (((opcode >= 0x4EA8) && (opcode <= 0x4EBB) && (opcode != 0x4EB9)) || (opcode == 0x6100)))
+	{
+		return true;
+	}
+
+	// JSR abs.L
+	return (UnwindReadCode(address - 6, opcode) && (opcode == 0x4EB9));
+}
+
+
+//
+// Function entry, at a LINK A6 or after the return of the previous function (and its padding)
+//
+static bool UnwindFindEntry(uint32_t pc, uint32_t & entry)
+{
+	uint32_t opcode;
+
+	for (uint32_t address = pc; (address >= 2) && ((pc - address) < UNWIND_SCAN_MAX); )
+	{
+		if (!UnwindReadCode(address -= 2, opcode))
+		{
+			return false;
+		}
+
+		if (opcode == 0x4E56)
+		{
+			entry = address;
+			return true;
+		}
+
+		// RTS, RTE, RTR
+		if ((opcode == 0x4E75) || (opcode == 0x4E73) || (opcode == 0x4E77))
+		{
+			for (entry = address + 2; (entry < pc) && UnwindReadCode(entry, opcode) && (!opcode || (opcode == 0x4E71)); entry += 2);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+// Rule of an address from the function prologue, simulated from the entry up to the address
+//
+static bool UnwindRuleFromPrologue(uint32_t pc, UnwindRule & rule)
+{
+	uint32_t entry, opcode, operand, operand2;
+	int32_t pushed = 0;
+
+	if (!UnwindFindEntry(pc, entry))
+	{
+		return false;
+	}
+
+	rule.method = UNWIND_PROLOGUE;
+	rule.cfaReg = UNWIND_REG_A7;
+	rule.raOffset = -4;
+	rule.a6Saved = false;
+	rule.a6Offset = 0;
+	rule.scan = false;
+	rule.start = entry;
+
+	for (uint32_t address = entry; address < pc; )
+	{
+		if (!UnwindReadCode(address, opcode) || !UnwindReadCode(address + 2, operand))
+		{
+			return false;
+		}
+
+		// LINK A6,#d: the pushes after it do not matter
+		if (opcode == 0x4E56)
+		{
+			rule.cfaReg = UNWIND_REG_A6;
+			rule.cfaOffset = 8;
+			rule.a6Saved = true;
+			rule.a6Offset = -8;
+			return true;
+		}
+		// MOVEM.L list,-(SP), the registers are stored from D0 at the lowest address
+		else if (opcode == 0x48E7)
+		{
+			int32_t count = 0, below = 0;
+
+			for (uint32_t bit = 0; bit < 16; bit++)
+			{
+				if (operand & (1 << bit))
+				{
+					count++;
+					below += (bit >= 2);
+				}
+			}
+
+			if (operand & 0x0002)
+			{
+				rule.a6Saved = true;
+				rule.a6Offset = -pushed - (4 * count) + (4 * below) - 4;
+			}
+
+			pushed += 4 * count;
+			address += 4;
+		}
+		// MOVE.L Rn,-(SP)
+		else if ((opcode & 0xFFF0) == 0x2F00)
+		{
+			if (opcode == 0x2F0E)
+			{
+				rule.a6Saved = true;
+				rule.a6Offset = -pushed - 8;
+			}
+
+			pushed += 4;
+			address += 2;
+		}
+		// SUBQ.W/SUBQ.L #n,SP
+		else if (((opcode & 0xF1FF) == 0x514F) || ((opcode & 0xF1FF) == 0x518F))
+		{
+			pushed += (((opcode >> 9) & 7) ? ((opcode >> 9) & 7) : 8);
+			address += 2;
+		}
+		// LEA d16(SP),SP
+		else if (opcode == 0x4FEF)
+		{
+			pushed -= (int16_t)operand;
+			address += 4;
+		}
+		// SUBA.W/ADDA.W #imm,SP
+		else if ((opcode == 0x9EFC) || (opcode == 0xDEFC))
+		{
+			pushed += ((opcode == 0x9EFC) ? (int16_t)operand : -(int16_t)operand);
+			address += 4;
+		}
+		// SUBA.L/ADDA.L #imm,SP
+		else if (((opcode == 0x9FFC) || (opcode == 0xDFFC)) && UnwindReadCode(address + 4, operand2))
+		{
+			pushed += (int32_t)((opcode == 0x9FFC) ? ((operand << 16) | operand2) : (0 - ((operand << 16) | operand2)));
+			address += 6;
+		}
+		// End of the prologue, the body can have pushed more
+		else
+		{
+			rule.scan = true;
+			break;
+		}
+	}
+
+	rule.cfaOffset = pushed + 4;
+	return (pushed >= 0);
+}
+
+
+//
+// The code of a rule has not been written since the rule has been found
+//
+static bool UnwindRuleValid(const UnwindRule & rule, uint32_t pc)
+{
+	if (rule.epoch)
+	{
+		for (uint32_t page = (rule.start >> MEMORY_PAGE_SHIFT); page <= (pc >> MEMORY_PAGE_SHIFT); page++)
+		{
+			if (memoryPageEpoch[page] >= rule.epoch)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//
+// Cached rule of a PC, the caller frames are looked up at the call (return address - 1)
+//
+static const UnwindRule & UnwindGetRule(uint32_t pc, bool caller)
+{
+	uint32_t key = pc | (caller ? 1 : 0);
+	std::unordered_map<uint32_t, UnwindRule>::iterator it = unwindRules.find(key);
+
+	if ((it != unwindRules.end()) && UnwindRuleValid(it->second, pc))
+	{
+		return it->second;
+	}
+
+	if (unwindRules.size() >= UNWIND_RULES_MAX)
+	{
+		unwindRules.clear();
+	}
+
+	UnwindRule & rule = unwindRules[key];
+
+	if (!UnwindRuleFromCFI(pc - (caller ? 1 : 0), rule))
+	{
+		// A new epoch, the later writes to the function invalidate the rule
+		rule.epoch = MemoryNewEpoch();
+
+		if (!UnwindRuleFromPrologue(pc, rule))
+		{
+			rule.method = UNWIND_FRAMEPOINTER;
+			rule.start = (pc > UNWIND_SCAN_MAX) ? (pc - UNWIND_SCAN_MAX) : 0;
+		}
+	}
+
+	return rule;
+}
+
+
+//
+// Apply a rule, false without a plausible caller
+//
+static bool UnwindApply(const UnwindRule & rule, uint32_t sp, uint32_t a6, UnwindFrame & frame, uint32_t & callerA6)
+{
+	uint32_t cfa, limit;
+
+	if (rule.method == UNWIND_FRAMEPOINTER)
+	{
+		if (!a6 || (a6 < sp) || !UnwindReadStack(a6 + 4, frame.returnAddress) || !UnwindReadStack(a6, callerA6))
+		{
+			return false;
+		}
+
+		frame.cfa = a6 + 8;
+		return ((frame.returnAddress < vjs.DRAM_size) || ((frame.returnAddress >= 0x800000) && (frame.returnAddress < 0xE20000)));
+	}
+
+	cfa = ((rule.cfaReg == UNWIND_REG_A6) ? a6 : sp) + rule.cfaOffset;
+
+	if (rule.scan)
+	{
+		for (limit = cfa + UNWIND_STACK_SCAN; (cfa < limit) && UnwindReadStack(cfa + rule.raOffset, frame.returnAddress) && !UnwindPlausibleReturn(frame.returnAddress); cfa += 2);
+
+		if (cfa >= limit)
+		{
+			return false;
+		}
+	}
+
+	if ((cfa <= sp) || !UnwindReadStack(cfa + rule.raOffset, frame.returnAddress) || (rule.a6Saved && !UnwindReadStack(cfa + rule.a6Offset, callerA6)))
+	{
+		return false;
+	}
+
+	if (!rule.a6Saved)
+	{
+		callerA6 = a6;
+	}
+
+	frame.cfa = cfa;
+	return ((rule.method == UNWIND_CFI) ? !(frame.returnAddress & 1) : UnwindPlausibleReturn(frame.returnAddress));
+}
+
+
+//
+// Unwind the M68K call stack from the current registers
+// The first frame is the current function, return the number of frames
+//
+uint32_t UnwindStack(UnwindFrame * frames, uint32_t max)
+{
+	UnwindRule framePointer = {};
+	uint32_t pc = m68k_get_reg(NULL, M68K_REG_PC), sp = m68k_get_reg(NULL, M68K_REG_SP), a6 = m68k_get_reg(NULL, M68K_REG_A6);
+	uint32_t count = 0, callerA6;
+	framePointer.method = UNWIND_FRAMEPOINTER;
+
+	while ((count < max) && pc)
+	{
+		const UnwindRule & rule = UnwindGetRule(pc, (count != 0));
+		UnwindFrame & frame = frames[count];
+		frame.pc = pc;
+		frame.method = rule.method;
+
+		if (!UnwindApply(rule, sp, a6, frame, callerA6))
+		{
+			if ((rule.method == UNWIND_FRAMEPOINTER) || !UnwindApply(framePointer, sp, a6, frame, callerA6))
+			{
+				break;
+			}
+
+			frame.method = UNWIND_FRAMEPOINTER;
+		}
+
+		count++;
+		pc = frame.returnAddress;
+		sp = frame.cfa;
+		a6 = callerA6;
+	}
+
+	return count;
+}
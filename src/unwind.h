@@ -0,0 +1,33 @@
+//
+// unwind.h: Header file
+//
+// M68K call stack unwinder, from the DWARF call frame information or from the
+// functions prologues, with the rules cached per PC
+//
+
+#ifndef __UNWIND_H__
+#define __UNWIND_H__
+
+#include <stdint.h>
+
+#define UNWIND_FRAMES_MAX	64
+
+// How a frame has been unwound
+// UNWIND_CFI             DWARF call frame information (.debug_frame)
+// UNWIND_PROLOGUE        function prologue found back from the PC
+// UNWIND_FRAMEPOINTER    A6 frames chain
+enum { UNWIND_CFI = 0, UNWIND_PROLOGUE, UNWIND_FRAMEPOINTER };
+
+struct UnwindFrame
+{
+	uint32_t pc;								// PC in the function
+	uint32_t cfa;								// SP before the call (the return address is just below)
+	uint32_t returnAddress;
+	uint32_t method;
+};
+
+extern void UnwindReset(void);
+extern bool UnwindSetFrameInfo(const uint8_t * section, uint32_t size);
+extern uint32_t UnwindStack(UnwindFrame * frames, uint32_t max);
+
+#endif	// __UNWIND_H__
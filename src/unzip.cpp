@@ -2,135 +2,478 @@
 // ZIP file support
 // This is here to simplify interfacing to zlib, as zlib does NO zip file handling
 //
+// The archive is mapped once in memory, the members are indexed from the
+// central directory (found with the end of central directory record), and a
+// member is inflated straight from the mapping into the destination buffer.
+// A closed archive stays mapped in a cache, so the archive opened by the file
+// scanner is not mapped & indexed again when its software is loaded.
+//
 // by James Hammons
 // (C) 2012 Underground Software
 //
 // JLH = James Hammons <jlhamm@acm.org>
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
 //
 // Who  When        What
 // ---  ----------  -------------------------------------------------------------
 // JLH  01/16/2010  Created this log ;-)
 // JLH  02/28/2010  Removed unnecessary cruft
 // JLH  05/31/2012  Rewrote everything and removed all MAME code
+// JPM   Oct./2026  Archive mapped once and indexed from the central directory
+// JPM   Oct./2026  Closed archives kept in a cache
 //
 
 #include "unzip.h"
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <zlib.h>
+#include <mutex>
+#include <vector>
 #include "log.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define ZIP_LOCAL_HEADER_SIGNATURE		0x04034B50
+#define ZIP_LOCAL_HEADER_SIZE			30
+#define ZIP_CENTRAL_HEADER_SIGNATURE	0x02014B50
+#define ZIP_CENTRAL_HEADER_SIZE			46
+#define ZIP_END_SIGNATURE				0x06054B50
+#define ZIP_END_SIZE					22
+#define ZIP_COMMENT_MAX_SIZE			0xFFFF
+
+#define ZIP_METHOD_STORED				0
+#define ZIP_METHOD_DEFLATED				8
+
+// Mapped size of the closed archives kept in the cache
+#define ZIP_CACHE_MAX_SIZE				(256 * 1024 * 1024)
+
+// Archives cache, shared by the file scanner thread & the software loading
+static std::mutex zipCacheMutex;
+static std::vector<ZipArchive *> zipCache;
+static uint64_t zipCacheUse = 0;
 
-uint32_t GetLong(FILE * fp)
+
+static uint32_t GetLong(const uint8_t * p)
 {
-	uint32_t n = ((uint32_t)fgetc(fp));
-	n |= ((uint32_t)fgetc(fp)) << 8;
-	n |= ((uint32_t)fgetc(fp)) << 16;
-	n |= ((uint32_t)fgetc(fp)) << 24;
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
 
-	return n;
+static uint16_t GetWord(const uint8_t * p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
 }
 
 
-uint16_t GetWord(FILE * fp)
+//
+// Map the archive file in memory
+//
+static bool ZIPMap(ZipArchive * zip, const char * path)
 {
-	uint16_t n = ((uint16_t)fgetc(fp));
-	n |= ((uint16_t)fgetc(fp)) << 8;
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(file, &size) || !size.QuadPart || (size.QuadPart > 0xFFFFFFFF))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	void * data = (mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL);
 
-	return n;
+	if (!data)
+	{
+		if (mapping)
+			CloseHandle(mapping);
+
+		CloseHandle(file);
+		return false;
+	}
+
+	zip->data = (uint8_t *)data;
+	zip->size = (uint32_t)size.QuadPart;
+	zip->fileHandle = file;
+	zip->mappingHandle = mapping;
+	return true;
+#else
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+
+	if ((fstat(fd, &st) != 0) || !st.st_size || ((uint64_t)st.st_size > 0xFFFFFFFF))
+	{
+		close(fd);
+		return false;
+	}
+
+	zip->size = (uint32_t)st.st_size;
+	void * data = mmap(NULL, zip->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (data != MAP_FAILED)
+	{
+		zip->data = (uint8_t *)data;
+		zip->mapped = true;
+	}
+	else
+	{
+		// File systems without mapping support, read the file instead
+		zip->data = (uint8_t *)malloc(zip->size);
+
+		if (zip->data && (pread(fd, zip->data, zip->size, 0) != (ssize_t)zip->size))
+		{
+			free(zip->data);
+			zip->data = NULL;
+		}
+	}
+
+	close(fd);
+	return (zip->data != NULL);
+#endif
 }
 
 
-bool GetZIPHeader(FILE * fp, ZipFileEntry & ze)
+static void ZIPUnmap(ZipArchive * zip)
 {
-	ze.signature = GetLong(fp);
-	ze.version = GetWord(fp);
-	ze.flags = GetWord(fp);
-	ze.method = GetWord(fp);
-	ze.modifiedTime = GetWord(fp);
-	ze.modifiedDate = GetWord(fp);
-	ze.crc32 = GetLong(fp);
-	ze.compressedSize = GetLong(fp);
-	ze.uncompressedSize = GetLong(fp);
-	ze.filenameLength = GetWord(fp);
-	ze.extraLength = GetWord(fp);
-
-	// This handling is really ungraceful; but if someone is going to feed us
-	// shit, then why eat it? :-)
-	if (ze.filenameLength < 512)
-	{
-		fread(ze.filename, 1, ze.filenameLength, fp);
-		ze.filename[ze.filenameLength] = 0;
-	}
+	if (!zip->data)
+		return;
+
+#if defined(_WIN32)
+	UnmapViewOfFile(zip->data);
+	CloseHandle(zip->mappingHandle);
+	CloseHandle(zip->fileHandle);
+#else
+	if (zip->mapped)
+		munmap(zip->data, zip->size);
 	else
+		free(zip->data);
+#endif
+	zip->data = NULL;
+}
+
+
+//
+// Index the members from the central directory
+//
+static bool ZIPReadDirectory(ZipArchive * zip)
+{
+	// The end of central directory record is followed by the archive comment
+	uint32_t lowest = (zip->size > (ZIP_END_SIZE + ZIP_COMMENT_MAX_SIZE) ? zip->size - (ZIP_END_SIZE + ZIP_COMMENT_MAX_SIZE) : 0);
+	const uint8_t * end = NULL;
+
+	for(uint32_t offset=zip->size-ZIP_END_SIZE; (zip->size >= ZIP_END_SIZE) && (offset >= lowest); offset--)
+	{
+		if (GetLong(zip->data + offset) == ZIP_END_SIGNATURE)
+		{
+			end = zip->data + offset;
+			break;
+		}
+
+		if (offset == 0)
+			break;
+	}
+
+	if (!end)
+	{
+		WriteLog("UNZIP: No end of central directory record found\n");
+		return false;
+	}
+
+	uint32_t count = GetWord(end + 10);
+	uint32_t directorySize = GetLong(end + 12);
+	uint32_t directoryOffset = GetLong(end + 16);
+
+	// ZIP64 archives have their values set to the maximum, and cannot hold a Jaguar software anyway
+	if ((directoryOffset > zip->size) || (directorySize > (zip->size - directoryOffset)))
 	{
-		fseek(fp, ze.filenameLength, SEEK_CUR);
-		ze.filename[0] = 0;
+		WriteLog("UNZIP: Central directory out of the file (ZIP64 archives are not supported)\n");
+		return false;
 	}
 
-	// Skip the "extra" header
-	fseek(fp, ze.extraLength, SEEK_CUR);
+	zip->entry = (ZipFileEntry *)calloc(count ? count : 1, sizeof(ZipFileEntry));
 
-	return (ze.signature == 0x04034B50 ? true : false);
+	if (!zip->entry)
+		return false;
+
+	const uint8_t * p = zip->data + directoryOffset;
+	const uint8_t * directoryEnd = p + directorySize;
+
+	for(zip->count=0; zip->count<count; zip->count++)
+	{
+		ZipFileEntry & ze = zip->entry[zip->count];
+
+		if (((p + ZIP_CENTRAL_HEADER_SIZE) > directoryEnd) || (GetLong(p) != ZIP_CENTRAL_HEADER_SIGNATURE))
+			break;
+
+		ze.signature = GetLong(p);
+		ze.version = GetWord(p + 6);
+		ze.flags = GetWord(p + 8);
+		ze.method = GetWord(p + 10);
+		ze.modifiedTime = GetWord(p + 12);
+		ze.modifiedDate = GetWord(p + 14);
+		ze.crc32 = GetLong(p + 16);
+		ze.compressedSize = GetLong(p + 20);
+		ze.uncompressedSize = GetLong(p + 24);
+		ze.filenameLength = GetWord(p + 28);
+		ze.extraLength = GetWord(p + 30);
+		ze.localHeaderOffset = GetLong(p + 42);
+		uint32_t commentLength = GetWord(p + 32);
+		const uint8_t * name = p + ZIP_CENTRAL_HEADER_SIZE;
+		p = name + ze.filenameLength + ze.extraLength + commentLength;
+
+		if (p > directoryEnd)
+			break;
+
+		// Names too long are kept empty, so they cannot match anything
+		if (ze.filenameLength < sizeof(ze.filename))
+		{
+			memcpy(ze.filename, name, ze.filenameLength);
+			ze.filename[ze.filenameLength] = 0;
+		}
+	}
+
+	if (zip->count != count)
+		WriteLog("UNZIP: Central directory truncated, %u of %u members indexed\n", zip->count, count);
+
+	return true;
+}
+
+
+static void ZIPFree(ZipArchive * zip)
+{
+	ZIPUnmap(zip);
+	free(zip->entry);
+	free(zip->path);
+	free(zip);
 }
 
 
 //
-// Uncompress a file from a ZIP file filestream
-// NOTE: The passed in buffer *must* be fully allocated before calling this!
+// Remove an archive from the cache, it is freed once no more opened
+// Must be called with the cache locked
 //
-#define CHUNKSIZE 16384
-int UncompressFileFromZIP(FILE * fp, ZipFileEntry ze, uint8_t * buffer)
+static void ZIPCacheRemove(uint32_t index)
 {
-	z_stream zip;
-	unsigned char inBuffer[CHUNKSIZE];
-	uint32_t remaining = ze.compressedSize;
+	ZipArchive * zip = zipCache[index];
+	zipCache.erase(zipCache.begin() + index);
+	zip->cached = false;
 
-	// Set up z_stream for inflating
-	zip.zalloc = Z_NULL;
-	zip.zfree = Z_NULL;
-	zip.opaque = Z_NULL;
-	zip.avail_in = 0;
-	zip.next_in = Z_NULL;
+	if (!zip->refs)
+		ZIPFree(zip);
+}
 
-	int ret = inflateInit2(&zip, -MAX_WBITS);	// -MAX_WBITS tells it there's no header
 
-	// Bail if can't initialize the z_stream...
-	if (ret != Z_OK)
-		return ret;
+//
+// Free the least recently used closed archives, over the cache size
+// Must be called with the cache locked
+//
+static void ZIPCacheTrim(void)
+{
+	uint64_t size = 0;
 
-	zip.avail_out = ze.uncompressedSize;
-	zip.next_out = buffer;
+	for(uint32_t i=0; i<zipCache.size(); i++)
+		size += zipCache[i]->size;
 
-	// Decompress until deflate stream ends or we hit end of file
-	do
+	while (size > ZIP_CACHE_MAX_SIZE)
 	{
-		zip.avail_in = fread(inBuffer, 1, (remaining < CHUNKSIZE ? remaining : CHUNKSIZE), fp);
-		zip.next_in = inBuffer;
-		remaining -= CHUNKSIZE;
+		int32_t oldest = -1;
 
-		if (ferror(fp))
+		for(uint32_t i=0; i<zipCache.size(); i++)
 		{
-			inflateEnd(&zip);
-			return Z_ERRNO;
+			if (!zipCache[i]->refs && ((oldest < 0) || (zipCache[i]->lastUse < zipCache[oldest]->lastUse)))
+				oldest = i;
 		}
 
-		if (zip.avail_in == 0)
+		// The archives still opened are over the cache size on their own
+		if (oldest < 0)
 			break;
 
-		ret = inflate(&zip, Z_NO_FLUSH);
+		size -= zipCache[oldest]->size;
+		ZIPCacheRemove(oldest);
+	}
+}
+
 
-		if ((ret == Z_NEED_DICT) || (ret == Z_DATA_ERROR) || (ret == Z_MEM_ERROR))
+//
+// Open & index an archive, or take it from the cache if the file has not changed
+// Returns NULL if it cannot be opened or is not a ZIP file
+//
+ZipArchive * ZIPOpen(const char * path)
+{
+	struct stat st;
+
+	if (stat(path, &st) != 0)
+	{
+		WriteLog("UNZIP: Could not open file '%s'!\n", path);
+		return NULL;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(zipCacheMutex);
+
+		for(uint32_t i=0; i<zipCache.size(); i++)
 		{
-			inflateEnd(&zip);
-			return ret;
+			ZipArchive * zip = zipCache[i];
+
+			if (strcmp(zip->path, path) != 0)
+				continue;
+
+			if ((zip->modified == (int64_t)st.st_mtime) && ((uint64_t)zip->size == (uint64_t)st.st_size))
+			{
+				zip->refs++;
+				zip->lastUse = ++zipCacheUse;
+				return zip;
+			}
+
+			// The file has been changed since
+			ZIPCacheRemove(i);
+			break;
 		}
+	}
+
+	ZipArchive * zip = (ZipArchive *)calloc(1, sizeof(ZipArchive));
 
+	if (!zip)
+		return NULL;
+
+	if (!ZIPMap(zip, path))
+	{
+		WriteLog("UNZIP: Could not open file '%s'!\n", path);
+		free(zip);
+		return NULL;
+	}
+
+	if (!ZIPReadDirectory(zip) || !(zip->path = strdup(path)))
+	{
+		WriteLog("UNZIP: '%s' is not a valid ZIP file\n", path);
+		ZIPFree(zip);
+		return NULL;
 	}
-	while (ret != Z_STREAM_END);
 
-	inflateEnd(&zip);
+	zip->modified = (int64_t)st.st_mtime;
+	zip->refs = 1;
+
+	std::lock_guard<std::mutex> lock(zipCacheMutex);
+	zip->lastUse = ++zipCacheUse;
+	zip->cached = true;
+	zipCache.push_back(zip);
+	return zip;
+}
+
+
+//
+// Close an archive, it stays mapped in the cache
+//
+void ZIPClose(ZipArchive * zip)
+{
+	if (!zip)
+		return;
+
+	std::lock_guard<std::mutex> lock(zipCacheMutex);
+	zip->refs--;
+
+	if (!zip->cached)
+	{
+		if (!zip->refs)
+			ZIPFree(zip);
+	}
+	else
+		ZIPCacheTrim();
+}
+
+
+//
+// Free the closed archives kept in the cache
+//
+void ZIPFlushCache(void)
+{
+	std::lock_guard<std::mutex> lock(zipCacheMutex);
+
+	for(uint32_t i=zipCache.size(); i>0; i--)
+	{
+		if (!zipCache[i - 1]->refs)
+			ZIPCacheRemove(i - 1);
+	}
+}
+
+
+//
+// Uncompress a member of an archive
+// The member is inflated straight from the archive mapping into the buffer,
+// which must be able to hold the member uncompressed size
+//
+int UncompressFileFromZIP(ZipArchive * zip, uint32_t index, uint8_t * buffer, uint32_t bufferSize)
+{
+	if (index >= zip->count)
+		return Z_STREAM_ERROR;
+
+	ZipFileEntry & ze = zip->entry[index];
+
+	if (ze.uncompressedSize > bufferSize)
+		return Z_BUF_ERROR;
+
+	// The local header may have other name & extra fields lengths than the central directory
+	uint32_t offset = ze.localHeaderOffset;
+
+	if ((offset > zip->size) || ((zip->size - offset) < ZIP_LOCAL_HEADER_SIZE) || (GetLong(zip->data + offset) != ZIP_LOCAL_HEADER_SIGNATURE))
+		return Z_DATA_ERROR;
+
+	offset += ZIP_LOCAL_HEADER_SIZE + GetWord(zip->data + offset + 26) + GetWord(zip->data + offset + 28);
+
+	if ((offset > zip->size) || (ze.compressedSize > (zip->size - offset)))
+		return Z_DATA_ERROR;
+
+	if (ze.method == ZIP_METHOD_STORED)
+	{
+		if (ze.compressedSize != ze.uncompressedSize)
+			return Z_DATA_ERROR;
+
+		memcpy(buffer, zip->data + offset, ze.uncompressedSize);
+		return Z_OK;
+	}
+
+	if (ze.method != ZIP_METHOD_DEFLATED)
+		return Z_DATA_ERROR;
+
+	z_stream stream;
+
+	// Set up z_stream for inflating
+	stream.zalloc = Z_NULL;
+	stream.zfree = Z_NULL;
+	stream.opaque = Z_NULL;
+	stream.avail_in = 0;
+	stream.next_in = Z_NULL;
+
+	int ret = inflateInit2(&stream, -MAX_WBITS);	// -MAX_WBITS tells it there's no header
+
+	// Bail if can't initialize the z_stream...
+	if (ret != Z_OK)
+		return ret;
+
+	// The whole member is available, so it is inflated in one call
+	stream.next_in = (Bytef *)(zip->data + offset);
+	stream.avail_in = ze.compressedSize;
+	stream.next_out = buffer;
+	stream.avail_out = ze.uncompressedSize;
+	ret = inflate(&stream, Z_FINISH);
+	inflateEnd(&stream);
 
-	return (ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR);
+	return (((ret == Z_STREAM_END) && (stream.total_out == ze.uncompressedSize)) ? Z_OK : Z_DATA_ERROR);
 }
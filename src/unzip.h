@@ -1,3 +1,16 @@
+//
+// unzip.h: Header file
+//
+// ZIP file support
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Archive mapped once and indexed from the central directory
+// JPM   Oct./2026  Closed archives kept in a cache
+//
+
 #ifndef __UNZIP_H__
 #define __UNZIP_H__
 
@@ -17,10 +30,33 @@ struct ZipFileEntry
 	uint32_t uncompressedSize;
 	uint16_t filenameLength;
 	uint16_t extraLength;
+	uint32_t localHeaderOffset;
 	uint8_t filename[512];
 };
 
-extern bool GetZIPHeader(FILE *, ZipFileEntry &);
-extern int UncompressFileFromZIP(FILE *, ZipFileEntry, uint8_t *);
+// Archive mapped in memory, with the members from the central directory
+struct ZipArchive
+{
+	uint8_t * data;
+	uint32_t size;
+	uint32_t count;
+	ZipFileEntry * entry;
+#if defined(_WIN32)
+	void * fileHandle;
+	void * mappingHandle;
+#else
+	bool mapped;						// false if the file has been read in an allocated buffer
+#endif
+	char * path;
+	int64_t modified;					// File time, checked with the size before reusing the archive
+	uint32_t refs;						// ZIPOpen not yet closed
+	uint64_t lastUse;
+	bool cached;
+};
+
+extern ZipArchive * ZIPOpen(const char * path);
+extern void ZIPClose(ZipArchive * zip);
+extern void ZIPFlushCache(void);
+extern int UncompressFileFromZIP(ZipArchive * zip, uint32_t index, uint8_t * buffer, uint32_t bufferSize);
 
 #endif	// __UNZIP_H__
@@ -0,0 +1,1133 @@
+//
+// Offline disassembler & binary inspector
+//
+// The software (ROM, ABS, COFF or ELF) is loaded by the emulator file loading,
+// without being run, and disassembled by the 68K & RISC decoders of the
+// debugger. By default the code is followed from the run address, and from the
+// entry points given: the 68K branches & calls, the 68K exception vectors and
+// GPU/DSP program counter writes, and the GPU/DSP code uploads. An upload is
+// guessed from an address pair loaded by the 68K close together, one address
+// in the loaded software and the other in the GPU or DSP local RAM; the RISC
+// code is then read from the software, at the addresses it will run from, and
+// the MOVEI constants give the JUMP targets. Address ranges, or the whole
+// loaded software, can be disassembled linearly instead.
+//
+// The code blocks, and the chunks of the ranges, go through a work queue run
+// by a pool of threads. The ELF/DWARF symbols & the hardware register names
+// are added when the listing is written, in text or in JSON.
+//
+//     vjdis [options] <file>
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "file.h"
+#include "hosttuning.h"
+#include "jagdasm.h"
+#include "jaguar.h"
+#include "log.h"
+#include "memory.h"
+#include "modelsBIOS.h"
+#include "settings.h"
+#include "debugger/DBGManager.h"
+#include "m68000/m68kinterface.h"
+
+// Processors
+enum { DASM_68K = 0, DASM_GPU, DASM_DSP, DASM_END };
+
+#define DASM_GPU_RAM			0xF03000
+#define DASM_GPU_RAM_END		0xF04000
+#define DASM_DSP_RAM			0xF1B000
+#define DASM_DSP_RAM_END		0xF1D000
+#define DASM_G_PC				0xF02110
+#define DASM_D_PC				0xF1A110
+#define DASM_VECTORS_END		0x400
+#define DASM_ROM_END			0xE00000
+#define DASM_CONST_WINDOW		8				// Instructions apart of an upload address pair
+#define DASM_CHUNK_SIZE			0x4000			// Ranges split in chunks for the workers
+#define DASM_TEXT_MAX			128
+
+struct DasmLine
+{
+	uint32_t address;							// Run address
+	int32_t offset;								// Source address - run address
+	uint32_t size;
+	uint8_t cpu;
+	char text[DASM_TEXT_MAX];
+};
+
+struct DasmWork
+{
+	uint8_t cpu;
+	bool linear;								// Range chunk, else code block to follow
+	uint32_t address;
+	uint32_t end;								// Chunk end
+	int32_t offset;
+	uint32_t chunk;								// Chunk index
+};
+
+struct DasmUpload
+{
+	uint8_t cpu;
+	uint32_t run;
+	uint32_t source;
+	uint32_t site;								// 68K instruction loading the second address
+};
+
+struct DasmEntry
+{
+	uint8_t cpu;
+	uint32_t address;
+};
+
+struct DasmRange
+{
+	uint8_t cpu;
+	uint32_t start, end;
+};
+
+struct DasmConst
+{
+	uint32_t value;
+	uint32_t index;								// Instruction index in the block
+};
+
+VJSettings vjs;
+
+static const char * dasmCPUName[DASM_END] = { "68K", "GPU", "DSP" };
+
+// Work queue
+static std::deque<DasmWork> dasmWork;
+static std::mutex dasmMutex;
+static std::condition_variable dasmCondition;
+static uint32_t dasmBusy;
+
+// Results, under the work queue mutex for the code followed
+static std::map<uint64_t, DasmLine> dasmCode;
+static std::vector<DasmUpload> dasmUploads;
+static std::vector<DasmEntry> dasmEntries;		// GPU & DSP program counters written by the 68K
+static std::vector< std::vector<DasmLine> > dasmChunks;
+
+
+//
+// Code memory reads, without side effect
+//
+static uint16_t DasmRead16(uint32_t address)
+{
+	return JaguarReadWord(address & 0xFFFFFF, UNKNOWN);
+}
+
+
+static uint32_t DasmRead32(uint32_t address)
+{
+	return ((uint32_t)DasmRead16(address) << 16) | DasmRead16(address + 2);
+}
+
+
+//
+// Processor of a GPU or DSP local RAM address, DASM_END if none
+//
+static uint8_t DasmLocalRAM(uint32_t address)
+{
+	if ((address >= DASM_GPU_RAM) && (address < DASM_GPU_RAM_END))
+	{
+		return DASM_GPU;
+	}
+
+	if ((address >= DASM_DSP_RAM) && (address < DASM_DSP_RAM_END))
+	{
+		return DASM_DSP;
+	}
+
+	return DASM_END;
+}
+
+
+//
+// Address in the loaded software, the local RAM excepted
+//
+static bool DasmInSoftware(uint32_t address)
+{
+	return (address < DASM_ROM_END) && (address >= jaguarLoadAddress) && ((address - jaguarLoadAddress) < jaguarLoadSize);
+}
+
+
+//
+// Code can be read from the address, for the processor
+//
+static bool DasmValid(uint8_t cpu, uint32_t address, int32_t offset)
+{
+	uint32_t source = address + offset;
+
+	if ((address & 0x01) || (source >= DASM_ROM_END) || ((source >= vjs.DRAM_size) && (source < 0x800000)))
+	{
+		return false;
+	}
+
+	// Code uploaded to the local RAM stays in it; the RISC may also run from the main memory
+	return ((cpu == DASM_68K) || !offset || (DasmLocalRAM(address) == cpu));
+}
+
+
+//
+// Instruction text cut at the end of the line, the cut is shown
+//
+static void DasmCheckText(DasmLine & line, int length)
+{
+	if (length >= DASM_TEXT_MAX)
+	{
+		strcpy(&line.text[DASM_TEXT_MAX - 4], "...");
+	}
+}
+
+
+//
+// Decode an instruction
+//
+static void DasmDecode(uint8_t cpu, uint32_t address, int32_t offset, DasmLine & line)
+{
+	char buffer[512];
+
+	line.cpu = cpu;
+	line.address = address;
+	line.offset = offset;
+
+	if (cpu == DASM_68K)
+	{
+		line.size = m68k_disassemble(buffer, address, 0, 0);
+
+		// Mnemonic aligned like the RISC ones, and without the condition result of the live CPU
+		char * operands = strchr(buffer, '\t');
+		char * result = strstr(buffer, " (true)");
+
+		if (!result)
+		{
+			result = strstr(buffer, " (false)");
+		}
+
+		if (result)
+		{
+			*result = 0;
+		}
+
+		if (operands)
+		{
+			*operands++ = 0;
+			DasmCheckText(line, snprintf(line.text, DASM_TEXT_MAX, "%-8s%s", buffer, operands));
+		}
+		else
+		{
+			DasmCheckText(line, snprintf(line.text, DASM_TEXT_MAX, "%s", buffer));
+		}
+
+		// The addresses computed from the live registers are dropped, the PC relative ones are kept
+		for (char * equal = strstr(line.text, " == $"); equal; equal = strstr(equal, " == $"))
+		{
+			char * pc = NULL, * end;
+
+			for (char * p = line.text; (p = strstr(p, "(PC, $")) && (p < equal); pc = p++);
+
+			strtoul(equal + 5, &end, 16);
+
+			if (pc && (equal[-1] == ')') && ((size_t)((equal - 1) - (pc + 6)) == strspn(pc + 6, "0123456789ABCDEF")))
+			{
+				equal = end;
+			}
+			else
+			{
+				memmove(equal, end, strlen(end) + 1);
+			}
+		}
+	}
+	else
+	{
+		// The opcode words come first
+		line.size = dasmjag(((cpu == DASM_GPU) ? JAGUAR_GPU : JAGUAR_DSP), buffer, address, offset);
+		DasmCheckText(line, snprintf(line.text, DASM_TEXT_MAX, "%s", buffer + 16));
+	}
+
+	for (size_t i = strlen(line.text); i && (line.text[i - 1] == ' '); line.text[--i] = 0);
+}
+
+
+//
+// Work queue
+//
+static void DasmPush(const DasmWork & work)
+{
+	std::lock_guard<std::mutex> lock(dasmMutex);
+	dasmWork.push_back(work);
+	dasmCondition.notify_one();
+}
+
+
+static bool DasmPop(DasmWork & work)
+{
+	std::unique_lock<std::mutex> lock(dasmMutex);
+	dasmCondition.wait(lock, [] { return !dasmWork.empty() || !dasmBusy; });
+
+	if (dasmWork.empty())
+	{
+		return false;
+	}
+
+	work = dasmWork.front();
+	dasmWork.pop_front();
+	dasmBusy++;
+	return true;
+}
+
+
+static void DasmDone(void)
+{
+	std::lock_guard<std::mutex> lock(dasmMutex);
+
+	if (!--dasmBusy && dasmWork.empty())
+	{
+		dasmCondition.notify_all();
+	}
+}
+
+
+//
+// Code block to follow
+//
+static void DasmPushBlock(uint8_t cpu, uint32_t address, int32_t offset)
+{
+	if (DasmValid(cpu, address, offset))
+	{
+		DasmWork work = { cpu, false, address, 0, offset, 0 };
+		DasmPush(work);
+	}
+}
+
+
+//
+// Keep a decoded instruction, false if it has been decoded already
+//
+static bool DasmAdd(const DasmLine & line)
+{
+	uint64_t key = ((uint64_t)line.cpu << 56) | ((uint64_t)(uint32_t)line.offset << 24) | (line.address & 0xFFFFFF);
+	std::lock_guard<std::mutex> lock(dasmMutex);
+	return dasmCode.insert(std::make_pair(key, line)).second;
+}
+
+
+//
+// GPU or DSP code upload, followed from its run address
+//
+static void DasmAddUpload(uint8_t cpu, uint32_t run, uint32_t source, uint32_t site)
+{
+	if ((run & 0x01) || (source & 0x01))
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(dasmMutex);
+
+		for (size_t i = 0; i < dasmUploads.size(); i++)
+		{
+			if ((dasmUploads[i].cpu == cpu) && (dasmUploads[i].run == run) && (dasmUploads[i].source == source))
+			{
+				// The lowest site is kept, whatever the workers order
+				dasmUploads[i].site = ((site < dasmUploads[i].site) ? site : dasmUploads[i].site);
+				return;
+			}
+		}
+
+		DasmUpload upload = { cpu, run, source, site };
+		dasmUploads.push_back(upload);
+	}
+
+	DasmPushBlock(cpu, run, (int32_t)(source - run));
+}
+
+
+//
+// Long written by the 68K at an absolute address: exception vector, or GPU/DSP program counter
+//
+static void DasmStore68K(uint32_t value, uint32_t destination)
+{
+	destination &= 0xFFFFFF;
+
+	if ((destination == DASM_G_PC) || (destination == DASM_D_PC))
+	{
+		DasmEntry entry = { (uint8_t)((destination == DASM_G_PC) ? DASM_GPU : DASM_DSP), value & 0xFFFFFF };
+		std::lock_guard<std::mutex> lock(dasmMutex);
+		dasmEntries.push_back(entry);
+	}
+	else if ((destination >= 8) && (destination < DASM_VECTORS_END) && !(destination & 0x03))
+	{
+		DasmPushBlock(DASM_68K, value & 0xFFFFFF, 0);
+	}
+}
+
+
+//
+// Address loaded by the 68K, paired with a recent one for an upload
+//
+static void DasmConst68K(DasmConst * consts, uint32_t & count, uint32_t value, uint32_t index, uint32_t site)
+{
+	value &= 0xFFFFFF;
+	uint8_t cpu = DasmLocalRAM(value);
+	bool software = DasmInSoftware(value);
+
+	if ((cpu == DASM_END) && !software)
+	{
+		return;
+	}
+
+	for (uint32_t i = count; i--; )
+	{
+		DasmConst & c = consts[i];
+
+		if ((index - c.index) > DASM_CONST_WINDOW)
+		{
+			break;
+		}
+
+		if ((cpu != DASM_END) && DasmInSoftware(c.value))
+		{
+			DasmAddUpload(cpu, value, c.value, site);
+		}
+		else if (software && (DasmLocalRAM(c.value) != DASM_END))
+		{
+			DasmAddUpload(DasmLocalRAM(c.value), c.value, value, site);
+		}
+	}
+
+	if (count == DASM_CONST_WINDOW)
+	{
+		memmove(consts, consts + 1, sizeof(DasmConst) * --count);
+	}
+
+	consts[count].value = value;
+	consts[count++].index = index;
+}
+
+
+//
+// Follow a 68K code block
+//
+static void DasmBlock68K(uint32_t address)
+{
+	DasmConst consts[DASM_CONST_WINDOW];
+	uint32_t count = 0;
+	DasmLine line;
+
+	for (uint32_t index = 0; DasmValid(DASM_68K, address, 0); index++, address += line.size)
+	{
+		DasmDecode(DASM_68K, address, 0, line);
+
+		if (!DasmAdd(line) || !line.size)
+		{
+			break;
+		}
+
+		uint16_t opcode = DasmRead16(address);
+
+		// Bcc, BRA & BSR
+		if ((opcode & 0xF000) == 0x6000)
+		{
+			int32_t displacement = (int8_t)(opcode & 0xFF);
+			displacement = (displacement ? displacement : (int16_t)DasmRead16(address + 2));
+			DasmPushBlock(DASM_68K, address + 2 + displacement, 0);
+
+			if ((opcode & 0xFF00) == 0x6000)
+			{
+				break;
+			}
+		}
+		// DBcc
+		else if ((opcode & 0xF0F8) == 0x50C8)
+		{
+			DasmPushBlock(DASM_68K, address + 2 + (int16_t)DasmRead16(address + 2), 0);
+		}
+		// JMP & JSR with an absolute or PC relative address
+		else if (((opcode & 0xFFC0) == 0x4EC0) || ((opcode & 0xFFC0) == 0x4E80))
+		{
+			switch (opcode & 0x3F)
+			{
+			case 0x38:
+				DasmPushBlock(DASM_68K, (int16_t)DasmRead16(address + 2) & 0xFFFFFF, 0);
+				break;
+
+			case 0x39:
+				DasmPushBlock(DASM_68K, DasmRead32(address + 2) & 0xFFFFFF, 0);
+				break;
+
+			case 0x3A:
+				DasmPushBlock(DASM_68K, address + 2 + (int16_t)DasmRead16(address + 2), 0);
+				break;
+			}
+
+			if ((opcode & 0xFFC0) == 0x4EC0)
+			{
+				break;
+			}
+		}
+		// RTS, RTE, RTR & ILLEGAL (the illegal opcodes are decoded as ILLEGAL)
+		else if ((opcode == 0x4E75) || (opcode == 0x4E73) || (opcode == 0x4E77) || !strncmp(line.text, "ILLEGAL", 7))
+		{
+			break;
+		}
+		// MOVE.L #imm,<ea>, to a register or to an absolute address
+		else if ((opcode & 0xF03F) == 0x203C)
+		{
+			uint32_t value = DasmRead32(address + 2);
+
+			if (!(opcode & 0x0180))
+			{
+				DasmConst68K(consts, count, value, index, address);
+			}
+			else if ((opcode & 0x0FC0) == 0x01C0)
+			{
+				DasmStore68K(value, (int16_t)DasmRead16(address + 6));
+			}
+			else if ((opcode & 0x0FC0) == 0x03C0)
+			{
+				DasmStore68K(value, DasmRead32(address + 6));
+			}
+		}
+		// LEA with an absolute or PC relative address
+		else if ((opcode & 0xF1FF) == 0x41F8)
+		{
+			DasmConst68K(consts, count, (int16_t)DasmRead16(address + 2), index, address);
+		}
+		else if ((opcode & 0xF1FF) == 0x41F9)
+		{
+			DasmConst68K(consts, count, DasmRead32(address + 2), index, address);
+		}
+		else if ((opcode & 0xF1FF) == 0x41FA)
+		{
+			DasmConst68K(consts, count, address + 2 + (int16_t)DasmRead16(address + 2), index, address);
+		}
+	}
+}
+
+
+//
+// Follow a GPU or DSP code block, the MOVEI constants give the JUMP targets
+//
+static void DasmBlockRISC(uint8_t cpu, uint32_t address, int32_t offset)
+{
+	uint32_t regs[32], known = 0;
+	bool last = false;
+	DasmLine line;
+
+	for (; DasmValid(cpu, address, offset); address += line.size)
+	{
+		DasmDecode(cpu, address, offset, line);
+
+		// The delay slot of a jump is the last instruction
+		if (!DasmAdd(line) || last)
+		{
+			break;
+		}
+
+		uint16_t opcode = DasmRead16(address + offset);
+		uint32_t reg1 = (opcode >> 5) & 0x1F, reg2 = opcode & 0x1F;
+
+		switch (opcode >> 10)
+		{
+		// MOVEI
+		case 38:
+			regs[reg2] = DasmRead16(address + offset + 2) | ((uint32_t)DasmRead16(address + offset + 4) << 16);
+			known |= (1 << reg2);
+			break;
+
+		// JUMP, the condition is in reg2
+		case 52:
+			if (known & (1 << reg1))
+			{
+				uint32_t target = regs[reg1] & 0xFFFFFF;
+				DasmPushBlock(cpu, target, ((DasmLocalRAM(target) == cpu) ? offset : 0));
+			}
+
+			last = !reg2;
+			break;
+
+		// JR
+		case 53:
+			if (reg2 != 31)
+			{
+				DasmPushBlock(cpu, address + 2 + ((int8_t)(reg1 << 3) >> 2), offset);
+			}
+
+			last = !reg2;
+			break;
+
+		// DSP illegal instruction
+		case 62:
+			if (cpu == DASM_DSP)
+			{
+				return;
+			}
+
+			known &= ~(1 << reg2);
+			break;
+
+		// No register written
+		case 13: case 30: case 31: case 36: case 45: case 46: case 47: case 48:
+		case 49: case 50: case 57: case 60: case 61:
+			break;
+
+		default:
+			known &= ~(1 << reg2);
+			break;
+		}
+	}
+}
+
+
+//
+// Decode a range chunk linearly, the last instruction may go over the chunk end
+//
+static void DasmChunk(const DasmWork & work)
+{
+	std::vector<DasmLine> & lines = dasmChunks[work.chunk];
+	DasmLine line;
+
+	for (uint32_t address = work.address; (address < work.end) && DasmValid(work.cpu, address, 0); address += line.size)
+	{
+		DasmDecode(work.cpu, address, 0, line);
+		lines.push_back(line);
+	}
+}
+
+
+//
+static void DasmWorker(void)
+{
+	DasmWork work;
+
+	while (DasmPop(work))
+	{
+		if (work.linear)
+		{
+			DasmChunk(work);
+		}
+		else if (work.cpu == DASM_68K)
+		{
+			DasmBlock68K(work.address);
+		}
+		else
+		{
+			DasmBlockRISC(work.cpu, work.address, work.offset);
+		}
+
+		DasmDone();
+	}
+}
+
+
+//
+// Run the work queue until it is empty
+//
+static void DasmRun(uint32_t threads)
+{
+	std::vector<std::thread> workers;
+
+	for (uint32_t i = 0; i < threads; i++)
+	{
+		workers.push_back(std::thread(DasmWorker));
+	}
+
+	for (uint32_t i = 0; i < threads; i++)
+	{
+		workers[i].join();
+	}
+}
+
+
+//
+// GPU & DSP program counters written by the 68K, read from the closest upload below them
+//
+static bool DasmResolveEntries(void)
+{
+	bool pushed = false;
+
+	for (size_t i = 0; i < dasmEntries.size(); i++)
+	{
+		DasmEntry & entry = dasmEntries[i];
+		uint32_t run = 0;
+
+		for (size_t j = 0; j < dasmUploads.size(); j++)
+		{
+			if ((dasmUploads[j].cpu == entry.cpu) && (dasmUploads[j].run <= entry.address) && (dasmUploads[j].run > run))
+			{
+				run = dasmUploads[j].run;
+			}
+		}
+
+		for (size_t j = 0; j < dasmUploads.size(); j++)
+		{
+			if ((dasmUploads[j].cpu == entry.cpu) && (dasmUploads[j].run == run) && run)
+			{
+				DasmPushBlock(entry.cpu, entry.address, (int32_t)(dasmUploads[j].source - run));
+				pushed = true;
+			}
+		}
+
+		// Code run from the main memory
+		if (!run && DasmInSoftware(entry.address))
+		{
+			DasmPushBlock(entry.cpu, entry.address, 0);
+			pushed = true;
+		}
+	}
+
+	dasmEntries.clear();
+	return pushed;
+}
+
+
+//
+// Disassemble the ranges linearly, the chunks out of step with the previous one are decoded again
+//
+static void DasmRanges(const std::vector<DasmRange> & ranges, uint32_t threads, std::vector<DasmLine> & listing)
+{
+	std::vector<DasmWork> chunks;
+
+	for (size_t i = 0; i < ranges.size(); i++)
+	{
+		for (uint32_t address = ranges[i].start; address < ranges[i].end; address += DASM_CHUNK_SIZE)
+		{
+			uint32_t end = (((ranges[i].end - address) > DASM_CHUNK_SIZE) ? (address + DASM_CHUNK_SIZE) : ranges[i].end);
+			DasmWork work = { ranges[i].cpu, true, address, end, 0, (uint32_t)chunks.size() };
+			chunks.push_back(work);
+		}
+	}
+
+	dasmChunks.resize(chunks.size());
+
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		dasmWork.push_back(chunks[i]);
+	}
+
+	DasmRun(threads);
+
+	uint32_t pc = 0;
+
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		std::vector<DasmLine> & lines = dasmChunks[i];
+		size_t j = 0;
+
+		// A range starts with its first chunk
+		if (!i || (chunks[i].address != chunks[i - 1].end) || (chunks[i].cpu != chunks[i - 1].cpu))
+		{
+			pc = chunks[i].address;
+		}
+
+		// Decoded again from the end of the previous chunk, until in step with this one
+		for (DasmLine line; ; pc += line.size)
+		{
+			for (; (j < lines.size()) && (lines[j].address < pc); j++);
+
+			if (((j < lines.size()) && (lines[j].address == pc)) || (pc >= chunks[i].end) || !DasmValid(chunks[i].cpu, pc, 0))
+			{
+				break;
+			}
+
+			DasmDecode(chunks[i].cpu, pc, 0, line);
+			listing.push_back(line);
+		}
+
+		for (; j < lines.size(); j++)
+		{
+			listing.push_back(lines[j]);
+			pc = lines[j].address + lines[j].size;
+		}
+	}
+}
+
+
+//
+// Symbols in an instruction text: the addresses are replaced, the immediates are commented
+//
+static void DasmAnnotate(const DasmLine & line, std::string & text, std::string & comment)
+{
+	bool risc = (line.cpu != DASM_68K);
+	bool addresses = (!risc || !strncmp(line.text, "JR", 2) || !strncmp(line.text, "MOVEI", 5));
+	bool immediate = false;
+	int depth = 0;
+
+	text.clear();
+	comment.clear();
+
+	for (const char * p = line.text; *p; )
+	{
+		switch (*p)
+		{
+		case '#':
+			immediate = true;
+			break;
+
+		case '(':
+			depth++;
+			break;
+
+		case ')':
+			depth--;
+			break;
+
+		case ',':
+		case '=':
+			immediate = (depth ? immediate : false);
+			break;
+		}
+
+		if ((*p != '$') || !addresses || depth)
+		{
+			text += *p++;
+			continue;
+		}
+
+		char * end;
+		uint32_t value = (uint32_t)strtoul(p + 1, &end, 16);
+		char * symbol = ((end != (p + 1)) ? DBGManager_GetSymbolNameFromAdr(value) : NULL);
+
+		if (symbol && !immediate)
+		{
+			text += symbol;
+		}
+		else
+		{
+			text.append(p, end - p);
+
+			if (symbol)
+			{
+				comment += (comment.empty() ? "" : ", ");
+				comment += symbol;
+			}
+		}
+
+		p = end;
+	}
+}
+
+
+//
+// Opcode words
+//
+static void DasmBytes(const DasmLine & line, char * buffer, const char * separator)
+{
+	buffer[0] = 0;
+
+	for (uint32_t i = 0; i < line.size; i += 2)
+	{
+		sprintf(buffer + strlen(buffer), "%s%04X", (i ? separator : ""), DasmRead16(line.address + line.offset + i));
+	}
+}
+
+
+//
+static void DasmWriteText(const char * filename, const std::vector<DasmLine> & listing)
+{
+	std::string text, comment;
+	char bytes[64];
+
+	printf("; %s\n", filename);
+	printf("; Run address $%06X, loaded at $%06X-$%06X\n", jaguarRunAddress, jaguarLoadAddress, jaguarLoadAddress + jaguarLoadSize - (jaguarLoadSize ? 1 : 0));
+
+	for (size_t i = 0; i < dasmUploads.size(); i++)
+	{
+		printf("; %s code uploaded to $%06X from $%06X, by the 68K at $%06X\n", dasmCPUName[dasmUploads[i].cpu], dasmUploads[i].run, dasmUploads[i].source, dasmUploads[i].site);
+	}
+
+	for (size_t i = 0; i < listing.size(); i++)
+	{
+		const DasmLine & line = listing[i];
+
+		if (!i || (line.cpu != listing[i - 1].cpu) || (line.offset != listing[i - 1].offset))
+		{
+			printf("\n; %s code", dasmCPUName[line.cpu]);
+			printf((line.offset ? ", read from $%06X\n" : "\n"), line.address + line.offset);
+		}
+		else if (line.address != (listing[i - 1].address + listing[i - 1].size))
+		{
+			printf("\n");
+		}
+
+		char * label = DBGManager_GetSymbolNameFromAdr(line.address);
+
+		if (label)
+		{
+			printf("%s:\n", label);
+		}
+
+		DasmBytes(line, bytes, " ");
+		DasmAnnotate(line, text, comment);
+		printf("%06X: %-24s  %s%s%s\n", line.address, bytes, text.c_str(), (comment.empty() ? "" : "\t; "), comment.c_str());
+	}
+}
+
+
+//
+static void DasmJSONString(const char * s)
+{
+	putchar('"');
+
+	for (; *s; s++)
+	{
+		if ((*s == '"') || (*s == '\\'))
+		{
+			printf("\\%c", *s);
+		}
+		else if ((uint8_t)*s < 0x20)
+		{
+			printf("\\u%04X", (uint8_t)*s);
+		}
+		else
+		{
+			putchar(*s);
+		}
+	}
+
+	putchar('"');
+}
+
+
+//
+static void DasmWriteJSON(const char * filename, const std::vector<DasmLine> & listing)
+{
+	std::string text, comment;
+	char bytes[64];
+
+	printf("{\n\t\"file\": ");
+	DasmJSONString(filename);
+	printf(",\n\t\"run\": %u,\n\t\"load\": { \"address\": %u, \"size\": %u },\n\t\"uploads\": [", jaguarRunAddress, jaguarLoadAddress, jaguarLoadSize);
+
+	for (size_t i = 0; i < dasmUploads.size(); i++)
+	{
+		printf("%s\n\t\t{ \"cpu\": \"%s\", \"run\": %u, \"source\": %u, \"site\": %u }", (i ? "," : ""), dasmCPUName[dasmUploads[i].cpu], dasmUploads[i].run, dasmUploads[i].source, dasmUploads[i].site);
+	}
+
+	printf("\n\t],\n\t\"code\": [");
+
+	for (size_t i = 0; i < listing.size(); i++)
+	{
+		const DasmLine & line = listing[i];
+		char * label = DBGManager_GetSymbolNameFromAdr(line.address);
+
+		DasmBytes(line, bytes, "");
+		DasmAnnotate(line, text, comment);
+		printf("%s\n\t\t{ \"cpu\": \"%s\", \"address\": %u, \"source\": %u, \"bytes\": \"%s\", \"text\": ", (i ? "," : ""), dasmCPUName[line.cpu], line.address, line.address + line.offset, bytes);
+		DasmJSONString(text.c_str());
+
+		if (label)
+		{
+			printf(", \"label\": ");
+			DasmJSONString(label);
+		}
+
+		if (!comment.empty())
+		{
+			printf(", \"comment\": ");
+			DasmJSONString(comment.c_str());
+		}
+
+		printf(" }");
+	}
+
+	printf("\n\t]\n}\n");
+}
+
+
+//
+// Address, in hexadecimal with a '$' or "0x" prefix, or in decimal
+//
+static uint32_t DasmParseAddress(const char * s, char ** end)
+{
+	return (uint32_t)((*s == '$') ? strtoul(s + 1, end, 16) : strtoul(s, end, 0));
+}
+
+
+//
+static void DasmUsage(void)
+{
+	printf("Usage: vjdis [options] <file>\n");
+	printf("Disassembles a ROM, ABS, COFF or ELF file; the code is followed from its run address\n");
+	printf("  -e <address>      68K entry point to follow too\n");
+	printf("  -r <start>-<end>  Disassemble the address range linearly instead\n");
+	printf("  -a                Disassemble the whole loaded software linearly instead\n");
+	printf("  -c <68k|gpu|dsp>  Processor of the following ranges (68K by default)\n");
+	printf("  -j                JSON output\n");
+	printf("  -t <threads>      Worker threads (hardware threads by default)\n");
+	printf("  -n                No hardware register names\n");
+	printf("  -l <file>         Write the emulator log to the file\n");
+}
+
+
+int main(int argc, char * argv[])
+{
+	std::vector<DasmRange> ranges;
+	std::vector<uint32_t> entries;
+	uint32_t threads = std::thread::hardware_concurrency();
+	uint8_t cpu = DASM_68K;
+	char * filename = NULL, * end;
+	bool json = false, whole = false;
+
+	memset(&vjs, 0, sizeof(vjs));
+	vjs.hardwareTypeNTSC = true;
+	vjs.biosType = BT_M_SERIES;
+	vjs.jaguarModel = JAG_M_SERIES;
+	vjs.allowWritesToROM = true;
+	vjs.allowWritesToUnknownLocation = true;
+	vjs.emulationThreadCPU = vjs.audioThreadCPU = vjs.workerThreadCPU = -1;
+	vjs.hugePagesType = HOST_HUGEPAGES_NONE;
+	vjs.DRAM_size = 0x200000;
+	vjs.displayHWlabels = true;
+
+	for (int i = 1; i < argc; i++)
+	{
+		bool value = ((i + 1) < argc);
+
+		if (!strcmp(argv[i], "-e") && value)
+		{
+			entries.push_back(DasmParseAddress(argv[++i], &end));
+		}
+		else if (!strcmp(argv[i], "-r") && value)
+		{
+			DasmRange range = { cpu, DasmParseAddress(argv[++i], &end), 0 };
+
+			if ((*end != '-') || ((range.end = DasmParseAddress(end + 1, &end)) <= range.start))
+			{
+				printf("Bad address range \"%s\"!\n", argv[i]);
+				return 1;
+			}
+
+			ranges.push_back(range);
+		}
+		else if (!strcmp(argv[i], "-a"))
+		{
+			whole = true;
+		}
+		else if (!strcmp(argv[i], "-c") && value)
+		{
+			i++;
+			cpu = (!strcmp(argv[i], "gpu") ? DASM_GPU : (!strcmp(argv[i], "dsp") ? DASM_DSP : DASM_68K));
+		}
+		else if (!strcmp(argv[i], "-j"))
+		{
+			json = true;
+		}
+		else if (!strcmp(argv[i], "-t") && value)
+		{
+			threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+		else if (!strcmp(argv[i], "-n"))
+		{
+			vjs.displayHWlabels = false;
+		}
+		else if (!strcmp(argv[i], "-l") && value)
+		{
+			LogInit(argv[++i]);
+		}
+		else if ((argv[i][0] != '-') && !filename)
+		{
+			filename = argv[i];
+		}
+		else
+		{
+			DasmUsage();
+			return 1;
+		}
+	}
+
+	if (!filename)
+	{
+		DasmUsage();
+		return 1;
+	}
+
+	threads = (threads ? threads : 1);
+
+	// The software is loaded over a cleared memory, for the same listing each time
+	DBGManager_Init();
+	JaguarInit();
+	SelectBIOS(vjs.biosType);
+	JaguarReset();
+	memset(jaguarMainRAM, 0, vjs.DRAM_size);
+
+	if (!JaguarLoadFile(filename))
+	{
+		printf("Could not load file \"%s\"!\n", filename);
+		DBGManager_Close();
+		JaguarDone();
+		return 1;
+	}
+
+	// The 68K decoder tables are made at the reset
+	SET32(jaguarMainRAM, 0, vjs.DRAM_size);
+	SET32(jaguarMainRAM, 4, jaguarRunAddress);
+	m68k_pulse_reset();
+
+	std::vector<DasmLine> listing;
+
+	if (whole && jaguarLoadSize)
+	{
+		DasmRange range = { cpu, jaguarLoadAddress, jaguarLoadAddress + jaguarLoadSize };
+		range.end = ((range.end > DASM_ROM_END) ? DASM_ROM_END : range.end);
+		ranges.push_back(range);
+	}
+
+	if (!ranges.empty())
+	{
+		DasmRanges(ranges, threads, listing);
+	}
+	else
+	{
+		DasmPushBlock(DASM_68K, jaguarRunAddress, 0);
+
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			DasmPushBlock(DASM_68K, entries[i], 0);
+		}
+
+		do
+		{
+			DasmRun(threads);
+		}
+		while (DasmResolveEntries());
+
+		for (std::map<uint64_t, DasmLine>::iterator i = dasmCode.begin(); i != dasmCode.end(); i++)
+		{
+			listing.push_back(i->second);
+		}
+	}
+
+	std::sort(dasmUploads.begin(), dasmUploads.end(), [](const DasmUpload & a, const DasmUpload & b)
+		{ return (a.cpu != b.cpu) ? (a.cpu < b.cpu) : ((a.run != b.run) ? (a.run < b.run) : (a.source < b.source)); });
+
+	if (json)
+	{
+		DasmWriteJSON(filename, listing);
+	}
+	else
+	{
+		DasmWriteText(filename, listing);
+	}
+
+	DBGManager_Close();
+	JaguarDone();
+	return 0;
+}
@@ -0,0 +1,548 @@
+//
+// Guest memory data watchpoints
+//
+// The host pages of the memory space holding a watched range are protected
+// (read-only for the write watches, no access for the read watches), so the
+// unwatched pages are accessed at the full speed, without any test in the
+// memory handlers. A guest access to a protected page faults: the fault
+// handler lifts the protection of the page and single-steps the host
+// instruction (x86 trap flag), then the trap handler checks the watched
+// bytes, records the hit, and protects the page again.
+//
+// The bus master is known through the host thread: the emulation loops set
+// it around the 68K, the GPU and the DSP slices, the blitter and the Object
+// Processor set it around their accesses. A write hit is found from the
+// bytes changed by the step, or from the faulting address (i.e. a write of
+// the same value), so the host stores wider than a byte are caught.
+//
+// The hits are recorded in a lock-free ring, the fault handler can interrupt
+// a thread at any point. The accesses of the OP speculation worker are
+// stepped, not recorded: they may be done again, or never committed; the
+// speculation is off while a read watchpoint is set.
+//
+// The protection is lifted for the whole process during the step, so a
+// concurrent access of another thread in the same page can be missed, and
+// the host system calls writing to a protected page (i.e. a file read
+// straight into the memory space) fail. The watchpoints need the x86-64
+// Linux host, and 4 KB host pages (no explicit huge pages).
+//
+// JPM = Jean-Paul Mari <djipi.mari@gmail.com>
+//
+// Who  When        What
+// ---  ----------  -----------------------------------------------------------
+// JPM   Oct./2026  Created this file
+// JPM   Oct./2026  Lock-free hits ring, OP speculation accesses not recorded
+//
+
+#include "watchpoint.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include "dsp.h"
+#include "gpu.h"
+#include "log.h"
+#include "memory.h"
+#include "m68000/m68kinterface.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+#include <errno.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#define WATCHPOINT_HOST
+#endif
+
+// Watchable space, the main RAM, the ROM & the cartridge (the chips registers & the local RAM are elsewhere)
+#define WATCHPOINT_SPACE	0xDFF000
+#define WATCHPOINT_PAGE_SHIFT	12
+#define WATCHPOINT_PAGE_SIZE	(1 << WATCHPOINT_PAGE_SHIFT)
+#define WATCHPOINT_PAGES	(WATCHPOINT_SPACE >> WATCHPOINT_PAGE_SHIFT)
+#define WATCHPOINT_HITS		256								// Hits ring size, a power of 2
+#define WATCHPOINT_STEP_MAX	2								// An access can straddle two pages
+#define WATCHPOINT_SNAPSHOT	8
+#define WATCHPOINT_TRAP_FLAG	0x100
+#define WATCHPOINT_WRITE_FAULT	0x02						// Page fault error code, write access
+
+// Hit slot of the ring, its sequence tells which turn of the ring it waits for
+struct WatchpointSlot
+{
+	std::atomic<uint32_t> sequence;
+	WatchpointHit hit;
+};
+
+struct Watchpoint
+{
+	uint32_t start, end;
+	uint32_t type;
+	bool used;
+};
+
+// Page unprotected for a step, and the bytes before the access
+struct WatchpointStep
+{
+	uint32_t page;
+	uint32_t address;
+	bool write;
+	uint32_t size;
+	uint8_t snapshot[WATCHPOINT_SNAPSHOT];
+};
+
+thread_local uint32_t watchpointMaster = UNKNOWN;
+
+static Watchpoint watchpoints[WATCHPOINT_MAX];
+static WatchpointSlot watchpointHits[WATCHPOINT_HITS];
+static std::atomic<uint32_t> watchpointHead(0), watchpointTail(0);
+static std::atomic<uint32_t> watchpointDropped(0);
+
+#ifdef WATCHPOINT_HOST
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "The hits ring needs lock-free atomics, it is filled by the fault handler");
+
+static int watchpointProtection[WATCHPOINT_PAGES];			// Current protection of each page
+static bool watchpointHandlers = false;
+static struct sigaction watchpointPreviousFault, watchpointPreviousTrap;
+static thread_local WatchpointStep watchpointSteps[WATCHPOINT_STEP_MAX];
+static thread_local uint32_t watchpointStepCount = 0;
+#endif
+
+
+#ifdef WATCHPOINT_HOST
+//
+// Protection a page needs, from the watchpoints over it
+//
+static int WatchpointPageProtection(uint32_t page)
+{
+	uint32_t start = page << WATCHPOINT_PAGE_SHIFT, end = start + WATCHPOINT_PAGE_SIZE;
+	int protection = PROT_READ | PROT_WRITE;
+
+	for (uint32_t i = 0; i < WATCHPOINT_MAX; i++)
+	{
+		if (watchpoints[i].used && (watchpoints[i].start < end) && (watchpoints[i].end > start))
+		{
+			if (watchpoints[i].type & WATCHPOINT_READ)
+			{
+				protection = PROT_NONE;
+			}
+			else if ((watchpoints[i].type & WATCHPOINT_WRITE) && (protection != PROT_NONE))
+			{
+				protection = PROT_READ;
+			}
+		}
+	}
+
+	return protection;
+}
+
+
+//
+// Protect the pages of a range as the watchpoints need
+//
+static bool WatchpointProtect(uint32_t start, uint32_t end)
+{
+	for (uint32_t page = (start >> WATCHPOINT_PAGE_SHIFT); page <= ((end - 1) >> WATCHPOINT_PAGE_SHIFT); page++)
+	{
+		int protection = WatchpointPageProtection(page);
+
+		if (mprotect(&jagMemSpace[page << WATCHPOINT_PAGE_SHIFT], WATCHPOINT_PAGE_SIZE, protection))
+		{
+			WriteLog("WATCH: Cannot protect the page $%06X (%s), the watchpoints need 4 KB host pages\n", page << WATCHPOINT_PAGE_SHIFT, ((errno == EINVAL) ? "explicit huge pages" : strerror(errno)));
+			return false;
+		}
+
+		watchpointProtection[page] = protection;
+	}
+
+	return true;
+}
+
+
+//
+// Give a fault which is not ours to the previous handler
+//
+static void WatchpointChain(int signal, siginfo_t * info, void * context, struct sigaction * previous)
+{
+	if (previous->sa_flags & SA_SIGINFO)
+	{
+		previous->sa_sigaction(signal, info, context);
+	}
+	else if ((previous->sa_handler != SIG_DFL) && (previous->sa_handler != SIG_IGN))
+	{
+		previous->sa_handler(signal);
+	}
+	else
+	{
+		// The signal is delivered again, at the return, with its default action
+		sigaction(signal, previous, NULL);
+		raise(signal);
+	}
+}
+
+
+//
+static uint32_t WatchpointPC(uint32_t who)
+{
+	switch (who)
+	{
+	case M68K:
+		return m68k_get_reg(NULL, M68K_REG_PC);
+
+	case GPU:
+		return GPUGetPC();
+
+	case DSP:
+		return DSPGetPC();
+
+	default:
+		return 0;
+	}
+}
+
+
+//
+// Record a hit, the hits come from the emulation and the DSP threads
+// A slot is claimed by moving the head, then published by its sequence
+//
+static void WatchpointRecord(uint32_t id, uint32_t address, bool write)
+{
+	WatchpointHit hit;
+
+	hit.id = id + 1;
+	hit.who = watchpointMaster;
+	hit.pc = WatchpointPC(watchpointMaster);
+	hit.address = address;
+	hit.value = 0;
+	hit.write = write;
+
+	// The value stays in the page, the next one can be unreadable
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		hit.value = (hit.value << 8) | ((((address + i) >> WATCHPOINT_PAGE_SHIFT) == (address >> WATCHPOINT_PAGE_SHIFT)) ? jagMemSpace[address + i] : 0);
+	}
+
+	uint32_t head = watchpointHead.load(std::memory_order_relaxed);
+	WatchpointSlot * slot = NULL;
+	bool claimed = false;
+
+	while (!claimed)
+	{
+		slot = &watchpointHits[head & (WATCHPOINT_HITS - 1)];
+		int32_t turn = (int32_t)(slot->sequence.load(std::memory_order_acquire) - head);
+
+		if (!turn)
+		{
+			// The head is reloaded by a failed exchange
+			claimed = watchpointHead.compare_exchange_weak(head, head + 1, std::memory_order_relaxed);
+		}
+		else if (turn < 0)
+		{
+			// Full, the slot has not been read yet
+			watchpointDropped.fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+		else
+		{
+			head = watchpointHead.load(std::memory_order_relaxed);
+		}
+	}
+
+	if (claimed)
+	{
+		slot->hit = hit;
+		slot->sequence.store(head + 1, std::memory_order_release);
+	}
+
+	if (watchpoints[id].type & WATCHPOINT_HALT)
+	{
+		M68KDebugHalt();
+	}
+}
+
+
+//
+// Watched bytes accessed by a stepped instruction
+// An access straddling two pages is a hit once, at its first watched byte
+//
+static void WatchpointCheck(const WatchpointStep & step, uint32_t & recorded)
+{
+	for (uint32_t i = 0; i < WATCHPOINT_MAX; i++)
+	{
+		const Watchpoint & watch = watchpoints[i];
+
+		if (!watch.used || (recorded & (1u << i)) || !(watch.type & (step.write ? WATCHPOINT_WRITE : WATCHPOINT_READ)))
+		{
+			continue;
+		}
+
+		uint32_t address = step.address;
+		bool hit = ((address >= watch.start) && (address < watch.end));
+
+		// The first changed byte of the range, for the wide stores starting before the range
+		for (uint32_t j = 0; step.write && !hit && (j < step.size); j++)
+		{
+			if ((jagMemSpace[step.address + j] != step.snapshot[j]) && ((step.address + j) >= watch.start) && ((step.address + j) < watch.end))
+			{
+				address = step.address + j;
+				hit = true;
+			}
+		}
+
+		if (hit)
+		{
+			WatchpointRecord(i, address, step.write);
+			recorded |= (1u << i);
+		}
+	}
+}
+
+
+//
+// Access to a protected page, the protection is lifted for a single step
+//
+static void WatchpointFault(int signal, siginfo_t * info, void * context)
+{
+	ucontext_t * uc = (ucontext_t *)context;
+	uintptr_t address = (uintptr_t)info->si_addr - (uintptr_t)jagMemSpace;
+
+	if ((info->si_code != SEGV_ACCERR) || (address >= WATCHPOINT_SPACE) || (watchpointProtection[address >> WATCHPOINT_PAGE_SHIFT] == (PROT_READ | PROT_WRITE)) || (watchpointStepCount == WATCHPOINT_STEP_MAX))
+	{
+		WatchpointChain(signal, info, context, &watchpointPreviousFault);
+		return;
+	}
+
+	WatchpointStep & step = watchpointSteps[watchpointStepCount++];
+	step.page = address >> WATCHPOINT_PAGE_SHIFT;
+	step.address = address;
+	step.write = (uc->uc_mcontext.gregs[REG_ERR] & WATCHPOINT_WRITE_FAULT) != 0;
+	mprotect(&jagMemSpace[step.page << WATCHPOINT_PAGE_SHIFT], WATCHPOINT_PAGE_SIZE, PROT_READ | PROT_WRITE);
+
+	// The snapshot stays in the page, the next one can be unreadable
+	step.size = WATCHPOINT_PAGE_SIZE - (address & (WATCHPOINT_PAGE_SIZE - 1));
+	step.size = ((step.size < WATCHPOINT_SNAPSHOT) ? step.size : WATCHPOINT_SNAPSHOT);
+	memcpy(step.snapshot, &jagMemSpace[address], step.size);
+
+	uc->uc_mcontext.gregs[REG_EFL] |= WATCHPOINT_TRAP_FLAG;
+}
+
+
+//
+// The faulting instruction has been stepped, the pages are protected again
+//
+static void WatchpointTrap(int signal, siginfo_t * info, void * context)
+{
+	ucontext_t * uc = (ucontext_t *)context;
+
+	if (!watchpointStepCount)
+	{
+		WatchpointChain(signal, info, context, &watchpointPreviousTrap);
+		return;
+	}
+
+	uc->uc_mcontext.gregs[REG_EFL] &= ~WATCHPOINT_TRAP_FLAG;
+	uint32_t recorded = 0;
+
+	for (uint32_t i = 0; (watchpointMaster != WATCHPOINT_UNWATCHED) && (i < watchpointStepCount); i++)
+	{
+		WatchpointCheck(watchpointSteps[i], recorded);
+	}
+
+	for (uint32_t i = 0; i < watchpointStepCount; i++)
+	{
+		mprotect(&jagMemSpace[watchpointSteps[i].page << WATCHPOINT_PAGE_SHIFT], WATCHPOINT_PAGE_SIZE, watchpointProtection[watchpointSteps[i].page]);
+	}
+
+	watchpointStepCount = 0;
+}
+
+
+//
+// Fault & trap handlers, installed at the first watchpoint
+//
+static bool WatchpointInstall(void)
+{
+	struct sigaction action;
+
+	if (watchpointHandlers)
+	{
+		return true;
+	}
+
+	for (uint32_t i = 0; i < WATCHPOINT_PAGES; i++)
+	{
+		watchpointProtection[i] = PROT_READ | PROT_WRITE;
+	}
+
+	// Each slot waits for the first turn of the ring
+	for (uint32_t i = 0; i < WATCHPOINT_HITS; i++)
+	{
+		watchpointHits[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	memset(&action, 0, sizeof(action));
+	sigemptyset(&action.sa_mask);
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	action.sa_sigaction = WatchpointFault;
+
+	if (sigaction(SIGSEGV, &action, &watchpointPreviousFault))
+	{
+		WriteLog("WATCH: Cannot install the fault handler\n");
+		return false;
+	}
+
+	action.sa_sigaction = WatchpointTrap;
+
+	if (sigaction(SIGTRAP, &action, &watchpointPreviousTrap))
+	{
+		sigaction(SIGSEGV, &watchpointPreviousFault, NULL);
+		WriteLog("WATCH: Cannot install the trap handler\n");
+		return false;
+	}
+
+	return (watchpointHandlers = true);
+}
+#endif
+
+
+//
+// Add a watchpoint, its identifier is returned (0 if it cannot be added)
+//
+uint32_t WatchpointAdd(uint32_t address, uint32_t size, uint32_t type)
+{
+#ifdef WATCHPOINT_HOST
+	if (!size || !(type & (WATCHPOINT_READ | WATCHPOINT_WRITE)) || (address >= WATCHPOINT_SPACE) || (size > (WATCHPOINT_SPACE - address)))
+	{
+		WriteLog("WATCH: Cannot watch $%06X-$%06X, out of the main RAM, the ROM & the cartridge\n", address, address + size);
+		return 0;
+	}
+
+	if (!WatchpointInstall())
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < WATCHPOINT_MAX; i++)
+	{
+		if (!watchpoints[i].used)
+		{
+			watchpoints[i].start = address;
+			watchpoints[i].end = address + size;
+			watchpoints[i].type = type;
+			watchpoints[i].used = true;
+
+			if (!WatchpointProtect(address, address + size))
+			{
+				watchpoints[i].used = false;
+				WatchpointProtect(address, address + size);
+				return 0;
+			}
+
+			return (i + 1);
+		}
+	}
+
+	WriteLog("WATCH: No more watchpoints (%u)\n", WATCHPOINT_MAX);
+#else
+	(void)address;
+	(void)size;
+	(void)type;
+	WriteLog("WATCH: The watchpoints need the x86-64 Linux host\n");
+#endif
+	return 0;
+}
+
+
+//
+bool WatchpointRemove(uint32_t id)
+{
+	if (!id || (id > WATCHPOINT_MAX) || !watchpoints[id - 1].used)
+	{
+		return false;
+	}
+
+	watchpoints[id - 1].used = false;
+#ifdef WATCHPOINT_HOST
+	WatchpointProtect(watchpoints[id - 1].start, watchpoints[id - 1].end);
+#endif
+	return true;
+}
+
+
+//
+void WatchpointClear(void)
+{
+	for (uint32_t i = 1; i <= WATCHPOINT_MAX; i++)
+	{
+		WatchpointRemove(i);
+	}
+}
+
+
+//
+// Read watchpoint set
+//
+bool WatchpointReadWatched(void)
+{
+	for (uint32_t i = 0; i < WATCHPOINT_MAX; i++)
+	{
+		if (watchpoints[i].used && (watchpoints[i].type & WATCHPOINT_READ))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+// Next hit, for the consumer
+//
+bool WatchpointGetHit(WatchpointHit * hit)
+{
+	uint32_t tail = watchpointTail.load(std::memory_order_relaxed);
+
+	while (true)
+	{
+		WatchpointSlot & slot = watchpointHits[tail & (WATCHPOINT_HITS - 1)];
+		int32_t turn = (int32_t)(slot.sequence.load(std::memory_order_acquire) - (tail + 1));
+
+		// Not published yet
+		if (turn < 0)
+		{
+			return false;
+		}
+
+		if (!turn && watchpointTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+		{
+			*hit = slot.hit;
+			// Free for the next turn of the ring
+			slot.sequence.store(tail + WATCHPOINT_HITS, std::memory_order_release);
+			return true;
+		}
+
+		if (turn > 0)
+		{
+			tail = watchpointTail.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+
+//
+// Hits dropped by a full ring
+//
+uint32_t WatchpointDropped(void)
+{
+	return watchpointDropped.load(std::memory_order_relaxed);
+}
+
+
+//
+// Hit as a text line
+//
+void WatchpointFormat(const WatchpointHit * hit, char * buffer, uint32_t size)
+{
+	char pc[16];
+
+	sprintf(pc, (hit->pc ? "$%06X" : "N/A"), hit->pc);
+	snprintf(buffer, size, "#%u %s %s at $%06X (PC %s), memory $%08X", hit->id, whoName[hit->who], (hit->write ? "write" : "read"), hit->address, pc, hit->value);
+}
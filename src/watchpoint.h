@@ -0,0 +1,46 @@
+//
+// watchpoint.h: Header file
+//
+// Guest memory data watchpoints, with the host pages of the watched ranges
+// protected and the accesses caught by the host faults
+//
+
+#ifndef __WATCHPOINT_H__
+#define __WATCHPOINT_H__
+
+#include <stdint.h>
+
+#define WATCHPOINT_MAX		32
+
+// Watch type, as a mask
+// WATCHPOINT_READ     reads of the range (the whole host page is made unreadable)
+// WATCHPOINT_WRITE    writes to the range
+// WATCHPOINT_HALT     the M68K is halted on a hit
+#define WATCHPOINT_READ		0x01
+#define WATCHPOINT_WRITE	0x02
+#define WATCHPOINT_HALT		0x04
+
+struct WatchpointHit
+{
+	uint32_t id;								// Watchpoint hit
+	uint32_t who, pc;							// Bus master, and its PC (0 for the blitter & the OP)
+	uint32_t address;							// First watched byte accessed
+	uint32_t value;								// Memory at the address after the access (big endian long)
+	bool write;
+};
+
+// Bus master running on the current host thread, set by the emulation loops
+// WATCHPOINT_UNWATCHED for a thread whose accesses are not recorded (i.e. the OP speculation worker)
+#define WATCHPOINT_UNWATCHED	0xFFFFFFFF
+
+extern thread_local uint32_t watchpointMaster;
+
+extern uint32_t WatchpointAdd(uint32_t address, uint32_t size, uint32_t type);
+extern bool WatchpointRemove(uint32_t id);
+extern void WatchpointClear(void);
+extern bool WatchpointReadWatched(void);
+extern bool WatchpointGetHit(WatchpointHit * hit);
+extern uint32_t WatchpointDropped(void);
+extern void WatchpointFormat(const WatchpointHit * hit, char * buffer, uint32_t size);
+
+#endif	// __WATCHPOINT_H__
@@ -58,6 +58,13 @@ QMAKE_CXXFLAGS += `$(CROSS)sdl-config --cflags`
 
 # Need to add libcdio stuffola (checking/including)...
 
+# Lua scripting (optional)
+packagesExist(lua5.3) {
+	DEFINES += HAVE_LIB_LUA
+	CONFIG += link_pkgconfig
+	PKGCONFIG += lua5.3
+}
+
 # Translations. NB: Nobody has stepped up to do any :-P so these are dummy
 # translations
 # Removed for now, they interfere with proper running in non-English locales for
@@ -102,6 +109,7 @@ HEADERS = \
 	src/gui/mainwin.h \
 	src/gui/profile.h \
 	src/gui/emustatus.h \
+	src/gui/debugportwin.h \
 	src/gui/debug/cpubrowser.h \
 	src/gui/debug/hwregsblitterbrowser.h \
 	src/gui/debug/m68kdasmbrowser.h \
@@ -124,6 +132,7 @@ HEADERS = \
 	src/debugger/allwatchbrowser.h \
 	src/debugger/localbrowser.h \
 	src/debugger/DWARFManager.h \
+	src/debugger/VARPROGManager.h \
 	src/debugger/memory1browser.h \
 	src/debugger/heapallocatorbrowser.h \
 	src/debugger/BreakpointsWin.h \
@@ -139,6 +148,8 @@ HEADERS = \
 	src/crc32.h \
 	src/settings.h \
 	src/file.h \
+	src/forkserver.h \
+	src/headless.h \
 	src/LEB128.h
 
 SOURCES = \
@@ -163,6 +174,7 @@ SOURCES = \
 	src/gui/mainwin.cpp \
 	src/gui/profile.cpp \
 	src/gui/emustatus.cpp \
+	src/gui/debugportwin.cpp \
 	src/gui/debug/cpubrowser.cpp \
 	src/gui/debug/hwregsblitterbrowser.cpp \
 	src/gui/debug/m68kdasmbrowser.cpp \
@@ -185,6 +197,7 @@ SOURCES = \
 	src/debugger/allwatchbrowser.cpp \
 	src/debugger/localbrowser.cpp \
 	src/debugger/DWARFManager.cpp \
+	src/debugger/VARPROGManager.cpp \
 	src/debugger/memory1browser.cpp \
 	src/debugger/heapallocatorbrowser.cpp \
 	src/debugger/BreakpointsWin.cpp \
@@ -200,5 +213,7 @@ SOURCES = \
 	src/crc32.cpp \
 	src/settings.cpp \
 	src/file.cpp \
+	src/forkserver.cpp \
+	src/headless.cpp \
 	src/LEB128.cpp
 		
@@ -0,0 +1,108 @@
+#
+# Makefile for vjdis, the Virtual Jaguar offline disassembler
+#
+# by Jean-Paul Mari
+#
+# This software is licensed under the GPL v3 or any later version. See the
+# file LICENSE file for details. ;-)
+#
+# The tool is linked with the core & the 68K libraries (make libs), with the
+# file loading and the ELF/DWARF managers of the debugger:
+#     make vjdis
+#     ./vjdis [options] <file>
+#
+# The listings of the sample binaries are checked against their golden outputs,
+# made with one and with several threads:
+#     make -f vjdis.mak check
+#
+
+ifeq ("$(V)","1")
+Q :=
+else
+Q := @
+endif
+
+# The core library may use libcdio & the Lua scripting
+ifneq "$(shell pkg-config --silence-errors --libs libcdio)" ""
+CDIOLIB  := -lcdio
+else
+CDIOLIB  :=
+endif
+
+ifneq "$(shell pkg-config --silence-errors --libs lua5.3)" ""
+LUA_LIBS := $(shell pkg-config --libs lua5.3)
+else
+LUA_LIBS :=
+endif
+
+CC         := $(CROSS)gcc
+CXX        := $(CROSS)g++
+SDL_CFLAGS = `$(CROSS)sdl-config --cflags`
+SDL_LIBS   = `$(CROSS)sdl-config --libs`
+QT_CFLAGS  = -fPIC $(shell pkg-config --cflags Qt5Widgets)
+QT_LIBS    = $(shell pkg-config --libs Qt5Widgets)
+DEFINES    = -D__GCCUNIX__
+CFLAGS    ?= -O2
+CXXFLAGS  ?= -O2
+
+INCS := -I./src -I./src/m68000 -I/usr/include/libdwarf
+
+OBJDIR := obj/vjdis
+
+OBJS := \
+	$(OBJDIR)/crc32.o                   \
+	$(OBJDIR)/file.o                    \
+	$(OBJDIR)/LEB128.o                  \
+	$(OBJDIR)/log.o                     \
+	$(OBJDIR)/unzip.o                   \
+	$(OBJDIR)/vjdis.o                   \
+	$(OBJDIR)/debugger/DBGManager.o     \
+	$(OBJDIR)/debugger/DWARFManager.o   \
+	$(OBJDIR)/debugger/ELFManager.o     \
+	$(OBJDIR)/debugger/HWLABELManager.o \
+	$(OBJDIR)/debugger/VARPROGManager.o
+
+LIBS := obj/libjaguarcore.a obj/libm68k.a
+
+# Sample binaries, and the options of each listing: ABS with a GPU upload, ELF
+# with its symbols, zipped cartridge with a DSP upload, and ranges of it
+TESTDIR := src/tests/vjdis
+
+define CHECK_LISTING
+	$(Q)./vjdis -t 1 $(2) $(TESTDIR)/$(1) | diff -u $(TESTDIR)/$(3) -
+	$(Q)./vjdis -t 4 $(2) $(TESTDIR)/$(1) | diff -u $(TESTDIR)/$(3) -
+endef
+
+# Targets for convenience sake, not "real" targets
+.PHONY: clean check
+
+all: vjdis
+	@echo "Done!"
+
+$(OBJDIR):
+	@mkdir -p $(OBJDIR)/debugger
+
+vjdis: $(OBJDIR) $(OBJS) $(LIBS)
+	@echo -e "\033[01;33m***\033[00;32m Linking the vjdis disassembler...\033[00m"
+	$(Q)$(CXX) $(OBJS) $(LIBS) -o vjdis $(SDL_LIBS) $(QT_LIBS) $(CDIOLIB) $(LUA_LIBS) -lelf -ldwarf -lz -pthread
+
+# Main source compilation (implicit rules)...
+
+$(OBJDIR)/%.o: src/%.cpp
+	@echo -e "\033[01;33m***\033[00;32m Compiling $<...\033[00m"
+	$(Q)$(CXX) -MMD $(CXXFLAGS) $(SDL_CFLAGS) $(QT_CFLAGS) $(DEFINES) $(INCS) -c $< -o $@
+
+check: vjdis
+	@echo -e "\033[01;33m***\033[00;32m Checking the vjdis listings...\033[00m"
+	$(call CHECK_LISTING,upload.abs,,upload.txt)
+	$(call CHECK_LISTING,upload.abs,-j,upload.json)
+	$(call CHECK_LISTING,symbols.elf,,symbols.txt)
+	$(call CHECK_LISTING,symbols.elf,-j,symbols.json)
+	$(call CHECK_LISTING,cart.zip,,cart.txt)
+	$(call CHECK_LISTING,cart.zip,-n -r 0x802000-0x802044 -c dsp -r 0x802100-0x802110,ranges.txt)
+	@echo "All the listings match"
+
+clean:
+	@-rm -rf $(OBJDIR) vjdis
+
+-include $(OBJDIR)/*.d $(OBJDIR)/debugger/*.d